@@ -6,6 +6,7 @@
 #ifndef GDCORE_LINKEVENT_H
 #define GDCORE_LINKEVENT_H
 #include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
 #include "GDCore/String.h"
 
 namespace gd {
@@ -41,7 +42,10 @@ class GD_CORE_API LinkEvent : public gd::BaseEvent {
    * Change the link target (i.e. the scene or external events the link refers
    * to).
    */
-  void SetTarget(const gd::String& target_) { target = target_; };
+  void SetTarget(const gd::String& target_) {
+    target = target_;
+    gd::EventsList::NotifyLinksModified();
+  };
 
   /**
    * Return the include config.
@@ -0,0 +1,111 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/CodeGenerationReport.h"
+
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+const char *GetEntryTypeName(gd::CodeGenerationReport::EntryType type) {
+  switch (type) {
+    case gd::CodeGenerationReport::Scene:
+      return "scene";
+    case gd::CodeGenerationReport::EventsGroup:
+      return "eventsGroup";
+    case gd::CodeGenerationReport::EventsFunction:
+      return "eventsFunction";
+  }
+  return "";
+}
+}  // namespace
+
+namespace gd {
+
+constexpr std::size_t CodeGenerationReport::NoParent;
+
+void CodeGenerationReport::BeginEntry(EntryType type,
+                                      const gd::String &name,
+                                      const gd::String &codeNamespace) {
+  Entry entry;
+  entry.type = type;
+  entry.name = name;
+  entry.codeNamespace = codeNamespace;
+  entry.parent = openedEntries.empty() ? NoParent : openedEntries.back();
+
+  openedEntries.push_back(entries.size());
+  entries.push_back(std::move(entry));
+}
+
+void CodeGenerationReport::EndEntry(std::size_t codeSize) {
+  if (openedEntries.empty()) return;
+
+  entries[openedEntries.back()].codeSize = codeSize;
+  openedEntries.pop_back();
+}
+
+void CodeGenerationReport::SetProfilerSectionId(int profilerSectionId) {
+  if (openedEntries.empty()) return;
+
+  entries[openedEntries.back()].profilerSectionId = profilerSectionId;
+}
+
+void CodeGenerationReport::AddObjectListsDeclared(std::size_t count) {
+  for (std::size_t index : openedEntries)
+    entries[index].objectListsDeclared += count;
+}
+
+void CodeGenerationReport::AddObjectListsCopied(std::size_t count) {
+  for (std::size_t index : openedEntries)
+    entries[index].objectListsCopied += count;
+}
+
+void CodeGenerationReport::AddAsyncCallback() {
+  for (std::size_t index : openedEntries) entries[index].asyncCallbacks++;
+}
+
+void CodeGenerationReport::Append(const CodeGenerationReport &other) {
+  std::size_t offset = entries.size();
+  for (const auto &otherEntry : other.entries) {
+    entries.push_back(otherEntry);
+    if (otherEntry.parent != NoParent) entries.back().parent += offset;
+  }
+}
+
+gd::String CodeGenerationReport::ToJSON() const {
+  gd::SerializerElement element;
+
+  auto &entriesElement = element.AddChild("entries");
+  entriesElement.ConsiderAsArrayOf("entry");
+  for (const auto &entry : entries) {
+    auto &entryElement = entriesElement.AddChild("entry");
+    entryElement.SetAttribute("type", gd::String(GetEntryTypeName(entry.type)))
+        .SetAttribute("name", entry.name)
+        .SetAttribute("parent",
+                      entry.parent == NoParent
+                          ? -1
+                          : static_cast<int>(entry.parent))
+        .SetAttribute("codeSize", static_cast<double>(entry.codeSize))
+        .SetAttribute("objectListsDeclared",
+                      static_cast<double>(entry.objectListsDeclared))
+        .SetAttribute("objectListsCopied",
+                      static_cast<double>(entry.objectListsCopied))
+        .SetAttribute("asyncCallbacks",
+                      static_cast<double>(entry.asyncCallbacks));
+    if (!entry.codeNamespace.empty())
+      entryElement.SetAttribute("codeNamespace", entry.codeNamespace);
+    if (entry.profilerSectionId != -1)
+      entryElement.SetAttribute("profilerSectionId", entry.profilerSectionId);
+  }
+
+  return gd::Serializer::ToJSON(element);
+}
+
+void CodeGenerationReport::Clear() {
+  entries.clear();
+  openedEntries.clear();
+}
+
+}  // namespace gd
@@ -0,0 +1,127 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief The size of the code generated for scenes, groups of events and
+ * events functions, with what makes the generated code costly at runtime:
+ * the objects lists declared and copied (`gdjs.copyArray`) and the callbacks
+ * of asynchronous actions.
+ *
+ * Used to find which events produce the most code and are worth optimizing.
+ * The groups of events have the id of their section in
+ * `gdjs.EventsSectionsTimings` when the code is generated with events
+ * profiling, so that the report can be matched with the timings measured at
+ * runtime.
+ *
+ * Entries are nested (a group of events is a child of the scene, of the
+ * events function or of the group containing it) and their sizes and counts
+ * include their children. Events functions are the free functions and the
+ * functions of events based behaviors and objects.
+ *
+ * \see gd::EventsCodeGenerator::SetCodeGenerationReport
+ */
+class GD_CORE_API CodeGenerationReport {
+ public:
+  enum EntryType {
+    Scene,
+    EventsGroup,
+    EventsFunction,
+  };
+
+  static constexpr std::size_t NoParent = static_cast<std::size_t>(-1);
+
+  /**
+   * \brief A scene, a group of events or an events function.
+   */
+  struct Entry {
+    EntryType type;
+    gd::String name;
+    gd::String codeNamespace;  ///< The namespace of the generated code, for
+                               ///< scenes and events functions.
+    std::size_t parent = NoParent;  ///< The index of the enclosing entry.
+    int profilerSectionId = -1;  ///< The id of the section measured by the
+                                 ///< events profiling, if any.
+    std::size_t codeSize = 0;  ///< In bytes.
+    std::size_t objectListsDeclared = 0;
+    std::size_t objectListsCopied = 0;
+    std::size_t asyncCallbacks = 0;
+  };
+
+  CodeGenerationReport(){};
+  virtual ~CodeGenerationReport(){};
+
+  /**
+   * \brief Start an entry, nested in the entry not ended yet (if any).
+   */
+  void BeginEntry(EntryType type,
+                  const gd::String &name,
+                  const gd::String &codeNamespace = "");
+
+  /**
+   * \brief End the last entry begun, with the size of the code generated for
+   * it.
+   */
+  void EndEntry(std::size_t codeSize);
+
+  /**
+   * \brief Set the id of the section measured by the events profiling for
+   * the last entry begun.
+   */
+  void SetProfilerSectionId(int profilerSectionId);
+
+  /**
+   * \brief Count objects lists declared, for the entries not ended yet.
+   */
+  void AddObjectListsDeclared(std::size_t count = 1);
+
+  /**
+   * \brief Count objects lists copied, for the entries not ended yet.
+   */
+  void AddObjectListsCopied(std::size_t count = 1);
+
+  /**
+   * \brief Count a callback of an asynchronous action, for the entries not
+   * ended yet.
+   */
+  void AddAsyncCallback();
+
+  /**
+   * \brief Add the entries of another report after the entries of this one,
+   * keeping them nested the same way.
+   *
+   * Useful to merge the reports filled by code generators running in
+   * parallel.
+   */
+  void Append(const CodeGenerationReport &other);
+
+  std::size_t GetEntriesCount() const { return entries.size(); }
+  const Entry &GetEntry(std::size_t index) const { return entries[index]; }
+
+  /**
+   * \brief Return the report, as JSON.
+   */
+  gd::String ToJSON() const;
+
+  /**
+   * \brief Remove all the entries.
+   */
+  void Clear();
+
+ private:
+  std::vector<Entry> entries;
+  std::vector<std::size_t> openedEntries;  ///< Indexes of the entries begun
+                                           ///< and not ended yet.
+};
+
+}  // namespace gd
@@ -0,0 +1,79 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A list of chunks of generated code, concatenated only once when
+ * the whole code is done.
+ *
+ * Appending a chunk moves it into the buffer (when it's a temporary), so
+ * that big chunks of code (like the code of a list of events) are not
+ * copied each time they are appended to a bigger one.
+ *
+ * \ingroup CodeGeneration
+ */
+class CodeOutputBuffer {
+ public:
+  CodeOutputBuffer() : size(0){};
+
+  /**
+   * \brief Add a chunk of code at the end of the buffer.
+   */
+  CodeOutputBuffer& Append(gd::String chunk) {
+    if (chunk.empty()) return *this;
+
+    size += chunk.Raw().size();
+    chunks.push_back(std::move(chunk));
+    return *this;
+  }
+
+  CodeOutputBuffer& operator+=(gd::String chunk) {
+    return Append(std::move(chunk));
+  }
+
+  /**
+   * \brief Return the size, in bytes, of the code in the buffer.
+   */
+  std::size_t GetSize() const { return size; }
+
+  bool IsEmpty() const { return size == 0; }
+
+  /**
+   * \brief Add all the code of the buffer at the end of \a output, allocating
+   * the memory only once.
+   */
+  void AppendTo(gd::String& output) const {
+    output.reserve(output.Raw().size() + size);
+    for (const auto& chunk : chunks) output += chunk;
+  }
+
+  /**
+   * \brief Return all the code of the buffer.
+   */
+  gd::String ToString() const {
+    gd::String output;
+    AppendTo(output);
+    return output;
+  }
+
+  void Clear() {
+    chunks.clear();
+    size = 0;
+  }
+
+ private:
+  std::vector<gd::String> chunks;
+  std::size_t size;  ///< The sum of the sizes of the chunks, in bytes.
+};
+
+}  // namespace gd
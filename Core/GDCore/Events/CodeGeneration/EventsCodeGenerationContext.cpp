@@ -20,24 +20,16 @@ void EventsCodeGenerationContext::InheritsFrom(
   parent = &parent_;
 
   // Objects lists declared by parent became "already declared" in the child
-  // context.
-  alreadyDeclaredObjectsLists = parent_.alreadyDeclaredObjectsLists;
-  std::copy(parent_.objectsListsToBeDeclared.begin(),
-            parent_.objectsListsToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
-  std::copy(parent_.objectsListsOrEmptyToBeDeclared.begin(),
-            parent_.objectsListsOrEmptyToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
-  std::copy(parent_.emptyObjectsListsToBeDeclared.begin(),
-            parent_.emptyObjectsListsToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
+  // context. They are shared with the parent (and its other children)
+  // rather than copied.
+  alreadyDeclaredObjectsLists = parent_.GetDeclaredObjectsListsLayer();
+  declaredObjectsListsLayer.reset();
 
   nearestAsyncParent = parent_.IsAsyncCallback() ? &parent_ : parent_.nearestAsyncParent;
   asyncDepth = parent_.asyncDepth;
-  depthOfLastUse = parent_.depthOfLastUse;
+  depthOfLastUse.clear();
+  parentsDepthOfLastUse = parent_.GetDepthsOfLastUseLayer();
+  depthsOfLastUseLayer.reset();
   customConditionDepth = parent_.customConditionDepth;
   contextDepth = parent_.GetContextDepth() + 1;
   if (parent_.maxDepthLevel) {
@@ -68,39 +60,123 @@ void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd
     asyncContext->allObjectsListToBeDeclaredAcrossChildren.insert(objectName);
 }
 
+std::shared_ptr<const EventsCodeGenerationContext::DeclaredObjectsListsLayer>
+EventsCodeGenerationContext::GetDeclaredObjectsListsLayer() const {
+  if (declaredObjectsListsLayer) return declaredObjectsListsLayer;
+
+  if (objectsListsToBeDeclared.empty() &&
+      objectsListsOrEmptyToBeDeclared.empty() &&
+      emptyObjectsListsToBeDeclared.empty()) {
+    declaredObjectsListsLayer = alreadyDeclaredObjectsLists;
+    return declaredObjectsListsLayer;
+  }
+
+  auto layer = std::make_shared<DeclaredObjectsListsLayer>();
+  layer->previous = alreadyDeclaredObjectsLists;
+  layer->names = GetAllObjectsToBeDeclared();
+  declaredObjectsListsLayer = layer;
+  return declaredObjectsListsLayer;
+}
+
+std::shared_ptr<const EventsCodeGenerationContext::DepthsOfLastUseLayer>
+EventsCodeGenerationContext::GetDepthsOfLastUseLayer() const {
+  if (depthsOfLastUseLayer) return depthsOfLastUseLayer;
+
+  if (depthOfLastUse.empty()) {
+    depthsOfLastUseLayer = parentsDepthOfLastUse;
+    return depthsOfLastUseLayer;
+  }
+
+  auto layer = std::make_shared<DepthsOfLastUseLayer>();
+  layer->previous = parentsDepthOfLastUse;
+  layer->depths = depthOfLastUse;
+  depthsOfLastUseLayer = layer;
+  return depthsOfLastUseLayer;
+}
+
+bool EventsCodeGenerationContext::ObjectAlreadyDeclaredByParents(
+    const gd::String& objectName) const {
+  for (const DeclaredObjectsListsLayer* layer =
+           alreadyDeclaredObjectsLists.get();
+       layer;
+       layer = layer->previous.get()) {
+    if (layer->names.find(objectName) != layer->names.end()) return true;
+  }
+
+  return false;
+}
+
+const std::set<gd::String>&
+EventsCodeGenerationContext::GetObjectsListsAlreadyDeclaredByParents() const {
+  alreadyDeclaredObjectsListsSet.clear();
+  for (const DeclaredObjectsListsLayer* layer =
+           alreadyDeclaredObjectsLists.get();
+       layer;
+       layer = layer->previous.get()) {
+    alreadyDeclaredObjectsListsSet.insert(layer->names.begin(),
+                                          layer->names.end());
+  }
+
+  return alreadyDeclaredObjectsListsSet;
+}
+
+void EventsCodeGenerationContext::AddObjectsListToBeDeclared(
+    std::set<gd::String>& objectsLists, const gd::String& objectName) {
+  objectsLists.insert(objectName);
+  declaredObjectsListsLayer.reset();
+}
+
+void EventsCodeGenerationContext::SetDepthOfLastUse(
+    const gd::String& objectName) {
+  depthOfLastUse[objectName] = GetContextDepth();
+  depthsOfLastUseLayer.reset();
+}
+
 void EventsCodeGenerationContext::ObjectsListNeeded(
     const gd::String& objectName) {
   if (!IsToBeDeclared(objectName)) {
-    objectsListsToBeDeclared.insert(objectName);
+    AddObjectsListToBeDeclared(objectsListsToBeDeclared, objectName);
 
     if (IsInsideAsync()) {
       NotifyAsyncParentsAboutDeclaredObject(objectName);
     }
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  SetDepthOfLastUse(objectName);
+}
+
+void EventsCodeGenerationContext::ObjectsListNeededForReading(
+    const gd::String& objectName) {
+  // *Optimization*: the list is not modified in this context, so it's the same
+  // as the one of the parent and there is no need to copy it.
+  // The depth of last use is kept, so that the list of the parent is used.
+  if (!IsToBeDeclared(objectName) &&
+      ObjectAlreadyDeclaredByParents(objectName) && !IsInsideAsync())
+    return;
+
+  ObjectsListNeeded(objectName);
 }
 
 void EventsCodeGenerationContext::ObjectsListNeededOrEmptyIfJustDeclared(
     const gd::String& objectName) {
   if (!IsToBeDeclared(objectName)) {
-    objectsListsOrEmptyToBeDeclared.insert(objectName);
+    AddObjectsListToBeDeclared(objectsListsOrEmptyToBeDeclared, objectName);
 
     if (IsInsideAsync()) {
       NotifyAsyncParentsAboutDeclaredObject(objectName);
     }
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  SetDepthOfLastUse(objectName);
 }
 
 void EventsCodeGenerationContext::EmptyObjectsListNeeded(
     const gd::String& objectName) {
   if (!IsToBeDeclared(objectName)) {
-    emptyObjectsListsToBeDeclared.insert(objectName);
+    AddObjectsListToBeDeclared(emptyObjectsListsToBeDeclared, objectName);
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  SetDepthOfLastUse(objectName);
 }
 
 std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
@@ -117,7 +193,14 @@ std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
 
 unsigned int EventsCodeGenerationContext::GetLastDepthObjectListWasNeeded(
     const gd::String& name) const {
-  if (depthOfLastUse.count(name) != 0) return depthOfLastUse.find(name)->second;
+  auto it = depthOfLastUse.find(name);
+  if (it != depthOfLastUse.end()) return it->second;
+
+  for (const DepthsOfLastUseLayer* layer = parentsDepthOfLastUse.get(); layer;
+       layer = layer->previous.get()) {
+    auto layerIt = layer->depths.find(name);
+    if (layerIt != layer->depths.end()) return layerIt->second;
+  }
 
   std::cout << "WARNING: During code generation, the last depth of an object "
                "list was 0."
@@ -116,6 +116,23 @@ class GD_CORE_API EventsCodeGenerationContext {
    */
   void ObjectsListNeeded(const gd::String& objectName);
 
+  /**
+   * \brief Call this when an instruction in the event only reads an objects
+   * list, without picking objects or adding objects to it (for example, an
+   * action run on each of the objects).
+   *
+   * If the list is declared by a parent (and not yet in this context), the list
+   * of the parent is used as is instead of being copied in a new list, as it
+   * would be exactly the same. Otherwise, this is the same as
+   * ObjectsListNeeded. Lists used inside asynchronous callbacks are always
+   * declared, as the lists of the parents are not available anymore when the
+   * callback is run.
+   *
+   * \note This must not be used by conditions, because they pick objects from
+   * the list.
+   */
+  void ObjectsListNeededForReading(const gd::String& objectName);
+
   /**
    * Call this when an instruction in the event needs an empty objects list
    * or the one already declared, if any.
@@ -139,10 +156,7 @@ class GD_CORE_API EventsCodeGenerationContext {
   /**
    * Return true if an object list has already been declared by the parent contexts.
    */
-  bool ObjectAlreadyDeclaredByParents(const gd::String& objectName) const {
-    return (alreadyDeclaredObjectsLists.find(objectName) !=
-            alreadyDeclaredObjectsLists.end());
-  };
+  bool ObjectAlreadyDeclaredByParents(const gd::String& objectName) const;
 
   /**
    * Return all the objects lists which will be declared by the current context
@@ -178,10 +192,11 @@ class GD_CORE_API EventsCodeGenerationContext {
   /**
    * Return the objects lists which are already declared and can be used in the
    * current context without declaration.
+   *
+   * \note This builds the set of all the lists declared by the parents: use
+   * ObjectAlreadyDeclaredByParents to check a list.
    */
-  const std::set<gd::String>& GetObjectsListsAlreadyDeclaredByParents() const {
-    return alreadyDeclaredObjectsLists;
-  };
+  const std::set<gd::String>& GetObjectsListsAlreadyDeclaredByParents() const;
 
   /**
    * \brief Get the depth of the context that was in effect when \a objectName
@@ -269,11 +284,55 @@ class GD_CORE_API EventsCodeGenerationContext {
   };
 
  private:
+  /**
+   * \brief The names of the objects lists declared by a context, shared by
+   * all its children (instead of each child copying the lists declared by
+   * all its parents). Chained to the lists declared by the parents.
+   *
+   * Layers are immutable: a new one is made when a context declared new
+   * lists since the last time a child inherited from it.
+   */
+  struct DeclaredObjectsListsLayer {
+    std::shared_ptr<const DeclaredObjectsListsLayer> previous;
+    std::set<gd::String> names;
+  };
+
+  /**
+   * \brief The depths of last use of objects lists set by a context, shared
+   * by all its children. Chained to the ones of the parents.
+   */
+  struct DepthsOfLastUseLayer {
+    std::shared_ptr<const DepthsOfLastUseLayer> previous;
+    std::map<gd::String, unsigned int> depths;
+  };
+
   void NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName);
+  void SetDepthOfLastUse(const gd::String& objectName);
+  void AddObjectsListToBeDeclared(std::set<gd::String>& objectsLists,
+                                  const gd::String& objectName);
 
-  std::set<gd::String>
+  /**
+   * \brief Return the layer of the lists declared by this context and its
+   * parents, to be used by a child.
+   */
+  std::shared_ptr<const DeclaredObjectsListsLayer>
+  GetDeclaredObjectsListsLayer() const;
+
+  /**
+   * \brief Return the layer of the depths of last use set by this context
+   * and its parents, to be used by a child.
+   */
+  std::shared_ptr<const DepthsOfLastUseLayer> GetDepthsOfLastUseLayer() const;
+
+  std::shared_ptr<const DeclaredObjectsListsLayer>
       alreadyDeclaredObjectsLists;  ///< Objects lists already needed in a
                                     ///< parent context.
+  mutable std::shared_ptr<const DeclaredObjectsListsLayer>
+      declaredObjectsListsLayer;  ///< The layer given to children, if still
+                                  ///< up to date.
+  mutable std::set<gd::String>
+      alreadyDeclaredObjectsListsSet;  ///< See
+                                       ///< GetObjectsListsAlreadyDeclaredByParents.
   std::set<gd::String>
       objectsListsToBeDeclared;  ///< Objects lists that will be declared in
                                  ///< this context.
@@ -298,7 +357,13 @@ class GD_CORE_API EventsCodeGenerationContext {
                                                  ///< backed up.
 
   std::map<gd::String, unsigned int>
-      depthOfLastUse;  ///< The context depth when an object was last used.
+      depthOfLastUse;  ///< The context depth when an object was last used in
+                       ///< this context.
+  std::shared_ptr<const DepthsOfLastUseLayer>
+      parentsDepthOfLastUse;  ///< The depths of last use set by the parents.
+  mutable std::shared_ptr<const DepthsOfLastUseLayer>
+      depthsOfLastUseLayer;  ///< The layer given to children, if still up to
+                             ///< date.
   gd::String
       currentObject;  ///< The object being used by an action or condition.
   unsigned int contextDepth = 0;  ///< The depth of the context: 0 for a newly
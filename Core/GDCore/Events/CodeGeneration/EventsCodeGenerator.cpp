@@ -4,8 +4,13 @@
 #include <utility>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/GroupEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/CodeGenerationReport.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionPurityChecker.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
@@ -304,7 +309,7 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
   const gd::InstructionMetadata& instrInfos =
       MetadataProvider::GetConditionMetadata(platform, condition.GetType());
   if (MetadataProvider::IsBadInstructionMetadata(instrInfos)) {
-    return "/* Unknown instruction - skipped. */";
+    return GenerateComment("Unknown instruction - skipped.");
   }
 
   AddIncludeFiles(instrInfos.GetIncludeFiles());
@@ -332,7 +337,7 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
   gd::EventsCodeGenerator::CheckBehaviorParameters(condition, instrInfos);
   // Verify that there are no mismatches between object type in parameters.
   for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
-    if (ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType())) {
+    if (instrInfos.parameters.GetParameter(pNb).GetValueTypeMetadata().IsObject()) {
       gd::String objectInParameter =
           condition.GetParameter(pNb).GetPlainString();
 
@@ -346,14 +351,14 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
             gd::ProjectDiagnostic::ErrorType::UnknownObject, "",
             objectInParameter, "");
         if (diagnosticReport) diagnosticReport->Add(projectDiagnostic);
-        return "/* Unknown object - skipped. */";
+        return GenerateComment("Unknown object - skipped.");
       } else if (!expectedObjectType.empty() &&
                  actualObjectType != expectedObjectType) {
         gd::ProjectDiagnostic projectDiagnostic(
             gd::ProjectDiagnostic::ErrorType::MismatchedObjectType, "",
             actualObjectType, expectedObjectType, objectInParameter);
         if (diagnosticReport) diagnosticReport->Add(projectDiagnostic);
-        return "/* Mismatched object type - skipped. */";
+        return GenerateComment("Mismatched object type - skipped.");
       }
     }
   }
@@ -442,6 +447,74 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
   return conditionCode;
 }
 
+/**
+ * Return true if the condition is pure and its parameters don't use any
+ * object, so that it gives the same result wherever it's evaluated in the
+ * conditions of an event.
+ */
+static bool IsPureConditionWithoutObjects(
+    gd::Instruction& condition,
+    const gd::InstructionMetadata& instrInfos,
+    const gd::ObjectsContainersList& objectsContainersList) {
+  if (!instrInfos.IsPure() || instrInfos.IsObjectInstruction() ||
+      instrInfos.IsBehaviorInstruction())
+    return false;
+
+  for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount();
+       ++pNb) {
+    const gd::ParameterMetadata& parameterMetadata =
+        instrInfos.parameters.GetParameter(pNb);
+    const gd::String& type = parameterMetadata.GetType();
+    const gd::ValueTypeMetadata& valueTypeMetadata =
+        parameterMetadata.GetValueTypeMetadata();
+    if (parameterMetadata.IsCodeOnly() || type == "relationalOperator" ||
+        type == "operator" || valueTypeMetadata.IsBoolean())
+      continue;
+
+    if (type == "objectvar" ||
+        (!valueTypeMetadata.IsNumber() &&
+         !valueTypeMetadata.IsStringExpression() &&
+         !valueTypeMetadata.IsVariableExpression()))
+      return false;
+
+    if (pNb >= condition.GetParametersCount()) continue;
+    gd::ExpressionNode* node = condition.GetParameter(pNb).GetRootNode();
+    if (node &&
+        !gd::ExpressionPurityChecker::IsPure(*node, objectsContainersList))
+      return false;
+  }
+
+  return true;
+}
+
+std::vector<std::size_t> EventsCodeGenerator::GetConditionsEvaluationOrder(
+    gd::InstructionsList& conditions) {
+  std::vector<std::size_t> order;
+  std::vector<int> costs;
+  // Conditions before this position in the order can't be skipped.
+  std::size_t firstSkippablePosition = 0;
+
+  for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
+    const gd::InstructionMetadata& instrInfos =
+        MetadataProvider::GetConditionMetadata(platform,
+                                               conditions[cId].GetType());
+    int cost = instrInfos.GetEvaluationCost();
+
+    std::size_t position = order.size();
+    if (IsPureConditionWithoutObjects(
+            conditions[cId], instrInfos, GetObjectsContainersList())) {
+      while (position > firstSkippablePosition && costs[position - 1] > cost)
+        position--;
+    }
+    order.insert(order.begin() + position, cId);
+    costs.insert(costs.begin() + position, cost);
+
+    if (instrInfos.HasSideEffects()) firstSkippablePosition = order.size();
+  }
+
+  return order;
+}
+
 /**
  * Generate code for a list of conditions.
  * Bools containing conditions results are named conditionXIsTrue.
@@ -454,12 +527,15 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
     outputCode += GenerateBooleanInitializationToFalse(
         "condition" + gd::String::From(i) + "IsTrue", context);
 
+  std::vector<std::size_t> conditionsOrder =
+      GetConditionsEvaluationOrder(conditions);
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
+    gd::Instruction& condition = conditions[conditionsOrder[cId]];
     gd::String conditionCode =
-        GenerateConditionCode(conditions[cId],
+        GenerateConditionCode(condition,
                               "condition" + gd::String::From(cId) + "IsTrue",
                               context);
-    if (!conditions[cId].GetType().empty()) {
+    if (!condition.GetType().empty()) {
       for (std::size_t i = 0; i < cId;
            ++i)  // Skip conditions if one condition is false. //TODO : Can be
                  // optimized
@@ -479,7 +555,7 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
       // Deprecated way to cancel code generation - but still honor it.
       // Can be removed once condition is passed by const reference to
       // GenerateConditionCode.
-      outputCode += "/* Skipped condition (empty type) */";
+      outputCode += GenerateComment("Skipped condition (empty type)");
     }
   }
 
@@ -496,7 +572,7 @@ void EventsCodeGenerator::CheckBehaviorParameters(
       [this](const gd::ParameterMetadata &parameterMetadata,
              const gd::Expression &parameterValue,
              const gd::String &lastObjectName) {
-        if (ParameterMetadata::IsBehavior(parameterMetadata.GetType())) {
+        if (parameterMetadata.GetValueTypeMetadata().IsBehavior()) {
           const gd::String &behaviorName = parameterValue.GetPlainString();
           const gd::String &actualBehaviorType =
               GetObjectsContainersList().GetTypeOfBehaviorInObjectOrGroup(
@@ -515,6 +591,51 @@ void EventsCodeGenerator::CheckBehaviorParameters(
       });
 }
 
+/**
+ * Return true if the instruction has parameters with objects lists that it can
+ * modify (by picking objects or by adding objects to them).
+ */
+static bool HasObjectsListsToModify(const gd::InstructionMetadata& instrInfos) {
+  for (std::size_t i = 0; i < instrInfos.parameters.GetParametersCount(); ++i) {
+    const gd::String& type = instrInfos.parameters.GetParameter(i).GetType();
+    if (type == "objectList" || type == "objectListOrEmptyIfJustDeclared" ||
+        type == "objectListOrEmptyWithoutPicking")
+      return true;
+  }
+  return false;
+}
+
+std::vector<gd::String> EventsCodeGenerator::GenerateObjectActionParametersCodes(
+    const gd::String& objectName,
+    gd::Instruction& action,
+    const gd::InstructionMetadata& instrInfos,
+    EventsCodeGenerationContext& context) {
+  if (HasObjectsListsToModify(instrInfos)) {
+    context.ObjectsListNeeded(objectName);
+    return GenerateParametersCodes(
+        action.GetParameters(), instrInfos.parameters, context);
+  }
+
+  // The action is run on each object: the list is only read.
+  context.ObjectsListNeededForReading(objectName);
+  unsigned int depthOfLastUse =
+      context.GetLastDepthObjectListWasNeeded(objectName);
+  vector<gd::String> arguments = GenerateParametersCodes(
+      action.GetParameters(), instrInfos.parameters, context);
+  if (context.GetLastDepthObjectListWasNeeded(objectName) == depthOfLastUse)
+    return arguments;
+
+  // A parameter needed the list to be declared (for example, to give it to a
+  // function): generate the parameters again so that they all use the declared
+  // list. Diagnostics were already reported by the first generation.
+  gd::DiagnosticReport* reportedDiagnosticReport = diagnosticReport;
+  diagnosticReport = nullptr;
+  arguments = GenerateParametersCodes(
+      action.GetParameters(), instrInfos.parameters, context);
+  diagnosticReport = reportedDiagnosticReport;
+  return arguments;
+}
+
 /**
  * Generate code for an action.
  */
@@ -527,7 +648,7 @@ gd::String EventsCodeGenerator::GenerateActionCode(
   const gd::InstructionMetadata& instrInfos =
       MetadataProvider::GetActionMetadata(platform, action.GetType());
   if (MetadataProvider::IsBadInstructionMetadata(instrInfos)) {
-    return "/* Unknown instruction - skipped. */";
+    return GenerateComment("Unknown instruction - skipped.");
   }
 
   AddIncludeFiles(instrInfos.GetIncludeFiles());
@@ -555,7 +676,7 @@ gd::String EventsCodeGenerator::GenerateActionCode(
   gd::EventsCodeGenerator::CheckBehaviorParameters(action, instrInfos);
   // Verify that there are no mismatches between object type in parameters.
   for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
-    if (ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType())) {
+    if (instrInfos.parameters.GetParameter(pNb).GetValueTypeMetadata().IsObject()) {
       gd::String objectInParameter = action.GetParameter(pNb).GetPlainString();
 
       const auto &expectedObjectType =
@@ -568,14 +689,14 @@ gd::String EventsCodeGenerator::GenerateActionCode(
             gd::ProjectDiagnostic::ErrorType::UnknownObject, "",
             objectInParameter, "");
         if (diagnosticReport) diagnosticReport->Add(projectDiagnostic);
-        return "/* Unknown object - skipped. */";
+        return GenerateComment("Unknown object - skipped.");
       } else if (!expectedObjectType.empty() &&
                  actualObjectType != expectedObjectType) {
         gd::ProjectDiagnostic projectDiagnostic(
             gd::ProjectDiagnostic::ErrorType::MismatchedObjectType, "",
             actualObjectType, expectedObjectType, objectInParameter);
         if (diagnosticReport) diagnosticReport->Add(projectDiagnostic);
-        return "/* Mismatched object type - skipped. */";
+        return GenerateComment("Mismatched object type - skipped.");
       }
     }
   }
@@ -595,11 +716,10 @@ gd::String EventsCodeGenerator::GenerateActionCode(
 
           AddIncludeFiles(objInfo.includeFiles);
           context.SetCurrentObject(realObjects[i]);
-          context.ObjectsListNeeded(realObjects[i]);
 
           // Prepare arguments and generate the whole action code
-          vector<gd::String> arguments = GenerateParametersCodes(
-              action.GetParameters(), instrInfos.parameters, context);
+          vector<gd::String> arguments = GenerateObjectActionParametersCodes(
+              realObjects[i], action, instrInfos, context);
           actionCode += GenerateObjectAction(realObjects[i],
                                              objInfo,
                                              functionCallName,
@@ -629,11 +749,10 @@ gd::String EventsCodeGenerator::GenerateActionCode(
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Setup context
         context.SetCurrentObject(realObjects[i]);
-        context.ObjectsListNeeded(realObjects[i]);
 
         // Prepare arguments and generate the whole action code
-        vector<gd::String> arguments = GenerateParametersCodes(
-            action.GetParameters(), instrInfos.parameters, context);
+        vector<gd::String> arguments = GenerateObjectActionParametersCodes(
+            realObjects[i], action, instrInfos, context);
         actionCode +=
             GenerateBehaviorAction(realObjects[i],
                                    behaviorName,
@@ -689,6 +808,8 @@ EventsCodeGenerator::GenerateCallback(
     gd::EventsCodeGenerationContext& parentContext,
     gd::InstructionsList& actions,
     gd::EventsList* subEvents) {
+  if (codeGenerationReport) codeGenerationReport->AddAsyncCallback();
+
   gd::EventsCodeGenerationContext callbackContext;
   callbackContext.InheritsAsAsyncCallbackFrom(parentContext);
   const gd::String callbackFunctionName =
@@ -702,9 +823,9 @@ EventsCodeGenerator::GenerateCallback(
   // Generate subevents
   if (subEvents != nullptr)  // Sub events
   {
-    actionsCode += "\n{ //Subevents\n";
+    actionsCode += "\n{" + GenerateComment("Subevents") + "\n";
     actionsCode += GenerateEventsListCode(*subEvents, callbackContext);
-    actionsCode += "} //End of subevents\n";
+    actionsCode += "}" + GenerateComment("End of subevents") + "\n";
   }
 
   gd::String restoreLocalVariablesCode;
@@ -719,13 +840,12 @@ EventsCodeGenerator::GenerateCallback(
   const gd::String clearLocalVariablesCode =
       GenerateLocalVariablesStackAccessor() + ".length = 0;\n";
 
-  const gd::String callbackCode = callbackFunctionName + " = function (" +
-                                  GenerateEventsParameters(callbackContext) +
-                                  ") {\n" + restoreLocalVariablesCode +
-                                  actionsDeclarationsCode + actionsCode +
-                                  clearLocalVariablesCode + "}\n";
-
-  AddCustomCodeOutsideMain(callbackCode);
+  AddCustomCodeOutsideMain(callbackFunctionName + " = function (" +
+                           GenerateEventsParameters(callbackContext) +
+                           ") {\n" + restoreLocalVariablesCode +
+                           actionsDeclarationsCode);
+  AddCustomCodeOutsideMain(std::move(actionsCode));
+  AddCustomCodeOutsideMain(clearLocalVariablesCode + "}\n");
 
   std::set<gd::String> requiredObjects;
   // Build the list of all objects required by the callback. Any object that has
@@ -765,7 +885,7 @@ gd::String EventsCodeGenerator::GenerateActionsListCode(
       // Deprecated way to cancel code generation - but still honor it.
       // Can be removed once action is passed by const reference to
       // GenerateActionCode.
-      outputCode += "/* Skipped action (empty type) */";
+      outputCode += GenerateComment("Skipped action (empty type)");
     } else {
       outputCode += actionCode;
     }
@@ -783,17 +903,21 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(
     std::vector<std::pair<gd::String, gd::String> >*
         supplementaryParametersTypes) {
   gd::String argOutput;
+  // Kinds of the type are resolved when it's declared: check them first
+  // rather than comparing the type with each known type.
+  const gd::ValueTypeMetadata& valueTypeMetadata =
+      metadata.GetValueTypeMetadata();
 
-  if (ParameterMetadata::IsExpression("number", metadata.GetType())) {
+  if (valueTypeMetadata.IsNumber()) {
     argOutput = gd::ExpressionCodeGenerator::GenerateExpressionCode(
         *this, context, "number", parameter, lastObjectName, metadata.GetExtraInfo());
-  } else if (ParameterMetadata::IsExpression("string", metadata.GetType())) {
+  } else if (valueTypeMetadata.IsStringExpression()) {
     argOutput = gd::ExpressionCodeGenerator::GenerateExpressionCode(
         *this, context, "string", parameter, lastObjectName, metadata.GetExtraInfo());
-  } else if (ParameterMetadata::IsExpression("variable", metadata.GetType())) {
+  } else if (valueTypeMetadata.IsVariableExpression()) {
     argOutput = gd::ExpressionCodeGenerator::GenerateExpressionCode(
         *this, context, metadata.GetType(), parameter, lastObjectName, metadata.GetExtraInfo());
-  } else if (ParameterMetadata::IsObject(metadata.GetType())) {
+  } else if (valueTypeMetadata.IsObject()) {
     // It would be possible to run a gd::ExpressionCodeGenerator if later
     // objects can have nested objects, or function returning objects.
     argOutput =
@@ -811,24 +935,13 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(
     }
 
     argOutput = "\"" + argOutput + "\"";
-  } else if (ParameterMetadata::IsBehavior(metadata.GetType())) {
+  } else if (valueTypeMetadata.IsBehavior()) {
     argOutput = GenerateGetBehaviorNameCode(parameter.GetPlainString());
   } else if (metadata.GetType() == "key") {
     argOutput = "\"" + ConvertToString(parameter.GetPlainString()) + "\"";
-  } else if (metadata.GetType() == "audioResource" ||
-             metadata.GetType() == "bitmapFontResource" ||
-             metadata.GetType() == "fontResource" ||
-             metadata.GetType() == "imageResource" ||
-             metadata.GetType() == "jsonResource" ||
-             metadata.GetType() == "tilemapResource" ||
-             metadata.GetType() == "tilesetResource" ||
-             metadata.GetType() == "videoResource" ||
-             metadata.GetType() == "model3DResource" ||
-             metadata.GetType() == "atlasResource" ||
-             metadata.GetType() == "spineResource" ||
-             // Deprecated, old parameter names:
-             metadata.GetType() == "password" || metadata.GetType() == "musicfile" ||
-             metadata.GetType() == "soundfile") {
+  } else if (valueTypeMetadata.IsResource() ||
+             // Deprecated, old parameter name:
+             metadata.GetType() == "password") {
     argOutput = "\"" + ConvertToString(parameter.GetPlainString()) + "\"";
   } else if (metadata.GetType() == "mouse") {
     argOutput = "\"" + ConvertToString(parameter.GetPlainString()) + "\"";
@@ -909,13 +1022,13 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
       std::cout << "ERROR: During code generation, a context tried to use an "
                    "already declared object list without having a parent"
                 << std::endl;
-      return "/* Could not declare " + objectListName + " */";
+      return GenerateComment("Could not declare " + objectListName);
     }
 
     //*Optimization*: Avoid a copy of the object list if we're using
     // the same list as the one from the parent context.
     if (context.IsSameObjectsList(object, *context.GetParentContext()))
-      return "/* Reuse " + objectListName + " */";
+      return GenerateComment("Reuse " + objectListName);
 
     gd::String declarationCode;
 
@@ -973,7 +1086,7 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
  */
 gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::EventsList& events, EventsCodeGenerationContext& parentContext) {
-  gd::String output;
+  gd::CodeOutputBuffer output;
   for (std::size_t eId = 0; eId < events.size(); ++eId) {
     auto& event = events[eId];
     if (event.HasVariables()) {
@@ -1005,15 +1118,24 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::String scopeEnd = GenerateScopeEnd(context);
     gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
 
-    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
-              eventCoreCode + "\n" + scopeEnd + "\n";
+    // Chunks are moved in the buffer, to only copy the (possibly big) code
+    // of the event once into the output.
+    output += "\n";
+    output += std::move(scopeBegin);
+    output += "\n";
+    output += std::move(declarationsCode);
+    output += "\n";
+    output += std::move(eventCoreCode);
+    output += "\n";
+    output += std::move(scopeEnd);
+    output += "\n";
 
     if (event.HasVariables()) {
       GetProjectScopedContainers().GetVariablesContainersList().Pop();
     }
   }
 
-  return output;
+  return output.ToString();
 }
 
 gd::String EventsCodeGenerator::ConvertToString(gd::String plainString) {
@@ -1032,12 +1154,29 @@ gd::String EventsCodeGenerator::ConvertToStringExplicit(
 
 void EventsCodeGenerator::DeleteUselessEvents(gd::EventsList& events) {
   for (std::size_t eId = events.size() - 1; eId < events.size(); --eId) {
-    if (events[eId].CanHaveSubEvents())  // Process sub events, if any
-      DeleteUselessEvents(events[eId].GetSubEvents());
-
-    if (!events[eId].IsExecutable() ||
-        events[eId].IsDisabled())  // Delete events that are not executable
+    gd::BaseEvent& event = events[eId];
+    // Delete events that are not executable, with their sub events.
+    if (!event.IsExecutable() || event.IsDisabled() ||
+        dynamic_cast<gd::LinkEvent*>(&event)) {
       events.RemoveEvent(eId);
+      continue;
+    }
+
+    if (event.CanHaveSubEvents())  // Process sub events, if any
+      DeleteUselessEvents(event.GetSubEvents());
+
+    // Delete events that are only there to hold sub events which were all
+    // deleted (for example, groups of comments).
+    bool isEmptyGroup = dynamic_cast<gd::GroupEvent*>(&event) &&
+                        event.GetSubEvents().IsEmpty();
+    gd::StandardEvent* standardEvent =
+        dynamic_cast<gd::StandardEvent*>(&event);
+    bool isEmptyStandardEvent =
+        standardEvent && standardEvent->GetConditions().empty() &&
+        standardEvent->GetActions().empty() &&
+        standardEvent->GetSubEvents().IsEmpty() &&
+        !standardEvent->HasVariables();
+    if (isEmptyGroup || isEmptyStandardEvent) events.RemoveEvent(eId);
   }
 }
 
@@ -1392,10 +1531,12 @@ EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project_,
       scene(&layout),
       errorOccurred(false),
       compilationForRuntime(false),
+      compactCode(false),
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
       eventsListNextUniqueId(0),
-      diagnosticReport(nullptr){};
+      diagnosticReport(nullptr),
+      codeGenerationReport(nullptr){};
 
 EventsCodeGenerator::EventsCodeGenerator(
     const gd::Platform& platform_,
@@ -1407,9 +1548,11 @@ EventsCodeGenerator::EventsCodeGenerator(
       scene(nullptr),
       errorOccurred(false),
       compilationForRuntime(false),
+      compactCode(false),
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
       eventsListNextUniqueId(0),
-      diagnosticReport(nullptr){};
+      diagnosticReport(nullptr),
+      codeGenerationReport(nullptr){};
 
 }  // namespace gd
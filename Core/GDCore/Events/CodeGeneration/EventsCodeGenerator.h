@@ -11,11 +11,13 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/CodeGeneration/CodeOutputBuffer.h"
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/String.h"
 
 namespace gd {
+class CodeGenerationReport;
 class EventsList;
 class Expression;
 class Project;
@@ -43,7 +45,13 @@ class GD_CORE_API EventsCodeGenerator {
 
  public:
   /**
-   * \brief Remove non executable events from the event list.
+   * \brief Remove the events that can't generate any code from the event
+   * list: non executable and disabled events (with their sub-events), the
+   * links that were not replaced by their events, and the groups and the
+   * standard events left with nothing to do.
+   *
+   * This is done after preprocessing, so that these events don't go through
+   * the setup of contexts and the declaration of object lists.
    */
   static void DeleteUselessEvents(gd::EventsList& events);
 
@@ -98,6 +106,20 @@ class GD_CORE_API EventsCodeGenerator {
   virtual gd::String GenerateConditionsListCode(
       gd::InstructionsList& conditions, EventsCodeGenerationContext& context);
 
+  /**
+   * \brief Return the indices of the conditions, in the order they must be
+   * evaluated.
+   *
+   * The conditions are evaluated in the order they were written, except the
+   * pure conditions (see gd::InstructionMetadata::MarkAsPure) that don't use
+   * any object: they are moved before the more expensive conditions written
+   * before them, as long as these conditions have no side effects other than
+   * picking objects (so that skipping them when a pure condition is false
+   * does not change anything).
+   */
+  std::vector<std::size_t> GetConditionsEvaluationOrder(
+      gd::InstructionsList& conditions);
+
   /**
    * \brief Generate code for executing an action list
    *
@@ -282,7 +304,7 @@ class GD_CORE_API EventsCodeGenerator {
    * \brief Add some code before events outside the main function.
    */
   void AddCustomCodeOutsideMain(gd::String code) {
-    customCodeOutsideMain += code;
+    customCodeOutsideMain.Append(std::move(code));
   };
 
   /** \brief Get the set containing the include files.
@@ -290,8 +312,11 @@ class GD_CORE_API EventsCodeGenerator {
   const std::set<gd::String>& GetIncludeFiles() const { return includeFiles; }
 
   /** \brief Get the custom code to be inserted outside main.
+   *
+   * The code is kept by chunks, use gd::CodeOutputBuffer::AppendTo to add it
+   * to the output without intermediate copies.
    */
-  const gd::String& GetCustomCodeOutsideMain() const {
+  const gd::CodeOutputBuffer& GetCustomCodeOutsideMain() const {
     return customCodeOutsideMain;
   }
 
@@ -314,6 +339,28 @@ class GD_CORE_API EventsCodeGenerator {
     compilationForRuntime = compilationForRuntime_;
   }
 
+  /**
+   * \brief Return true if the code must be generated without the comments
+   * explaining it (to reduce the size of the code).
+   */
+  bool IsGeneratingCompactCode() const { return compactCode; }
+
+  /**
+   * \brief Set if the code must be generated without the comments explaining
+   * it.
+   */
+  void SetGenerateCompactCode(bool compactCode_) {
+    compactCode = compactCode_;
+  }
+
+  /**
+   * \brief Generate a comment in the code, or nothing if compact code is
+   * generated.
+   */
+  virtual gd::String GenerateComment(const gd::String& comment) {
+    return compactCode ? "" : "/* " + comment + " */";
+  }
+
   /**
    * \brief Report that an error occurred during code generation ( Event code
    * won't be generated )
@@ -391,6 +438,18 @@ class GD_CORE_API EventsCodeGenerator {
     return diagnosticReport;
   }
 
+  /**
+   * \brief Set the report where the size of the generated code and its costly
+   * parts are recorded, or nullptr to not record them (default).
+   */
+  void SetCodeGenerationReport(gd::CodeGenerationReport* codeGenerationReport_) {
+    codeGenerationReport = codeGenerationReport_;
+  }
+
+  gd::CodeGenerationReport* GetCodeGenerationReport() {
+    return codeGenerationReport;
+  }
+
   /**
    * \brief Generate the full name for accessing to a boolean variable used for
    * conditions.
@@ -526,6 +585,20 @@ protected:
   virtual const gd::String GenerateRelationalOperatorCodes(
       const gd::String& operatorString);
 
+  /**
+   * \brief Declare the objects list used by an action run on each object of
+   * \a objectName and generate the code of the parameters of the action.
+   *
+   * The objects list is only read (see
+   * EventsCodeGenerationContext::ObjectsListNeededForReading), unless the
+   * action or one of its parameters needs it to be declared.
+   */
+  std::vector<gd::String> GenerateObjectActionParametersCodes(
+      const gd::String& objectName,
+      gd::Instruction& action,
+      const gd::InstructionMetadata& instrInfos,
+      EventsCodeGenerationContext& context);
+
   /**
    * \brief Generate the code for a single parameter.
    *
@@ -853,13 +926,15 @@ protected:
   bool errorOccurred;          ///< Must be set to true if an error occurred.
   bool compilationForRuntime;  ///< Is set to true if the code generation is
                                ///< made for runtime only.
+  bool compactCode;  ///< Is set to true if comments must not be generated.
 
   std::set<gd::String>
       includeFiles;  ///< List of headers files used by instructions. A (shared)
                      ///< pointer is used so as context created from another one
                      ///< can share the same list.
-  gd::String customCodeOutsideMain;  ///< Custom code inserted before events (
-                                     ///< and not in events function )
+  gd::CodeOutputBuffer
+      customCodeOutsideMain;  ///< Custom code inserted before events (and not
+                              ///< in events function)
   std::set<gd::String>
       customGlobalDeclarations;     ///< Custom global C++ declarations inserted
                                     ///< after includes
@@ -873,6 +948,7 @@ protected:
                                   ///< list function name.
 
   gd::DiagnosticReport* diagnosticReport;
+  gd::CodeGenerationReport* codeGenerationReport;
 };
 
 }  // namespace gd
@@ -12,6 +12,7 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
@@ -90,6 +91,18 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
 }
 
 void ExpressionCodeGenerator::OnVisitOperatorNode(OperatorNode& node) {
+  // Operations on literals only are computed once, here, instead of each
+  // time the generated code is run.
+  constantFolder.Evaluate(node);
+  if (constantFolder.GetType() == gd::ExpressionConstantFolder::Number) {
+    output +=
+        gd::ExpressionConstantFolder::NumberToString(constantFolder.GetNumber());
+    return;
+  } else if (constantFolder.GetType() == gd::ExpressionConstantFolder::Text) {
+    output += codeGenerator.ConvertToStringExplicit(constantFolder.GetText());
+    return;
+  }
+
   node.leftHandSide->Visit(*this);
   output += " ";
   output.push_back(node.op);
@@ -363,7 +376,12 @@ gd::String ExpressionCodeGenerator::GenerateObjectFunctionCode(
   std::vector<gd::String> realObjects =
       codeGenerator.GetObjectsContainersList().ExpandObjectName(objectName, context.GetCurrentObject());
   for (std::size_t i = 0; i < realObjects.size(); ++i) {
-    context.ObjectsListNeeded(realObjects[i]);
+    // The objects list of the object used by the instruction is only read
+    // (the instruction itself declares it if needed).
+    if (realObjects[i] == context.GetCurrentObject())
+      context.ObjectsListNeededForReading(realObjects[i]);
+    else
+      context.ObjectsListNeeded(realObjects[i]);
 
     gd::String objectType = codeGenerator.GetObjectsContainersList().GetTypeOfObject(realObjects[i]);
     const ObjectMetadata& objInfo = MetadataProvider::GetObjectMetadata(
@@ -414,7 +432,12 @@ gd::String ExpressionCodeGenerator::GenerateBehaviorFunctionCode(
       codeGenerator.GetPlatform(), behaviorType);
 
   for (std::size_t i = 0; i < realObjects.size(); ++i) {
-    context.ObjectsListNeeded(realObjects[i]);
+    // The objects list of the object used by the instruction is only read
+    // (the instruction itself declares it if needed).
+    if (realObjects[i] == context.GetCurrentObject())
+      context.ObjectsListNeededForReading(realObjects[i]);
+    else
+      context.ObjectsListNeeded(realObjects[i]);
 
     codeGenerator.AddIncludeFiles(autoInfo.includeFiles);
     functionOutput = codeGenerator.GenerateObjectBehaviorFunctionCall(
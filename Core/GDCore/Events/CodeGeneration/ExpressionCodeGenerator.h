@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <vector>
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/String.h"
@@ -108,6 +109,9 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
   EventsCodeGenerationContext& context;
   const gd::String rootType;
   const gd::String rootObjectName;
+  gd::ExpressionConstantFolder
+      constantFolder;  ///< Used for all the operators of the tree, so that
+                       ///< each one is evaluated once.
 };
 
 }  // namespace gd
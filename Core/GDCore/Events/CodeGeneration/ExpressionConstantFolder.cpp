@@ -0,0 +1,124 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
+
+#include <cmath>
+#include <locale>
+#include <sstream>
+
+namespace gd {
+
+gd::String ExpressionConstantFolder::NumberToString(double number) {
+  std::string output;
+  for (int precision = 1; precision <= 17; precision++) {
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    stream.precision(precision);
+    stream << number;
+    output = stream.str();
+
+    double readNumber = 0;
+    std::istringstream readStream(output);
+    readStream.imbue(std::locale::classic());
+    readStream >> readNumber;
+    if (readNumber == number) break;
+  }
+
+  return gd::String::FromUTF8(output);
+}
+
+void ExpressionConstantFolder::OnVisitSubExpressionNode(
+    SubExpressionNode &node) {
+  node.expression->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitOperatorNode(OperatorNode &node) {
+  if (notConstantOperators.find(&node) != notConstantOperators.end()) {
+    type = NotConstant;
+    return;
+  }
+
+  EvaluateOperator(node);
+  if (type == NotConstant) notConstantOperators.insert(&node);
+}
+
+void ExpressionConstantFolder::EvaluateOperator(OperatorNode &node) {
+  // Don't evaluate the right hand side if the left one is already not a
+  // constant: it will be evaluated if the code generator reaches it.
+  node.leftHandSide->Visit(*this);
+  if (type == NotConstant) return;
+
+  ConstantType leftType = type;
+  double leftNumber = number;
+  gd::String leftText = std::move(text);
+
+  node.rightHandSide->Visit(*this);
+  if (type != leftType) {
+    type = NotConstant;
+    return;
+  }
+
+  if (type == Text) {
+    if (node.op == '+')
+      text = leftText + text;
+    else
+      type = NotConstant;
+    return;
+  }
+
+  double result = 0;
+  if (node.op == '+')
+    result = leftNumber + number;
+  else if (node.op == '-')
+    result = leftNumber - number;
+  else if (node.op == '*')
+    result = leftNumber * number;
+  else if (node.op == '/')
+    result = leftNumber / number;
+  else {
+    type = NotConstant;
+    return;
+  }
+
+  // Keep infinities and NaN computed at runtime, as they can't be written as
+  // number literals.
+  if (!std::isfinite(result)) {
+    type = NotConstant;
+    return;
+  }
+  number = result;
+}
+
+void ExpressionConstantFolder::OnVisitUnaryOperatorNode(
+    UnaryOperatorNode &node) {
+  node.factor->Visit(*this);
+  if (type != Number) {
+    type = NotConstant;
+    return;
+  }
+
+  if (node.op == '-')
+    number = -number;
+  else if (node.op != '+')
+    type = NotConstant;
+}
+
+void ExpressionConstantFolder::OnVisitNumberNode(NumberNode &node) {
+  std::istringstream stream(node.number.Raw());
+  stream.imbue(std::locale::classic());
+  if (stream >> number) {
+    type = std::isfinite(number) ? Number : NotConstant;
+  } else {
+    type = NotConstant;
+  }
+}
+
+void ExpressionConstantFolder::OnVisitTextNode(TextNode &node) {
+  type = Text;
+  text = node.text;
+}
+
+}  // namespace gd
@@ -0,0 +1,102 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <unordered_set>
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Evaluate the parts of an expression that are only made of
+ * operations on number or text literals, so that they can be generated as a
+ * single literal.
+ *
+ * The tree is not modified (it can be shared between expressions, see
+ * gd::Expression::GetRootNode). The operators found not to be constant are
+ * remembered, so that evaluating again parts of the same tree (like the code
+ * generator does for each operator) doesn't evaluate them again: use a folder
+ * for a single tree.
+ *
+ * \see gd::ExpressionCodeGenerator
+ */
+class GD_CORE_API ExpressionConstantFolder : public ExpressionParser2NodeWorker {
+ public:
+  enum ConstantType { NotConstant, Number, Text };
+
+  ExpressionConstantFolder() : type(NotConstant), number(0){};
+  virtual ~ExpressionConstantFolder(){};
+
+  /**
+   * \brief Evaluate the given node.
+   */
+  void Evaluate(gd::ExpressionNode &node) {
+    type = NotConstant;
+    node.Visit(*this);
+  }
+
+  /**
+   * \brief Return the type of the evaluated node, or NotConstant if it can't
+   * be evaluated (for example if it contains a function call or a variable).
+   */
+  ConstantType GetType() const { return type; }
+
+  /**
+   * \brief Return the value of the evaluated node, when it's a number.
+   */
+  double GetNumber() const { return number; }
+
+  /**
+   * \brief Return the value of the evaluated node, when it's a text.
+   */
+  const gd::String &GetText() const { return text; }
+
+  /**
+   * \brief Return the shortest representation of a number that is read back
+   * as the same number.
+   */
+  static gd::String NumberToString(double number);
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override;
+  void OnVisitOperatorNode(OperatorNode &node) override;
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override;
+  void OnVisitNumberNode(NumberNode &node) override;
+  void OnVisitTextNode(TextNode &node) override;
+  void OnVisitVariableNode(VariableNode &node) override { type = NotConstant; }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    type = NotConstant;
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    type = NotConstant;
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {
+    type = NotConstant;
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {
+    type = NotConstant;
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    type = NotConstant;
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override { type = NotConstant; }
+
+ private:
+  void EvaluateOperator(OperatorNode &node);
+
+  ConstantType type;
+  double number;
+  gd::String text;
+  std::unordered_set<const gd::OperatorNode *>
+      notConstantOperators;  ///< The operators already evaluated and found
+                             ///< not to be constant.
+};
+
+}  // namespace gd
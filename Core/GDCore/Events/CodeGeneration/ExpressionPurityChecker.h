@@ -0,0 +1,85 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Project/ObjectsContainersList.h"
+
+namespace gd {
+
+/**
+ * \brief Check if an expression is only made of literals, operators and
+ * variables that are not the variables of an object.
+ *
+ * Such an expression has no side effects and does not depend on the objects
+ * picked by the events, so it gives the same result wherever it's evaluated
+ * in the conditions of an event. Function calls are never considered as pure,
+ * as they can have side effects or use objects.
+ *
+ * \see gd::EventsCodeGenerator::GetConditionsEvaluationOrder
+ */
+class GD_CORE_API ExpressionPurityChecker : public ExpressionParser2NodeWorker {
+ public:
+  static bool IsPure(gd::ExpressionNode &node,
+                     const gd::ObjectsContainersList &objectsContainersList) {
+    gd::ExpressionPurityChecker checker(objectsContainersList);
+    node.Visit(checker);
+    return checker.isPure;
+  }
+
+  virtual ~ExpressionPurityChecker(){};
+
+ protected:
+  ExpressionPurityChecker(
+      const gd::ObjectsContainersList &objectsContainersList_)
+      : objectsContainersList(objectsContainersList_), isPure(true){};
+
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode &node) override {}
+  void OnVisitTextNode(TextNode &node) override {}
+  void OnVisitVariableNode(VariableNode &node) override {
+    if (objectsContainersList.HasObjectOrGroupNamed(node.name)) {
+      isPure = false;
+      return;
+    }
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {
+    if (objectsContainersList.HasObjectOrGroupNamed(node.identifierName))
+      isPure = false;
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {
+    isPure = false;
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    isPure = false;
+  }
+
+ private:
+  const gd::ObjectsContainersList &objectsContainersList;
+  bool isPure;
+};
+
+}  // namespace gd
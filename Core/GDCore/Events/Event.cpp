@@ -8,9 +8,12 @@
 
 #include "GDCore/Events/Builtin/AsyncEvent.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/EventsArena.h"
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/EventVisitor.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/PlatformMetadataIndex.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 
@@ -37,31 +40,9 @@ gd::String BaseEvent::GenerateEventCode(
   try {
     if (type.empty()) return "";
 
-    const gd::Platform& platform = codeGenerator.GetPlatform();
-
-    // First try to guess the extension used
-    gd::String eventNamespace = type.substr(0, type.find("::"));
-    std::shared_ptr<gd::PlatformExtension> guessedExtension =
-        platform.GetExtension(eventNamespace);
-    if (guessedExtension) {
-      std::map<gd::String, gd::EventMetadata>& allEvents =
-          guessedExtension->GetAllEvents();
-      if (allEvents.find(type) != allEvents.end())
-        return allEvents[type].codeGeneration(*this, codeGenerator, context);
-    }
-
-    // Else make a search in all the extensions
-    for (std::size_t i = 0; i < platform.GetAllPlatformExtensions().size();
-         ++i) {
-      std::shared_ptr<gd::PlatformExtension> extension =
-          platform.GetAllPlatformExtensions()[i];
-      if (!extension) continue;
-
-      std::map<gd::String, gd::EventMetadata>& allEvents =
-          extension->GetAllEvents();
-      if (allEvents.find(type) != allEvents.end())
-        return allEvents[type].codeGeneration(*this, codeGenerator, context);
-    }
+    if (auto* entry =
+            codeGenerator.GetPlatform().GetMetadataIndex().FindEvent(type))
+      return entry->metadata->codeGeneration(*this, codeGenerator, context);
   } catch (...) {
     std::cout << "ERROR: Exception caught during code generation for event \""
               << type << "\"." << std::endl;
@@ -109,33 +90,10 @@ void BaseEvent::Preprocess(gd::EventsCodeGenerator& codeGenerator,
   try {
     if (type.empty()) return;
 
-    const gd::Platform& platform = codeGenerator.GetPlatform();
-
-    // First try to guess the extension used
-    gd::String eventNamespace = type.substr(0, type.find("::"));
-    std::shared_ptr<gd::PlatformExtension> guessedExtension =
-        platform.GetExtension(eventNamespace);
-    if (guessedExtension) {
-      std::map<gd::String, gd::EventMetadata>& allEvents =
-          guessedExtension->GetAllEvents();
-      if (allEvents.find(type) != allEvents.end())
-        return allEvents[type].preprocessing(
-            *this, codeGenerator, eventList, indexOfTheEventInThisList);
-    }
-
-    // Else make a search in all the extensions
-    for (std::size_t i = 0; i < platform.GetAllPlatformExtensions().size();
-         ++i) {
-      std::shared_ptr<gd::PlatformExtension> extension =
-          platform.GetAllPlatformExtensions()[i];
-      if (!extension) continue;
-
-      std::map<gd::String, gd::EventMetadata>& allEvents =
-          extension->GetAllEvents();
-      if (allEvents.find(type) != allEvents.end())
-        return allEvents[type].preprocessing(
-            *this, codeGenerator, eventList, indexOfTheEventInThisList);
-    }
+    if (auto* entry =
+            codeGenerator.GetPlatform().GetMetadataIndex().FindEvent(type))
+      return entry->metadata->preprocessing(
+          *this, codeGenerator, eventList, indexOfTheEventInThisList);
   } catch (...) {
     std::cout << "ERROR: Exception caught during preprocessing of event \""
               << type << "\"." << std::endl;
@@ -151,7 +109,12 @@ void BaseEvent::AcceptVisitor(gd::ReadOnlyEventVisitor& eventVisitor) const {
 }
 
 BaseEventSPtr GD_CORE_API CloneRememberingOriginalEvent(BaseEventSPtr event) {
-  gd::BaseEventSPtr copy(event->Clone());
+  // The reference counter is allocated in the arena of the current thread,
+  // if any.
+  gd::BaseEventSPtr copy(event->Clone(),
+                         std::default_delete<gd::BaseEvent>(),
+                         gd::EventsArenaAllocator<gd::BaseEvent>(
+                             gd::EventsArena::GetCurrentArena()));
   // Original event is either the original event of the copied event, or the
   // event copied.
   copy->originalEvent =
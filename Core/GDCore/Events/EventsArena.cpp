@@ -0,0 +1,44 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/EventsArena.h"
+
+#include <algorithm>
+
+namespace {
+constexpr std::size_t alignment = alignof(std::max_align_t);
+
+thread_local gd::EventsArena *currentArena = nullptr;
+}  // namespace
+
+namespace gd {
+
+void *EventsArena::Allocate(std::size_t size) {
+  size = (size + alignment - 1) / alignment * alignment;
+  if (size > remaining) {
+    // Allocations larger than a block get their own block.
+    std::size_t newBlockSize = std::max(blockSize, size);
+    // new[] returns memory aligned for any fundamental type.
+    blocks.emplace_back(new char[newBlockSize]);
+    reservedSize += newBlockSize;
+    current = blocks.back().get();
+    remaining = newBlockSize;
+  }
+
+  char *allocated = current;
+  current += size;
+  remaining -= size;
+  return allocated;
+}
+
+EventsArena::Scope::Scope(EventsArena *arena) : previousArena(currentArena) {
+  currentArena = arena;
+}
+
+EventsArena::Scope::~Scope() { currentArena = previousArena; }
+
+EventsArena *EventsArena::GetCurrentArena() { return currentArena; }
+
+}  // namespace gd
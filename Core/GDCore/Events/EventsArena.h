@@ -0,0 +1,126 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief A monotonic memory arena where the instructions of a read-only copy
+ * of a project (for example, the copy used to export a game) can be
+ * allocated.
+ *
+ * While a gd::EventsArena::Scope is alive, the instructions copied on the
+ * current thread are allocated, with their reference counter, in the arena
+ * instead of on the heap. The reference counters of copied events are
+ * allocated in it too. They are still owned by `std::shared_ptr`, so nothing
+ * changes for the code using them. Destructors are called as usual, but the
+ * memory is only released, at once, when the arena is destroyed.
+ *
+ * \warning The arena must outlive all the instructions and events allocated
+ * in it. Allocating is not thread-safe, but instructions and events allocated
+ * in an arena can be read and destroyed from any thread.
+ */
+class GD_CORE_API EventsArena {
+ public:
+  EventsArena(std::size_t blockSize_ = 256 * 1024) : blockSize(blockSize_) {}
+  EventsArena(const EventsArena &) = delete;
+  EventsArena &operator=(const EventsArena &) = delete;
+
+  /**
+   * \brief Allocate memory for \a size bytes, suitably aligned for any type.
+   */
+  void *Allocate(std::size_t size);
+
+  /**
+   * \brief Return the number of bytes reserved by the arena.
+   */
+  std::size_t GetReservedSize() const { return reservedSize; }
+
+  /**
+   * \brief Set the arena used to allocate instructions and reference
+   * counters of events on the current thread, until the scope is destroyed.
+   */
+  class GD_CORE_API Scope {
+   public:
+    Scope(EventsArena *arena);
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+   private:
+    EventsArena *previousArena;
+  };
+
+  /**
+   * \brief Return the arena used on the current thread, if any.
+   */
+  static EventsArena *GetCurrentArena();
+
+ private:
+  std::size_t blockSize;
+  char *current = nullptr;
+  std::size_t remaining = 0;
+  std::size_t reservedSize = 0;
+  std::vector<std::unique_ptr<char[]>> blocks;
+};
+
+/**
+ * \brief A standard allocator allocating in a gd::EventsArena, or on the
+ * heap if no arena is given. Deallocation from an arena is a no-op: memory
+ * is released with the arena.
+ */
+template <typename T>
+class EventsArenaAllocator {
+ public:
+  typedef T value_type;
+
+  EventsArenaAllocator(EventsArena *arena_) : arena(arena_) {}
+  template <typename U>
+  EventsArenaAllocator(const EventsArenaAllocator<U> &other)
+      : arena(other.arena) {}
+
+  T *allocate(std::size_t n) {
+    if (!arena) return static_cast<T *>(::operator new(n * sizeof(T)));
+    return static_cast<T *>(arena->Allocate(n * sizeof(T)));
+  }
+  void deallocate(T *pointer, std::size_t) {
+    if (!arena) ::operator delete(pointer);
+  }
+
+  template <typename U>
+  bool operator==(const EventsArenaAllocator<U> &other) const {
+    return arena == other.arena;
+  }
+  template <typename U>
+  bool operator!=(const EventsArenaAllocator<U> &other) const {
+    return arena != other.arena;
+  }
+
+ private:
+  template <typename U>
+  friend class EventsArenaAllocator;
+
+  EventsArena *arena;
+};
+
+/**
+ * \brief Create an object owned by a `std::shared_ptr`, allocated with its
+ * reference counter in the arena of the current thread if any (like
+ * `std::make_shared` otherwise).
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeSharedInEventsArena(Args &&...args) {
+  return std::allocate_shared<T>(
+      EventsArenaAllocator<T>(EventsArena::GetCurrentArena()),
+      std::forward<Args>(args)...);
+}
+
+}  // namespace gd
@@ -6,13 +6,34 @@
 
 #include "EventsList.h"
 
+#include "GDCore/Events/Builtin/LinkEvent.h"
 #include "GDCore/Events/Event.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MemoryTracker.h"
 #include "Serialization.h"
 
+namespace {
+
+bool HasExternalLayouts(const gd::InstructionsList& instructions) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    if (instructions[i].GetType() ==
+            "BuiltinExternalLayouts::CreateObjectsFromExternalLayout" ||
+        HasExternalLayouts(instructions[i].GetSubInstructions()))
+      return true;
+  }
+
+  return false;
+}
+
+}  // namespace
+
 namespace gd {
 
+std::atomic<std::size_t> EventsList::linksGeneration(0);
+
 EventsList::EventsList() {}
 
 void EventsList::InsertEvents(const EventsList& otherEvents,
@@ -24,6 +45,9 @@ void EventsList::InsertEvents(const EventsList& otherEvents,
   if (end >= otherEvents.size()) end = otherEvents.size() - 1;
 
   for (std::size_t insertPos = 0; insertPos <= (end - begin); insertPos++) {
+    const gd::BaseEvent& event = *otherEvents.events[begin + insertPos];
+    if (HasLinksOrExternalLayouts(event)) NotifyLinksModified();
+
     if (position != (size_t)-1 && position + insertPos < events.size())
       events.insert(
           events.begin() + position + insertPos,
@@ -37,6 +61,7 @@ void EventsList::InsertEvents(const EventsList& otherEvents,
 gd::BaseEvent& EventsList::InsertEvent(const gd::BaseEvent& evt,
                                        size_t position) {
   std::shared_ptr<gd::BaseEvent> event(evt.Clone());
+  if (HasLinksOrExternalLayouts(*event)) NotifyLinksModified();
   if (position < events.size())
     events.insert(events.begin() + position, event);
   else
@@ -47,6 +72,7 @@ gd::BaseEvent& EventsList::InsertEvent(const gd::BaseEvent& evt,
 
 void EventsList::InsertEvent(std::shared_ptr<gd::BaseEvent> event,
                              size_t position) {
+  if (HasLinksOrExternalLayouts(*event)) NotifyLinksModified();
   if (position < events.size())
     events.insert(events.begin() + position, event);
   else
@@ -67,24 +93,32 @@ gd::BaseEvent& EventsList::InsertNewEvent(gd::Project& project,
 }
 
 void EventsList::RemoveEvent(size_t index) {
+  if (HasLinksOrExternalLayouts(*events[index])) NotifyLinksModified();
   events.erase(events.begin() + index);
 }
 
 void EventsList::RemoveEvent(const gd::BaseEvent& event) {
   for (size_t i = 0; i < events.size(); ++i) {
     if (events[i].get() == &event) {
+      if (HasLinksOrExternalLayouts(event)) NotifyLinksModified();
       events.erase(events.begin() + i);
       return;
     }
   }
 }
 
+void EventsList::Clear() {
+  if (HasLinksOrExternalLayouts()) NotifyLinksModified();
+  events.clear();
+}
+
 void EventsList::SerializeTo(SerializerElement& element) const {
   EventsListSerialization::SerializeEventsTo(*this, element);
 }
 
 void EventsList::UnserializeFrom(gd::Project& project,
                                  const SerializerElement& element) {
+  gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Events);
   EventsListSerialization::UnserializeEventsFrom(project, *this, element);
 }
 
@@ -119,11 +153,37 @@ bool EventsList::MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
 EventsList::EventsList(const EventsList& other) { Init(other); }
 
 EventsList& EventsList::operator=(const EventsList& other) {
-  if (this != &other) Init(other);
+  if (this != &other) {
+    // Copying events into a new list (see the copy constructor) is not a
+    // modification of the links, but replacing the events of a list is.
+    if (HasLinksOrExternalLayouts() || other.HasLinksOrExternalLayouts())
+      NotifyLinksModified();
+    Init(other);
+  }
 
   return *this;
 }
 
+bool EventsList::HasLinksOrExternalLayouts(const gd::BaseEvent& event) {
+  if (dynamic_cast<const gd::LinkEvent*>(&event) ||
+      event.GetType() == "BuiltinCommonInstructions::JsCode")
+    return true;
+  for (const gd::InstructionsList* actions : event.GetAllActionsVectors()) {
+    if (HasExternalLayouts(*actions)) return true;
+  }
+
+  return event.CanHaveSubEvents() &&
+         event.GetSubEvents().HasLinksOrExternalLayouts();
+}
+
+bool EventsList::HasLinksOrExternalLayouts() const {
+  for (const auto& event : events) {
+    if (HasLinksOrExternalLayouts(*event)) return true;
+  }
+
+  return false;
+}
+
 void EventsList::Init(const gd::EventsList& other) {
   events.clear();
   for (size_t i = 0; i < other.events.size(); ++i)
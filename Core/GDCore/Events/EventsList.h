@@ -6,6 +6,7 @@
 #if defined(GD_IDE_ONLY)
 #ifndef GDCORE_EVENTSLIST_H
 #define GDCORE_EVENTSLIST_H
+#include <atomic>
 #include <memory>
 #include <vector>
 #include "GDCore/String.h"
@@ -129,7 +130,7 @@ class GD_CORE_API EventsList {
   /**
    * \brief Clear the list of events.
    */
-  void Clear() { return events.clear(); };
+  void Clear();
 
   /** \name Utilities
    * Utility methods
@@ -206,8 +207,44 @@ class GD_CORE_API EventsList {
   void UnserializeFrom(gd::Project& project, const SerializerElement& element);
   ///@}
 
+  /**
+   * \brief Return a number that is changed every time the links between
+   * events or the external layouts they use may have changed: links,
+   * JavaScript events or actions creating objects from an external layout
+   * inserted or removed in a list, targets of links, types and parameters of
+   * these actions, names of layouts and external events.
+   *
+   * Other modifications (and copies of events) don't change it, so that what
+   * was found in events stays valid (see gd::DependenciesAnalyzer::LinksCache).
+   */
+  static std::size_t GetLinksGeneration() { return linksGeneration; }
+
+  /**
+   * \brief Notify that links or external layouts used by events were
+   * modified (see GetLinksGeneration).
+   *
+   * Called by the methods modifying them. Code modifying them in another way
+   * (like inserting an action creating objects from an external layout
+   * directly in an instructions list) must call it too.
+   */
+  static void NotifyLinksModified() { linksGeneration++; }
+
  private:
+  /**
+   * Return true if the event, or one of its sub events, is a link, is a
+   * JavaScript event or has an action creating objects from an external
+   * layout.
+   */
+  static bool HasLinksOrExternalLayouts(const gd::BaseEvent& event);
+
+  /**
+   * Return true if an event of the list is a link, is a JavaScript event or
+   * has an action creating objects from an external layout.
+   */
+  bool HasLinksOrExternalLayouts() const;
+
   std::vector<std::shared_ptr<BaseEvent> > events;
+  static std::atomic<std::size_t> linksGeneration;
 
   /**
    * Initialize from another list of events, copying events. Used by copy-ctor
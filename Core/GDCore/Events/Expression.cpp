@@ -6,8 +6,109 @@
 
 #include "GDCore/Events/Expression.h"
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/MemoryTracker.h"
+
+namespace {
+/**
+ * Parsed trees, by expression plain string. Trees are shared between all the
+ * expressions with the same plain string, and are freed when no expression is
+ * using them anymore - except the most recently parsed ones, which are kept so
+ * that a project that is unserialized again (or a copy that is made after the
+ * original is destroyed) does not need to parse its expressions again.
+ *
+ * Trees can be requested from several threads (see
+ * gd::ProjectExpressionsValidator::ValidateProjectInParallel), so the map is
+ * protected by a mutex. Parsing is done without holding it.
+ */
+class SharedRootNodes {
+ public:
+  std::shared_ptr<gd::ExpressionNode> Get(const gd::String& plainString) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = nodes.find(plainString);
+      if (it != nodes.end()) {
+        std::shared_ptr<gd::ExpressionNode> node = it->second.lock();
+        if (node) return node;
+      }
+    }
+
+    gd::ExpressionParser2 parser;
+    // Don't use make_shared, which would keep the memory of the tree
+    // allocated as long as a weak pointer exists.
+    std::shared_ptr<gd::ExpressionNode> parsedNode(
+        parser.ParseExpression(plainString).release());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::weak_ptr<gd::ExpressionNode>& weakNode = nodes[plainString];
+    // Another thread may have parsed the same expression in the meantime.
+    std::shared_ptr<gd::ExpressionNode> node = weakNode.lock();
+    if (node) return node;
+
+    weakNode = parsedNode;
+    KeepNode(parsedNode);
+    if (nodes.size() >= pruneThreshold) PruneExpiredNodes();
+    return parsedNode;
+  }
+
+  void SetKeptNodesCount(std::size_t count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    keptNodesCount = count;
+    if (keptNodes.size() > keptNodesCount) keptNodes.resize(keptNodesCount);
+    nextKeptNodeIndex = 0;
+  }
+
+ private:
+  /**
+   * Keep a strong reference on the node, replacing the oldest one when
+   * there are already keptNodesCount of them.
+   */
+  void KeepNode(const std::shared_ptr<gd::ExpressionNode>& node) {
+    if (keptNodesCount == 0) return;
+    if (keptNodes.size() < keptNodesCount) {
+      keptNodes.push_back(node);
+      return;
+    }
+    if (nextKeptNodeIndex >= keptNodes.size()) nextKeptNodeIndex = 0;
+    keptNodes[nextKeptNodeIndex++] = node;
+  }
+
+  void PruneExpiredNodes() {
+    for (auto it = nodes.begin(); it != nodes.end();) {
+      if (it->second.expired())
+        it = nodes.erase(it);
+      else
+        ++it;
+    }
+    pruneThreshold = std::max(minimumPruneThreshold, nodes.size() * 2);
+  }
+
+  static constexpr std::size_t minimumPruneThreshold = 1024;
+  std::size_t pruneThreshold = minimumPruneThreshold;
+  std::mutex mutex;
+  std::unordered_map<gd::String, std::weak_ptr<gd::ExpressionNode>> nodes;
+#if defined(EMSCRIPTEN)
+  std::size_t keptNodesCount = 4096;  // The editor reloads projects often.
+#else
+  std::size_t keptNodesCount = 0;
+#endif
+  std::size_t nextKeptNodeIndex = 0;
+  std::vector<std::shared_ptr<gd::ExpressionNode>> keptNodes;
+};
+
+constexpr std::size_t SharedRootNodes::minimumPruneThreshold;
+
+SharedRootNodes& GetSharedRootNodes() {
+  static SharedRootNodes sharedRootNodes;
+  return sharedRootNodes;
+}
+}  // namespace
 
 namespace gd {
 
@@ -20,11 +121,11 @@ Expression::Expression(const char* plainString_)
     : node(nullptr), plainString(plainString_) {};
 
 Expression::Expression(const Expression& copy)
-    : node(nullptr), plainString{copy.plainString} {};
+    : node(copy.node), plainString{copy.plainString} {};
 
 Expression& Expression::operator=(const Expression& expression) {
   plainString = expression.plainString;
-  node = nullptr;
+  node = expression.node;
   return *this;
 };
 
@@ -32,10 +133,14 @@ Expression::~Expression(){};
 
 ExpressionNode* Expression::GetRootNode() const {
   if (!node) {
-    gd::ExpressionParser2 parser = ExpressionParser2();
-    node = std::move(parser.ParseExpression(plainString));
+    gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Expressions);
+    node = GetSharedRootNodes().Get(plainString);
   }
   return node.get();
 }
 
+void Expression::SetKeptParsedTreesCount(std::size_t count) {
+  GetSharedRootNodes().SetKeptNodesCount(count);
+}
+
 }  // namespace gd
@@ -59,12 +59,38 @@ class GD_CORE_API Expression {
    */
   inline const gd::String& GetPlainString() const { return plainString; };
 
+  /**
+   * \brief Return true if \a text is found in the plain string.
+   *
+   * This is a cheap way for refactorings to skip the parsing of expressions
+   * that can't refer to the name they are looking for.
+   */
+  inline bool ContainsText(const gd::String& text) const {
+    return plainString.Raw().find(text.Raw()) != std::string::npos;
+  };
+
   /**
    * @brief Get the expression node.
-   * @return std::unique_ptr<gd::ExpressionNode>
+   *
+   * The tree is parsed on first access. It is shared with the copies of this
+   * expression and with the other expressions having the same plain string,
+   * so it must not be modified. To modify an expression, parse it with a
+   * gd::ExpressionParser2 and set the printed result instead.
    */
   gd::ExpressionNode* GetRootNode() const;
 
+  /**
+   * \brief Set how many of the most recently parsed trees are kept in memory
+   * when no expression is using them anymore (4096 by default in the editor,
+   * when built with Emscripten, and 0 otherwise).
+   *
+   * This avoids parsing again the expressions of a project that is
+   * unserialized again, or copied after the original was destroyed. Set it
+   * to 0 to free the kept trees (for example when a project is closed) and
+   * to free trees as soon as they are not used.
+   */
+  static void SetKeptParsedTreesCount(std::size_t count);
+
   /**
    * \brief Mimics std::string::c_str
    */
@@ -74,7 +100,7 @@ class GD_CORE_API Expression {
 
  private:
   gd::String plainString;  ///< The expression string
-  mutable std::unique_ptr<gd::ExpressionNode> node;
+  mutable std::shared_ptr<gd::ExpressionNode> node;  ///< The parsed tree, shared between expressions with the same string.
 };
 
 }  // namespace gd
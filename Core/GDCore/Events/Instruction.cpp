@@ -10,10 +10,24 @@
 #include <iostream>
 #include <vector>
 
+#include "GDCore/Events/EventsArena.h"
+#include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/String.h"
 
+namespace {
+
+/**
+ * Return true if the instruction type is an action using an external layout,
+ * that gd::DependenciesAnalyzer looks for.
+ */
+bool IsUsingExternalLayout(const gd::String& type) {
+  return type == "BuiltinExternalLayouts::CreateObjectsFromExternalLayout";
+}
+
+}  // namespace
+
 namespace gd {
 
 gd::Expression Instruction::badExpression("");
@@ -38,10 +52,13 @@ const gd::Expression& Instruction::GetParameter(std::size_t index) const {
 gd::Expression& Instruction::GetParameter(std::size_t index) {
   if (index >= parameters.size()) return badExpression;
 
+  // The parameter can be modified through the reference.
+  if (IsUsingExternalLayout(type)) gd::EventsList::NotifyLinksModified();
   return parameters[index];
 }
 
 void Instruction::SetParametersCount(std::size_t size) {
+  if (IsUsingExternalLayout(type)) gd::EventsList::NotifyLinksModified();
   while (size < parameters.size())
     parameters.erase(parameters.begin() + parameters.size() - 1);
   while (size > parameters.size()) parameters.push_back(gd::Expression(""));
@@ -53,6 +70,18 @@ void Instruction::SetParameter(std::size_t nb, const gd::Expression& val) {
     return;
   }
   parameters[nb] = val;
+  if (IsUsingExternalLayout(type)) gd::EventsList::NotifyLinksModified();
+}
+
+void Instruction::SetParameters(const std::vector<gd::Expression>& val) {
+  parameters = val;
+  if (IsUsingExternalLayout(type)) gd::EventsList::NotifyLinksModified();
+}
+
+void Instruction::SetType(const gd::String& newType) {
+  if (IsUsingExternalLayout(type) || IsUsingExternalLayout(newType))
+    gd::EventsList::NotifyLinksModified();
+  type = newType;
 }
 
 void Instruction::AddParameter(const gd::Expression& val) {
@@ -62,7 +91,7 @@ void Instruction::AddParameter(const gd::Expression& val) {
 std::shared_ptr<Instruction> GD_CORE_API
 CloneRememberingOriginalElement(std::shared_ptr<Instruction> instruction) {
   std::shared_ptr<Instruction> copy =
-      std::make_shared<Instruction>(*instruction);
+      gd::MakeSharedInEventsArena<Instruction>(*instruction);
   // Original instruction is either the original instruction of the copied
   // instruction, or the instruction copied.
   copy->originalInstruction = instruction->originalInstruction.expired()
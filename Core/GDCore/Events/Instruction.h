@@ -58,7 +58,7 @@ class GD_CORE_API Instruction {
    * \brief Change the instruction type
    * \param val The new type of the instruction
    */
-  void SetType(const gd::String& newType) { type = newType; }
+  void SetType(const gd::String& newType);
 
   /**
    * \brief Return true if the condition is inverted
@@ -138,9 +138,7 @@ class GD_CORE_API Instruction {
   /** \brief Replace all the parameters by new ones.
    * \param val A vector containing the new parameters.
    */
-  inline void SetParameters(const std::vector<gd::Expression>& val) {
-    parameters = val;
-  }
+  void SetParameters(const std::vector<gd::Expression>& val);
 
   /**
    * \brief Return a reference to the vector containing sub instructions
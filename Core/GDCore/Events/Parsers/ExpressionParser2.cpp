@@ -6,6 +6,7 @@
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -29,8 +30,7 @@ namespace gd {
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
 
 ExpressionParser2::ExpressionParser2()
-    : expression(""),
-      currentPosition(0) {}
+    : currentPosition(0) {}
 
 std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
   size_t textStartPosition = GetCurrentPosition();
@@ -142,4 +142,264 @@ std::unique_ptr<NumberNode> ExpressionParser2::ReadNumber() {
   return number;
 }
 
+namespace {
+
+/**
+ * \brief Move the locations of all the nodes of a tree, and of their errors,
+ * that are at or after a position.
+ */
+class ExpressionLocationsMover : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionLocationsMover(size_t position_, std::ptrdiff_t offset_)
+      : position(position_), offset(offset_){};
+  virtual ~ExpressionLocationsMover(){};
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    Move(node);
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    Move(node);
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    Move(node);
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override { Move(node); }
+  void OnVisitTextNode(TextNode& node) override { Move(node); }
+  void OnVisitVariableNode(VariableNode& node) override {
+    Move(node);
+    node.nameLocation.MovePositionsFrom(position, offset);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    Move(node);
+    node.nameLocation.MovePositionsFrom(position, offset);
+    node.dotLocation.MovePositionsFrom(position, offset);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    Move(node);
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    Move(node);
+    node.identifierNameLocation.MovePositionsFrom(position, offset);
+    node.identifierNameDotLocation.MovePositionsFrom(position, offset);
+    node.childIdentifierNameLocation.MovePositionsFrom(position, offset);
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    Move(node);
+    node.objectNameLocation.MovePositionsFrom(position, offset);
+    node.objectNameDotLocation.MovePositionsFrom(position, offset);
+    node.objectFunctionOrBehaviorNameLocation.MovePositionsFrom(position,
+                                                                offset);
+    node.behaviorNameNamespaceSeparatorLocation.MovePositionsFrom(position,
+                                                                  offset);
+    node.behaviorFunctionNameLocation.MovePositionsFrom(position, offset);
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    Move(node);
+    node.functionNameLocation.MovePositionsFrom(position, offset);
+    node.objectNameLocation.MovePositionsFrom(position, offset);
+    node.objectNameDotLocation.MovePositionsFrom(position, offset);
+    node.behaviorNameLocation.MovePositionsFrom(position, offset);
+    node.behaviorNameNamespaceSeparatorLocation.MovePositionsFrom(position,
+                                                                  offset);
+    node.openingParenthesisLocation.MovePositionsFrom(position, offset);
+    node.closingParenthesisLocation.MovePositionsFrom(position, offset);
+    for (auto& parameter : node.parameters) parameter->Visit(*this);
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override { Move(node); }
+
+ private:
+  void Move(ExpressionNode& node) {
+    node.location.MovePositionsFrom(position, offset);
+    if (node.diagnostic) node.diagnostic->MovePositionsFrom(position, offset);
+  }
+
+  size_t position;
+  std::ptrdiff_t offset;
+};
+
+/**
+ * \brief A part of an expression that can be parsed on its own: a function
+ * parameter or the inside of parentheses.
+ */
+struct ExpressionSlot {
+  std::unique_ptr<ExpressionNode>* node;
+  ExpressionNode* parent;  ///< The parent to give to a new node, if any.
+  bool isParameter;
+  size_t startPosition;  ///< Where the parser starts to read the slot.
+  size_t endPosition;    ///< Where the parser stops reading the slot.
+};
+
+/**
+ * \brief Find the slots containing a range of an expression, from the
+ * outermost to the innermost.
+ */
+class ExpressionSlotsFinder : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionSlotsFinder(const std::u32string& expression_,
+                        size_t startPosition_,
+                        size_t endPosition_)
+      : expression(expression_),
+        startPosition(startPosition_),
+        endPosition(endPosition_){};
+  virtual ~ExpressionSlotsFinder(){};
+
+  const std::vector<ExpressionSlot>& GetSlots() { return slots; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    if (node.location.IsValid())
+      AddSlotIfContainingRange(ExpressionSlot{&node.expression,
+                                              nullptr,
+                                              false,
+                                              node.location.GetStartPosition(),
+                                              node.location.GetEndPosition()});
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {}
+  void OnVisitVariableNode(VariableNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    // The parser reads a parameter from the end of the previous separator
+    // until the next separator or closing parenthesis.
+    bool hasParameterStart = node.openingParenthesisLocation.IsValid();
+    size_t parameterStartPosition =
+        node.openingParenthesisLocation.GetEndPosition();
+    for (auto& parameter : node.parameters) {
+      size_t parameterEndPosition = SkipWhitespaces(
+          parameter->location.IsValid() ? parameter->location.GetEndPosition()
+                                        : parameterStartPosition);
+      bool isParameterEndValid =
+          parameterEndPosition >= expression.size() ||
+          expression[parameterEndPosition] == ',' ||
+          expression[parameterEndPosition] == ')';
+      if (hasParameterStart && isParameterEndValid &&
+          parameter->location.IsValid())
+        AddSlotIfContainingRange(ExpressionSlot{&parameter,
+                                                &node,
+                                                true,
+                                                parameterStartPosition,
+                                                parameterEndPosition});
+
+      hasParameterStart = hasParameterStart &&
+                          parameterEndPosition < expression.size() &&
+                          expression[parameterEndPosition] == ',';
+      parameterStartPosition = parameterEndPosition + 1;
+
+      parameter->Visit(*this);
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {}
+
+ private:
+  void AddSlotIfContainingRange(const ExpressionSlot& slot) {
+    if (slot.startPosition < slot.endPosition &&
+        slot.startPosition <= startPosition &&
+        endPosition <= slot.endPosition)
+      slots.push_back(slot);
+  }
+
+  size_t SkipWhitespaces(size_t position) {
+    while (position < expression.size() && IsWhitespace(expression[position]))
+      position++;
+    return position;
+  }
+
+  const std::u32string& expression;
+  size_t startPosition;
+  size_t endPosition;
+  std::vector<ExpressionSlot> slots;
+};
+
+}  // namespace
+
+bool ExpressionParser2::ReparseExpression(
+    std::unique_ptr<ExpressionNode>& rootNode,
+    const gd::String& previousExpression,
+    size_t position,
+    size_t deletedLength,
+    const gd::String& insertedText) {
+  std::u32string previous = previousExpression.ToUTF32();
+  std::u32string inserted = insertedText.ToUTF32();
+  position = std::min(position, previous.size());
+  deletedLength = std::min(deletedLength, previous.size() - position);
+
+  expression = previous.substr(0, position) + inserted +
+               previous.substr(position + deletedLength);
+  std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(inserted.size()) -
+                          static_cast<std::ptrdiff_t>(deletedLength);
+  if (!rootNode) {
+    currentPosition = 0;
+    rootNode = Start();
+    return false;
+  }
+
+  ExpressionSlotsFinder slotsFinder(previous, position, position + deletedLength);
+  rootNode->Visit(slotsFinder);
+  const auto& slots = slotsFinder.GetSlots();
+
+  // The parser only looks at the current character, so reading a slot from
+  // its start gives the same nodes as a full parse, as long as it stops at
+  // the same (moved) end: the characters before and after it did not change.
+  for (auto it = slots.rbegin(); it != slots.rend(); ++it) {
+    const ExpressionSlot& slot = *it;
+    currentPosition = slot.startPosition;
+    SkipAllWhitespaces();
+    if (slot.isParameter &&
+        (IsEndReached() || CheckIfChar(IsParameterSeparator) ||
+         CheckIfChar(IsClosingParenthesis)))
+      continue;  // The parameter is now empty.
+
+    auto node = Expression();
+    if (currentPosition != slot.endPosition + offset) continue;
+
+    // The locations of the nodes don't always end where the parser stopped
+    // (the closing parenthesis of a sub expression is not in its location),
+    // so check that the slot was read the same way in the previous expression.
+    expression.swap(previous);
+    currentPosition = slot.startPosition;
+    Expression();
+    expression.swap(previous);
+    if (currentPosition != slot.endPosition) continue;
+
+    ExpressionLocationsMover locationsMover(slot.endPosition, offset);
+    rootNode->Visit(locationsMover);
+    if (slot.parent) node->parent = slot.parent;
+    *slot.node = std::move(node);
+    return true;
+  }
+
+  currentPosition = 0;
+  rootNode = Start();
+  return false;
+}
+
 }  // namespace gd
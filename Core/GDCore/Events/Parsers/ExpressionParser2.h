@@ -7,6 +7,7 @@
 #define GDCORE_EXPRESSIONPARSER2_H
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -55,12 +56,54 @@ class GD_CORE_API ExpressionParser2 {
    */
   std::unique_ptr<ExpressionNode> ParseExpression(
       const gd::String &expression_) {
-    expression = expression_;
+    // Decode the expression once, so that accessing a character or the
+    // length is done in constant time while parsing (gd::String::operator[]
+    // and size() are linear in the length of the string).
+    expression = expression_.ToUTF32();
 
     currentPosition = 0;
     return Start();
   }
 
+  /**
+   * Parse the given expression into a tree of nodes allocated in \a arena.
+   *
+   * \warning The returned nodes must be destroyed before the arena is reset
+   * or destroyed.
+   *
+   * \see gd::ExpressionNodeArena
+   */
+  std::unique_ptr<ExpressionNode> ParseExpression(
+      const gd::String &expression_, gd::ExpressionNodeArena &arena) {
+    gd::ExpressionNodeArena::Scope arenaScope(&arena);
+    return ParseExpression(expression_);
+  }
+
+  /**
+   * Update a tree, previously returned by ParseExpression, after a part of
+   * its expression was replaced by another text.
+   *
+   * Only the innermost parameter or sub expression containing the edit is
+   * parsed again, and the locations of the nodes after it are moved. If the
+   * edit changes the structure of the expression around it (for example, a
+   * parenthesis or a comma was typed), the whole expression is parsed again.
+   * In both cases, the tree is the same as the one given by ParseExpression
+   * on the new expression.
+   *
+   * \param rootNode The tree of the previous expression, updated in place.
+   * \param previousExpression The expression that was parsed into \a rootNode.
+   * \param position The position, in code points, of the edit.
+   * \param deletedLength The number of code points removed at \a position.
+   * \param insertedText The text inserted at \a position.
+   *
+   * \return true if only a part of the tree was parsed again.
+   */
+  bool ReparseExpression(std::unique_ptr<ExpressionNode> &rootNode,
+                         const gd::String &previousExpression,
+                         size_t position,
+                         size_t deletedLength,
+                         const gd::String &insertedText);
+
   /**
    * Given an object name (or empty if none) and a behavior name (or empty if
    * none), return the index of the first parameter that is inside the
@@ -604,7 +647,7 @@ class GD_CORE_API ExpressionParser2 {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
     if (IsNamespaceSeparator()) {
-      currentPosition += NAMESPACE_SEPARATOR.size();
+      currentPosition += 2;
     }
 
     return ExpressionParserLocation(startPosition, currentPosition);
@@ -621,9 +664,9 @@ class GD_CORE_API ExpressionParser2 {
   bool IsNamespaceSeparator() {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
-    return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+    return (currentPosition + 2 <= expression.size() &&
+            expression[currentPosition] == NAMESPACE_SEPARATOR[0] &&
+            expression[currentPosition + 1] == NAMESPACE_SEPARATOR[1]);
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -635,35 +678,29 @@ class GD_CORE_API ExpressionParser2 {
   };
 
   IdentifierAndLocation ReadIdentifierName(bool allowDeprecatedSpacesInName = true) {
-    gd::String name;
     size_t startPosition = currentPosition;
     while (currentPosition < expression.size() &&
            (CheckIfChar(IsAllowedInIdentifier)
             // Allow whitespace in identifier name for compatibility
             || (allowDeprecatedSpacesInName && expression[currentPosition] == ' '))) {
-      name += expression[currentPosition];
       currentPosition++;
     }
 
     // Trim whitespace at the end (we allow them for compatibility inside
     // the name, but after the last character that is not whitespace, they
     // should be ignore again).
-    if (!name.empty() && IsWhitespace(name[name.size() - 1])) {
-      size_t lastCharacterPos = name.size() - 1;
-      while (lastCharacterPos < name.size() &&
-             IsWhitespace(name[lastCharacterPos])) {
-        lastCharacterPos--;
-      }
-      if ((lastCharacterPos + 1) < name.size()) {
-        name.erase(lastCharacterPos + 1);
-      }
+    size_t endPosition = currentPosition;
+    while (endPosition > startPosition &&
+           IsWhitespace(expression[endPosition - 1])) {
+      endPosition--;
     }
 
     IdentifierAndLocation identifierAndLocation{
-        name,
+        gd::String::FromUTF32(
+            expression.substr(startPosition, endPosition - startPosition)),
         // The location is ignoring the trailing whitespace (only whitespace
         // inside the identifier are allowed for compatibility).
-        ExpressionParserLocation(startPosition, startPosition + name.size())};
+        ExpressionParserLocation(startPosition, endPosition)};
     return identifierAndLocation;
   }
 
@@ -731,8 +768,8 @@ class GD_CORE_API ExpressionParser2 {
   }
   ///@}
 
-  gd::String expression;
-  std::size_t currentPosition;
+  std::u32string expression;  ///< The code points of the expression being parsed.
+  std::size_t currentPosition;  ///< The position, in code points, in the expression.
 
   static gd::String NAMESPACE_SEPARATOR;
 };
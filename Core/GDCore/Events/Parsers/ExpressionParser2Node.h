@@ -5,9 +5,12 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
+#include "ExpressionParser2NodeArena.h"
 #include "ExpressionParser2NodeWorker.h"
 #include "GDCore/String.h"
 
@@ -22,22 +25,40 @@ struct FunctionCallNode;
 
 namespace gd {
 
+/**
+ * \brief The start and end positions, in code points, of a part of an
+ * expression.
+ *
+ * Positions are stored on 32 bits (and the validity is stored as an invalid
+ * start position) because trees of expressions are kept in memory for all
+ * the events of a project.
+ */
 struct GD_CORE_API ExpressionParserLocation {
-  ExpressionParserLocation() : isValid(false){};
+  ExpressionParserLocation() : startPosition(invalidPosition), endPosition(0){};
   ExpressionParserLocation(size_t position)
-      : isValid(true), startPosition(position), endPosition(position){};
+      : startPosition(position), endPosition(position){};
   ExpressionParserLocation(size_t startPosition_, size_t endPosition_)
-      : isValid(true),
-        startPosition(startPosition_),
-        endPosition(endPosition_){};
-  size_t GetStartPosition() const { return startPosition; }
+      : startPosition(startPosition_), endPosition(endPosition_){};
+  size_t GetStartPosition() const { return IsValid() ? startPosition : 0; }
   size_t GetEndPosition() const { return endPosition; }
-  bool IsValid() const { return isValid; }
+  bool IsValid() const { return startPosition != invalidPosition; }
+
+  /**
+   * \brief Move the positions that are at or after \a position by \a offset.
+   *
+   * Used to update a tree when a part of its expression was edited.
+   */
+  void MovePositionsFrom(size_t position, std::ptrdiff_t offset) {
+    if (!IsValid()) return;
+    if (startPosition >= position) startPosition += offset;
+    if (endPosition >= position) endPosition += offset;
+  }
 
  private:
-  bool isValid;
-  size_t startPosition = 0;
-  size_t endPosition = 0;
+  static constexpr std::uint32_t invalidPosition = UINT32_MAX;
+
+  std::uint32_t startPosition;
+  std::uint32_t endPosition;
 };
 
 /**
@@ -66,17 +87,31 @@ struct GD_CORE_API ExpressionParserError {
                         const ExpressionParserLocation &location_,
                         const gd::String &actualValue_ = "",
                         const gd::String &objectName_ = "")
-      : type(type_), message(message_), location(location_),
-        actualValue(actualValue_), objectName(objectName_){};
+      : type(type_), location(location_),
+        isInArena(ExpressionNodeArena::GetCurrentArena() != nullptr),
+        message(message_), actualValue(actualValue_),
+        objectName(objectName_){};
   ExpressionParserError(gd::ExpressionParserError::ErrorType type_,
                         const gd::String &message_, size_t position_)
-      : type(type_), message(message_), location(position_){};
+      : type(type_), location(position_),
+        isInArena(ExpressionNodeArena::GetCurrentArena() != nullptr),
+        message(message_){};
   ExpressionParserError(gd::ExpressionParserError::ErrorType type_,
                         const gd::String &message_, size_t startPosition_,
                         size_t endPosition_)
-      : type(type_), message(message_),
-        location(startPosition_, endPosition_){};
-  virtual ~ExpressionParserError(){};
+      : type(type_), location(startPosition_, endPosition_),
+        isInArena(ExpressionNodeArena::GetCurrentArena() != nullptr),
+        message(message_){};
+  virtual ~ExpressionParserError() {
+    ExpressionNodeArena::SetDeletedNodeInArena(isInArena);
+  };
+
+  static void *operator new(std::size_t size) {
+    return ExpressionNodeArena::AllocateNode(size);
+  }
+  static void operator delete(void *pointer) {
+    ExpressionNodeArena::DeallocateNode(pointer);
+  }
 
   gd::ExpressionParserError::ErrorType GetType() { return type; }
   const gd::String &GetMessage() { return message; }
@@ -84,11 +119,15 @@ struct GD_CORE_API ExpressionParserError {
   const gd::String &GetActualValue() { return actualValue; }
   size_t GetStartPosition() { return location.GetStartPosition(); }
   size_t GetEndPosition() { return location.GetEndPosition(); }
+  void MovePositionsFrom(size_t position, std::ptrdiff_t offset) {
+    location.MovePositionsFrom(position, offset);
+  }
 
 private:
   gd::ExpressionParserError::ErrorType type;
-  gd::String message;
   ExpressionParserLocation location;
+  bool isInArena;  ///< True if allocated in a gd::ExpressionNodeArena.
+  gd::String message;
   gd::String objectName;
   gd::String actualValue;
 };
@@ -98,10 +137,29 @@ private:
  * an expression inherits from.
  */
 struct GD_CORE_API ExpressionNode {
-  ExpressionNode() : parent(nullptr) {};
-  virtual ~ExpressionNode(){};
+  ExpressionNode()
+      : parent(nullptr),
+        isInArena(ExpressionNodeArena::GetCurrentArena() != nullptr){};
+  virtual ~ExpressionNode() {
+    // The diagnostic is deleted first, so that the node is the last one to
+    // tell the deallocation where it was allocated.
+    diagnostic.reset();
+    ExpressionNodeArena::SetDeletedNodeInArena(isInArena);
+  };
   virtual void Visit(ExpressionParser2NodeWorker &worker){};
 
+  /** \name Allocation
+   * Nodes are allocated in the current gd::ExpressionNodeArena, if any.
+   */
+  ///@{
+  static void *operator new(std::size_t size) {
+    return ExpressionNodeArena::AllocateNode(size);
+  }
+  static void operator delete(void *pointer) {
+    ExpressionNodeArena::DeallocateNode(pointer);
+  }
+  ///@}
+
   std::unique_ptr<ExpressionParserError> diagnostic;
   ExpressionParserLocation location;  ///< The location of the entire node. Some
                                       /// nodes might have other locations
@@ -110,6 +168,9 @@ struct GD_CORE_API ExpressionNode {
                                       /// object name, the dot, the function
                                       /// name, etc...
   ExpressionNode *parent;
+
+ private:
+  bool isInArena;  ///< True if allocated in a gd::ExpressionNodeArena.
 };
 
 struct GD_CORE_API SubExpressionNode : public ExpressionNode {
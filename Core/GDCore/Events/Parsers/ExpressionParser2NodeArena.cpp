@@ -0,0 +1,75 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionParser2NodeArena.h"
+
+#include <algorithm>
+#include <new>
+
+namespace {
+constexpr std::size_t alignment = alignof(std::max_align_t);
+
+thread_local gd::ExpressionNodeArena *currentArena = nullptr;
+
+// Set by the destructor of the node being deleted (or by the allocation of a
+// node, in case its constructor throws) and read when it's deallocated.
+thread_local bool deletedNodeInArena = false;
+}  // namespace
+
+namespace gd {
+
+void *ExpressionNodeArena::Allocate(std::size_t size) {
+  size = (size + alignment - 1) / alignment * alignment;
+  while (currentBlock < blocks.size() &&
+         currentOffset + size > blocks[currentBlock].second) {
+    currentBlock++;
+    currentOffset = 0;
+  }
+
+  if (currentBlock == blocks.size()) {
+    // Allocations larger than a block get their own block.
+    std::size_t newBlockSize = std::max(blockSize, size);
+    // new[] returns memory aligned for any fundamental type.
+    blocks.emplace_back(std::unique_ptr<char[]>(new char[newBlockSize]),
+                        newBlockSize);
+    reservedSize += newBlockSize;
+    currentOffset = 0;
+  }
+
+  char *allocated = blocks[currentBlock].first.get() + currentOffset;
+  currentOffset += size;
+  return allocated;
+}
+
+ExpressionNodeArena::Scope::Scope(ExpressionNodeArena *arena)
+    : previousArena(currentArena) {
+  currentArena = arena;
+}
+
+ExpressionNodeArena::Scope::~Scope() { currentArena = previousArena; }
+
+ExpressionNodeArena *ExpressionNodeArena::GetCurrentArena() {
+  return currentArena;
+}
+
+void *ExpressionNodeArena::AllocateNode(std::size_t size) {
+  deletedNodeInArena = currentArena != nullptr;
+  if (currentArena) return currentArena->Allocate(size);
+
+  return ::operator new(size);
+}
+
+void ExpressionNodeArena::DeallocateNode(void *pointer) {
+  // Memory allocated in an arena is reused when the arena is reset.
+  if (!pointer || deletedNodeInArena) return;
+
+  ::operator delete(pointer);
+}
+
+void ExpressionNodeArena::SetDeletedNodeInArena(bool isInArena) {
+  deletedNodeInArena = isInArena;
+}
+
+}  // namespace gd
@@ -0,0 +1,107 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief A memory arena where the nodes (and their errors) of parsed
+ * expressions can be allocated.
+ *
+ * Parsing a batch of expressions into an arena avoids an allocation (and a
+ * deallocation) per node. Nodes are still owned by `std::unique_ptr`, but
+ * deleting a node allocated in an arena only calls its destructor: its
+ * memory is reused when the arena is reset. Each node remembers if it was
+ * allocated in an arena, so deleting a node doesn't have to look for where
+ * its memory comes from.
+ *
+ * \warning All the nodes allocated in the arena must be destroyed before the
+ * arena is reset or destroyed. The arena is not thread-safe.
+ *
+ * \see gd::ExpressionParser2::ParseExpression
+ */
+class GD_CORE_API ExpressionNodeArena {
+ public:
+  ExpressionNodeArena(std::size_t blockSize_ = 64 * 1024)
+      : blockSize(blockSize_) {}
+  ExpressionNodeArena(const ExpressionNodeArena &) = delete;
+  ExpressionNodeArena &operator=(const ExpressionNodeArena &) = delete;
+
+  /**
+   * \brief Allocate memory for \a size bytes, suitably aligned for any type.
+   */
+  void *Allocate(std::size_t size);
+
+  /**
+   * \brief Make all the memory of the arena available again, without
+   * releasing it.
+   */
+  void Reset() {
+    currentBlock = 0;
+    currentOffset = 0;
+  }
+
+  /**
+   * \brief Return the number of bytes reserved by the arena.
+   */
+  std::size_t GetReservedSize() const { return reservedSize; }
+
+  /**
+   * \brief Set the arena used to allocate nodes on the current thread,
+   * until the scope is destroyed.
+   */
+  class GD_CORE_API Scope {
+   public:
+    Scope(ExpressionNodeArena *arena);
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+   private:
+    ExpressionNodeArena *previousArena;
+  };
+
+  /**
+   * \brief Return the arena used to allocate nodes on the current thread, if
+   * any.
+   */
+  static ExpressionNodeArena *GetCurrentArena();
+
+  /**
+   * \brief Allocate memory for a node, in the current arena if any or on the
+   * heap otherwise.
+   */
+  static void *AllocateNode(std::size_t size);
+
+  /**
+   * \brief Release memory allocated by AllocateNode, unless it was allocated
+   * in an arena (see SetDeletedNodeInArena).
+   */
+  static void DeallocateNode(void *pointer);
+
+  /**
+   * \brief Tell the next call to DeallocateNode on the current thread if the
+   * node being deleted was allocated in an arena.
+   *
+   * Called by the destructor of the nodes, as their memory can't be read
+   * anymore when it's deallocated.
+   */
+  static void SetDeletedNodeInArena(bool isInArena);
+
+ private:
+  std::size_t blockSize;
+  std::size_t currentBlock = 0;
+  std::size_t currentOffset = 0;
+  std::size_t reservedSize = 0;
+  std::vector<std::pair<std::unique_ptr<char[]>, std::size_t>> blocks;
+};
+
+}  // namespace gd
@@ -10,27 +10,40 @@
 
 EventsCodeNameMangler *EventsCodeNameMangler::_singleton = nullptr;
 
+namespace {
+/**
+ * Replace all unallowed characters by an underscore and their code point, in
+ * a single pass on the name.
+ */
+gd::String ReplaceUnallowedCharacters(const gd::String &name,
+                                      bool allowUnderscore) {
+  gd::String mangledName;
+  mangledName.Raw().reserve(name.Raw().size());
+  for (char32_t character : name) {
+    if ((character >= 'a' && character <= 'z') ||
+        (character >= 'A' && character <= 'Z') ||
+        (character >= '0' && character <= '9') ||
+        (allowUnderscore && character == '_'))
+      mangledName.push_back(character);
+    else
+      mangledName += "_" + gd::String::From(character);
+  }
+  return mangledName;
+}
+}  // namespace
+
 const gd::String& EventsCodeNameMangler::GetMangledObjectsListName(
     const gd::String &originalObjectName) {
+  std::lock_guard<std::mutex> lock(mutex);
   auto it = mangledObjectNames.find(originalObjectName);
   if (it != mangledObjectNames.end()) {
     return it->second;
   }
 
-  gd::String partiallyMangledName = GetMangledNameWithForbiddenUnderscore(originalObjectName);
-  static const gd::String allowedCharacters =
-      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
-
-  for (size_t i = 0; i < partiallyMangledName.size();
-       ++i)  // Replace all unallowed letter by an underscore and the ascii
-             // number of the letter
-  {
-    if (allowedCharacters.find_first_of(
-            std::u32string(1, partiallyMangledName[i])) == gd::String::npos) {
-      char32_t unallowedChar = partiallyMangledName[i];
-      partiallyMangledName.replace(i, 1, "_" + gd::String::From(unallowedChar));
-    }
-  }
+  // Underscores added by the first mangling are mangled too.
+  gd::String partiallyMangledName = ReplaceUnallowedCharacters(
+      GetMangledNameWithForbiddenUnderscore(originalObjectName),
+      /*allowUnderscore=*/false);
 
   mangledObjectNames[originalObjectName] = "GD" + partiallyMangledName + "Objects";
   return mangledObjectNames[originalObjectName];
@@ -38,6 +51,7 @@ const gd::String& EventsCodeNameMangler::GetMangledObjectsListName(
 
 const gd::String& EventsCodeNameMangler::GetExternalEventsFunctionMangledName(
     const gd::String &externalEventsName) {
+  std::lock_guard<std::mutex> lock(mutex);
   auto it = mangledExternalEventsNames.find(externalEventsName);
   if (it != mangledExternalEventsNames.end()) {
     return it->second;
@@ -51,40 +65,12 @@ const gd::String& EventsCodeNameMangler::GetExternalEventsFunctionMangledName(
 
 gd::String EventsCodeNameMangler::GetMangledNameWithForbiddenUnderscore(
     const gd::String &name) {
-  gd::String partiallyMangledName = name;
-  static const gd::String allowedCharacters =
-      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
-
-  for (size_t i = 0; i < partiallyMangledName.size();
-       ++i)  // Replace all unallowed letter by an underscore and the ascii
-             // number of the letter
-  {
-    if (allowedCharacters.find_first_of(
-            std::u32string(1, partiallyMangledName[i])) == gd::String::npos) {
-      char32_t unallowedChar = partiallyMangledName[i];
-      partiallyMangledName.replace(i, 1, "_" + gd::String::From(unallowedChar));
-    }
-  }
-  return partiallyMangledName;
+  return ReplaceUnallowedCharacters(name, /*allowUnderscore=*/false);
 }
 
 gd::String EventsCodeNameMangler::GetMangledName(
     const gd::String &name) {
-  gd::String partiallyMangledName = name;
-  static const gd::String allowedCharacters =
-      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
-
-  for (size_t i = 0; i < partiallyMangledName.size();
-       ++i)  // Replace all unallowed letter by an underscore and the ascii
-             // number of the letter
-  {
-    if (allowedCharacters.find_first_of(
-            std::u32string(1, partiallyMangledName[i])) == gd::String::npos) {
-      char32_t unallowedChar = partiallyMangledName[i];
-      partiallyMangledName.replace(i, 1, "_" + gd::String::From(unallowedChar));
-    }
-  }
-  return partiallyMangledName;
+  return ReplaceUnallowedCharacters(name, /*allowUnderscore=*/true);
 }
 
 
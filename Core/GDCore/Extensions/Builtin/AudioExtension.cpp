@@ -365,6 +365,40 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
           "res/actions/music.png")
       .AddCodeOnlyParameter("currentScene", "")
       .MarkAsComplex();
+
+  extension
+      .AddAction(
+          "SetMaxSoundVoices",
+          _("Maximum number of simultaneous sounds"),
+          _("Change the maximum number of sounds of the same file played at "
+            "the same time (without a channel). When reached, the oldest "
+            "sounds are stopped to play the new ones. Use 0 for no limit."),
+          _("Play at most _PARAM1_ sounds of the same file at the same time"),
+          _("Sounds"),
+          "res/actions/son24.png",
+          "res/actions/son.png")
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("expression", _("Maximum number of sounds"))
+      .SetDefaultValue("32")
+      .MarkAsAdvanced();
+
+  extension
+      .AddAction(
+          "SetSoundDeduplicationDelay",
+          _("Minimum delay between the same sounds"),
+          _("Change the delay during which a sound played again (without a "
+            "channel) is ignored. This avoids playing a sound many times at "
+            "once, for example when lots of objects collide. Use 0 to always "
+            "play the sounds."),
+          _("Ignore the same sounds played within _PARAM1_ seconds"),
+          _("Sounds"),
+          "res/actions/son24.png",
+          "res/actions/son.png")
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("expression", _("Delay (in seconds)"))
+      .SetDefaultValue("0")
+      .MarkAsAdvanced();
+
   extension
       .AddAction(
           "FadeSoundVolume",
@@ -1806,7 +1806,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                     true)
       .SetDefaultValue("no")
       .SetHelpPath("/all-features/collisions/")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsWithoutSideEffects()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddCondition("EstTourne",
@@ -1869,7 +1871,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
             "If no intersection is found, the variable won't be changed."))
       .AddCodeOnlyParameter("conditionInverted", "")
       .SetHelpPath("/all-features/collisions/")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddCondition(
@@ -1901,7 +1904,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
             "If no intersection is found, the variable won't be changed."))
       .AddCodeOnlyParameter("conditionInverted", "")
       .SetHelpPath("/all-features/collisions/")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddExpression("Count",
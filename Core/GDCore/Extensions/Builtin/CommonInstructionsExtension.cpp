@@ -123,7 +123,9 @@ BuiltinExtensionsImplementer::ImplementsCommonInstructionsExtension(
       .AddParameter("expression", _("First expression"))
       .AddParameter("relationalOperator", _("Sign of the test"), "number")
       .AddParameter("expression", _("Second expression"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsPure()
+      .MarkAsCheapToEvaluate();
 
   // Compatibility with GD <= 5.0.127
   extension
@@ -145,7 +147,9 @@ BuiltinExtensionsImplementer::ImplementsCommonInstructionsExtension(
       .AddParameter("string", _("First string expression"))
       .AddParameter("relationalOperator", _("Sign of the test"), "string")
       .AddParameter("string", _("Second string expression"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsPure()
+      .MarkAsCheapToEvaluate();
 
   // Compatibility with GD <= 5.0.127
   extension
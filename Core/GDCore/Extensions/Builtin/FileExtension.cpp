@@ -200,6 +200,21 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsFileExtension(
           "res/actions/delete.png")
       .AddParameter("string", _("Storage name"));
 
+  extension
+      .AddAction(
+          "SetWriteBehindEnabled",
+          _("Delay writes to storages"),
+          _("Group the changes made to storages during a short time and save "
+            "them at once, when the device is idle or when the game is "
+            "hidden or closed. This avoids slowdowns in games saving large "
+            "data often."),
+          _("Delay writes to storages: _PARAM0_"),
+          "",
+          "res/actions/fichier24.png",
+          "res/actions/fichier.png")
+      .AddParameter("yesorno", _("Delay writes?"))
+      .MarkAsAdvanced();
+
   extension
       .AddCondition("FileExists",
                     _("A storage exists"),
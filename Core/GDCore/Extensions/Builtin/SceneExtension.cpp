@@ -203,6 +203,35 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSceneExtension(
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("sceneName", _("Scene name"))
       .MarkAsAdvanced();
+
+  extension
+      .AddAction("PreInstantiateScene",
+                 _("Prepare scene"),
+                 _("Preload a scene resources and create its objects in "
+                   "background, a few at each frame, so that the scene "
+                   "starts instantly when it's changed to."),
+                 _("Prepare scene _PARAM1_ in background"),
+                 "",
+                 "res/actions/hourglass_black.svg",
+                 "res/actions/hourglass_black.svg")
+      .SetHelpPath("/all-features/resources-loading")
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("sceneName", _("Name of the new scene"))
+      .MarkAsAdvanced();
+
+  extension
+      .AddCondition("IsScenePreInstantiated",
+                    _("Scene prepared"),
+                    _("Check if a scene resources are loaded and its objects "
+                      "created in background."),
+                    _("Scene _PARAM1_ was prepared in background"),
+                    "",
+                    "res/actions/hourglass_black.svg",
+                    "res/actions/hourglass_black.svg")
+      .SetHelpPath("/all-features/resources-loading")
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("sceneName", _("Scene name"))
+      .MarkAsAdvanced();
 }
 
 }  // namespace gd
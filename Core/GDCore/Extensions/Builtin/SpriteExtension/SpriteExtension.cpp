@@ -697,7 +697,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
                     "res/conditions/collision.png")
       .AddParameter("objectList", _("Object 1"), "Sprite")
       .AddParameter("objectList", _("Object 2"), "Sprite")
-      .AddCodeOnlyParameter("conditionInverted", "");
+      .AddCodeOnlyParameter("conditionInverted", "")
+      .MarkAsWithoutSideEffects()
+      .MarkAsExpensiveToEvaluate();
 }
 
 }  // namespace gd
@@ -35,7 +35,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddParameter("variableOrPropertyOrParameter", _("Variable"))
       .UseStandardRelationalOperatorParameters(
-          "number", ParameterOptions::MakeNewOptions());
+          "number", ParameterOptions::MakeNewOptions())
+      .MarkAsPure()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("StringVariable",
@@ -47,7 +49,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddParameter("variableOrPropertyOrParameter", _("Variable"))
       .UseStandardRelationalOperatorParameters(
-          "string", ParameterOptions::MakeNewOptions());
+          "string", ParameterOptions::MakeNewOptions())
+      .MarkAsPure()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -63,7 +67,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
       .SetDefaultValue("true")
       // This parameter allows to keep the operand expression
       // when the editor switch between variable instructions.
-      .AddCodeOnlyParameter("trueorfalse", "");
+      .AddCodeOnlyParameter("trueorfalse", "")
+      .MarkAsPure()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddAction("SetNumberVariable",
@@ -25,6 +25,9 @@ InstructionMetadata::InstructionMetadata()
       hidden(true),
       usageComplexity(5),
       isPrivate(false),
+      pure(false),
+      withoutSideEffects(false),
+      evaluationCost(5),
       isObjectInstruction(false),
       isBehaviorInstruction(false) {}
 
@@ -48,6 +51,9 @@ InstructionMetadata::InstructionMetadata(const gd::String& extensionNamespace_,
       hidden(false),
       usageComplexity(5),
       isPrivate(false),
+      pure(false),
+      withoutSideEffects(false),
+      evaluationCost(5),
       isObjectInstruction(false),
       isBehaviorInstruction(false),
       relevantContext("Any") {}
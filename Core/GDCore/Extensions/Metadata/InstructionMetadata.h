@@ -387,6 +387,68 @@ class GD_CORE_API InstructionMetadata : public gd::AbstractFunctionMetadata {
    */
   int GetUsageComplexity() const { return usageComplexity; }
 
+  /**
+   * \brief Consider that the condition only compares values: it does not pick
+   * objects and it has no side effects.
+   *
+   * The code generator can evaluate it before the other conditions of the
+   * same event, if it does not use any object.
+   */
+  InstructionMetadata &MarkAsPure() {
+    pure = true;
+    withoutSideEffects = true;
+    return *this;
+  }
+
+  /**
+   * \brief Return true if the condition was marked as only comparing values.
+   * \see MarkAsPure
+   */
+  bool IsPure() const { return pure; }
+
+  /**
+   * \brief Consider that the condition has no side effects, other than picking
+   * objects.
+   *
+   * The code generator can skip it when a condition of the same event is
+   * false, even if this condition was written before.
+   */
+  InstructionMetadata &MarkAsWithoutSideEffects() {
+    withoutSideEffects = true;
+    return *this;
+  }
+
+  /**
+   * \brief Return true if the instruction can have side effects, other than
+   * picking objects (this is the case unless it was marked as pure or without
+   * side effects).
+   */
+  bool HasSideEffects() const { return !withoutSideEffects; }
+
+  /**
+   * \brief Consider that the instruction is fast to evaluate compared to a
+   * normal instruction (a comparison of values for example).
+   */
+  InstructionMetadata &MarkAsCheapToEvaluate() {
+    evaluationCost = 1;
+    return *this;
+  }
+
+  /**
+   * \brief Consider that the instruction is slow to evaluate compared to a
+   * normal instruction (a collision test between objects for example).
+   */
+  InstructionMetadata &MarkAsExpensiveToEvaluate() {
+    evaluationCost = 9;
+    return *this;
+  }
+
+  /**
+   * \brief Return the cost of evaluating the instruction, from 0 (fast) to 10
+   * (slow).
+   */
+  int GetEvaluationCost() const { return evaluationCost; }
+
   /**
    * \brief Defines information about how generate the code for an instruction
    */
@@ -582,6 +644,10 @@ class GD_CORE_API InstructionMetadata : public gd::AbstractFunctionMetadata {
   int usageComplexity;  ///< Evaluate the instruction from 0 (simple&easy to
                         ///< use) to 10 (complex to understand)
   bool isPrivate;
+  bool pure;
+  bool withoutSideEffects;
+  int evaluationCost;  ///< Evaluate the cost of running the instruction from 0
+                       ///< (fast) to 10 (slow)
   bool isObjectInstruction;
   bool isBehaviorInstruction;
   gd::String requiredBaseObjectCapability;
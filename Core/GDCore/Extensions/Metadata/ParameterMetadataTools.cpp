@@ -225,7 +225,7 @@ void ParameterMetadataTools::IterateOverParametersWithIndex(
     // the object in the list of parameters (if possible, just after).
     // Search "lastObjectName" in the codebase for other place where this
     // convention is enforced.
-    if (gd::ParameterMetadata::IsObject(parameterMetadata.GetType()))
+    if (parameterMetadata.GetValueTypeMetadata().IsObject())
       lastObjectName = parameterValueOrDefault.GetPlainString();
   }
 }
@@ -271,7 +271,7 @@ void ParameterMetadataTools::IterateOverParametersWithIndex(
     // the object in the list of parameters (if possible, just after).
     // Search "lastObjectName" in the codebase for other place where this
     // convention is enforced.
-    if (gd::ParameterMetadata::IsObject(parameterMetadata.GetType()))
+    if (parameterMetadata.GetValueTypeMetadata().IsObject())
       // Object can't be expressions so it should always be the object name.
       lastObjectName =
           gd::ExpressionParser2NodePrinter::PrintNode(*parameterNode);
@@ -288,8 +288,7 @@ size_t ParameterMetadataTools::GetObjectParameterIndexFor(
   // convention is enforced.
   for (std::size_t pNb = parameterIndex;
        pNb < parametersMetadata.GetParametersCount(); pNb--) {
-    if (gd::ParameterMetadata::IsObject(
-            parametersMetadata.GetParameter(pNb).GetType())) {
+    if (parametersMetadata.GetParameter(pNb).GetValueTypeMetadata().IsObject()) {
       return pNb;
     }
   }
@@ -0,0 +1,194 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Metadata/PlatformMetadataIndex.h"
+
+#include <algorithm>
+#include <map>
+
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/EffectMetadata.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Tools/MemoryTracker.h"
+
+namespace gd {
+
+namespace {
+// Entries are only added if not already there: the first extension
+// declaring a metadata wins.
+template <class T, class Index>
+void AddEntries(Index& index,
+                gd::PlatformExtension& extension,
+                std::map<gd::String, T>& allMetadata) {
+  for (auto& it : allMetadata) {
+    index.emplace(it.first,
+                  PlatformMetadataIndex::Entry<T>{&extension, &it.second});
+  }
+}
+}  // namespace
+
+PlatformMetadataIndex::PlatformMetadataIndex(const gd::Platform& platform) {
+  gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Metadata);
+  for (auto& extensionPtr : platform.GetAllPlatformExtensions()) {
+    gd::PlatformExtension& extension = *extensionPtr;
+    const auto objectsTypes = extension.GetExtensionObjectsTypes();
+    const auto behaviorsTypes = extension.GetBehaviorsTypes();
+
+    for (const gd::String& objectType : objectsTypes) {
+      objects.emplace(objectType,
+                      Entry<gd::ObjectMetadata>{
+                          &extension, &extension.GetObjectMetadata(objectType)});
+    }
+    for (const gd::String& behaviorType : behaviorsTypes) {
+      behaviors.emplace(
+          behaviorType,
+          Entry<gd::BehaviorMetadata>{
+              &extension, &extension.GetBehaviorMetadata(behaviorType)});
+    }
+    for (const gd::String& effectType : extension.GetExtensionEffectTypes()) {
+      effects.emplace(effectType,
+                      Entry<gd::EffectMetadata>{
+                          &extension, &extension.GetEffectMetadata(effectType)});
+    }
+
+    // Instructions are searched in free instructions, then in objects and
+    // then in behaviors.
+    AddEntries(actions, extension, extension.GetAllActions());
+    AddEntries(conditions, extension, extension.GetAllConditions());
+    for (const gd::String& objectType : objectsTypes) {
+      AddEntries(actions, extension, extension.GetAllActionsForObject(objectType));
+      AddEntries(
+          conditions, extension, extension.GetAllConditionsForObject(objectType));
+    }
+    for (const gd::String& behaviorType : behaviorsTypes) {
+      AddEntries(
+          actions, extension, extension.GetAllActionsForBehavior(behaviorType));
+      AddEntries(conditions,
+                 extension,
+                 extension.GetAllConditionsForBehavior(behaviorType));
+    }
+
+    // Events are searched in the extension named like their namespace first.
+    for (auto& it : extension.GetAllEvents()) {
+      const gd::String& eventType = it.first;
+      Entry<gd::EventMetadata> entry{&extension, &it.second};
+      if (eventType.substr(0, eventType.find("::")) == extension.GetName())
+        events[eventType] = entry;
+      else
+        events.emplace(eventType, entry);
+    }
+
+    AddEntries(expressions, extension, extension.GetAllExpressions());
+    AddEntries(strExpressions, extension, extension.GetAllStrExpressions());
+    for (const gd::String& objectType : objectsTypes) {
+      AddEntries(objectExpressions[objectType],
+                 extension,
+                 extension.GetAllExpressionsForObject(objectType));
+      AddEntries(objectStrExpressions[objectType],
+                 extension,
+                 extension.GetAllStrExpressionsForObject(objectType));
+    }
+    for (const gd::String& behaviorType : behaviorsTypes) {
+      AddEntries(behaviorExpressions[behaviorType],
+                 extension,
+                 extension.GetAllExpressionsForBehavior(behaviorType));
+      AddEntries(behaviorStrExpressions[behaviorType],
+                 extension,
+                 extension.GetAllStrExpressionsForBehavior(behaviorType));
+    }
+    AddEntries(baseObjectExpressions,
+               extension,
+               extension.GetAllExpressionsForObject(""));
+    AddEntries(baseObjectStrExpressions,
+               extension,
+               extension.GetAllStrExpressionsForObject(""));
+    AddEntries(baseBehaviorExpressions,
+               extension,
+               extension.GetAllExpressionsForBehavior(""));
+    AddEntries(baseBehaviorStrExpressions,
+               extension,
+               extension.GetAllStrExpressionsForBehavior(""));
+  }
+
+  SortExpressions(expressions);
+  SortExpressions(strExpressions);
+  SortExpressions(baseObjectExpressions);
+  SortExpressions(baseObjectStrExpressions);
+  SortExpressions(baseBehaviorExpressions);
+  SortExpressions(baseBehaviorStrExpressions);
+  for (const auto* byTypeIndex : {&objectExpressions,
+                                  &objectStrExpressions,
+                                  &behaviorExpressions,
+                                  &behaviorStrExpressions}) {
+    for (const auto& it : *byTypeIndex) SortExpressions(it.second);
+  }
+}
+
+void PlatformMetadataIndex::SortExpressions(const ExpressionsIndex& index) {
+  SortedExpressions& sorted = sortedExpressions[&index];
+  sorted.reserve(index.size());
+  for (const auto& it : index)
+    sorted.emplace_back(it.first.CaseFold().Raw(), &it);
+
+  // Types differing only by their case are sorted by their original type, so
+  // that the order does not depend on the order of the unordered map.
+  std::sort(sorted.begin(),
+            sorted.end(),
+            [](const SortedExpressions::value_type& a,
+               const SortedExpressions::value_type& b) {
+              if (a.first != b.first) return a.first < b.first;
+              return a.second->first.Raw() < b.second->first.Raw();
+            });
+}
+
+void PlatformMetadataIndex::ForEachWithPrefix(
+    const ExpressionsIndex& index,
+    const gd::String& prefix,
+    const ExpressionCallback& fn,
+    const ExpressionsIndex* excludedIndex) const {
+  auto sortedIt = sortedExpressions.find(&index);
+  if (sortedIt == sortedExpressions.end()) return;
+  const SortedExpressions& sorted = sortedIt->second;
+
+  const std::string caseFoldedPrefix = prefix.CaseFold().Raw();
+  auto it = std::lower_bound(
+      sorted.begin(),
+      sorted.end(),
+      caseFoldedPrefix,
+      [](const SortedExpressions::value_type& element,
+         const std::string& value) { return element.first < value; });
+  for (; it != sorted.end() &&
+         it->first.compare(0, caseFoldedPrefix.size(), caseFoldedPrefix) == 0;
+       ++it) {
+    const gd::String& expressionType = it->second->first;
+    if (excludedIndex && excludedIndex->count(expressionType)) continue;
+
+    fn(expressionType, it->second->second);
+  }
+}
+
+void PlatformMetadataIndex::ForEachInTypeOrBaseWithPrefix(
+    const ExpressionsByTypeIndex& byTypeIndex,
+    const ExpressionsIndex& baseIndex,
+    const gd::String& type,
+    const gd::String& prefix,
+    const ExpressionCallback& fn) const {
+  auto it = byTypeIndex.find(type);
+  if (it == byTypeIndex.end()) {
+    ForEachWithPrefix(baseIndex, prefix, fn);
+    return;
+  }
+
+  // Base expressions overridden by the type were already given.
+  ForEachWithPrefix(it->second, prefix, fn);
+  ForEachWithPrefix(baseIndex, prefix, fn, &it->second);
+}
+
+}  // namespace gd
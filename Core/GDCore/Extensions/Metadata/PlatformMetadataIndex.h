@@ -0,0 +1,245 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class Platform;
+class PlatformExtension;
+class BehaviorMetadata;
+class ObjectMetadata;
+class EffectMetadata;
+class EventMetadata;
+class InstructionMetadata;
+class ExpressionMetadata;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An index of the metadata declared by all the extensions of a
+ * platform, so that gd::MetadataProvider can find them without iterating on
+ * all the extensions.
+ *
+ * For each name, the index stores the metadata that gd::MetadataProvider would
+ * find by iterating on the extensions: the first extension declaring it wins.
+ *
+ * Events are an exception: like for code generation, the extension named like
+ * the namespace of the event type wins, then the first extension declaring it.
+ *
+ * Expressions are also sorted by their case-folded type, so that the
+ * expressions starting with a text typed by the user (for autocompletion) are
+ * found without going through all the expressions.
+ *
+ * \note The index is built by gd::Platform when first needed, and discarded
+ * when an extension is added or removed. Extensions must not be modified
+ * after being added to the platform, unless they are got with
+ * gd::Platform::GetExtensionToUpdate and gd::Platform::NotifyExtensionChanged
+ * is called.
+ *
+ * \see gd::Platform::GetMetadataIndex
+ */
+class GD_CORE_API PlatformMetadataIndex {
+ public:
+  template <class T>
+  struct Entry {
+    gd::PlatformExtension* extension;
+    T* metadata;
+  };
+
+  typedef std::function<void(const gd::String& expressionType,
+                             const Entry<gd::ExpressionMetadata>& entry)>
+      ExpressionCallback;
+
+  PlatformMetadataIndex(const gd::Platform& platform);
+  PlatformMetadataIndex(const PlatformMetadataIndex&) = delete;
+  PlatformMetadataIndex& operator=(const PlatformMetadataIndex&) = delete;
+
+  const Entry<gd::BehaviorMetadata>* FindBehavior(
+      const gd::String& behaviorType) const {
+    return Find(behaviors, behaviorType);
+  }
+  const Entry<gd::ObjectMetadata>* FindObject(
+      const gd::String& objectType) const {
+    return Find(objects, objectType);
+  }
+  const Entry<gd::EffectMetadata>* FindEffect(
+      const gd::String& effectType) const {
+    return Find(effects, effectType);
+  }
+  const Entry<gd::InstructionMetadata>* FindAction(
+      const gd::String& actionType) const {
+    return Find(actions, actionType);
+  }
+  const Entry<gd::InstructionMetadata>* FindCondition(
+      const gd::String& conditionType) const {
+    return Find(conditions, conditionType);
+  }
+  const Entry<gd::EventMetadata>* FindEvent(const gd::String& eventType) const {
+    return Find(events, eventType);
+  }
+
+  /**
+   * \brief Find a number (or string if \a isString is true) free expression.
+   */
+  const Entry<gd::ExpressionMetadata>* FindExpression(
+      const gd::String& expressionType, bool isString) const {
+    return Find(isString ? strExpressions : expressions, expressionType);
+  }
+
+  /**
+   * \brief Find a number (or string) expression of an object, or of the base
+   * object if not found.
+   */
+  const Entry<gd::ExpressionMetadata>* FindObjectExpression(
+      const gd::String& objectType,
+      const gd::String& expressionType,
+      bool isString) const {
+    return FindInTypeOrBase(
+        isString ? objectStrExpressions : objectExpressions,
+        isString ? baseObjectStrExpressions : baseObjectExpressions,
+        objectType,
+        expressionType);
+  }
+
+  /**
+   * \brief Find a number (or string) expression of a behavior, or of the base
+   * behavior if not found.
+   */
+  const Entry<gd::ExpressionMetadata>* FindBehaviorExpression(
+      const gd::String& behaviorType,
+      const gd::String& expressionType,
+      bool isString) const {
+    return FindInTypeOrBase(
+        isString ? behaviorStrExpressions : behaviorExpressions,
+        isString ? baseBehaviorStrExpressions : baseBehaviorExpressions,
+        behaviorType,
+        expressionType);
+  }
+
+  /**
+   * \brief Call \a fn for each number (or string) free expression whose type
+   * starts with \a prefix (ignoring the case), sorted by type.
+   */
+  void ForEachExpressionWithPrefix(const gd::String& prefix,
+                                   bool isString,
+                                   const ExpressionCallback& fn) const {
+    ForEachWithPrefix(isString ? strExpressions : expressions, prefix, fn);
+  }
+
+  /**
+   * \brief Call \a fn for each number (or string) expression of an object
+   * whose type starts with \a prefix (ignoring the case): the expressions of
+   * the object first, then the ones of the base object, each sorted by type.
+   */
+  void ForEachObjectExpressionWithPrefix(const gd::String& objectType,
+                                         const gd::String& prefix,
+                                         bool isString,
+                                         const ExpressionCallback& fn) const {
+    ForEachInTypeOrBaseWithPrefix(
+        isString ? objectStrExpressions : objectExpressions,
+        isString ? baseObjectStrExpressions : baseObjectExpressions,
+        objectType,
+        prefix,
+        fn);
+  }
+
+  /**
+   * \brief Call \a fn for each number (or string) expression of a behavior
+   * whose type starts with \a prefix (ignoring the case): the expressions of
+   * the behavior first, then the ones of the base behavior, each sorted by
+   * type.
+   */
+  void ForEachBehaviorExpressionWithPrefix(const gd::String& behaviorType,
+                                           const gd::String& prefix,
+                                           bool isString,
+                                           const ExpressionCallback& fn) const {
+    ForEachInTypeOrBaseWithPrefix(
+        isString ? behaviorStrExpressions : behaviorExpressions,
+        isString ? baseBehaviorStrExpressions : baseBehaviorExpressions,
+        behaviorType,
+        prefix,
+        fn);
+  }
+
+ private:
+  template <class T>
+  using Index = std::unordered_map<gd::String, Entry<T>>;
+  typedef Index<gd::ExpressionMetadata> ExpressionsIndex;
+  typedef std::unordered_map<gd::String, ExpressionsIndex>
+      ExpressionsByTypeIndex;
+  /**
+   * The elements of an expressions index, with their case-folded type, sorted
+   * by case-folded type.
+   */
+  typedef std::vector<
+      std::pair<std::string, const ExpressionsIndex::value_type*>>
+      SortedExpressions;
+
+  template <class T>
+  static const Entry<T>* Find(const Index<T>& index, const gd::String& name) {
+    auto it = index.find(name);
+    return it == index.end() ? nullptr : &it->second;
+  }
+
+  static const Entry<gd::ExpressionMetadata>* FindInTypeOrBase(
+      const ExpressionsByTypeIndex& byTypeIndex,
+      const ExpressionsIndex& baseIndex,
+      const gd::String& type,
+      const gd::String& expressionType) {
+    auto it = byTypeIndex.find(type);
+    if (it != byTypeIndex.end()) {
+      if (auto* entry = Find(it->second, expressionType)) return entry;
+    }
+
+    return Find(baseIndex, expressionType);
+  }
+
+  void SortExpressions(const ExpressionsIndex& index);
+
+  /**
+   * \brief Call \a fn for the expressions of \a index starting with \a prefix,
+   * except the ones also in \a excludedIndex (if not null).
+   */
+  void ForEachWithPrefix(const ExpressionsIndex& index,
+                         const gd::String& prefix,
+                         const ExpressionCallback& fn,
+                         const ExpressionsIndex* excludedIndex = nullptr) const;
+
+  void ForEachInTypeOrBaseWithPrefix(const ExpressionsByTypeIndex& byTypeIndex,
+                                     const ExpressionsIndex& baseIndex,
+                                     const gd::String& type,
+                                     const gd::String& prefix,
+                                     const ExpressionCallback& fn) const;
+
+  Index<gd::BehaviorMetadata> behaviors;
+  Index<gd::ObjectMetadata> objects;
+  Index<gd::EffectMetadata> effects;
+  Index<gd::InstructionMetadata> actions;
+  Index<gd::InstructionMetadata> conditions;
+  Index<gd::EventMetadata> events;
+  ExpressionsIndex expressions;
+  ExpressionsIndex strExpressions;
+  ExpressionsByTypeIndex objectExpressions;
+  ExpressionsByTypeIndex objectStrExpressions;
+  ExpressionsIndex baseObjectExpressions;
+  ExpressionsIndex baseObjectStrExpressions;
+  ExpressionsByTypeIndex behaviorExpressions;
+  ExpressionsByTypeIndex behaviorStrExpressions;
+  ExpressionsIndex baseBehaviorExpressions;
+  ExpressionsIndex baseBehaviorStrExpressions;
+  std::unordered_map<const ExpressionsIndex*, SortedExpressions>
+      sortedExpressions;  ///< The sorted expressions of each index above.
+};
+
+}  // namespace gd
@@ -10,7 +10,7 @@
 
 namespace gd {
 
-ValueTypeMetadata::ValueTypeMetadata() : optional(false) {}
+ValueTypeMetadata::ValueTypeMetadata() : optional(false), kinds(0) {}
 
 void ValueTypeMetadata::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("type", name);
@@ -26,13 +26,26 @@ void ValueTypeMetadata::SerializeTo(SerializerElement& element) const {
 }
 
 void ValueTypeMetadata::UnserializeFrom(const SerializerElement& element) {
-  name = element.GetStringAttribute("type");
+  SetName(element.GetStringAttribute("type"));
   supplementaryInformation =
       element.GetStringAttribute("supplementaryInformation");
   optional = element.GetBoolAttribute("optional");
   defaultValue = element.GetStringAttribute("defaultValue");
 }
 
+unsigned int ValueTypeMetadata::GetTypeKinds(const gd::String &type) {
+  unsigned int kinds = 0;
+  if (IsTypeExpression("number", type)) kinds |= NumberExpressionKind;
+  if (IsTypeExpression("string", type)) kinds |= StringExpressionKind;
+  if (IsTypeExpression("boolean", type)) kinds |= BooleanExpressionKind;
+  if (IsTypeExpression("variable", type)) kinds |= VariableExpressionKind;
+  if (IsTypeExpression("resource", type)) kinds |= ResourceKind;
+  if (type == "key" || type == "mouse") kinds |= StringValueKind;
+  if (IsTypeObject(type)) kinds |= ObjectKind;
+  if (IsTypeBehavior(type)) kinds |= BehaviorKind;
+  return kinds;
+}
+
 const gd::String ValueTypeMetadata::numberType = "number";
 const gd::String ValueTypeMetadata::stringType = "string";
 const gd::String ValueTypeMetadata::variableType = "variable";
@@ -38,6 +38,7 @@ class GD_CORE_API ValueTypeMetadata {
    */
   ValueTypeMetadata &SetName(const gd::String &name_) {
     name = name_;
+    kinds = GetTypeKinds(name);
     return *this;
   }
 
@@ -95,38 +96,52 @@ class GD_CORE_API ValueTypeMetadata {
    * \brief Return true if the type is representing one object
    * (or more, i.e: an object group).
    */
-  bool IsObject() const {
-    return gd::ValueTypeMetadata::IsTypeObject(name);
-  }
+  bool IsObject() const { return kinds & ObjectKind; }
 
   /**
    * \brief Return true if the type is "behavior".
    */
-  bool IsBehavior() const {
-    return gd::ValueTypeMetadata::IsTypeBehavior(name);
-  }
+  bool IsBehavior() const { return kinds & BehaviorKind; }
 
   /**
    * \brief Return true if the type is an expression of the
    * given type.
    */
-  bool IsNumber() const {
-    return gd::ValueTypeMetadata::IsTypeValue("number", name);
-  }
+  bool IsNumber() const { return kinds & NumberExpressionKind; }
 
   /**
    * \brief Return true if the type is a string.
    */
   bool IsString() const {
-    return gd::ValueTypeMetadata::IsTypeValue("string", name);
+    return kinds & (StringExpressionKind | StringValueKind);
   }
 
   /**
    * \brief Return true if the type is a boolean.
    */
-  bool IsBoolean() const {
-    return gd::ValueTypeMetadata::IsTypeValue("boolean", name);
-  }
+  bool IsBoolean() const { return kinds & BooleanExpressionKind; }
+
+  /**
+   * \brief Return true if the type is a string expression from the caller
+   * point of view.
+   *
+   * \see gd::ValueTypeMetadata::IsTypeExpression
+   */
+  bool IsStringExpression() const { return kinds & StringExpressionKind; }
+
+  /**
+   * \brief Return true if the type is a variable.
+   *
+   * \see gd::ValueTypeMetadata::IsTypeExpression
+   */
+  bool IsVariableExpression() const { return kinds & VariableExpressionKind; }
+
+  /**
+   * \brief Return true if the type is a resource.
+   *
+   * \see gd::ValueTypeMetadata::IsTypeExpression
+   */
+  bool IsResource() const { return kinds & ResourceKind; }
 
   /**
    * \brief Return true if the type of the parameter is a variable.
@@ -306,6 +321,30 @@ class GD_CORE_API ValueTypeMetadata {
    */
   static const gd::String &ConvertPropertyTypeToValueType(const gd::String &propertyType);
 
+  /**
+   * \brief The kinds of values a type can belong to (see the static `IsType*`
+   * functions), used as flags.
+   */
+  enum Kind : unsigned int {
+    NumberExpressionKind = 1 << 0,
+    StringExpressionKind = 1 << 1,
+    BooleanExpressionKind = 1 << 2,
+    VariableExpressionKind = 1 << 3,
+    ResourceKind = 1 << 4,
+    /// "key" and "mouse", which are strings only inside functions.
+    StringValueKind = 1 << 5,
+    ObjectKind = 1 << 6,
+    BehaviorKind = 1 << 7,
+  };
+
+  /**
+   * \brief Return the kinds (as flags) of a type.
+   *
+   * The kinds of a ValueTypeMetadata are resolved once, when its type is set,
+   * so that checking them doesn't compare strings.
+   */
+  static unsigned int GetTypeKinds(const gd::String &type);
+
   /** \name Serialization
    */
   ///@{
@@ -326,6 +365,7 @@ class GD_CORE_API ValueTypeMetadata {
   bool optional;                        ///< True if the parameter is optional
   gd::String defaultValue;     ///< Used as a default value in editor or if an
                                ///< optional parameter is empty.
+  unsigned int kinds;  ///< The kinds of the type, see GetTypeKinds.
 
   static const gd::String numberValueType;
   static const gd::String booleanValueType;
@@ -5,11 +5,14 @@
  */
 #include "Platform.h"
 
+#include <algorithm>
+
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectConfiguration.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MemoryTracker.h"
 
 using namespace std;
 
@@ -20,7 +23,33 @@ namespace gd {
 InstructionOrExpressionGroupMetadata
     Platform::badInstructionOrExpressionGroupMetadata;
 
-Platform::Platform() : enableExtensionLoadingLogs(false) {}
+Platform::Platform()
+    : nextRegistrationIndex(0), enableExtensionLoadingLogs(false) {}
+
+Platform::Platform(const Platform& other)
+    : extensionsLoaded(other.extensionsLoaded),
+      lazyExtensions(other.lazyExtensions),
+      extensionsRegistrationIndexes(other.extensionsRegistrationIndexes),
+      nextRegistrationIndex(other.nextRegistrationIndex),
+      creationFunctionTable(other.creationFunctionTable),
+      instructionOrExpressionGroupMetadata(
+          other.instructionOrExpressionGroupMetadata),
+      enableExtensionLoadingLogs(other.enableExtensionLoadingLogs) {}
+
+Platform& Platform::operator=(const Platform& other) {
+  if (this != &other) {
+    extensionsLoaded = other.extensionsLoaded;
+    lazyExtensions = other.lazyExtensions;
+    extensionsRegistrationIndexes = other.extensionsRegistrationIndexes;
+    nextRegistrationIndex = other.nextRegistrationIndex;
+    creationFunctionTable = other.creationFunctionTable;
+    instructionOrExpressionGroupMetadata =
+        other.instructionOrExpressionGroupMetadata;
+    enableExtensionLoadingLogs = other.enableExtensionLoadingLogs;
+    metadataIndex.reset();
+  }
+  return *this;
+}
 
 Platform::~Platform() {}
 
@@ -36,7 +65,46 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   }
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
-  extensionsLoaded.push_back(extension);
+  RegisterExtension(extension, nextRegistrationIndex++);
+  return true;
+}
+
+void Platform::AddLazyExtension(
+    const gd::String& name,
+    const std::vector<gd::String>& objectsTypes,
+    std::function<std::shared_ptr<PlatformExtension>()> createExtension) {
+  if (IsExtensionLoaded(name)) RemoveExtension(name);
+
+  lazyExtensions.push_back(LazyExtension{
+      name, objectsTypes, createExtension, nextRegistrationIndex++});
+}
+
+void Platform::LoadLazyExtension(std::size_t index) const {
+  LazyExtension lazyExtension = lazyExtensions[index];
+  lazyExtensions.erase(lazyExtensions.begin() + index);
+
+  gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Metadata);
+  std::shared_ptr<PlatformExtension> extension =
+      lazyExtension.createExtension();
+  if (!extension) return;
+
+  if (enableExtensionLoadingLogs)
+    std::cout << "Loading " << extension->GetName() << "..." << std::endl;
+  RegisterExtension(extension, lazyExtension.registrationIndex);
+}
+
+void Platform::RegisterExtension(std::shared_ptr<PlatformExtension> extension,
+                                 std::size_t registrationIndex) const {
+  extensionsRegistrationIndexes[extension->GetName()] = registrationIndex;
+  auto position = std::find_if(
+      extensionsLoaded.begin(),
+      extensionsLoaded.end(),
+      [&](const std::shared_ptr<PlatformExtension>& loadedExtension) {
+        return extensionsRegistrationIndexes[loadedExtension->GetName()] >
+               registrationIndex;
+      });
+  extensionsLoaded.insert(position, extension);
+  metadataIndex.reset();
 
   // Load all creation functions for objects provided by the
   // extension.
@@ -52,8 +120,6 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
        extension->GetAllInstructionOrExpressionGroupMetadata()) {
     instructionOrExpressionGroupMetadata[it.first] = it.second;
   }
-
-  return true;
 }
 
 void Platform::RemoveExtension(const gd::String& name) {
@@ -78,18 +144,61 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+  lazyExtensions.erase(remove_if(lazyExtensions.begin(),
+                                 lazyExtensions.end(),
+                                 [&name](const LazyExtension& lazyExtension) {
+                                   return lazyExtension.name == name;
+                                 }),
+                       lazyExtensions.end());
+  extensionsRegistrationIndexes.erase(name);
+  metadataIndex.reset();
+}
+
+std::shared_ptr<gd::PlatformExtension> Platform::GetExtensionToUpdate(
+    const gd::String& name) {
+  if (!GetExtension(name)) return std::shared_ptr<gd::PlatformExtension>();
+
+  for (auto& extension : extensionsLoaded) {
+    if (extension->GetName() == name) {
+      extension = std::make_shared<gd::PlatformExtension>(*extension);
+      metadataIndex.reset();
+      return extension;
+    }
+  }
+  return std::shared_ptr<gd::PlatformExtension>();
+}
+
+void Platform::NotifyExtensionChanged(const gd::String& name) {
+  metadataIndex.reset();
+
+  auto extension = GetExtension(name);
+  if (!extension) return;
+  for (const auto& it :
+       extension->GetAllInstructionOrExpressionGroupMetadata()) {
+    instructionOrExpressionGroupMetadata[it.first] = it.second;
+  }
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return true;
   }
+  for (std::size_t i = 0; i < lazyExtensions.size(); ++i) {
+    if (lazyExtensions[i].name == name) return true;
+  }
 
   return false;
 }
 
 std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
     const gd::String& name) const {
+  for (std::size_t i = 0; i < lazyExtensions.size(); ++i) {
+    if (lazyExtensions[i].name == name) {
+      LoadLazyExtension(i);
+      break;
+    }
+  }
+
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return extensionsLoaded[i];
   }
@@ -99,6 +208,16 @@ std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
 
 std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
     gd::String type) const {
+  if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
+    for (std::size_t i = 0; i < lazyExtensions.size(); ++i) {
+      const auto& objectsTypes = lazyExtensions[i].objectsTypes;
+      if (std::find(objectsTypes.begin(), objectsTypes.end(), type) !=
+          objectsTypes.end()) {
+        LoadLazyExtension(i);
+        break;
+      }
+    }
+  }
   if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
     gd::LogWarning("Tried to create an object configuration with an unknown type: " + type
               + " for platform " + GetName() + "!");
@@ -118,13 +237,25 @@ std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
 #if defined(GD_IDE_ONLY)
 std::shared_ptr<gd::BaseEvent> Platform::CreateEvent(
     const gd::String& eventType) const {
+  // The metadata index gives the event without iterating on the extensions.
+  // It's not used while some extensions are still lazy, to avoid creating them
+  // if the event is declared by an extension already created.
+  if (lazyExtensions.empty()) {
+    auto* entry = GetMetadataIndex().FindEvent(eventType);
+    if (!entry) return std::shared_ptr<gd::BaseEvent>();
+
+    return entry->extension->CreateEvent(eventType);
+  }
+
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     std::shared_ptr<gd::BaseEvent> event =
         extensionsLoaded[i]->CreateEvent(eventType);
     if (event != std::shared_ptr<gd::BaseEvent>()) return event;
   }
 
-  return std::shared_ptr<gd::BaseEvent>();
+  // The event can be declared by an extension that is not created yet.
+  LoadAllLazyExtensions();
+  return CreateEvent(eventType);
 }
 #endif
 
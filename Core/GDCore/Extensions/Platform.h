@@ -6,11 +6,13 @@
 
 #ifndef GDCORE_PLATFORM_H
 #define GDCORE_PLATFORM_H
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
 
 #include "GDCore/Extensions/Metadata/InstructionOrExpressionGroupMetadata.h"
+#include "GDCore/Extensions/Metadata/PlatformMetadataIndex.h"
 #include "GDCore/String.h"
 namespace gd {
 class InstructionsMetadataHolder;
@@ -42,6 +44,12 @@ namespace gd {
 class GD_CORE_API Platform {
  public:
   Platform();
+  /**
+   * \brief Copy a platform. The metadata index is not copied but built
+   * again when needed.
+   */
+  Platform(const Platform& other);
+  Platform& operator=(const Platform& other);
   virtual ~Platform();
 
   /**
@@ -96,8 +104,26 @@ class GD_CORE_API Platform {
    */
   virtual bool AddExtension(std::shared_ptr<PlatformExtension> extension);
 
+  /**
+   * \brief Add an extension to the platform that is only created when it is
+   * first needed: when it is got by its name, when one of its objects is
+   * created or when all the extensions (or their metadata) are used.
+   *
+   * This avoids to build the metadata of all the extensions when the platform
+   * is created.
+   *
+   * \param name The name of the extension, as declared by the extension.
+   * \param objectsTypes The types of the objects declared by the extension.
+   * \param createExtension The function creating the extension.
+   */
+  void AddLazyExtension(
+      const gd::String& name,
+      const std::vector<gd::String>& objectsTypes,
+      std::function<std::shared_ptr<PlatformExtension>()> createExtension);
+
   /**
    * \brief Return true if an extension with the specified name is loaded
+   * (or will be created when needed, see AddLazyExtension).
    */
   bool IsExtensionLoaded(const gd::String& name) const;
 
@@ -113,6 +139,7 @@ class GD_CORE_API Platform {
    */
   const std::vector<std::shared_ptr<gd::PlatformExtension>>&
   GetAllPlatformExtensions() const {
+    LoadAllLazyExtensions();
     return extensionsLoaded;
   };
 
@@ -124,12 +151,63 @@ class GD_CORE_API Platform {
    */
   virtual void RemoveExtension(const gd::String& name);
 
+  /**
+   * \brief Replace a loaded extension by a copy of it, at the same place in
+   * the platform, and return the copy so that some of its metadata can be
+   * declared again, without redeclaring the whole extension (for example when
+   * a function of an events based extension is modified).
+   *
+   * The extension is copied so that the platforms and gd::PlatformSnapshot
+   * sharing it are not modified.
+   *
+   * \warning Call NotifyExtensionChanged when the copy is modified.
+   *
+   * @return Shared pointer to the copy, or nullptr if the extension is not
+   * loaded.
+   */
+  std::shared_ptr<PlatformExtension> GetExtensionToUpdate(
+      const gd::String& name);
+
+  /**
+   * \brief Notify the platform that the metadata of an extension were
+   * modified (see GetExtensionToUpdate), so that the index of the metadata
+   * and the groups of instructions or expressions are updated.
+   */
+  void NotifyExtensionChanged(const gd::String& name);
+
+  /**
+   * \brief Get the index of the metadata declared by the extensions, used by
+   * gd::MetadataProvider.
+   *
+   * The index is built on first use, and rebuilt after extensions are added,
+   * removed or changed (see NotifyExtensionChanged).
+   */
+  const gd::PlatformMetadataIndex& GetMetadataIndex() const {
+    if (!metadataIndex) metadataIndex.reset(new PlatformMetadataIndex(*this));
+    return *metadataIndex;
+  }
+
+  /**
+   * \brief Create the lazy extensions and the index of the metadata, so that
+   * the platform is not modified anymore when it's read.
+   *
+   * The const methods create lazy extensions and the metadata index when
+   * first needed, which is not thread safe. This must be called before the
+   * platform is read by tasks running in parallel (see gd::TasksRunner), and
+   * the platform must not be modified while they run.
+   */
+  void PrepareForConcurrentUse() const {
+    LoadAllLazyExtensions();
+    GetMetadataIndex();
+  }
+
   /**
    * \brief Get the metadata (icon, etc...) of a group used for instructions or
    * expressions.
    */
   const InstructionOrExpressionGroupMetadata& GetInstructionOrExpressionGroupMetadata(
       const gd::String& name) const {
+    LoadAllLazyExtensions();
     auto it = instructionOrExpressionGroupMetadata.find(name);
     if (it == instructionOrExpressionGroupMetadata.end())
       return badInstructionOrExpressionGroupMetadata;
@@ -166,14 +244,44 @@ class GD_CORE_API Platform {
   };
 
  private:
-  std::vector<std::shared_ptr<PlatformExtension>>
+  struct LazyExtension {
+    gd::String name;
+    std::vector<gd::String> objectsTypes;
+    std::function<std::shared_ptr<PlatformExtension>()> createExtension;
+    std::size_t registrationIndex;
+  };
+
+  /**
+   * \brief Register the extension, keeping the extensions sorted in the
+   * order they were added to the platform.
+   */
+  void RegisterExtension(std::shared_ptr<PlatformExtension> extension,
+                         std::size_t registrationIndex) const;
+
+  /**
+   * \brief Create the lazy extension at the given index of lazyExtensions.
+   */
+  void LoadLazyExtension(std::size_t index) const;
+
+  void LoadAllLazyExtensions() const {
+    while (!lazyExtensions.empty()) LoadLazyExtension(0);
+  }
+
+  mutable std::vector<std::shared_ptr<PlatformExtension>>
       extensionsLoaded;  ///< Extensions of the platform
-  std::map<gd::String, CreateFunPtr>
+  mutable std::vector<LazyExtension>
+      lazyExtensions;  ///< Extensions not created yet, see AddLazyExtension.
+  mutable std::map<gd::String, std::size_t>
+      extensionsRegistrationIndexes;  ///< Order of the extensions.
+  std::size_t nextRegistrationIndex;
+  mutable std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
-  std::map<gd::String, InstructionOrExpressionGroupMetadata>
+  mutable std::map<gd::String, InstructionOrExpressionGroupMetadata>
       instructionOrExpressionGroupMetadata;
   static InstructionOrExpressionGroupMetadata badInstructionOrExpressionGroupMetadata;
   bool enableExtensionLoadingLogs;
+  mutable std::unique_ptr<gd::PlatformMetadataIndex>
+      metadataIndex;  ///< Lazily built, see GetMetadataIndex.
 };
 
 }  // namespace gd
@@ -465,6 +465,15 @@ PlatformExtension::GetAllStrExpressions() {
   return strExpressionsInfos;
 }
 
+void PlatformExtension::RemoveInstructionsAndExpressions(
+    const gd::String& name) {
+  const gd::String nameWithNamespace = GetNameSpace() + name;
+  actionsInfos.erase(nameWithNamespace);
+  conditionsInfos.erase(nameWithNamespace);
+  expressionsInfos.erase(nameWithNamespace);
+  strExpressionsInfos.erase(nameWithNamespace);
+}
+
 const std::vector<gd::DependencyMetadata>&
 PlatformExtension::GetAllDependencies() const {
   return extensionDependenciesMetadata;
@@ -542,6 +542,15 @@ class GD_CORE_API PlatformExtension {
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllStrExpressions();
 
+  /**
+   * \brief Remove the actions, conditions and expressions (not the ones of
+   * objects or behaviors) declared with the given name, so that they can be
+   * declared again.
+   *
+   * \see gd::Platform::GetExtensionToUpdate
+   */
+  void RemoveInstructionsAndExpressions(const gd::String& name);
+
   /**
    * \brief Return a reference to a vector containing the metadata of all the
    * dependencies of the extension.
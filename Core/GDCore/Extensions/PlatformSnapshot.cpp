@@ -0,0 +1,70 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/PlatformSnapshot.h"
+
+#include <cstdint>
+
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/VersionWrapper.h"
+
+namespace gd {
+
+PlatformSnapshot::PlatformSnapshot() {}
+
+PlatformSnapshot::~PlatformSnapshot() {}
+
+gd::String PlatformSnapshot::ComputeKey(const gd::Project &project) {
+  // 64 bits FNV-1a hash of the serialized extensions.
+  std::uint64_t hash = 14695981039346656037ULL;
+  auto addToHash = [&hash](const char *data, std::size_t size) {
+    for (std::size_t i = 0; i < size; i++) {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 1099511628211ULL;
+    }
+  };
+
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       i++) {
+    gd::SerializerElement element;
+    project.GetEventsFunctionsExtension(i).SerializeTo(element);
+    gd::Serializer::ToJSON(element, addToHash);
+    addToHash("", 1);
+  }
+
+  static const char *hexDigits = "0123456789abcdef";
+  gd::String hashString;
+  for (int shift = 60; shift >= 0; shift -= 4)
+    hashString += hexDigits[(hash >> shift) & 0xf];
+
+  return gd::VersionWrapper::FullString() + "-" +
+         gd::String::From(project.GetEventsFunctionsExtensionsCount()) + "-" +
+         hashString;
+}
+
+void PlatformSnapshot::Take(const gd::Platform &platform_,
+                            const gd::String &key_) {
+  platform.reset(new gd::Platform(platform_));
+  key = key_;
+}
+
+bool PlatformSnapshot::Restore(gd::Platform &platform_,
+                               const gd::String &key_) const {
+  if (!platform || key != key_) return false;
+
+  platform_ = *platform;
+  return true;
+}
+
+void PlatformSnapshot::Clear() {
+  platform.reset();
+  key.clear();
+}
+
+}  // namespace gd
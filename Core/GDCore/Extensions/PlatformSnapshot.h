@@ -0,0 +1,84 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class Platform;
+class Project;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A copy of the extensions of a platform, with their metadata, that can
+ * be restored later instead of declaring the extensions again.
+ *
+ * Typically, the extensions of the events functions extensions of a project
+ * are declared once, then a snapshot is taken with a key computed from the
+ * project (see ComputeKey). When a project with the same key is opened again
+ * (or exported by the same worker), the snapshot is restored instead of
+ * running all the declaration code:
+ * \code
+ * gd::String key = gd::PlatformSnapshot::ComputeKey(project);
+ * if (!snapshot.Restore(platform, key)) {
+ *   // Declare the extensions of the project...
+ *   snapshot.Take(platform, key);
+ * }
+ * \endcode
+ *
+ * \note The metadata contain functions (to create objects or generate code),
+ * so the snapshot is kept in memory and can't be serialized. The extensions
+ * are shared with the platform: they are not copied.
+ *
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API PlatformSnapshot {
+ public:
+  PlatformSnapshot();
+  virtual ~PlatformSnapshot();
+
+  /**
+   * \brief Compute the key identifying the extensions declared for a project:
+   * the version of GDevelop and the events functions extensions of the
+   * project.
+   */
+  static gd::String ComputeKey(const gd::Project &project);
+
+  /**
+   * \brief Copy the extensions of the platform, identified by the key.
+   */
+  void Take(const gd::Platform &platform, const gd::String &key);
+
+  /**
+   * \brief Restore the extensions of the platform, if the snapshot was taken
+   * with the same key.
+   *
+   * \return true if the snapshot was restored, false if there is no snapshot
+   * or if it was taken with another key (the platform is not modified).
+   */
+  bool Restore(gd::Platform &platform, const gd::String &key) const;
+
+  /**
+   * \brief Return the key of the snapshot, or an empty string if no snapshot
+   * was taken.
+   */
+  const gd::String &GetKey() const { return key; }
+
+  /**
+   * \brief Remove the snapshot.
+   */
+  void Clear();
+
+ private:
+  std::unique_ptr<gd::Platform> platform;
+  gd::String key;
+};
+
+}  // namespace gd
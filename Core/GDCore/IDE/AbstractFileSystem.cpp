@@ -18,4 +18,45 @@ gd::String gd::AbstractFileSystem::NormalizeSeparator(gd::String filename) {
   return filename.FindAndReplace("\\", "/");
 }
 
+std::vector<bool> AbstractFileSystem::CopyFiles(
+    const std::vector<std::pair<gd::String, gd::String>>&
+        filesAndDestinations) {
+  std::vector<bool> copied;
+  copied.reserve(filesAndDestinations.size());
+  for (const auto& fileAndDestination : filesAndDestinations)
+    copied.push_back(
+        CopyFile(fileAndDestination.first, fileAndDestination.second));
+
+  return copied;
+}
+
+gd::String AbstractFileSystem::GetFileFingerprint(const gd::String& file) {
+  return "";
+}
+
+bool AbstractFileSystem::RemoveFile(const gd::String& file) { return false; }
+
+bool AbstractFileSystem::OpenForWrite(const gd::String& file) {
+  openedFilesContent[file].clear();
+  return true;
+}
+
+bool AbstractFileSystem::Append(const gd::String& file,
+                                const gd::String& content) {
+  auto it = openedFilesContent.find(file);
+  if (it == openedFilesContent.end()) return false;
+
+  it->second += content;
+  return true;
+}
+
+bool AbstractFileSystem::Close(const gd::String& file) {
+  auto it = openedFilesContent.find(file);
+  if (it == openedFilesContent.end()) return false;
+
+  bool written = WriteToFile(file, it->second);
+  openedFilesContent.erase(it);
+  return written;
+}
+
 }  // namespace gd
@@ -6,6 +6,8 @@
 
 #ifndef GDCORE_ABSTRACTFILESYSTEM
 #define GDCORE_ABSTRACTFILESYSTEM
+#include <map>
+#include <utility>
 #include <vector>
 #include "GDCore/String.h"
 
@@ -100,6 +102,38 @@ class GD_CORE_API AbstractFileSystem {
   virtual bool CopyFile(const gd::String& file,
                         const gd::String& destination) = 0;
 
+  /**
+   * \brief Copy several files at once.
+   *
+   * File systems able to do it should override this to copy the files
+   * concurrently. By default, files are copied one after the other with
+   * CopyFile.
+   *
+   * \param filesAndDestinations The files to copy, with their destination.
+   * The directories of the destinations must exist.
+   * \return For each file, true if it was copied.
+   */
+  virtual std::vector<bool> CopyFiles(
+      const std::vector<std::pair<gd::String, gd::String>>&
+          filesAndDestinations);
+
+  /**
+   * \brief Return a string that changes when the content of the file changes
+   * (for example, made of its size and its last modification time).
+   *
+   * Used to avoid copying again files that did not change. By default, an
+   * empty string is returned, meaning that the file system can't tell.
+   */
+  virtual gd::String GetFileFingerprint(const gd::String& file);
+
+  /**
+   * \brief Remove a file.
+   *
+   * By default, nothing is done and false is returned.
+   * \return true if the operation succeeded.
+   */
+  virtual bool RemoveFile(const gd::String& file);
+
   /**
    * \brief Write the content of a string to a file.
    * \return true if the operation succeeded.
@@ -107,6 +141,30 @@ class GD_CORE_API AbstractFileSystem {
   virtual bool WriteToFile(const gd::String& file,
                            const gd::String& content) = 0;
 
+  /**
+   * \brief Start writing a file piece by piece: its content is given with
+   * Append and the file is written when Close is called.
+   *
+   * File systems able to do it should override OpenForWrite, Append and Close
+   * to write the content as it comes. By default, the content is kept in
+   * memory and written with WriteToFile when the file is closed.
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool OpenForWrite(const gd::String& file);
+
+  /**
+   * \brief Add some content at the end of a file opened with OpenForWrite.
+   * \return true if the operation succeeded.
+   */
+  virtual bool Append(const gd::String& file, const gd::String& content);
+
+  /**
+   * \brief Finish writing a file opened with OpenForWrite.
+   * \return true if the operation succeeded.
+   */
+  virtual bool Close(const gd::String& file);
+
   /**
    * \brief Read the content of a file.
    * \return The content of the file.
@@ -125,6 +183,12 @@ class GD_CORE_API AbstractFileSystem {
 
  protected:
   AbstractFileSystem(){};
+
+ private:
+  std::map<gd::String, gd::String>
+      openedFilesContent;  ///< The content of the files opened with
+                           ///< OpenForWrite, when written by the default
+                           ///< implementation.
 };
 
 }  // namespace gd
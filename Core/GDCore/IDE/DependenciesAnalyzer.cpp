@@ -9,27 +9,139 @@
 #include "GDCore/Events/Builtin/LinkEvent.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+const DependenciesAnalyzer::LinksCache::EventsDependencies&
+DependenciesAnalyzer::LinksCache::GetEventsDependencies(
+    const gd::Layout& layout) {
+  auto it = layoutsDependencies.find(layout.GetName());
+  if (it != layoutsDependencies.end()) return it->second;
+
+  EventsDependencies& dependencies = layoutsDependencies[layout.GetName()];
+  FindEventsDependencies(layout.GetEvents(), dependencies);
+  return dependencies;
+}
+
+const DependenciesAnalyzer::LinksCache::EventsDependencies&
+DependenciesAnalyzer::LinksCache::GetEventsDependencies(
+    const gd::ExternalEvents& externalEvents) {
+  auto it = externalEventsEventsDependencies.find(externalEvents.GetName());
+  if (it != externalEventsEventsDependencies.end()) return it->second;
+
+  EventsDependencies& dependencies =
+      externalEventsEventsDependencies[externalEvents.GetName()];
+  FindEventsDependencies(externalEvents.GetEvents(), dependencies);
+  return dependencies;
+}
+
+void DependenciesAnalyzer::LinksCache::ClearIfLinksModified() {
+  const std::size_t currentLinksGeneration =
+      gd::EventsList::GetLinksGeneration();
+  if (linksGeneration == currentLinksGeneration) return;
+
+  Clear();
+  linksGeneration = currentLinksGeneration;
+}
+
+void DependenciesAnalyzer::LinksCache::FindEventsDependencies(
+    const gd::EventsList& events, EventsDependencies& dependencies) {
+  for (unsigned int i = 0; i < events.size(); ++i) {
+    const gd::BaseEvent& event = events[i];
+    const gd::LinkEvent* linkEvent = dynamic_cast<const gd::LinkEvent*>(&event);
+    if (linkEvent) dependencies.linksTargets.push_back(linkEvent->GetTarget());
+
+    if (event.GetType() == "BuiltinCommonInstructions::JsCode") {
+      // The code can't be analyzed: assume it uses external layouts if it
+      // mentions them.
+      gd::SerializerElement element;
+      event.SerializeTo(element);
+      if (element.HasChild("inlineCode") &&
+          element.GetChild("inlineCode").GetMultilineStringValue().find(
+              "ExternalLayout") != gd::String::npos)
+        dependencies.hasUnknownExternalLayouts = true;
+    }
+    for (const gd::InstructionsList* actions : event.GetAllActionsVectors())
+      FindInstructionsDependencies(*actions, dependencies);
+
+    if (event.CanHaveSubEvents())
+      FindEventsDependencies(event.GetSubEvents(), dependencies);
+  }
+}
+
+void DependenciesAnalyzer::LinksCache::FindInstructionsDependencies(
+    const gd::InstructionsList& instructions,
+    EventsDependencies& dependencies) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    const gd::Instruction& instruction = instructions[i];
+    if (instruction.GetType() ==
+        "BuiltinExternalLayouts::CreateObjectsFromExternalLayout") {
+      // The name is known only if it's a text without any operation.
+      const gd::String& name =
+          instruction.GetParametersCount() > 1
+              ? instruction.GetParameter(1).GetPlainString()
+              : gd::String();
+      if (name.size() >= 2 && name[0] == '"' &&
+          name.find('"', 1) == name.size() - 1 &&
+          name.find('\\') == gd::String::npos)
+        dependencies.externalLayouts.insert(name.substr(1, name.size() - 2));
+      else
+        dependencies.hasUnknownExternalLayouts = true;
+    }
+
+    FindInstructionsDependencies(instruction.GetSubInstructions(),
+                                 dependencies);
+  }
+}
 
 DependenciesAnalyzer::DependenciesAnalyzer(const gd::Project& project_,
                                            const gd::Layout& layout_)
-    : project(project_), layout(&layout_), externalEvents(NULL) {
+    : project(project_),
+      layout(&layout_),
+      externalEvents(NULL),
+      linksCache(ownLinksCache) {
   parentScenes.push_back(layout->GetName());
 }
 
 DependenciesAnalyzer::DependenciesAnalyzer(const gd::Project& project_,
                                            const gd::ExternalEvents& externalEvents_)
-    : project(project_), layout(NULL), externalEvents(&externalEvents_) {
+    : project(project_),
+      layout(NULL),
+      externalEvents(&externalEvents_),
+      linksCache(ownLinksCache) {
+  parentExternalEvents.push_back(externalEvents->GetName());
+}
+
+DependenciesAnalyzer::DependenciesAnalyzer(const gd::Project& project_,
+                                           const gd::Layout& layout_,
+                                           LinksCache& linksCache_)
+    : project(project_),
+      layout(&layout_),
+      externalEvents(NULL),
+      linksCache(linksCache_) {
+  parentScenes.push_back(layout->GetName());
+}
+
+DependenciesAnalyzer::DependenciesAnalyzer(const gd::Project& project_,
+                                           const gd::ExternalEvents& externalEvents_,
+                                           LinksCache& linksCache_)
+    : project(project_),
+      layout(NULL),
+      externalEvents(&externalEvents_),
+      linksCache(linksCache_) {
   parentExternalEvents.push_back(externalEvents->GetName());
 }
 
 bool DependenciesAnalyzer::Analyze() {
+  linksCache.ClearIfLinksModified();
   if (layout)
-    return Analyze(layout->GetEvents());
+    return Analyze(linksCache.GetEventsDependencies(*layout));
   else if (externalEvents)
-    return Analyze(externalEvents->GetEvents());
+    return Analyze(linksCache.GetEventsDependencies(*externalEvents));
 
   std::cout << "ERROR: DependenciesAnalyzer called without any layout or "
                "external events.";
@@ -38,45 +150,46 @@ bool DependenciesAnalyzer::Analyze() {
 
 DependenciesAnalyzer::~DependenciesAnalyzer() {}
 
-bool DependenciesAnalyzer::Analyze(const gd::EventsList& events) {
-  for (unsigned int i = 0; i < events.size(); ++i) {
-    const gd::LinkEvent* linkEvent = dynamic_cast<const gd::LinkEvent*>(&events[i]);
-    if (linkEvent) {
-      gd::String linked = linkEvent->GetTarget();
-      if (project.HasExternalEventsNamed(linked)) {
-        if (std::find(parentExternalEvents.begin(),
-                      parentExternalEvents.end(),
-                      linked) != parentExternalEvents.end()) {
-          // Circular dependency!
+bool DependenciesAnalyzer::Analyze(
+    const LinksCache::EventsDependencies& eventsDependencies) {
+  externalLayoutsDependencies.insert(eventsDependencies.externalLayouts.begin(),
+                                     eventsDependencies.externalLayouts.end());
+  if (eventsDependencies.hasUnknownExternalLayouts)
+    hasUnknownExternalLayoutsDependencies = true;
+
+  // The links are in the same order as in the events (including sub events),
+  // so the dependencies are analyzed in the same order as the events.
+  for (const gd::String& linked : eventsDependencies.linksTargets) {
+    if (project.HasExternalEventsNamed(linked)) {
+      if (std::find(parentExternalEvents.begin(),
+                    parentExternalEvents.end(),
+                    linked) != parentExternalEvents.end()) {
+        // Circular dependency!
+        return false;
+      }
+      bool wasDependencyJustAdded = externalEventsDependencies.insert(linked).second;
+      if (wasDependencyJustAdded) {
+        parentExternalEvents.push_back(linked);
+        if (!Analyze(linksCache.GetEventsDependencies(
+                project.GetExternalEvents(linked))))
           return false;
-        }
-        bool wasDependencyJustAdded = externalEventsDependencies.insert(linked).second;
-        if (wasDependencyJustAdded) {
-          parentExternalEvents.push_back(linked);
-          if (!Analyze(project.GetExternalEvents(linked).GetEvents()))
-            return false;
-          parentExternalEvents.pop_back();
-        }
-      } else if (project.HasLayoutNamed(linked)) {
-        if (std::find(parentScenes.begin(), parentScenes.end(), linked) !=
-            parentScenes.end()) {
-          // Circular dependency!
+        parentExternalEvents.pop_back();
+      }
+    } else if (project.HasLayoutNamed(linked)) {
+      if (std::find(parentScenes.begin(), parentScenes.end(), linked) !=
+          parentScenes.end()) {
+        // Circular dependency!
+        return false;
+      }
+      bool wasDependencyJustAdded = scenesDependencies.insert(linked).second;
+      if (wasDependencyJustAdded) {
+        parentScenes.push_back(linked);
+        if (!Analyze(
+                linksCache.GetEventsDependencies(project.GetLayout(linked))))
           return false;
-        }
-        bool wasDependencyJustAdded = scenesDependencies.insert(linked).second;
-        if (wasDependencyJustAdded) {
-          parentScenes.push_back(linked);
-          if (!Analyze(project.GetLayout(linked).GetEvents()))
-            return false;
-          parentScenes.pop_back();
-        }
+        parentScenes.pop_back();
       }
     }
-
-    // Analyze sub events dependencies
-    if (events[i].CanHaveSubEvents()) {
-      if (!Analyze(events[i].GetSubEvents())) return false;
-    }
   }
 
   return true;
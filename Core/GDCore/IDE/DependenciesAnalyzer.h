@@ -6,13 +6,16 @@
 #if defined(GD_IDE_ONLY)
 #ifndef DEPENDENCIESANALYZER_H
 #define DEPENDENCIESANALYZER_H
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <vector>
+#include "GDCore/Events/EventsList.h"
 #include "GDCore/String.h"
 namespace gd {
 class EventsList;
+class InstructionsList;
 }
 namespace gd {
 class BaseEvent;
@@ -32,6 +35,121 @@ class ExternalEvents;
  */
 class GD_CORE_API DependenciesAnalyzer {
  public:
+  /**
+   * \brief The targets of the links (and the other dependencies) of the
+   * events of scenes and external events, found once for each of them.
+   *
+   * Give the same cache to several analyzers to avoid browsing the events of
+   * the same scenes and external events again (for example, when analyzing
+   * all the scenes of a project).
+   *
+   * Everything found is forgotten when an analysis starts after links or
+   * external layouts used by events were modified (see
+   * gd::EventsList::GetLinksGeneration).
+   */
+  class GD_CORE_API LinksCache {
+   public:
+    /**
+     * \brief What the events of a scene or external events use, without the
+     * events they link to.
+     */
+    struct EventsDependencies {
+      /**
+       * The targets of the links, in the order they are found in the events.
+       */
+      std::vector<gd::String> linksTargets;
+      /**
+       * The external layouts from which objects are created by the events.
+       */
+      std::set<gd::String> externalLayouts;
+      /**
+       * True if objects are created from external layouts with names only
+       * known when the game is running (computed names, JavaScript events).
+       */
+      bool hasUnknownExternalLayouts = false;
+    };
+
+    LinksCache(){};
+
+    /**
+     * \brief Return the targets of the links of the events of the layout, in
+     * the order they are found in the events.
+     */
+    const std::vector<gd::String>& GetLinksTargets(const gd::Layout& layout) {
+      ClearIfLinksModified();
+      return GetEventsDependencies(layout).linksTargets;
+    };
+
+    /**
+     * \brief Return the targets of the links of the external events, in the
+     * order they are found in the events.
+     */
+    const std::vector<gd::String>& GetLinksTargets(
+        const gd::ExternalEvents& externalEvents) {
+      ClearIfLinksModified();
+      return GetEventsDependencies(externalEvents).linksTargets;
+    };
+
+    /**
+     * \brief Return what the events of the layout use.
+     */
+    const EventsDependencies& GetEventsDependencies(const gd::Layout& layout);
+
+    /**
+     * \brief Return what the events of the external events use.
+     */
+    const EventsDependencies& GetEventsDependencies(
+        const gd::ExternalEvents& externalEvents);
+
+    /**
+     * \brief Find what the events use (including their sub events, but not
+     * the events they link to).
+     */
+    static void FindEventsDependencies(const gd::EventsList& events,
+                                       EventsDependencies& dependencies);
+
+    /**
+     * \brief Forget the links of the layout with the given name.
+     */
+    void InvalidateLayout(const gd::String& name) {
+      layoutsDependencies.erase(name);
+    };
+
+    /**
+     * \brief Forget the links of the external events with the given name.
+     */
+    void InvalidateExternalEvents(const gd::String& name) {
+      externalEventsEventsDependencies.erase(name);
+    };
+
+    /**
+     * \brief Forget all the links.
+     */
+    void Clear() {
+      layoutsDependencies.clear();
+      externalEventsEventsDependencies.clear();
+    };
+
+    /**
+     * \brief Forget all the links if they were modified since they were
+     * found.
+     *
+     * Not done by GetEventsDependencies, so that the dependencies being
+     * analyzed stay valid even if a scene is unserialized during the
+     * analysis.
+     */
+    void ClearIfLinksModified();
+
+   private:
+    static void FindInstructionsDependencies(
+        const gd::InstructionsList& instructions,
+        EventsDependencies& dependencies);
+
+    std::map<gd::String, EventsDependencies> layoutsDependencies;
+    std::map<gd::String, EventsDependencies> externalEventsEventsDependencies;
+    std::size_t linksGeneration = gd::EventsList::GetLinksGeneration();
+  };
+
   /**
    * \brief Constructor for analyzing the dependencies of a layout
    */
@@ -43,6 +161,22 @@ class GD_CORE_API DependenciesAnalyzer {
   DependenciesAnalyzer(const gd::Project& project_,
                        const gd::ExternalEvents& externalEvents);
 
+  /**
+   * \brief Constructor for analyzing the dependencies of a layout, using (and
+   * filling) the links found in \a linksCache.
+   */
+  DependenciesAnalyzer(const gd::Project& project_,
+                       const gd::Layout& layout_,
+                       LinksCache& linksCache_);
+
+  /**
+   * \brief Constructor for analyzing the dependencies of external events,
+   * using (and filling) the links found in \a linksCache.
+   */
+  DependenciesAnalyzer(const gd::Project& project_,
+                       const gd::ExternalEvents& externalEvents,
+                       LinksCache& linksCache_);
+
   virtual ~DependenciesAnalyzer();
 
   /**
@@ -71,19 +205,38 @@ class GD_CORE_API DependenciesAnalyzer {
     return externalEventsDependencies;
   };
 
+  /**
+   * \brief Return the external layouts from which objects are created by the
+   * events of the scene or external events passed in the constructor, or by
+   * the events they depend on.
+   */
+  const std::set<gd::String>& GetExternalLayoutsDependencies() const {
+    return externalLayoutsDependencies;
+  };
+
+  /**
+   * \brief Return true if objects are created from external layouts with
+   * names only known when the game is running (in which case
+   * GetExternalLayoutsDependencies is incomplete).
+   */
+  bool HasUnknownExternalLayoutsDependencies() const {
+    return hasUnknownExternalLayoutsDependencies;
+  };
+
  private:
   /**
-   * \brief Analyze the dependencies of the events.
+   * \brief Analyze the dependencies of events having links to the given
+   * targets.
    *
-   * \param events The events to be analyzed
-   * \param isOnTopLevel If true, assumes that the events are on the top level
-   * (they have no parents). \return false if a circular dependency exists, true
-   * otherwise.
+   * \param linksTargets The targets of the links of the events to be analyzed
+   * \return false if a circular dependency exists, true otherwise.
    */
-  bool Analyze(const gd::EventsList& events);
+  bool Analyze(const LinksCache::EventsDependencies& eventsDependencies);
 
   std::set<gd::String> scenesDependencies;
   std::set<gd::String> externalEventsDependencies;
+  std::set<gd::String> externalLayoutsDependencies;
+  bool hasUnknownExternalLayoutsDependencies = false;
   std::vector<gd::String>
       parentScenes;  ///< Used to check for circular dependencies.
   std::vector<gd::String>
@@ -92,6 +245,8 @@ class GD_CORE_API DependenciesAnalyzer {
   const gd::Project& project;
   const gd::Layout* layout;
   const gd::ExternalEvents* externalEvents;
+  LinksCache ownLinksCache;  ///< Used if no cache is given to the analyzer.
+  LinksCache& linksCache;
 };
 
 #endif  // DEPENDENCIESANALYZER_H
@@ -12,6 +12,7 @@
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadata.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
@@ -170,6 +171,14 @@ bool ArbitraryEventsWorker::VisitEvent(gd::BaseEvent &event) {
 
 ArbitraryEventsWorkerWithContext::~ArbitraryEventsWorkerWithContext() {}
 
+std::unique_ptr<gd::ExpressionNode>
+ArbitraryEventsWorkerWithContext::ParseExpressionToModify(
+    const gd::String& expression) {
+  expressionNodeArena.Reset();
+  gd::ExpressionParser2 parser;
+  return parser.ParseExpression(expression, expressionNodeArena);
+}
+
 bool ArbitraryEventsWorkerWithContext::VisitEvent(gd::BaseEvent &event) {
   if (!event.HasVariables()) {
     return AbstractArbitraryEventsWorker::VisitEvent(event);
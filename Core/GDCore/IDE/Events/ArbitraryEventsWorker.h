@@ -10,6 +10,7 @@
 #include <vector>
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/Events/EventVisitor.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeArena.h"
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/String.h"
 
@@ -21,6 +22,7 @@ class EventsList;
 class ObjectsContainer;
 class Expression;
 class ParameterMetadata;
+struct ExpressionNode;
 }  // namespace gd
 
 namespace gd {
@@ -44,6 +46,8 @@ protected:
   void VisitEventList(gd::EventsList& events);
 
  private:
+  friend class ArbitraryEventsWorkersBatch;
+
   bool VisitLinkEvent(gd::LinkEvent& linkEvent) override;
   void VisitInstructionList(gd::InstructionsList& instructions,
                             bool areConditions);
@@ -161,10 +165,26 @@ protected:
     return currentProjectScopedContainers->GetObjectsContainersList();
   };
 
+  /**
+   * \brief Parse an expression into a new tree, to be modified and printed
+   * back in place of the expression.
+   *
+   * The trees are allocated in an arena reused for each expression parsed by
+   * the worker.
+   *
+   * \warning The tree previously returned must be destroyed before calling
+   * this again.
+   */
+  std::unique_ptr<gd::ExpressionNode> ParseExpressionToModify(
+      const gd::String& expression);
+
  private:
+  friend class ArbitraryEventsWorkersBatch;
+
   bool VisitEvent(gd::BaseEvent& event) override;
 
   const gd::ProjectScopedContainers* currentProjectScopedContainers;
+  gd::ExpressionNodeArena expressionNodeArena;
 };
 
 /**
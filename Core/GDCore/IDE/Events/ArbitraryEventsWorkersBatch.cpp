@@ -0,0 +1,78 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersBatch.h"
+
+namespace gd {
+
+ArbitraryEventsWorkersBatch::~ArbitraryEventsWorkersBatch() {}
+
+ArbitraryEventsWorkersBatch& ArbitraryEventsWorkersBatch::AddWorker(
+    gd::ArbitraryEventsWorker& worker) {
+  workers.push_back(&worker);
+  return *this;
+}
+
+ArbitraryEventsWorkersBatch& ArbitraryEventsWorkersBatch::AddWorker(
+    gd::ArbitraryEventsWorkerWithContext& worker) {
+  workers.push_back(&worker);
+  workersWithContext.push_back(&worker);
+  return *this;
+}
+
+void ArbitraryEventsWorkersBatch::UpdateWorkersContext() {
+  // The context changes when local variables are pushed or popped, which is
+  // only known by the batch as it is the one doing the traversal.
+  for (auto* worker : workersWithContext)
+    worker->currentProjectScopedContainers = currentProjectScopedContainers;
+}
+
+void ArbitraryEventsWorkersBatch::DoVisitEventList(gd::EventsList& events) {
+  UpdateWorkersContext();
+  for (auto* worker : workers) worker->DoVisitEventList(events);
+}
+
+bool ArbitraryEventsWorkersBatch::DoVisitEvent(gd::BaseEvent& event) {
+  UpdateWorkersContext();
+  for (auto* worker : workers) {
+    if (worker->DoVisitEvent(event)) return true;
+  }
+  return false;
+}
+
+bool ArbitraryEventsWorkersBatch::DoVisitLinkEvent(gd::LinkEvent& event) {
+  UpdateWorkersContext();
+  for (auto* worker : workers) {
+    if (worker->DoVisitLinkEvent(event)) return true;
+  }
+  return false;
+}
+
+void ArbitraryEventsWorkersBatch::DoVisitInstructionList(
+    gd::InstructionsList& instructions, bool areConditions) {
+  UpdateWorkersContext();
+  for (auto* worker : workers)
+    worker->DoVisitInstructionList(instructions, areConditions);
+}
+
+bool ArbitraryEventsWorkersBatch::DoVisitInstruction(
+    gd::Instruction& instruction, bool isCondition) {
+  UpdateWorkersContext();
+  for (auto* worker : workers) {
+    if (worker->DoVisitInstruction(instruction, isCondition)) return true;
+  }
+  return false;
+}
+
+bool ArbitraryEventsWorkersBatch::DoVisitEventExpression(
+    gd::Expression& expression, const gd::ParameterMetadata& metadata) {
+  UpdateWorkersContext();
+  for (auto* worker : workers) {
+    if (worker->DoVisitEventExpression(expression, metadata)) return true;
+  }
+  return false;
+}
+
+}  // namespace gd
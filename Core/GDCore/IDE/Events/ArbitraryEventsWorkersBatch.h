@@ -0,0 +1,87 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+
+namespace gd {
+class BaseEvent;
+class EventsList;
+class Expression;
+class Instruction;
+class InstructionsList;
+class LinkEvent;
+class ParameterMetadata;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Run several events workers in a single traversal of the events.
+ *
+ * Use this to apply several refactorings (renaming a function, then the
+ * instructions using it...) to the events of a project without browsing all
+ * the events of the project once per refactoring.
+ *
+ * Each event, instruction and expression is given to the workers in the order
+ * they were added, so a worker sees the changes done by the previous ones.
+ * When a worker asks for an event or an instruction to be removed, it is
+ * removed and the next workers don't visit it.
+ *
+ * \note The workers must only depend on the event, instruction or expression
+ * being visited (and not, for example, on another events list already being
+ * changed by another worker), which is the case of the refactoring workers.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ArbitraryEventsWorkersBatch
+    : public ArbitraryEventsWorkerWithContext {
+ public:
+  ArbitraryEventsWorkersBatch(){};
+  virtual ~ArbitraryEventsWorkersBatch();
+
+  /**
+   * \brief Add a worker to run. The worker must outlive the batch.
+   */
+  ArbitraryEventsWorkersBatch& AddWorker(gd::ArbitraryEventsWorker& worker);
+
+  /**
+   * \brief Add a worker to run. The worker must outlive the batch.
+   *
+   * The worker is given the same context (objects, variables...) as the batch.
+   */
+  ArbitraryEventsWorkersBatch& AddWorker(
+      gd::ArbitraryEventsWorkerWithContext& worker);
+
+  /**
+   * \brief Return the number of workers of the batch.
+   */
+  std::size_t GetWorkersCount() const { return workers.size(); }
+
+ private:
+  void DoVisitEventList(gd::EventsList& events) override;
+  bool DoVisitEvent(gd::BaseEvent& event) override;
+  bool DoVisitLinkEvent(gd::LinkEvent& event) override;
+  void DoVisitInstructionList(gd::InstructionsList& instructions,
+                              bool areConditions) override;
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override;
+  bool DoVisitEventExpression(gd::Expression& expression,
+                              const gd::ParameterMetadata& metadata) override;
+
+  /**
+   * \brief Give the current context of the batch to the workers needing it.
+   */
+  void UpdateWorkersContext();
+
+  std::vector<gd::AbstractArbitraryEventsWorker*> workers;
+  std::vector<gd::ArbitraryEventsWorkerWithContext*>
+      workersWithContext;  ///< The workers of `workers` needing a context.
+};
+
+}  // namespace gd
@@ -11,6 +11,7 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -123,8 +124,9 @@ bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
                                        gd::Expression(newBehaviorName));
             }
           }
-        } else {
-          auto node = parameterValue.GetRootNode();
+        } else if (parameterValue.ContainsText(oldBehaviorName)) {
+          // Parse a new tree, as the one of the expression can't be modified.
+          auto node = ParseExpressionToModify(parameterValue.GetPlainString());
           if (node) {
             ExpressionBehaviorRenamer renamer(objectName,
                                               oldBehaviorName,
@@ -0,0 +1,317 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsFunctionsCallGraph.h"
+
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace gd {
+
+/**
+ * \brief Find the types of the instructions and expressions used in events.
+ *
+ * The types of object and behavior expressions are found from the type of
+ * the object or behavior they are called on.
+ */
+class GD_CORE_API EventsFunctionCallsFinder
+    : public ReadOnlyArbitraryEventsWorkerWithContext,
+      ExpressionParser2NodeWorker {
+ public:
+  EventsFunctionCallsFinder(const gd::Platform &platform_,
+                            std::set<gd::String> &calledTypes_)
+      : platform(platform_), calledTypes(calledTypes_){};
+  virtual ~EventsFunctionCallsFinder(){};
+
+ private:
+  void DoVisitInstruction(const gd::Instruction &instruction,
+                          bool isCondition) override {
+    calledTypes.insert(instruction.GetType());
+
+    const gd::InstructionMetadata &instrInfos =
+        isCondition ? MetadataProvider::GetConditionMetadata(
+                          platform, instruction.GetType())
+                    : MetadataProvider::GetActionMetadata(
+                          platform, instruction.GetType());
+    for (std::size_t pNb = 0;
+         pNb < instrInfos.parameters.GetParametersCount() &&
+         pNb < instruction.GetParametersCount();
+         ++pNb) {
+      VisitExpression(instruction.GetParameter(pNb),
+                      instrInfos.parameters.GetParameter(pNb));
+    }
+  }
+
+  void DoVisitEventExpression(const gd::Expression &expression,
+                              const gd::ParameterMetadata &metadata) override {
+    VisitExpression(expression, metadata);
+  }
+
+  void VisitExpression(const gd::Expression &expression,
+                       const gd::ParameterMetadata &metadata) {
+    if (!ParameterMetadata::IsExpression("number", metadata.GetType()) &&
+        !ParameterMetadata::IsExpression("string", metadata.GetType()))
+      return;
+
+    auto node = expression.GetRootNode();
+    if (node) node->Visit(*this);
+  }
+
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode &node) override {}
+  void OnVisitTextNode(TextNode &node) override {}
+  void OnVisitVariableNode(VariableNode &node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    const auto &separator = PlatformExtension::GetNamespaceSeparator();
+    const auto &objectsContainersList =
+        GetProjectScopedContainers().GetObjectsContainersList();
+    if (node.objectName.empty()) {
+      calledTypes.insert(node.functionName);
+    } else if (node.behaviorName.empty()) {
+      const gd::String &objectType =
+          objectsContainersList.GetTypeOfObject(node.objectName);
+      if (!objectType.empty())
+        calledTypes.insert(objectType + separator + node.functionName);
+    } else {
+      const gd::String &behaviorType =
+          objectsContainersList.GetTypeOfBehaviorInObjectOrGroup(
+              node.objectName, node.behaviorName);
+      if (!behaviorType.empty())
+        calledTypes.insert(behaviorType + separator + node.functionName);
+    }
+
+    for (auto &parameter : node.parameters) {
+      parameter->Visit(*this);
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override {}
+
+  const gd::Platform &platform;
+  std::set<gd::String> &calledTypes;
+};
+
+const std::set<gd::String> EventsFunctionsCallGraph::noFunctions;
+
+void EventsFunctionsCallGraph::Build(const gd::Project &project) {
+  calls.clear();
+  callers.clear();
+  functionsByExtension.clear();
+  ClearQueriesCache();
+
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    UpdateExtension(project, project.GetEventsFunctionsExtension(i));
+  }
+}
+
+void EventsFunctionsCallGraph::UpdateExtension(
+    const gd::Project &project,
+    const gd::EventsFunctionsExtension &eventsFunctionsExtension) {
+  const gd::String &extensionName = eventsFunctionsExtension.GetName();
+  RemoveExtension(extensionName);
+
+  for (auto &&eventsFunction :
+       eventsFunctionsExtension.GetEventsFunctions().GetInternalVector()) {
+    gd::ObjectsContainer parameterObjectsContainer(
+        gd::ObjectsContainer::SourceType::Function);
+    gd::VariablesContainer parameterVariablesContainer(
+        gd::VariablesContainer::SourceType::Parameters);
+    auto projectScopedContainers = gd::ProjectScopedContainers::
+        MakeNewProjectScopedContainersForFreeEventsFunction(
+            project, eventsFunctionsExtension, *eventsFunction,
+            parameterObjectsContainer, parameterVariablesContainer);
+
+    AddFunction(project,
+                extensionName,
+                PlatformExtension::GetEventsFunctionFullType(
+                    extensionName, eventsFunction->GetName()),
+                *eventsFunction,
+                projectScopedContainers);
+  }
+
+  for (auto &&eventsBasedBehavior :
+       eventsFunctionsExtension.GetEventsBasedBehaviors().GetInternalVector()) {
+    for (auto &&eventsFunction :
+         eventsBasedBehavior->GetEventsFunctions().GetInternalVector()) {
+      gd::ObjectsContainer parameterObjectsContainer(
+          gd::ObjectsContainer::SourceType::Function);
+      gd::VariablesContainer parameterVariablesContainer(
+          gd::VariablesContainer::SourceType::Parameters);
+      gd::VariablesContainer propertyVariablesContainer(
+          gd::VariablesContainer::SourceType::Properties);
+      auto projectScopedContainers = gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForBehaviorEventsFunction(
+              project, eventsFunctionsExtension, *eventsBasedBehavior,
+              *eventsFunction, parameterObjectsContainer,
+              parameterVariablesContainer, propertyVariablesContainer);
+
+      AddFunction(project,
+                  extensionName,
+                  PlatformExtension::GetBehaviorEventsFunctionFullType(
+                      extensionName,
+                      eventsBasedBehavior->GetName(),
+                      eventsFunction->GetName()),
+                  *eventsFunction,
+                  projectScopedContainers);
+    }
+  }
+
+  for (auto &&eventsBasedObject :
+       eventsFunctionsExtension.GetEventsBasedObjects().GetInternalVector()) {
+    for (auto &&eventsFunction :
+         eventsBasedObject->GetEventsFunctions().GetInternalVector()) {
+      gd::ObjectsContainer parameterObjectsContainer(
+          gd::ObjectsContainer::SourceType::Function);
+      gd::VariablesContainer parameterVariablesContainer(
+          gd::VariablesContainer::SourceType::Parameters);
+      gd::VariablesContainer propertyVariablesContainer(
+          gd::VariablesContainer::SourceType::Properties);
+      auto projectScopedContainers = gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForObjectEventsFunction(
+              project, eventsFunctionsExtension, *eventsBasedObject,
+              *eventsFunction, parameterObjectsContainer,
+              parameterVariablesContainer, propertyVariablesContainer);
+
+      AddFunction(project,
+                  extensionName,
+                  PlatformExtension::GetObjectEventsFunctionFullType(
+                      extensionName,
+                      eventsBasedObject->GetName(),
+                      eventsFunction->GetName()),
+                  *eventsFunction,
+                  projectScopedContainers);
+    }
+  }
+}
+
+void EventsFunctionsCallGraph::RemoveExtension(
+    const gd::String &extensionName) {
+  auto extensionFunctions = functionsByExtension.find(extensionName);
+  if (extensionFunctions == functionsByExtension.end()) return;
+
+  for (const gd::String &functionFullType : extensionFunctions->second) {
+    auto functionCalls = calls.find(functionFullType);
+    if (functionCalls == calls.end()) continue;
+
+    for (const gd::String &calledType : functionCalls->second) {
+      auto calledTypeCallers = callers.find(calledType);
+      if (calledTypeCallers == callers.end()) continue;
+
+      calledTypeCallers->second.erase(functionFullType);
+      if (calledTypeCallers->second.empty()) callers.erase(calledTypeCallers);
+    }
+    calls.erase(functionCalls);
+  }
+  functionsByExtension.erase(extensionFunctions);
+  ClearQueriesCache();
+}
+
+void EventsFunctionsCallGraph::AddFunction(
+    const gd::Project &project,
+    const gd::String &extensionName,
+    const gd::String &functionFullType,
+    const gd::EventsFunction &eventsFunction,
+    const gd::ProjectScopedContainers &projectScopedContainers) {
+  std::set<gd::String> &functionCalls = calls[functionFullType];
+  EventsFunctionCallsFinder worker(project.GetCurrentPlatform(),
+                                   functionCalls);
+  worker.Launch(eventsFunction.GetEvents(), projectScopedContainers);
+
+  for (const gd::String &calledType : functionCalls) {
+    callers[calledType].insert(functionFullType);
+  }
+  functionsByExtension[extensionName].push_back(functionFullType);
+  ClearQueriesCache();
+}
+
+std::set<gd::String> EventsFunctionsCallGraph::GetCalledFunctions(
+    const gd::String &functionFullType) const {
+  std::set<gd::String> calledFunctions;
+  auto functionCalls = calls.find(functionFullType);
+  if (functionCalls == calls.end()) return calledFunctions;
+
+  for (const gd::String &calledType : functionCalls->second) {
+    if (HasFunction(calledType)) calledFunctions.insert(calledType);
+  }
+  return calledFunctions;
+}
+
+std::set<gd::String> EventsFunctionsCallGraph::GetCallingFunctions(
+    const gd::String &functionFullType) const {
+  auto functionCallers = callers.find(functionFullType);
+  return functionCallers != callers.end() ? functionCallers->second
+                                          : noFunctions;
+}
+
+bool EventsFunctionsCallGraph::IsRecursive(
+    const gd::String &functionFullType) const {
+  const auto &affectedFunctions = GetAffectedFunctions(functionFullType);
+  return affectedFunctions.find(functionFullType) != affectedFunctions.end();
+}
+
+const std::set<gd::String> &EventsFunctionsCallGraph::GetAffectedFunctions(
+    const gd::String &functionFullType) const {
+  auto cachedAffectedFunctions = affectedFunctionsCache.find(functionFullType);
+  if (cachedAffectedFunctions != affectedFunctionsCache.end())
+    return cachedAffectedFunctions->second;
+
+  std::set<gd::String> &affectedFunctions =
+      affectedFunctionsCache[functionFullType];
+  std::vector<const gd::String *> functionsToVisit = {&functionFullType};
+  while (!functionsToVisit.empty()) {
+    const gd::String &function = *functionsToVisit.back();
+    functionsToVisit.pop_back();
+
+    auto functionCallers = callers.find(function);
+    if (functionCallers == callers.end()) continue;
+    for (const gd::String &caller : functionCallers->second) {
+      if (affectedFunctions.insert(caller).second)
+        functionsToVisit.push_back(&caller);
+    }
+  }
+  return affectedFunctions;
+}
+
+void EventsFunctionsCallGraph::ClearQueriesCache() const {
+  affectedFunctionsCache.clear();
+}
+
+}  // namespace gd
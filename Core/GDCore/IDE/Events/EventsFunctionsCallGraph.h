@@ -0,0 +1,115 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class Project;
+class EventsFunctionsExtension;
+class EventsFunction;
+class ProjectScopedContainers;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief The graph of the calls between the events functions (free, behavior
+ * and object functions) of the extensions of a project.
+ *
+ * Functions are identified by their full type (see
+ * gd::PlatformExtension::GetEventsFunctionFullType,
+ * gd::PlatformExtension::GetBehaviorEventsFunctionFullType and
+ * gd::PlatformExtension::GetObjectEventsFunctionFullType). Calls are found in
+ * the instructions and in the expressions of the functions events.
+ *
+ * The graph is built once with Build, then updated only for the extensions
+ * which are modified, with UpdateExtension. Results of queries are kept until
+ * the graph is modified.
+ */
+class GD_CORE_API EventsFunctionsCallGraph {
+ public:
+  EventsFunctionsCallGraph(){};
+  virtual ~EventsFunctionsCallGraph(){};
+
+  /**
+   * \brief Build the graph from all the events functions extensions of the
+   * project.
+   */
+  void Build(const gd::Project &project);
+
+  /**
+   * \brief Browse again the functions of an extension (to be called after the
+   * extension was modified or added to the project).
+   */
+  void UpdateExtension(
+      const gd::Project &project,
+      const gd::EventsFunctionsExtension &eventsFunctionsExtension);
+
+  /**
+   * \brief Remove the functions of an extension (to be called after the
+   * extension was removed from the project).
+   */
+  void RemoveExtension(const gd::String &extensionName);
+
+  /**
+   * \brief Return true if the function is in the graph.
+   */
+  bool HasFunction(const gd::String &functionFullType) const {
+    return calls.find(functionFullType) != calls.end();
+  }
+
+  /**
+   * \brief Return the events functions directly called by a function.
+   */
+  std::set<gd::String> GetCalledFunctions(
+      const gd::String &functionFullType) const;
+
+  /**
+   * \brief Return the events functions directly calling a function.
+   */
+  std::set<gd::String> GetCallingFunctions(
+      const gd::String &functionFullType) const;
+
+  /**
+   * \brief Return true if the function calls itself, directly or through
+   * other functions.
+   */
+  bool IsRecursive(const gd::String &functionFullType) const;
+
+  /**
+   * \brief Return the events functions calling a function, directly or
+   * through other functions: these are the functions affected if the
+   * function is changed.
+   */
+  const std::set<gd::String> &GetAffectedFunctions(
+      const gd::String &functionFullType) const;
+
+ private:
+  void AddFunction(const gd::Project &project,
+                   const gd::String &extensionName,
+                   const gd::String &functionFullType,
+                   const gd::EventsFunction &eventsFunction,
+                   const gd::ProjectScopedContainers &projectScopedContainers);
+  void ClearQueriesCache() const;
+
+  std::map<gd::String, std::set<gd::String>>
+      calls;  ///< The types of the instructions and expressions used by each
+              ///< function (including the ones not being events functions).
+  std::map<gd::String, std::set<gd::String>>
+      callers;  ///< The functions using each instruction or expression type.
+  std::map<gd::String, std::vector<gd::String>>
+      functionsByExtension;  ///< The functions of each extension.
+
+  mutable std::map<gd::String, std::set<gd::String>> affectedFunctionsCache;
+  static const std::set<gd::String> noFunctions;
+};
+
+}  // namespace gd
@@ -0,0 +1,97 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsListRows.h"
+
+#include <algorithm>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+
+namespace gd {
+
+void EventsListRows::Build(gd::EventsList& events) {
+  rows.clear();
+  AddRows(events, 0, false);
+  areOffsetsDirty = true;
+}
+
+void EventsListRows::AddRows(gd::EventsList& events,
+                             std::size_t depth,
+                             bool isDisabled) {
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    gd::BaseEvent& event = events[i];
+    bool isEventDisabled = isDisabled || event.IsDisabled();
+    rows.push_back(Row{&event, depth, isEventDisabled});
+
+    if (event.CanHaveSubEvents() && !event.IsFolded())
+      AddRows(event.GetSubEvents(), depth + 1, isEventDisabled);
+  }
+}
+
+std::size_t EventsListRows::GetRowIndexOf(const gd::BaseEvent& event) const {
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    if (rows[i].event == &event) return i;
+  }
+
+  return gd::String::npos;
+}
+
+void EventsListRows::SetEventHeight(const gd::BaseEvent& event,
+                                    double height) {
+  eventsHeights[&event] = height;
+  areOffsetsDirty = true;
+}
+
+void EventsListRows::SetDefaultEventHeight(double height) {
+  defaultEventHeight = height;
+  areOffsetsDirty = true;
+}
+
+void EventsListRows::ClearEventsHeights() {
+  eventsHeights.clear();
+  areOffsetsDirty = true;
+}
+
+double EventsListRows::GetRowHeight(std::size_t rowIndex) const {
+  auto it = eventsHeights.find(rows[rowIndex].event);
+  return it != eventsHeights.end() ? it->second : defaultEventHeight;
+}
+
+void EventsListRows::UpdateOffsets() const {
+  if (!areOffsetsDirty && offsets.size() == rows.size() + 1) return;
+
+  offsets.resize(rows.size() + 1);
+  double offset = 0;
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    offsets[i] = offset;
+    offset += GetRowHeight(i);
+  }
+  offsets[rows.size()] = offset;
+  areOffsetsDirty = false;
+}
+
+double EventsListRows::GetRowOffset(std::size_t rowIndex) const {
+  UpdateOffsets();
+  return offsets[std::min(rowIndex, rows.size())];
+}
+
+double EventsListRows::GetTotalHeight() const {
+  UpdateOffsets();
+  return offsets.back();
+}
+
+std::size_t EventsListRows::GetRowIndexAtOffset(double offset) const {
+  if (rows.empty()) return 0;
+
+  UpdateOffsets();
+  // Find the first row starting after the offset: the row before it
+  // contains the offset.
+  auto it = std::upper_bound(offsets.begin(), offsets.end() - 1, offset);
+  if (it == offsets.begin()) return 0;
+  return static_cast<std::size_t>(it - offsets.begin()) - 1;
+}
+
+}  // namespace gd
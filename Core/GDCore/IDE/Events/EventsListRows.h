@@ -0,0 +1,136 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class BaseEvent;
+class EventsList;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief The rows of an events sheet: the events of a list and of their
+ * sub-events, flattened, without the sub-events of folded events.
+ *
+ * It also stores the height of each event, and the offset of each row, so
+ * that an events sheet only needs to render the rows that are visible
+ * (see GetRowIndexAtOffset) instead of reading the whole events tree:
+ * \code
+ * gd::EventsListRows rows;
+ * rows.Build(events);
+ * std::size_t firstRow = rows.GetRowIndexAtOffset(scrollTop);
+ * std::size_t lastRow = rows.GetRowIndexAtOffset(scrollTop + height);
+ * \endcode
+ *
+ * \note Build must be called again after events are added, removed, moved,
+ * folded or unfolded. Heights are kept between calls to Build.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsListRows {
+ public:
+  EventsListRows() : defaultEventHeight(0), areOffsetsDirty(false){};
+  virtual ~EventsListRows(){};
+
+  /**
+   * \brief Compute the rows of the events list.
+   */
+  void Build(gd::EventsList& events);
+
+  std::size_t GetRowsCount() const { return rows.size(); }
+
+  /**
+   * \brief Return the event displayed at the row.
+   */
+  gd::BaseEvent& GetEventAt(std::size_t rowIndex) {
+    return *rows[rowIndex].event;
+  }
+
+  /**
+   * \brief Return the depth of the event displayed at the row (0 for the
+   * events of the list given to Build).
+   */
+  std::size_t GetDepthAt(std::size_t rowIndex) const {
+    return rows[rowIndex].depth;
+  }
+
+  /**
+   * \brief Return true if the event of the row, or one of its parents, is
+   * disabled.
+   */
+  bool IsDisabledAt(std::size_t rowIndex) const {
+    return rows[rowIndex].isDisabled;
+  }
+
+  /**
+   * \brief Return the index of the row of the event, or gd::String::npos if
+   * the event is not displayed (because it's in a folded event or not in the
+   * list).
+   */
+  std::size_t GetRowIndexOf(const gd::BaseEvent& event) const;
+
+  /**
+   * \brief Set the height of an event, once it's known (typically after it
+   * was rendered).
+   */
+  void SetEventHeight(const gd::BaseEvent& event, double height);
+
+  /**
+   * \brief Set the height of the events whose height was not set.
+   */
+  void SetDefaultEventHeight(double height);
+
+  /**
+   * \brief Forget the heights of all the events.
+   */
+  void ClearEventsHeights();
+
+  double GetRowHeight(std::size_t rowIndex) const;
+
+  /**
+   * \brief Return the offset of the top of the row.
+   */
+  double GetRowOffset(std::size_t rowIndex) const;
+
+  /**
+   * \brief Return the sum of the heights of all the rows.
+   */
+  double GetTotalHeight() const;
+
+  /**
+   * \brief Return the index of the row displayed at the offset (the last row
+   * if the offset is after all the rows).
+   *
+   * \note The complexity is logarithmic in the number of rows.
+   */
+  std::size_t GetRowIndexAtOffset(double offset) const;
+
+ private:
+  struct Row {
+    gd::BaseEvent* event;
+    std::size_t depth;
+    bool isDisabled;
+  };
+
+  void AddRows(gd::EventsList& events, std::size_t depth, bool isDisabled);
+  void UpdateOffsets() const;
+
+  std::vector<Row> rows;
+  std::unordered_map<const gd::BaseEvent*, double> eventsHeights;
+  double defaultEventHeight;
+  mutable std::vector<double> offsets;  ///< The offset of each row, and the
+                                        ///< total height at the end.
+  mutable bool areOffsetsDirty;
+};
+
+}  // namespace gd
@@ -13,6 +13,7 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -193,7 +194,8 @@ bool EventsParameterReplacer::DoVisitInstruction(gd::Instruction& instruction,
           parameterMetadata.GetValueTypeMetadata())) {
           return;
         }
-        auto node = parameterValue.GetRootNode();
+        // Parse a new tree, as the one of the expression can't be modified.
+        auto node = ParseExpressionToModify(parameterValue.GetPlainString());
         if (node) {
           ExpressionParameterReplacer renamer(
               platform, GetProjectScopedContainers(),
@@ -217,7 +219,8 @@ bool EventsParameterReplacer::DoVisitEventExpression(
           metadata.GetValueTypeMetadata())) {
     return false;
   }
-  auto node = expression.GetRootNode();
+  // Parse a new tree, as the one of the expression can't be modified.
+  auto node = ParseExpressionToModify(expression.GetPlainString());
   if (node) {
     ExpressionParameterReplacer renamer(
         platform, GetProjectScopedContainers(),
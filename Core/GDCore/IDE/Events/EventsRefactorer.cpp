@@ -11,6 +11,7 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
@@ -23,6 +24,7 @@
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/IDE/Events/ExpressionTypeFinder.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/TextSearchPattern.h"
 
 using namespace std;
 
@@ -336,10 +338,12 @@ private:
             const gd::Expression &parameterValue, size_t parameterIndex,
             const gd::String &lastObjectName) {
           if (!gd::EventsObjectReplacer::CanContainObject(
-                  parameterMetadata.GetValueTypeMetadata())) {
+                  parameterMetadata.GetValueTypeMetadata()) ||
+              !parameterValue.ContainsText(oldObjectName)) {
             return;
           }
-          auto node = parameterValue.GetRootNode();
+          // Parse a new tree, as the one of the expression can't be modified.
+          auto node = ParseExpressionToModify(parameterValue.GetPlainString());
           if (node) {
             ExpressionObjectRenamer renamer(
                 platform, GetProjectScopedContainers(),
@@ -367,10 +371,12 @@ private:
       return false;
     }
     if (!gd::EventsObjectReplacer::CanContainObject(
-            metadata.GetValueTypeMetadata())) {
+            metadata.GetValueTypeMetadata()) ||
+        !expression.ContainsText(oldObjectName)) {
       return false;
     }
-    auto node = expression.GetRootNode();
+    // Parse a new tree, as the one of the expression can't be modified.
+    auto node = ParseExpressionToModify(expression.GetPlainString());
     if (node) {
       ExpressionObjectRenamer renamer(platform, GetProjectScopedContainers(),
                                       metadata.GetValueTypeMetadata().GetName(),
@@ -419,7 +425,7 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
         MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
       // Find object's name in parameters
-      if (gd::ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType()) &&
+      if (instrInfos.parameters.GetParameter(pNb).GetValueTypeMetadata().IsObject() &&
           actions[aId].GetParameter(pNb).GetPlainString() == name) {
         deleteMe = true;
         break;
@@ -477,7 +483,7 @@ bool EventsRefactorer::RemoveObjectInConditions(
                                                conditions[cId].GetType());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount(); ++pNb) {
       // Find object's name in parameters
-      if (gd::ParameterMetadata::IsObject(instrInfos.parameters.GetParameter(pNb).GetType()) &&
+      if (instrInfos.parameters.GetParameter(pNb).GetValueTypeMetadata().IsObject() &&
           conditions[cId].GetParameter(pNb).GetPlainString() == name) {
         deleteMe = true;
         break;
@@ -546,8 +552,30 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
     bool inConditions,
     bool inActions,
     bool inEventStrings) {
+  if (toReplace.empty()) return vector<EventsSearchResult>();
+
+  return ReplaceStringInEvents(project,
+                               layout,
+                               events,
+                               gd::TextSearchPattern(toReplace, matchCase),
+                               newString,
+                               inConditions,
+                               inActions,
+                               inEventStrings);
+}
+
+std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
+    gd::ObjectsContainer& project,
+    gd::ObjectsContainer& layout,
+    gd::EventsList& events,
+    const gd::TextSearchPattern& toReplacePattern,
+    const gd::String& newString,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings) {
   vector<EventsSearchResult> modifiedEvents;
-  if (toReplace.empty()) return modifiedEvents;
+  const gd::String& toReplace = toReplacePattern.GetSearch();
+  const bool matchCase = toReplacePattern.IsMatchingCase();
 
   for (std::size_t i = 0; i < events.size(); ++i) {
     bool eventModified = false;
@@ -555,6 +583,7 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
     auto allExpressionsWithMetadata = events[i].GetAllExpressionsWithMetadata();
     for (auto& expressionAndMetadata : allExpressionsWithMetadata) {
       gd::Expression* expression = expressionAndMetadata.first;
+      if (!toReplacePattern.IsFoundIn(expression->GetPlainString())) continue;
 
       gd::String newExpressionPlainString =
           matchCase ? expression->GetPlainString().FindAndReplace(
@@ -585,9 +614,8 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
             ReplaceStringInConditions(project,
                                       layout,
                                       *conditionsVectors[j],
-                                      toReplace,
-                                      newString,
-                                      matchCase);
+                                      toReplacePattern,
+                                      newString);
         if (conditionsModified && !eventModified) {
           modifiedEvents.push_back(EventsSearchResult(
               std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
@@ -605,9 +633,8 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
         bool actionsModified = ReplaceStringInActions(project,
                                                       layout,
                                                       *actionsVectors[j],
-                                                      toReplace,
-                                                      newString,
-                                                      matchCase);
+                                                      toReplacePattern,
+                                                      newString);
         if (actionsModified && !eventModified) {
           modifiedEvents.push_back(EventsSearchResult(
               std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
@@ -620,7 +647,7 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
 
     if (inEventStrings) {
       bool eventStringModified = ReplaceStringInEventSearchableStrings(
-          project, layout, events[i], toReplace, newString, matchCase);
+          project, layout, events[i], toReplacePattern, newString);
       if (eventStringModified && !eventModified) {
         modifiedEvents.push_back(EventsSearchResult(
             std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
@@ -635,9 +662,8 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
           ReplaceStringInEvents(project,
                                 layout,
                                 events[i].GetSubEvents(),
-                                toReplace,
+                                toReplacePattern,
                                 newString,
-                                matchCase,
                                 inConditions,
                                 inActions,
                                 inEventStrings);
@@ -652,14 +678,19 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
 bool EventsRefactorer::ReplaceStringInActions(gd::ObjectsContainer& project,
                                               gd::ObjectsContainer& layout,
                                               gd::InstructionsList& actions,
-                                              gd::String toReplace,
-                                              gd::String newString,
-                                              bool matchCase) {
+                                              const gd::TextSearchPattern& toReplacePattern,
+                                              const gd::String& newString) {
   bool somethingModified = false;
+  const gd::String& toReplace = toReplacePattern.GetSearch();
+  const bool matchCase = toReplacePattern.IsMatchingCase();
 
   for (std::size_t aId = 0; aId < actions.size(); ++aId) {
     for (std::size_t pNb = 0; pNb < actions[aId].GetParameters().size();
          ++pNb) {
+      if (!toReplacePattern.IsFoundIn(
+              actions[aId].GetParameter(pNb).GetPlainString()))
+        continue;
+
       gd::String newParameter =
           matchCase
               ? actions[aId].GetParameter(pNb).GetPlainString().FindAndReplace(
@@ -679,9 +710,8 @@ bool EventsRefactorer::ReplaceStringInActions(gd::ObjectsContainer& project,
       ReplaceStringInActions(project,
                              layout,
                              actions[aId].GetSubInstructions(),
-                             toReplace,
-                             newString,
-                             matchCase);
+                             toReplacePattern,
+                             newString);
   }
 
   return somethingModified;
@@ -691,14 +721,19 @@ bool EventsRefactorer::ReplaceStringInConditions(
     gd::ObjectsContainer& project,
     gd::ObjectsContainer& layout,
     gd::InstructionsList& conditions,
-    gd::String toReplace,
-    gd::String newString,
-    bool matchCase) {
+    const gd::TextSearchPattern& toReplacePattern,
+    const gd::String& newString) {
   bool somethingModified = false;
+  const gd::String& toReplace = toReplacePattern.GetSearch();
+  const bool matchCase = toReplacePattern.IsMatchingCase();
 
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
     for (std::size_t pNb = 0; pNb < conditions[cId].GetParameters().size();
          ++pNb) {
+      if (!toReplacePattern.IsFoundIn(
+              conditions[cId].GetParameter(pNb).GetPlainString()))
+        continue;
+
       gd::String newParameter =
           matchCase ? conditions[cId]
                           .GetParameter(pNb)
@@ -719,9 +754,8 @@ bool EventsRefactorer::ReplaceStringInConditions(
       ReplaceStringInConditions(project,
                                 layout,
                                 conditions[cId].GetSubInstructions(),
-                                toReplace,
-                                newString,
-                                matchCase);
+                                toReplacePattern,
+                                newString);
   }
 
   return somethingModified;
@@ -731,13 +765,19 @@ bool EventsRefactorer::ReplaceStringInEventSearchableStrings(
     gd::ObjectsContainer& project,
     gd::ObjectsContainer& layout,
     gd::BaseEvent& event,
-    gd::String toReplace,
-    gd::String newString,
-    bool matchCase) {
+    const gd::TextSearchPattern& toReplacePattern,
+    const gd::String& newString) {
   vector<gd::String> newEventStrings;
   vector<gd::String> stringEvent = event.GetAllSearchableStrings();
+  const gd::String& toReplace = toReplacePattern.GetSearch();
+  const bool matchCase = toReplacePattern.IsMatchingCase();
 
   for (std::size_t sNb = 0; sNb < stringEvent.size(); ++sNb) {
+    if (!toReplacePattern.IsFoundIn(stringEvent[sNb])) {
+      newEventStrings.push_back(stringEvent[sNb]);
+      continue;
+    }
+
     gd::String newStringEvent =
         matchCase ? stringEvent[sNb].FindAndReplace(toReplace, newString, true)
                   : ReplaceAllOccurrencesCaseInsensitive(
@@ -759,8 +799,6 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     bool inActions,
     bool inEventStrings,
     bool inEventSentences) {
-  vector<EventsSearchResult> results;
-
   const gd::String& ignored_characters =
       EventsRefactorer::searchIgnoredCharacters;
 
@@ -777,6 +815,25 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     search.RemoveConsecutiveOccurrences(search.begin(), search.end(), ' ');
   }
 
+  return SearchInEvents(platform,
+                        events,
+                        gd::TextSearchPattern(search, matchCase),
+                        inConditions,
+                        inActions,
+                        inEventStrings,
+                        inEventSentences);
+}
+
+vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
+    const gd::Platform& platform,
+    gd::EventsList& events,
+    const gd::TextSearchPattern& searchPattern,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings,
+    bool inEventSentences) {
+  vector<EventsSearchResult> results;
+
   for (std::size_t i = 0; i < events.size(); ++i) {
     bool eventAddedInResults = false;
 
@@ -784,12 +841,8 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     for (auto& expressionAndMetadata : allExpressionsWithMetadata) {
       gd::Expression* expression = expressionAndMetadata.first;
 
-      size_t foundPosition =
-          matchCase
-              ? expression->GetPlainString().find(search)
-              : expression->GetPlainString().FindCaseInsensitive(search);
-
-      if (foundPosition != gd::String::npos && !eventAddedInResults) {
+      if (!eventAddedInResults &&
+          searchPattern.IsFoundIn(expression->GetPlainString())) {
         results.push_back(EventsSearchResult(
             std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
             &events,
@@ -805,8 +858,7 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
         if (!eventAddedInResults &&
             SearchStringInConditions(platform,
                                      *conditionsVectors[j],
-                                     search,
-                                     matchCase,
+                                     searchPattern,
                                      inEventSentences)) {
           results.push_back(EventsSearchResult(
               std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
@@ -823,8 +875,7 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
       for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
         if (!eventAddedInResults && SearchStringInActions(platform,
                                                           *actionsVectors[j],
-                                                          search,
-                                                          matchCase,
+                                                          searchPattern,
                                                           inEventSentences)) {
           results.push_back(EventsSearchResult(
               std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
@@ -837,7 +888,7 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
 
     if (inEventStrings) {
       if (!eventAddedInResults &&
-          SearchStringInEvent(events[i], search, matchCase)) {
+          SearchStringInEvent(events[i], searchPattern)) {
         results.push_back(EventsSearchResult(
             std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
             &events,
@@ -849,8 +900,7 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
       vector<EventsSearchResult> subResults =
           SearchInEvents(platform,
                          events[i].GetSubEvents(),
-                         search,
-                         matchCase,
+                         searchPattern,
                          inConditions,
                          inActions,
                          inEventStrings,
@@ -865,32 +915,24 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
 
 bool EventsRefactorer::SearchStringInActions(const gd::Platform& platform,
                                              gd::InstructionsList& actions,
-                                             gd::String search,
-                                             bool matchCase,
+                                             const gd::TextSearchPattern& searchPattern,
                                              bool inSentences) {
   for (std::size_t aId = 0; aId < actions.size(); ++aId) {
     for (std::size_t pNb = 0; pNb < actions[aId].GetParameters().size();
          ++pNb) {
-      size_t foundPosition =
-          matchCase
-              ? actions[aId].GetParameter(pNb).GetPlainString().find(search)
-              : actions[aId]
-                    .GetParameter(pNb)
-                    .GetPlainString()
-                    .FindCaseInsensitive(search);
-
-      if (foundPosition != gd::String::npos) return true;
+      if (searchPattern.IsFoundIn(
+              actions[aId].GetParameter(pNb).GetPlainString()))
+        return true;
     }
 
     if (inSentences && SearchStringInFormattedText(
-                           platform, actions[aId], search, matchCase, false))
+                           platform, actions[aId], searchPattern, false))
       return true;
 
     if (!actions[aId].GetSubInstructions().empty() &&
         SearchStringInActions(platform,
                               actions[aId].GetSubInstructions(),
-                              search,
-                              matchCase,
+                              searchPattern,
                               inSentences))
       return true;
   }
@@ -900,8 +942,7 @@ bool EventsRefactorer::SearchStringInActions(const gd::Platform& platform,
 
 bool EventsRefactorer::SearchStringInFormattedText(const gd::Platform& platform,
                                                    gd::Instruction& instruction,
-                                                   gd::String search,
-                                                   bool matchCase,
+                                                   const gd::TextSearchPattern& searchPattern,
                                                    bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
@@ -926,42 +967,30 @@ bool EventsRefactorer::SearchStringInFormattedText(const gd::Platform& platform,
   completeSentence.RemoveConsecutiveOccurrences(
       completeSentence.begin(), completeSentence.end(), ' ');
 
-  size_t foundPosition = matchCase
-                             ? completeSentence.find(search)
-                             : completeSentence.FindCaseInsensitive(search);
-
-  return foundPosition != gd::String::npos;
+  return searchPattern.IsFoundIn(completeSentence);
 }
 
 bool EventsRefactorer::SearchStringInConditions(
     const gd::Platform& platform,
     gd::InstructionsList& conditions,
-    gd::String search,
-    bool matchCase,
+    const gd::TextSearchPattern& searchPattern,
     bool inSentences) {
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
     for (std::size_t pNb = 0; pNb < conditions[cId].GetParameters().size();
          ++pNb) {
-      size_t foundPosition =
-          matchCase
-              ? conditions[cId].GetParameter(pNb).GetPlainString().find(search)
-              : conditions[cId]
-                    .GetParameter(pNb)
-                    .GetPlainString()
-                    .FindCaseInsensitive(search);
-
-      if (foundPosition != gd::String::npos) return true;
+      if (searchPattern.IsFoundIn(
+              conditions[cId].GetParameter(pNb).GetPlainString()))
+        return true;
     }
 
     if (inSentences && SearchStringInFormattedText(
-                           platform, conditions[cId], search, matchCase, true))
+                           platform, conditions[cId], searchPattern, true))
       return true;
 
     if (!conditions[cId].GetSubInstructions().empty() &&
         SearchStringInConditions(platform,
                                  conditions[cId].GetSubInstructions(),
-                                 search,
-                                 matchCase,
+                                 searchPattern,
                                  inSentences))
       return true;
   }
@@ -969,15 +998,10 @@ bool EventsRefactorer::SearchStringInConditions(
   return false;
 }
 
-bool EventsRefactorer::SearchStringInEvent(gd::BaseEvent& event,
-                                           gd::String search,
-                                           bool matchCase) {
-  for (gd::String str : event.GetAllSearchableStrings()) {
-    if (matchCase) {
-      if (str.find(search) != gd::String::npos) return true;
-    } else {
-      if (str.FindCaseInsensitive(search) != gd::String::npos) return true;
-    }
+bool EventsRefactorer::SearchStringInEvent(
+    gd::BaseEvent& event, const gd::TextSearchPattern& searchPattern) {
+  for (const gd::String& str : event.GetAllSearchableStrings()) {
+    if (searchPattern.IsFoundIn(str)) return true;
   }
 
   return false;
@@ -20,6 +20,7 @@ class Platform;
 class ExternalEvents;
 class BaseEvent;
 class Instruction;
+class TextSearchPattern;
 typedef std::shared_ptr<gd::BaseEvent> BaseEventSPtr;
 }  // namespace gd
 
@@ -122,6 +123,31 @@ class GD_CORE_API EventsRefactorer {
   virtual ~EventsRefactorer(){};
 
  private:
+  /**
+   * Search for a prepared text in events.
+   */
+  static std::vector<EventsSearchResult> SearchInEvents(
+      const gd::Platform& platform,
+      gd::EventsList& events,
+      const gd::TextSearchPattern& searchPattern,
+      bool inConditions,
+      bool inActions,
+      bool inEventStrings,
+      bool inEventSentences);
+
+  /**
+   * Replace all occurrences of a prepared text in events.
+   */
+  static std::vector<EventsSearchResult> ReplaceStringInEvents(
+      gd::ObjectsContainer& project,
+      gd::ObjectsContainer& layout,
+      gd::EventsList& events,
+      const gd::TextSearchPattern& toReplacePattern,
+      const gd::String& newString,
+      bool inConditions,
+      bool inActions,
+      bool inEventString);
+
   /**
    * Remove all conditions of the list using an object
    *
@@ -147,24 +173,24 @@ class GD_CORE_API EventsRefactorer {
    *
    * \return true if something was modified.
    */
-  static bool ReplaceStringInConditions(gd::ObjectsContainer& project,
-                                        gd::ObjectsContainer& layout,
-                                        gd::InstructionsList& conditions,
-                                        gd::String toReplace,
-                                        gd::String newString,
-                                        bool matchCase);
+  static bool ReplaceStringInConditions(
+      gd::ObjectsContainer& project,
+      gd::ObjectsContainer& layout,
+      gd::InstructionsList& conditions,
+      const gd::TextSearchPattern& toReplacePattern,
+      const gd::String& newString);
 
   /**
    * Replace all occurrences of a gd::String in actions
    *
    * \return true if something was modified.
    */
-  static bool ReplaceStringInActions(gd::ObjectsContainer& project,
-                                     gd::ObjectsContainer& layout,
-                                     gd::InstructionsList& conditions,
-                                     gd::String toReplace,
-                                     gd::String newString,
-                                     bool matchCase);
+  static bool ReplaceStringInActions(
+      gd::ObjectsContainer& project,
+      gd::ObjectsContainer& layout,
+      gd::InstructionsList& conditions,
+      const gd::TextSearchPattern& toReplacePattern,
+      const gd::String& newString);
 
   /**
    * Replace all occurrences of a gd::String in strings of events (for example:
@@ -176,28 +202,25 @@ class GD_CORE_API EventsRefactorer {
       gd::ObjectsContainer& project,
       gd::ObjectsContainer& layout,
       gd::BaseEvent& event,
-      gd::String toReplace,
-      gd::String newString,
-      bool matchCase);
+      const gd::TextSearchPattern& toReplacePattern,
+      const gd::String& newString);
 
-  static bool SearchStringInFormattedText(const gd::Platform& platform,
-                                          gd::Instruction& instruction,
-                                          gd::String search,
-                                          bool matchCase,
-                                          bool isCondition);
+  static bool SearchStringInFormattedText(
+      const gd::Platform& platform,
+      gd::Instruction& instruction,
+      const gd::TextSearchPattern& searchPattern,
+      bool isCondition);
   static bool SearchStringInActions(const gd::Platform& platform,
                                     gd::InstructionsList& actions,
-                                    gd::String search,
-                                    bool matchCase,
+                                    const gd::TextSearchPattern& searchPattern,
                                     bool inSentences);
-  static bool SearchStringInConditions(const gd::Platform& platform,
-                                       gd::InstructionsList& conditions,
-                                       gd::String search,
-                                       bool matchCase,
-                                       bool inSentences);
+  static bool SearchStringInConditions(
+      const gd::Platform& platform,
+      gd::InstructionsList& conditions,
+      const gd::TextSearchPattern& searchPattern,
+      bool inSentences);
   static bool SearchStringInEvent(gd::BaseEvent& events,
-                                  gd::String search,
-                                  bool matchCase);
+                                  const gd::TextSearchPattern& searchPattern);
 
   static const gd::String searchIgnoredCharacters;
 
@@ -33,6 +33,21 @@ namespace gd {
 
 VariablesContainer EventsVariableInstructionTypeSwitcher::nullVariablesContainer;
 
+void EventsVariableInstructionTypeSwitcher::DoVisitEventList(
+    gd::EventsList &events) {
+  // The variables containers are only the same for the events of a same root
+  // events list: the worker can be launched on several events functions,
+  // each with its own (temporary) containers for parameters.
+  if (subEventsLists.find(&events) == subEventsLists.end()) {
+    variablePathsCache.Clear();
+  }
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    if (events.GetEvent(i).CanHaveSubEvents()) {
+      subEventsLists.insert(&events.GetEvent(i).GetSubEvents());
+    }
+  }
+}
+
 bool EventsVariableInstructionTypeSwitcher::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
@@ -95,7 +110,8 @@ bool EventsVariableInstructionTypeSwitcher::DoVisitInstruction(gd::Instruction&
               typeChangedVariableNames.end()) {
             gd::VariableInstructionSwitcher::
                 SwitchBetweenUnifiedInstructionIfNeeded(
-                    platform, GetProjectScopedContainers(), instruction);
+                    platform, GetProjectScopedContainers(), instruction,
+                    &variablePathsCache);
           }
         }
       });
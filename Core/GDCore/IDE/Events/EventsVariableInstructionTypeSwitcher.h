@@ -12,9 +12,11 @@
 #include <vector>
 
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ExpressionVariablePathFinder.h"
 #include "GDCore/String.h"
 
 namespace gd {
+class EventsList;
 class VariablesContainer;
 class Platform;
 } // namespace gd
@@ -49,6 +51,7 @@ public:
   virtual ~EventsVariableInstructionTypeSwitcher();
 
 private:
+  void DoVisitEventList(gd::EventsList &events) override;
   bool DoVisitInstruction(gd::Instruction &instruction,
                           bool isCondition) override;
 
@@ -61,6 +64,10 @@ private:
    */
   const gd::String groupName;
   const std::unordered_set<gd::String> &typeChangedVariableNames;
+  gd::VariablePathsCache variablePathsCache;
+  std::unordered_set<const gd::EventsList *>
+      subEventsLists;  ///< The sub-events of visited events, to recognize the
+                       ///< root events lists.
 
   static VariablesContainer nullVariablesContainer;
 };
@@ -13,6 +13,8 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -438,6 +440,22 @@ EventsVariableReplacer::FindForcedVariablesContainerIfAny(
   return nullptr;
 }
 
+bool EventsVariableReplacer::MayUseChangedVariables(
+    const gd::Expression& expression) const {
+  for (const auto& oldToNewVariableName :
+       variablesRenamingChangesetRoot.oldToNewVariableNames) {
+    if (expression.ContainsText(oldToNewVariableName.first)) return true;
+  }
+  for (const auto& modifiedVariable :
+       variablesRenamingChangesetRoot.modifiedVariables) {
+    if (expression.ContainsText(modifiedVariable.first)) return true;
+  }
+  for (const auto& removedVariableName : removedVariableNames) {
+    if (expression.ContainsText(removedVariableName)) return true;
+  }
+  return false;
+}
+
 bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
@@ -460,8 +478,10 @@ bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
             !gd::ParameterMetadata::IsExpression("number", type) &&
             !gd::ParameterMetadata::IsExpression("string", type))
           return;  // Not an expression that can contain variables.
+        if (!MayUseChangedVariables(parameterValue)) return;
 
-        auto node = parameterValue.GetRootNode();
+        // Parse a new tree, as the one of the expression can't be modified.
+        auto node = ParseExpressionToModify(parameterValue.GetPlainString());
         if (node) {
           ExpressionVariableReplacer renamer(platform,
                                              GetProjectScopedContainers(),
@@ -494,8 +514,10 @@ bool EventsVariableReplacer::DoVisitEventExpression(
       !gd::ParameterMetadata::IsExpression("number", type) &&
       !gd::ParameterMetadata::IsExpression("string", type))
     return false;  // Not an expression that can contain variables.
+  if (!MayUseChangedVariables(expression)) return false;
 
-  auto node = expression.GetRootNode();
+  // Parse a new tree, as the one of the expression can't be modified.
+  auto node = ParseExpressionToModify(expression.GetPlainString());
   if (node) {
     ExpressionVariableReplacer renamer(platform,
                                        GetProjectScopedContainers(),
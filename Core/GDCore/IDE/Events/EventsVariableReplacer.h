@@ -18,6 +18,7 @@ namespace gd {
 class BaseEvent;
 class VariablesContainer;
 class EventsList;
+class Expression;
 class Platform;
 struct VariablesRenamingChangesetNode;
 }  // namespace gd
@@ -64,6 +65,13 @@ class GD_CORE_API EventsVariableReplacer
   const gd::VariablesContainer *FindForcedVariablesContainerIfAny(
       const gd::String &type, const gd::String &lastObjectName);
 
+  /**
+   * \brief Return false if the expression can't refer to a renamed or removed
+   * variable (or to the children of a modified one), as it doesn't contain
+   * the name of any of them - so parsing it can be skipped.
+   */
+  bool MayUseChangedVariables(const gd::Expression &expression) const;
+
   const gd::Platform &platform;
   const gd::VariablesContainer &targetVariablesContainer;
   /**
@@ -171,7 +171,8 @@ class GD_CORE_API ExpressionVariableContextFinder
 VariableAndItsParent ExpressionVariablePathFinder::GetLastParentOfNode(
     const gd::Platform &platform,
     const gd::ProjectScopedContainers &projectScopedContainers,
-    gd::ExpressionNode &node) {
+    gd::ExpressionNode &node,
+    gd::VariablePathsCache *cache) {
 
   gd::ExpressionVariableContextFinder contextFinder(platform,
                                                     projectScopedContainers);
@@ -182,14 +183,14 @@ VariableAndItsParent ExpressionVariablePathFinder::GetLastParentOfNode(
 
   gd::ExpressionVariablePathFinder typeFinder(platform, projectScopedContainers,
                                               contextFinder.parameterType,
-                                              contextFinder.objectName, &node);
+                                              contextFinder.objectName, &node,
+                                              cache);
   contextFinder.variableNode->Visit(typeFinder);
 
   if (typeFinder.variableName.empty() || !typeFinder.variablesContainer) {
     return {};
   }
-  return typeFinder.WalkUntilLastParent(*typeFinder.variablesContainer,
-                                        typeFinder.childVariableNames);
+  return typeFinder.WalkUntilLastParent(*typeFinder.variablesContainer);
 }
 
 }  // namespace gd
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
@@ -30,6 +32,31 @@ struct VariableAndItsParent {
   const gd::Variable* parentVariable;
 };
 
+/**
+ * \brief Cache of the variables found by gd::ExpressionVariablePathFinder for
+ * each variables container and path of children, so that paths sharing a
+ * prefix (like `Foo.Bar[0].Baz` and `Foo.Bar[0].Qux`) walk it only once.
+ *
+ * \warning The cache must be cleared when the variables, or the containers it
+ * was used with, are modified or destroyed: it's usually kept only during the
+ * validation or the completion of events sharing the same containers.
+ */
+class GD_CORE_API VariablePathsCache {
+ public:
+  VariablePathsCache(){};
+  virtual ~VariablePathsCache(){};
+
+  void Clear() { variables.clear(); };
+
+ private:
+  friend class ExpressionVariablePathFinder;
+
+  std::unordered_map<const gd::VariablesContainer*,
+                     std::unordered_map<std::string, const gd::Variable*>>
+      variables;  ///< The variable (or nullptr if not existing) found for
+                  ///< each path, in each variables container.
+};
+
 /**
  * \brief Find a variable path from an expression node.
  *
@@ -42,45 +69,56 @@ class GD_CORE_API ExpressionVariablePathFinder
   static VariableAndItsParent GetLastParentOfNode(
       const gd::Platform& platform,
       const gd::ProjectScopedContainers& projectScopedContainers,
-      gd::ExpressionNode& node);
-
-  static const gd::Variable::Type GetVariableType(
+      gd::ExpressionNode& node,
+      gd::VariablePathsCache* cache = nullptr);
+
+  /**
+   * \brief Return the variable a variable parameter refers to, or nullptr if
+   * it can't be found.
+   */
+  static const gd::Variable* GetVariable(
       const gd::Platform& platform,
       const gd::ProjectScopedContainers& projectScopedContainers,
-      gd::ExpressionNode& node, const gd::String& objectName) {
+      gd::ExpressionNode& node, const gd::String& objectName,
+      gd::VariablePathsCache* cache = nullptr) {
     // The context is not checked because this is called on variable parameters.
     gd::String parameterType = objectName.empty() ? "variable" : "objectvar";
     gd::String objName = objectName;
     gd::ExpressionVariablePathFinder typeFinder(
-        platform, projectScopedContainers, parameterType, objName);
+        platform, projectScopedContainers, parameterType, objName, nullptr,
+        cache);
     node.Visit(typeFinder);
 
     if (typeFinder.variableName.empty() || !typeFinder.variablesContainer) {
-      return gd::Variable::Unknown;
+      return nullptr;
     }
-    auto *variable = typeFinder.WalkUntilLastChild(
-        typeFinder.variablesContainer->Get(typeFinder.variableName),
-        typeFinder.childVariableNames);
+    const gd::VariablesContainer& variablesContainer =
+        *typeFinder.variablesContainer;
+    const gd::Variable* variable =
+        typeFinder.FindRootVariable(variablesContainer);
+    return typeFinder.WalkChildren(
+        variablesContainer,
+        variable ? *variable : variablesContainer.Get(typeFinder.variableName),
+        typeFinder.childVariableNames.size());
+  }
+
+  static const gd::Variable::Type GetVariableType(
+      const gd::Platform& platform,
+      const gd::ProjectScopedContainers& projectScopedContainers,
+      gd::ExpressionNode& node, const gd::String& objectName,
+      gd::VariablePathsCache* cache = nullptr) {
+    auto* variable = GetVariable(
+        platform, projectScopedContainers, node, objectName, cache);
     return variable ? variable->GetType() : gd::Variable::Unknown;
   }
 
   static const gd::Variable::Type GetArrayVariableType(
       const gd::Platform& platform,
       const gd::ProjectScopedContainers& projectScopedContainers,
-      gd::ExpressionNode& node, const gd::String& objectName) {
-    // The context is not checked because this is called on variable parameters.
-    gd::String parameterType = objectName.empty() ? "variable" : "objectvar";
-    gd::String objName = objectName;
-    gd::ExpressionVariablePathFinder typeFinder(
-        platform, projectScopedContainers, parameterType, objName);
-    node.Visit(typeFinder);
-
-    if (typeFinder.variableName.empty() || !typeFinder.variablesContainer) {
-      return gd::Variable::Unknown;
-    }
-    auto *variable = typeFinder.WalkUntilLastChild(
-        typeFinder.variablesContainer->Get(typeFinder.variableName),
-        typeFinder.childVariableNames);
+      gd::ExpressionNode& node, const gd::String& objectName,
+      gd::VariablePathsCache* cache = nullptr) {
+    auto* variable = GetVariable(
+        platform, projectScopedContainers, node, objectName, cache);
     if (variable && variable->GetType() != gd::Variable::Array) {
       return gd::Variable::Unknown;
     }
@@ -97,12 +135,14 @@ class GD_CORE_API ExpressionVariablePathFinder
       const gd::ProjectScopedContainers& projectScopedContainers_,
       const gd::String& parameterType_,
       gd::String& objectName_,
-      const gd::ExpressionNode* lastNodeToCheck_ = nullptr)
+      const gd::ExpressionNode* lastNodeToCheck_ = nullptr,
+      gd::VariablePathsCache* cache_ = nullptr)
       : platform(platform_),
         projectScopedContainers(projectScopedContainers_),
         parameterType(parameterType_),
         objectName(objectName_),
         lastNodeToCheck(lastNodeToCheck_),
+        cache(cache_),
         variablesContainer(nullptr),
         variableName(""),
         bailOutBecauseEmptyVariableName(false) {};
@@ -253,94 +293,96 @@ class GD_CORE_API ExpressionVariablePathFinder
   }
 
  private:
-  const gd::Variable* WalkUntilLastChild(
-      const gd::Variable& variable,
-      const std::vector<gd::String>& childVariableNames,
-      size_t startIndex = 0) {
-    if (bailOutBecauseEmptyVariableName)
-      return nullptr;  // Do not even attempt to find the parent if we had an issue
-                  // when visiting nodes.
-
-    const gd::Variable* currentVariable = &variable;
-
-    for (size_t index = startIndex; index < childVariableNames.size();
-         ++index) {
-      const gd::String& childName = childVariableNames[index];
-
-      if (childName.empty()) {
-        if (currentVariable->GetChildrenCount() == 0) {
-          // The array or structure is empty, we can't walk through it - there
-          // is no "parent".
-          return nullptr;
-        }
-
-        if (currentVariable->GetType() == gd::Variable::Array) {
-          currentVariable = &currentVariable->GetAtIndex(0);
-        } else {
-          currentVariable =
-              currentVariable->GetAllChildren().begin()->second.get();
-        }
-      } else {
-        if (!currentVariable->HasChild(childName)) {
-          // Non existing child - there is no "parent".
-          return nullptr;
-        }
-
-        currentVariable = &currentVariable->GetChild(childName);
-      }
+  /**
+   * \brief Return the variable named `variableName` in the variables
+   * container, or nullptr if there is none.
+   */
+  const gd::Variable* FindRootVariable(
+      const gd::VariablesContainer& variablesContainer) {
+    if (!cache) {
+      return variablesContainer.Has(variableName)
+                 ? &variablesContainer.Get(variableName)
+                 : nullptr;
     }
 
-    // Return the last parent of the chain of variables (so not the last
-    // variable but the one before it).
-    return currentVariable;
+    auto& containerVariables = cache->variables[&variablesContainer];
+    auto cachedVariable = containerVariables.find(variableName.Raw());
+    if (cachedVariable != containerVariables.end())
+      return cachedVariable->second;
+
+    const gd::Variable* variable = variablesContainer.Has(variableName)
+                                       ? &variablesContainer.Get(variableName)
+                                       : nullptr;
+    containerVariables[variableName.Raw()] = variable;
+    return variable;
   }
 
-  VariableAndItsParent WalkUntilLastParent(
+  /**
+   * \brief Walk through the children of the variable (found in the variables
+   * container), following the `childrenCount` first names of
+   * `childVariableNames`.
+   *
+   * \return The last variable found, or nullptr if a child does not exist.
+   */
+  const gd::Variable* WalkChildren(
+      const gd::VariablesContainer& variablesContainer,
       const gd::Variable& variable,
-      const std::vector<gd::String>& childVariableNames,
-      size_t startIndex = 0) {
+      size_t childrenCount) {
     if (bailOutBecauseEmptyVariableName)
-      return {};  // Do not even attempt to find the parent if we had an issue
-                  // when visiting nodes.
+      return nullptr;  // Do not even attempt to find the variable if we had an
+                       // issue when visiting nodes.
 
     const gd::Variable* currentVariable = &variable;
+    if (!cache) {
+      for (size_t index = 0; index < childrenCount && currentVariable;
+           ++index) {
+        currentVariable =
+            GetChildVariable(*currentVariable, childVariableNames[index]);
+      }
+      return currentVariable;
+    }
 
-    // Walk until size - 1 as we want the last parent.
-    for (size_t index = startIndex; index + 1 < childVariableNames.size();
-         ++index) {
+    // Each prefix of the path is cached, so that paths sharing it (siblings
+    // accessors or the same path used again) don't walk it again.
+    auto& containerVariables = cache->variables[&variablesContainer];
+    std::string path = variableName.Raw();
+    for (size_t index = 0; index < childrenCount; ++index) {
       const gd::String& childName = childVariableNames[index];
+      path.push_back('\0');
+      path.append(childName.Raw());
 
-      if (childName.empty()) {
-        if (currentVariable->GetChildrenCount() == 0) {
-          // The array or structure is empty, we can't walk through it - there
-          // is no "parent".
-          return {};
-        }
-
-        if (currentVariable->GetType() == gd::Variable::Array) {
-          currentVariable = &currentVariable->GetAtIndex(0);
-        } else {
-          currentVariable =
-              currentVariable->GetAllChildren().begin()->second.get();
-        }
+      auto cachedVariable = containerVariables.find(path);
+      if (cachedVariable != containerVariables.end()) {
+        currentVariable = cachedVariable->second;
       } else {
-        if (!currentVariable->HasChild(childName)) {
-          // Non existing child - there is no "parent".
-          return {};
-        }
+        currentVariable = GetChildVariable(*currentVariable, childName);
+        containerVariables[path] = currentVariable;
+      }
+      if (!currentVariable) return nullptr;
+    }
+    return currentVariable;
+  }
 
-        currentVariable = &currentVariable->GetChild(childName);
+  static const gd::Variable* GetChildVariable(const gd::Variable& variable,
+                                              const gd::String& childName) {
+    if (childName.empty()) {
+      if (variable.GetChildrenCount() == 0) {
+        // The array or structure is empty, we can't walk through it.
+        return nullptr;
       }
+
+      return variable.GetType() == gd::Variable::Array
+                 ? &variable.GetAtIndex(0)
+                 : variable.GetAllChildren().begin()->second.get();
     }
 
-    // Return the last parent of the chain of variables (so not the last
-    // variable but the one before it).
-    return {.parentVariable = currentVariable};
+    // Non existing child - there is no variable.
+    return variable.HasChild(childName) ? &variable.GetChild(childName)
+                                        : nullptr;
   }
 
   VariableAndItsParent WalkUntilLastParent(
-      const gd::VariablesContainer& variablesContainer,
-      const std::vector<gd::String>& childVariableNames) {
+      const gd::VariablesContainer& variablesContainer) {
     if (bailOutBecauseEmptyVariableName)
       return {};  // Do not even attempt to find the parent if we had an issue
                   // when visiting nodes.
@@ -348,14 +390,18 @@ class GD_CORE_API ExpressionVariablePathFinder
     if (variableName.empty())
       return {};  // There is no "parent" to the variables container itself.
 
-    const gd::Variable* variable = variablesContainer.Has(variableName)
-                                       ? &variablesContainer.Get(variableName)
-                                       : nullptr;
+    const gd::Variable* variable = FindRootVariable(variablesContainer);
     if (childVariableNames.empty() || !variable)
       return {// No child: the parent is the variables container itself.
               .parentVariablesContainer = &variablesContainer};
 
-    return WalkUntilLastParent(*variable, childVariableNames, 0);
+    // Walk until the last parent of the chain of variables (so not the last
+    // variable but the one before it).
+    const gd::Variable* parentVariable = WalkChildren(
+        variablesContainer, *variable, childVariableNames.size() - 1);
+    if (!parentVariable) return {};
+
+    return {.parentVariable = parentVariable};
   }
 
   const gd::Platform& platform;
@@ -363,6 +409,7 @@ class GD_CORE_API ExpressionVariablePathFinder
   const gd::String& parameterType;
   gd::String& objectName;
   const gd::ExpressionNode* lastNodeToCheck;
+  gd::VariablePathsCache* cache;  ///< Optional cache of the variables found.
 
   const gd::VariablesContainer* variablesContainer;
   gd::String variableName;
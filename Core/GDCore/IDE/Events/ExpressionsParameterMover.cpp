@@ -11,6 +11,7 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -150,7 +151,8 @@ bool ExpressionsParameterMover::DoVisitInstruction(gd::Instruction& instruction,
     const gd::String& type = metadata.parameters.GetParameter(pNb).GetType();
     const gd::Expression& expression = instruction.GetParameter(pNb);
 
-    auto node = expression.GetRootNode();
+    // Parse a new tree, as the one of the expression can't be modified.
+    auto node = ParseExpressionToModify(expression.GetPlainString());
     if (node) {
       ExpressionParameterMover mover(GetProjectScopedContainers(),
                                      behaviorType,
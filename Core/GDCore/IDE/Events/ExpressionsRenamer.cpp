@@ -11,6 +11,7 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -155,8 +156,10 @@ bool ExpressionsRenamer::DoVisitInstruction(gd::Instruction& instruction,
                             pNb < instruction.GetParametersCount();
        ++pNb) {
     const gd::Expression& expression = instruction.GetParameter(pNb);
+    if (!expression.ContainsText(oldFunctionName)) continue;
 
-    auto node = expression.GetRootNode();
+    // Parse a new tree, as the one of the expression can't be modified.
+    auto node = ParseExpressionToModify(expression.GetPlainString());
     if (node) {
       ExpressionFunctionRenamer renamer(GetProjectScopedContainers(),
                                         behaviorType,
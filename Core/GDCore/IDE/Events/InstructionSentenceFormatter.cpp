@@ -28,6 +28,39 @@ InstructionSentenceFormatter::GetAsFormattedText(
     const Instruction &instr, const gd::InstructionMetadata &metadata) {
   std::vector<std::pair<gd::String, gd::TextFormatting> > formattedStr;
 
+  for (const SentencePart &part : GetSentenceParts(metadata)) {
+    TextFormatting format;
+    if (part.parameterIndex == gd::String::npos) {
+      formattedStr.push_back(std::make_pair(part.text, format));
+      continue;
+    }
+
+    // Add the parameter
+    format.userData = part.parameterIndex;
+
+    gd::String text = instr.GetParameter(part.parameterIndex).GetPlainString();
+    std::replace(text.Raw().begin(),
+                 text.Raw().end(),
+                 '\n',
+                 ' ');  // Using the raw std::string inside gd::String (no
+                        // problems because it's only ANSI characters)
+
+    formattedStr.push_back(std::make_pair(text, format));
+  }
+
+  return formattedStr;
+}
+
+const std::vector<InstructionSentenceFormatter::SentencePart> &
+InstructionSentenceFormatter::GetSentenceParts(
+    const gd::InstructionMetadata &metadata) {
+  const std::size_t parametersCount = metadata.parameters.GetParametersCount();
+  auto key = std::make_pair(metadata.GetSentence(), parametersCount);
+  auto it = sentencesParts.find(key);
+  if (it != sentencesParts.end()) return it->second;
+
+  std::vector<SentencePart> &parts = sentencesParts[key];
+
   gd::String sentence = metadata.GetSentence();
   std::replace(sentence.Raw().begin(), sentence.Raw().end(), '\n', ' ');
 
@@ -43,7 +76,7 @@ InstructionSentenceFormatter::GetAsFormattedText(
     parse = false;
     size_t firstParamPosition = gd::String::npos;
     size_t firstParamIndex = gd::String::npos;
-    for (std::size_t i = 0; i < metadata.parameters.GetParametersCount(); ++i) {
+    for (std::size_t i = 0; i < parametersCount; ++i) {
       size_t paramPosition =
           sentence.find("_PARAM" + gd::String::From(i) + "_");
       if (paramPosition < firstParamPosition) {
@@ -53,40 +86,28 @@ InstructionSentenceFormatter::GetAsFormattedText(
       }
     }
 
-    // When a parameter is found, complete formatted gd::String.
+    // When a parameter is found, complete the parts.
     if (parse) {
       if (firstParamPosition !=
           0)  // Add constant text before the parameter if any
       {
-        TextFormatting format;
-        formattedStr.push_back(
-            std::make_pair(sentence.substr(0, firstParamPosition), format));
+        parts.push_back(SentencePart{sentence.substr(0, firstParamPosition),
+                                     gd::String::npos});
       }
 
       // Add the parameter
-      TextFormatting format;
-      format.userData = firstParamIndex;
-
-      gd::String text = instr.GetParameter(firstParamIndex).GetPlainString();
-      std::replace(text.Raw().begin(),
-                   text.Raw().end(),
-                   '\n',
-                   ' ');  // Using the raw std::string inside gd::String (no
-                          // problems because it's only ANSI characters)
-
-      formattedStr.push_back(std::make_pair(text, format));
+      parts.push_back(SentencePart{"", firstParamIndex});
       gd::String placeholder =
           "_PARAM" + gd::String::From(firstParamIndex) + "_";
       sentence = sentence.substr(firstParamPosition + placeholder.length());
     } else if (!sentence.empty())  // No more parameter found: Add the end of
                                    // the sentence
     {
-      TextFormatting format;
-      formattedStr.push_back(std::make_pair(sentence, format));
+      parts.push_back(SentencePart{sentence, gd::String::npos});
     }
   }
 
-  return formattedStr;
+  return parts;
 }
 
 gd::String InstructionSentenceFormatter::GetFullText(
@@ -21,6 +21,9 @@ namespace gd {
 /**
  * \brief Generate user friendly sentences and information from an action or
  * condition metadata.
+ *
+ * The sentences of the metadata are only parsed the first time they are
+ * formatted, as this is done for each instruction displayed.
  */
 class GD_CORE_API InstructionSentenceFormatter {
  public:
@@ -51,8 +54,27 @@ class GD_CORE_API InstructionSentenceFormatter {
   virtual ~InstructionSentenceFormatter(){};
 
  private:
+  /**
+   * \brief A part of a sentence: a constant text, or a parameter.
+   */
+  struct SentencePart {
+    gd::String text;
+    std::size_t parameterIndex;  ///< gd::String::npos for a constant text.
+  };
+
+  /**
+   * \brief Return the parts of the sentence of the metadata, parsed once for
+   * each sentence (so a translated sentence is parsed again).
+   */
+  const std::vector<SentencePart> &GetSentenceParts(
+      const gd::InstructionMetadata &metadata);
+
   InstructionSentenceFormatter(){};
   static InstructionSentenceFormatter *_singleton;
+
+  std::map<std::pair<gd::String, std::size_t>, std::vector<SentencePart>>
+      sentencesParts;  ///< The parts of each sentence, by sentence and number
+                       ///< of parameters.
 };
 
 }  // namespace gd
@@ -6,17 +6,10 @@
 
 #ifndef GDCORE_INSTRUCTIONS_COUNT_EVALUATOR_H
 #define GDCORE_INSTRUCTIONS_COUNT_EVALUATOR_H
-#include <set>
-
-#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
-#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
-#include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
 #include "GDCore/String.h"
 
 namespace gd {
 class Project;
-class Object;
-class Behavior;
 } // namespace gd
 
 namespace gd {
@@ -26,23 +19,14 @@ namespace gd {
  *
  * This is used by the examples repository to evaluate examples size.
  *
+ * \see gd::ProjectStatisticsEvaluator, to get more statistics at once.
  */
-class GD_CORE_API InstructionsCountEvaluator : public ArbitraryEventsWorker {
+class GD_CORE_API InstructionsCountEvaluator {
 public:
   /**
    * Return the number of instructions in the project excluding extensions.
    */
   static const int ScanProject(gd::Project &project);
-
-private:
-  InstructionsCountEvaluator(gd::Project &project_)
-      : project(project_), instructionCount(0){};
-  gd::Project &project;
-  int instructionCount;
-
-  // Instructions Visitor
-  bool DoVisitInstruction(gd::Instruction &instruction,
-                          bool isCondition) override;
 };
 
 }; // namespace gd
@@ -163,6 +163,8 @@ bool ProjectElementRenamer::DoVisitInstruction(gd::Instruction &instruction,
           }
         }
 
+        if (!parameterValue.ContainsText(oldName)) return;
+
         if (parameterMetadata.GetType() == parameterType &&
             (objectName.empty() || lastObjectName == objectName) &&
             (layerName.empty() || lastLayerName == layerName)) {
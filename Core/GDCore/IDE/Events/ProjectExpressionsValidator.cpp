@@ -0,0 +1,255 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ProjectExpressionsValidator.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Tools/PerfScope.h"
+#include "GDCore/Tools/TasksRunner.h"
+
+namespace gd {
+
+ProjectExpressionsValidator::~ProjectExpressionsValidator() {}
+
+std::vector<std::vector<ProjectExpressionsValidator::Diagnostic>>
+ProjectExpressionsValidator::ValidateProjectUnits(
+    gd::Project &project,
+    std::size_t threadsCount,
+    std::vector<gd::String> *unitNames) {
+  gd::PerfScope perfScope("ProjectExpressionsValidator::ValidateProjectUnits");
+  // Everything lazily built when read must be built before the threads are
+  // started: the layouts (if the project was lazily unserialized), the lazy
+  // extensions and the metadata index.
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); i++)
+    project.GetLayout(i);
+  const gd::Platform &platform = project.GetCurrentPlatform();
+  platform.PrepareForConcurrentUse();
+
+  const std::size_t layoutsCount = project.GetLayoutsCount();
+  const std::size_t unitsCount =
+      layoutsCount + project.GetEventsFunctionsExtensionsCount();
+  if (unitNames) {
+    for (std::size_t i = 0; i < layoutsCount; i++)
+      unitNames->push_back(project.GetLayout(i).GetName());
+    for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+         i++)
+      unitNames->push_back(project.GetEventsFunctionsExtension(i).GetName());
+  }
+
+  std::vector<std::vector<Diagnostic>> unitsDiagnostics(unitsCount);
+  gd::TasksRunner::Run(unitsCount, threadsCount, [&](std::size_t index) {
+    gd::ProjectExpressionsValidator validator(platform);
+    if (index < layoutsCount) {
+      gd::ProjectBrowserHelper::ExposeLayoutEventsAndExternalEvents(
+          project, project.GetLayout(index), validator);
+    } else {
+      gd::ProjectBrowserHelper::ExposeEventsFunctionsExtensionEvents(
+          project,
+          project.GetEventsFunctionsExtension(index - layoutsCount),
+          validator);
+    }
+    unitsDiagnostics[index] = std::move(validator.diagnostics);
+  });
+
+  return unitsDiagnostics;
+}
+
+std::vector<ProjectExpressionsValidator::Diagnostic>
+ProjectExpressionsValidator::ValidateProjectInParallel(
+    gd::Project &project, std::size_t threadsCount) {
+  std::vector<Diagnostic> diagnostics;
+  for (auto &unitDiagnostics :
+       ValidateProjectUnits(project, threadsCount, nullptr)) {
+    std::move(unitDiagnostics.begin(),
+              unitDiagnostics.end(),
+              std::back_inserter(diagnostics));
+  }
+  return diagnostics;
+}
+
+void ProjectExpressionsValidator::AddProjectDiagnosticReports(
+    gd::Project &project,
+    gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport,
+    std::size_t threadsCount) {
+  std::vector<gd::String> unitNames;
+  auto unitsDiagnostics =
+      ValidateProjectUnits(project, threadsCount, &unitNames);
+
+  for (std::size_t i = 0; i < unitsDiagnostics.size(); i++) {
+    auto &diagnosticReport =
+        wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
+            unitNames[i]);
+    // Same errors as the ones reported by gd::ExpressionCodeGenerator.
+    for (const auto &diagnostic : unitsDiagnostics[i]) {
+      if (diagnostic.isFatal && !diagnostic.actualValue.empty() &&
+          (diagnostic.type ==
+               gd::ExpressionParserError::ErrorType::UndeclaredVariable ||
+           diagnostic.type ==
+               gd::ExpressionParserError::ErrorType::UnknownIdentifier)) {
+        diagnosticReport.Add(gd::ProjectDiagnostic(
+            gd::ProjectDiagnostic::ErrorType::UndeclaredVariable,
+            diagnostic.message,
+            diagnostic.actualValue,
+            "",
+            diagnostic.objectName));
+      }
+    }
+  }
+}
+
+std::vector<ProjectExpressionsValidator::Diagnostic>
+ProjectExpressionsValidator::ValidateProject(gd::Project &project) {
+  gd::PerfScope perfScope("ProjectExpressionsValidator::ValidateProject");
+  gd::ProjectExpressionsValidator validator(project.GetCurrentPlatform());
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, validator);
+  return validator.GetDiagnostics();
+}
+
+std::vector<ProjectExpressionsValidator::Diagnostic>
+ProjectExpressionsValidator::ValidateLayout(gd::Project &project,
+                                            gd::Layout &layout) {
+  gd::ProjectExpressionsValidator validator(project.GetCurrentPlatform());
+  gd::ProjectBrowserHelper::ExposeLayoutEventsAndExternalEvents(
+      project, layout, validator);
+  return validator.GetDiagnostics();
+}
+
+std::vector<ProjectExpressionsValidator::Diagnostic>
+ProjectExpressionsValidator::ValidateEventsFunction(
+    gd::Project &project,
+    const gd::EventsFunctionsExtension &eventsFunctionsExtension,
+    gd::EventsFunction &eventsFunction) {
+  gd::ObjectsContainer parameterObjectsContainer(
+      gd::ObjectsContainer::SourceType::Function);
+  gd::VariablesContainer parameterVariablesContainer(
+      gd::VariablesContainer::SourceType::Parameters);
+  auto projectScopedContainers = gd::ProjectScopedContainers::
+      MakeNewProjectScopedContainersForFreeEventsFunction(
+          project, eventsFunctionsExtension, eventsFunction,
+          parameterObjectsContainer, parameterVariablesContainer);
+
+  gd::ProjectExpressionsValidator validator(project.GetCurrentPlatform());
+  validator.Launch(eventsFunction.GetEvents(), projectScopedContainers);
+  return validator.GetDiagnostics();
+}
+
+std::size_t ProjectExpressionsValidator::GetFatalErrorsCount() const {
+  return std::count_if(
+      diagnostics.begin(), diagnostics.end(),
+      [](const Diagnostic &diagnostic) { return diagnostic.isFatal; });
+}
+
+bool ProjectExpressionsValidator::DoVisitEvent(gd::BaseEvent &event) {
+  currentEvent = &event;
+  return false;
+}
+
+bool ProjectExpressionsValidator::DoVisitInstruction(
+    gd::Instruction &instruction, bool isCondition) {
+  const gd::InstructionMetadata &metadata =
+      GetInstructionMetadata(instruction.GetType(), isCondition);
+
+  gd::ParameterMetadataTools::IterateOverParametersWithIndex(
+      instruction.GetParameters(),
+      metadata.GetParameters(),
+      [&](const gd::ParameterMetadata &parameterMetadata,
+          const gd::Expression &parameterValue,
+          size_t parameterIndex,
+          const gd::String &lastObjectName) {
+        ValidateExpression(
+            parameterValue, parameterMetadata, &instruction, parameterIndex);
+      });
+
+  return false;
+}
+
+bool ProjectExpressionsValidator::DoVisitEventExpression(
+    gd::Expression &expression, const gd::ParameterMetadata &metadata) {
+  ValidateExpression(expression, metadata, nullptr, 0);
+  return false;
+}
+
+const gd::InstructionMetadata &
+ProjectExpressionsValidator::GetInstructionMetadata(const gd::String &type,
+                                                    bool isCondition) {
+  auto &cache = isCondition ? conditionsMetadata : actionsMetadata;
+  auto it = cache.find(type);
+  if (it != cache.end()) return *it->second;
+
+  // Returned metadata are owned by the platform extensions (or are the
+  // static "bad" metadata), so they outlive the worker.
+  const gd::InstructionMetadata &metadata =
+      isCondition ? gd::MetadataProvider::GetConditionMetadata(platform, type)
+                  : gd::MetadataProvider::GetActionMetadata(platform, type);
+  cache.emplace(type, &metadata);
+  return metadata;
+}
+
+void ProjectExpressionsValidator::ValidateExpression(
+    const gd::Expression &expression,
+    const gd::ParameterMetadata &parameterMetadata,
+    const gd::Instruction *instruction,
+    std::size_t parameterIndex) {
+  // Use the same root types as the code generation.
+  const gd::String &type = parameterMetadata.GetType();
+  gd::String rootType;
+  if (gd::ParameterMetadata::IsExpression("number", type))
+    rootType = "number";
+  else if (gd::ParameterMetadata::IsExpression("string", type))
+    rootType = "string";
+  else if (gd::ParameterMetadata::IsExpression("variable", type))
+    rootType = type;
+  else
+    return;
+
+  auto node = expression.GetRootNode();
+  if (!node) return;
+
+  gd::ExpressionValidator validator(platform,
+                                    GetProjectScopedContainers(),
+                                    rootType,
+                                    parameterMetadata.GetExtraInfo());
+  node->Visit(validator);
+
+  const auto &fatalErrors = validator.GetFatalErrors();
+  for (auto *error : validator.GetAllErrors()) {
+    Diagnostic diagnostic;
+    diagnostic.event = currentEvent;
+    diagnostic.instruction = instruction;
+    diagnostic.parameterIndex = parameterIndex;
+    diagnostic.type = error->GetType();
+    diagnostic.isFatal =
+        std::find(fatalErrors.begin(), fatalErrors.end(), error) !=
+        fatalErrors.end();
+    diagnostic.message = error->GetMessage();
+    diagnostic.actualValue = error->GetActualValue();
+    diagnostic.objectName = error->GetObjectName();
+    diagnostic.startPosition = error->GetStartPosition();
+    diagnostic.endPosition = error->GetEndPosition();
+    diagnostics.push_back(std::move(diagnostic));
+  }
+}
+
+}  // namespace gd
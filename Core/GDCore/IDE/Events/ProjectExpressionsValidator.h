@@ -0,0 +1,173 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class BaseEvent;
+class Expression;
+class EventsFunction;
+class EventsFunctionsExtension;
+class Instruction;
+class InstructionMetadata;
+class Layout;
+class ParameterMetadata;
+class Platform;
+class Project;
+class WholeProjectDiagnosticReport;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Validate all the expressions of events in a single pass, and
+ * collect the errors in a list of diagnostics.
+ *
+ * This is the batch counterpart of gd::ExpressionValidator: events are
+ * browsed once, the gd::ProjectScopedContainers are built once per events
+ * list and the instructions metadata are looked up once per instruction type.
+ *
+ * \see gd::ExpressionValidator
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ProjectExpressionsValidator
+    : public ArbitraryEventsWorkerWithContext {
+ public:
+  /**
+   * \brief An error found in an expression of the events.
+   *
+   * \note Event and instruction pointers are only valid as long as the
+   * validated events are not modified.
+   */
+  struct Diagnostic {
+    /** The event holding the expression. */
+    const gd::BaseEvent *event;
+    /** The instruction holding the expression, or nullptr if the expression
+     * is a parameter of the event itself. */
+    const gd::Instruction *instruction;
+    /** The index of the parameter in the instruction. */
+    std::size_t parameterIndex;
+    gd::ExpressionParserError::ErrorType type;
+    /** false for errors that don't prevent the code generation. */
+    bool isFatal;
+    gd::String message;
+    /** The variable or identifier name, for undeclared ones. */
+    gd::String actualValue;
+    gd::String objectName;
+    std::size_t startPosition;
+    std::size_t endPosition;
+  };
+
+  ProjectExpressionsValidator(const gd::Platform &platform_)
+      : platform(platform_), currentEvent(nullptr){};
+  virtual ~ProjectExpressionsValidator();
+
+  /**
+   * \brief Validate the expressions of all the events of the project
+   * (scenes, external events and extensions).
+   */
+  static std::vector<Diagnostic> ValidateProject(gd::Project &project);
+
+  /**
+   * \brief Validate the expressions of all the events of the project, like
+   * ValidateProject, using several threads.
+   *
+   * Each scene (with its external events) and each extension is validated
+   * by the first available thread, with its own worker. The diagnostics are
+   * then merged: the ones of each scene, followed by its external events,
+   * then the ones of each extension.
+   *
+   * \param threadsCount The number of threads to use. 0 means as many as the
+   * hardware can run concurrently.
+   *
+   * \note The project is not modified, but it must not be modified by
+   * another thread while it's validated. Threads are not used when GDCore is
+   * built with Emscripten without threads support.
+   */
+  static std::vector<Diagnostic> ValidateProjectInParallel(
+      gd::Project &project, std::size_t threadsCount = 0);
+
+  /**
+   * \brief Validate the expressions of all the events of the project using
+   * several threads, and add a report for each scene and each extension to
+   * \a wholeProjectDiagnosticReport.
+   *
+   * Only the errors reported by the code generation (undeclared variables)
+   * are added to the reports.
+   *
+   * \see ValidateProjectInParallel
+   */
+  static void AddProjectDiagnosticReports(
+      gd::Project &project,
+      gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport,
+      std::size_t threadsCount = 0);
+
+  /**
+   * \brief Validate the expressions of the events of a scene and of its
+   * external events.
+   */
+  static std::vector<Diagnostic> ValidateLayout(gd::Project &project,
+                                                gd::Layout &layout);
+
+  /**
+   * \brief Validate the expressions of the events of a free events function.
+   */
+  static std::vector<Diagnostic> ValidateEventsFunction(
+      gd::Project &project,
+      const gd::EventsFunctionsExtension &eventsFunctionsExtension,
+      gd::EventsFunction &eventsFunction);
+
+  /**
+   * \brief Return the errors found since the worker was constructed.
+   */
+  const std::vector<Diagnostic> &GetDiagnostics() const { return diagnostics; }
+
+  /**
+   * \brief Return the number of errors that prevent the code generation.
+   */
+  std::size_t GetFatalErrorsCount() const;
+
+ private:
+  bool DoVisitEvent(gd::BaseEvent &event) override;
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override;
+  bool DoVisitEventExpression(gd::Expression &expression,
+                              const gd::ParameterMetadata &metadata) override;
+
+  /**
+   * \brief Validate the project split in units (scenes and extensions),
+   * each one run with its own worker, possibly from another thread.
+   */
+  static std::vector<std::vector<Diagnostic>> ValidateProjectUnits(
+      gd::Project &project,
+      std::size_t threadsCount,
+      std::vector<gd::String> *unitNames);
+
+  const gd::InstructionMetadata &GetInstructionMetadata(
+      const gd::String &type, bool isCondition);
+
+  void ValidateExpression(const gd::Expression &expression,
+                          const gd::ParameterMetadata &parameterMetadata,
+                          const gd::Instruction *instruction,
+                          std::size_t parameterIndex);
+
+  const gd::Platform &platform;
+  const gd::BaseEvent *currentEvent;
+  std::unordered_map<gd::String, const gd::InstructionMetadata *>
+      conditionsMetadata;  ///< Cache of the conditions metadata, by type.
+  std::unordered_map<gd::String, const gd::InstructionMetadata *>
+      actionsMetadata;  ///< Cache of the actions metadata, by type.
+  std::vector<Diagnostic> diagnostics;
+};
+
+}  // namespace gd
@@ -0,0 +1,160 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ProjectStatisticsEvaluator.h"
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/PlatformMetadataIndex.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+void ProjectStatistics::Add(const ProjectStatistics &other) {
+  eventsCount += other.eventsCount;
+  conditionsCount += other.conditionsCount;
+  actionsCount += other.actionsCount;
+  expressionsCount += other.expressionsCount;
+  if (eventsCountByDepth.size() < other.eventsCountByDepth.size())
+    eventsCountByDepth.resize(other.eventsCountByDepth.size(), 0);
+  for (std::size_t depth = 0; depth < other.eventsCountByDepth.size(); ++depth)
+    eventsCountByDepth[depth] += other.eventsCountByDepth[depth];
+  for (const auto &it : other.instructionsCountByExtension)
+    instructionsCountByExtension[it.first] += it.second;
+  objectsCount += other.objectsCount;
+  instancesCount += other.instancesCount;
+  for (const auto &it : other.resourcesCountByKind)
+    resourcesCountByKind[it.first] += it.second;
+}
+
+gd::String ProjectStatistics::ToJSON() const {
+  gd::SerializerElement element;
+  element.SetAttribute("eventsCount", static_cast<int>(eventsCount));
+  element.SetAttribute("conditionsCount", static_cast<int>(conditionsCount));
+  element.SetAttribute("actionsCount", static_cast<int>(actionsCount));
+  element.SetAttribute("expressionsCount", static_cast<int>(expressionsCount));
+  element.SetAttribute("objectsCount", static_cast<int>(objectsCount));
+  element.SetAttribute("instancesCount", static_cast<int>(instancesCount));
+
+  auto &eventsCountByDepthElement = element.AddChild("eventsCountByDepth");
+  eventsCountByDepthElement.ConsiderAsArrayOf("depth");
+  for (std::size_t count : eventsCountByDepth)
+    eventsCountByDepthElement.AddChild("depth").SetValue(static_cast<int>(count));
+
+  auto &instructionsCountByExtensionElement =
+      element.AddChild("instructionsCountByExtension");
+  for (const auto &it : instructionsCountByExtension)
+    instructionsCountByExtensionElement.AddChild(it.first).SetValue(
+        static_cast<int>(it.second));
+
+  auto &resourcesCountByKindElement = element.AddChild("resourcesCountByKind");
+  for (const auto &it : resourcesCountByKind)
+    resourcesCountByKindElement.AddChild(it.first).SetValue(
+        static_cast<int>(it.second));
+
+  return gd::Serializer::ToJSON(element);
+}
+
+ProjectStatisticsEvaluator::ProjectStatisticsEvaluator(
+    const gd::Project &project, ProjectStatistics &statistics_)
+    : platform(project.GetUsedPlatforms().empty()
+                   ? nullptr
+                   : &project.GetCurrentPlatform()),
+      statistics(statistics_) {}
+
+ProjectStatistics ProjectStatisticsEvaluator::ComputeLayoutStatistics(
+    const gd::Project &project, const gd::Layout &layout) {
+  ProjectStatistics statistics;
+  ProjectStatisticsEvaluator worker(project, statistics);
+  worker.Launch(layout.GetEvents());
+
+  AddObjectsStatistics(layout.GetObjects(), statistics);
+  statistics.instancesCount += layout.GetInitialInstances().GetInstancesCount();
+  return statistics;
+}
+
+ProjectStatistics ProjectStatisticsEvaluator::ComputeProjectStatistics(
+    const gd::Project &project) {
+  ProjectStatistics statistics;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    statistics.Add(ComputeLayoutStatistics(project, project.GetLayout(i)));
+  }
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    ProjectStatistics externalEventsStatistics;
+    ProjectStatisticsEvaluator worker(project, externalEventsStatistics);
+    worker.Launch(project.GetExternalEvents(i).GetEvents());
+    statistics.Add(externalEventsStatistics);
+  }
+
+  AddObjectsStatistics(project.GetObjects(), statistics);
+  for (const auto &resource :
+       project.GetResourcesManager().GetAllResources()) {
+    statistics.resourcesCountByKind[resource->GetKind()]++;
+  }
+  return statistics;
+}
+
+void ProjectStatisticsEvaluator::AddObjectsStatistics(
+    const gd::ObjectsContainer &objects, ProjectStatistics &statistics) {
+  statistics.objectsCount += objects.GetObjectsCount();
+}
+
+void ProjectStatisticsEvaluator::DoVisitEventList(
+    const gd::EventsList &events) {
+  // Events are counted with their list, where their depth is known. The
+  // lists not found are the root events lists.
+  auto subEventsDepth = subEventsDepths.find(&events);
+  std::size_t depth =
+      subEventsDepth != subEventsDepths.end() ? subEventsDepth->second : 0;
+
+  if (events.IsEmpty()) return;
+  statistics.eventsCount += events.GetEventsCount();
+  if (statistics.eventsCountByDepth.size() <= depth)
+    statistics.eventsCountByDepth.resize(depth + 1, 0);
+  statistics.eventsCountByDepth[depth] += events.GetEventsCount();
+
+  // Sub-events lists are visited after: remember their depth.
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent &event = events.GetEvent(i);
+    if (event.CanHaveSubEvents())
+      subEventsDepths[&event.GetSubEvents()] = depth + 1;
+  }
+}
+
+void ProjectStatisticsEvaluator::DoVisitInstruction(
+    const gd::Instruction &instruction, bool isCondition) {
+  if (isCondition)
+    statistics.conditionsCount++;
+  else
+    statistics.actionsCount++;
+
+  for (const gd::Expression &parameter : instruction.GetParameters()) {
+    if (!parameter.GetPlainString().empty()) statistics.expressionsCount++;
+  }
+
+  const gd::String &type = instruction.GetType();
+  const PlatformMetadataIndex::Entry<gd::InstructionMetadata> *entry = nullptr;
+  if (platform) {
+    const auto &metadataIndex = platform->GetMetadataIndex();
+    entry = isCondition ? metadataIndex.FindCondition(type)
+                        : metadataIndex.FindAction(type);
+  }
+  if (entry)
+    statistics.instructionsCountByExtension[entry->extension->GetName()]++;
+  else
+    statistics.instructionsCountByExtension[type.substr(0, type.find("::"))]++;
+}
+
+}  // namespace gd
@@ -0,0 +1,152 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class Project;
+class Layout;
+class Platform;
+class ObjectsContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Statistics about a project, or a part of it (usually a scene): the
+ * number of events (by depth), instructions (by extension), expressions,
+ * objects, instances and resources (by kind).
+ *
+ * The statistics of the parts of a project can be computed separately (and
+ * kept while the part is not modified), then summed with Add.
+ *
+ * \see gd::ProjectStatisticsEvaluator
+ */
+class GD_CORE_API ProjectStatistics {
+ public:
+  ProjectStatistics()
+      : eventsCount(0),
+        conditionsCount(0),
+        actionsCount(0),
+        expressionsCount(0),
+        objectsCount(0),
+        instancesCount(0){};
+  virtual ~ProjectStatistics(){};
+
+  std::size_t GetEventsCount() const { return eventsCount; }
+  std::size_t GetInstructionsCount() const {
+    return conditionsCount + actionsCount;
+  }
+  std::size_t GetConditionsCount() const { return conditionsCount; }
+  std::size_t GetActionsCount() const { return actionsCount; }
+
+  /**
+   * \brief Return the number of non empty parameters of instructions.
+   */
+  std::size_t GetExpressionsCount() const { return expressionsCount; }
+
+  /**
+   * \brief Return the number of events at each depth (0 for the events at
+   * the root of an events list, 1 for their sub-events...).
+   */
+  const std::vector<std::size_t> &GetEventsCountByDepth() const {
+    return eventsCountByDepth;
+  }
+
+  /**
+   * \brief Return the number of instructions using the conditions and
+   * actions of each extension (the namespace of the instruction type is used
+   * for instructions not declared by any extension).
+   */
+  const std::map<gd::String, std::size_t> &GetInstructionsCountByExtension()
+      const {
+    return instructionsCountByExtension;
+  }
+
+  std::size_t GetObjectsCount() const { return objectsCount; }
+  std::size_t GetInstancesCount() const { return instancesCount; }
+
+  /**
+   * \brief Return the number of resources of each kind.
+   */
+  const std::map<gd::String, std::size_t> &GetResourcesCountByKind() const {
+    return resourcesCountByKind;
+  }
+
+  /**
+   * \brief Add the statistics of another part of the project.
+   */
+  void Add(const ProjectStatistics &other);
+
+  /**
+   * \brief Return the statistics, as JSON.
+   */
+  gd::String ToJSON() const;
+
+ private:
+  friend class ProjectStatisticsEvaluator;
+
+  std::size_t eventsCount;
+  std::size_t conditionsCount;
+  std::size_t actionsCount;
+  std::size_t expressionsCount;
+  std::vector<std::size_t> eventsCountByDepth;
+  std::map<gd::String, std::size_t> instructionsCountByExtension;
+  std::size_t objectsCount;
+  std::size_t instancesCount;
+  std::map<gd::String, std::size_t> resourcesCountByKind;
+};
+
+/**
+ * \brief Compute the statistics of a project (excluding extensions) or of a
+ * scene, browsing the events only once.
+ *
+ * \see gd::ProjectStatistics
+ */
+class GD_CORE_API ProjectStatisticsEvaluator
+    : public ReadOnlyArbitraryEventsWorker {
+ public:
+  /**
+   * \brief Compute the statistics of the events, objects and instances of a
+   * scene.
+   */
+  static ProjectStatistics ComputeLayoutStatistics(const gd::Project &project,
+                                                   const gd::Layout &layout);
+
+  /**
+   * \brief Compute the statistics of the whole project, excluding the events
+   * functions extensions: the scenes, the external events, the global
+   * objects and the resources.
+   */
+  static ProjectStatistics ComputeProjectStatistics(
+      const gd::Project &project);
+
+ private:
+  ProjectStatisticsEvaluator(const gd::Project &project,
+                             ProjectStatistics &statistics_);
+
+  static void AddObjectsStatistics(const gd::ObjectsContainer &objects,
+                                   ProjectStatistics &statistics);
+
+  void DoVisitEventList(const gd::EventsList &events) override;
+  void DoVisitInstruction(const gd::Instruction &instruction,
+                          bool isCondition) override;
+
+  const gd::Platform *platform;  ///< Used to find the extension of
+                                 ///< instructions, if any.
+  ProjectStatistics &statistics;
+  std::unordered_map<const gd::EventsList *, std::size_t>
+      subEventsDepths;  ///< The depth of the sub-events of visited events.
+};
+
+}  // namespace gd
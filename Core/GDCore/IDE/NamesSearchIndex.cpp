@@ -0,0 +1,72 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/NamesSearchIndex.h"
+
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace gd {
+
+void NamesSearchIndex::Add(const gd::String &name) {
+  names.push_back(name);
+  caseFoldedNames.push_back(name.CaseFold().Raw());
+}
+
+void NamesSearchIndex::AddVariables(
+    const gd::VariablesContainer &variablesContainer) {
+  for (std::size_t i = 0; i < variablesContainer.Count(); ++i)
+    Add(variablesContainer.GetNameAt(i));
+}
+
+void NamesSearchIndex::AddObjects(
+    const gd::ObjectsContainer &objectsContainer) {
+  for (std::size_t i = 0; i < objectsContainer.GetObjectsCount(); ++i)
+    Add(objectsContainer.GetObject(i).GetName());
+}
+
+void NamesSearchIndex::AddObjectGroups(
+    const gd::ObjectGroupsContainer &objectGroups) {
+  for (std::size_t i = 0; i < objectGroups.size(); ++i)
+    Add(objectGroups[i].GetName());
+}
+
+void NamesSearchIndex::AddResources(
+    const gd::ResourcesManager &resourcesManager) {
+  for (const auto &resource : resourcesManager.GetAllResources())
+    Add(resource->GetName());
+}
+
+void NamesSearchIndex::Clear() {
+  names.clear();
+  caseFoldedNames.clear();
+}
+
+void NamesSearchIndex::ForEachNameMatchingSearch(
+    const gd::String &search,
+    std::function<void(std::size_t index, const gd::String &name)> fn) const {
+  // UTF-8 is self-synchronizing, so the bytes of the case-folded search are
+  // only found at the start of a character of a case-folded name.
+  const std::string caseFoldedSearch = search.CaseFold().Raw();
+  for (std::size_t i = 0; i < caseFoldedNames.size(); ++i) {
+    if (caseFoldedNames[i].find(caseFoldedSearch) != std::string::npos)
+      fn(i, names[i]);
+  }
+}
+
+std::vector<gd::String> NamesSearchIndex::GetNamesMatchingSearch(
+    const gd::String &search) const {
+  std::vector<gd::String> matchingNames;
+  ForEachNameMatchingSearch(
+      search, [&matchingNames](std::size_t index, const gd::String &name) {
+        matchingNames.push_back(name);
+      });
+  return matchingNames;
+}
+
+}  // namespace gd
@@ -0,0 +1,101 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class ObjectGroupsContainer;
+class ObjectsContainer;
+class ResourcesManager;
+class VariablesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A list of names (variables, objects, groups, resources...) that can
+ * be filtered quickly by a search typed by the user.
+ *
+ * The names are case-folded once, when added, so that a search only has to
+ * case-fold the searched text, then compare bytes. Build the index once for a
+ * list and reuse it for each search (for example, at each keystroke).
+ *
+ * \see gd::String::FindCaseInsensitive
+ */
+class GD_CORE_API NamesSearchIndex {
+ public:
+  NamesSearchIndex(){};
+  virtual ~NamesSearchIndex(){};
+
+  /**
+   * \brief Add a name at the end of the index.
+   */
+  void Add(const gd::String &name);
+
+  /**
+   * \brief Add the names of the variables of the container.
+   */
+  void AddVariables(const gd::VariablesContainer &variablesContainer);
+
+  /**
+   * \brief Add the names of the objects of the container.
+   */
+  void AddObjects(const gd::ObjectsContainer &objectsContainer);
+
+  /**
+   * \brief Add the names of the groups of the container.
+   */
+  void AddObjectGroups(const gd::ObjectGroupsContainer &objectGroups);
+
+  /**
+   * \brief Add the names of the resources of the manager.
+   */
+  void AddResources(const gd::ResourcesManager &resourcesManager);
+
+  /**
+   * \brief Remove all the names.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of names in the index.
+   */
+  std::size_t GetNamesCount() const { return names.size(); }
+
+  /**
+   * \brief Return the name at the given position (in the order the names
+   * were added).
+   */
+  const gd::String &GetNameAt(std::size_t index) const {
+    return names[index];
+  }
+
+  /**
+   * \brief Call \a fn with the position and the name of each name containing
+   * \a search (ignoring the case), in the order the names were added.
+   */
+  void ForEachNameMatchingSearch(
+      const gd::String &search,
+      std::function<void(std::size_t index, const gd::String &name)> fn) const;
+
+  /**
+   * \brief Return the names containing \a search (ignoring the case), in the
+   * order they were added.
+   */
+  std::vector<gd::String> GetNamesMatchingSearch(
+      const gd::String &search) const;
+
+ private:
+  std::vector<gd::String> names;
+  std::vector<std::string> caseFoldedNames;  ///< The UTF-8 case-folded names,
+                                             ///< at the same positions.
+};
+
+}  // namespace gd
@@ -4,6 +4,9 @@
  * reserved. This project is released under the MIT License.
  */
 #include "NewNameGenerator.h"
+
+#include <unordered_set>
+
 #include "GDCore/String.h"
 
 namespace gd {
@@ -27,4 +30,51 @@ gd::String NewNameGenerator::Generate(
   return NewNameGenerator::Generate(name, "", exists);
 }
 
+std::vector<gd::String> NewNameGenerator::GenerateMany(
+    const gd::String &name,
+    std::size_t count,
+    const std::vector<gd::String> &usedNames) {
+  bool isNameUsed = false;
+  std::unordered_set<std::size_t> usedNumbers;
+  const std::string &rawName = name.Raw();
+  for (const gd::String &usedName : usedNames) {
+    const std::string &rawUsedName = usedName.Raw();
+    if (rawUsedName.size() < rawName.size() ||
+        rawUsedName.compare(0, rawName.size(), rawName) != 0)
+      continue;
+
+    if (rawUsedName.size() == rawName.size()) {
+      isNameUsed = true;
+      continue;
+    }
+
+    // Only consider the numbers that Generate would try: no leading zero,
+    // and small enough to not overflow.
+    const std::size_t digitsCount = rawUsedName.size() - rawName.size();
+    if (digitsCount > 9 || rawUsedName[rawName.size()] == '0') continue;
+
+    std::size_t number = 0;
+    bool isNumber = true;
+    for (std::size_t i = rawName.size(); i < rawUsedName.size(); ++i) {
+      const char character = rawUsedName[i];
+      if (character < '0' || character > '9') {
+        isNumber = false;
+        break;
+      }
+      number = number * 10 + (character - '0');
+    }
+    if (isNumber) usedNumbers.insert(number);
+  }
+
+  std::vector<gd::String> names;
+  names.reserve(count);
+  if (count > 0 && !isNameUsed) names.push_back(name);
+  for (std::size_t number = 2; names.size() < count; ++number) {
+    if (usedNumbers.find(number) == usedNumbers.end())
+      names.push_back(name + gd::String::From(number));
+  }
+
+  return names;
+}
+
 }  // namespace gd
@@ -6,6 +6,7 @@
 #ifndef GDCORE_NEWNAMEGENERATOR_H
 #define GDCORE_NEWNAMEGENERATOR_H
 #include <functional>
+#include <vector>
 namespace gd {
 class String;
 }
@@ -31,6 +32,21 @@ class GD_CORE_API NewNameGenerator {
   static gd::String Generate(const gd::String &name,
                              std::function<bool(const gd::String &)> exists);
 
+  /**
+   * \brief Generate \a count unique names, using the specified name as a
+   * first attempt and then the name followed by 2, 3... (skipping the used
+   * ones), like calling Generate for each name.
+   *
+   * The used names are scanned once to find the numbers already used after
+   * the name, instead of checking each attempt: use it when lots of names
+   * are generated at once (for example, when pasting lots of objects with
+   * the same name).
+   */
+  static std::vector<gd::String> GenerateMany(
+      const gd::String &name,
+      std::size_t count,
+      const std::vector<gd::String> &usedNames);
+
  private:
   NewNameGenerator();
   ~NewNameGenerator();
@@ -42,6 +42,16 @@ void ObjectAssetSerializer::SerializeTo(
     gd::Project &project, const gd::Object &object,
     const gd::String &objectFullName, SerializerElement &element,
     std::vector<gd::String> &usedResourceNames) {
+  SharedElements sharedElements;
+  SerializeTo(project, object, objectFullName, element, usedResourceNames,
+              sharedElements);
+}
+
+void ObjectAssetSerializer::SerializeTo(
+    gd::Project &project, const gd::Object &object,
+    const gd::String &objectFullName, SerializerElement &element,
+    std::vector<gd::String> &usedResourceNames,
+    SharedElements &sharedElements) {
   auto cleanObject = object.Clone();
   cleanObject->GetVariables().Clear();
   cleanObject->GetEffects().Clear();
@@ -89,7 +99,8 @@ void ObjectAssetSerializer::SerializeTo(
 
     std::unordered_set<gd::String> alreadyUsedVariantIdentifiers;
     gd::ObjectAssetSerializer::SerializeUsedVariantsTo(
-        project, object, variantsElement, alreadyUsedVariantIdentifiers);
+        project, object, variantsElement, alreadyUsedVariantIdentifiers,
+        sharedElements);
   }
 
   // TODO Find the right object dimensions when their is no variant.
@@ -107,11 +118,15 @@ void ObjectAssetSerializer::SerializeTo(
       continue;
     }
     usedResourceNames.push_back(resourceName);
-    auto &resource = resourcesManager.GetResource(resourceName);
-    SerializerElement &resourceElement = resourcesElement.AddChild("resource");
-    resource.SerializeTo(resourceElement);
-    resourceElement.SetAttribute("kind", resource.GetKind());
-    resourceElement.SetAttribute("name", resource.GetName());
+    auto &resourceElement = sharedElements["resource:" + resourceName];
+    if (!resourceElement) {
+      auto &resource = resourcesManager.GetResource(resourceName);
+      resourceElement = std::make_shared<SerializerElement>();
+      resource.SerializeTo(*resourceElement);
+      resourceElement->SetAttribute("kind", resource.GetKind());
+      resourceElement->SetAttribute("name", resource.GetName());
+    }
+    resourcesElement.AddSharedChild("resource", resourceElement);
   }
 
   SerializerElement &requiredExtensionsElement =
@@ -133,7 +148,8 @@ void ObjectAssetSerializer::SerializeTo(
 void ObjectAssetSerializer::SerializeUsedVariantsTo(
     gd::Project &project, const gd::Object &object,
     SerializerElement &variantsElement,
-    std::unordered_set<gd::String> &alreadyUsedVariantIdentifiers) {
+    std::unordered_set<gd::String> &alreadyUsedVariantIdentifiers,
+    SharedElements &sharedElements) {
   const auto *variant = ObjectAssetSerializer::GetVariant(project, object);
   if (!variant) {
     return;
@@ -145,14 +161,18 @@ void ObjectAssetSerializer::SerializeUsedVariantsTo(
   if (!insertResult.second) {
     return;
   }
-  SerializerElement &pairElement = variantsElement.AddChild("variant");
-  pairElement.SetAttribute("objectType", object.GetType());
-  SerializerElement &variantElement = pairElement.AddChild("variant");
-  variant->SerializeTo(variantElement);
+  auto &pairElement = sharedElements["variant:" + variantIdentifier];
+  if (!pairElement) {
+    pairElement = std::make_shared<SerializerElement>();
+    pairElement->SetAttribute("objectType", object.GetType());
+    variant->SerializeTo(pairElement->AddChild("variant"));
+  }
+  variantsElement.AddSharedChild("variant", pairElement);
 
   for (auto &object : variant->GetObjects().GetObjects()) {
     gd::ObjectAssetSerializer::SerializeUsedVariantsTo(
-        project, *object, variantsElement, alreadyUsedVariantIdentifiers);
+        project, *object, variantsElement, alreadyUsedVariantIdentifiers,
+        sharedElements);
   }
 }
 
@@ -184,4 +204,26 @@ ObjectAssetSerializer::GetVariant(gd::Project &project,
                             : eventsBasedObject.GetDefaultVariant();
   return &variant;
 }
+
+void ObjectAssetsPackSerializer::SerializeAssetTo(
+    const gd::Object &object, const gd::String &objectFullName,
+    const gd::Serializer::JSONSink &sink,
+    std::vector<gd::String> &usedResourceNames) {
+  SerializerElement element;
+  ObjectAssetSerializer::SerializeTo(project, object, objectFullName, element,
+                                     usedResourceNames, sharedElements);
+  gd::Serializer::ToJSON(element, sink);
+}
+
+gd::String ObjectAssetsPackSerializer::SerializeAssetToJSON(
+    const gd::Object &object, const gd::String &objectFullName,
+    std::vector<gd::String> &usedResourceNames) {
+  gd::String json;
+  SerializeAssetTo(object, objectFullName,
+                   [&json](const char *data, std::size_t size) {
+                     json.Raw().append(data, size);
+                   },
+                   usedResourceNames);
+  return json;
+}
 } // namespace gd
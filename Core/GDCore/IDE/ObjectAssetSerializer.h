@@ -5,9 +5,12 @@
  */
 #pragma once
 #include <map>
-#include <vector>
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include "GDCore/Serialization/Serializer.h"
 #include "GDCore/String.h"
 
 namespace gd {
@@ -51,16 +54,78 @@ public:
   ~ObjectAssetSerializer(){};
 
 private:
+  friend class ObjectAssetsPackSerializer;
+
+  /**
+   * The elements of the resources and the variants already serialized, by
+   * identifier, to be shared by the assets using them.
+   */
+  typedef std::unordered_map<gd::String, std::shared_ptr<SerializerElement>>
+      SharedElements;
+
   ObjectAssetSerializer(){};
 
+  static void SerializeTo(gd::Project &project, const gd::Object &object,
+                          const gd::String &objectFullName,
+                          SerializerElement &element,
+                          std::vector<gd::String> &usedResourceNames,
+                          SharedElements &sharedElements);
+
   static gd::String GetObjectExtensionName(const gd::Object &object);
 
   static void SerializeUsedVariantsTo(
       gd::Project &project, const gd::Object &object,
       SerializerElement &variantsElement,
-      std::unordered_set<gd::String> &alreadyUsedVariantIdentifiers);
+      std::unordered_set<gd::String> &alreadyUsedVariantIdentifiers,
+      SharedElements &sharedElements);
 
   static const gd::EventsBasedObjectVariant* GetVariant(gd::Project &project, const gd::Object &object);
 };
 
+/**
+ * \brief Serialize objects into the assets of an asset pack, one after the
+ * other, writing each asset as JSON.
+ *
+ * Only the element of the asset being serialized is kept in memory. The
+ * resources and the variants used by several assets are serialized once and
+ * then shared by the elements of the next assets using them.
+ *
+ * \note The project must not be modified while the assets are serialized.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ObjectAssetsPackSerializer {
+public:
+  ObjectAssetsPackSerializer(gd::Project &project_) : project(project_){};
+  virtual ~ObjectAssetsPackSerializer(){};
+
+  /**
+   * \brief Serialize an object into an asset, sending its JSON by chunks to
+   * the sink.
+   *
+   * \param object The object to serialize as an asset.
+   * \param objectFullName The object name with spaces instead of PascalCase.
+   * \param sink The function receiving the JSON of the asset.
+   * \param usedResourceNames Return the names of the resources used by the
+   * asset.
+   */
+  void SerializeAssetTo(const gd::Object &object,
+                        const gd::String &objectFullName,
+                        const gd::Serializer::JSONSink &sink,
+                        std::vector<gd::String> &usedResourceNames);
+
+  /**
+   * \brief Serialize an object into an asset and return its JSON.
+   *
+   * \see SerializeAssetTo
+   */
+  gd::String SerializeAssetToJSON(const gd::Object &object,
+                                  const gd::String &objectFullName,
+                                  std::vector<gd::String> &usedResourceNames);
+
+private:
+  gd::Project &project;
+  ObjectAssetSerializer::SharedElements sharedElements;
+};
+
 } // namespace gd
@@ -233,6 +233,8 @@ bool ResourceWorkerInEventsWorker::DoVisitInstruction(gd::Instruction& instructi
                             const gd::Expression& parameterExpression,
                             size_t parameterIndex,
                             const gd::String& lastObjectName) {
+        if (!parameterMetadata.GetValueTypeMetadata().IsResource()) return;
+
         const String& parameterValue = parameterExpression.GetPlainString();
         if (parameterMetadata.GetType() == "fontResource") {
           gd::String updatedParameterValue = parameterValue;
@@ -37,14 +37,15 @@ std::vector<gd::String> ProjectResourcesAdder::GetAllUseless(
   return unusedResources;
 }
 
-void ProjectResourcesAdder::RemoveAllUseless(gd::Project& project,
-                                             const gd::String& resourceType) {
+std::vector<gd::String> ProjectResourcesAdder::RemoveAllUseless(
+    gd::Project& project, const gd::String& resourceType) {
   std::vector<gd::String> unusedResources =
       GetAllUseless(project, resourceType);
 
-  for (std::size_t i = 0; i < unusedResources.size(); ++i) {
-    project.GetResourcesManager().RemoveResource(unusedResources[i]);
-  }
+  // Remove all of them in a single pass on the resources.
+  project.GetResourcesManager().RemoveResources(unusedResources);
+
+  return unusedResources;
 }
 
 }  // namespace gd
@@ -37,8 +37,10 @@ class GD_CORE_API ProjectResourcesAdder {
    *
    * \param project The project to be crawled.
    * \param resourceType The type of the resource the be searched
+   *
+   * \return A vector containing the name of all removed resources
    */
-  static void RemoveAllUseless(gd::Project& project, const gd::String & resourceType);
+  static std::vector<gd::String> RemoveAllUseless(gd::Project& project, const gd::String & resourceType);
 };
 
 }  // namespace gd
@@ -5,35 +5,153 @@
  */
 #include "ProjectResourcesCopier.h"
 #include <map>
+#include <set>
+#include <utility>
+#include <vector>
 #include "GDCore/CommonTools.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/Project/ResourcesAbsolutePathChecker.h"
 #include "GDCore/IDE/Project/ResourcesMergingHelper.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 #include "GDCore/IDE/ResourceExposer.h"
 
 using namespace std;
 
+namespace {
+
+/**
+ * Copy the files, logging the ones that could not be copied.
+ * \return For each file, true if it was copied.
+ */
+std::vector<bool> CopyFilesAndLogErrors(
+    gd::AbstractFileSystem& fs,
+    const std::vector<std::pair<gd::String, gd::String>>&
+        filesAndDestinations) {
+  std::vector<bool> copied = fs.CopyFiles(filesAndDestinations);
+  copied.resize(filesAndDestinations.size(), false);
+  for (std::size_t i = 0; i < filesAndDestinations.size(); ++i) {
+    if (!copied[i]) {
+      gd::LogWarning(_("Unable to copy \"") + filesAndDestinations[i].first +
+                     _("\" to \"") + filesAndDestinations[i].second +
+                     _("\"."));
+    }
+  }
+  return copied;
+}
+
+/**
+ * Copy the files that are new or changed since the last copy to the
+ * destination directory, according to the manifest stored in it, and remove
+ * the files of the last copy that are not copied anymore.
+ */
+void CopyNewOrChangedFiles(
+    gd::AbstractFileSystem& fs,
+    const gd::String& destinationDirectory,
+    const std::vector<std::pair<gd::String, gd::String>>&
+        filesAndDestinations) {
+  const gd::String manifestFile =
+      destinationDirectory + "/" +
+      gd::ProjectResourcesCopier::GetCopyManifestFilename();
+
+  // Destination of each file of the last copy, with its source and its
+  // fingerprint.
+  std::map<gd::String, std::pair<gd::String, gd::String>> previousFiles;
+  if (fs.FileExists(manifestFile)) {
+    gd::SerializerElement manifestElement =
+        gd::Serializer::FromJSON(fs.ReadFile(manifestFile));
+    gd::SerializerElement& filesElement = manifestElement.GetChild("files");
+    filesElement.ConsiderAsArrayOf("file");
+    for (std::size_t i = 0; i < filesElement.GetChildrenCount(); ++i) {
+      const gd::SerializerElement& fileElement = filesElement.GetChild(i);
+      previousFiles[fileElement.GetStringAttribute("destination")] =
+          std::make_pair(fileElement.GetStringAttribute("source"),
+                         fileElement.GetStringAttribute("fingerprint"));
+    }
+  }
+
+  std::vector<std::pair<gd::String, gd::String>> filesToCopy;
+  std::vector<gd::String> fingerprintsOfFilesToCopy;
+  gd::SerializerElement manifestElement;
+  gd::SerializerElement& filesElement = manifestElement.AddChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  auto addToManifest = [&filesElement](const gd::String& source,
+                                       const gd::String& destination,
+                                       const gd::String& fingerprint) {
+    // Files without a fingerprint are always copied again.
+    if (fingerprint.empty()) return;
+    filesElement.AddChild("file")
+        .SetStringAttribute("source", source)
+        .SetStringAttribute("destination", destination)
+        .SetStringAttribute("fingerprint", fingerprint);
+  };
+
+  for (const auto& fileAndDestination : filesAndDestinations) {
+    const gd::String& source = fileAndDestination.first;
+    const gd::String& destination = fileAndDestination.second;
+    gd::String fingerprint = fs.GetFileFingerprint(source);
+
+    auto previousFile = previousFiles.find(destination);
+    if (previousFile != previousFiles.end()) {
+      bool isUnchanged = !fingerprint.empty() &&
+                         previousFile->second.first == source &&
+                         previousFile->second.second == fingerprint;
+      previousFiles.erase(previousFile);
+      if (isUnchanged && fs.FileExists(destination)) {
+        addToManifest(source, destination, fingerprint);
+        continue;
+      }
+    }
+
+    filesToCopy.push_back(fileAndDestination);
+    fingerprintsOfFilesToCopy.push_back(fingerprint);
+  }
+
+  std::vector<bool> copied = CopyFilesAndLogErrors(fs, filesToCopy);
+  for (std::size_t i = 0; i < filesToCopy.size(); ++i) {
+    if (copied[i])
+      addToManifest(filesToCopy[i].first,
+                    filesToCopy[i].second,
+                    fingerprintsOfFilesToCopy[i]);
+  }
+
+  // Remove the files that are not used anymore.
+  for (const auto& previousFile : previousFiles)
+    fs.RemoveFile(previousFile.first);
+
+  fs.WriteToFile(manifestFile, gd::Serializer::ToJSON(manifestElement));
+}
+
+}  // namespace
+
 namespace gd {
 
+gd::String ProjectResourcesCopier::GetCopyManifestFilename() {
+  return "resources-manifest.json";
+}
+
 bool ProjectResourcesCopier::CopyAllResourcesTo(
     gd::Project& originalProject,
     AbstractFileSystem& fs,
     gd::String destinationDirectory,
     bool updateOriginalProject,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    bool onlyNewOrChangedFiles) {
   if (updateOriginalProject) {
     gd::ProjectResourcesCopier::CopyAllResourcesTo(
         originalProject, originalProject, fs, destinationDirectory,
-        preserveAbsoluteFilenames, preserveDirectoryStructure);
+        preserveAbsoluteFilenames, preserveDirectoryStructure,
+        onlyNewOrChangedFiles);
   } else {
     gd::Project clonedProject = originalProject;
     gd::ProjectResourcesCopier::CopyAllResourcesTo(
         originalProject, clonedProject, fs, destinationDirectory,
-        preserveAbsoluteFilenames, preserveDirectoryStructure);
+        preserveAbsoluteFilenames, preserveDirectoryStructure,
+        onlyNewOrChangedFiles);
   }
   return true;
 }
@@ -44,7 +162,8 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
     AbstractFileSystem& fs,
     gd::String destinationDirectory,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    bool onlyNewOrChangedFiles) {
 
   // Check if there are some resources with absolute filenames
   gd::ResourcesAbsolutePathChecker absolutePathChecker(originalProject.GetResourcesManager(), fs);
@@ -64,9 +183,12 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
   gd::ResourceExposer::ExposeWholeProjectResources(clonedProject,
                                                     resourcesMergingHelper);
 
-  // Copy resources
+  // Prepare the files to be copied, making sure their directories exist
   map<gd::String, gd::String>& resourcesNewFilename =
       resourcesMergingHelper.GetAllResourcesOldAndNewFilename();
+  std::vector<std::pair<gd::String, gd::String>> filesAndDestinations;
+  filesAndDestinations.reserve(resourcesNewFilename.size());
+  std::set<gd::String> checkedDirectories;
   for (map<gd::String, gd::String>::const_iterator it =
            resourcesNewFilename.begin();
        it != resourcesNewFilename.end();
@@ -78,16 +200,19 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
 
       // Be sure the directory exists
       gd::String dir = fs.DirNameFrom(destinationFile);
-      if (!fs.DirExists(dir)) fs.MkDir(dir);
+      if (checkedDirectories.insert(dir).second && !fs.DirExists(dir))
+        fs.MkDir(dir);
 
-      // We can now copy the file
-      if (!fs.CopyFile(it->first, destinationFile)) {
-        gd::LogWarning(_("Unable to copy \"") + it->first + _("\" to \"") +
-                       destinationFile + _("\"."));
-      }
+      filesAndDestinations.push_back(std::make_pair(it->first, destinationFile));
     }
   }
 
+  // We can now copy all the files at once
+  if (onlyNewOrChangedFiles)
+    CopyNewOrChangedFiles(fs, destinationDirectory, filesAndDestinations);
+  else
+    CopyFilesAndLogErrors(fs, filesAndDestinations);
+
   return true;
 }
 
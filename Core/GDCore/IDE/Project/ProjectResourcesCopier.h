@@ -40,6 +40,12 @@ class GD_CORE_API ProjectResourcesCopier {
    * of the resources will be preserved when copying. Otherwise, everything will
    * be send in the destinationDirectory.
    *
+   * \param onlyNewOrChangedFiles If set to true, a manifest of the copied
+   * files is kept in the destinationDirectory and only the files that are new
+   * or changed since the previous copy (according to
+   * gd::AbstractFileSystem::GetFileFingerprint) are copied. The files of the
+   * previous copy that are not used anymore are removed.
+   *
    * \return true if no error happened
    */
   static bool CopyAllResourcesTo(gd::Project& project,
@@ -47,15 +53,23 @@ class GD_CORE_API ProjectResourcesCopier {
                                  gd::String destinationDirectory,
                                  bool updateOriginalProject,
                                  bool preserveAbsoluteFilenames = true,
-                                 bool preserveDirectoryStructure = true);
+                                 bool preserveDirectoryStructure = true,
+                                 bool onlyNewOrChangedFiles = false);
+
+  /**
+   * \brief Return the name of the manifest file kept in the destination
+   * directory when only new or changed files are copied.
+   */
+  static gd::String GetCopyManifestFilename();
 
 private:
   static bool CopyAllResourcesTo(gd::Project& originalProject,
                                  gd::Project& clonedProject,
                                  gd::AbstractFileSystem& fs,
                                  gd::String destinationDirectory,
-                                 bool preserveAbsoluteFilenames = true,
-                                 bool preserveDirectoryStructure = true);
+                                 bool preserveAbsoluteFilenames,
+                                 bool preserveDirectoryStructure,
+                                 bool onlyNewOrChangedFiles);
 };
 
 }  // namespace gd
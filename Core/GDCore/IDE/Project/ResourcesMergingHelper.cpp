@@ -18,6 +18,19 @@ namespace gd {
 void ResourcesMergingHelper::ExposeFile(gd::String& resourceFilename) {
   if (resourceFilename.empty()) return;
 
+  // The new filename only depends on the original one: resolve it once.
+  auto exposedFilename = exposedFilenames.find(resourceFilename);
+  if (exposedFilename != exposedFilenames.end()) {
+    resourceFilename = exposedFilename->second;
+    return;
+  }
+
+  gd::String originalFilename = resourceFilename;
+  ResolveFilename(resourceFilename);
+  exposedFilenames.emplace(std::move(originalFilename), resourceFilename);
+}
+
+void ResourcesMergingHelper::ResolveFilename(gd::String& resourceFilename) {
   gd::String resourceFullFilename = resourceFilename;
   resourceFullFilename = gd::AbstractFileSystem::NormalizeSeparator(
       resourceFullFilename);  // Protect against \ on Linux.
@@ -61,8 +74,8 @@ void ResourcesMergingHelper::ExposeFile(gd::String& resourceFilename) {
   }
 }
 
-void ResourcesMergingHelper::SetNewFilename(gd::String oldFilename,
-                                            gd::String newFilename) {
+void ResourcesMergingHelper::SetNewFilename(const gd::String& oldFilename,
+                                            const gd::String& newFilename) {
   if (newFilenames.find(oldFilename) != newFilenames.end()) return;
 
   // Extract baseName and extension from the new filename
@@ -92,6 +105,7 @@ void ResourcesMergingHelper::SetNewFilename(gd::String oldFilename,
 void ResourcesMergingHelper::SetBaseDirectory(
     const gd::String& baseDirectory_) {
   baseDirectory = baseDirectory_;
+  exposedFilenames.clear();
 }
 
 }  // namespace gd
@@ -8,6 +8,7 @@
 
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
 #include "GDCore/String.h"
@@ -49,6 +50,7 @@ public:
    */
   void PreserveDirectoriesStructure(bool preserveDirectoriesStructure_ = true) {
     preserveDirectoriesStructure = preserveDirectoriesStructure_;
+    exposedFilenames.clear();
   };
 
   /**
@@ -56,6 +58,7 @@ public:
    */
   void PreserveAbsoluteFilenames(bool preserveAbsoluteFilenames_ = true) {
     preserveAbsoluteFilenames = preserveAbsoluteFilenames_;
+    exposedFilenames.clear();
   };
 
   /**
@@ -74,7 +77,14 @@ public:
   void ExposeFile(gd::String& resource) override;
 
  protected:
-  void SetNewFilename(gd::String oldFilename, gd::String newFilename);
+  /**
+   * Compute the new filename of a resource, and store it in the maps of
+   * filenames.
+   */
+  void ResolveFilename(gd::String& resourceFilename);
+
+  void SetNewFilename(const gd::String& oldFilename,
+                      const gd::String& newFilename);
 
   /**
    * Original file names that can be accessed by their new name.
@@ -84,6 +94,11 @@ public:
    * New file names that can be accessed by their original name.
    */
   std::map<gd::String, gd::String> newFilenames;
+  /**
+   * The filename given to resources, by the filename they had when exposed,
+   * so that a file used by many resources is only resolved once.
+   */
+  std::unordered_map<gd::String, gd::String> exposedFilenames;
   gd::String baseDirectory;
   bool preserveDirectoriesStructure;  ///< If set to true, the directory
                                       ///< structure, starting from
@@ -0,0 +1,91 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/TextureAtlasPacker.h"
+
+#include <algorithm>
+
+#include "GDCore/IDE/Project/SceneResourcesFinder.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+
+namespace gd {
+
+std::vector<TextureAtlasPacker::Atlas> TextureAtlasPacker::PackSceneImages(
+    gd::Project &project,
+    gd::Layout &layout,
+    const std::map<gd::String, std::pair<unsigned int, unsigned int>>
+        &imageSizes) const {
+  std::vector<Frame> smoothedImages;
+  std::vector<Frame> notSmoothedImages;
+  const auto &resourcesManager = project.GetResourcesManager();
+  for (const gd::String &resourceName :
+       gd::SceneResourcesFinder::FindSceneResources(project, layout)) {
+    if (!resourcesManager.HasResource(resourceName)) continue;
+    const auto *imageResource = dynamic_cast<const gd::ImageResource *>(
+        &resourcesManager.GetResource(resourceName));
+    auto sizeIt = imageSizes.find(resourceName);
+    if (!imageResource || sizeIt == imageSizes.end()) continue;
+
+    Frame image{resourceName, 0, 0, sizeIt->second.first, sizeIt->second.second};
+    (imageResource->IsSmooth() ? smoothedImages : notSmoothedImages)
+        .push_back(image);
+  }
+
+  std::vector<Atlas> atlases = Pack(smoothedImages, true);
+  std::vector<Atlas> notSmoothedAtlases = Pack(notSmoothedImages, false);
+  atlases.insert(
+      atlases.end(), notSmoothedAtlases.begin(), notSmoothedAtlases.end());
+  return atlases;
+}
+
+std::vector<TextureAtlasPacker::Atlas> TextureAtlasPacker::Pack(
+    std::vector<Frame> images, bool smoothed) const {
+  // Rows are less wasteful when the images are sorted by height. The name is
+  // used to always give the same atlases for the same images.
+  std::sort(images.begin(), images.end(), [](const Frame &a, const Frame &b) {
+    if (a.height != b.height) return a.height > b.height;
+    if (a.width != b.width) return a.width > b.width;
+    return a.resourceName < b.resourceName;
+  });
+
+  std::vector<Atlas> atlases;
+  unsigned int rowX = 0;
+  unsigned int rowY = 0;
+  unsigned int rowHeight = 0;
+  for (auto &image : images) {
+    if (image.width == 0 || image.height == 0 ||
+        image.width > maxAtlasSize || image.height > maxAtlasSize)
+      continue;
+
+    if (!atlases.empty() && rowX + image.width > maxAtlasSize) {
+      // Start a new row.
+      rowX = 0;
+      rowY += rowHeight + padding;
+      rowHeight = 0;
+    }
+    if (atlases.empty() || rowY + image.height > maxAtlasSize) {
+      atlases.push_back(Atlas{0, 0, smoothed, {}});
+      rowX = 0;
+      rowY = 0;
+      rowHeight = 0;
+    }
+
+    Atlas &atlas = atlases.back();
+    image.x = rowX;
+    image.y = rowY;
+    atlas.frames.push_back(image);
+    atlas.width = std::max(atlas.width, rowX + image.width);
+    atlas.height = std::max(atlas.height, rowY + image.height);
+
+    rowX += image.width + padding;
+    rowHeight = std::max(rowHeight, image.height);
+  }
+
+  return atlases;
+}
+
+}  // namespace gd
@@ -0,0 +1,92 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class Project;
+class Layout;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Compute how the images used by a scene can be packed into texture
+ * atlases, so that they are loaded and drawn as a few textures.
+ *
+ * Only the layout of the atlases is computed: the images must then be drawn
+ * into atlases of the given sizes, at the position of their frames, by the
+ * exporter (which can decode images).
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API TextureAtlasPacker {
+ public:
+  /**
+   * \brief The position of an image in an atlas.
+   */
+  struct Frame {
+    gd::String resourceName;
+    unsigned int x;
+    unsigned int y;
+    unsigned int width;
+    unsigned int height;
+  };
+
+  /**
+   * \brief An atlas, containing images all with or all without smoothing.
+   */
+  struct Atlas {
+    unsigned int width;
+    unsigned int height;
+    bool smoothed;
+    std::vector<Frame> frames;
+  };
+
+  /**
+   * \param maxAtlasSize The maximum width and height of an atlas.
+   * \param padding The space left between the images, to avoid bleeding when
+   * they are drawn with smoothing.
+   */
+  TextureAtlasPacker(unsigned int maxAtlasSize = 2048,
+                     unsigned int padding = 2)
+      : maxAtlasSize(maxAtlasSize), padding(padding){};
+  virtual ~TextureAtlasPacker(){};
+
+  /**
+   * \brief Pack the image resources used by the scene (see
+   * gd::SceneResourcesFinder) into atlases. Images with and without smoothing
+   * are never packed in the same atlas, as smoothing is a setting of the
+   * texture.
+   *
+   * \param imageSizes The width and height of the images, by resource name.
+   * Images with an unknown size, or too large for an atlas, are not packed.
+   */
+  std::vector<Atlas> PackSceneImages(
+      gd::Project &project,
+      gd::Layout &layout,
+      const std::map<gd::String, std::pair<unsigned int, unsigned int>>
+          &imageSizes) const;
+
+  /**
+   * \brief Pack the images (given as frames, only their name and size being
+   * used) into atlases, filled by rows of images sorted by height.
+   *
+   * \return The atlases. Images too large for an atlas are not packed.
+   */
+  std::vector<Atlas> Pack(std::vector<Frame> images, bool smoothed) const;
+
+ private:
+  unsigned int maxAtlasSize;
+  unsigned int padding;
+};
+
+}  // namespace gd
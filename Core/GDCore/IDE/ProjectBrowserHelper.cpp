@@ -5,6 +5,9 @@
  */
 #include "ProjectBrowserHelper.h"
 
+#include <vector>
+
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/IDE/EventsFunctionTools.h"
 #include "GDCore/IDE/Project/ArbitraryEventBasedBehaviorsWorker.h"
@@ -20,6 +23,7 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/TasksRunner.h"
 #include "GDCore/IDE/DependenciesAnalyzer.h"
 
 namespace gd {
@@ -55,6 +59,60 @@ void ProjectBrowserHelper::ExposeProjectEvents(
   }
 }
 
+void ProjectBrowserHelper::ExposeProjectEventsInParallel(
+    gd::Project &project,
+    const std::function<std::unique_ptr<gd::ArbitraryEventsWorkerWithContext>()>
+        &createWorker,
+    const std::function<void(gd::ArbitraryEventsWorkerWithContext &worker)>
+        &mergeWorker,
+    std::size_t threadsCount) {
+  // Everything lazily built when read must be built before the threads are
+  // started: the layouts (if the project was lazily unserialized), the lazy
+  // extensions and the metadata indexes of the platforms.
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); i++)
+    project.GetLayout(i);
+  for (const gd::Platform *platform : project.GetUsedPlatforms())
+    platform->PrepareForConcurrentUse();
+
+  const std::size_t layoutsCount = project.GetLayoutsCount();
+  const std::size_t externalEventsCount = project.GetExternalEventsCount();
+  const std::size_t unitsCount = layoutsCount + externalEventsCount +
+                                 project.GetEventsFunctionsExtensionsCount();
+
+  // Workers are created on the calling thread, so that createWorker doesn't
+  // have to be thread safe.
+  std::vector<std::unique_ptr<gd::ArbitraryEventsWorkerWithContext>> workers;
+  for (std::size_t i = 0; i < unitsCount; i++)
+    workers.push_back(createWorker());
+
+  gd::TasksRunner::Run(unitsCount, threadsCount, [&](std::size_t index) {
+    gd::ArbitraryEventsWorkerWithContext *worker = workers[index].get();
+    if (index < layoutsCount) {
+      auto &layout = project.GetLayout(index);
+      auto projectScopedContainers = gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+      worker->Launch(layout.GetEvents(), projectScopedContainers);
+    } else if (index < layoutsCount + externalEventsCount) {
+      auto &externalEvents = project.GetExternalEvents(index - layoutsCount);
+      const gd::String &associatedLayout = externalEvents.GetAssociatedLayout();
+      if (project.HasLayoutNamed(associatedLayout)) {
+        auto projectScopedContainers = gd::ProjectScopedContainers::
+            MakeNewProjectScopedContainersForProjectAndLayout(
+                project, project.GetLayout(associatedLayout));
+        worker->Launch(externalEvents.GetEvents(), projectScopedContainers);
+      }
+    } else {
+      ExposeEventsFunctionsExtensionEvents(
+          project,
+          project.GetEventsFunctionsExtension(index - layoutsCount -
+                                              externalEventsCount),
+          *worker);
+    }
+  });
+
+  for (auto &worker : workers) mergeWorker(*worker);
+}
+
 void ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(
     gd::Project& project, gd::ArbitraryEventsWorker& worker) {
   // Add layouts events
@@ -5,6 +5,10 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+
 namespace gd {
 class Project;
 class Layout;
@@ -47,6 +51,36 @@ public:
   static void ExposeProjectEvents(gd::Project &project,
                                   gd::ArbitraryEventsWorkerWithContext &worker);
 
+  /**
+   * \brief Call workers on all events of the project, like
+   * ExposeProjectEvents, using several threads.
+   *
+   * The events are split in units: the events of each layout, of each
+   * external events and of each extension. Each unit is browsed by the first
+   * available thread, with its own worker returned by \a createWorker (called
+   * on the calling thread for every unit, before the units are browsed).
+   * \a mergeWorker is then called on the calling thread with the worker of
+   * each unit, in the order used by ExposeProjectEvents, to gather the results
+   * of the workers.
+   *
+   * \param threadsCount The number of threads to use. 0 means as many as the
+   * hardware can run concurrently.
+   *
+   * \note Workers must not modify the events nor the project, which must not
+   * be modified by another thread while it's browsed. Workers run at the same
+   * time, so they must not share any state that is not thread safe. Threads
+   * are not used when GDCore is built with Emscripten without threads support.
+   *
+   * \see gd::TasksRunner
+   */
+  static void ExposeProjectEventsInParallel(
+      gd::Project &project,
+      const std::function<std::unique_ptr<gd::ArbitraryEventsWorkerWithContext>()>
+          &createWorker,
+      const std::function<void(gd::ArbitraryEventsWorkerWithContext &worker)>
+          &mergeWorker,
+      std::size_t threadsCount = 0);
+
   /**
    * \brief Call the specified worker on all events of the project (layout and
    * external events) but not events from extensions.
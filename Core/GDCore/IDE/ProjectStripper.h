@@ -25,6 +25,9 @@ class GD_CORE_API ProjectStripper {
    * Objects groups are deleted as well as all events.
    *
    * \param project The project to be stripped.
+   *
+   * \see gd::Project::SerializeForExportTo to serialize a project as if it
+   * was stripped, without having to copy it.
    */
   static void StripProjectForExport(gd::Project& project);
 
@@ -14,28 +14,25 @@ SceneNameMangler *SceneNameMangler::_singleton = nullptr;
 
 const gd::String &SceneNameMangler::GetMangledSceneName(
     const gd::String &sceneName) {
+  std::lock_guard<std::mutex> lock(mutex);
   auto it = mangledSceneNames.find(sceneName);
   if (it != mangledSceneNames.end()) {
     return it->second;
   }
 
-  gd::String partiallyMangledName = sceneName;
-  static const gd::String alwaysAllowedCharacters =
-      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
-  static const gd::String allowedExceptFirstCharacters = "0123456789";
-
-  for (size_t i = 0; i < partiallyMangledName.size();
-       ++i)  // Replace all unallowed letter by an underscore and the unicode
-             // code point of the letter
-  {
-    if (alwaysAllowedCharacters.find_first_of(
-            std::u32string(1, partiallyMangledName[i])) == gd::String::npos &&
-        (i == 0 ||
-         allowedExceptFirstCharacters.find(
-             std::u32string(1, partiallyMangledName[i])) == gd::String::npos)) {
-      char32_t unallowedChar = partiallyMangledName[i];
-      partiallyMangledName.replace(i, 1, "_" + gd::String::From(unallowedChar));
-    }
+  // Replace all unallowed letter by an underscore and the unicode code point
+  // of the letter, in a single pass on the name.
+  gd::String partiallyMangledName;
+  partiallyMangledName.Raw().reserve(sceneName.Raw().size());
+  bool isFirstCharacter = true;
+  for (char32_t character : sceneName) {
+    if ((character >= 'a' && character <= 'z') ||
+        (character >= 'A' && character <= 'Z') ||
+        (!isFirstCharacter && character >= '0' && character <= '9'))
+      partiallyMangledName.push_back(character);
+    else
+      partiallyMangledName += "_" + gd::String::From(character);
+    isFirstCharacter = false;
   }
 
   mangledSceneNames[sceneName] = partiallyMangledName;
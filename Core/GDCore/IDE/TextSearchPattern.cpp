@@ -0,0 +1,75 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/TextSearchPattern.h"
+
+namespace gd {
+
+namespace {
+bool IsAscii(const std::string &text) {
+  for (char c : text) {
+    if (static_cast<unsigned char>(c) >= 0x80) return false;
+  }
+  return true;
+}
+
+// Case folding of ASCII characters only changes uppercase letters.
+char ToAsciiCaseFolded(char c) {
+  return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+}  // namespace
+
+TextSearchPattern::TextSearchPattern(const gd::String &search_,
+                                     bool matchCase_)
+    : search(search_),
+      matchCase(matchCase_),
+      pattern(matchCase_ ? search_.Raw() : search_.CaseFold().Raw()),
+      isAsciiPattern(IsAscii(pattern)) {
+  for (std::size_t i = 0; i < 256; ++i) shifts[i] = pattern.size();
+  for (std::size_t i = 0; i + 1 < pattern.size(); ++i)
+    shifts[static_cast<unsigned char>(pattern[i])] = pattern.size() - 1 - i;
+}
+
+template <class Converter>
+bool TextSearchPattern::IsFoundIn(const std::string &text,
+                                  Converter convert) const {
+  const std::size_t patternSize = pattern.size();
+  if (patternSize == 0) return true;
+  if (patternSize > text.size()) return false;
+
+  std::size_t position = 0;
+  while (position <= text.size() - patternSize) {
+    std::size_t i = patternSize - 1;
+    while (convert(text[position + i]) == pattern[i]) {
+      if (i == 0) return true;
+      --i;
+    }
+
+    position += shifts[static_cast<unsigned char>(
+        convert(text[position + patternSize - 1]))];
+  }
+
+  return false;
+}
+
+bool TextSearchPattern::IsFoundIn(const gd::String &text) const {
+  // Like gd::String::find, nothing (not even an empty text) is found in an
+  // empty string.
+  if (text.empty()) return false;
+
+  // UTF-8 is self-synchronizing, so the bytes of the pattern are only found at
+  // the start of a character of the text.
+  if (matchCase) return IsFoundIn(text.Raw(), [](char c) { return c; });
+
+  // ASCII characters are case-folded to ASCII characters, so the
+  // case-folded text is only needed if it has other characters.
+  if (IsAscii(text.Raw())) {
+    return isAsciiPattern && IsFoundIn(text.Raw(), ToAsciiCaseFolded);
+  }
+
+  return IsFoundIn(text.CaseFold().Raw(), [](char c) { return c; });
+}
+
+}  // namespace gd
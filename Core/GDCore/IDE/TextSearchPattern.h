@@ -0,0 +1,68 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A text searched by the user, prepared once to be searched in a lot
+ * of strings (for example, all the parameters of the events of a project).
+ *
+ * The searched text is case-folded once (if the case is ignored), and the
+ * strings are searched with the Boyer-Moore-Horspool algorithm. Strings
+ * containing only ASCII characters are searched without being case-folded.
+ *
+ * \see gd::String::FindCaseInsensitive
+ */
+class GD_CORE_API TextSearchPattern {
+ public:
+  /**
+   * \brief Prepare the search of \a search, with the same case (if
+   * \a matchCase is true) or ignoring the case.
+   */
+  TextSearchPattern(const gd::String &search, bool matchCase);
+  virtual ~TextSearchPattern(){};
+
+  /**
+   * \brief Return the searched text, as given to the constructor.
+   */
+  const gd::String &GetSearch() const { return search; }
+
+  /**
+   * \brief Return true if the case must be the same for the text to be found.
+   */
+  bool IsMatchingCase() const { return matchCase; }
+
+  /**
+   * \brief Return true if the searched text is in \a text.
+   *
+   * This gives the same result as `text.find(search)` (or
+   * `text.FindCaseInsensitive(search)`) not returning gd::String::npos.
+   */
+  bool IsFoundIn(const gd::String &text) const;
+
+ private:
+  /**
+   * \brief Search the pattern in \a text, converting each character of
+   * \a text with \a convert before comparing it.
+   */
+  template <class Converter>
+  bool IsFoundIn(const std::string &text, Converter convert) const;
+
+  gd::String search;
+  bool matchCase;
+  std::string pattern;  ///< The UTF-8 searched text, case-folded if the case
+                        ///< is ignored.
+  bool isAsciiPattern;
+  std::size_t shifts[256];  ///< The Boyer-Moore-Horspool shifts, by byte.
+};
+
+}  // namespace gd
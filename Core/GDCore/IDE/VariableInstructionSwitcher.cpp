@@ -199,7 +199,8 @@ const gd::Variable::Type
 VariableInstructionSwitcher::GetVariableTypeFromParameters(
     const gd::Platform &platform,
     const gd::ProjectScopedContainers &projectScopedContainers,
-    const gd::Instruction &instruction) {
+    const gd::Instruction &instruction,
+    gd::VariablePathsCache *variablePathsCache) {
   if (instruction.GetParametersCount() < 2 ||
       !gd::VariableInstructionSwitcher::IsSwitchableVariableInstruction(
           instruction.GetType())) {
@@ -215,23 +216,28 @@ VariableInstructionSwitcher::GetVariableTypeFromParameters(
   auto &variableExpressionNode =
       *instruction.GetParameter(variableParameterIndex).GetRootNode();
 
-  auto variableType = gd::ExpressionVariablePathFinder::GetVariableType(
-      platform, projectScopedContainers, variableExpressionNode, objectName);
-  return variableType == gd::Variable::Type::Array
-             ? // "Push" actions need the child type to be able to switch.
-             gd::ExpressionVariablePathFinder::GetArrayVariableType(
-                 platform, projectScopedContainers, variableExpressionNode,
-                 objectName)
-             : variableType;
+  const gd::Variable *variable = gd::ExpressionVariablePathFinder::GetVariable(
+      platform, projectScopedContainers, variableExpressionNode, objectName,
+      variablePathsCache);
+  if (!variable) {
+    return gd::Variable::Type::Unknown;
+  }
+  if (variable->GetType() != gd::Variable::Type::Array) {
+    return variable->GetType();
+  }
+  // "Push" actions need the child type to be able to switch.
+  return variable->GetChildrenCount() > 0 ? variable->GetAtIndex(0).GetType()
+                                          : gd::Variable::Type::Unknown;
 }
 
 void VariableInstructionSwitcher::SwitchBetweenUnifiedInstructionIfNeeded(
     const gd::Platform &platform,
     const gd::ProjectScopedContainers &projectScopedContainers,
-    gd::Instruction &instruction) {
+    gd::Instruction &instruction,
+    gd::VariablePathsCache *variablePathsCache) {
   const auto variableType =
       gd::VariableInstructionSwitcher::GetVariableTypeFromParameters(
-          platform, projectScopedContainers, instruction);
+          platform, projectScopedContainers, instruction, variablePathsCache);
   if (variableType != gd::Variable::Type::Unknown) {
     gd::VariableInstructionSwitcher::SwitchVariableInstructionType(
         instruction, variableType);
@@ -11,6 +11,7 @@ namespace gd {
 class Instruction;
 class Platform;
 class ProjectScopedContainers;
+class VariablePathsCache;
 } // namespace gd
 
 namespace gd {
@@ -64,11 +65,15 @@ public:
 
   /**
    * \brief Return the variable type of the instruction parameter.
+   *
+   * \param variablePathsCache An optional cache of the variables found, to be
+   * shared by instructions using the same variables containers.
    */
   static const gd::Variable::Type GetVariableTypeFromParameters(
       const gd::Platform &platform,
       const gd::ProjectScopedContainers &projectScopedContainers,
-      const gd::Instruction &instruction);
+      const gd::Instruction &instruction,
+      gd::VariablePathsCache *variablePathsCache = nullptr);
 
   /**
    * \brief Modify the instruction type to match the variable type of the
@@ -77,7 +82,8 @@ public:
   static void SwitchBetweenUnifiedInstructionIfNeeded(
       const gd::Platform &platform,
       const gd::ProjectScopedContainers &projectScopedContainers,
-      gd::Instruction &instruction);
+      gd::Instruction &instruction,
+      gd::VariablePathsCache *variablePathsCache = nullptr);
 
 private:
   static const gd::String variableGetterIdentifier;
@@ -15,6 +15,7 @@
 #include "GDCore/IDE/EventBasedBehaviorBrowser.h"
 #include "GDCore/IDE/EventBasedObjectBrowser.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersBatch.h"
 #include "GDCore/IDE/Events/BehaviorParametersFiller.h"
 #include "GDCore/IDE/Events/BehaviorTypeRenamer.h"
 #include "GDCore/IDE/Events/CustomObjectTypeRenamer.h"
@@ -55,6 +56,7 @@
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/PerfScope.h"
 
 namespace gd {
 
@@ -156,58 +158,62 @@ WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
     return changeset;
   }
 
-  std::unordered_map<gd::String, gd::String> removedUuidAndNames;
+  // Old variables are found by their position, rather than by their name
+  // which would need another search in the container.
+  std::unordered_map<gd::String, std::size_t> removedUuidAndPositions;
   for (std::size_t i = 0; i < oldVariablesContainer.Count(); ++i) {
     const auto &variable = oldVariablesContainer.Get(i);
-    const auto &variableName = oldVariablesContainer.GetNameAt(i);
 
     // All variables are candidate to be removed.
-    removedUuidAndNames[variable.GetPersistentUuid()] = variableName;
+    removedUuidAndPositions[variable.GetPersistentUuid()] = i;
   }
   for (std::size_t i = 0; i < newVariablesContainer.Count(); ++i) {
     const auto &variable = newVariablesContainer.Get(i);
     const auto &variableName = newVariablesContainer.GetNameAt(i);
 
-    auto existingOldVariableUuidAndName =
-        removedUuidAndNames.find(variable.GetPersistentUuid());
-    if (existingOldVariableUuidAndName == removedUuidAndNames.end()) {
+    auto existingOldVariableUuidAndPosition =
+        removedUuidAndPositions.find(variable.GetPersistentUuid());
+    if (existingOldVariableUuidAndPosition == removedUuidAndPositions.end()) {
       // This is a new variable.
       changeset.addedVariableNames.insert(variableName);
     } else {
-      const gd::String &oldName = existingOldVariableUuidAndName->second;
+      const std::size_t oldPosition =
+          existingOldVariableUuidAndPosition->second;
+      const gd::String &oldName = oldVariablesContainer.GetNameAt(oldPosition);
 
       if (oldName != variableName) {
         // This is a renamed variable.
         changeset.oldToNewVariableNames[oldName] = variableName;
       }
 
-      const auto &oldVariable = oldVariablesContainer.Get(oldName);
-      if (gd::WholeProjectRefactorer::HasAnyVariableTypeChanged(oldVariable,
-                                                                variable)) {
-        changeset.typeChangedVariableNames.insert(variableName);
-      }
+      const auto &oldVariable = oldVariablesContainer.Get(oldPosition);
       if (oldVariable != variable
         // Mixed values are never equals, but they must not override anything.
         && !variable.HasMixedValues()) {
         changeset.valueChangedVariableNames.insert(variableName);
       }
 
+      bool hasAnyVariableTypeChanged = false;
       const auto &variablesRenamingChangesetNode =
-          gd::WholeProjectRefactorer::ComputeChangesetForVariable(oldVariable,
-                                                                  variable);
+          gd::WholeProjectRefactorer::ComputeChangesetForVariable(
+              oldVariable, variable, hasAnyVariableTypeChanged);
 
+      if (hasAnyVariableTypeChanged) {
+        changeset.typeChangedVariableNames.insert(variableName);
+      }
       if (variablesRenamingChangesetNode) {
         changeset.modifiedVariables[oldName] =
             std::move(variablesRenamingChangesetNode);
       }
 
       // Renamed or not, this is not a removed variable.
-      removedUuidAndNames.erase(variable.GetPersistentUuid());
+      removedUuidAndPositions.erase(existingOldVariableUuidAndPosition);
     }
   }
 
-  for (const auto &removedUuidAndName : removedUuidAndNames) {
-    changeset.removedVariableNames.insert(removedUuidAndName.second);
+  for (const auto &removedUuidAndPosition : removedUuidAndPositions) {
+    changeset.removedVariableNames.insert(
+        oldVariablesContainer.GetNameAt(removedUuidAndPosition.second));
   }
 
   return changeset;
@@ -215,20 +221,26 @@ WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
 
 std::shared_ptr<VariablesRenamingChangesetNode>
 WholeProjectRefactorer::ComputeChangesetForVariable(
-    const gd::Variable &oldVariable, const gd::Variable &newVariable) {
+    const gd::Variable &oldVariable,
+    const gd::Variable &newVariable,
+    bool &hasAnyVariableTypeChanged) {
+  if (newVariable.GetType() != oldVariable.GetType()) {
+    hasAnyVariableTypeChanged = true;
+  }
 
   if (newVariable.GetChildrenCount() == 0 ||
       oldVariable.GetChildrenCount() == 0) {
     return std::shared_ptr<VariablesRenamingChangesetNode>(nullptr);
   }
 
-  std::unordered_map<gd::String, gd::String> oldVariableNamesByUuid;
+  // Old children are stored with their name, to avoid searching them again.
+  std::unordered_map<gd::String,
+                     const std::pair<const gd::String,
+                                     std::shared_ptr<gd::Variable>> *>
+      oldChildrenByUuid;
   for (const auto &pair : oldVariable.GetAllChildren()) {
-    const auto &oldName = pair.first;
-    const auto oldChild = pair.second;
-
     // All variables are candidate to be removed.
-    oldVariableNamesByUuid[oldChild->GetPersistentUuid()] = oldName;
+    oldChildrenByUuid[pair.second->GetPersistentUuid()] = &pair;
   }
 
   auto changeset = std::make_shared<VariablesRenamingChangesetNode>();
@@ -236,14 +248,14 @@ WholeProjectRefactorer::ComputeChangesetForVariable(
     const auto &newName = pair.first;
     const auto newChild = pair.second;
 
-    auto existingOldVariableUuidAndName =
-        oldVariableNamesByUuid.find(newChild->GetPersistentUuid());
-    if (existingOldVariableUuidAndName == oldVariableNamesByUuid.end()) {
+    auto existingOldChild =
+        oldChildrenByUuid.find(newChild->GetPersistentUuid());
+    if (existingOldChild == oldChildrenByUuid.end()) {
       // This is a new variable.
       continue;
     }
-    const gd::String &oldName = existingOldVariableUuidAndName->second;
-    const auto &oldChild = oldVariable.GetChild(oldName);
+    const gd::String &oldName = existingOldChild->second->first;
+    const auto &oldChild = *existingOldChild->second->second;
 
     if (oldName != newName) {
       // This is a renamed child.
@@ -251,8 +263,8 @@ WholeProjectRefactorer::ComputeChangesetForVariable(
     }
 
     const auto &childChangeset =
-        gd::WholeProjectRefactorer::ComputeChangesetForVariable(oldChild,
-                                                                *newChild);
+        gd::WholeProjectRefactorer::ComputeChangesetForVariable(
+            oldChild, *newChild, hasAnyVariableTypeChanged);
     if (childChangeset) {
       changeset->modifiedVariables[oldName] = std::move(childChangeset);
     }
@@ -264,47 +276,6 @@ WholeProjectRefactorer::ComputeChangesetForVariable(
   return std::move(changeset);
 };
 
-bool WholeProjectRefactorer::HasAnyVariableTypeChanged(
-    const gd::Variable &oldVariable, const gd::Variable &newVariable) {
-  if (newVariable.GetType() != oldVariable.GetType()) {
-    return true;
-  }
-
-  if (newVariable.GetChildrenCount() == 0 ||
-      oldVariable.GetChildrenCount() == 0) {
-    return false;
-  }
-
-  std::unordered_map<gd::String, gd::String> oldVariableNamesByUuid;
-  for (const auto &pair : oldVariable.GetAllChildren()) {
-    const auto &oldName = pair.first;
-    const auto oldChild = pair.second;
-
-    // All variables are candidate to be removed.
-    oldVariableNamesByUuid[oldChild->GetPersistentUuid()] = oldName;
-  }
-
-  for (const auto &pair : newVariable.GetAllChildren()) {
-    const auto &newName = pair.first;
-    const auto newChild = pair.second;
-
-    auto existingOldVariableUuidAndName =
-        oldVariableNamesByUuid.find(newChild->GetPersistentUuid());
-    if (existingOldVariableUuidAndName == oldVariableNamesByUuid.end()) {
-      // This is a new variable.
-      continue;
-    }
-    const gd::String &oldName = existingOldVariableUuidAndName->second;
-    const auto &oldChild = oldVariable.GetChild(oldName);
-
-    if (gd::WholeProjectRefactorer::HasAnyVariableTypeChanged(oldChild,
-                                                              *newChild)) {
-      return true;
-    }
-  }
-  return false;
-}
-
 void WholeProjectRefactorer::ApplyRefactoringForVariablesContainer(
     gd::Project &project, gd::VariablesContainer &variablesContainer,
     const gd::VariablesChangeset &changeset,
@@ -473,6 +444,8 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::String &oldName, const gd::String &newName,
     const gd::ProjectBrowser &projectBrowser) {
+  gd::PerfScope perfScope(
+      "WholeProjectRefactorer::RenameEventsFunctionsExtension");
   auto renameEventsFunction = [&project, &oldName, &newName, &projectBrowser](
                                   const gd::EventsFunction &eventsFunction) {
     DoRenameEventsFunction(project, eventsFunction,
@@ -726,6 +699,7 @@ void WholeProjectRefactorer::RenameEventsFunction(
     gd::Project &project,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::String &oldFunctionName, const gd::String &newFunctionName) {
+  gd::PerfScope perfScope("WholeProjectRefactorer::RenameEventsFunction");
   const auto &eventsFunctions = eventsFunctionsExtension.GetEventsFunctions();
   if (!eventsFunctions.HasEventsFunctionNamed(oldFunctionName))
     return;
@@ -759,6 +733,8 @@ void WholeProjectRefactorer::RenameBehaviorEventsFunction(
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::EventsBasedBehavior &eventsBasedBehavior,
     const gd::String &oldFunctionName, const gd::String &newFunctionName) {
+  gd::PerfScope perfScope(
+      "WholeProjectRefactorer::RenameBehaviorEventsFunction");
   auto &eventsFunctions = eventsBasedBehavior.GetEventsFunctions();
   if (!eventsFunctions.HasEventsFunctionNamed(oldFunctionName))
     return;
@@ -766,29 +742,29 @@ void WholeProjectRefactorer::RenameBehaviorEventsFunction(
   const gd::EventsFunction &eventsFunction =
       eventsFunctions.GetEventsFunction(oldFunctionName);
 
-  // Order is important: we first rename the expressions then the instructions,
-  // to avoid being unable to fetch the metadata (the types of parameters) of
-  // instructions after they are renamed.
-  if (eventsFunction.IsExpression()) {
-    gd::ExpressionsRenamer renamer =
-        gd::ExpressionsRenamer(project.GetCurrentPlatform());
-    renamer.SetReplacedBehaviorExpression(
-        gd::PlatformExtension::GetBehaviorFullType(
-            eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName()),
-        oldFunctionName, newFunctionName);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
-  }
-  if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-    gd::InstructionsTypeRenamer renamer = gd::InstructionsTypeRenamer(
-        project,
-        gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
-            eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
-            oldFunctionName),
-        gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
-            eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
-            newFunctionName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
-  }
+  // Order is important: we first rename the expressions then the instructions
+  // (the batch gives each instruction to the renamers in the order they are
+  // added), to avoid being unable to fetch the metadata (the types of
+  // parameters) of instructions after they are renamed.
+  gd::ExpressionsRenamer expressionRenamer(project.GetCurrentPlatform());
+  expressionRenamer.SetReplacedBehaviorExpression(
+      gd::PlatformExtension::GetBehaviorFullType(
+          eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName()),
+      oldFunctionName, newFunctionName);
+  gd::InstructionsTypeRenamer instructionRenamer = gd::InstructionsTypeRenamer(
+      project,
+      gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
+          eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
+          oldFunctionName),
+      gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
+          eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
+          newFunctionName));
+  gd::ArbitraryEventsWorkersBatch renamers;
+  if (eventsFunction.IsExpression()) renamers.AddWorker(expressionRenamer);
+  if (eventsFunction.IsAction() || eventsFunction.IsCondition())
+    renamers.AddWorker(instructionRenamer);
+  if (renamers.GetWorkersCount() > 0)
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
   if (eventsFunction.GetFunctionType() ==
       gd::EventsFunction::ExpressionAndCondition) {
     for (auto &&otherFunction :
@@ -807,6 +783,7 @@ void WholeProjectRefactorer::RenameObjectEventsFunction(
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::EventsBasedObject &eventsBasedObject,
     const gd::String &oldFunctionName, const gd::String &newFunctionName) {
+  gd::PerfScope perfScope("WholeProjectRefactorer::RenameObjectEventsFunction");
   auto &eventsFunctions = eventsBasedObject.GetEventsFunctions();
   if (!eventsFunctions.HasEventsFunctionNamed(oldFunctionName))
     return;
@@ -814,26 +791,25 @@ void WholeProjectRefactorer::RenameObjectEventsFunction(
   const gd::EventsFunction &eventsFunction =
       eventsFunctions.GetEventsFunction(oldFunctionName);
 
-  if (eventsFunction.IsExpression()) {
-    gd::ExpressionsRenamer renamer =
-        gd::ExpressionsRenamer(project.GetCurrentPlatform());
-    renamer.SetReplacedObjectExpression(
-        gd::PlatformExtension::GetObjectFullType(
-            eventsFunctionsExtension.GetName(), eventsBasedObject.GetName()),
-        oldFunctionName, newFunctionName);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
-  }
-  if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-    gd::InstructionsTypeRenamer renamer = gd::InstructionsTypeRenamer(
-        project,
-        gd::PlatformExtension::GetObjectEventsFunctionFullType(
-            eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
-            oldFunctionName),
-        gd::PlatformExtension::GetObjectEventsFunctionFullType(
-            eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
-            newFunctionName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
-  }
+  gd::ExpressionsRenamer expressionRenamer(project.GetCurrentPlatform());
+  expressionRenamer.SetReplacedObjectExpression(
+      gd::PlatformExtension::GetObjectFullType(
+          eventsFunctionsExtension.GetName(), eventsBasedObject.GetName()),
+      oldFunctionName, newFunctionName);
+  gd::InstructionsTypeRenamer instructionRenamer = gd::InstructionsTypeRenamer(
+      project,
+      gd::PlatformExtension::GetObjectEventsFunctionFullType(
+          eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
+          oldFunctionName),
+      gd::PlatformExtension::GetObjectEventsFunctionFullType(
+          eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
+          newFunctionName));
+  gd::ArbitraryEventsWorkersBatch renamers;
+  if (eventsFunction.IsExpression()) renamers.AddWorker(expressionRenamer);
+  if (eventsFunction.IsAction() || eventsFunction.IsCondition())
+    renamers.AddWorker(instructionRenamer);
+  if (renamers.GetWorkersCount() > 0)
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
   if (eventsFunction.GetFunctionType() ==
       gd::EventsFunction::ExpressionAndCondition) {
     for (auto &&otherFunction :
@@ -926,8 +902,7 @@ void WholeProjectRefactorer::MoveEventsFunctionParameter(
           eventsFunctionsExtension.GetName(), functionName);
 
   if (eventsFunction.IsExpression()) {
-    gd::ExpressionsParameterMover mover =
-        gd::ExpressionsParameterMover(project.GetCurrentPlatform());
+    gd::ExpressionsParameterMover mover(project.GetCurrentPlatform());
     mover.SetFreeExpressionMovedParameter(eventsFunctionType, oldIndex,
                                           newIndex);
     gd::ProjectBrowserHelper::ExposeProjectEvents(project, mover);
@@ -960,8 +935,7 @@ void WholeProjectRefactorer::MoveBehaviorEventsFunctionParameter(
           functionName);
 
   if (eventsFunction.IsExpression()) {
-    gd::ExpressionsParameterMover mover =
-        gd::ExpressionsParameterMover(project.GetCurrentPlatform());
+    gd::ExpressionsParameterMover mover(project.GetCurrentPlatform());
     mover.SetBehaviorExpressionMovedParameter(
         gd::PlatformExtension::GetBehaviorFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName()),
@@ -996,8 +970,7 @@ void WholeProjectRefactorer::MoveObjectEventsFunctionParameter(
           functionName);
 
   if (eventsFunction.IsExpression()) {
-    gd::ExpressionsParameterMover mover =
-        gd::ExpressionsParameterMover(project.GetCurrentPlatform());
+    gd::ExpressionsParameterMover mover(project.GetCurrentPlatform());
     mover.SetObjectExpressionMovedParameter(
         gd::PlatformExtension::GetObjectFullType(
             eventsFunctionsExtension.GetName(), eventsBasedObject.GetName()),
@@ -1042,18 +1015,17 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
     // their related actions/conditions/expressions. Rename these.
 
     // Order is important: we first rename the expressions then the
-    // instructions, to avoid being unable to fetch the metadata (the types of
-    // parameters) of instructions after they are renamed.
+    // instructions (the batch gives each instruction to the renamers in the
+    // order they are added), to avoid being unable to fetch the metadata (the
+    // types of parameters) of instructions after they are renamed.
 
     // Rename legacy expressions like: Object.Behavior::PropertyMyPropertyName()
-    gd::ExpressionsRenamer expressionRenamer =
-        gd::ExpressionsRenamer(project.GetCurrentPlatform());
+    gd::ExpressionsRenamer expressionRenamer(project.GetCurrentPlatform());
     expressionRenamer.SetReplacedBehaviorExpression(
         gd::PlatformExtension::GetBehaviorFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName()),
         EventsBasedBehavior::GetPropertyExpressionName(oldPropertyName),
         EventsBasedBehavior::GetPropertyExpressionName(newPropertyName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
 
     // Rename property names directly used as an identifier.
     std::unordered_map<gd::String, gd::String> oldToNewPropertyNames = {
@@ -1074,7 +1046,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetPropertyActionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
     gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
         project,
@@ -1084,7 +1055,11 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetPropertyConditionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+    gd::ArbitraryEventsWorkersBatch renamers;
+    renamers.AddWorker(expressionRenamer)
+        .AddWorker(actionRenamer)
+        .AddWorker(conditionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
   }
 }
 
@@ -1117,18 +1092,17 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
     // their related actions/conditions/expressions. Rename these.
 
     // Order is important: we first rename the expressions then the
-    // instructions, to avoid being unable to fetch the metadata (the types of
-    // parameters) of instructions after they are renamed.
+    // instructions (the batch gives each instruction to the renamers in the
+    // order they are added), to avoid being unable to fetch the metadata (the
+    // types of parameters) of instructions after they are renamed.
 
     // Rename legacy expressions like: Object.Behavior::SharedPropertyMyPropertyName()
-    gd::ExpressionsRenamer expressionRenamer =
-        gd::ExpressionsRenamer(project.GetCurrentPlatform());
+    gd::ExpressionsRenamer expressionRenamer(project.GetCurrentPlatform());
     expressionRenamer.SetReplacedBehaviorExpression(
         gd::PlatformExtension::GetBehaviorFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName()),
         EventsBasedBehavior::GetSharedPropertyExpressionName(oldPropertyName),
         EventsBasedBehavior::GetSharedPropertyExpressionName(newPropertyName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
 
     // Rename property names directly used as an identifier.
     std::unordered_map<gd::String, gd::String> oldToNewPropertyNames = {
@@ -1149,7 +1123,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetSharedPropertyActionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
     gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
         project,
@@ -1161,7 +1134,11 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetSharedPropertyConditionName(
                 newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+    gd::ArbitraryEventsWorkersBatch renamers;
+    renamers.AddWorker(expressionRenamer)
+        .AddWorker(actionRenamer)
+        .AddWorker(conditionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
   }
 }
 
@@ -1178,18 +1155,17 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
   // their related actions/conditions/expressions. Rename these.
 
   // Order is important: we first rename the expressions then the
-  // instructions, to avoid being unable to fetch the metadata (the types of
-  // parameters) of instructions after they are renamed.
+  // instructions (the batch gives each instruction to the renamers in the
+  // order they are added), to avoid being unable to fetch the metadata (the
+  // types of parameters) of instructions after they are renamed.
 
   // Rename legacy expressions like: Object.PropertyMyPropertyName()
-  gd::ExpressionsRenamer expressionRenamer =
-      gd::ExpressionsRenamer(project.GetCurrentPlatform());
+  gd::ExpressionsRenamer expressionRenamer(project.GetCurrentPlatform());
   expressionRenamer.SetReplacedObjectExpression(
       gd::PlatformExtension::GetObjectFullType(
           eventsFunctionsExtension.GetName(), eventsBasedObject.GetName()),
       EventsBasedObject::GetPropertyExpressionName(oldPropertyName),
       EventsBasedObject::GetPropertyExpressionName(newPropertyName));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
 
   // Rename property names directly used as an identifier.
   std::unordered_map<gd::String, gd::String> oldToNewPropertyNames = {
@@ -1210,7 +1186,6 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
       gd::PlatformExtension::GetObjectEventsFunctionFullType(
           eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
           EventsBasedObject::GetPropertyActionName(newPropertyName)));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
   gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
       project,
@@ -1220,7 +1195,11 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
       gd::PlatformExtension::GetObjectEventsFunctionFullType(
           eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
           EventsBasedObject::GetPropertyConditionName(newPropertyName)));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+  gd::ArbitraryEventsWorkersBatch renamers;
+  renamers.AddWorker(expressionRenamer)
+      .AddWorker(actionRenamer)
+      .AddWorker(conditionRenamer);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
 }
 
 void WholeProjectRefactorer::ChangeEventsBasedBehaviorPropertyType(
@@ -1501,6 +1480,7 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
     const gd::String &oldBehaviorName,
     const gd::String &newBehaviorName,
     const gd::ProjectBrowser &projectBrowser) {
+  gd::PerfScope perfScope("WholeProjectRefactorer::RenameEventsBasedBehavior");
   auto renameBehaviorEventsFunction =
       [&project, &eventsFunctionsExtension, &oldBehaviorName,
        &newBehaviorName, &projectBrowser](const gd::EventsFunction &eventsFunction) {
@@ -1654,6 +1634,7 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
     const gd::EventsBasedObject &eventsBasedObject,
     const gd::String &oldObjectName, const gd::String &newObjectName,
     const gd::ProjectBrowser &projectBrowser) {
+  gd::PerfScope perfScope("WholeProjectRefactorer::RenameEventsBasedObject");
   auto renameObjectEventsFunction =
       [&project, &eventsFunctionsExtension, &oldObjectName, &newObjectName,
        &projectBrowser](const gd::EventsFunction &eventsFunction) {
@@ -1742,8 +1723,7 @@ void WholeProjectRefactorer::DoRenameEventsFunction(
   // to avoid being unable to fetch the metadata (the types of parameters) of
   // instructions after they are renamed.
   if (eventsFunction.IsExpression()) {
-    gd::ExpressionsRenamer renamer =
-        gd::ExpressionsRenamer(project.GetCurrentPlatform());
+    gd::ExpressionsRenamer renamer(project.GetCurrentPlatform());
     renamer.SetReplacedFreeExpression(oldFullType, newFullType);
     projectBrowser.ExposeEvents(project, renamer);
   }
@@ -1813,11 +1793,7 @@ void WholeProjectRefactorer::ObjectRemovedInScene(
   auto projectScopedContainers = gd::ProjectScopedContainers::
       MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
 
-  auto &groups = layout.GetObjects().GetObjectGroups();
-  for (std::size_t g = 0; g < groups.size(); ++g) {
-    if (groups[g].Find(objectName))
-      groups[g].RemoveObject(objectName);
-  }
+  layout.GetObjects().GetObjectGroups().RemoveObjectFromGroups(objectName);
   layout.GetInitialInstances().RemoveInitialInstancesOfObject(objectName);
 
   // Remove object in external layouts
@@ -1851,6 +1827,8 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
     gd::Project &project, gd::Layout &layout,
     const gd::ObjectsContainer &targetedObjectsContainer,
     const gd::String &oldName, const gd::String &newName, bool isObjectGroup) {
+  gd::PerfScope perfScope(
+      "WholeProjectRefactorer::ObjectOrGroupRenamedInScene");
 
   if (oldName == newName || newName.empty() || oldName.empty())
     return;
@@ -1865,11 +1843,9 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
 
   // Object groups can't have instances or be in other groups
   if (!isObjectGroup) {
-    auto &groups = layout.GetObjects().GetObjectGroups();
     layout.GetInitialInstances().RenameInstancesOfObject(oldName, newName);
-    for (std::size_t g = 0; g < groups.size(); ++g) {
-      groups[g].RenameObject(oldName, newName);
-    }
+    layout.GetObjects().GetObjectGroups().RenameObjectInGroups(oldName,
+                                                               newName);
   }
 
   // Rename object in external events
@@ -1896,6 +1872,7 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
 void WholeProjectRefactorer::RenameLayout(gd::Project &project,
                                           const gd::String &oldName,
                                           const gd::String &newName) {
+  gd::PerfScope perfScope("WholeProjectRefactorer::RenameLayout");
   if (oldName == newName || newName.empty() || oldName.empty())
     return;
   gd::ProjectElementRenamer projectElementRenamer(
@@ -2096,11 +2073,8 @@ void WholeProjectRefactorer::ObjectRemovedInEventsBasedObject(
                                                           objectName);
   }
 
-  auto &groups = eventsBasedObject.GetObjects().GetObjectGroups();
-  for (std::size_t g = 0; g < groups.size(); ++g) {
-    if (groups[g].Find(objectName))
-      groups[g].RemoveObject(objectName);
-  }
+  eventsBasedObject.GetObjects().GetObjectGroups().RemoveObjectFromGroups(
+      objectName);
   eventsBasedObject.GetInitialInstances().RemoveInitialInstancesOfObject(
       objectName);
 }
@@ -2109,10 +2083,7 @@ void WholeProjectRefactorer::ObjectRemovedInEventsFunction(
     gd::Project &project, gd::EventsFunction &eventsFunction,
     const gd::String &objectName) {
 
-  for (std::size_t g = 0; g < eventsFunction.GetObjectGroups().size(); ++g) {
-    if (eventsFunction.GetObjectGroups()[g].Find(objectName))
-      eventsFunction.GetObjectGroups()[g].RemoveObject(objectName);
-  }
+  eventsFunction.GetObjectGroups().RemoveObjectFromGroups(objectName);
 }
 
 void WholeProjectRefactorer::ObjectOrGroupRenamedInEventsBasedObject(
@@ -2132,10 +2103,8 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInEventsBasedObject(
   if (!isObjectGroup) {
     eventsBasedObject.GetInitialInstances().RenameInstancesOfObject(oldName,
                                                                     newName);
-    auto &groups = eventsBasedObject.GetObjects().GetObjectGroups();
-    for (std::size_t g = 0; g < groups.size(); ++g) {
-      groups[g].RenameObject(oldName, newName);
-    }
+    eventsBasedObject.GetObjects().GetObjectGroups().RenameObjectInGroups(
+        oldName, newName);
   }
 
   for (auto &variant : eventsBasedObject.GetVariants().GetInternalVector()) {
@@ -2152,9 +2121,7 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInEventsBasedObject(
         variantObjects.GetObject(oldName).SetName(newName);
       }
       variant->GetInitialInstances().RenameInstancesOfObject(oldName, newName);
-      for (std::size_t g = 0; g < variantObjectGroups.size(); ++g) {
-        variantObjectGroups[g].RenameObject(oldName, newName);
-      }
+      variantObjectGroups.RenameObjectInGroups(oldName, newName);
     }
   }
 }
@@ -2171,21 +2138,18 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInEventsFunction(
 
   // Object groups can't be in other groups
   if (!isObjectGroup) {
-    for (std::size_t g = 0; g < eventsFunction.GetObjectGroups().size(); ++g) {
-      eventsFunction.GetObjectGroups()[g].RenameObject(oldName, newName);
-    }
+    eventsFunction.GetObjectGroups().RenameObjectInGroups(oldName, newName);
   }
 }
 
 void WholeProjectRefactorer::GlobalObjectOrGroupRenamed(
     gd::Project &project, const gd::String &oldName, const gd::String &newName,
     bool isObjectGroup) {
+  gd::PerfScope perfScope("WholeProjectRefactorer::GlobalObjectOrGroupRenamed");
   // Object groups can't be in other groups
   if (!isObjectGroup) {
-    for (std::size_t g = 0; g < project.GetObjects().GetObjectGroups().size();
-         ++g) {
-      project.GetObjects().GetObjectGroups()[g].RenameObject(oldName, newName);
-    }
+    project.GetObjects().GetObjectGroups().RenameObjectInGroups(oldName,
+                                                                newName);
   }
 
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
@@ -2200,10 +2164,7 @@ void WholeProjectRefactorer::GlobalObjectOrGroupRenamed(
 
 void WholeProjectRefactorer::GlobalObjectRemoved(gd::Project &project,
                                                  const gd::String &objectName) {
-  auto &globalGroups = project.GetObjects().GetObjectGroups();
-  for (std::size_t g = 0; g < globalGroups.size(); ++g) {
-    globalGroups[g].RemoveObject(objectName);
-  }
+  project.GetObjects().GetObjectGroups().RemoveObjectFromGroups(objectName);
 
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
     gd::Layout &layout = project.GetLayout(i);
@@ -798,12 +798,15 @@ class GD_CORE_API WholeProjectRefactorer {
       const gd::String& behaviorName,
       std::unordered_set<gd::String>& dependentBehaviorNames);
 
+  /**
+   * \brief Compute the renaming of the children of a variable, and set
+   * \a hasAnyVariableTypeChanged to true if the type of the variable or of
+   * one of its children changed (so that both are found in one pass).
+   */
   static std::shared_ptr<VariablesRenamingChangesetNode>
   ComputeChangesetForVariable(const gd::Variable &oldVariable,
-                              const gd::Variable &newVariable);
-
-  static bool HasAnyVariableTypeChanged(const gd::Variable &oldVariable,
-                                        const gd::Variable &newVariable);
+                              const gd::Variable &newVariable,
+                              bool &hasAnyVariableTypeChanged);
 
   static const gd::String behaviorObjectParameterName;
   static const gd::String parentObjectParameterName;
@@ -20,17 +20,20 @@ using namespace gd;
 void CustomObjectConfiguration::Init(const gd::CustomObjectConfiguration& objectConfiguration) {
   project = objectConfiguration.project;
   variantName = objectConfiguration.variantName;
+  // Shared until one of the configurations modifies them.
   objectContent = objectConfiguration.objectContent;
   animations = objectConfiguration.animations;
   isMarkedAsOverridingEventsBasedObjectChildrenConfiguration =
       objectConfiguration
           .isMarkedAsOverridingEventsBasedObjectChildrenConfiguration;
+  childObjectConfigurations = objectConfiguration.childObjectConfigurations;
+}
 
-  // There is no default copy for a map of unique_ptr like childObjectConfigurations.
-  childObjectConfigurations.clear();
-  for (auto& it : objectConfiguration.childObjectConfigurations) {
-    childObjectConfigurations[it.first] = it.second->Clone();
+gd::SerializerElement &CustomObjectConfiguration::GetObjectContentToModify() {
+  if (objectContent.use_count() > 1) {
+    objectContent = std::make_shared<gd::SerializerElement>(*objectContent);
   }
+  return *objectContent;
 }
 
 gd::ObjectConfiguration CustomObjectConfiguration::badObjectConfiguration;
@@ -101,10 +104,36 @@ gd::ObjectConfiguration &CustomObjectConfiguration::GetChildObjectConfiguration(
   else {
     auto &pair = *configurationPosition;
     auto &configuration = pair.second;
+    if (configuration.use_count() > 1) {
+      // The configuration is shared with copies of this configuration.
+      configuration = configuration->Clone();
+    }
     return *configuration;
   }
 }
 
+const gd::ObjectConfiguration &
+CustomObjectConfiguration::GetChildObjectConfiguration(
+    const gd::String &objectName) const {
+  const auto *eventsBasedObject = GetEventsBasedObject();
+  if (!eventsBasedObject ||
+      !eventsBasedObject->GetObjects().HasObjectNamed(objectName)) {
+    return badObjectConfiguration;
+  }
+
+  auto &childObject = eventsBasedObject->GetObjects().GetObject(objectName);
+  if (!IsOverridingEventsBasedObjectChildrenConfiguration()) {
+    return childObject.GetConfiguration();
+  }
+
+  auto configurationPosition = childObjectConfigurations.find(objectName);
+  if (configurationPosition == childObjectConfigurations.end()) {
+    // This is what would be copied by the non-const version.
+    return childObject.GetConfiguration();
+  }
+  return *configurationPosition->second;
+}
+
 std::map<gd::String, gd::PropertyDescriptor> CustomObjectConfiguration::GetProperties() const {
     auto objectProperties = std::map<gd::String, gd::PropertyDescriptor>();
     if (!project->HasEventsBasedObject(GetType())) {
@@ -113,7 +142,7 @@ std::map<gd::String, gd::PropertyDescriptor> CustomObjectConfiguration::GetPrope
     const auto &eventsBasedObject = project->GetEventsBasedObject(GetType());
     const auto &properties = eventsBasedObject.GetPropertyDescriptors();
 
-    return gd::CustomConfigurationHelper::GetProperties(properties, objectContent);
+    return gd::CustomConfigurationHelper::GetProperties(properties, *objectContent);
 }
 
 bool CustomObjectConfiguration::UpdateProperty(const gd::String& propertyName,
@@ -126,7 +155,7 @@ bool CustomObjectConfiguration::UpdateProperty(const gd::String& propertyName,
 
     return gd::CustomConfigurationHelper::UpdateProperty(
         properties,
-        objectContent,
+        GetObjectContentToModify(),
         propertyName,
         newValue);
 }
@@ -135,7 +164,7 @@ std::map<gd::String, gd::PropertyDescriptor>
 CustomObjectConfiguration::GetInitialInstanceProperties(
     const gd::InitialInstance &initialInstance) {
   std::map<gd::String, gd::PropertyDescriptor> properties;
-  if (!animations.HasNoAnimations()) {
+  if (!animations->HasNoAnimations()) {
     properties["animation"] =
         gd::PropertyDescriptor(
             gd::String::From(initialInstance.GetRawDoubleProperty("animation")))
@@ -157,13 +186,13 @@ bool CustomObjectConfiguration::UpdateInitialInstanceProperty(
 }
 
 void CustomObjectConfiguration::DoSerializeTo(SerializerElement& element) const {
-  element.AddChild("content") = objectContent;
+  element.AddChild("content") = *objectContent;
 
   const auto *eventsBasedObject = GetEventsBasedObject();
-  if (!animations.HasNoAnimations() ||
+  if (!animations->HasNoAnimations() ||
       (eventsBasedObject && eventsBasedObject->IsAnimatable())) {
     auto &animatableElement = element.AddChild("animatable");
-    animations.SerializeTo(animatableElement);
+    animations->SerializeTo(animatableElement);
   }
 
   element.SetAttribute("variant", variantName);
@@ -179,11 +208,12 @@ void CustomObjectConfiguration::DoSerializeTo(SerializerElement& element) const
 }
 void CustomObjectConfiguration::DoUnserializeFrom(Project& project,
                                                const SerializerElement& element) {
-  objectContent = element.GetChild("content");
+  objectContent =
+      std::make_shared<gd::SerializerElement>(element.GetChild("content"));
 
   if (element.HasChild("animatable")) {
     auto &animatableElement = element.GetChild("animatable");
-    animations.UnserializeFrom(animatableElement);
+    GetAnimations().UnserializeFrom(animatableElement);
   }
 
   variantName = element.GetStringAttribute("variant");
@@ -201,7 +231,7 @@ void CustomObjectConfiguration::DoUnserializeFrom(Project& project,
 }
 
 void CustomObjectConfiguration::ExposeResources(gd::ArbitraryResourceWorker& worker) {
-  animations.ExposeResources(worker);
+  GetAnimations().ExposeResources(worker);
 
   std::map<gd::String, gd::PropertyDescriptor> properties = GetProperties();
 
@@ -277,25 +307,28 @@ void CustomObjectConfiguration::ExposeResources(gd::ArbitraryResourceWorker& wor
 }
 
 std::size_t CustomObjectConfiguration::GetAnimationsCount() const {
-  return animations.GetAnimationsCount();
+  return animations->GetAnimationsCount();
 }
 
 const gd::String &
 CustomObjectConfiguration::GetAnimationName(size_t index) const {
-  return animations.GetAnimation(index).GetName();
+  return animations->GetAnimation(index).GetName();
 }
 
 bool CustomObjectConfiguration::HasAnimationNamed(
     const gd::String &name) const {
-  return animations.HasAnimationNamed(name);
+  return animations->HasAnimationNamed(name);
 }
 
 const SpriteAnimationList& CustomObjectConfiguration::GetAnimations() const {
-  return animations;
+  return *animations;
 }
 
 SpriteAnimationList& CustomObjectConfiguration::GetAnimations() {
-  return animations;
+  if (animations.use_count() > 1) {
+    animations = std::make_shared<SpriteAnimationList>(*animations);
+  }
+  return *animations;
 }
 
 const gd::CustomObjectConfiguration::EdgeAnchor
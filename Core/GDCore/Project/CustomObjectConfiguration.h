@@ -27,6 +27,11 @@ namespace gd {
  *
  * It also implements "ExposeResources" to expose the properties of type
  * "resource".
+ *
+ * \note The content, the animations and the configurations of the children
+ * are shared between copies of a configuration, and only copied when they
+ * are modified (or could be, when they are accessed without being const).
+ * So a reference to them must be got again after the configuration is copied.
  */
 class CustomObjectConfiguration : public gd::ObjectConfiguration {
 public:
@@ -101,9 +106,20 @@ public:
 
   void ClearChildrenConfiguration();
 
+  /**
+   * \brief Return the configuration of a child object, to be modified. It is
+   * copied first if it was shared with other configurations.
+   */
   gd::ObjectConfiguration &
   GetChildObjectConfiguration(const gd::String &objectName);
 
+  /**
+   * \brief Return the configuration of a child object, without copying it if
+   * it's shared with other configurations.
+   */
+  const gd::ObjectConfiguration &
+  GetChildObjectConfiguration(const gd::String &objectName) const;
+
   std::size_t GetAnimationsCount() const override;
 
   const gd::String &GetAnimationName(size_t index) const override;
@@ -161,18 +177,27 @@ protected:
 
   bool IsOverridingEventsBasedObjectChildrenConfiguration() const;
 
+  /**
+   * Return the content, copied first if it's shared with other
+   * configurations.
+   */
+  gd::SerializerElement &GetObjectContentToModify();
+
   const Project* project = nullptr; ///< The project is used to get the
                                     ///< EventBasedObject from the fullType.
-  gd::SerializerElement objectContent;
+  std::shared_ptr<gd::SerializerElement> objectContent =
+      std::make_shared<gd::SerializerElement>(); ///< Shared between copies.
   std::unordered_set<gd::String> unfoldedChildren;
 
   gd::String variantName = "";
   bool isMarkedAsOverridingEventsBasedObjectChildrenConfiguration = false;
-  mutable std::map<gd::String, std::unique_ptr<gd::ObjectConfiguration>> childObjectConfigurations;
+  mutable std::map<gd::String, std::shared_ptr<gd::ObjectConfiguration>>
+      childObjectConfigurations; ///< Shared between copies.
 
   static gd::ObjectConfiguration badObjectConfiguration;
 
-  SpriteAnimationList animations;
+  std::shared_ptr<SpriteAnimationList> animations =
+      std::make_shared<SpriteAnimationList>(); ///< Shared between copies.
 
   /**
    * Initialize configuration using another configuration. Used by copy-ctor
@@ -180,8 +205,8 @@ protected:
    *
    * Don't forget to update me if members were changed!
    *
-   * It's needed because there is no default copy for childObjectConfigurations
-   * and it must be a deep copy.
+   * The content, the animations and childObjectConfigurations are shared
+   * with the other configuration: they are copied when modified.
    */
   void Init(const gd::CustomObjectConfiguration& object);
 };
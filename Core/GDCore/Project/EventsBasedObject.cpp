@@ -23,7 +23,8 @@ EventsBasedObject::EventsBasedObject()
 EventsBasedObject::~EventsBasedObject() {}
 
 
-void EventsBasedObject::SerializeToExternal(SerializerElement& element) const {
+void EventsBasedObject::SerializeObjectAttributesTo(
+    SerializerElement& element, bool includeDefaultBehaviors) const {
   element.SetAttribute("defaultName", defaultName);
   if (isRenderedIn3D) {
     element.SetBoolAttribute("is3D", true);
@@ -41,7 +42,11 @@ void EventsBasedObject::SerializeToExternal(SerializerElement& element) const {
 
   // The EventsBasedObjectVariant SerializeTo method override the name.
   // AbstractEventsBasedEntity::SerializeTo must be done after.
-  defaultVariant.SerializeTo(element);
+  defaultVariant.SerializeTo(element, includeDefaultBehaviors);
+}
+
+void EventsBasedObject::SerializeToExternal(SerializerElement& element) const {
+  SerializeObjectAttributesTo(element, false);
   AbstractEventsBasedEntity::SerializeTo(element);
 }
 
@@ -50,6 +55,28 @@ void EventsBasedObject::SerializeTo(SerializerElement& element) const {
   variants.SerializeVariantsTo(element.AddChild("variants"));
 }
 
+void EventsBasedObject::SerializeForExportTo(SerializerElement& element) const {
+  SerializeObjectAttributesTo(element, true);
+
+  // Only keep what AbstractEventsBasedEntity::SerializeTo writes that is
+  // used by the game engine.
+  element.SetAttribute("description", "");
+  element.SetAttribute("name", GetName());
+  element.SetAttribute("fullName", "");
+  if (IsPrivate()) {
+    element.SetBoolAttribute("private", true);
+  }
+  element.AddChild("eventsFunctions").ConsiderAsArrayOf("eventsFunction");
+  element.AddChild("propertyDescriptors")
+      .ConsiderAsArrayOf("propertyDescriptor");
+
+  auto& variantsElement = element.AddChild("variants");
+  variantsElement.ConsiderAsArrayOf("variant");
+  for (const auto& variant : variants.GetInternalVector()) {
+    variant->SerializeTo(variantsElement.AddChild("variant"), true);
+  }
+}
+
 void EventsBasedObject::UnserializeFrom(gd::Project& project,
                                         const SerializerElement& element) {
   defaultName = element.GetStringAttribute("defaultName");
@@ -350,10 +350,22 @@ class GD_CORE_API EventsBasedObject: public AbstractEventsBasedEntity {
 
   void SerializeTo(SerializerElement& element) const override;
 
+  /**
+   * \brief Serialize the events-based object as needed by the game engine:
+   * functions, properties, full name and description are not serialized
+   * and the default behaviors of the child-objects are.
+   *
+   * \see gd::Project::SerializeForExportTo
+   */
+  void SerializeForExportTo(SerializerElement& element) const;
+
   void UnserializeFrom(gd::Project& project,
                        const SerializerElement& element) override;
 
  private:
+  void SerializeObjectAttributesTo(SerializerElement& element,
+                                   bool includeDefaultBehaviors) const;
+
   gd::String defaultName;
   bool isRenderedIn3D;
   bool isAnimatable;
@@ -16,7 +16,8 @@ EventsBasedObjectVariant::EventsBasedObjectVariant()
 
 EventsBasedObjectVariant::~EventsBasedObjectVariant() {}
 
-void EventsBasedObjectVariant::SerializeTo(SerializerElement &element) const {
+void EventsBasedObjectVariant::SerializeTo(SerializerElement &element,
+                                           bool includeDefaultBehaviors) const {
   element.SetAttribute("name", name);
   if (!GetAssetStoreAssetId().empty() && !GetAssetStoreOriginalName().empty()) {
     element.SetAttribute("assetStoreAssetId", GetAssetStoreAssetId());
@@ -29,7 +30,8 @@ void EventsBasedObjectVariant::SerializeTo(SerializerElement &element) const {
   element.SetIntAttribute("areaMaxY", areaMaxY);
   element.SetIntAttribute("areaMaxZ", areaMaxZ);
 
-  objectsContainer.SerializeObjectsTo(element.AddChild("objects"));
+  objectsContainer.SerializeObjectsTo(element.AddChild("objects"),
+                                      includeDefaultBehaviors);
   objectsContainer.SerializeFoldersTo(
       element.AddChild("objectsFolderStructure"));
   objectsContainer.GetObjectGroups().SerializeTo(
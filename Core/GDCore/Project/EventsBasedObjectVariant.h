@@ -200,7 +200,13 @@ public:
     return assetStoreOriginalName;
   };
 
-  void SerializeTo(SerializerElement &element) const;
+  /**
+   * \brief Serialize the variant.
+   *
+   * \see gd::Object::SerializeTo for \a includeDefaultBehaviors.
+   */
+  void SerializeTo(SerializerElement &element,
+                   bool includeDefaultBehaviors = false) const;
 
   void UnserializeFrom(gd::Project &project, const SerializerElement &element);
 
@@ -55,7 +55,8 @@ void EventsFunctionsExtension::Init(const gd::EventsFunctionsExtension& other) {
   sceneVariables = other.GetSceneVariables();
 }
 
-void EventsFunctionsExtension::SerializeTo(SerializerElement& element, bool isExternal) const {
+void EventsFunctionsExtension::SerializePropertiesTo(
+    SerializerElement& element) const {
   element.SetAttribute("version", version);
   element.SetAttribute("extensionNamespace", extensionNamespace);
   element.SetAttribute("shortDescription", shortDescription);
@@ -100,6 +101,10 @@ void EventsFunctionsExtension::SerializeTo(SerializerElement& element, bool isEx
 
   GetGlobalVariables().SerializeTo(element.AddChild("globalVariables"));
   GetSceneVariables().SerializeTo(element.AddChild("sceneVariables"));
+}
+
+void EventsFunctionsExtension::SerializeTo(SerializerElement& element, bool isExternal) const {
+  SerializePropertiesTo(element);
 
   eventsFunctionsContainer.SerializeEventsFunctionsTo(
       element.AddChild("eventsFunctions"));
@@ -119,6 +124,29 @@ void EventsFunctionsExtension::SerializeTo(SerializerElement& element, bool isEx
   }
 }
 
+void EventsFunctionsExtension::SerializeForExportTo(
+    SerializerElement& element) const {
+  SerializePropertiesTo(element);
+  element.SetAttribute("version", "");
+  element.SetAttribute("shortDescription", "");
+  element.GetChild("description").SetMultilineStringValue("");
+  element.SetAttribute("fullName", "");
+  element.RemoveChild("origin");
+  element.SetAttribute("previewIconUrl", "");
+  element.SetAttribute("iconUrl", "");
+  element.SetAttribute("helpPath", "");
+
+  element.AddChild("eventsFunctions").ConsiderAsArrayOf("eventsFunction");
+  element.AddChild("eventsBasedBehaviors")
+      .ConsiderAsArrayOf("eventsBasedBehavior");
+  auto& eventsBasedObjectsElement = element.AddChild("eventsBasedObjects");
+  eventsBasedObjectsElement.ConsiderAsArrayOf("eventsBasedObject");
+  for (const auto& eventsBasedObject : eventsBasedObjects.GetInternalVector()) {
+    eventsBasedObject->SerializeForExportTo(
+        eventsBasedObjectsElement.AddChild("eventsBasedObject"));
+  }
+}
+
 void EventsFunctionsExtension::UnserializeFrom(
     gd::Project& project, const SerializerElement& element) {
   // Unserialize first the "declaration" (everything but objects content)
@@ -297,6 +297,16 @@ class GD_CORE_API EventsFunctionsExtension {
     SerializeTo(element, true);
   }
 
+  /**
+   * \brief Serialize the EventsFunctionsExtension as needed by the game
+   * engine: the free functions and the behaviors (which are generated as
+   * code) and the information only displayed in the editor are not
+   * serialized.
+   *
+   * \see gd::Project::SerializeForExportTo
+   */
+  void SerializeForExportTo(gd::SerializerElement& element) const;
+
   /**
    * \brief Load the EventsFunctionsExtension from the specified element.
    */
@@ -370,6 +380,11 @@ class GD_CORE_API EventsFunctionsExtension {
    */
   void Init(const gd::EventsFunctionsExtension& other);
 
+  /**
+   * Serialize everything but the free functions, behaviors and objects.
+   */
+  void SerializePropertiesTo(gd::SerializerElement& element) const;
+
   void SerializeDependencyTo(const gd::DependencyMetadata& dependency,
                              gd::SerializerElement& serializer) const {
     serializer.SetStringAttribute("type", dependency.GetDependencyType());
@@ -48,7 +48,10 @@ class GD_CORE_API ExternalEvents {
   /**
    * \brief Change external events name
    */
-  virtual void SetName(const gd::String& name_) { name = name_; };
+  virtual void SetName(const gd::String& name_) {
+    name = name_;
+    gd::EventsList::NotifyLinksModified();
+  };
 
   /**
    * \brief Get the layout associated with external events.
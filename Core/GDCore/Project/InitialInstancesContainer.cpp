@@ -4,6 +4,7 @@
  * reserved. This project is released under the MIT License.
  */
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <map>
 
@@ -30,9 +31,10 @@ void InitialInstancesContainer::UnserializeFrom(
 
   element.ConsiderAsArrayOf("instance", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
-    gd::InitialInstance instance;
-    instance.UnserializeFrom(element.GetChild(i));
-    initialInstances.push_back(instance);
+    // Unserialize in place to avoid copying the instance (and its strings
+    // and properties).
+    initialInstances.emplace_back();
+    initialInstances.back().UnserializeFrom(element.GetChild(i));
   }
 }
 
@@ -51,12 +53,20 @@ void InitialInstancesContainer::IterateOverInstances(
   }
 }
 
+void InitialInstancesContainer::IterateOverInstances(
+  const std::function< bool(const gd::InitialInstance &) >& func) const {
+  for (const auto& instance : initialInstances) {
+    if (func(instance)) return;
+  }
+}
+
 void InitialInstancesContainer::IterateOverInstancesWithZOrdering(
     gd::InitialInstanceFunctor& func, const gd::String& layerName) {
   std::vector<std::reference_wrapper<gd::InitialInstance>> sortedInstances;
+  sortedInstances.reserve(initialInstances.size());
   std::copy_if(initialInstances.begin(),
                initialInstances.end(),
-               std::inserter(sortedInstances, sortedInstances.begin()),
+               std::back_inserter(sortedInstances),
                [&layerName](InitialInstance& instance) {
                  return instance.GetLayer() == layerName;
                });
@@ -71,8 +81,7 @@ void InitialInstancesContainer::IterateOverInstancesWithZOrdering(
 }
 
 gd::InitialInstance& InitialInstancesContainer::InsertNewInitialInstance() {
-  gd::InitialInstance newInstance;
-  initialInstances.push_back(newInstance);
+  initialInstances.emplace_back();
 
   return initialInstances.back();
 }
@@ -144,6 +153,50 @@ void InitialInstancesContainer::MoveInstancesToLayer(
   }
 }
 
+void InitialInstancesContainer::MoveInstances(
+    const std::vector<gd::InitialInstance *> &instances,
+    double deltaX,
+    double deltaY,
+    double deltaZ) {
+  for (gd::InitialInstance *instance : instances) {
+    instance->SetX(instance->GetX() + deltaX);
+    instance->SetY(instance->GetY() + deltaY);
+    if (deltaZ != 0) instance->SetZ(instance->GetZ() + deltaZ);
+  }
+}
+
+void InitialInstancesContainer::RotateInstances(
+    const std::vector<gd::InitialInstance *> &instances,
+    double angle,
+    double pivotX,
+    double pivotY) {
+  const double angleInRadians = angle * gd::Pi() / 180.0;
+  const double cosAngle = std::cos(angleInRadians);
+  const double sinAngle = std::sin(angleInRadians);
+  for (gd::InitialInstance *instance : instances) {
+    const double x = instance->GetX() - pivotX;
+    const double y = instance->GetY() - pivotY;
+    instance->SetX(pivotX + x * cosAngle - y * sinAngle);
+    instance->SetY(pivotY + x * sinAngle + y * cosAngle);
+    instance->SetAngle(instance->GetAngle() + angle);
+  }
+}
+
+void InitialInstancesContainer::SetInstancesLayer(
+    const std::vector<gd::InitialInstance *> &instances,
+    const gd::String &layerName) {
+  for (gd::InitialInstance *instance : instances) {
+    if (instance->GetLayer() != layerName) instance->SetLayer(layerName);
+  }
+}
+
+void InitialInstancesContainer::ChangeInstancesZOrder(
+    const std::vector<gd::InitialInstance *> &instances, int offset) {
+  for (gd::InitialInstance *instance : instances) {
+    instance->SetZOrder(instance->GetZOrder() + offset);
+  }
+}
+
 std::size_t InitialInstancesContainer::GetLayerInstancesCount(
     const gd::String &layerName) const {
   std::size_t count = 0;
@@ -202,7 +255,7 @@ void InitialInstancesContainer::Create(
 
 void InitialInstancesContainer::SerializeTo(SerializerElement& element) const {
   element.ConsiderAsArrayOf("instance");
-  for (auto instance : initialInstances)
+  for (const auto& instance : initialInstances)
     instance.SerializeTo(element.AddChild("instance"));
 }
 
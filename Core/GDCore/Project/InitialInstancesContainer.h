@@ -7,6 +7,8 @@
 #pragma once
 
 #include <list>
+#include <vector>
+
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -94,6 +96,13 @@ class GD_CORE_API InitialInstancesContainer {
   void IterateOverInstances(
     const std::function< bool(gd::InitialInstance &) >& func);
 
+  /**
+   * \brief Apply \a func to each instance of the container, without
+   * modifying them. Stop when \a func returns true.
+   */
+  void IterateOverInstances(
+    const std::function< bool(const gd::InitialInstance &) >& func) const;
+
   /**
    * Get the instances on the specified layer,
    * sort them regarding their Z order and then apply \a func on them.
@@ -133,6 +142,38 @@ class GD_CORE_API InitialInstancesContainer {
   void MoveInstancesToLayer(const gd::String &fromLayer,
                             const gd::String &toLayer);
 
+  /**
+   * \brief Move the given instances (of this container) by the same offset.
+   */
+  void MoveInstances(const std::vector<gd::InitialInstance *> &instances,
+                     double deltaX,
+                     double deltaY,
+                     double deltaZ = 0);
+
+  /**
+   * \brief Rotate the given instances (of this container) by \a angle
+   * degrees: their positions are rotated around the pivot, and \a angle is
+   * added to their angles.
+   */
+  void RotateInstances(const std::vector<gd::InitialInstance *> &instances,
+                       double angle,
+                       double pivotX,
+                       double pivotY);
+
+  /**
+   * \brief Move the given instances (of this container) to the layer \a
+   * layerName.
+   */
+  void SetInstancesLayer(const std::vector<gd::InitialInstance *> &instances,
+                         const gd::String &layerName);
+
+  /**
+   * \brief Add \a offset to the Z order of the given instances (of this
+   * container).
+   */
+  void ChangeInstancesZOrder(
+      const std::vector<gd::InitialInstance *> &instances, int offset);
+
   /**
    * \brief Remove instances of object named \a objectName
    */
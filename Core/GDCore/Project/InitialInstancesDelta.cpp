@@ -0,0 +1,199 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/InitialInstancesDelta.h"
+
+#include <unordered_map>
+
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+const char *numberNames[] = {
+    "x", "y", "z", "angle", "width", "height", "depth"};
+
+const int flagLocked = 1;
+const int flagCustomSize = 2;
+const int flagCustomDepth = 4;
+
+bool HasValue(const gd::SerializerElement &element, const gd::String &name) {
+  // Values are attributes when serialized, but children when read from JSON.
+  return element.HasAttribute(name) || element.HasChild(name);
+}
+}  // namespace
+
+namespace gd {
+
+void InitialInstancesDelta::InstanceState::ReadFrom(
+    const gd::InitialInstance &instance) {
+  numbers[0] = instance.GetX();
+  numbers[1] = instance.GetY();
+  numbers[2] = instance.GetZ();
+  numbers[3] = instance.GetAngle();
+  numbers[4] = instance.GetCustomWidth();
+  numbers[5] = instance.GetCustomHeight();
+  numbers[6] = instance.GetCustomDepth();
+  zOrder = instance.GetZOrder();
+  layer = instance.GetLayer();
+  flags = (instance.IsLocked() ? flagLocked : 0) |
+          (instance.HasCustomSize() ? flagCustomSize : 0) |
+          (instance.HasCustomDepth() ? flagCustomDepth : 0);
+}
+
+void InitialInstancesDelta::InstanceState::ApplyTo(
+    gd::InitialInstance &instance, unsigned int fields) const {
+  if (fields & FieldX) instance.SetX(numbers[0]);
+  if (fields & FieldY) instance.SetY(numbers[1]);
+  if (fields & FieldZ) instance.SetZ(numbers[2]);
+  if (fields & FieldAngle) instance.SetAngle(numbers[3]);
+  if (fields & FieldCustomWidth) instance.SetCustomWidth(numbers[4]);
+  if (fields & FieldCustomHeight) instance.SetCustomHeight(numbers[5]);
+  if (fields & FieldCustomDepth) instance.SetCustomDepth(numbers[6]);
+  if (fields & FieldZOrder) instance.SetZOrder(zOrder);
+  if (fields & FieldLayer) instance.SetLayer(layer);
+  if (fields & FieldFlags) {
+    instance.SetLocked((flags & flagLocked) != 0);
+    instance.SetHasCustomSize((flags & flagCustomSize) != 0);
+    instance.SetHasCustomDepth((flags & flagCustomDepth) != 0);
+  }
+}
+
+unsigned int InitialInstancesDelta::InstanceState::GetChangedFields(
+    const InstanceState &other) const {
+  unsigned int fields = 0;
+  for (std::size_t i = 0; i < NumbersCount; ++i) {
+    if (numbers[i] != other.numbers[i]) fields |= 1 << i;
+  }
+  if (zOrder != other.zOrder) fields |= FieldZOrder;
+  if (layer != other.layer) fields |= FieldLayer;
+  if (flags != other.flags) fields |= FieldFlags;
+  return fields;
+}
+
+void InitialInstancesDelta::InstanceState::SerializeTo(
+    SerializerElement &element, unsigned int fields) const {
+  for (std::size_t i = 0; i < NumbersCount; ++i) {
+    if (fields & (1 << i)) element.SetAttribute(numberNames[i], numbers[i]);
+  }
+  if (fields & FieldZOrder) element.SetAttribute("zOrder", zOrder);
+  if (fields & FieldLayer) element.SetAttribute("layer", layer);
+  if (fields & FieldFlags) element.SetAttribute("flags", flags);
+}
+
+unsigned int InitialInstancesDelta::InstanceState::UnserializeFrom(
+    const SerializerElement &element) {
+  unsigned int fields = 0;
+  for (std::size_t i = 0; i < NumbersCount; ++i) {
+    if (HasValue(element, numberNames[i])) {
+      numbers[i] = element.GetDoubleAttribute(numberNames[i]);
+      fields |= 1 << i;
+    }
+  }
+  if (HasValue(element, "zOrder")) {
+    zOrder = element.GetIntAttribute("zOrder");
+    fields |= FieldZOrder;
+  }
+  if (HasValue(element, "layer")) {
+    layer = element.GetStringAttribute("layer");
+    fields |= FieldLayer;
+  }
+  if (HasValue(element, "flags")) {
+    flags = element.GetIntAttribute("flags");
+    fields |= FieldFlags;
+  }
+  return fields;
+}
+
+void InitialInstancesDelta::RecordBefore(
+    const std::vector<gd::InitialInstance *> &instances) {
+  recordedInstances = instances;
+  recordedStates.resize(instances.size());
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    if (instances[i]->GetPersistentUuid().empty())
+      instances[i]->ResetPersistentUuid();
+    recordedStates[i].ReadFrom(*instances[i]);
+  }
+}
+
+void InitialInstancesDelta::RecordAfter() {
+  changes.clear();
+  for (std::size_t i = 0; i < recordedInstances.size(); ++i) {
+    InstanceState after;
+    after.ReadFrom(*recordedInstances[i]);
+    unsigned int fields = recordedStates[i].GetChangedFields(after);
+    if (!fields) continue;
+
+    changes.emplace_back();
+    InstanceChange &change = changes.back();
+    change.persistentUuid = recordedInstances[i]->GetPersistentUuid();
+    change.fields = fields;
+    change.before = std::move(recordedStates[i]);
+    change.after = std::move(after);
+  }
+
+  recordedInstances.clear();
+  recordedStates.clear();
+}
+
+void InitialInstancesDelta::Undo(
+    gd::InitialInstancesContainer &container) const {
+  Apply(container, true);
+}
+
+void InitialInstancesDelta::Redo(
+    gd::InitialInstancesContainer &container) const {
+  Apply(container, false);
+}
+
+void InitialInstancesDelta::Apply(gd::InitialInstancesContainer &container,
+                                  bool undo) const {
+  if (changes.empty()) return;
+
+  std::unordered_map<gd::String, const InstanceChange *> changesByUuid;
+  for (const InstanceChange &change : changes)
+    changesByUuid[change.persistentUuid] = &change;
+
+  container.IterateOverInstances([&](gd::InitialInstance &instance) {
+    auto it = changesByUuid.find(instance.GetPersistentUuid());
+    if (it != changesByUuid.end()) {
+      const InstanceChange &change = *it->second;
+      (undo ? change.before : change.after).ApplyTo(instance, change.fields);
+    }
+    return false;
+  });
+}
+
+void InitialInstancesDelta::SerializeTo(SerializerElement &element) const {
+  SerializerElement &instancesElement = element.AddChild("instances");
+  instancesElement.ConsiderAsArrayOf("instance");
+  for (const InstanceChange &change : changes) {
+    SerializerElement &changeElement = instancesElement.AddChild("instance");
+    changeElement.SetAttribute("persistentUuid", change.persistentUuid);
+    change.before.SerializeTo(changeElement.AddChild("before"), change.fields);
+    change.after.SerializeTo(changeElement.AddChild("after"), change.fields);
+  }
+}
+
+void InitialInstancesDelta::UnserializeFrom(const SerializerElement &element) {
+  changes.clear();
+  recordedInstances.clear();
+  recordedStates.clear();
+
+  const SerializerElement &instancesElement = element.GetChild("instances");
+  instancesElement.ConsiderAsArrayOf("instance");
+  changes.reserve(instancesElement.GetChildrenCount());
+  for (std::size_t i = 0; i < instancesElement.GetChildrenCount(); ++i) {
+    const SerializerElement &changeElement = instancesElement.GetChild(i);
+    changes.emplace_back();
+    InstanceChange &change = changes.back();
+    change.persistentUuid = changeElement.GetStringAttribute("persistentUuid");
+    change.fields =
+        change.before.UnserializeFrom(changeElement.GetChild("before")) &
+        change.after.UnserializeFrom(changeElement.GetChild("after"));
+  }
+}
+
+}  // namespace gd
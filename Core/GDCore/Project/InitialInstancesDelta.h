@@ -0,0 +1,133 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class InitialInstance;
+class InitialInstancesContainer;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief The changes made to some instances of a gd::InitialInstancesContainer
+ * by an edition (moving, rotating, resizing or changing the layer or the Z
+ * order of a selection), to undo or redo it.
+ *
+ * Only the changed fields of the changed instances are kept, instead of the
+ * whole instances: record the instances with RecordBefore before changing
+ * them, then call RecordAfter.
+ *
+ * Instances are identified by their persistent UUID, so that the changes can
+ * be undone or redone even after the instances were removed and added back.
+ *
+ * \see gd::InitialInstancesContainer
+ */
+class GD_CORE_API InitialInstancesDelta {
+ public:
+  InitialInstancesDelta(){};
+  virtual ~InitialInstancesDelta(){};
+
+  /**
+   * \brief Remember the state of the instances, before they are changed.
+   *
+   * Instances without a persistent UUID are given one.
+   */
+  void RecordBefore(const std::vector<gd::InitialInstance *> &instances);
+
+  /**
+   * \brief Compare the instances given to RecordBefore with their state
+   * before, and keep their changed fields.
+   *
+   * \warning The instances must not have been removed from their container
+   * since RecordBefore.
+   */
+  void RecordAfter();
+
+  /**
+   * \brief Return true if no instance was changed.
+   */
+  bool IsEmpty() const { return changes.empty(); }
+
+  /**
+   * \brief Return the number of changed instances.
+   */
+  std::size_t GetInstancesCount() const { return changes.size(); }
+
+  /**
+   * \brief Give back to the instances of the container the state they had
+   * before the changes.
+   */
+  void Undo(gd::InitialInstancesContainer &container) const;
+
+  /**
+   * \brief Give again to the instances of the container the state they had
+   * after the changes.
+   */
+  void Redo(gd::InitialInstancesContainer &container) const;
+
+  /** \name Saving and loading
+   */
+  ///@{
+  void SerializeTo(SerializerElement &element) const;
+  void UnserializeFrom(const SerializerElement &element);
+  ///@}
+
+ private:
+  enum Field {
+    FieldX = 1 << 0,
+    FieldY = 1 << 1,
+    FieldZ = 1 << 2,
+    FieldAngle = 1 << 3,
+    FieldCustomWidth = 1 << 4,
+    FieldCustomHeight = 1 << 5,
+    FieldCustomDepth = 1 << 6,
+    FieldZOrder = 1 << 7,
+    FieldLayer = 1 << 8,
+    FieldFlags = 1 << 9,
+  };
+
+  /**
+   * \brief The fields of an instance that can be changed by an edition.
+   */
+  struct InstanceState {
+    static constexpr std::size_t NumbersCount = 7;
+
+    void ReadFrom(const gd::InitialInstance &instance);
+    void ApplyTo(gd::InitialInstance &instance, unsigned int fields) const;
+    unsigned int GetChangedFields(const InstanceState &other) const;
+    void SerializeTo(SerializerElement &element, unsigned int fields) const;
+    unsigned int UnserializeFrom(const SerializerElement &element);
+
+    double numbers[NumbersCount] = {};  ///< x, y, z, angle, custom width,
+                                        ///< custom height and custom depth.
+    int zOrder = 0;
+    gd::String layer;
+    int flags = 0;  ///< Locked, has a custom size, has a custom depth.
+  };
+
+  struct InstanceChange {
+    gd::String persistentUuid;
+    unsigned int fields = 0;  ///< The changed fields (see Field).
+    InstanceState before;
+    InstanceState after;
+  };
+
+  void Apply(gd::InitialInstancesContainer &container, bool undo) const;
+
+  std::vector<InstanceChange> changes;
+  std::vector<gd::InitialInstance *>
+      recordedInstances;  ///< The instances given to RecordBefore, until
+                          ///< RecordAfter is called.
+  std::vector<InstanceState> recordedStates;
+};
+
+}  // namespace gd
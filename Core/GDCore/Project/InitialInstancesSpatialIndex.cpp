@@ -0,0 +1,232 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/InitialInstancesSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+
+namespace {
+// Instances covering more cells than this are not put in the cells, but are
+// always checked by the queries.
+const std::size_t maxCellsPerInstance = 64;
+
+// Keep the cells coordinates far from the limits of int, so that ranges of
+// cells can be computed without overflows.
+const double maxCellCoordinate = 1 << 24;
+}  // namespace
+
+namespace gd {
+
+InitialInstancesSpatialIndex::InitialInstancesSpatialIndex(double cellSize_)
+    : cellSize(cellSize_ > 0 ? cellSize_ : 256) {}
+
+void InitialInstancesSpatialIndex::GetInstanceBounds(
+    const gd::InitialInstance &instance,
+    double &left,
+    double &top,
+    double &right,
+    double &bottom) const {
+  double width = instance.HasCustomSize() ? instance.GetCustomWidth() : 0;
+  double height = instance.HasCustomSize() ? instance.GetCustomHeight() : 0;
+  left = std::min(instance.GetX(), instance.GetX() + width);
+  right = std::max(instance.GetX(), instance.GetX() + width);
+  top = std::min(instance.GetY(), instance.GetY() + height);
+  bottom = std::max(instance.GetY(), instance.GetY() + height);
+}
+
+int InitialInstancesSpatialIndex::GetCellCoordinate(double position) const {
+  double cellCoordinate = std::floor(position / cellSize);
+  if (!(cellCoordinate > -maxCellCoordinate)) return -maxCellCoordinate;
+  if (cellCoordinate > maxCellCoordinate) return maxCellCoordinate;
+  return static_cast<int>(cellCoordinate);
+}
+
+std::uint64_t InitialInstancesSpatialIndex::GetCellKey(int cellX, int cellY) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX)) << 32) |
+         static_cast<std::uint32_t>(cellY);
+}
+
+void InitialInstancesSpatialIndex::RemoveEntry(
+    std::vector<Entry> &entries, const gd::InitialInstance &instance) {
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    if (entries[i].instance == &instance) {
+      entries[i] = entries.back();
+      entries.pop_back();
+      return;
+    }
+  }
+}
+
+void InitialInstancesSpatialIndex::Build(
+    gd::InitialInstancesContainer &container) {
+  Clear();
+  locations.reserve(container.GetInstancesCount());
+  container.IterateOverInstances([this](gd::InitialInstance &instance) {
+    Update(instance);
+    return false;
+  });
+}
+
+void InitialInstancesSpatialIndex::Update(gd::InitialInstance &instance) {
+  Remove(instance);
+
+  Entry entry;
+  entry.instance = &instance;
+  GetInstanceBounds(
+      instance, entry.left, entry.top, entry.right, entry.bottom);
+
+  Location location;
+  location.minCellX = GetCellCoordinate(entry.left);
+  location.minCellY = GetCellCoordinate(entry.top);
+  location.maxCellX = GetCellCoordinate(entry.right);
+  location.maxCellY = GetCellCoordinate(entry.bottom);
+  entry.minCellX = location.minCellX;
+  entry.minCellY = location.minCellY;
+  std::size_t cellsCount =
+      static_cast<std::size_t>(location.maxCellX - location.minCellX + 1) *
+      static_cast<std::size_t>(location.maxCellY - location.minCellY + 1);
+  location.isLarge = cellsCount > maxCellsPerInstance;
+  locations[&instance] = location;
+
+  if (location.isLarge) {
+    largeEntries.push_back(entry);
+    return;
+  }
+  for (int cellX = location.minCellX; cellX <= location.maxCellX; ++cellX) {
+    for (int cellY = location.minCellY; cellY <= location.maxCellY; ++cellY) {
+      cells[GetCellKey(cellX, cellY)].push_back(entry);
+    }
+  }
+}
+
+void InitialInstancesSpatialIndex::Remove(
+    const gd::InitialInstance &instance) {
+  auto it = locations.find(&instance);
+  if (it == locations.end()) return;
+
+  const Location &location = it->second;
+  if (location.isLarge) {
+    RemoveEntry(largeEntries, instance);
+  } else {
+    for (int cellX = location.minCellX; cellX <= location.maxCellX; ++cellX) {
+      for (int cellY = location.minCellY; cellY <= location.maxCellY;
+           ++cellY) {
+        auto cellIt = cells.find(GetCellKey(cellX, cellY));
+        if (cellIt == cells.end()) continue;
+
+        RemoveEntry(cellIt->second, instance);
+        if (cellIt->second.empty()) cells.erase(cellIt);
+      }
+    }
+  }
+  locations.erase(it);
+}
+
+void InitialInstancesSpatialIndex::Clear() {
+  cells.clear();
+  largeEntries.clear();
+  locations.clear();
+}
+
+void InitialInstancesSpatialIndex::IterateOverInstancesInRectangle(
+    double left,
+    double top,
+    double right,
+    double bottom,
+    const std::function<bool(gd::InitialInstance &)> &func) const {
+  auto overlaps = [&](const Entry &entry) {
+    return entry.left <= right && entry.right >= left && entry.top <= bottom &&
+           entry.bottom >= top;
+  };
+
+  for (const Entry &entry : largeEntries) {
+    if (overlaps(entry) && func(*entry.instance)) return;
+  }
+
+  int minCellX = GetCellCoordinate(left);
+  int minCellY = GetCellCoordinate(top);
+  int maxCellX = GetCellCoordinate(right);
+  int maxCellY = GetCellCoordinate(bottom);
+  if (maxCellX < minCellX || maxCellY < minCellY) return;
+
+  // An instance covering several cells is only given by the first of its cells
+  // that is in the rectangle.
+  auto visitCell = [&](int cellX, int cellY, const std::vector<Entry> &entries) {
+    for (const Entry &entry : entries) {
+      if (!overlaps(entry)) continue;
+
+      if (cellX != std::max(entry.minCellX, minCellX) ||
+          cellY != std::max(entry.minCellY, minCellY))
+        continue;
+
+      if (func(*entry.instance)) return true;
+    }
+    return false;
+  };
+
+  std::size_t rectangleCellsCount =
+      static_cast<std::size_t>(maxCellX - minCellX + 1) *
+      static_cast<std::size_t>(maxCellY - minCellY + 1);
+  if (rectangleCellsCount > cells.size()) {
+    // The rectangle is bigger than the indexed area: check the cells that are
+    // not empty rather than all the cells of the rectangle.
+    for (const auto &cell : cells) {
+      int cellX = static_cast<std::int32_t>(
+          static_cast<std::uint32_t>(cell.first >> 32));
+      int cellY = static_cast<std::int32_t>(
+          static_cast<std::uint32_t>(cell.first & 0xFFFFFFFF));
+      if (cellX < minCellX || cellX > maxCellX || cellY < minCellY ||
+          cellY > maxCellY)
+        continue;
+
+      if (visitCell(cellX, cellY, cell.second)) return;
+    }
+    return;
+  }
+
+  for (int cellX = minCellX; cellX <= maxCellX; ++cellX) {
+    for (int cellY = minCellY; cellY <= maxCellY; ++cellY) {
+      auto cellIt = cells.find(GetCellKey(cellX, cellY));
+      if (cellIt == cells.end()) continue;
+
+      if (visitCell(cellX, cellY, cellIt->second)) return;
+    }
+  }
+}
+
+void InitialInstancesSpatialIndex::IterateOverCells(
+    const std::function<void(int cellX,
+                             int cellY,
+                             const std::vector<gd::InitialInstance *> &)>
+        &func) const {
+  std::vector<std::pair<int, int>> cellsCoordinates;
+  cellsCoordinates.reserve(cells.size());
+  for (const auto &cell : cells) {
+    cellsCoordinates.push_back(std::make_pair(
+        static_cast<std::int32_t>(static_cast<std::uint32_t>(cell.first >> 32)),
+        static_cast<std::int32_t>(
+            static_cast<std::uint32_t>(cell.first & 0xFFFFFFFF))));
+  }
+  std::sort(cellsCoordinates.begin(), cellsCoordinates.end());
+
+  std::vector<gd::InitialInstance *> cellInstances;
+  for (const auto &cellCoordinates : cellsCoordinates) {
+    cellInstances.clear();
+    for (const Entry &entry :
+         cells.at(GetCellKey(cellCoordinates.first, cellCoordinates.second))) {
+      if (entry.minCellX == cellCoordinates.first &&
+          entry.minCellY == cellCoordinates.second)
+        cellInstances.push_back(entry.instance);
+    }
+    if (!cellInstances.empty())
+      func(cellCoordinates.first, cellCoordinates.second, cellInstances);
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,148 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace gd {
+class InitialInstance;
+class InitialInstancesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A grid dividing the scene in cells, to find quickly the instances of
+ * an gd::InitialInstancesContainer that are in a rectangle or at a point.
+ *
+ * The index is not updated automatically: it must be built with Build, then
+ * notified with Update or Remove when an instance is moved, resized, added or
+ * removed.
+ *
+ * By default, an instance covers the rectangle given by its position and its
+ * custom size (if any). Override GetInstanceBounds to use the size of the
+ * objects (which is not known by the instances) or to handle rotations.
+ *
+ * \see gd::InitialInstancesContainer
+ */
+class GD_CORE_API InitialInstancesSpatialIndex {
+ public:
+  /**
+   * \brief Create an empty index, with cells of \a cellSize pixels.
+   */
+  InitialInstancesSpatialIndex(double cellSize = 256);
+  virtual ~InitialInstancesSpatialIndex(){};
+
+  /**
+   * \brief Index all the instances of the container, replacing the instances
+   * indexed before.
+   */
+  void Build(gd::InitialInstancesContainer &container);
+
+  /**
+   * \brief Add the instance to the index, or update its position in the index
+   * after it was moved or resized.
+   */
+  void Update(gd::InitialInstance &instance);
+
+  /**
+   * \brief Remove the instance from the index. Must be called before the
+   * instance is removed from its container.
+   */
+  void Remove(const gd::InitialInstance &instance);
+
+  /**
+   * \brief Remove all the instances from the index.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of instances in the index.
+   */
+  std::size_t GetInstancesCount() const { return locations.size(); }
+
+  /**
+   * \brief Call \a func for each instance overlapping the rectangle, in no
+   * particular order. If \a func returns true, the iteration is stopped.
+   */
+  void IterateOverInstancesInRectangle(
+      double left,
+      double top,
+      double right,
+      double bottom,
+      const std::function<bool(gd::InitialInstance &)> &func) const;
+
+  /**
+   * \brief Call \a func for each instance covering the point, in no
+   * particular order. If \a func returns true, the iteration is stopped.
+   */
+  void IterateOverInstancesAtPoint(
+      double x,
+      double y,
+      const std::function<bool(gd::InitialInstance &)> &func) const {
+    IterateOverInstancesInRectangle(x, y, x, y, func);
+  }
+
+  /**
+   * \brief Call \a func for each cell having instances starting in it (the
+   * top-left corner of their rectangle is in the cell), ordered by their
+   * coordinates, so that each instance is given once.
+   *
+   * Instances covering too many cells to be put in each of them are not
+   * given.
+   */
+  void IterateOverCells(
+      const std::function<void(int cellX,
+                               int cellY,
+                               const std::vector<gd::InitialInstance *> &)>
+          &func) const;
+
+ protected:
+  /**
+   * \brief Compute the rectangle covered by the instance.
+   */
+  virtual void GetInstanceBounds(const gd::InitialInstance &instance,
+                                 double &left,
+                                 double &top,
+                                 double &right,
+                                 double &bottom) const;
+
+ private:
+  struct Entry {
+    gd::InitialInstance *instance;
+    double left;
+    double top;
+    double right;
+    double bottom;
+    int minCellX;  ///< The first cell of the instance, used to give it only
+    int minCellY;  ///< once when it's in several cells.
+  };
+
+  struct Location {
+    int minCellX;
+    int minCellY;
+    int maxCellX;
+    int maxCellY;
+    bool isLarge;  ///< True if the instance is in largeEntries instead
+                   ///< of in the cells.
+  };
+
+  int GetCellCoordinate(double position) const;
+  static std::uint64_t GetCellKey(int cellX, int cellY);
+  static void RemoveEntry(std::vector<Entry> &entries,
+                          const gd::InitialInstance &instance);
+
+  double cellSize;
+  std::unordered_map<std::uint64_t, std::vector<Entry>> cells;
+  std::vector<Entry> largeEntries;  ///< Instances covering too many cells to
+                                    ///< be put in each of them.
+  std::unordered_map<const gd::InitialInstance *, Location> locations;
+};
+
+}  // namespace gd
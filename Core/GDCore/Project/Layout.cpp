@@ -28,6 +28,7 @@
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/PerfScope.h"
 #include "GDCore/Tools/PolymorphicClone.h"
 
 using namespace std;
@@ -64,6 +65,7 @@ Layout::Layout()
 void Layout::SetName(const gd::String& name_) {
   name = name_;
   mangledName = gd::SceneNameMangler::Get()->GetMangledSceneName(name);
+  gd::EventsList::NotifyLinksModified();
 };
 
 bool Layout::HasBehaviorSharedData(const gd::String& behaviorName) {
@@ -237,7 +239,33 @@ std::unique_ptr<gd::BehaviorsSharedData> Layout::CreateBehaviorsSharedData(
   return std::unique_ptr<gd::BehaviorsSharedData>(sharedData);
 }
 
-void Layout::SerializeTo(SerializerElement& element) const {
+void Layout::SerializeTo(SerializerElement& element,
+                         bool stripForExport) const {
+  SerializeSettingsTo(element);
+
+  if (stripForExport)
+    element.AddChild("objectsGroups").ConsiderAsArrayOf("group");
+  else
+    objectsContainer.GetObjectGroups().SerializeTo(
+        element.AddChild("objectsGroups"));
+  GetVariables().SerializeTo(element.AddChild("variables"));
+  GetInitialInstances().SerializeTo(element.AddChild("instances"));
+  objectsContainer.SerializeObjectsTo(element.AddChild("objects"),
+                                      stripForExport);
+  objectsContainer.SerializeFoldersTo(
+      element.AddChild("objectsFolderStructure"));
+  if (stripForExport)
+    element.AddChild("events").ConsiderAsArrayOf("event");
+  else
+    gd::EventsListSerialization::SerializeEventsTo(events,
+                                                   element.AddChild("events"));
+
+  layers.SerializeLayersTo(element.AddChild("layers"));
+
+  SerializeBehaviorsSharedDataTo(element.AddChild("behaviorsSharedData"));
+}
+
+void Layout::SerializeSettingsTo(SerializerElement& element) const {
   element.SetAttribute("name", GetName());
   element.SetAttribute("mangledName", GetMangledName());
   element.SetAttribute("r", (int)GetBackgroundColorRed());
@@ -254,21 +282,10 @@ void Layout::SerializeTo(SerializerElement& element) const {
                        disableInputWhenNotFocused);
 
   editorSettings.SerializeTo(element.AddChild("uiSettings"));
+}
 
-  objectsContainer.GetObjectGroups().SerializeTo(
-      element.AddChild("objectsGroups"));
-  GetVariables().SerializeTo(element.AddChild("variables"));
-  GetInitialInstances().SerializeTo(element.AddChild("instances"));
-  objectsContainer.SerializeObjectsTo(element.AddChild("objects"));
-  objectsContainer.SerializeFoldersTo(
-      element.AddChild("objectsFolderStructure"));
-  gd::EventsListSerialization::SerializeEventsTo(events,
-                                                 element.AddChild("events"));
-
-  layers.SerializeLayersTo(element.AddChild("layers"));
-
-  SerializerElement& behaviorDatasElement =
-      element.AddChild("behaviorsSharedData");
+void Layout::SerializeBehaviorsSharedDataTo(
+    SerializerElement& behaviorDatasElement) const {
   behaviorDatasElement.ConsiderAsArrayOf("behaviorSharedData");
   for (const auto& it : behaviorsSharedData) {
     const gd::BehaviorsSharedData& sharedData = *it.second;
@@ -303,6 +320,8 @@ void Layout::SerializeTo(SerializerElement& element) const {
 
 void Layout::UnserializeFrom(gd::Project& project,
                              const SerializerElement& element) {
+  gd::PerfScope perfScope("Layout::UnserializeFrom");
+  gd::PerfScope::IncrementCounter("layoutsLoaded");
   SetBackgroundColor(element.GetIntAttribute("r"),
                      element.GetIntAttribute("v"),
                      element.GetIntAttribute("b"));
@@ -394,7 +413,8 @@ void Layout::UnserializeFrom(gd::Project& project,
 }
 
 void Layout::Init(const Layout& other) {
-  SetName(other.name);
+  name = other.name;
+  mangledName = other.mangledName;
   backgroundColorR = other.backgroundColorR;
   backgroundColorG = other.backgroundColorG;
   backgroundColorB = other.backgroundColorB;
@@ -388,7 +388,20 @@ class GD_CORE_API Layout {
   /**
    * \brief Serialize the layout.
    */
-  void SerializeTo(SerializerElement& element) const;
+  void SerializeTo(SerializerElement& element) const {
+    SerializeTo(element, false);
+  }
+
+  /**
+   * \brief Serialize the layout as needed by the game engine: events and
+   * objects groups (which are only used to generate the events code) are not
+   * serialized and the default behaviors of the objects are.
+   *
+   * \see gd::Project::SerializeForExportTo
+   */
+  void SerializeForExportTo(SerializerElement& element) const {
+    SerializeTo(element, true);
+  }
 
   /**
    * \brief Unserialize the layout.
@@ -397,6 +410,8 @@ class GD_CORE_API Layout {
   ///@}
 
  private:
+  friend class LayoutSnapshot;
+
   gd::String name;         ///< Scene name
   gd::String mangledName;  ///< The scene name mangled by SceneNameMangler
   unsigned int backgroundColorR = 0;     ///< Background color Red component
@@ -433,6 +448,18 @@ class GD_CORE_API Layout {
    */
   void Init(const gd::Layout& other);
 
+  void SerializeTo(SerializerElement& element, bool stripForExport) const;
+
+  /**
+   * \brief Serialize the attributes and the editor settings of the layout.
+   */
+  void SerializeSettingsTo(SerializerElement& element) const;
+
+  /**
+   * \brief Serialize the initial shared data of the behaviors.
+   */
+  void SerializeBehaviorsSharedDataTo(SerializerElement& element) const;
+
   std::unique_ptr<gd::BehaviorsSharedData> CreateBehaviorsSharedData(
       gd::Project& project,
       const gd::String& name,
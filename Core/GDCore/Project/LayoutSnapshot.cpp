@@ -0,0 +1,197 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/LayoutSnapshot.h"
+
+#include <unordered_set>
+
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+const std::size_t settingsPartIndex = 0;
+const std::size_t instancesPartIndex = 2;
+
+void AddInstance(
+    gd::SerializerElement &instancesElement,
+    std::unordered_map<gd::String, std::shared_ptr<gd::SerializerElement>>
+        &index,
+    const gd::String &persistentUuid,
+    std::shared_ptr<gd::SerializerElement> instanceElement) {
+  instancesElement.AddSharedChild("instance", instanceElement);
+
+  // Instances with the same UUID are not shared: they can't be told apart.
+  auto inserted = index.emplace(persistentUuid, instanceElement);
+  if (!inserted.second) inserted.first->second = nullptr;
+}
+}  // namespace
+
+namespace gd {
+
+std::shared_ptr<SerializerElement> LayoutSnapshot::SerializePart(
+    const gd::Layout &layout, std::size_t partIndex) {
+  auto element = std::make_shared<SerializerElement>();
+  switch (1 << partIndex) {
+    case Settings:
+      layout.SerializeSettingsTo(*element);
+      layout.SerializeBehaviorsSharedDataTo(
+          element->AddChild("behaviorsSharedData"));
+      break;
+    case Variables:
+      layout.GetVariables().SerializeTo(element->AddChild("variables"));
+      break;
+    case Instances:
+      layout.GetInitialInstances().SerializeTo(element->AddChild("instances"));
+      break;
+    case Objects:
+      layout.GetObjects().GetObjectGroups().SerializeTo(
+          element->AddChild("objectsGroups"));
+      layout.GetObjects().SerializeObjectsTo(element->AddChild("objects"),
+                                             false);
+      layout.GetObjects().SerializeFoldersTo(
+          element->AddChild("objectsFolderStructure"));
+      break;
+    case Events:
+      gd::EventsListSerialization::SerializeEventsTo(
+          layout.GetEvents(), element->AddChild("events"));
+      break;
+    case Layers:
+      layout.GetLayers().SerializeLayersTo(element->AddChild("layers"));
+      break;
+  }
+  return element;
+}
+
+void LayoutSnapshot::Take(const gd::Layout &layout) {
+  for (std::size_t i = 0; i < PartsCount; ++i)
+    parts[i] = SerializePart(layout, i);
+  instancesIndex.reset();
+}
+
+void LayoutSnapshot::TakeNext(
+    const LayoutSnapshot &previous,
+    const gd::Layout &layout,
+    unsigned int changedParts,
+    const std::vector<gd::String> &changedInstancesUuids) {
+  if (previous.IsEmpty()) {
+    Take(layout);
+    return;
+  }
+
+  for (std::size_t i = 0; i < PartsCount; ++i) {
+    parts[i] = (changedParts & (1 << i)) ? SerializePart(layout, i)
+                                          : previous.parts[i];
+  }
+  instancesIndex =
+      parts[instancesPartIndex] == previous.parts[instancesPartIndex]
+          ? previous.instancesIndex
+          : nullptr;
+  if ((changedParts & Instances) || changedInstancesUuids.empty()) return;
+
+  // Only some instances were changed: serialize them again and share the
+  // others with the previous snapshot.
+  const InstancesIndex &previousIndex = previous.GetInstancesIndex();
+  std::unordered_set<gd::String> changedUuids(changedInstancesUuids.begin(),
+                                              changedInstancesUuids.end());
+  auto index = std::make_shared<InstancesIndex>();
+  index->reserve(layout.GetInitialInstances().GetInstancesCount());
+
+  parts[instancesPartIndex] = std::make_shared<SerializerElement>();
+  SerializerElement &instancesElement =
+      parts[instancesPartIndex]->AddChild("instances");
+  instancesElement.ConsiderAsArrayOf("instance");
+  layout.GetInitialInstances().IterateOverInstances(
+      [&](const gd::InitialInstance &instance) {
+        const gd::String &persistentUuid = instance.GetPersistentUuid();
+        if (!persistentUuid.empty() && !changedUuids.count(persistentUuid)) {
+          auto it = previousIndex.find(persistentUuid);
+          if (it != previousIndex.end() && it->second) {
+            AddInstance(instancesElement, *index, persistentUuid, it->second);
+            return false;
+          }
+        }
+
+        auto instanceElement = std::make_shared<SerializerElement>();
+        instance.SerializeTo(*instanceElement);
+        AddInstance(instancesElement,
+                    *index,
+                    instance.GetPersistentUuid(),
+                    instanceElement);
+        return false;
+      });
+
+  instancesIndex = index;
+}
+
+const LayoutSnapshot::InstancesIndex &LayoutSnapshot::GetInstancesIndex()
+    const {
+  if (!instancesIndex) {
+    auto index = std::make_shared<InstancesIndex>();
+    if (parts[instancesPartIndex]) {
+      const SerializerElement &instancesElement =
+          parts[instancesPartIndex]->GetChild("instances");
+      for (const auto &child : instancesElement.GetAllChildren()) {
+        auto inserted = index->emplace(
+            child.second->GetStringAttribute("persistentUuid"), child.second);
+        if (!inserted.second) inserted.first->second = nullptr;
+      }
+    }
+    instancesIndex = index;
+  }
+
+  return *instancesIndex;
+}
+
+void LayoutSnapshot::RestoreTo(gd::Project &project,
+                               gd::Layout &layout) const {
+  if (IsEmpty()) return;
+
+  SerializerElement element;
+  SerializeTo(element);
+  layout.UnserializeFrom(project, element);
+}
+
+void LayoutSnapshot::SerializeTo(SerializerElement &element) const {
+  if (IsEmpty()) return;
+
+  // The settings are small: they are copied, with the attributes of the
+  // layout. The other parts are shared.
+  element = *parts[settingsPartIndex];
+  for (std::size_t i = 0; i < PartsCount; ++i) {
+    if (i == settingsPartIndex) continue;
+    for (const auto &child : parts[i]->GetAllChildren())
+      element.AddSharedChild(child.first, child.second);
+  }
+}
+
+bool LayoutSnapshot::IsPartSharedWith(const LayoutSnapshot &other,
+                                      Part part) const {
+  for (std::size_t i = 0; i < PartsCount; ++i) {
+    if (part == (1 << i)) return parts[i] && parts[i] == other.parts[i];
+  }
+  return false;
+}
+
+std::size_t LayoutSnapshot::GetSharedInstancesCount(
+    const LayoutSnapshot &other) const {
+  if (IsEmpty() || other.IsEmpty()) return 0;
+
+  std::unordered_set<const SerializerElement *> otherInstances;
+  for (const auto &child :
+       other.parts[instancesPartIndex]->GetChild("instances").GetAllChildren())
+    otherInstances.insert(child.second.get());
+
+  std::size_t count = 0;
+  for (const auto &child :
+       parts[instancesPartIndex]->GetChild("instances").GetAllChildren()) {
+    if (otherInstances.count(child.second.get())) count++;
+  }
+  return count;
+}
+
+}  // namespace gd
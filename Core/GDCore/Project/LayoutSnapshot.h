@@ -0,0 +1,138 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class Layout;
+class Project;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A snapshot of a gd::Layout, to undo or redo the changes made to it,
+ * sharing its unchanged parts with the previous snapshot.
+ *
+ * A layout is snapshotted as several parts (see Part): a new snapshot is
+ * taken from the previous one, telling which parts were changed since. Only
+ * these parts are serialized again, the others are shared with the previous
+ * snapshot (snapshots are never modified once taken). The instances are
+ * also shared one by one: when only some instances were changed, only these
+ * instances (identified by their persistent UUID) are serialized again.
+ *
+ * Taking a snapshot after an edition then costs (in time and in memory) in
+ * proportion to the changed parts, instead of the whole layout.
+ *
+ * \warning Changes are not detected automatically: all the parts changed
+ * since the previous snapshot must be given, otherwise the outdated parts are
+ * kept.
+ *
+ * \see gd::InitialInstancesDelta
+ */
+class GD_CORE_API LayoutSnapshot {
+ public:
+  /**
+   * \brief The parts of a layout that are shared between snapshots.
+   */
+  enum Part {
+    Settings = 1 << 0,  ///< The properties, the editor settings and the
+                        ///< shared data of the behaviors.
+    Variables = 1 << 1,
+    Instances = 1 << 2,
+    Objects = 1 << 3,  ///< The objects, the groups and the folders.
+    Events = 1 << 4,
+    Layers = 1 << 5,
+    AllParts = (1 << 6) - 1,
+  };
+
+  LayoutSnapshot(){};
+  virtual ~LayoutSnapshot(){};
+
+  /**
+   * \brief Take a snapshot of the whole layout.
+   */
+  void Take(const gd::Layout &layout);
+
+  /**
+   * \brief Take a snapshot of the layout, serializing only the parts changed
+   * since the previous snapshot.
+   *
+   * \param previous The previous snapshot of the same layout. If empty, the
+   * whole layout is snapshotted.
+   * \param changedParts The parts changed since the previous snapshot (see
+   * Part).
+   * \param changedInstancesUuids The persistent UUIDs of the instances
+   * changed, added or removed since the previous snapshot, when the
+   * Instances part is not entirely changed.
+   */
+  void TakeNext(const LayoutSnapshot &previous,
+                const gd::Layout &layout,
+                unsigned int changedParts,
+                const std::vector<gd::String> &changedInstancesUuids = {});
+
+  /**
+   * \brief Return true if no snapshot was taken.
+   */
+  bool IsEmpty() const { return !parts[0]; }
+
+  /**
+   * \brief Give back to the layout the state it had when the snapshot was
+   * taken.
+   */
+  void RestoreTo(gd::Project &project, gd::Layout &layout) const;
+
+  /**
+   * \brief Serialize the layout as it was when the snapshot was taken (as
+   * done by gd::Layout::SerializeTo).
+   *
+   * The parts of the snapshot are shared with the element (except for the
+   * Settings part): they must not be modified.
+   */
+  void SerializeTo(SerializerElement &element) const;
+
+  /**
+   * \brief Return true if the part is shared with the other snapshot (i.e:
+   * was not serialized again).
+   */
+  bool IsPartSharedWith(const LayoutSnapshot &other, Part part) const;
+
+  /**
+   * \brief Return the number of instances shared with the other snapshot.
+   */
+  std::size_t GetSharedInstancesCount(const LayoutSnapshot &other) const;
+
+ private:
+  static constexpr std::size_t PartsCount = 6;
+
+  using InstancesIndex =
+      std::unordered_map<gd::String, std::shared_ptr<SerializerElement>>;
+
+  static std::shared_ptr<SerializerElement> SerializePart(
+      const gd::Layout &layout, std::size_t partIndex);
+
+  /**
+   * \brief Return the serialized instances, by persistent UUID. Instances
+   * sharing the same UUID can't be shared and are indexed with
+   * nullptr.
+   */
+  const InstancesIndex &GetInstancesIndex() const;
+
+  std::shared_ptr<SerializerElement>
+      parts[PartsCount];  ///< The serialized parts, in the order of Part.
+                          ///< Their children are merged in the layout
+                          ///< element.
+  mutable std::shared_ptr<const InstancesIndex>
+      instancesIndex;  ///< Built when first needed.
+};
+
+}  // namespace gd
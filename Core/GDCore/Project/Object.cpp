@@ -5,12 +5,16 @@
  */
 #include "GDCore/Project/Object.h"
 
+#include <algorithm>
+
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/CustomBehavior.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/ObjectsContainersList.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Project/QuickCustomization.h"
@@ -26,8 +30,10 @@ Object::Object(const gd::String& name_,
                const gd::String& type_,
                std::unique_ptr<gd::ObjectConfiguration> configuration_)
     : name(name_),
+      instancesPoolSize(0),
       configuration(std::move(configuration_)),
-      objectVariables(gd::VariablesContainer::SourceType::Object) {
+      objectVariables(gd::VariablesContainer::SourceType::Object),
+      container(nullptr) {
   SetType(type_);
 }
 
@@ -35,8 +41,10 @@ Object::Object(const gd::String& name_,
                const gd::String& type_,
                gd::ObjectConfiguration* configuration_)
     : name(name_),
+      instancesPoolSize(0),
       configuration(configuration_),
-      objectVariables(gd::VariablesContainer::SourceType::Object) {
+      objectVariables(gd::VariablesContainer::SourceType::Object),
+      container(nullptr) {
   SetType(type_);
 }
 
@@ -46,9 +54,11 @@ void Object::Init(const gd::Object& object) {
 }
 
 void Object::CopyWithoutConfiguration(const gd::Object& object) {
+  gd::ObjectsContainersList::InvalidateResolutions();
   persistentUuid = object.persistentUuid;
-  name = object.name;
+  SetName(object.name);
   assetStoreId = object.assetStoreId;
+  instancesPoolSize = object.instancesPoolSize;
   objectVariables = object.objectVariables;
   effectsContainer = object.effectsContainer;
 
@@ -58,6 +68,20 @@ void Object::CopyWithoutConfiguration(const gd::Object& object) {
   }
 }
 
+void Object::SetName(const gd::String& name_) {
+  if (name_ == name) return;
+
+  gd::String oldName = name;
+  name = name_;
+  if (container) container->OnObjectRenamed(*this, oldName);
+  gd::ObjectsContainersList::InvalidateResolutions();
+}
+
+void Object::SetType(const gd::String& type_) {
+  GetConfiguration().SetType(type_);
+  gd::ObjectsContainersList::InvalidateResolutions();
+}
+
 gd::ObjectConfiguration& Object::GetConfiguration() { return *configuration; }
 
 const gd::ObjectConfiguration& Object::GetConfiguration() const {
@@ -72,7 +96,10 @@ std::vector<gd::String> Object::GetAllBehaviorNames() const {
   return allNameIdentifiers;
 }
 
-void Object::RemoveBehavior(const gd::String& name) { behaviors.erase(name); }
+void Object::RemoveBehavior(const gd::String& name) {
+  behaviors.erase(name);
+  gd::ObjectsContainersList::InvalidateResolutions();
+}
 
 bool Object::RenameBehavior(const gd::String& name, const gd::String& newName) {
   if (behaviors.find(name) == behaviors.end() ||
@@ -83,6 +110,7 @@ bool Object::RenameBehavior(const gd::String& name, const gd::String& newName) {
   behaviors.erase(name);
   behaviors[newName] = std::move(aut);
   behaviors[newName]->SetName(newName);
+  gd::ObjectsContainersList::InvalidateResolutions();
 
   return true;
 }
@@ -106,6 +134,7 @@ gd::Behavior* Object::AddNewBehavior(const gd::Project& project,
                            &name](std::unique_ptr<gd::Behavior> behavior) {
     behavior->InitializeContent();
     this->behaviors[name] = std::move(behavior);
+    gd::ObjectsContainersList::InvalidateResolutions();
     return this->behaviors[name].get();
   };
 
@@ -136,7 +165,9 @@ void Object::UnserializeFrom(gd::Project& project,
 
   SetType(element.GetStringAttribute("type"));
   assetStoreId = element.GetStringAttribute("assetStoreId");
-  name = element.GetStringAttribute("name", name, "nom");
+  instancesPoolSize =
+      std::max(0, element.GetIntAttribute("instancesPoolSize", 0));
+  SetName(element.GetStringAttribute("name", name, "nom"));
 
   objectVariables.UnserializeFrom(
       element.GetChild("variables", 0, "Variables"));
@@ -219,13 +250,17 @@ void Object::UnserializeFrom(gd::Project& project,
   configuration->UnserializeFrom(project, element);
 }
 
-void Object::SerializeTo(SerializerElement& element) const {
+void Object::SerializeTo(SerializerElement& element,
+                         bool includeDefaultBehaviors) const {
   if (!persistentUuid.empty())
     element.SetStringAttribute("persistentUuid", persistentUuid);
 
   element.SetAttribute("name", GetName());
   element.SetAttribute("assetStoreId", GetAssetStoreId());
   element.SetAttribute("type", GetType());
+  if (instancesPoolSize > 0)
+    element.SetAttribute("instancesPoolSize",
+                         static_cast<int>(instancesPoolSize));
   objectVariables.SerializeTo(element.AddChild("variables"));
   effectsContainer.SerializeTo(element.AddChild("effects"));
 
@@ -236,7 +271,7 @@ void Object::SerializeTo(SerializerElement& element) const {
     const gd::Behavior& behavior = GetBehavior(allBehaviors[i]);
     // Default behaviors are added at the object creation according to
     // metadata. They don't need to be serialized.
-    if (behavior.IsDefaultBehavior()) {
+    if (behavior.IsDefaultBehavior() && !includeDefaultBehaviors) {
       continue;
     }
     SerializerElement& behaviorElement = behaviorsElement.AddChild("behavior");
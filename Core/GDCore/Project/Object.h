@@ -25,6 +25,7 @@ class ArbitraryResourceWorker;
 class InitialInstance;
 class SerializerElement;
 class EffectsContainer;
+class ObjectsContainer;
 }  // namespace gd
 
 namespace gd {
@@ -55,7 +56,7 @@ class GD_CORE_API Object {
   /**
    * Copy constructor. Calls Init().
    */
-  Object(const gd::Object& object) { Init(object); };
+  Object(const gd::Object& object) : container(nullptr) { Init(object); };
 
   /**
    * Assignment operator. Calls Init().
@@ -97,8 +98,11 @@ class GD_CORE_API Object {
   ///@{
 
   /** \brief Change the name of the object with the name passed as parameter.
+   *
+   * The container owning the object, if any, is told so that the object can
+   * still be found by its name.
    */
-  void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_);
 
   /** \brief Return the name of the object.
    */
@@ -114,9 +118,24 @@ class GD_CORE_API Object {
    */
   const gd::String& GetAssetStoreId() const { return assetStoreId; };
 
+  /** \brief Change the maximum number of deleted instances of the object
+   * kept by the game engine to be reused when instances are created (0 to use
+   * the default of the game engine).
+   *
+   * Useful for objects created and deleted very often (bullets, particles...).
+   */
+  void SetInstancesPoolSize(std::size_t instancesPoolSize_) {
+    instancesPoolSize = instancesPoolSize_;
+  };
+
+  /** \brief Return the maximum number of deleted instances of the object
+   * kept to be reused, or 0 to use the default of the game engine.
+   */
+  std::size_t GetInstancesPoolSize() const { return instancesPoolSize; };
+
   /** \brief Change the type of the object.
    */
-  void SetType(const gd::String& type_) { configuration->SetType(type_); }
+  void SetType(const gd::String& type_);
 
   /** \brief Return the type of the object.
    */
@@ -225,9 +244,15 @@ class GD_CORE_API Object {
   ///@{
   /**
    * \brief Serialize the object.
+   *
+   * Default behaviors are not serialized (they are added back according to
+   * the metadata when the object is created), unless
+   * \a includeDefaultBehaviors is true (useful for the game engine).
+   *
    * \see DoSerializeTo
    */
-  void SerializeTo(SerializerElement& element) const;
+  void SerializeTo(SerializerElement& element,
+                   bool includeDefaultBehaviors = false) const;
 
   /**
    * \brief Unserialize the object.
@@ -252,6 +277,8 @@ class GD_CORE_API Object {
   gd::String name;          ///< The full name of the object
   gd::String assetStoreId;  ///< The ID of the asset if the object comes from
                             ///< the store.
+  std::size_t instancesPoolSize;  ///< The maximum number of deleted instances
+                                  ///< kept to be reused (0 for the default).
   std::unique_ptr<gd::ObjectConfiguration> configuration;
   std::map<gd::String, std::unique_ptr<gd::Behavior>>
       behaviors;  ///< Contains all behaviors and their properties for the
@@ -272,6 +299,13 @@ class GD_CORE_API Object {
    * behaviors and it must be a deep copy.
    */
   void Init(const gd::Object& object);
+
+ private:
+  friend class gd::ObjectsContainer;
+
+  gd::ObjectsContainer*
+      container;  ///< The container owning the object, if any, that must be
+                  ///< told when the object is renamed. Not copied.
 };
 
 /**
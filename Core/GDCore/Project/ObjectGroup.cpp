@@ -9,6 +9,8 @@
 #include <algorithm>
 #include <vector>
 
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/ObjectsContainersList.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 
@@ -16,26 +18,64 @@ using namespace std;
 
 namespace gd {
 
+ObjectGroup::ObjectGroup(const ObjectGroup& other)
+    : memberObjects(other.memberObjects),
+      name(other.name),
+      container(nullptr) {}
+
+ObjectGroup& ObjectGroup::operator=(const ObjectGroup& other) {
+  if (this != &other) {
+    if (container) container->RemoveGroupFromObjectsIndex(*this);
+    memberObjects = other.memberObjects;
+    name = other.name;
+    if (container) container->AddGroupToObjectsIndex(*this);
+    gd::ObjectsContainersList::InvalidateResolutions();
+  }
+
+  return *this;
+}
+
+void ObjectGroup::SetName(const gd::String& name_) {
+  name = name_;
+  gd::ObjectsContainersList::InvalidateResolutions();
+}
+
 bool ObjectGroup::Find(const gd::String& name) const {
+  if (container) return container->IsObjectInGroup(name, *this);
+
   return std::find(memberObjects.begin(), memberObjects.end(), name) !=
          memberObjects.end();
 }
 
 void ObjectGroup::AddObject(const gd::String& name) {
-  if (!Find(name)) memberObjects.push_back(name);
+  if (Find(name)) return;
+
+  memberObjects.push_back(name);
+  if (container) container->AddToObjectsIndex(*this, name);
+  gd::ObjectsContainersList::InvalidateResolutions();
 }
 
 void ObjectGroup::RemoveObject(const gd::String& name) {
+  if (container) container->RemoveFromObjectsIndex(*this, name);
+
   memberObjects.erase(
       std::remove(memberObjects.begin(), memberObjects.end(), name),
       memberObjects.end());
+  gd::ObjectsContainersList::InvalidateResolutions();
 }
 
 void ObjectGroup::RenameObject(const gd::String& oldName,
                                const gd::String& newName) {
+  if (oldName == newName || !Find(oldName)) return;
+
+  if (container) {
+    container->RemoveFromObjectsIndex(*this, oldName);
+    container->AddToObjectsIndex(*this, newName);
+  }
   for (auto& object : memberObjects) {
     if (object == oldName) object = newName;
   }
+  gd::ObjectsContainersList::InvalidateResolutions();
 }
 
 void ObjectGroup::SerializeTo(SerializerElement& element) const {
@@ -50,6 +90,7 @@ void ObjectGroup::SerializeTo(SerializerElement& element) const {
 
 void ObjectGroup::UnserializeFrom(const SerializerElement& element) {
   SetName(element.GetStringAttribute("name", "", "nom"));
+  if (container) container->RemoveGroupFromObjectsIndex(*this);
   memberObjects.clear();
 
   // Compatibility with GD <= 3.3
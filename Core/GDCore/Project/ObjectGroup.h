@@ -12,6 +12,7 @@
 #include "GDCore/String.h"
 
 namespace gd {
+class ObjectGroupsContainer;
 class SerializerElement;
 }
 
@@ -27,8 +28,10 @@ namespace gd {
  */
 class GD_CORE_API ObjectGroup {
  public:
-  ObjectGroup(){};
+  ObjectGroup() : container(nullptr){};
+  ObjectGroup(const ObjectGroup&);
   virtual ~ObjectGroup(){};
+  ObjectGroup& operator=(const ObjectGroup& rhs);
 
   /**
    * \brief Return true if an object is found inside the ObjectGroup.
@@ -56,7 +59,7 @@ class GD_CORE_API ObjectGroup {
 
   /** \brief Change group name
    */
-  inline void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_);
 
   /**
    * \brief Get a vector with objects names.
@@ -76,8 +79,13 @@ class GD_CORE_API ObjectGroup {
   void UnserializeFrom(const SerializerElement& element);
 
  private:
+  friend class gd::ObjectGroupsContainer;
+
   std::vector<gd::String> memberObjects;
   gd::String name;  ///< Group name
+  gd::ObjectGroupsContainer*
+      container;  ///< The container owning the group, if any, that must be
+                  ///< told when objects are added or removed. Not copied.
 };
 
 }  // namespace gd
@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectsContainersList.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/MakeUnique.h"
@@ -32,8 +33,10 @@ ObjectGroupsContainer& ObjectGroupsContainer::operator=(
 
 void ObjectGroupsContainer::Init(const ObjectGroupsContainer& other) {
   objectGroups.clear();
+  groupsByObject.clear();
   for (auto& it : other.objectGroups) {
     objectGroups.push_back(gd::make_unique<gd::ObjectGroup>(*it));
+    AddGroupToObjectsIndex(*objectGroups.back());
   }
 }
 
@@ -45,7 +48,7 @@ void ObjectGroupsContainer::SerializeTo(SerializerElement& element) const {
 }
 
 void ObjectGroupsContainer::UnserializeFrom(const SerializerElement& element) {
-  objectGroups.clear();
+  Clear();
   element.ConsiderAsArrayOf("group", "Groupe");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     const SerializerElement& groupElement = element.GetChild(i);
@@ -99,6 +102,9 @@ const ObjectGroup& ObjectGroupsContainer::Get(const gd::String& name) const {
 }
 
 void ObjectGroupsContainer::Remove(const gd::String& name) {
+  for (auto& group : objectGroups) {
+    if (group->GetName() == name) RemoveGroupFromObjectsIndex(*group);
+  }
   objectGroups.erase(
       std::remove_if(objectGroups.begin(),
                      objectGroups.end(),
@@ -123,6 +129,7 @@ ObjectGroup& ObjectGroupsContainer::InsertNew(const gd::String& name,
                                      : objectGroups.end(),
       gd::make_unique<gd::ObjectGroup>())));
   newlyInsertedGroup.SetName(name);
+  AddGroupToObjectsIndex(newlyInsertedGroup);
   return newlyInsertedGroup;
 }
 
@@ -132,6 +139,7 @@ ObjectGroup& ObjectGroupsContainer::Insert(const gd::ObjectGroup& group,
       position < objectGroups.size() ? objectGroups.begin() + position
                                      : objectGroups.end(),
       gd::make_unique<gd::ObjectGroup>(group))));
+  AddGroupToObjectsIndex(newlyInsertedGroup);
   return newlyInsertedGroup;
 }
 
@@ -152,6 +160,12 @@ bool ObjectGroupsContainer::Rename(const gd::String& oldName,
   return true;
 }
 
+void ObjectGroupsContainer::Clear() {
+  objectGroups.clear();
+  groupsByObject.clear();
+  gd::ObjectsContainersList::InvalidateResolutions();
+}
+
 void ObjectGroupsContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
   if (oldIndex >= objectGroups.size() || newIndex >= objectGroups.size())
     return;
@@ -171,4 +185,89 @@ void ObjectGroupsContainer::ForEachNameMatchingSearch(
   }
 }
 
+bool ObjectGroupsContainer::IsObjectInGroup(const gd::String& objectName,
+                                            const gd::String& groupName) const {
+  auto it = groupsByObject.find(objectName);
+  if (it == groupsByObject.end()) return false;
+
+  for (const gd::ObjectGroup* group : it->second) {
+    if (group->GetName() == groupName) return true;
+  }
+  return false;
+}
+
+std::vector<gd::String> ObjectGroupsContainer::GetGroupsContainingObject(
+    const gd::String& objectName) const {
+  std::vector<gd::String> groupsNames;
+  auto it = groupsByObject.find(objectName);
+  if (it == groupsByObject.end()) return groupsNames;
+
+  for (const gd::ObjectGroup* group : it->second)
+    groupsNames.push_back(group->GetName());
+  return groupsNames;
+}
+
+void ObjectGroupsContainer::RemoveObjectFromGroups(
+    const gd::String& objectName) {
+  auto it = groupsByObject.find(objectName);
+  if (it == groupsByObject.end()) return;
+
+  // Removing the object from a group updates the index, so iterate on a copy.
+  const std::vector<gd::ObjectGroup*> groups = it->second;
+  for (gd::ObjectGroup* group : groups) group->RemoveObject(objectName);
+}
+
+void ObjectGroupsContainer::RenameObjectInGroups(const gd::String& oldName,
+                                                 const gd::String& newName) {
+  auto it = groupsByObject.find(oldName);
+  if (it == groupsByObject.end()) return;
+
+  // Renaming the object in a group updates the index, so iterate on a copy.
+  const std::vector<gd::ObjectGroup*> groups = it->second;
+  for (gd::ObjectGroup* group : groups) group->RenameObject(oldName, newName);
+}
+
+bool ObjectGroupsContainer::IsObjectInGroup(
+    const gd::String& objectName, const gd::ObjectGroup& group) const {
+  auto it = groupsByObject.find(objectName);
+  if (it == groupsByObject.end()) return false;
+
+  return std::find(it->second.begin(), it->second.end(), &group) !=
+         it->second.end();
+}
+
+void ObjectGroupsContainer::AddToObjectsIndex(gd::ObjectGroup& group,
+                                              const gd::String& objectName) {
+  gd::ObjectsContainersList::InvalidateResolutions();
+  auto& groups = groupsByObject[objectName];
+  if (std::find(groups.begin(), groups.end(), &group) == groups.end())
+    groups.push_back(&group);
+}
+
+void ObjectGroupsContainer::RemoveFromObjectsIndex(
+    gd::ObjectGroup& group, const gd::String& objectName) {
+  gd::ObjectsContainersList::InvalidateResolutions();
+  auto it = groupsByObject.find(objectName);
+  if (it == groupsByObject.end()) return;
+
+  auto& groups = it->second;
+  groups.erase(std::remove(groups.begin(), groups.end(), &group),
+               groups.end());
+  if (groups.empty()) groupsByObject.erase(it);
+}
+
+void ObjectGroupsContainer::AddGroupToObjectsIndex(gd::ObjectGroup& group) {
+  gd::ObjectsContainersList::InvalidateResolutions();
+  group.container = this;
+  for (const gd::String& objectName : group.memberObjects)
+    AddToObjectsIndex(group, objectName);
+}
+
+void ObjectGroupsContainer::RemoveGroupFromObjectsIndex(
+    gd::ObjectGroup& group) {
+  gd::ObjectsContainersList::InvalidateResolutions();
+  for (const gd::String& objectName : group.memberObjects)
+    RemoveFromObjectsIndex(group, objectName);
+}
+
 }  // namespace gd
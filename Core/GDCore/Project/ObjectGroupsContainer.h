@@ -8,6 +8,7 @@
 #define GDCORE_OBJECTGROUPSCONTAINER_H
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Project/ObjectGroup.h"
@@ -115,7 +116,7 @@ class GD_CORE_API ObjectGroupsContainer {
   /**
    * \brief Clear all groups of the container.
    */
-  inline void Clear() { objectGroups.clear(); }
+  void Clear();
 
   /**
    * \brief Call the callback for each group name matching the specified search.
@@ -123,6 +124,46 @@ class GD_CORE_API ObjectGroupsContainer {
   void ForEachNameMatchingSearch(const gd::String& search, std::function<void(const gd::String& name)> fn) const;
   ///@}
 
+  /** \name Objects of the groups
+   * Members functions to know or change in which groups an object is, without
+   * going through the objects of every group.
+   */
+  ///@{
+  /**
+   * \brief Return true if the object called \a objectName is in at least one
+   * group of the container.
+   */
+  bool IsObjectInAnyGroup(const gd::String& objectName) const {
+    return groupsByObject.find(objectName) != groupsByObject.end();
+  }
+
+  /**
+   * \brief Return true if the object called \a objectName is in the group
+   * called \a groupName.
+   */
+  bool IsObjectInGroup(const gd::String& objectName,
+                       const gd::String& groupName) const;
+
+  /**
+   * \brief Return the names of the groups containing the object called \a
+   * objectName, in the order the object was added to them.
+   */
+  std::vector<gd::String> GetGroupsContainingObject(
+      const gd::String& objectName) const;
+
+  /**
+   * \brief Remove the object called \a objectName from all the groups.
+   */
+  void RemoveObjectFromGroups(const gd::String& objectName);
+
+  /**
+   * \brief Rename the object called \a oldName in all the groups containing
+   * it.
+   */
+  void RenameObjectInGroups(const gd::String& oldName,
+                            const gd::String& newName);
+  ///@}
+
   /** \name Saving and loading
    * Members functions related to saving and loading the object.
    */
@@ -187,7 +228,20 @@ class GD_CORE_API ObjectGroupsContainer {
   void Init(const gd::ObjectGroupsContainer& other);
 
  private:
+  friend class gd::ObjectGroup;
+
+  bool IsObjectInGroup(const gd::String& objectName,
+                       const gd::ObjectGroup& group) const;
+  void AddToObjectsIndex(gd::ObjectGroup& group, const gd::String& objectName);
+  void RemoveFromObjectsIndex(gd::ObjectGroup& group,
+                              const gd::String& objectName);
+  void AddGroupToObjectsIndex(gd::ObjectGroup& group);
+  void RemoveGroupFromObjectsIndex(gd::ObjectGroup& group);
+
   std::vector<std::unique_ptr<gd::ObjectGroup>> objectGroups;
+  std::unordered_map<gd::String, std::vector<gd::ObjectGroup*>>
+      groupsByObject;  ///< The groups containing each object. Kept up to date
+                       ///< by the groups of the container when they change.
   static ObjectGroup badGroup;
 };
 
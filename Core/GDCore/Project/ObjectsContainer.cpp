@@ -6,14 +6,47 @@
 #include "GDCore/Project/ObjectsContainer.h"
 
 #include <algorithm>
+#include <unordered_map>
 
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectFolderOrObject.h"
+#include "GDCore/Project/ObjectsContainersList.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/PolymorphicClone.h"
 
+namespace {
+
+/**
+ * Copy the children of a folder, the objects being replaced by their copies.
+ */
+void CopyFolderChildren(
+    const gd::ObjectFolderOrObject& folder,
+    gd::ObjectFolderOrObject& newFolder,
+    const std::unordered_map<const gd::Object*, gd::Object*>& newObjects) {
+  for (std::size_t i = 0; i < folder.GetChildrenCount(); ++i) {
+    const gd::ObjectFolderOrObject& child = folder.GetChildAt(i);
+    if (child.IsFolder()) {
+      gd::ObjectFolderOrObject& newChild = newFolder.InsertNewFolder(
+          child.GetFolderName(), newFolder.GetChildrenCount());
+      newChild.SetQuickCustomizationVisibility(
+          child.GetQuickCustomizationVisibility());
+      CopyFolderChildren(child, newChild, newObjects);
+    } else {
+      auto it = newObjects.find(&child.GetObject());
+      if (it == newObjects.end()) continue;
+
+      newFolder.InsertObject(it->second);
+      newFolder.GetChildAt(newFolder.GetChildrenCount() - 1)
+          .SetQuickCustomizationVisibility(
+              child.GetQuickCustomizationVisibility());
+    }
+  }
+}
+
+}  // namespace
+
 namespace gd {
 
 ObjectsContainer::ObjectsContainer(
@@ -38,15 +71,23 @@ void ObjectsContainer::Init(const gd::ObjectsContainer& other) {
   sourceType = other.sourceType;
   initialObjects = gd::Clone(other.initialObjects);
   objectGroups = other.objectGroups;
-  // The objects folders are not copied.
-  // It's not an issue because the UI uses the serialization for duplication.
+  UpdateObjectsIndex();
+
+  std::unordered_map<const gd::Object*, gd::Object*> newObjects;
+  for (std::size_t i = 0; i < initialObjects.size(); ++i)
+    newObjects[other.initialObjects[i].get()] = initialObjects[i].get();
   rootFolder = gd::make_unique<gd::ObjectFolderOrObject>("__ROOT");
+  rootFolder->SetQuickCustomizationVisibility(
+      other.rootFolder->GetQuickCustomizationVisibility());
+  CopyFolderChildren(*other.rootFolder, *rootFolder, newObjects);
 }
 
-void ObjectsContainer::SerializeObjectsTo(SerializerElement& element) const {
+void ObjectsContainer::SerializeObjectsTo(SerializerElement& element,
+                                          bool includeDefaultBehaviors) const {
   element.ConsiderAsArrayOf("object");
   for (std::size_t j = 0; j < initialObjects.size(); j++) {
-    initialObjects[j]->SerializeTo(element.AddChild("object"));
+    initialObjects[j]->SerializeTo(element.AddChild("object"),
+                                   includeDefaultBehaviors);
   }
 }
 void ObjectsContainer::SerializeFoldersTo(SerializerElement& element) const {
@@ -84,28 +125,112 @@ void ObjectsContainer::UnserializeObjectsFrom(
       std::cout << "WARNING: Unknown object type \"" << type << "\""
                 << std::endl;
   }
+  UpdateObjectsIndex();
+}
+
+void ObjectsContainer::UpdateObjectsIndex() {
+  gd::ObjectsContainersList::InvalidateResolutions();
+  objectsIndex.clear();
+  objectsIndex.reserve(initialObjects.size());
+  for (std::size_t i = 0; i < initialObjects.size(); ++i) {
+    initialObjects[i]->container = this;
+    // Keep the first object if several have the same name.
+    objectsIndex.emplace(initialObjects[i]->GetName(), i);
+  }
+}
+
+std::size_t ObjectsContainer::FindObjectPosition(const gd::String& name) const {
+  auto it = objectsIndex.find(name);
+  return it != objectsIndex.end() ? it->second : gd::String::npos;
+}
+
+void ObjectsContainer::IndexObject(std::size_t position) {
+  const gd::String& name = initialObjects[position]->GetName();
+  auto it = objectsIndex.find(name);
+  if (it == objectsIndex.end())
+    objectsIndex.emplace(name, position);
+  else if (it->second > position)
+    it->second = position;
+}
+
+void ObjectsContainer::UnindexObject(std::size_t position,
+                                     const gd::String& name) {
+  auto it = objectsIndex.find(name);
+  if (it == objectsIndex.end() || it->second != position) return;
+
+  objectsIndex.erase(it);
+  // Another object, after this one, can have the same name.
+  for (std::size_t i = position + 1; i < initialObjects.size(); ++i) {
+    if (initialObjects[i]->GetName() == name) {
+      objectsIndex.emplace(name, i);
+      return;
+    }
+  }
+}
+
+void ObjectsContainer::OnObjectInserted(std::size_t position) {
+  gd::ObjectsContainersList::InvalidateResolutions();
+  if (position >= initialObjects.size()) position = initialObjects.size() - 1;
+
+  // The next objects were moved by one (nothing to do when appending).
+  for (std::size_t i = initialObjects.size() - 1; i > position; --i) {
+    auto it = objectsIndex.find(initialObjects[i]->GetName());
+    if (it != objectsIndex.end() && it->second == i - 1) it->second = i;
+  }
+  initialObjects[position]->container = this;
+  IndexObject(position);
+}
+
+void ObjectsContainer::OnObjectRemoved(std::size_t position,
+                                       const gd::String& name) {
+  gd::ObjectsContainersList::InvalidateResolutions();
+  auto removedIt = objectsIndex.find(name);
+  bool wasIndexed =
+      removedIt != objectsIndex.end() && removedIt->second == position;
+  if (wasIndexed) objectsIndex.erase(removedIt);
+
+  // The next objects were moved back by one (nothing to do when removing the
+  // last one).
+  for (std::size_t i = position; i < initialObjects.size(); ++i) {
+    auto it = objectsIndex.find(initialObjects[i]->GetName());
+    if (it != objectsIndex.end() && it->second == i + 1) it->second = i;
+  }
+
+  if (!wasIndexed) return;
+  // Another object, after the removed one, can have the same name.
+  for (std::size_t i = position; i < initialObjects.size(); ++i) {
+    if (initialObjects[i]->GetName() == name) {
+      objectsIndex.emplace(name, i);
+      return;
+    }
+  }
+}
+
+void ObjectsContainer::OnObjectRenamed(const gd::Object& object,
+                                       const gd::String& oldName) {
+  std::size_t position = FindObjectPosition(oldName);
+  if (position == gd::String::npos ||
+      initialObjects[position].get() != &object) {
+    // The object is not the first one with this name.
+    position = gd::String::npos;
+    for (std::size_t i = 0; i < initialObjects.size(); ++i) {
+      if (initialObjects[i].get() == &object) position = i;
+    }
+    if (position == gd::String::npos) return;
+  }
+
+  UnindexObject(position, oldName);
+  IndexObject(position);
 }
 
 bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
-  return (find_if(initialObjects.begin(),
-                  initialObjects.end(),
-                  [&](const std::unique_ptr<gd::Object>& object) {
-                    return object->GetName() == name;
-                  }) != initialObjects.end());
+  return FindObjectPosition(name) != gd::String::npos;
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    [&](const std::unique_ptr<gd::Object>& object) {
-                      return object->GetName() == name;
-                    }));
+  return *initialObjects[FindObjectPosition(name)];
 }
 const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    [&](const std::unique_ptr<gd::Object>& object) {
-                      return object->GetName() == name;
-                    }));
+  return *initialObjects[FindObjectPosition(name)];
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
   return *initialObjects[index];
@@ -114,10 +239,7 @@ const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
   return *initialObjects[index];
 }
 std::size_t ObjectsContainer::GetObjectPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < initialObjects.size(); ++i) {
-    if (initialObjects[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return FindObjectPosition(name);
 }
 std::size_t ObjectsContainer::GetObjectsCount() const {
   return initialObjects.size();
@@ -130,6 +252,7 @@ gd::Object& ObjectsContainer::InsertNewObject(const gd::Project& project,
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
       project.CreateObject(objectType, name))));
+  OnObjectInserted(position);
 
   rootFolder->InsertObject(&newlyCreatedObject);
 
@@ -144,6 +267,7 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
     std::size_t position) {
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       initialObjects.end(), project.CreateObject(objectType, name))));
+  OnObjectInserted(gd::String::npos);
 
   objectFolderOrObject.InsertObject(&newlyCreatedObject, position);
 
@@ -156,6 +280,7 @@ gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
       std::unique_ptr<gd::Object>(object.Clone()))));
+  OnObjectInserted(position);
 
   return newlyCreatedObject;
 }
@@ -166,26 +291,29 @@ void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
 
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
+  OnObjectRemoved(oldIndex, object->GetName());
   initialObjects.insert(initialObjects.begin() + newIndex, std::move(object));
+  OnObjectInserted(newIndex);
 }
 
 void ObjectsContainer::RemoveObject(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Object>>::iterator objectIt =
-      find_if(initialObjects.begin(),
-              initialObjects.end(),
-              [&](const std::unique_ptr<gd::Object>& object) {
-                return object->GetName() == name;
-              });
-  if (objectIt == initialObjects.end()) return;
+  std::size_t position = FindObjectPosition(name);
+  if (position == gd::String::npos) return;
 
   rootFolder->RemoveRecursivelyObjectNamed(name);
 
-  initialObjects.erase(objectIt);
+  // Keep the object alive until the index is updated, as the name can be its
+  // own name.
+  std::unique_ptr<gd::Object> object = std::move(initialObjects[position]);
+  initialObjects.erase(initialObjects.begin() + position);
+  OnObjectRemoved(position, object->GetName());
 }
 
 void ObjectsContainer::Clear() {
   rootFolder->Clear();
   initialObjects.clear();
+  objectsIndex.clear();
+  gd::ObjectsContainersList::InvalidateResolutions();
 }
 
 void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
@@ -203,10 +331,13 @@ void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
       });
   if (objectIt == initialObjects.end()) return;
 
+  std::size_t position = objectIt - initialObjects.begin();
   std::unique_ptr<gd::Object> object = std::move(*objectIt);
   initialObjects.erase(objectIt);
+  OnObjectRemoved(position, object->GetName());
 
   newContainer.initialObjects.push_back(std::move(object));
+  newContainer.OnObjectInserted(gd::String::npos);
 
   objectFolderOrObject.GetParent().MoveObjectFolderOrObjectToAnotherFolder(
       objectFolderOrObject, newParentFolder, newPosition);
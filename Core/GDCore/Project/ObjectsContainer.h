@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <unordered_map>
 #include "GDCore/String.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/ObjectFolderOrObject.h"
@@ -173,6 +174,9 @@ class GD_CORE_API ObjectsContainer {
 
   /**
    * Provide a raw access to the vector containing the objects
+   *
+   * \note Call UpdateObjectsIndex after modifying the list, otherwise the
+   * objects won't be found by their names.
    */
   std::vector<std::unique_ptr<gd::Object> >& GetObjects() {
     return initialObjects;
@@ -185,6 +189,13 @@ class GD_CORE_API ObjectsContainer {
     return initialObjects;
   }
 
+  /**
+   * \brief Rebuild the index used to find the objects by name. To be called
+   * after the objects list was modified from outside of the container (renaming
+   * an object is fine, the object tells its container).
+   */
+  void UpdateObjectsIndex();
+
   std::set<gd::String> GetAllObjectNames() const;
   ///@}
 
@@ -207,8 +218,11 @@ class GD_CORE_API ObjectsContainer {
   ///@{
   /**
    * \brief Serialize the objects container.
+   *
+   * \see gd::Object::SerializeTo
    */
-  void SerializeObjectsTo(SerializerElement& element) const;
+  void SerializeObjectsTo(SerializerElement& element,
+                          bool includeDefaultBehaviors = false) const;
 
   /**
    * \brief Unserialize the objects container.
@@ -250,8 +264,50 @@ class GD_CORE_API ObjectsContainer {
   gd::ObjectGroupsContainer objectGroups;
 
  private:
+  friend class gd::Object;
+
   SourceType sourceType = Unknown;
   std::unique_ptr<gd::ObjectFolderOrObject> rootFolder;
+  std::unordered_map<gd::String, std::size_t>
+      objectsIndex;  ///< The position of the objects, by name.
+
+  /**
+   * Return the position of the object called \a name, or gd::String::npos.
+   *
+   * The index is kept up to date by the container (and by the objects when
+   * they are renamed), so the list is never searched. It's never updated here
+   * so that the container can be read from several threads.
+   */
+  std::size_t FindObjectPosition(const gd::String& name) const;
+
+  /**
+   * Index the object at \a position, unless an object before it has the same
+   * name.
+   */
+  void IndexObject(std::size_t position);
+
+  /**
+   * Remove the object at \a position, called \a name, from the index. The
+   * next object with the same name, if any, is indexed instead.
+   */
+  void UnindexObject(std::size_t position, const gd::String& name);
+
+  /**
+   * Update the index after an object was inserted at \a position (or at the
+   * end of the list if \a position is invalid).
+   */
+  void OnObjectInserted(std::size_t position);
+
+  /**
+   * Update the index after the object called \a name was removed from
+   * \a position.
+   */
+  void OnObjectRemoved(std::size_t position, const gd::String& name);
+
+  /**
+   * Update the index after \a object, owned by the container, was renamed.
+   */
+  void OnObjectRenamed(const gd::Object& object, const gd::String& oldName);
 
   /**
    * Initialize from another variables container, copying elements. Used by
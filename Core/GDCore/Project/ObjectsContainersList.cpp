@@ -12,6 +12,8 @@
 
 namespace gd {
 
+std::atomic<std::size_t> ObjectsContainersList::resolutionsGeneration(0);
+
 ObjectsContainersList
 ObjectsContainersList::MakeNewEmptyObjectsContainersList() {
   ObjectsContainersList objectsContainersList;
@@ -53,15 +55,34 @@ ObjectsContainersList::MakeNewObjectsContainersListForContainer(
   return objectsContainersList;
 }
 
-bool ObjectsContainersList::HasObjectOrGroupNamed(
-    const gd::String& name) const {
+ObjectsContainersList::Resolution& ObjectsContainersList::GetResolution(
+    const gd::String& objectOrGroupName) const {
+  const std::size_t generation = resolutionsGeneration;
+  if (resolutionsGenerationOfList != generation) {
+    resolutions.clear();
+    resolutionsGenerationOfList = generation;
+  }
+
+  auto resolutionIt = resolutions.find(objectOrGroupName);
+  if (resolutionIt != resolutions.end()) return resolutionIt->second;
+
+  Resolution& resolution = resolutions[objectOrGroupName];
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
        ++it) {
-    if ((*it)->HasObjectNamed(name) || (*it)->GetObjectGroups().Has(name))
-      return true;
+    if ((*it)->HasObjectNamed(objectOrGroupName) ||
+        (*it)->GetObjectGroups().Has(objectOrGroupName)) {
+      resolution.objectsContainer = *it;
+      break;
+    }
   }
 
-  return false;
+  return resolution;
+}
+
+bool ObjectsContainersList::HasObjectOrGroupNamed(
+    const gd::String& name) const {
+  std::lock_guard<std::mutex> lock(resolutionsMutex);
+  return GetResolution(name).objectsContainer != nullptr;
 }
 
 bool ObjectsContainersList::HasObjectNamed(const gd::String& name) const {
@@ -348,44 +369,42 @@ void ObjectsContainersList::ForEachNameMatchingSearch(
 std::vector<gd::String> ObjectsContainersList::ExpandObjectName(
     const gd::String& objectOrGroupName,
     const gd::String& onlyObjectToSelectIfPresent) const {
-  std::vector<gd::String> realObjects;
-
-  // Check progressively each object container to find the object or the group
-  // with the specified name.
-  for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
-       ++it) {
-    if ((*it)->HasObjectNamed(objectOrGroupName)) {
+  std::lock_guard<std::mutex> lock(resolutionsMutex);
+  Resolution& resolution = GetResolution(objectOrGroupName);
+  if (!resolution.hasObjectNames) {
+    const gd::ObjectsContainer* objectsContainer = resolution.objectsContainer;
+    if (objectsContainer &&
+        objectsContainer->HasObjectNamed(objectOrGroupName)) {
       // We found the object, it's a single object with this name.
-      realObjects.push_back(objectOrGroupName);
-      break;
-    }
-    if ((*it)->GetObjectGroups().Has(objectOrGroupName)) {
+      resolution.objectNames.push_back(objectOrGroupName);
+    } else if (objectsContainer) {
       // We found a group with this name, expand the object names inside of it.
-      realObjects =
-          (*it)->GetObjectGroups().Get(objectOrGroupName).GetAllObjectsNames();
-      break;
+      resolution.objectNames = objectsContainer->GetObjectGroups()
+                                   .Get(objectOrGroupName)
+                                   .GetAllObjectsNames();
     }
+
+    // Ensure that all returned objects actually exists (i.e: if some groups
+    // have names referring to non existing objects, don't return them).
+    for (const gd::String& objectName : resolution.objectNames) {
+      if (HasObjectNamed(objectName))
+        resolution.existingObjectNames.push_back(objectName);
+    }
+    resolution.hasObjectNames = true;
   }
 
   // If the "current object" is present, use it and only it.
   if (!onlyObjectToSelectIfPresent.empty() &&
-      find(realObjects.begin(),
-           realObjects.end(),
-           onlyObjectToSelectIfPresent) != realObjects.end()) {
-    realObjects.clear();
-    realObjects.push_back(onlyObjectToSelectIfPresent);
+      find(resolution.objectNames.begin(),
+           resolution.objectNames.end(),
+           onlyObjectToSelectIfPresent) != resolution.objectNames.end()) {
+    std::vector<gd::String> realObjects;
+    if (HasObjectNamed(onlyObjectToSelectIfPresent))
+      realObjects.push_back(onlyObjectToSelectIfPresent);
+    return realObjects;
   }
 
-  // Ensure that all returned objects actually exists (i.e: if some groups have
-  // names referring to non existing objects, don't return them).
-  for (std::size_t i = 0; i < realObjects.size();) {
-    if (!HasObjectNamed(realObjects[i]))
-      realObjects.erase(realObjects.begin() + i);
-    else
-      ++i;
-  }
-
-  return realObjects;
+  return resolution.existingObjectNames;
 }
 
 void ObjectsContainersList::ForEachObject(
@@ -401,6 +420,17 @@ void ObjectsContainersList::ForEachObject(
 
 gd::String ObjectsContainersList::GetTypeOfObject(
     const gd::String& objectName) const {
+  std::lock_guard<std::mutex> lock(resolutionsMutex);
+  Resolution& resolution = GetResolution(objectName);
+  if (!resolution.hasType) {
+    resolution.type = ResolveTypeOfObject(objectName);
+    resolution.hasType = true;
+  }
+  return resolution.type;
+}
+
+gd::String ObjectsContainersList::ResolveTypeOfObject(
+    const gd::String& objectName) const {
   if (objectsContainers.size() > 2) {
     std::cout << this << std::endl;
     std::cout << objectsContainers.size() << std::endl;
@@ -511,6 +541,19 @@ gd::String ObjectsContainersList::GetTypeOfBehavior(
 
 std::vector<gd::String> ObjectsContainersList::GetBehaviorsOfObject(
     const gd::String& objectName, bool searchInGroups) const {
+  std::lock_guard<std::mutex> lock(resolutionsMutex);
+  Resolution& resolution = GetResolution(objectName);
+  const std::size_t index = searchInGroups ? 1 : 0;
+  if (!resolution.hasBehaviors[index]) {
+    resolution.behaviors[index] =
+        ResolveBehaviorsOfObject(objectName, searchInGroups);
+    resolution.hasBehaviors[index] = true;
+  }
+  return resolution.behaviors[index];
+}
+
+std::vector<gd::String> ObjectsContainersList::ResolveBehaviorsOfObject(
+    const gd::String& objectName, bool searchInGroups) const {
   if (objectsContainers.size() > 2) {
     // TODO: rework forwarded methods so they can work with any number of
     // containers.
@@ -624,14 +667,8 @@ std::vector<gd::String> ObjectsContainersList::GetAnimationNamesOfObject(
 const ObjectsContainer *
 ObjectsContainersList::GetObjectsContainerFromObjectName(
     const gd::String &objectOrGroupName) const {
-  for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
-       ++it) {
-    if ((*it)->HasObjectNamed(objectOrGroupName) ||
-        (*it)->GetObjectGroups().Has(objectOrGroupName)) {
-      return *it;
-    }
-  }
-  return nullptr;
+  std::lock_guard<std::mutex> lock(resolutionsMutex);
+  return GetResolution(objectOrGroupName).objectsContainer;
 }
 
 const gd::ObjectsContainer::SourceType
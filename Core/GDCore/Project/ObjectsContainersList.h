@@ -1,4 +1,7 @@
 #pragma once
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "Variable.h"
@@ -19,6 +22,16 @@ namespace gd {
  * \brief A list of objects containers, useful for accessing objects in a
  * scoped way, along with methods to access them.
  *
+ * The container, the type, the behaviors and the objects of each object or
+ * group name are remembered when they are first asked (by the expression
+ * validators and the code generators for almost each node). They are
+ * computed again after any object, group or objects container of the
+ * project was modified (see InvalidateResolutions).
+ *
+ * The remembered resolutions are guarded by a mutex, so a list can be used
+ * by tasks running in parallel (as long as the project is not modified while
+ * they run).
+ *
  * \see gd::Object
  * \see gd::ObjectsContainer
  * \see gd::Project
@@ -30,6 +43,18 @@ class GD_CORE_API ObjectsContainersList {
  public:
   virtual ~ObjectsContainersList(){};
 
+  ObjectsContainersList(const ObjectsContainersList& other)
+      : objectsContainers(other.objectsContainers){};
+
+  ObjectsContainersList& operator=(const ObjectsContainersList& other) {
+    if (this != &other) {
+      std::lock_guard<std::mutex> lock(resolutionsMutex);
+      objectsContainers = other.objectsContainers;
+      resolutions.clear();
+    }
+    return *this;
+  };
+
   static ObjectsContainersList MakeNewEmptyObjectsContainersList();
 
   static ObjectsContainersList MakeNewObjectsContainersListForProjectAndLayout(
@@ -225,6 +250,14 @@ class GD_CORE_API ObjectsContainersList {
    */
   std::size_t GetObjectsContainersCount() const;
 
+  /**
+   * \brief Forget the resolutions of names remembered by all the lists.
+   *
+   * Called when objects, groups or objects containers are modified. Code
+   * modifying them directly must call it too.
+   */
+  static void InvalidateResolutions() { resolutionsGeneration++; }
+
   /** Do not use - should be private but accessible to let Emscripten create a
    * temporary. */
   ObjectsContainersList(){};
@@ -252,9 +285,40 @@ class GD_CORE_API ObjectsContainersList {
 
   void Add(const gd::ObjectsContainer& objectsContainer) {
     objectsContainers.push_back(&objectsContainer);
+    resolutions.clear();
+  };
+
+  /**
+   * \brief What is known about an object or group name, each part being
+   * computed when first asked.
+   */
+  struct Resolution {
+    /** The container having the object or group, if any. */
+    const gd::ObjectsContainer* objectsContainer = nullptr;
+    bool hasType = false;
+    gd::String type;
+    bool hasBehaviors[2] = {false, false};  ///< Without and with groups.
+    std::vector<gd::String> behaviors[2];
+    bool hasObjectNames = false;
+    /** The object, or the objects of the group, even if not existing. */
+    std::vector<gd::String> objectNames;
+    std::vector<gd::String> existingObjectNames;
   };
 
+  /**
+   * \brief Return the resolution of a name. \a resolutionsMutex must be
+   * locked while it's used.
+   */
+  Resolution& GetResolution(const gd::String& objectOrGroupName) const;
+  gd::String ResolveTypeOfObject(const gd::String& objectName) const;
+  std::vector<gd::String> ResolveBehaviorsOfObject(
+      const gd::String& objectName, bool searchInGroups) const;
+
   std::vector<const gd::ObjectsContainer*> objectsContainers;
+  mutable std::unordered_map<gd::String, Resolution> resolutions;
+  mutable std::size_t resolutionsGenerationOfList = 0;
+  mutable std::mutex resolutionsMutex;  ///< Guards resolutions.
+  static std::atomic<std::size_t> resolutionsGeneration;
 };
 
 }  // namespace gd
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include <cctype>
 #include <fstream>
 #include <map>
+#include <set>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
@@ -35,6 +36,9 @@
 #include "GDCore/String.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MemoryTracker.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/PerfScope.h"
 #include "GDCore/Tools/PolymorphicClone.h"
 #include "GDCore/Tools/UUID/UUID.h"
 #include "GDCore/Tools/VersionWrapper.h"
@@ -306,19 +310,27 @@ bool Project::HasLayoutNamed(const gd::String& name) const {
                   }) != scenes.end());
 }
 gd::Layout& Project::GetLayout(const gd::String& name) {
-  return *(*find_if(
+  gd::Layout& layout = *(*find_if(
       scenes.begin(), scenes.end(), [&name](const std::unique_ptr<gd::Layout>& layout) {
         return layout->GetName() == name;
       }));
+  EnsureLayoutUnserialized(layout);
+  return layout;
 }
 const gd::Layout& Project::GetLayout(const gd::String& name) const {
-  return *(*find_if(
+  const gd::Layout& layout = *(*find_if(
       scenes.begin(), scenes.end(), [&name](const std::unique_ptr<gd::Layout>& layout) {
         return layout->GetName() == name;
       }));
+  EnsureLayoutUnserialized(layout);
+  return layout;
+}
+gd::Layout& Project::GetLayout(std::size_t index) {
+  EnsureLayoutUnserialized(*scenes[index]);
+  return *scenes[index];
 }
-gd::Layout& Project::GetLayout(std::size_t index) { return *scenes[index]; }
 const gd::Layout& Project::GetLayout(std::size_t index) const {
+  EnsureLayoutUnserialized(*scenes[index]);
   return *scenes[index];
 }
 std::size_t Project::GetLayoutPosition(const gd::String& name) const {
@@ -365,6 +377,7 @@ void Project::RemoveLayout(const gd::String& name) {
       });
   if (scene == scenes.end()) return;
 
+  lazilyUnserializedLayouts.erase(scene->get());
   scenes.erase(scene);
 }
 
@@ -505,24 +518,30 @@ bool Project::HasExternalLayoutNamed(const gd::String& name) const {
                   }) != externalLayouts.end());
 }
 gd::ExternalLayout& Project::GetExternalLayout(const gd::String& name) {
-  return *(*find_if(externalLayouts.begin(),
+  gd::ExternalLayout& externalLayout = *(*find_if(externalLayouts.begin(),
                     externalLayouts.end(),
                     [&name](const std::unique_ptr<gd::ExternalLayout>& externalLayout) {
                       return externalLayout->GetName() == name;
                     }));
+  EnsureExternalLayoutUnserialized(externalLayout);
+  return externalLayout;
 }
 const gd::ExternalLayout& Project::GetExternalLayout(
     const gd::String& name) const {
-  return *(*find_if(externalLayouts.begin(),
+  const gd::ExternalLayout& externalLayout = *(*find_if(externalLayouts.begin(),
                     externalLayouts.end(),
                     [&name](const std::unique_ptr<gd::ExternalLayout>& externalLayout) {
                       return externalLayout->GetName() == name;
                     }));
+  EnsureExternalLayoutUnserialized(externalLayout);
+  return externalLayout;
 }
 gd::ExternalLayout& Project::GetExternalLayout(std::size_t index) {
+  EnsureExternalLayoutUnserialized(*externalLayouts[index]);
   return *externalLayouts[index];
 }
 const gd::ExternalLayout& Project::GetExternalLayout(std::size_t index) const {
+  EnsureExternalLayoutUnserialized(*externalLayouts[index]);
   return *externalLayouts[index];
 }
 std::size_t Project::GetExternalLayoutPosition(const gd::String& name) const {
@@ -566,6 +585,7 @@ void Project::RemoveExternalLayout(const gd::String& name) {
               });
   if (externalLayout == externalLayouts.end()) return;
 
+  lazilyUnserializedExternalLayouts.erase(externalLayout->get());
   externalLayouts.erase(externalLayout);
 }
 
@@ -668,7 +688,10 @@ void Project::ClearEventsFunctionsExtensions() {
   eventsFunctionsExtensions.clear();
 }
 
-void Project::UnserializeFrom(const SerializerElement& element) {
+void Project::UnserializeFrom(const SerializerElement& element,
+                              bool lazilyUnserializeLayouts) {
+  gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::ProjectModel);
+  gd::PerfScope perfScope("Project::UnserializeFrom");
   const SerializerElement& gdVersionElement =
       element.GetChild("gdVersion", 0, "GDVersion");
   gdMajorVersion =
@@ -876,6 +899,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
   scenes.clear();
+  lazilyUnserializedLayouts.clear();
   const SerializerElement& layoutsElement =
       element.GetChild("layouts", 0, "Scenes");
   layoutsElement.ConsiderAsArrayOf("layout", "Scene");
@@ -884,7 +908,11 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 
     gd::Layout& layout = InsertNewLayout(
         layoutElement.GetStringAttribute("name", "", "nom"), -1);
-    layout.UnserializeFrom(*this, layoutElement);
+    if (lazilyUnserializeLayouts)
+      lazilyUnserializedLayouts[&layout] =
+          gd::make_unique<gd::SerializerElement>(layoutElement);
+    else
+      layout.UnserializeFrom(*this, layoutElement);
   }
   SetFirstLayout(element.GetChild("firstLayout").GetStringValue());
 
@@ -903,6 +931,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   }
 
   externalLayouts.clear();
+  lazilyUnserializedExternalLayouts.clear();
   const SerializerElement& externalLayoutsElement =
       element.GetChild("externalLayouts", 0, "ExternalLayouts");
   externalLayoutsElement.ConsiderAsArrayOf("externalLayout", "ExternalLayout");
@@ -910,16 +939,64 @@ void Project::UnserializeFrom(const SerializerElement& element) {
     const SerializerElement& externalLayoutElement =
         externalLayoutsElement.GetChild(i);
 
-    gd::ExternalLayout& newExternalLayout =
-        InsertNewExternalLayout("", GetExternalLayoutsCount());
-    newExternalLayout.UnserializeFrom(externalLayoutElement);
+    if (lazilyUnserializeLayouts) {
+      gd::ExternalLayout& newExternalLayout = InsertNewExternalLayout(
+          externalLayoutElement.GetStringAttribute("name", "", "Name"),
+          GetExternalLayoutsCount());
+      lazilyUnserializedExternalLayouts[&newExternalLayout] =
+          gd::make_unique<gd::SerializerElement>(externalLayoutElement);
+    } else {
+      gd::ExternalLayout& newExternalLayout =
+          InsertNewExternalLayout("", GetExternalLayoutsCount());
+      newExternalLayout.UnserializeFrom(externalLayoutElement);
+    }
   }
 }
 
+void Project::EnsureLayoutUnserialized(const gd::Layout& layout) const {
+  if (lazilyUnserializedLayouts.empty()) return;
+
+  auto it = lazilyUnserializedLayouts.find(&layout);
+  if (it == lazilyUnserializedLayouts.end()) return;
+
+  std::unique_ptr<gd::SerializerElement> layoutElement = std::move(it->second);
+  lazilyUnserializedLayouts.erase(it);
+
+  // The layout is only being completed: from the point of view of the
+  // caller, the project and the layout are unchanged.
+  const_cast<gd::Layout&>(layout).UnserializeFrom(
+      const_cast<gd::Project&>(*this), *layoutElement);
+}
+
+void Project::EnsureExternalLayoutUnserialized(
+    const gd::ExternalLayout& externalLayout) const {
+  if (lazilyUnserializedExternalLayouts.empty()) return;
+
+  auto it = lazilyUnserializedExternalLayouts.find(&externalLayout);
+  if (it == lazilyUnserializedExternalLayouts.end()) return;
+
+  std::unique_ptr<gd::SerializerElement> externalLayoutElement =
+      std::move(it->second);
+  lazilyUnserializedExternalLayouts.erase(it);
+
+  const_cast<gd::ExternalLayout&>(externalLayout)
+      .UnserializeFrom(*externalLayoutElement);
+}
+
+void Project::EnsureAllLayoutsUnserialized() const {
+  for (const auto& layout : scenes) EnsureLayoutUnserialized(*layout);
+  for (const auto& externalLayout : externalLayouts)
+    EnsureExternalLayoutUnserialized(*externalLayout);
+}
+
 void Project::UnserializeAndInsertExtensionsFrom(
   const gd::SerializerElement &eventsFunctionsExtensionsElement) {
+  gd::PerfScope perfScope("Project::UnserializeAndInsertExtensionsFrom");
   eventsFunctionsExtensionsElement.ConsiderAsArrayOf(
       "eventsFunctionsExtension");
+  gd::PerfScope::IncrementCounter(
+      "eventsFunctionsExtensionsLoaded",
+      eventsFunctionsExtensionsElement.GetChildrenCount());
 
   std::map<gd::String, size_t> extensionNameToElementIndex;
   std::map<gd::String, gd::SerializerElement> objectTypeToVariantsElement;
@@ -993,6 +1070,7 @@ void Project::UnserializeAndInsertExtensionsFrom(
 
 std::vector<gd::String> Project::GetUnserializingOrderExtensionNames(
     const gd::SerializerElement &eventsFunctionsExtensionsElement) {
+  gd::PerfScope perfScope("Project::GetUnserializingOrderExtensionNames");
   eventsFunctionsExtensionsElement.ConsiderAsArrayOf(
       "eventsFunctionsExtension");
 
@@ -1000,83 +1078,101 @@ std::vector<gd::String> Project::GetUnserializingOrderExtensionNames(
   // These child objects must be loaded completely before the parent custom obejct can be unserialized.
   // This implies: an order on the extension unserialization (and no cycles).
 
-  // At the beginning, everything is yet to be loaded.
+  const std::size_t extensionsCount =
+      eventsFunctionsExtensionsElement.GetChildrenCount();
+  std::vector<gd::String> extensionNames(extensionsCount);
   std::map<gd::String, size_t> extensionNameToElementIndex;
-  std::vector<gd::String> remainingExtensionNames(
-      eventsFunctionsExtensionsElement.GetChildrenCount());
-  for (std::size_t i = 0; i < eventsFunctionsExtensionsElement.GetChildrenCount(); ++i) {
+  std::map<gd::String, std::vector<size_t>> extensionNameToPositions;
+  for (std::size_t i = 0; i < extensionsCount; ++i) {
     const SerializerElement& eventsFunctionsExtensionElement =
         eventsFunctionsExtensionsElement.GetChild(i);
     const gd::String& name = eventsFunctionsExtensionElement.GetStringAttribute("name");
 
-    remainingExtensionNames[i] = name;
+    extensionNames[i] = name;
     extensionNameToElementIndex[name] = i;
+    extensionNameToPositions[name].push_back(i);
   }
 
-  // Helper allowing to find if an extension has an object that depends on
-  // at least one other object from another extension that is not loaded yet.
-  auto isDependentFromRemainingExtensions =
-      [&remainingExtensionNames](
-          const gd::SerializerElement &eventsFunctionsExtensionElement) {
-        auto &eventsBasedObjectsElement =
-            eventsFunctionsExtensionElement.GetChild("eventsBasedObjects");
-        eventsBasedObjectsElement.ConsiderAsArrayOf("eventsBasedObject");
-        for (std::size_t eventsBasedObjectsIndex = 0;
-             eventsBasedObjectsIndex <
-             eventsBasedObjectsElement.GetChildrenCount();
-             ++eventsBasedObjectsIndex) {
-          auto &objectsElement =
-              eventsBasedObjectsElement.GetChild(eventsBasedObjectsIndex)
-                  .GetChild("objects");
-          objectsElement.ConsiderAsArrayOf("object");
-
-          for (std::size_t objectIndex = 0;
-               objectIndex < objectsElement.GetChildrenCount(); ++objectIndex) {
-            const gd::String &objectType =
-                objectsElement.GetChild(objectIndex).GetStringAttribute("type");
-
-            gd::String extensionName =
-                eventsFunctionsExtensionElement.GetStringAttribute("name");
-            gd::String usedExtensionName =
-                gd::PlatformExtension::GetExtensionFromFullObjectType(objectType);
-
-            if (usedExtensionName != extensionName &&
-                std::find(remainingExtensionNames.begin(),
-                          remainingExtensionNames.end(),
-                          usedExtensionName) != remainingExtensionNames.end()) {
-              return true;
-            }
-          }
-        }
-        return false;
-      };
-
-  // Find the order of loading so that the extensions are loaded when all the other
-  // extensions they depend on are already loaded.
-  std::vector<gd::String> loadOrderExtensionNames;
-  bool foundAnyExtension = true;
-  while (foundAnyExtension) {
-    foundAnyExtension = false;
-    for (std::size_t i = 0; i < remainingExtensionNames.size(); ++i) {
-      auto extensionName = remainingExtensionNames[i];
-
-      size_t elementIndex = extensionNameToElementIndex[extensionName];
-      const SerializerElement &eventsFunctionsExtensionElement =
-          eventsFunctionsExtensionsElement.GetChild(elementIndex);
-
-      if (!isDependentFromRemainingExtensions(
-              eventsFunctionsExtensionElement)) {
-        loadOrderExtensionNames.push_back(extensionName);
-        remainingExtensionNames.erase(remainingExtensionNames.begin() + i);
-        i--;
-        foundAnyExtension = true;
+  // Build the dependency graph in one pass: an extension depends on the
+  // extensions of the child objects of its custom objects.
+  std::vector<std::vector<size_t>> dependentPositions(extensionsCount);
+  std::vector<size_t> remainingDependenciesCounts(extensionsCount, 0);
+  for (std::size_t i = 0; i < extensionsCount; ++i) {
+    const gd::String& extensionName = extensionNames[i];
+    const SerializerElement& eventsFunctionsExtensionElement =
+        eventsFunctionsExtensionsElement.GetChild(
+            extensionNameToElementIndex[extensionName]);
+
+    std::set<gd::String> usedExtensionNames;
+    auto &eventsBasedObjectsElement =
+        eventsFunctionsExtensionElement.GetChild("eventsBasedObjects");
+    eventsBasedObjectsElement.ConsiderAsArrayOf("eventsBasedObject");
+    for (std::size_t eventsBasedObjectsIndex = 0;
+         eventsBasedObjectsIndex <
+         eventsBasedObjectsElement.GetChildrenCount();
+         ++eventsBasedObjectsIndex) {
+      auto &objectsElement =
+          eventsBasedObjectsElement.GetChild(eventsBasedObjectsIndex)
+              .GetChild("objects");
+      objectsElement.ConsiderAsArrayOf("object");
+
+      for (std::size_t objectIndex = 0;
+           objectIndex < objectsElement.GetChildrenCount(); ++objectIndex) {
+        const gd::String &objectType =
+            objectsElement.GetChild(objectIndex).GetStringAttribute("type");
+        gd::String usedExtensionName =
+            gd::PlatformExtension::GetExtensionFromFullObjectType(objectType);
+        if (usedExtensionName != extensionName)
+          usedExtensionNames.insert(usedExtensionName);
+      }
+    }
+
+    for (const gd::String &usedExtensionName : usedExtensionNames) {
+      auto positionsIt = extensionNameToPositions.find(usedExtensionName);
+      if (positionsIt == extensionNameToPositions.end()) continue;
+
+      for (size_t usedPosition : positionsIt->second) {
+        dependentPositions[usedPosition].push_back(i);
+        remainingDependenciesCounts[i]++;
       }
     }
   }
+
+  // Find the order of loading so that the extensions are loaded when all the
+  // other extensions they depend on are already loaded (extensions in a cycle
+  // are never loaded).
+  // Extensions are taken by sweeping the list, like if it was walked again
+  // and again until no extension can be loaded: an extension that can be
+  // loaded after the current position is loaded in the same sweep, otherwise
+  // in the next one. This keeps the order of the list when possible.
+  std::set<size_t> loadablePositions;
+  for (std::size_t i = 0; i < extensionsCount; ++i) {
+    if (remainingDependenciesCounts[i] == 0) loadablePositions.insert(i);
+  }
+
+  std::vector<gd::String> loadOrderExtensionNames;
+  loadOrderExtensionNames.reserve(extensionsCount);
+  size_t sweepPosition = 0;
+  while (!loadablePositions.empty()) {
+    auto it = loadablePositions.lower_bound(sweepPosition);
+    if (it == loadablePositions.end()) it = loadablePositions.begin();
+
+    const size_t position = *it;
+    loadablePositions.erase(it);
+    loadOrderExtensionNames.push_back(extensionNames[position]);
+    sweepPosition = position;
+
+    for (size_t dependentPosition : dependentPositions[position]) {
+      if (--remainingDependenciesCounts[dependentPosition] == 0)
+        loadablePositions.insert(dependentPosition);
+    }
+  }
   return loadOrderExtensionNames;
 }
 
-void Project::SerializeTo(SerializerElement& element) const {
+void Project::SerializeTo(SerializerElement& element,
+                          bool stripForExport) const {
+  gd::PerfScope perfScope("Project::SerializeTo");
   SerializerElement& versionElement = element.AddChild("gdVersion");
   versionElement.SetAttribute("major", gd::VersionWrapper::Major());
   versionElement.SetAttribute("minor", gd::VersionWrapper::Minor());
@@ -1176,20 +1272,29 @@ void Project::SerializeTo(SerializerElement& element) const {
   }
 
   resourcesManager.SerializeTo(element.AddChild("resources"));
-  objectsContainer.SerializeObjectsTo(element.AddChild("objects"));
+  objectsContainer.SerializeObjectsTo(element.AddChild("objects"),
+                                      stripForExport);
   objectsContainer.SerializeFoldersTo(element.AddChild("objectsFolderStructure"));
-  objectsContainer.GetObjectGroups().SerializeTo(element.AddChild("objectsGroups"));
+  if (stripForExport)
+    element.AddChild("objectsGroups").ConsiderAsArrayOf("group");
+  else
+    objectsContainer.GetObjectGroups().SerializeTo(element.AddChild("objectsGroups"));
   GetVariables().SerializeTo(element.AddChild("variables"));
 
   element.SetAttribute("firstLayout", firstLayout);
   gd::SerializerElement& layoutsElement = element.AddChild("layouts");
   layoutsElement.ConsiderAsArrayOf("layout");
-  for (std::size_t i = 0; i < GetLayoutsCount(); i++)
-    GetLayout(i).SerializeTo(layoutsElement.AddChild("layout"));
+  for (std::size_t i = 0; i < GetLayoutsCount(); i++) {
+    if (stripForExport)
+      GetLayout(i).SerializeForExportTo(layoutsElement.AddChild("layout"));
+    else
+      GetLayout(i).SerializeTo(layoutsElement.AddChild("layout"));
+  }
 
   SerializerElement& externalEventsElement = element.AddChild("externalEvents");
   externalEventsElement.ConsiderAsArrayOf("externalEvents");
-  for (std::size_t i = 0; i < GetExternalEventsCount(); ++i)
+  for (std::size_t i = 0; i < GetExternalEventsCount() && !stripForExport;
+       ++i)
     GetExternalEvents(i).SerializeTo(
         externalEventsElement.AddChild("externalEvents"));
 
@@ -1197,15 +1302,29 @@ void Project::SerializeTo(SerializerElement& element) const {
       element.AddChild("eventsFunctionsExtensions");
   eventsFunctionsExtensionsElement.ConsiderAsArrayOf(
       "eventsFunctionsExtension");
-  for (std::size_t i = 0; i < eventsFunctionsExtensions.size(); ++i)
-    eventsFunctionsExtensions[i]->SerializeTo(
+  for (std::size_t i = 0; i < eventsFunctionsExtensions.size(); ++i) {
+    const auto& extension = *eventsFunctionsExtensions[i];
+    if (!stripForExport) {
+      extension.SerializeTo(
+          eventsFunctionsExtensionsElement.AddChild("eventsFunctionsExtension"));
+      continue;
+    }
+
+    // Extensions are only needed by the game engine for their objects
+    // (to create the child-objects) and their variables.
+    if (extension.GetEventsBasedObjects().size() == 0 &&
+        extension.GetGlobalVariables().Count() == 0 &&
+        extension.GetSceneVariables().Count() == 0)
+      continue;
+    extension.SerializeForExportTo(
         eventsFunctionsExtensionsElement.AddChild("eventsFunctionsExtension"));
+  }
 
   SerializerElement& externalLayoutsElement =
       element.AddChild("externalLayouts");
   externalLayoutsElement.ConsiderAsArrayOf("externalLayout");
   for (std::size_t i = 0; i < externalLayouts.size(); ++i)
-    externalLayouts[i]->SerializeTo(
+    GetExternalLayout(i).SerializeTo(
         externalLayoutsElement.AddChild("externalLayout"));
 }
 
@@ -1306,6 +1425,9 @@ void Project::Init(const gd::Project& game) {
 
   objectsContainer = game.objectsContainer;
 
+  game.EnsureAllLayoutsUnserialized();
+  lazilyUnserializedLayouts.clear();
+  lazilyUnserializedExternalLayouts.clear();
   scenes = gd::Clone(game.scenes);
 
   externalEvents = gd::Clone(game.externalEvents);
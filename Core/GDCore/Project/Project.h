@@ -7,6 +7,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
@@ -623,14 +624,46 @@ class GD_CORE_API Project {
   /**
    * \brief Unserialize the project from an element.
    */
-  void UnserializeFrom(const SerializerElement& element);
+  void UnserializeFrom(const SerializerElement& element) {
+    UnserializeFrom(element, false);
+  }
+
+  /**
+   * \brief Unserialize the project from an element, deferring the
+   * unserialization of layouts and external layouts.
+   *
+   * Layouts and external layouts are created with their name only, and a
+   * copy of their element is kept. Each of them is then unserialized the
+   * first time it's accessed with GetLayout/GetExternalLayout (or when the
+   * project is serialized or copied). This is useful for tools only working
+   * on a few scenes of a large project.
+   */
+  void UnserializeLazilyFrom(const SerializerElement& element) {
+    UnserializeFrom(element, true);
+  }
 
   /**
    * \brief Serialize the project.
    *
    * "Dirty" flag is set to false when serialization is done.
    */
-  void SerializeTo(SerializerElement& element) const;
+  void SerializeTo(SerializerElement& element) const {
+    SerializeTo(element, false);
+  }
+
+  /**
+   * \brief Serialize the project as needed by the game engine, skipping the
+   * data only used by the editor or to generate the events code (events,
+   * objects groups, external events, extensions free functions and
+   * behaviors...).
+   *
+   * This gives the same result as serializing a copy of the project stripped
+   * with gd::ProjectStripper::StripProjectForExport, without having to copy
+   * the project or to serialize the stripped data.
+   */
+  void SerializeForExportTo(SerializerElement& element) const {
+    SerializeTo(element, true);
+  }
 
   /**
    * Get the major version of GDevelop used to save the project.
@@ -1072,6 +1105,30 @@ class GD_CORE_API Project {
    */
   void Init(const gd::Project& project);
 
+  void SerializeTo(SerializerElement& element, bool stripForExport) const;
+
+  void UnserializeFrom(const SerializerElement& element,
+                       bool lazilyUnserializeLayouts);
+
+  /**
+   * Unserialize the layout if its unserialization was deferred.
+   * \see gd::Project::UnserializeLazilyFrom
+   */
+  void EnsureLayoutUnserialized(const gd::Layout& layout) const;
+
+  /**
+   * Unserialize the external layout if its unserialization was deferred.
+   * \see gd::Project::UnserializeLazilyFrom
+   */
+  void EnsureExternalLayoutUnserialized(
+      const gd::ExternalLayout& externalLayout) const;
+
+  /**
+   * Unserialize all the layouts and external layouts with a deferred
+   * unserialization.
+   */
+  void EnsureAllLayoutsUnserialized() const;
+
   /**
    * Create an object configuration of the given type.
    *
@@ -1165,6 +1222,14 @@ class GD_CORE_API Project {
   mutable unsigned int gdBuildVersion =
       0;  ///< The GD build version used the last
           ///< time the project was saved.
+  mutable std::unordered_map<const gd::Layout*,
+                             std::unique_ptr<gd::SerializerElement> >
+      lazilyUnserializedLayouts;  ///< Elements of layouts not unserialized
+                                  ///< yet.
+  mutable std::unordered_map<const gd::ExternalLayout*,
+                             std::unique_ptr<gd::SerializerElement> >
+      lazilyUnserializedExternalLayouts;  ///< Elements of external layouts
+                                          ///< not unserialized yet.
 };
 
 }  // namespace gd
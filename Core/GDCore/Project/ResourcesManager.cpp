@@ -6,6 +6,7 @@
 
 #include "GDCore/Project/ResourcesManager.h"
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <unordered_set>
@@ -51,24 +52,47 @@ void ResourcesManager::Init(const ResourcesManager& other) {
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
     resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
+  UpdateResourcesIndex();
   folders.clear();
   for (std::size_t i = 0; i < other.folders.size(); ++i) {
     folders.push_back(other.folders[i]);
   }
 }
 
-Resource& ResourcesManager::GetResource(const gd::String& name) {
+std::size_t ResourcesManager::FindResourcePosition(
+    const gd::String& name) const {
+  auto it = resourcesIndex.find(name);
+  if (it != resourcesIndex.end() && it->second < resources.size() &&
+      resources[it->second]->GetName() == name)
+    return it->second;
+
+  // The index is outdated (a resource was renamed), or the resource does not
+  // exist.
   for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
+    if (resources[i]->GetName() == name) return i;
   }
+  return gd::String::npos;
+}
+
+void ResourcesManager::UpdateResourcesIndex() {
+  resourcesIndex.clear();
+  resourcesIndex.reserve(resources.size());
+  for (std::size_t i = 0; i < resources.size(); ++i) {
+    // Keep the first resource if several have the same name.
+    resourcesIndex.emplace(resources[i]->GetName(), i);
+  }
+}
+
+Resource& ResourcesManager::GetResource(const gd::String& name) {
+  std::size_t position = FindResourcePosition(name);
+  if (position != gd::String::npos) return *resources[position];
 
   return badResource;
 }
 
 const Resource& ResourcesManager::GetResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
-  }
+  std::size_t position = FindResourcePosition(name);
+  if (position != gd::String::npos) return *resources[position];
 
   return badResource;
 }
@@ -105,11 +129,7 @@ std::shared_ptr<Resource> ResourcesManager::CreateResource(
 }
 
 bool ResourcesManager::HasResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return true;
-  }
-
-  return false;
+  return FindResourcePosition(name) != gd::String::npos;
 }
 
 const gd::String& ResourcesManager::GetResourceNameWithOrigin(
@@ -226,6 +246,7 @@ bool ResourcesManager::AddResource(const gd::Resource& resource) {
   if (newResource == std::shared_ptr<Resource>()) return false;
 
   resources.push_back(newResource);
+  resourcesIndex.emplace(newResource->GetName(), resources.size() - 1);
   return true;
 }
 
@@ -239,6 +260,7 @@ bool ResourcesManager::AddResource(const gd::String& name,
   res->SetName(name);
 
   resources.push_back(res);
+  resourcesIndex.emplace(name, resources.size() - 1);
 
   return true;
 }
@@ -315,19 +337,22 @@ bool ResourceFolder::MoveResourceDownInList(const gd::String& name) {
 }
 
 bool ResourcesManager::MoveResourceUpInList(const gd::String& name) {
-  return gd::MoveResourceUpInList(resources, name);
+  if (!gd::MoveResourceUpInList(resources, name)) return false;
+
+  UpdateResourcesIndex();
+  return true;
 }
 
 bool ResourcesManager::MoveResourceDownInList(const gd::String& name) {
-  return gd::MoveResourceDownInList(resources, name);
+  if (!gd::MoveResourceDownInList(resources, name)) return false;
+
+  UpdateResourcesIndex();
+  return true;
 }
 
 std::size_t ResourcesManager::GetResourcePosition(
     const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return FindResourcePosition(name);
 }
 
 void ResourcesManager::MoveResource(std::size_t oldIndex,
@@ -337,6 +362,7 @@ void ResourcesManager::MoveResource(std::size_t oldIndex,
   auto resource = resources[oldIndex];
   resources.erase(resources.begin() + oldIndex);
   resources.insert(resources.begin() + newIndex, resource);
+  UpdateResourcesIndex();
 }
 
 bool ResourcesManager::MoveFolderUpInList(const gd::String& name) {
@@ -363,9 +389,8 @@ bool ResourcesManager::MoveFolderDownInList(const gd::String& name) {
 
 std::shared_ptr<gd::Resource> ResourcesManager::GetResourceSPtr(
     const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return resources[i];
-  }
+  std::size_t position = FindResourcePosition(name);
+  if (position != gd::String::npos) return resources[position];
 
   return std::shared_ptr<gd::Resource>();
 }
@@ -438,6 +463,7 @@ void ResourcesManager::RenameResource(const gd::String& oldName,
   for (std::size_t i = 0; i < resources.size(); ++i) {
     if (resources[i]->GetName() == oldName) resources[i]->SetName(newName);
   }
+  UpdateResourcesIndex();
 }
 
 void ResourceFolder::RemoveResource(const gd::String& name) {
@@ -451,6 +477,7 @@ void ResourceFolder::RemoveResource(const gd::String& name) {
 }
 
 void ResourcesManager::RemoveResource(const gd::String& name) {
+  std::size_t oldCount = resources.size();
   for (std::size_t i = 0; i < resources.size();) {
     if (resources[i] != std::shared_ptr<Resource>() &&
         resources[i]->GetName() == name)
@@ -458,11 +485,43 @@ void ResourcesManager::RemoveResource(const gd::String& name) {
     else
       ++i;
   }
+  if (resources.size() != oldCount) UpdateResourcesIndex();
 
   for (std::size_t i = 0; i < folders.size(); ++i)
     folders[i].RemoveResource(name);
 }
 
+void ResourceFolder::RemoveResources(
+    const std::unordered_set<gd::String>& names) {
+  resources.erase(
+      std::remove_if(resources.begin(),
+                     resources.end(),
+                     [&names](const std::shared_ptr<Resource>& resource) {
+                       return resource != std::shared_ptr<Resource>() &&
+                              names.count(resource->GetName()) != 0;
+                     }),
+      resources.end());
+}
+
+void ResourcesManager::RemoveResources(const std::vector<gd::String>& names) {
+  if (names.empty()) return;
+
+  std::unordered_set<gd::String> namesSet(names.begin(), names.end());
+  std::size_t oldCount = resources.size();
+  resources.erase(
+      std::remove_if(resources.begin(),
+                     resources.end(),
+                     [&namesSet](const std::shared_ptr<Resource>& resource) {
+                       return resource != std::shared_ptr<Resource>() &&
+                              namesSet.count(resource->GetName()) != 0;
+                     }),
+      resources.end());
+  if (resources.size() != oldCount) UpdateResourcesIndex();
+
+  for (std::size_t i = 0; i < folders.size(); ++i)
+    folders[i].RemoveResources(namesSet);
+}
+
 void ResourceFolder::UnserializeFrom(const SerializerElement& element,
                                      gd::ResourcesManager& parentManager) {
   name = element.GetStringAttribute("name");
@@ -515,6 +574,7 @@ void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
 
     resources.push_back(resource);
   }
+  UpdateResourcesIndex();
 
   folders.clear();
   const SerializerElement& resourcesFoldersElement =
@@ -7,6 +7,8 @@
 #define GDCORE_RESOURCESMANAGER_H
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "GDCore/String.h"
@@ -658,6 +660,14 @@ class GD_CORE_API ResourcesManager {
    */
   void RemoveResource(const gd::String& name);
 
+  /**
+   * \brief Remove several resources at once.
+   *
+   * Equivalent to calling RemoveResource for each name, but the resources
+   * list, the folders and the index are only updated once.
+   */
+  void RemoveResources(const std::vector<gd::String>& names);
+
   /**
    * \brief Rename a resource
    */
@@ -741,7 +751,25 @@ class GD_CORE_API ResourcesManager {
  private:
   void Init(const ResourcesManager& other);
 
+  /**
+   * Return the position of the resource called \a name, or gd::String::npos.
+   *
+   * The index is only a hint: resources can be renamed without the manager
+   * knowing it, so the position is checked and the list is searched when the
+   * index is outdated. It's never updated here so that the manager can be read
+   * from several threads.
+   */
+  std::size_t FindResourcePosition(const gd::String& name) const;
+
+  /**
+   * Rebuild the index of the positions of the resources. To be called after
+   * the resources list was modified.
+   */
+  void UpdateResourcesIndex();
+
   std::vector<std::shared_ptr<Resource> > resources;
+  std::unordered_map<gd::String, std::size_t>
+      resourcesIndex;  ///< The position of the resources, by name.
   std::vector<ResourceFolder> folders;
 
   static ResourceFolder badFolder;
@@ -775,6 +803,11 @@ class GD_CORE_API ResourceFolder {
    */
   virtual void RemoveResource(const gd::String& name);
 
+  /**
+   * Remove the resources having one of the given names.
+   */
+  void RemoveResources(const std::unordered_set<gd::String>& names);
+
   /**
    * Return true if a resource is in the folder.
    */
@@ -151,8 +151,8 @@ Variable& Variable::GetChild(const gd::String& name) {
 
   type = Type::Structure;
   hasMixedValues = false;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  return *children.emplace(name, std::make_shared<gd::Variable>())
+              .first->second;
 }
 
 /**
@@ -166,8 +166,8 @@ const Variable& Variable::GetChild(const gd::String& name) const {
   if (it != children.end()) return *it->second;
 
   type = Type::Structure;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  return *children.emplace(name, std::make_shared<gd::Variable>())
+              .first->second;
 }
 
 void Variable::RemoveChild(const gd::String& name) {
@@ -278,7 +278,7 @@ void Variable::SerializeTo(SerializerElement& element) const {
   } else if (type == Type::Array) {
     SerializerElement& childrenElement = element.AddChild("children");
     childrenElement.ConsiderAsArrayOf("variable");
-    for (auto child : childrenArray) {
+    for (const auto& child : childrenArray) {
       child->SerializeTo(childrenElement.AddChild("variable"));
     }
   }
@@ -318,12 +318,20 @@ void Variable::UnserializeFrom(const SerializerElement& element) {
     childrenElement.ConsiderAsArrayOf("variable", "Variable");
     if (childrenElement.GetChildrenCount() == 0) return;
 
+    if (type == Type::Array)
+      childrenArray.reserve(childrenArray.size() +
+                            childrenElement.GetChildrenCount());
     for (int i = 0; i < childrenElement.GetChildrenCount(); ++i) {
       const SerializerElement& childElement = childrenElement.GetChild(i);
       if (type == Type::Structure) {
         gd::String name = childElement.GetStringAttribute("name", "", "Name");
-        children[name] = std::make_shared<gd::Variable>();
-        children[name]->UnserializeFrom(childElement);
+        // Children are serialized sorted by name, so they are added at the end
+        // of the map without searching for their place.
+        auto& child =
+            children.emplace_hint(children.end(), std::move(name), nullptr)
+                ->second;
+        child = std::make_shared<gd::Variable>();
+        child->UnserializeFrom(childElement);
       } else if (type == Type::Array)
         PushNew().UnserializeFrom(childElement);
     }
@@ -425,10 +433,16 @@ Variable& Variable::operator=(const Variable& other) {
 void Variable::CopyChildren(const gd::Variable& other) {
   children.clear();
   for (auto& it : other.children) {
-    children[it.first] = std::make_shared<gd::Variable>(*it.second);
+    // The other children are sorted, so each one is added at the end of the
+    // map without searching for its place.
+    children.emplace_hint(children.end(),
+                          it.first,
+                          std::make_shared<gd::Variable>(*it.second));
   }
-  for (auto child : other.childrenArray) {
-    childrenArray.push_back(std::make_shared<gd::Variable>(*child.get()));
+  childrenArray.clear();
+  childrenArray.reserve(other.childrenArray.size());
+  for (const auto& child : other.childrenArray) {
+    childrenArray.push_back(std::make_shared<gd::Variable>(*child));
   }
 }
 
@@ -54,9 +54,16 @@ class GD_CORE_API Variable {
    */
   Variable() : value(0), type(Type::Number), hasMixedValues(false) {};
   Variable(const Variable&);
+
+  /**
+   * \brief Move constructor, taking the children of the other variable
+   * without copying them.
+   */
+  Variable(Variable&&) = default;
   virtual ~Variable(){};
 
   Variable& operator=(const Variable& rhs);
+  Variable& operator=(Variable&& rhs) = default;
 
   /**
    * \brief Get the type of the variable.
@@ -11,6 +11,7 @@
 #include "GDCore/Project/Variable.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/MakeUnique.h"
 #include "GDCore/Tools/UUID/UUID.h"
 
 namespace gd {
@@ -43,23 +44,19 @@ VariablesContainer::VariablesContainer(
 }
 
 bool VariablesContainer::Has(const gd::String& name) const {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  return (i != variables.end());
+  return FindPosition(name) != gd::String::npos;
 }
 
 Variable& VariablesContainer::Get(const gd::String& name) {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  if (i != variables.end()) return *i->second;
+  std::size_t position = FindPosition(name);
+  if (position != gd::String::npos) return *variables[position].second;
 
   return badVariable;
 }
 
 const Variable& VariablesContainer::Get(const gd::String& name) const {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  if (i != variables.end()) return *i->second;
+  std::size_t position = FindPosition(name);
+  if (position != gd::String::npos) return *variables[position].second;
 
   return badVariable;
 }
@@ -89,22 +86,31 @@ Variable& VariablesContainer::Insert(const gd::String& name,
   if (position < variables.size()) {
     variables.insert(variables.begin() + position,
                      std::make_pair(name, newVariable));
+    UpdateVariablesIndex();
     return *variables[position].second;
   } else {
     variables.push_back(std::make_pair(name, newVariable));
+    if (variablesIndex)
+      variablesIndex->emplace(name, variables.size() - 1);
+    else if (variables.size() > indexThreshold)
+      UpdateVariablesIndex();
     return *variables.back().second;
   }
 }
 
 void VariablesContainer::Remove(const gd::String& varName) {
+  if (!Has(varName)) return;
+
   variables.erase(
       std::remove_if(
           variables.begin(), variables.end(), VariableHasName(varName)),
       variables.end());
+  UpdateVariablesIndex();
 }
 
 void VariablesContainer::RemoveRecursively(
     const gd::Variable& variableToRemove) {
+  std::size_t oldCount = variables.size();
   variables.erase(
       std::remove_if(
           variables.begin(),
@@ -115,6 +121,7 @@ void VariablesContainer::RemoveRecursively(
             return &variableToRemove == nameAndVariable.second.get();
           }),
       variables.end());
+  if (variables.size() != oldCount) UpdateVariablesIndex();
 
   for (auto& it : variables) {
     it.second->RemoveRecursively(variableToRemove);
@@ -122,11 +129,7 @@ void VariablesContainer::RemoveRecursively(
 }
 
 std::size_t VariablesContainer::GetPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < variables.size(); ++i) {
-    if (variables[i].first == name) return i;
-  }
-
-  return gd::String::npos;
+  return FindPosition(name);
 }
 
 Variable& VariablesContainer::InsertNew(const gd::String& name,
@@ -139,9 +142,19 @@ bool VariablesContainer::Rename(const gd::String& oldName,
                                 const gd::String& newName) {
   if (Has(newName)) return false;
 
-  auto i = std::find_if(
-      variables.begin(), variables.end(), VariableHasName(oldName));
-  if (i != variables.end()) i->first = newName;
+  std::size_t position = FindPosition(oldName);
+  if (position == gd::String::npos) return true;
+
+  variables[position].first = newName;
+  if (!variablesIndex) return true;
+
+  if (HasDuplicatedNames()) {
+    // Another variable may still have the old name.
+    UpdateVariablesIndex();
+  } else {
+    variablesIndex->erase(oldName);
+    variablesIndex->emplace(newName, position);
+  }
 
   return true;
 }
@@ -155,6 +168,17 @@ void VariablesContainer::Swap(std::size_t firstVariableIndex,
   auto temp = variables[firstVariableIndex];
   variables[firstVariableIndex] = variables[secondVariableIndex];
   variables[secondVariableIndex] = temp;
+
+  if (!variablesIndex) return;
+
+  if (HasDuplicatedNames()) {
+    UpdateVariablesIndex();
+  } else {
+    (*variablesIndex)[variables[firstVariableIndex].first] =
+        firstVariableIndex;
+    (*variablesIndex)[variables[secondVariableIndex].first] =
+        secondVariableIndex;
+  }
 }
 
 void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
@@ -165,14 +189,48 @@ void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
   auto nameAndVariable = variables[oldIndex];
   variables.erase(variables.begin() + oldIndex);
   variables.insert(variables.begin() + newIndex, nameAndVariable);
+  UpdateVariablesIndex();
+}
+
+void VariablesContainer::UpdateVariablesIndex() {
+  if (variables.size() <= indexThreshold) {
+    // A few variables are found faster by iterating over them.
+    variablesIndex.reset();
+    return;
+  }
+
+  if (!variablesIndex)
+    variablesIndex =
+        gd::make_unique<std::unordered_map<gd::String, std::size_t>>();
+  variablesIndex->clear();
+  variablesIndex->reserve(variables.size());
+  for (std::size_t i = 0; i < variables.size(); ++i) {
+    // Keep the first variable if several have the same name.
+    variablesIndex->emplace(variables[i].first, i);
+  }
+}
+
+std::size_t VariablesContainer::FindPosition(const gd::String& name) const {
+  if (variablesIndex) {
+    auto it = variablesIndex->find(name);
+    return it != variablesIndex->end() ? it->second : gd::String::npos;
+  }
+
+  for (std::size_t i = 0; i < variables.size(); ++i) {
+    if (variables[i].first == name) return i;
+  }
+  return gd::String::npos;
 }
 
 void VariablesContainer::ForEachVariableMatchingSearch(
     const gd::String& search,
     std::function<void(const gd::String& name, const gd::Variable& variable)>
         fn) const {
+  // Case-fold the search only once, rather than for each variable.
+  const std::string caseFoldedSearch = search.CaseFold().Raw();
   for (const auto& nameAndVariable : variables) {
-    if (nameAndVariable.first.FindCaseInsensitive(search) != gd::String::npos)
+    if (nameAndVariable.first.CaseFold().Raw().find(caseFoldedSearch) !=
+        std::string::npos)
       fn(nameAndVariable.first, *nameAndVariable.second);
   }
 }
@@ -194,6 +252,7 @@ void VariablesContainer::UnserializeFrom(const SerializerElement& element) {
 
   Clear();
   element.ConsiderAsArrayOf("variable", "Variable");
+  variables.reserve(element.GetChildrenCount());
   for (std::size_t j = 0; j < element.GetChildrenCount(); j++) {
     const SerializerElement& variableElement = element.GetChild(j);
 
@@ -237,9 +296,15 @@ void VariablesContainer::Init(const gd::VariablesContainer& other) {
   sourceType = other.sourceType;
   persistentUuid = other.persistentUuid;
   variables.clear();
+  variables.reserve(other.variables.size());
   for (auto& it : other.variables) {
     variables.push_back(
         std::make_pair(it.first, std::make_shared<gd::Variable>(*it.second)));
   }
+  variablesIndex =
+      other.variablesIndex
+          ? gd::make_unique<std::unordered_map<gd::String, std::size_t>>(
+                *other.variablesIndex)
+          : nullptr;
 }
 }  // namespace gd
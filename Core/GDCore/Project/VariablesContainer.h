@@ -6,6 +6,7 @@
 
 #pragma once
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include "GDCore/Project/Variable.h"
 #include "GDCore/String.h"
@@ -147,7 +148,10 @@ class GD_CORE_API VariablesContainer {
   /**
    * \brief Clear all variables of the container.
    */
-  inline void Clear() { variables.clear(); }
+  inline void Clear() {
+    variables.clear();
+    variablesIndex.reset();
+  }
 
   /**
    * \brief Call the callback for each variable with a name matching the specified search.
@@ -191,6 +195,12 @@ class GD_CORE_API VariablesContainer {
  private:
   SourceType sourceType = Unknown;
   std::vector<std::pair<gd::String, std::shared_ptr<gd::Variable>>> variables;
+  std::unique_ptr<std::unordered_map<gd::String, std::size_t>>
+      variablesIndex;  ///< The position of the variables, by name (the first
+                       ///< one if several have the same name). Only built
+                       ///< past indexThreshold variables, so that the many
+                       ///< containers of events (mostly empty) stay small.
+  static constexpr std::size_t indexThreshold = 8;
   mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
                                       ///< useful for computing changesets.
   static gd::Variable badVariable;
@@ -201,6 +211,26 @@ class GD_CORE_API VariablesContainer {
    * copy-ctor and assign-op. Don't forget to update me if members were changed!
    */
   void Init(const VariablesContainer& other);
+
+  /**
+   * Rebuild the index of the positions of the variables. To be called when
+   * the positions of the variables changed.
+   */
+  void UpdateVariablesIndex();
+
+  /**
+   * Return the position of the first variable with the given name, or
+   * gd::String::npos.
+   */
+  std::size_t FindPosition(const gd::String& name) const;
+
+  /**
+   * Return true if several variables have the same name, in which case the
+   * index can't be updated incrementally.
+   */
+  bool HasDuplicatedNames() const {
+    return variablesIndex->size() != variables.size();
+  }
 };
 
 }  // namespace gd
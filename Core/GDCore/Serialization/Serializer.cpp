@@ -7,16 +7,24 @@
 #include "GDCore/Serialization/Serializer.h"
 
 #include <iomanip>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Serialization/SerializerElement.h"
-#include "rapidjson/document.h"
-#include "rapidjson/prettywriter.h"
+#include "GDCore/Tools/MemoryTracker.h"
+#include "GDCore/Tools/PerfScope.h"
+#include "rapidjson/error/en.h"
+#include "rapidjson/memorystream.h"
 #include "rapidjson/rapidjson.h"
+#include "rapidjson/reader.h"
+#include "rapidjson/writer.h"
 
 using namespace rapidjson;
 
@@ -31,120 +39,526 @@ gd::String Serializer::ToEscapedXMLString(const gd::String& str) {
 }
 
 namespace {
-void RapidJsonValueToElement(const Value& value,
-                             gd::SerializerElement& element) {
-  if (value.IsBool()) {
-    element.SetBoolValue(value.GetBool());
-  } else if (value.IsNumber()) {
-    if (value.IsInt64())
-      element.SetIntValue(value.GetInt64());
-    else if (value.IsUint64())
-      element.SetIntValue(value.GetUint64());
-    else if (value.IsInt())
-      element.SetValue(value.GetInt());
-    else if (value.IsUint())
-      element.SetValue(value.GetUint());
-    else if (value.IsDouble())
-      element.SetValue(value.GetDouble());
-    else if (value.IsFloat())
-      element.SetValue(value.GetFloat());
-  } else if (value.IsString()) {
-    element.SetStringValue(value.GetString());
-  } else if (value.IsObject()) {
-    for (auto& m : value.GetObject()) {
-      RapidJsonValueToElement(m.value, element.AddChild(m.name.GetString()));
-    }
-  } else if (value.IsArray()) {
+/**
+ * Set an integer read from JSON or binary data. gd::SerializerValue stores
+ * integers as int, so integers out of this range are stored as double.
+ */
+void SetIntegerValue(gd::SerializerElement& element, int64_t value) {
+  if (value >= std::numeric_limits<int>::min() &&
+      value <= std::numeric_limits<int>::max())
+    element.SetIntValue((int)value);
+  else
+    element.SetDoubleValue((double)value);
+}
+
+/**
+ * \brief A rapidjson SAX handler building a gd::SerializerElement tree
+ * directly from the reader events.
+ *
+ * This avoids building a rapidjson::Document and copying the input: memory
+ * used while parsing is only the resulting tree (plus the stack of elements
+ * being currently filled).
+ */
+class SerializerElementSaxHandler
+    : public BaseReaderHandler<UTF8<>, SerializerElementSaxHandler> {
+ public:
+  SerializerElementSaxHandler(gd::SerializerElement& rootElement_)
+      : rootElement(rootElement_) {}
+
+  bool Null() {
+    NextElement().SetNullValue();
+    return true;
+  }
+  bool Bool(bool b) {
+    NextElement().SetBoolValue(b);
+    return true;
+  }
+  bool Int(int i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint(unsigned u) {
+    SetIntegerValue(NextElement(), u);
+    return true;
+  }
+  bool Int64(int64_t i) {
+    SetIntegerValue(NextElement(), i);
+    return true;
+  }
+  bool Uint64(uint64_t u) {
+    if (u > (uint64_t)std::numeric_limits<int64_t>::max())
+      NextElement().SetDoubleValue((double)u);
+    else
+      SetIntegerValue(NextElement(), (int64_t)u);
+    return true;
+  }
+  bool Double(double d) {
+    NextElement().SetValue(d);
+    return true;
+  }
+  bool String(const char* str, SizeType length, bool copy) {
+    // Use the length, as strings can contain null characters.
+    gd::String value;
+    value.Raw().assign(str, length);
+    NextElement().SetStringValue(value);
+    return true;
+  }
+  bool StartObject() {
+    stack.push_back(&NextElement());
+    return true;
+  }
+  bool Key(const char* str, SizeType length, bool copy) {
+    key = str;
+    return true;
+  }
+  bool EndObject(SizeType memberCount) {
+    stack.pop_back();
+    return true;
+  }
+  bool StartArray() {
+    gd::SerializerElement& element = NextElement();
     element.ConsiderAsArray();
-    for (auto& m : value.GetArray()) {
-      RapidJsonValueToElement(m, element.AddChild(""));
-    }
+    stack.push_back(&element);
+    return true;
+  }
+  bool EndArray(SizeType elementCount) {
+    stack.pop_back();
+    return true;
+  }
+
+ private:
+  /**
+   * \brief Return the element that must receive the next value: the root
+   * element, a new child of the current array or a new child of the current
+   * object, named after the last key.
+   */
+  gd::SerializerElement& NextElement() {
+    if (stack.empty()) return rootElement;
+
+    gd::SerializerElement& parent = *stack.back();
+    if (parent.ConsideredAsArray()) return parent.AddChild("");
+
+    // The key is not used anymore: move it to avoid a copy.
+    return parent.AddChild(std::move(key));
+  }
+
+  gd::SerializerElement& rootElement;
+  std::vector<gd::SerializerElement*> stack;
+  gd::String key;  ///< The name of the last key read in an object.
+};
+
+/**
+ * \brief A rapidjson output stream appending directly to a std::string.
+ */
+class StringOutputStream {
+ public:
+  typedef char Ch;
+
+  StringOutputStream(std::string& output_) : output(output_) {}
+
+  void Put(Ch c) { output.push_back(c); }
+  void Flush() {}
+
+ private:
+  std::string& output;
+};
+
+/**
+ * \brief A rapidjson output stream sending its output by chunks
+ * to a sink.
+ */
+class SinkOutputStream {
+ public:
+  typedef char Ch;
+
+  SinkOutputStream(const Serializer::JSONSink& sink_) : sink(sink_) {
+    buffer.reserve(chunkSize);
+  }
+
+  void Put(Ch c) {
+    buffer.push_back(c);
+    if (buffer.size() >= chunkSize) Flush();
+  }
+  void Flush() {
+    if (buffer.empty()) return;
+
+    sink(buffer.data(), buffer.size());
+    buffer.clear();
   }
+
+ private:
+  static constexpr std::size_t chunkSize = 64 * 1024;
+
+  const Serializer::JSONSink& sink;
+  std::vector<char> buffer;
+};
+
+/**
+ * \brief Write an element and its children using the given rapidjson writer,
+ * without building a rapidjson::Document (so no names or strings are copied).
+ */
+template <typename JSONWriter>
+void WriteElement(const gd::SerializerElement& element, JSONWriter& writer);
+
+template <typename JSONWriter>
+void WriteValue(const gd::SerializerValue& serializerValue,
+                JSONWriter& writer) {
+  if (serializerValue.IsBoolean())
+    writer.Bool(serializerValue.GetBool());
+  else if (serializerValue.IsDouble())
+    writer.Double(serializerValue.GetDouble());
+  else if (serializerValue.IsInt())
+    writer.Int(serializerValue.GetInt());
+  else if (serializerValue.IsString()) {
+    const std::string& str = serializerValue.GetRawString().Raw();
+    writer.String(str.c_str(), str.size());
+  } else
+    writer.Null();
 }
 
-void ElementToRapidJson(const gd::SerializerElement& element,
-                        Value& value,
-                        Document::AllocatorType& allocator) {
+template <typename JSONWriter>
+void WriteElement(const gd::SerializerElement& element, JSONWriter& writer) {
   if (!element.IsValueUndefined()) {
-    const SerializerValue& serializerValue = element.GetValue();
-    // TODO: use GetRaw to avoid conversions
-    if (serializerValue.IsBoolean())
-      value.SetBool(serializerValue.GetBool());
-    else if (serializerValue.IsDouble())
-      value.SetDouble(serializerValue.GetDouble());
-    else if (serializerValue.IsInt())
-      value.SetInt(serializerValue.GetInt());
-    else if (serializerValue.IsString()) {
-      // This does a copy of the string, and measure the string length.
-      value.SetString(serializerValue.GetRawString().c_str(), allocator);
-    }
+    WriteValue(element.GetValue(), writer);
+  } else if (element.IsNull()) {
+    writer.Null();
   } else if (element.ConsideredAsArray()) {
-    value.SetArray();
-
-    const auto& children = element.GetAllChildren();
-    value.Reserve(children.size(), allocator);
-
-    for (const auto& child : children) {
-      Value childValue;
-      ElementToRapidJson(*child.second, childValue, allocator);
-      value.PushBack(childValue, allocator);
+    writer.StartArray();
+    for (const auto& child : element.GetAllChildren()) {
+      WriteElement(*child.second, writer);
     }
+    writer.EndArray();
   } else {
-    value.SetObject();
-
-    const auto& attributes = element.GetAllAttributes();
-    const auto& children = element.GetAllChildren();
-
-    for (const auto& attribute : attributes) {
-      Value name(attribute.first.c_str(),
-                 allocator);  // Copying the name is required.
-      Value childValue;
-      ElementToRapidJson(attribute.second, childValue, allocator);
-      value.AddMember(name, childValue, allocator);
+    writer.StartObject();
+    for (const auto& attribute : element.GetAllAttributes()) {
+      const std::string& name = attribute.first.Raw();
+      writer.Key(name.c_str(), name.size());
+      WriteValue(attribute.second, writer);
     }
-    for (const auto& child : children) {
-      Value name(child.first.c_str(),
-                 allocator);  // Copying the name is required.
-      Value childValue;
-      ElementToRapidJson(*child.second, childValue, allocator);
-      value.AddMember(name, childValue, allocator);
+    for (const auto& child : element.GetAllChildren()) {
+      const std::string& name = child.first.Raw();
+      writer.Key(name.c_str(), name.size());
+      WriteElement(*child.second, writer);
     }
+    writer.EndObject();
   }
 }
 }  // namespace
 
-SerializerElement Serializer::FromJSON(const char* json) {
+namespace {
+template <typename InputStream>
+SerializerElement ParseJSON(InputStream& stream) {
+  // Parse with a SAX handler so that the tree of elements is built
+  // directly from the input, without a copy of it nor an intermediate
+  // document. Iterative parsing keeps the native stack usage constant
+  // whatever the nesting depth of the input.
+  gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Serializer);
+  gd::PerfScope perfScope("Serializer::FromJSON");
   SerializerElement element;
-  size_t len = strlen(json);
-  if (len != 0) {
-    Document document;
-
-    // In-situ parsing, decode strings directly in the source string. Source
-    // must be string.
-    char buffer[len + 1];
-    memcpy(buffer, json, len + 1);
-    if (document.ParseInsitu(buffer).HasParseError()) {
-      std::cout << "TODO: error while parsing" << std::endl;
-      return element;
-    }
-
-    RapidJsonValueToElement(document, element);
+  Reader reader;
+  SerializerElementSaxHandler handler(element);
+  ParseResult result = reader.Parse<kParseIterativeFlag>(stream, handler);
+  if (result.IsError()) {
+    std::cout << "Error while parsing JSON at offset " << result.Offset()
+              << ": " << GetParseError_En(result.Code()) << std::endl;
+    return SerializerElement();
   }
 
   return element;
 }
+}  // namespace
+
+SerializerElement Serializer::FromJSON(const char* json) {
+  if (!json || json[0] == '\0') return SerializerElement();
+
+  StringStream stream(json);
+  return ParseJSON(stream);
+}
+
+SerializerElement Serializer::FromJSON(const char* json, std::size_t size) {
+  if (!json || size == 0) return SerializerElement();
+
+  MemoryStream stream(json, size);
+  return ParseJSON(stream);
+}
 
 gd::String Serializer::ToJSON(const SerializerElement& element) {
-  Document document;
-  Document::AllocatorType& allocator = document.GetAllocator();
+  gd::PerfScope perfScope("Serializer::ToJSON");
+  gd::String json;
+  StringOutputStream stream(json.Raw());
+  Writer<StringOutputStream> writer(stream);
+  WriteElement(element, writer);
+
+  return json;
+}
 
-  ElementToRapidJson(element, document, allocator);
+void Serializer::ToJSON(const SerializerElement& element,
+                        const JSONSink& sink) {
+  gd::PerfScope perfScope("Serializer::ToJSON");
+  SinkOutputStream stream(sink);
+  Writer<SinkOutputStream> writer(stream);
+  WriteElement(element, writer);
+  stream.Flush();
+}
+
+namespace {
+/**
+ * Binary format: the header, followed by the root element. Each element
+ * is a tag byte followed by its content:
+ * - null, false, true: nothing,
+ * - int: a zigzag encoded varint,
+ * - double: 8 bytes (IEEE 754, little endian),
+ * - string: a varint length followed by the UTF-8 bytes,
+ * - array: a varint count followed by the elements,
+ * - object: a varint count followed by, for each member, the key and the
+ *   element. A key is a varint: 0 means a new key (followed by its length and
+ *   bytes, then added to the table of keys), otherwise it's the index + 1 of an
+ *   already seen key.
+ *
+ * This is the same data model as JSON, so conversions between the two are
+ * lossless. Elements are nested at most binaryMaxDepth levels deep, as they
+ * are read recursively.
+ */
+const char binaryHeader[] = {'G', 'D', 'B', '1'};
+const std::size_t binaryHeaderSize = sizeof(binaryHeader);
+const std::size_t binaryMaxDepth = 512;
 
-  StringBuffer buffer;
-  Writer<StringBuffer> writer(buffer);
-  document.Accept(writer);
+enum BinaryTag : unsigned char {
+  BinaryNull = 0,
+  BinaryFalse,
+  BinaryTrue,
+  BinaryInt,
+  BinaryDouble,
+  BinaryString,
+  BinaryArray,
+  BinaryObject,
+};
+
+class BinaryWriter {
+ public:
+  BinaryWriter(std::string& output_) : output(output_) {}
+
+  void WriteElement(const gd::SerializerElement& element) {
+    if (!element.IsValueUndefined()) {
+      WriteValue(element.GetValue());
+    } else if (element.IsNull()) {
+      output.push_back(BinaryNull);
+    } else if (element.ConsideredAsArray()) {
+      const auto& children = element.GetAllChildren();
+      output.push_back(BinaryArray);
+      WriteVarUint(children.size());
+      for (const auto& child : children) WriteElement(*child.second);
+    } else {
+      const auto& attributes = element.GetAllAttributes();
+      const auto& children = element.GetAllChildren();
+      output.push_back(BinaryObject);
+      WriteVarUint(attributes.size() + children.size());
+      for (const auto& attribute : attributes) {
+        WriteKey(attribute.first);
+        WriteValue(attribute.second);
+      }
+      for (const auto& child : children) {
+        WriteKey(child.first);
+        WriteElement(*child.second);
+      }
+    }
+  }
+
+ private:
+  void WriteValue(const gd::SerializerValue& value) {
+    if (value.IsBoolean()) {
+      output.push_back(value.GetBool() ? BinaryTrue : BinaryFalse);
+    } else if (value.IsDouble()) {
+      output.push_back(BinaryDouble);
+      double doubleValue = value.GetDouble();
+      uint64_t bits;
+      memcpy(&bits, &doubleValue, sizeof(bits));
+      for (int i = 0; i < 8; ++i) output.push_back((char)(bits >> (i * 8)));
+    } else if (value.IsInt()) {
+      output.push_back(BinaryInt);
+      int64_t intValue = value.GetInt();
+      WriteVarUint(((uint64_t)intValue << 1) ^ (uint64_t)(intValue >> 63));
+    } else if (value.IsString()) {
+      output.push_back(BinaryString);
+      WriteString(value.GetRawString().Raw());
+    } else {
+      output.push_back(BinaryNull);
+    }
+  }
+
+  void WriteKey(const gd::String& key) {
+    auto it = keys.find(key.Raw());
+    if (it != keys.end()) {
+      WriteVarUint(it->second + 1);
+      return;
+    }
+
+    std::size_t index = keys.size();
+    keys[key.Raw()] = index;
+    WriteVarUint(0);
+    WriteString(key.Raw());
+  }
+
+  void WriteString(const std::string& str) {
+    WriteVarUint(str.size());
+    output.append(str);
+  }
+
+  void WriteVarUint(uint64_t value) {
+    while (value >= 0x80) {
+      output.push_back((char)((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    output.push_back((char)value);
+  }
+
+  std::string& output;
+  std::unordered_map<std::string, std::size_t> keys;
+};
+
+class BinaryReader {
+ public:
+  BinaryReader(const char* data_, std::size_t size_)
+      : data(data_), size(size_), position(0) {}
+
+  bool ReadHeader() {
+    if (size < binaryHeaderSize ||
+        memcmp(data, binaryHeader, binaryHeaderSize) != 0)
+      return false;
+
+    position = binaryHeaderSize;
+    return true;
+  }
+
+  bool ReadElement(gd::SerializerElement& element, std::size_t depth = 0) {
+    if (position >= size || depth >= binaryMaxDepth) return false;
+
+    unsigned char tag = data[position++];
+    switch (tag) {
+      case BinaryNull:
+        element.SetNullValue();
+        return true;
+      case BinaryFalse:
+        element.SetBoolValue(false);
+        return true;
+      case BinaryTrue:
+        element.SetBoolValue(true);
+        return true;
+      case BinaryInt: {
+        uint64_t zigzag;
+        if (!ReadVarUint(zigzag)) return false;
+        int64_t intValue = (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+        SetIntegerValue(element, intValue);
+        return true;
+      }
+      case BinaryDouble: {
+        if (size - position < 8) return false;
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i)
+          bits |= (uint64_t)(unsigned char)data[position++] << (i * 8);
+        double doubleValue;
+        memcpy(&doubleValue, &bits, sizeof(doubleValue));
+        element.SetDoubleValue(doubleValue);
+        return true;
+      }
+      case BinaryString: {
+        gd::String str;
+        if (!ReadString(str.Raw())) return false;
+        element.SetStringValue(str);
+        return true;
+      }
+      case BinaryArray: {
+        uint64_t count;
+        if (!ReadVarUint(count)) return false;
+        element.ConsiderAsArray();
+        for (uint64_t i = 0; i < count; ++i) {
+          if (!ReadElement(element.AddChild(""), depth + 1)) return false;
+        }
+        return true;
+      }
+      case BinaryObject: {
+        uint64_t count;
+        if (!ReadVarUint(count)) return false;
+        for (uint64_t i = 0; i < count; ++i) {
+          uint64_t keyReference;
+          if (!ReadVarUint(keyReference)) return false;
+          if (keyReference == 0) {
+            gd::String key;
+            if (!ReadString(key.Raw())) return false;
+            keys.push_back(std::move(key));
+          } else if (keyReference > keys.size()) {
+            return false;
+          }
+          const gd::String& key =
+              keyReference == 0 ? keys.back() : keys[keyReference - 1];
+          if (!ReadElement(element.AddChild(key), depth + 1)) return false;
+        }
+        return true;
+      }
+      default:
+        return false;
+    }
+  }
+
+  std::size_t GetPosition() const { return position; }
+
+ private:
+  bool ReadVarUint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (position >= size) return false;
+      unsigned char byte = data[position++];
+      value |= (uint64_t)(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+  }
+
+  bool ReadString(std::string& str) {
+    uint64_t length;
+    if (!ReadVarUint(length) || length > size - position) return false;
+    str.assign(data + position, length);
+    position += length;
+    return true;
+  }
+
+  const char* data;
+  std::size_t size;
+  std::size_t position;
+  std::vector<gd::String> keys;
+};
+}  // namespace
+
+std::string Serializer::ToBinary(const SerializerElement& element) {
+  gd::PerfScope perfScope("Serializer::ToBinary");
+  std::string output(binaryHeader, binaryHeaderSize);
+  BinaryWriter writer(output);
+  writer.WriteElement(element);
+  return output;
+}
+
+SerializerElement Serializer::FromBinary(const char* data, std::size_t size) {
+  gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Serializer);
+  gd::PerfScope perfScope("Serializer::FromBinary");
+  SerializerElement element;
+  BinaryReader reader(data, size);
+  if (!reader.ReadHeader()) {
+    std::cout << "Error while reading binary data: invalid header."
+              << std::endl;
+    return element;
+  }
+  if (!reader.ReadElement(element)) {
+    std::cout << "Error while reading binary data at offset "
+              << reader.GetPosition() << "." << std::endl;
+    return SerializerElement();
+  }
+
+  return element;
+}
 
-  return buffer.GetString();  // Temporary copy
+bool Serializer::IsBinary(const char* data, std::size_t size) {
+  return size >= binaryHeaderSize &&
+         memcmp(data, binaryHeader, binaryHeaderSize) == 0;
 }
 
 }  // namespace gd
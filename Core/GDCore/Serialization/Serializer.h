@@ -6,6 +6,8 @@
 
 #ifndef GDCORE_SERIALIZER_H
 #define GDCORE_SERIALIZER_H
+#include <cstddef>
+#include <functional>
 #include <string>
 #include "GDCore/Serialization/SerializerElement.h"
 
@@ -34,11 +36,24 @@ class GD_CORE_API Serializer {
    * See https://github.com/miloyip/nativejson-benchmark
    */
   ///@{
+  /**
+   * \brief A function receiving, chunk by chunk, the JSON being written.
+   */
+  typedef std::function<void(const char* data, std::size_t size)> JSONSink;
+
   /**
    * \brief Serialize a gd::SerializerElement to a JSON string.
    */
   static gd::String ToJSON(const SerializerElement& element);
 
+  /**
+   * \brief Serialize a gd::SerializerElement to JSON, sending the result by
+   * chunks to the given sink (for example, to write it to a file).
+   *
+   * This avoids holding the whole JSON string in memory.
+   */
+  static void ToJSON(const SerializerElement& element, const JSONSink& sink);
+
   /**
    * \brief Construct a gd::SerializerElement from a JSON string.
    */
@@ -50,6 +65,47 @@ class GD_CORE_API Serializer {
   static SerializerElement FromJSON(const gd::String& json) {
     return FromJSON(json.c_str());
   }
+
+  /**
+   * \brief Construct a gd::SerializerElement from a JSON text of the given
+   * size, which does not need to be null-terminated (for example, the
+   * content of a gd::MappedFile). The text is not copied.
+   */
+  static SerializerElement FromJSON(const char* json, std::size_t size);
+  ///@}
+
+  /** \name Binary serialization.
+   * Convert a gd::SerializerElement from/to a compact binary format (varint
+   * integers, raw doubles, length-prefixed strings and interned keys).
+   *
+   * The data model is the same as JSON, so a conversion from/to JSON is
+   * lossless. This is faster to read and write than JSON and is intended for
+   * caches or for exchanging data between processes, not for files edited by
+   * users.
+   */
+  ///@{
+  /**
+   * \brief Serialize a gd::SerializerElement to binary data.
+   */
+  static std::string ToBinary(const SerializerElement& element);
+
+  /**
+   * \brief Construct a gd::SerializerElement from binary data.
+   */
+  static SerializerElement FromBinary(const char* data, std::size_t size);
+
+  /**
+   * \brief Construct a gd::SerializerElement from binary data.
+   */
+  static SerializerElement FromBinary(const std::string& data) {
+    return FromBinary(data.data(), data.size());
+  }
+
+  /**
+   * \brief Return true if the data starts with the header of the binary
+   * format.
+   */
+  static bool IsBinary(const char* data, std::size_t size);
   ///@}
 
   virtual ~Serializer(){};
@@ -1,16 +1,23 @@
 #include "GDCore/Serialization/SerializerElement.h"
 
-#include <iostream>
+#include <algorithm>
+
+#include "GDCore/Serialization/SerializerElementArena.h"
+#include "GDCore/Tools/Log.h"
 
 namespace gd {
 
 SerializerElement SerializerElement::nullElement;
+constexpr std::size_t SerializerElement::childrenIndexThreshold;
 
 SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
 
 SerializerElement::SerializerElement(const SerializerValue& value)
     : valueUndefined(false), elementValue(value), isArray(false) {}
 
+SerializerElement::SerializerElement(SerializerElementArena& arena_)
+    : valueUndefined(true), isArray(false), arena(&arena_) {}
+
 SerializerElement::~SerializerElement() {}
 
 const SerializerValue& SerializerElement::GetValue() const {
@@ -60,77 +67,82 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
   return *this;
 }
 
-bool SerializerElement::GetBoolAttribute(const gd::String& name,
-                                         bool defaultValue,
-                                         gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end()) {
-    return attributes.find(name)->second.GetBool();
-  } else if (!deprecatedName.empty() &&
-             attributes.find(deprecatedName) != attributes.end()) {
-    return attributes.find(deprecatedName)->second.GetBool();
-  } else {
-    if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
-      if (!child.IsValueUndefined()) {
-        return child.GetValue().GetBool();
-      }
-    }
+const SerializerValue* SerializerElement::FindAttribute(
+    const gd::String& name, const gd::String& deprecatedName) const {
+  auto it = attributes.find(name);
+  if (it != attributes.end()) return &it->second;
+
+  if (!deprecatedName.empty()) {
+    it = attributes.find(deprecatedName);
+    if (it != attributes.end()) return &it->second;
   }
 
+  return nullptr;
+}
+
+const SerializerValue* SerializerElement::FindChildValue(
+    const gd::String& name, const gd::String& deprecatedName) const {
+  if (isArray) {
+    if (!HasChild(name, deprecatedName)) return nullptr;
+
+    const SerializerElement& child = GetChild(name, 0, deprecatedName);
+    return child.IsValueUndefined() ? nullptr : &child.GetValue();
+  }
+
+  // Like GetChild, the first child with the name or the deprecated name is
+  // used, but each name is only looked up once.
+  std::size_t position = FindChildPosition(name);
+  if (!deprecatedName.empty())
+    position = std::min(position, FindChildPosition(deprecatedName));
+  if (position == children.size()) return nullptr;
+
+  const SerializerElement& child = *children[position].second;
+  return child.IsValueUndefined() ? nullptr : &child.GetValue();
+}
+
+bool SerializerElement::GetBoolAttribute(
+    const gd::String& name,
+    bool defaultValue,
+    const gd::String& deprecatedName) const {
+  if (const SerializerValue* value = FindAttribute(name, deprecatedName))
+    return value->GetBool();
+  if (const SerializerValue* value = FindChildValue(name, deprecatedName))
+    return value->GetBool();
+
   return defaultValue;
 }
 
-gd::String SerializerElement::GetStringAttribute(  // TODO: Use const ref?
+gd::String SerializerElement::GetStringAttribute(
     const gd::String& name,
-    gd::String defaultValue,
-    gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetString();
-  else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetString();
-  else {
-    if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
-      if (!child.IsValueUndefined()) return child.GetValue().GetString();
-    }
-  }
+    const gd::String& defaultValue,
+    const gd::String& deprecatedName) const {
+  if (const SerializerValue* value = FindAttribute(name, deprecatedName))
+    return value->GetString();
+  if (const SerializerValue* value = FindChildValue(name, deprecatedName))
+    return value->GetString();
 
   return defaultValue;
 }
 
 int SerializerElement::GetIntAttribute(const gd::String& name,
                                        int defaultValue,
-                                       gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetInt();
-  else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetInt();
-  else {
-    if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
-      if (!child.IsValueUndefined()) return child.GetValue().GetInt();
-    }
-  }
+                                       const gd::String& deprecatedName) const {
+  if (const SerializerValue* value = FindAttribute(name, deprecatedName))
+    return value->GetInt();
+  if (const SerializerValue* value = FindChildValue(name, deprecatedName))
+    return value->GetInt();
 
   return defaultValue;
 }
 
-double SerializerElement::GetDoubleAttribute(const gd::String& name,
-                                             double defaultValue,
-                                             gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetDouble();
-  else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetDouble();
-  else {
-    if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
-      if (!child.IsValueUndefined()) return child.GetValue().GetDouble();
-    }
-  }
+double SerializerElement::GetDoubleAttribute(
+    const gd::String& name,
+    double defaultValue,
+    const gd::String& deprecatedName) const {
+  if (const SerializerValue* value = FindAttribute(name, deprecatedName))
+    return value->GetDouble();
+  if (const SerializerValue* value = FindChildValue(name, deprecatedName))
+    return value->GetDouble();
 
   return defaultValue;
 }
@@ -142,34 +154,52 @@ bool SerializerElement::HasAttribute(const gd::String& name) const {
 SerializerElement& SerializerElement::AddChild(gd::String name) {
   if (isArray) {
     if (name != arrayOf) {
-      std::cout << "WARNING: Adding a child, to a SerializerElement which is "
-                   "considered as an array, with a name ("
-                << name << ") which is not the same as the array elements ("
-                << arrayOf << "). Child was renamed." << std::endl;
+      gd::LogWarning("Adding a child, to a SerializerElement which is "
+                     "considered as an array, with a name (" +
+                     name + ") which is not the same as the array elements (" +
+                     arrayOf + "). Child was renamed.");
       name = arrayOf;
     }
   }
 
   // In case of children of objects, there can be only one child with
   // a given name.
-  // Note: searching for the existing children is O(number of children). This
-  // could be improved, but in practice has no visible impact on saving
-  // large projects.
-  if (!isArray && HasChild(name)) {
-    return GetChild(name);
+  if (!isArray) {
+    std::size_t position = FindChildPosition(name);
+    if (position != children.size()) return *children[position].second;
   }
 
-  std::shared_ptr<SerializerElement> newElement(new SerializerElement);
+  // The element and its reference counter are allocated at once (in the
+  // arena, if any).
+  std::shared_ptr<SerializerElement> newElement =
+      arena ? std::allocate_shared<SerializerElement>(
+                  SerializerElementArenaAllocator<SerializerElement>(*arena),
+                  *arena)
+            : std::make_shared<SerializerElement>();
   children.push_back(std::make_pair(name, newElement));
+  if (childrenIndex) childrenIndex->emplace(name, children.size() - 1);
 
   return *newElement;
 }
 
+void SerializerElement::AddSharedChild(
+    gd::String name, std::shared_ptr<SerializerElement> child) {
+  if (isArray && name != arrayOf) {
+    gd::LogWarning("Adding a child, to a SerializerElement which is "
+                   "considered as an array, with a name (" +
+                   name + ") which is not the same as the array elements (" +
+                   arrayOf + "). Child was renamed.");
+    name = arrayOf;
+  }
+
+  children.push_back(std::make_pair(name, std::move(child)));
+  if (childrenIndex) childrenIndex->emplace(name, children.size() - 1);
+}
+
 SerializerElement& SerializerElement::GetChild(std::size_t index) const {
   if (!isArray) {
-    std::cout << "ERROR: Getting a child from its index whereas the parent is "
-                 "not considered as an array."
-              << std::endl;
+    gd::LogError("Getting a child from its index whereas the parent is not "
+                 "considered as an array.");
     return nullElement;
   }
 
@@ -187,55 +217,61 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
     }
   }
 
-  std::cout << "ERROR: Requested out of bound child at index " << index
-            << std::endl;
+  gd::LogError("Requested out of bound child at index " +
+               gd::String::From(index));
   return nullElement;
 }
 
 SerializerElement& SerializerElement::GetChild(
-    gd::String name, std::size_t index, gd::String deprecatedName) const {
-  if (isArray) {
-    if (name != arrayOf) {
-      std::cout << "WARNING: Getting a child, from a SerializerElement which "
-                   "is considered as an array, with a name ("
-                << name << ") which is not the same as the array elements ("
-                << arrayOf << ")." << std::endl;
-      name = arrayOf;
-    }
+    const gd::String& childName,
+    std::size_t index,
+    const gd::String& deprecatedName) const {
+  if (isArray && childName != arrayOf) {
+    gd::LogWarning("Getting a child, from a SerializerElement which is "
+                   "considered as an array, with a name (" +
+                   childName +
+                   ") which is not the same as the array elements (" +
+                   arrayOf + ").");
   }
+  const gd::String& name = isArray ? arrayOf : childName;
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+  if (!isArray && index == 0) {
+    std::size_t position = FindChildPosition(name);
+    if (!deprecatedName.empty())
+      position = std::min(position, FindChildPosition(deprecatedName));
 
-    if (children[i].first == name || (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
+    if (position != children.size()) return *children[position].second;
+  } else {
+    std::size_t currentIndex = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      if (children[i].first == name ||
+          (isArray && children[i].first.empty()) ||
+          (!deprecatedName.empty() && children[i].first == deprecatedName)) {
+        if (index == currentIndex)
+          return *children[i].second;
+        else
+          currentIndex++;
+      }
     }
   }
 
-  std::cout << "Child " << name << " not found in SerializerElement::GetChild"
-            << std::endl;
+  gd::LogWarning("Child " + name + " not found in SerializerElement::GetChild");
   return nullElement;
 }
 
 std::size_t SerializerElement::GetChildrenCount(
-    gd::String name, gd::String deprecatedName) const {
-  if (name.empty()) {
-    if (!isArray) {
-      std::cout
-          << "ERROR: Getting children count without specifying name, from a "
-             "SerializerElement which is NOT considered as an array."
-          << std::endl;
-      return 0;
-    }
-
-    name = arrayOf;
-    deprecatedName = deprecatedArrayOf;
+    const gd::String& childName,
+    const gd::String& childDeprecatedName) const {
+  if (childName.empty() && !isArray) {
+    gd::LogError("Getting children count without specifying name, from a "
+                 "SerializerElement which is NOT considered as an array.");
+    return 0;
   }
+  const gd::String& name = childName.empty() ? arrayOf : childName;
+  const gd::String& deprecatedName =
+      childName.empty() ? deprecatedArrayOf : childDeprecatedName;
 
   std::size_t currentIndex = 0;
   for (size_t i = 0; i < children.size(); ++i) {
@@ -250,38 +286,64 @@ std::size_t SerializerElement::GetChildrenCount(
 }
 
 bool SerializerElement::HasChild(const gd::String& name,
-                                 gd::String deprecatedName) const {
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
-      return true;
-  }
-
-  return false;
+                                 const gd::String& deprecatedName) const {
+  return FindChildPosition(name) != children.size() ||
+         (!deprecatedName.empty() &&
+          FindChildPosition(deprecatedName) != children.size());
 }
 
 void SerializerElement::RemoveChild(const gd::String& name) {
+  bool removed = false;
   for (size_t i = 0; i < children.size();) {
-    if (children[i].first == name)
+    if (children[i].first == name) {
       children.erase(children.begin() + i);
-    else
+      removed = true;
+    } else
       ++i;
   }
+
+  // Positions of the children after the removed ones are now invalid.
+  if (removed) childrenIndex.reset();
+}
+
+std::size_t SerializerElement::FindChildPosition(const gd::String& name) const {
+  if (!childrenIndex) {
+    if (children.size() < childrenIndexThreshold) {
+      for (size_t i = 0; i < children.size(); ++i) {
+        if (children[i].second == std::shared_ptr<SerializerElement>())
+          continue;
+
+        if (children[i].first == name) return i;
+      }
+
+      return children.size();
+    }
+
+    childrenIndex.reset(new std::unordered_map<gd::String, std::size_t>());
+    childrenIndex->reserve(children.size());
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      // Only the first child with a given name is indexed.
+      childrenIndex->emplace(children[i].first, i);
+    }
+  }
+
+  auto it = childrenIndex->find(name);
+  return it == childrenIndex->end() ? children.size() : it->second;
 }
 
 void SerializerElement::Init(const gd::SerializerElement& other) {
   valueUndefined = other.valueUndefined;
+  isNull = other.isNull;
   elementValue = other.elementValue;
   attributes = other.attributes;
 
   children.clear();
+  childrenIndex.reset();
   for (const auto& child : other.children) {
-    children.push_back(
-        std::make_pair(child.first,
-                       std::shared_ptr<SerializerElement>(
-                           new SerializerElement(*child.second))));
+    children.push_back(std::make_pair(
+        child.first, std::make_shared<SerializerElement>(*child.second)));
   }
 
   isArray = other.isArray;
@@ -297,6 +359,7 @@ void SerializerElement::SetMultilineStringValue(const gd::String& value) {
 
   std::vector<gd::String> lines = value.Split('\n');
   children.clear();
+  childrenIndex.reset();
   ConsiderAsArrayOf("");
   for (const auto& line : lines) {
     AddChild("").SetStringValue(line);
@@ -9,11 +9,16 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Serialization/SerializerValue.h"
 #include "GDCore/String.h"
 
+namespace gd {
+class SerializerElementArena;
+}
+
 namespace gd {
 
 /**
@@ -28,9 +33,11 @@ namespace gd {
  * It also has specialized methods in GDevelop.js (see postjs.js) to be
  * converted to a JavaScript object.
  *
- * \note Children are stored with their order preserved, but this also
- * means that their access/removal is O(number of children). This class
- * is not appropriated for a use in game where fast access is required.
+ * \note Children are stored with their order preserved. Access to a child
+ * by its name is O(1) once the element has many children (an index of the
+ * children names is then built lazily), but removal is O(number of
+ * children). This class is not appropriated for a use in game where fast
+ * access is required.
  *
  * \see gd::Serializer
  */
@@ -47,6 +54,18 @@ class GD_CORE_API SerializerElement {
    */
   SerializerElement(const SerializerValue &value);
 
+  /**
+   * \brief Create an empty element whose children (and their own children)
+   * will be allocated in the given arena.
+   *
+   * Useful for large temporary trees (for example, a project serialized
+   * to be exported), which are then freed at once with the arena.
+   *
+   * \warning The arena must outlive the element. Copies of the element are
+   * not allocated in the arena.
+   */
+  SerializerElement(SerializerElementArena &arena);
+
   /**
    * Copy constructor.
    */
@@ -179,6 +198,24 @@ class GD_CORE_API SerializerElement {
    */
   bool IsValueUndefined() const { return valueUndefined; }
 
+  /**
+   * \brief Mark the element as null (a JSON null).
+   *
+   * The value stays undefined, so that the getters of attributes and children
+   * still return their default value, but the element is written back as null
+   * instead of an empty object.
+   */
+  void SetNullValue() { isNull = true; }
+
+  /**
+   * \brief Return true if the element was marked as null and was not given a
+   * value, attributes or children since.
+   */
+  bool IsNull() const {
+    return isNull && valueUndefined && attributes.empty() && children.empty() &&
+           !isArray;
+  }
+
   /**
    * \brief Save the value either as a string or as an array of strings if it
    * has line breaks.
@@ -287,7 +324,7 @@ class GD_CORE_API SerializerElement {
    */
   bool GetBoolAttribute(const gd::String &name,
                         bool defaultValue = false,
-                        gd::String deprecatedName = "") const;
+                        const gd::String &deprecatedName = "") const;
 
   /**
    * Get the value of an attribute being a string.
@@ -297,8 +334,8 @@ class GD_CORE_API SerializerElement {
    * used if the first one doesn't exist.
    */
   gd::String GetStringAttribute(const gd::String &name,
-                                gd::String defaultValue = "",
-                                gd::String deprecatedName = "") const;
+                                const gd::String &defaultValue = "",
+                                const gd::String &deprecatedName = "") const;
 
   /**
    * Get the value of an attribute being an int.
@@ -309,7 +346,7 @@ class GD_CORE_API SerializerElement {
    */
   int GetIntAttribute(const gd::String &name,
                       int defaultValue = 0,
-                      gd::String deprecatedName = "") const;
+                      const gd::String &deprecatedName = "") const;
 
   /**
    * Get the value of an attribute being a double.
@@ -320,7 +357,7 @@ class GD_CORE_API SerializerElement {
    */
   double GetDoubleAttribute(const gd::String &name,
                             double defaultValue = 0.0,
-                            gd::String deprecatedName = "") const;
+                            const gd::String &deprecatedName = "") const;
 
   /**
    * \deprecated Use HasChild instead. This should be removed from the codebase.
@@ -392,15 +429,29 @@ class GD_CORE_API SerializerElement {
    */
   SerializerElement &AddChild(gd::String name);
 
+  /**
+   * \brief Add, at the end of the children list, a child that is shared with
+   * other elements instead of being copied. Useful when the same element must
+   * be written in several places (for example, a resource used by several
+   * assets).
+   *
+   * \warning Modifying the child modifies it for all the elements having it.
+   *
+   * \param name The name of the new child.
+   * \param child The element to add as child.
+   */
+  void AddSharedChild(gd::String name,
+                      std::shared_ptr<SerializerElement> child);
+
   /**
    * \brief Get a child of the element using its name.
    *
    * \param name The name of the child.
    * \param name The index of the child, in case of an array.
    */
-  SerializerElement &GetChild(gd::String name,
+  SerializerElement &GetChild(const gd::String &name,
                               std::size_t index = 0,
-                              gd::String deprecatedName = "") const;
+                              const gd::String &deprecatedName = "") const;
 
   /**
    * \brief Get a child of the element using its index (when the element is
@@ -421,15 +472,15 @@ class GD_CORE_API SerializerElement {
    *
    * \see SerializerElement::ConsiderAsArrayOf
    */
-  std::size_t GetChildrenCount(gd::String name = "",
-                               gd::String deprecatedName = "") const;
+  std::size_t GetChildrenCount(const gd::String &name = "",
+                               const gd::String &deprecatedName = "") const;
 
   /**
    * \brief Return true if the specified child exists.
-   * \note Complexity is O(number of children).
    * \param name The name of the child to find.
    */
-  bool HasChild(const gd::String &name, gd::String deprecatedName = "") const;
+  bool HasChild(const gd::String &name,
+                const gd::String &deprecatedName = "") const;
 
   /**
    * \brief Remove the child with the specified name
@@ -456,16 +507,47 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement &other);
 
+  /**
+   * \brief Return the position of the first child with the given name, or
+   * the number of children if not found.
+   *
+   * Past a few children, an index of the children names is built (and then
+   * kept up to date when children are added) to make this O(1).
+   */
+  std::size_t FindChildPosition(const gd::String &name) const;
+
+  /**
+   * \brief Return the attribute with the given name (or else with the
+   * deprecated name), or nullptr if not found.
+   */
+  const SerializerValue *FindAttribute(const gd::String &name,
+                                       const gd::String &deprecatedName) const;
+
+  /**
+   * \brief Return the value of the child with the given name (or else with
+   * the deprecated name), or nullptr if not found or without value.
+   */
+  const SerializerValue *FindChildValue(const gd::String &name,
+                                        const gd::String &deprecatedName) const;
+
+  static constexpr std::size_t childrenIndexThreshold = 16;
+
   bool valueUndefined = true;  ///< If true, the element does not have a value.
+  bool isNull = false;  ///< If true, the element is null (see SetNullValue).
   SerializerValue elementValue;
 
   std::map<gd::String, SerializerValue> attributes;
   std::vector<std::pair<gd::String, std::shared_ptr<SerializerElement> > >
       children;
+  mutable std::unique_ptr<std::unordered_map<gd::String, std::size_t> >
+      childrenIndex;  ///< Position of the first child for each name, built
+                      ///< lazily. Reset when children are removed.
   mutable bool isArray = false;  ///< true if element is considered as an array
   mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
                                ///< parsed elements).
   mutable gd::String deprecatedArrayOf;  ///< Alternate name for children
+  SerializerElementArena *arena =
+      nullptr;  ///< If set, the arena where children are allocated.
 };
 
 }  // namespace gd
@@ -0,0 +1,36 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/SerializerElementArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace gd {
+
+void *SerializerElementArena::Allocate(std::size_t size,
+                                       std::size_t alignment) {
+  std::size_t padding =
+      (alignment - reinterpret_cast<std::uintptr_t>(current) % alignment) %
+      alignment;
+  if (current == nullptr || padding + size > remaining) {
+    // Allocations larger than a block get their own block.
+    std::size_t newBlockSize = std::max(blockSize, size + alignment);
+    blocks.push_back(std::unique_ptr<char[]>(new char[newBlockSize]));
+    reservedSize += newBlockSize;
+    current = blocks.back().get();
+    remaining = newBlockSize;
+    padding =
+        (alignment - reinterpret_cast<std::uintptr_t>(current) % alignment) %
+        alignment;
+  }
+
+  char *allocated = current + padding;
+  current += padding + size;
+  remaining -= padding + size;
+  return allocated;
+}
+
+}  // namespace gd
@@ -0,0 +1,88 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_SERIALIZERELEMENTARENA_H
+#define GDCORE_SERIALIZERELEMENTARENA_H
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief A monotonic memory arena used to allocate the elements of a
+ * temporary gd::SerializerElement tree.
+ *
+ * Memory is only released, at once, when the arena is destroyed. The arena
+ * must outlive all the elements allocated in it, and it is not thread-safe.
+ *
+ * \see gd::SerializerElement::SerializerElement(SerializerElementArena &)
+ */
+class GD_CORE_API SerializerElementArena {
+ public:
+  SerializerElementArena(std::size_t blockSize_ = 64 * 1024)
+      : blockSize(blockSize_), current(nullptr), remaining(0) {}
+  SerializerElementArena(const SerializerElementArena &) = delete;
+  SerializerElementArena &operator=(const SerializerElementArena &) = delete;
+
+  /**
+   * \brief Allocate memory for \a size bytes, aligned on \a alignment.
+   */
+  void *Allocate(std::size_t size, std::size_t alignment);
+
+  /**
+   * \brief Return the number of bytes reserved by the arena.
+   */
+  std::size_t GetReservedSize() const { return reservedSize; }
+
+ private:
+  std::size_t blockSize;
+  char *current;
+  std::size_t remaining;
+  std::size_t reservedSize = 0;
+  std::vector<std::unique_ptr<char[]>> blocks;
+};
+
+/**
+ * \brief A standard allocator allocating in a gd::SerializerElementArena.
+ * Deallocation is a no-op: memory is released with the arena.
+ */
+template <typename T>
+class SerializerElementArenaAllocator {
+ public:
+  typedef T value_type;
+
+  SerializerElementArenaAllocator(SerializerElementArena &arena_)
+      : arena(&arena_) {}
+  template <typename U>
+  SerializerElementArenaAllocator(
+      const SerializerElementArenaAllocator<U> &other)
+      : arena(other.arena) {}
+
+  T *allocate(std::size_t n) {
+    return static_cast<T *>(arena->Allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *, std::size_t) {}
+
+  template <typename U>
+  bool operator==(const SerializerElementArenaAllocator<U> &other) const {
+    return arena == other.arena;
+  }
+  template <typename U>
+  bool operator!=(const SerializerElementArenaAllocator<U> &other) const {
+    return arena != other.arena;
+  }
+
+ private:
+  template <typename U>
+  friend class SerializerElementArenaAllocator;
+
+  SerializerElementArena *arena;
+};
+
+}  // namespace gd
+
+#endif
@@ -9,6 +9,10 @@
 #include "GDCore/String.h"
 
 #include <algorithm>
+#include <cerrno>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
 #include <string.h>
 
 #include "GDCore/CommonTools.h"
@@ -62,7 +66,27 @@ String& String::operator=(const std::u32string &string)
 
 String::size_type String::size() const
 {
-    return std::distance(begin(), end());
+    // Skip the characters using their first byte only, without decoding them
+    // (like the iterators do, an invalid byte is counted as a character).
+    size_type count = 0;
+    const size_type bytesCount = m_string.size();
+    for( size_type i = 0; i < bytesCount; ++count )
+    {
+        unsigned char lead = static_cast<unsigned char>( m_string[i] );
+        if( lead < 0x80 ) i += 1;
+        else if( ( lead >> 5 ) == 0x6 ) i += 2;
+        else if( ( lead >> 4 ) == 0xE ) i += 3;
+        else if( ( lead >> 3 ) == 0x1E ) i += 4;
+        else i += 1;
+    }
+    return count;
+}
+
+bool String::IsAscii() const
+{
+    for( unsigned char byte : m_string )
+        if( byte >= 0x80 ) return false;
+    return true;
 }
 
 String::iterator String::begin()
@@ -85,6 +109,72 @@ String::const_iterator String::end() const
     return String::const_iterator(m_string.end());
 }
 
+namespace
+{
+
+/**
+ * The C functions use the decimal separator of the C locale, while streams
+ * always use '.' (unless the global C++ locale is changed).
+ */
+bool IsCLocaleDecimalPointADot()
+{
+    const char *decimalPoint = std::localeconv()->decimal_point;
+    return decimalPoint[0] == '.' && decimalPoint[1] == '\0';
+}
+
+bool IsMadeOf(const std::string &str, const char *allowedCharacters)
+{
+    return !str.empty() && str.find_first_not_of(allowedCharacters) == std::string::npos;
+}
+
+}
+
+bool String::FormatFloatingPoint(double value, char *buffer, std::size_t bufferSize)
+{
+    if (!IsCLocaleDecimalPointADot())
+        return false;
+
+    int length = std::snprintf(buffer, bufferSize, "%g", value);
+    return length > 0 && static_cast<std::size_t>(length) < bufferSize;
+}
+
+bool String::ParseInteger(const std::string &str, long long &value)
+{
+    if (!IsMadeOf(str, "0123456789+-"))
+        return false;
+
+    const char *begin = str.c_str();
+    char *end = nullptr;
+    errno = 0;
+    value = std::strtoll(begin, &end, 10);
+    return errno != ERANGE && end == begin + str.size();
+}
+
+bool String::ParseFloatingPoint(const std::string &str, double &value)
+{
+    // Hexadecimal numbers, "inf" or "nan" are not read the same by streams.
+    if (!IsMadeOf(str, "0123456789+-.eE") || !IsCLocaleDecimalPointADot())
+        return false;
+
+    const char *begin = str.c_str();
+    char *end = nullptr;
+    errno = 0;
+    value = std::strtod(begin, &end);
+    return errno != ERANGE && end == begin + str.size();
+}
+
+bool String::ParseFloatingPoint(const std::string &str, float &value)
+{
+    if (!IsMadeOf(str, "0123456789+-.eE") || !IsCLocaleDecimalPointADot())
+        return false;
+
+    const char *begin = str.c_str();
+    char *end = nullptr;
+    errno = 0;
+    value = std::strtof(begin, &end);
+    return errno != ERANGE && end == begin + str.size();
+}
+
 String String::FromLocale( const std::string &localizedString )
 {
 #if defined(WINDOWS)
@@ -197,6 +287,17 @@ String& String::ReplaceInvalid( value_type replacement )
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
+    // If the characters up to the position are ASCII, the byte at the position
+    // is the character.
+    if( position < m_string.size() )
+    {
+        size_type i = 0;
+        while( i <= position && static_cast<unsigned char>( m_string[i] ) < 0x80 )
+            ++i;
+        if( i > position )
+            return static_cast<unsigned char>( m_string[position] );
+    }
+
     const_iterator it = begin();
     std::advance(it, position);
     return *it;
@@ -12,8 +12,10 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "GDCore/Utf8/utf8.h"
@@ -158,6 +160,8 @@ public:
 
     /**
      * \brief Returns the string's length.
+     * \note This has a linear complexity on the string size (but the
+     * characters are not decoded).
      */
     size_type size() const;
 
@@ -216,30 +220,32 @@ public:
     /**
      * \brief Method to create a gd::String from a number (float, double, int, ...)
      * \return a gd::String created from **value**.
+     *
+     * \note The result is the same as writing **value** in a std::ostream,
+     * but integers and floating point numbers are converted without creating
+     * a stream.
      */
     template<typename T>
     static String From(T value)
     {
         static_assert(!std::is_same<T, std::string>::value, "Can't use gd::String::From with std::string.");
 
-        std::ostringstream oss;
-        oss << value;
-        return gd::String(oss.str().c_str());
+        return FromValue(value, FromConversion<T>());
     }
 
     /**
      * \brief Method to convert the string to a number
      * \return the string converted to the type **T**
+     *
+     * \note The result is the same as reading **T** from a std::istream, but
+     * strings containing only a number are converted without creating a stream.
      */
     template<typename T>
     T To() const
     {
         static_assert(!std::is_same<T, std::string>::value, "Can't use gd::String::To with std::string.");
 
-        T value;
-        std::istringstream oss(m_string);
-        oss >> value;
-        return value;
+        return ToValue<T>(ToConversion<T>());
     }
 
 /**
@@ -339,10 +345,18 @@ public:
      * \brief Returns the code point at the specified position
      * \warning This operator has a linear complexity on the character's
      * position. You should avoid to use it in a loop and use the iterators
-     * provided by this class instead.
+     * provided by this class instead (or check once that the string IsAscii
+     * and then index the bytes of Raw()).
      */
     value_type operator[]( const size_type position ) const;
 
+    /**
+     * \brief Returns true if the string is only made of ASCII characters, in
+     * which case each byte of Raw() is a character and it can be indexed
+     * directly.
+     */
+    bool IsAscii() const;
+
     /**
      * \brief Get the raw UTF8-encoded std::string
      */
@@ -677,6 +691,128 @@ public:
  */
 
 private:
+    struct StreamConversion {};
+    struct SignedIntegerConversion {};
+    struct UnsignedIntegerConversion {};
+    struct FloatingPointConversion {};
+
+    template<typename T>
+    using IsCharacterOrBool = std::integral_constant<bool,
+        std::is_same<T, bool>::value || std::is_same<T, char>::value ||
+        std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value ||
+        std::is_same<T, wchar_t>::value || std::is_same<T, char16_t>::value ||
+        std::is_same<T, char32_t>::value>;
+
+    template<typename T>
+    using IsFastInteger = std::integral_constant<bool,
+        std::is_integral<T>::value && !IsCharacterOrBool<T>::value>;
+
+    template<typename T>
+    using IsFastFloatingPoint = std::integral_constant<bool,
+        std::is_same<T, float>::value || std::is_same<T, double>::value>;
+
+    template<typename T>
+    using FromConversion = typename std::conditional<IsFastInteger<T>::value,
+        typename std::conditional<std::is_signed<T>::value, SignedIntegerConversion, UnsignedIntegerConversion>::type,
+        typename std::conditional<IsFastFloatingPoint<T>::value, FloatingPointConversion, StreamConversion>::type>::type;
+
+    /**
+     * Unsigned integers are read from streams with the modular arithmetic of
+     * strtoull (so "-1" is the biggest value): they are left to streams.
+     */
+    template<typename T>
+    using ToConversion = typename std::conditional<IsFastInteger<T>::value && std::is_signed<T>::value,
+        SignedIntegerConversion,
+        typename std::conditional<IsFastFloatingPoint<T>::value, FloatingPointConversion, StreamConversion>::type>::type;
+
+    template<typename T>
+    static String FromValue(T value, StreamConversion)
+    {
+        std::ostringstream oss;
+        oss << value;
+        return gd::String(oss.str().c_str());
+    }
+
+    template<typename T>
+    static String FromValue(T value, SignedIntegerConversion)
+    {
+        gd::String str;
+        str.m_string = std::to_string(static_cast<long long>(value));
+        return str;
+    }
+
+    template<typename T>
+    static String FromValue(T value, UnsignedIntegerConversion)
+    {
+        gd::String str;
+        str.m_string = std::to_string(static_cast<unsigned long long>(value));
+        return str;
+    }
+
+    template<typename T>
+    static String FromValue(T value, FloatingPointConversion)
+    {
+        char buffer[32];
+        if (!FormatFloatingPoint(value, buffer, sizeof(buffer)))
+            return FromValue(value, StreamConversion());
+
+        return gd::String(buffer);
+    }
+
+    template<typename T>
+    T ToValue(StreamConversion) const
+    {
+        T value;
+        std::istringstream oss(m_string);
+        oss >> value;
+        return value;
+    }
+
+    template<typename T>
+    T ToValue(SignedIntegerConversion) const
+    {
+        long long value;
+        if (!ParseInteger(m_string, value) ||
+            value < static_cast<long long>(std::numeric_limits<T>::min()) ||
+            value > static_cast<long long>(std::numeric_limits<T>::max()))
+            return ToValue<T>(StreamConversion());
+
+        return static_cast<T>(value);
+    }
+
+    template<typename T>
+    T ToValue(FloatingPointConversion) const
+    {
+        T value;
+        if (!ParseFloatingPoint(m_string, value))
+            return ToValue<T>(StreamConversion());
+
+        return value;
+    }
+
+    /**
+     * Write **value** in **buffer** like a std::ostream does (i.e: "%g").
+     * \return false if the number can't be written without a stream (because
+     * the C locale doesn't use '.' as decimal separator).
+     */
+    static bool FormatFloatingPoint(double value, char *buffer, std::size_t bufferSize);
+
+    /**
+     * Read **value** from **str** if it contains only an integer, without
+     * spaces.
+     * \return false if the string must be read with a stream instead (so that
+     * the stream rules apply to anything else, including out of range numbers).
+     */
+    static bool ParseInteger(const std::string &str, long long &value);
+
+    /**
+     * Read **value** from **str** if it contains only a decimal number (digits,
+     * sign, '.' and exponent), without spaces.
+     * \return false if the string must be read with a stream instead.
+     */
+    static bool ParseFloatingPoint(const std::string &str, double &value);
+    static bool ParseFloatingPoint(const std::string &str, float &value);
+
     std::string m_string; ///< Internal std::string container
 
 };
@@ -3,14 +3,41 @@
  * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
  * reserved. This project is released under the MIT License.
  */
+#include "GDCore/Tools/Localization.h"
+
+#include <atomic>
+
+namespace {
+
+std::atomic<std::size_t> translationsGeneration(0);
+
+}  // namespace
 
 #if defined(EMSCRIPTEN)
 #include <emscripten.h>
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #include "GDCore/String.h"
 
+namespace {
+
+std::mutex translationsCacheMutex;
+std::unordered_map<std::string, gd::String> translationsCache;
+
+}  // namespace
+
 namespace gd {
-gd::String GetTranslation(const char* str) {  // TODO: Inline?
+
+gd::String GetTranslation(const char* str) {
+  {
+    std::lock_guard<std::mutex> lock(translationsCacheMutex);
+    auto it = translationsCache.find(str);
+    if (it != translationsCache.end()) return it->second;
+  }
+
   const char* translatedStr = (const char*)EM_ASM_INT(
       {
         var getTranslation = Module['getTranslation'];
@@ -30,12 +57,36 @@ gd::String GetTranslation(const char* str) {  // TODO: Inline?
         return ensureString(translatedStr);
       },
       str);
-  return gd::String(translatedStr);  // TODO: Is copying necessary?
+  gd::String translation(translatedStr);
+
+  std::lock_guard<std::mutex> lock(translationsCacheMutex);
+  translationsCache.emplace(str, translation);
+  return translation;
 }
 
 gd::String GetTranslation(const gd::String& str) {
   return GetTranslation(str.c_str());
 }
 
+void TranslationsCache::Clear() {
+  std::lock_guard<std::mutex> lock(translationsCacheMutex);
+  translationsCache.clear();
+  translationsGeneration++;
+}
+
+}  // namespace gd
+#else
+namespace gd {
+
+void TranslationsCache::Clear() { translationsGeneration++; }
+
 }  // namespace gd
 #endif
+
+namespace gd {
+
+std::size_t TranslationsCache::GetGeneration() {
+  return translationsGeneration;
+}
+
+}  // namespace gd
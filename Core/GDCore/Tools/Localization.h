@@ -45,4 +45,32 @@ gd::String GetTranslation(const char* str);
 
 #endif
 
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief The strings already translated are kept in a cache, so that
+ * translating a string again does not call the translation function (which,
+ * with Emscripten, is a JavaScript function).
+ *
+ * The cache must be cleared when the translation function or the language is
+ * changed. In libGD.js, this is done when `getTranslation` is set.
+ */
+class GD_CORE_API TranslationsCache {
+ public:
+  /**
+   * \brief Forget all the translated strings.
+   */
+  static void Clear();
+
+  /**
+   * \brief Return a number changing each time the cache is cleared, so that
+   * other caches holding translated strings know they must be cleared too.
+   */
+  static std::size_t GetGeneration();
+};
+
+}  // namespace gd
+
 #endif  // GDCORE_LOCALIZATION_H
@@ -3,29 +3,187 @@
  * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
  * reserved. This project is released under the MIT License.
  */
+#include "GDCore/Tools/Log.h"
+
+#include <chrono>
 #include <iostream>
+#include <mutex>
+#if defined(EMSCRIPTEN)
+#include <emscripten.h>
+#endif
+
 #include "GDCore/String.h"
 
+namespace {
+
+struct LogState {
+  std::mutex mutex;
+  gd::LogSink::Level minimumLevel = gd::LogSink::Status;
+  gd::LogSink::Handler handler;
+
+  // The last message logged, and the number of times it was repeated since.
+  gd::LogSink::Level lastLevel = gd::LogSink::Status;
+  gd::String lastMessage;
+  std::size_t repetitionsCount = 0;
+
+  std::size_t maximumMessagesPerSecond = 0;
+  std::chrono::steady_clock::time_point periodStart;
+  std::size_t periodMessagesCount = 0;
+  std::size_t droppedMessagesCount = 0;
+};
+
+LogState& GetLogState() {
+  static LogState state;
+  return state;
+}
+
+void Emit(LogState& state, gd::LogSink::Level level, const gd::String& msg) {
+  if (state.handler) {
+    state.handler(level, msg);
+    return;
+  }
+
+  // Only flush for errors, as flushing for every line is slow (in particular
+  // with Emscripten, where each line is then sent to the JavaScript console).
+  std::cout << gd::LogSink::GetLevelPrefix(level) << msg << '\n';
+  if (level >= gd::LogSink::Error) std::cout.flush();
+}
+
+void EmitRepetitions(LogState& state) {
+  if (state.repetitionsCount == 0) return;
+
+  Emit(state,
+       state.lastLevel,
+       "(previous message repeated " +
+           gd::String::From(state.repetitionsCount) + " more times)");
+  state.repetitionsCount = 0;
+}
+
+void EmitDroppedMessages(LogState& state) {
+  if (state.droppedMessagesCount == 0) return;
+
+  Emit(state,
+       gd::LogSink::Warning,
+       gd::String::From(state.droppedMessagesCount) +
+           " messages were not logged because too many messages were logged "
+           "in a second.");
+  state.droppedMessagesCount = 0;
+}
+
+}  // namespace
+
 namespace gd {
 
+void LogSink::SetMinimumLevel(Level level) {
+  LogState& state = GetLogState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.minimumLevel = level;
+}
+
+void LogSink::SetMaximumMessagesPerSecond(std::size_t count) {
+  LogState& state = GetLogState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.maximumMessagesPerSecond = count;
+  state.periodMessagesCount = 0;
+}
+
+void LogSink::SetHandler(Handler handler) {
+  LogState& state = GetLogState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  EmitRepetitions(state);
+  EmitDroppedMessages(state);
+  state.handler = std::move(handler);
+  state.lastMessage.clear();
+}
+
+void LogSink::UseJavaScriptHandler() {
+#if defined(EMSCRIPTEN)
+  SetHandler([](Level level, const gd::String& msg) {
+    EM_ASM(
+        {
+          var onLog = Module['onLog'];
+          if (onLog) onLog($0, UTF8ToString($1));
+        },
+        static_cast<int>(level),
+        msg.c_str());
+  });
+#endif
+}
+
+void LogSink::Flush() {
+  LogState& state = GetLogState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  EmitRepetitions(state);
+  EmitDroppedMessages(state);
+  std::cout.flush();
+}
+
+void LogSink::Log(Level level, const gd::String& msg) {
+  LogState& state = GetLogState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (level < state.minimumLevel) return;
+
+  if (level == state.lastLevel && !state.lastMessage.empty() &&
+      msg == state.lastMessage) {
+    state.repetitionsCount++;
+    return;
+  }
+  EmitRepetitions(state);
+
+  if (state.maximumMessagesPerSecond != 0 && level < Error) {
+    auto now = std::chrono::steady_clock::now();
+    if (now - state.periodStart >= std::chrono::seconds(1)) {
+      EmitDroppedMessages(state);
+      state.periodStart = now;
+      state.periodMessagesCount = 0;
+    }
+    if (state.periodMessagesCount >= state.maximumMessagesPerSecond) {
+      state.droppedMessagesCount++;
+      state.lastMessage.clear();
+      return;
+    }
+    state.periodMessagesCount++;
+  }
+
+  state.lastLevel = level;
+  state.lastMessage = msg;
+  Emit(state, level, msg);
+}
+
+const char* LogSink::GetLevelPrefix(Level level) {
+  switch (level) {
+    case Status:
+      return "STATUS: ";
+    case Message:
+      return "MESSAGE: ";
+    case Warning:
+      return "WARNING: ";
+    case Error:
+      return "ERROR: ";
+    case FatalError:
+      return "FATAL ERROR: ";
+  }
+  return "";
+}
+
 void GD_CORE_API LogWarning(const gd::String& msg) {
-  std::cout << "WARNING: " << msg << std::endl;
+  LogSink::Log(LogSink::Warning, msg);
 }
 
 void GD_CORE_API LogError(const gd::String& msg) {
-  std::cout << "ERROR: " << msg << std::endl;
+  LogSink::Log(LogSink::Error, msg);
 }
 
 void GD_CORE_API LogFatalError(const gd::String& msg) {
-  std::cout << "FATAL ERROR: " << msg << std::endl;
+  LogSink::Log(LogSink::FatalError, msg);
 }
 
 void GD_CORE_API LogMessage(const gd::String& msg) {
-  std::cout << "MESSAGE: " << msg << std::endl;
+  LogSink::Log(LogSink::Message, msg);
 }
 
 void GD_CORE_API LogStatus(const gd::String& msg) {
-  std::cout << "STATUS: " << msg << std::endl;
+  LogSink::Log(LogSink::Status, msg);
 }
 
 }  // namespace gd
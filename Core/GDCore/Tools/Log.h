@@ -5,11 +5,80 @@
  */
 #ifndef GDCORE_LOG_H
 #define GDCORE_LOG_H
+#include <cstddef>
+#include <functional>
 #include <string>
 #include "GDCore/String.h"
 
 namespace gd {
 
+/**
+ * \brief Configure where and how the messages given to gd::LogWarning,
+ * gd::LogError, gd::LogStatus... are logged.
+ *
+ * By default, messages are written to the standard output, which is only
+ * flushed for errors (or when Flush is called), instead of for every line.
+ * Messages below a minimum level can be ignored, and a message repeated
+ * several times in a row is only logged once, followed by the number of
+ * repetitions when another message is logged (or when Flush is called).
+ * The number of messages logged per second can also be limited (errors are
+ * never dropped).
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API LogSink {
+ public:
+  enum Level { Status = 0, Message, Warning, Error, FatalError };
+
+  /**
+   * \brief A function receiving the messages to log.
+   * \note The handler is called while the logging is locked: it must not log
+   * messages itself.
+   */
+  typedef std::function<void(Level level, const gd::String &msg)> Handler;
+
+  /**
+   * \brief Ignore the messages with a level lower than \a level.
+   */
+  static void SetMinimumLevel(Level level);
+
+  /**
+   * \brief Drop the messages (except errors) logged after \a count messages
+   * in the same second. The number of dropped messages is logged afterwards.
+   * 0 means no limit (the default).
+   */
+  static void SetMaximumMessagesPerSecond(std::size_t count);
+
+  /**
+   * \brief Send the messages to \a handler instead of the standard output.
+   * An empty handler restores the standard output.
+   */
+  static void SetHandler(Handler handler);
+
+  /**
+   * \brief Send the messages to the JavaScript function `Module.onLog`
+   * (called with the level and the message). Only available with Emscripten.
+   */
+  static void UseJavaScriptHandler();
+
+  /**
+   * \brief Log the repetitions of the last message not logged yet, and flush
+   * the standard output.
+   */
+  static void Flush();
+
+  /**
+   * \brief Log a message with the given level.
+   */
+  static void Log(Level level, const gd::String &msg);
+
+  /**
+   * \brief Return the prefix written before the messages of this level
+   * ("WARNING: "...) on the standard output.
+   */
+  static const char *GetLevelPrefix(Level level);
+};
+
 /**
  * \brief Standard function that should be used when emitting a warning to be
  * displayed to the user.
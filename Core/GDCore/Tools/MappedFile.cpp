@@ -0,0 +1,67 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/MappedFile.h"
+
+#include <fstream>
+
+#if defined(LINUX) || defined(MACOS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gd {
+
+MappedFile::MappedFile(const gd::String &filename)
+    : isOpened(false), data(nullptr), size(0), isMapped(false) {
+#if defined(LINUX) || defined(MACOS)
+  int fileDescriptor = open(filename.c_str(), O_RDONLY);
+  if (fileDescriptor != -1) {
+    struct stat fileStat;
+    if (fstat(fileDescriptor, &fileStat) == 0) {
+      size = static_cast<std::size_t>(fileStat.st_size);
+      if (size == 0) {
+        isOpened = true;
+      } else {
+        void *mapping =
+            mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping != MAP_FAILED) {
+          data = static_cast<const char *>(mapping);
+          isMapped = true;
+          isOpened = true;
+        }
+      }
+    }
+    // The mapping stays valid after the file is closed.
+    close(fileDescriptor);
+    if (isOpened) return;
+  }
+  size = 0;
+#endif
+
+  std::ifstream file(filename.ToLocale().c_str(),
+                     std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file.is_open()) return;
+
+  std::streamoff fileSize = file.tellg();
+  if (fileSize < 0) return;
+  buffer.resize(static_cast<std::size_t>(fileSize));
+  file.seekg(0);
+  if (!buffer.empty() && !file.read(buffer.data(), buffer.size())) return;
+
+  data = buffer.data();
+  size = buffer.size();
+  isOpened = true;
+}
+
+MappedFile::~MappedFile() {
+#if defined(LINUX) || defined(MACOS)
+  if (isMapped) munmap(const_cast<char *>(data), size);
+#endif
+}
+
+}  // namespace gd
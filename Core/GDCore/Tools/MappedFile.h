@@ -0,0 +1,65 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Give a read-only access to the content of a file, without copying
+ * it in memory when possible.
+ *
+ * On Linux and macOS, the file is memory-mapped: its pages are only read
+ * when accessed and are not copied. On other systems (Windows, Emscripten),
+ * the file is read into a buffer.
+ *
+ * Typically used by native tools to load big projects:
+ * \code
+ * gd::MappedFile file("project.json");
+ * if (file.IsOpened()) {
+ *   gd::SerializerElement element =
+ *       gd::Serializer::FromJSON(file.GetData(), file.GetSize());
+ * }
+ * \endcode
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API MappedFile {
+ public:
+  MappedFile(const gd::String &filename);
+  virtual ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  /**
+   * \brief Return true if the file could be opened and read.
+   */
+  bool IsOpened() const { return isOpened; }
+
+  /**
+   * \brief Return the content of the file. It is not null-terminated.
+   */
+  const char *GetData() const { return data; }
+
+  /**
+   * \brief Return the size of the file, in bytes.
+   */
+  std::size_t GetSize() const { return size; }
+
+ private:
+  bool isOpened;
+  const char *data;
+  std::size_t size;
+  bool isMapped;  ///< True if data is mapped, false if it points to buffer.
+  std::vector<char> buffer;
+};
+
+}  // namespace gd
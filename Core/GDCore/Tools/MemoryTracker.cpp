@@ -0,0 +1,183 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/MemoryTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+
+thread_local gd::MemoryTracker::Subsystem currentSubsystem =
+    gd::MemoryTracker::Other;
+
+std::atomic<std::size_t>
+    allocatedBytes[gd::MemoryTracker::SubsystemsCount];
+std::atomic<std::size_t>
+    peakAllocatedBytes[gd::MemoryTracker::SubsystemsCount];
+std::atomic<std::size_t>
+    allocationsCount[gd::MemoryTracker::SubsystemsCount];
+
+}  // namespace
+
+namespace gd {
+
+MemoryTracker::Scope::Scope(Subsystem subsystem)
+    : previousSubsystem(currentSubsystem) {
+  currentSubsystem = subsystem;
+}
+
+MemoryTracker::Scope::~Scope() { currentSubsystem = previousSubsystem; }
+
+bool MemoryTracker::IsEnabled() {
+#if defined(GD_MEMORY_TRACKING)
+  return true;
+#else
+  return false;
+#endif
+}
+
+const char *MemoryTracker::GetSubsystemName(Subsystem subsystem) {
+  switch (subsystem) {
+    case ProjectModel:
+      return "projectModel";
+    case Events:
+      return "events";
+    case Expressions:
+      return "expressions";
+    case Serializer:
+      return "serializer";
+    case Metadata:
+      return "metadata";
+    default:
+      return "other";
+  }
+}
+
+std::size_t MemoryTracker::GetAllocatedBytes(Subsystem subsystem) {
+  if (subsystem < 0 || subsystem >= SubsystemsCount) return 0;
+  return allocatedBytes[subsystem];
+}
+
+std::size_t MemoryTracker::GetPeakAllocatedBytes(Subsystem subsystem) {
+  if (subsystem < 0 || subsystem >= SubsystemsCount) return 0;
+  return peakAllocatedBytes[subsystem];
+}
+
+std::size_t MemoryTracker::GetAllocationsCount(Subsystem subsystem) {
+  if (subsystem < 0 || subsystem >= SubsystemsCount) return 0;
+  return allocationsCount[subsystem];
+}
+
+gd::String MemoryTracker::ToJSON() {
+  gd::SerializerElement element;
+  element.SetAttribute("enabled", IsEnabled());
+
+  auto &subsystemsElement = element.AddChild("subsystems");
+  for (int i = 0; i < SubsystemsCount; i++) {
+    Subsystem subsystem = static_cast<Subsystem>(i);
+    subsystemsElement.AddChild(GetSubsystemName(subsystem))
+        .SetAttribute("allocatedBytes",
+                      static_cast<double>(GetAllocatedBytes(subsystem)))
+        .SetAttribute("peakAllocatedBytes",
+                      static_cast<double>(GetPeakAllocatedBytes(subsystem)))
+        .SetAttribute("allocationsCount",
+                      static_cast<double>(GetAllocationsCount(subsystem)));
+  }
+
+  return gd::Serializer::ToJSON(element);
+}
+
+MemoryTracker::Subsystem MemoryTracker::GetCurrentSubsystem() {
+  return currentSubsystem;
+}
+
+void MemoryTracker::RecordAllocation(Subsystem subsystem, std::size_t size) {
+  std::size_t allocated = (allocatedBytes[subsystem] += size);
+  allocationsCount[subsystem]++;
+
+  std::size_t peak = peakAllocatedBytes[subsystem];
+  while (allocated > peak &&
+         !peakAllocatedBytes[subsystem].compare_exchange_weak(peak, allocated)) {
+  }
+}
+
+void MemoryTracker::RecordDeallocation(Subsystem subsystem, std::size_t size) {
+  allocatedBytes[subsystem] -= size;
+  allocationsCount[subsystem]--;
+}
+
+}  // namespace gd
+
+#if defined(GD_MEMORY_TRACKING)
+namespace {
+
+/**
+ * \brief Header put before each allocated block, to know its size and the
+ * subsystem it was attributed to when it is freed. Keeps the alignment of
+ * the blocks returned by malloc.
+ */
+struct alignas(std::max_align_t) AllocationHeader {
+  std::size_t size;
+  gd::MemoryTracker::Subsystem subsystem;
+};
+
+void *Allocate(std::size_t size) {
+  AllocationHeader *header = static_cast<AllocationHeader *>(
+      std::malloc(sizeof(AllocationHeader) + size));
+  if (!header) return nullptr;
+
+  header->size = size;
+  header->subsystem = currentSubsystem;
+  gd::MemoryTracker::RecordAllocation(header->subsystem, size);
+  return header + 1;
+}
+
+void *AllocateOrThrow(std::size_t size) {
+  while (true) {
+    void *block = Allocate(size);
+    if (block) return block;
+
+    std::new_handler handler = std::get_new_handler();
+    if (!handler) throw std::bad_alloc();
+    handler();
+  }
+}
+
+void Deallocate(void *block) {
+  if (!block) return;
+
+  AllocationHeader *header = static_cast<AllocationHeader *>(block) - 1;
+  gd::MemoryTracker::RecordDeallocation(header->subsystem, header->size);
+  std::free(header);
+}
+
+}  // namespace
+
+void *operator new(std::size_t size) { return AllocateOrThrow(size); }
+void *operator new[](std::size_t size) { return AllocateOrThrow(size); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return Allocate(size);
+}
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return Allocate(size);
+}
+void operator delete(void *block) noexcept { Deallocate(block); }
+void operator delete[](void *block) noexcept { Deallocate(block); }
+void operator delete(void *block, const std::nothrow_t &) noexcept {
+  Deallocate(block);
+}
+void operator delete[](void *block, const std::nothrow_t &) noexcept {
+  Deallocate(block);
+}
+void operator delete(void *block, std::size_t) noexcept { Deallocate(block); }
+void operator delete[](void *block, std::size_t) noexcept {
+  Deallocate(block);
+}
+#endif
@@ -0,0 +1,109 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Record the memory allocated by each subsystem (project model,
+ * events, expressions, serializer elements, metadata...), to find which one
+ * is using the most memory.
+ *
+ * Code allocating for a subsystem is enclosed in a gd::MemoryTracker::Scope:
+ * \code
+ * gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Events);
+ * \endcode
+ * The memory is attributed to the innermost scope, and is given back to the
+ * same subsystem when it is freed, whatever the scope is at this moment.
+ *
+ * Allocations are only recorded when GDevelop is built with
+ * `GD_MEMORY_TRACKING` (the global `operator new` and `operator delete` are
+ * then replaced to record them). Otherwise, scopes cost almost nothing and
+ * all the measures are 0.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API MemoryTracker {
+ public:
+  enum Subsystem {
+    Other = 0,
+    ProjectModel,
+    Events,
+    Expressions,
+    Serializer,
+    Metadata,
+    SubsystemsCount
+  };
+
+  /**
+   * \brief Attribute the memory allocated during the lifetime of the scope
+   * to a subsystem.
+   */
+  class GD_CORE_API Scope {
+   public:
+    Scope(Subsystem subsystem);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+   private:
+    Subsystem previousSubsystem;
+  };
+
+  /**
+   * \brief Return true if GDevelop was built with `GD_MEMORY_TRACKING`, so
+   * that allocations are recorded.
+   */
+  static bool IsEnabled();
+
+  /**
+   * \brief Return the name of the subsystem, as used in the report.
+   */
+  static const char *GetSubsystemName(Subsystem subsystem);
+
+  /**
+   * \brief Return the bytes currently allocated by the subsystem.
+   */
+  static std::size_t GetAllocatedBytes(Subsystem subsystem);
+
+  /**
+   * \brief Return the highest number of bytes allocated at once by the
+   * subsystem.
+   */
+  static std::size_t GetPeakAllocatedBytes(Subsystem subsystem);
+
+  /**
+   * \brief Return the number of blocks currently allocated by the subsystem.
+   */
+  static std::size_t GetAllocationsCount(Subsystem subsystem);
+
+  /**
+   * \brief Return the measures of all the subsystems, as JSON.
+   */
+  static gd::String ToJSON();
+
+  /**
+   * \brief Return the subsystem to which allocations are attributed.
+   */
+  static Subsystem GetCurrentSubsystem();
+
+  /**
+   * \brief Record an allocation (or a deallocation). Called by the
+   * allocation functions.
+   */
+  static void RecordAllocation(Subsystem subsystem, std::size_t size);
+  static void RecordDeallocation(Subsystem subsystem, std::size_t size);
+
+ private:
+  MemoryTracker(){};
+};
+
+}  // namespace gd
@@ -0,0 +1,162 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/PerfScope.h"
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+struct PerfScope::Node {
+  Node(const char *name_) : name(name_) {}
+
+  Node &GetChild(const char *childName) {
+    // Scopes have few children: a linear search is faster than a map,
+    // and does not allocate.
+    for (auto &child : children)
+      if (std::strcmp(child->name, childName) == 0) return *child;
+
+    children.push_back(std::unique_ptr<Node>(new Node(childName)));
+    return *children.back();
+  }
+
+  const Node *FindChild(const gd::String &childName) const {
+    for (auto &child : children)
+      if (childName == child->name) return child.get();
+
+    return nullptr;
+  }
+
+  void SerializeTo(gd::SerializerElement &element) const {
+    element.SetAttribute("name", gd::String(name));
+    element.SetAttribute("callsCount", static_cast<double>(callsCount));
+    element.SetAttribute("totalDuration", totalDuration);
+
+    auto &childrenElement = element.AddChild("children");
+    childrenElement.ConsiderAsArrayOf("timing");
+    for (auto &child : children)
+      child->SerializeTo(childrenElement.AddChild("timing"));
+  }
+
+  const char *name;
+  std::size_t callsCount = 0;
+  double totalDuration = 0;  ///< In milliseconds.
+  std::vector<std::unique_ptr<Node>> children;
+};
+
+}  // namespace gd
+
+namespace {
+
+std::atomic<bool> enabled(false);
+std::thread::id recordingThreadId;
+gd::PerfScope::Node *rootNode = nullptr;
+gd::PerfScope::Node *currentNode = nullptr;
+std::map<gd::String, double> counters;
+
+bool IsRecordingThread() {
+  return enabled && std::this_thread::get_id() == recordingThreadId;
+}
+
+gd::PerfScope::Node &GetRootNode() {
+  if (!rootNode) rootNode = new gd::PerfScope::Node("");
+  return *rootNode;
+}
+
+const gd::PerfScope::Node *FindNode(const gd::String &path) {
+  const gd::PerfScope::Node *node = &GetRootNode();
+  for (const gd::String &name : path.Split(U'/')) {
+    node = node->FindChild(name);
+    if (!node) return nullptr;
+  }
+
+  return node;
+}
+
+}  // namespace
+
+namespace gd {
+
+PerfScope::PerfScope(const char *name) : node(nullptr), parentNode(nullptr) {
+  if (!IsRecordingThread()) return;
+
+  parentNode = currentNode ? currentNode : &GetRootNode();
+  node = &parentNode->GetChild(name);
+  currentNode = node;
+  startTime = std::chrono::steady_clock::now();
+}
+
+PerfScope::~PerfScope() {
+  if (!node) return;
+
+  // Still recorded if recording was disabled during the scope, so that the
+  // parents are always restored.
+  node->callsCount++;
+  node->totalDuration += std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() - startTime)
+                             .count();
+  currentNode = parentNode;
+}
+
+void PerfScope::Enable(bool enable) {
+  if (enable) recordingThreadId = std::this_thread::get_id();
+  enabled = enable;
+}
+
+bool PerfScope::IsEnabled() { return enabled; }
+
+void PerfScope::Reset() {
+  delete rootNode;
+  rootNode = nullptr;
+  currentNode = nullptr;
+  counters.clear();
+}
+
+void PerfScope::IncrementCounter(const char *name, double value) {
+  if (!IsRecordingThread()) return;
+
+  counters[name] += value;
+}
+
+double PerfScope::GetCounter(const gd::String &name) {
+  auto it = counters.find(name);
+  return it != counters.end() ? it->second : 0;
+}
+
+std::size_t PerfScope::GetCallsCount(const gd::String &path) {
+  const Node *node = FindNode(path);
+  return node ? node->callsCount : 0;
+}
+
+double PerfScope::GetTotalDuration(const gd::String &path) {
+  const Node *node = FindNode(path);
+  return node ? node->totalDuration : 0;
+}
+
+gd::String PerfScope::ToJSON() {
+  gd::SerializerElement element;
+  element.SetAttribute("enabled", IsEnabled());
+
+  auto &timingsElement = element.AddChild("timings");
+  timingsElement.ConsiderAsArrayOf("timing");
+  for (auto &child : GetRootNode().children)
+    child->SerializeTo(timingsElement.AddChild("timing"));
+
+  auto &countersElement = element.AddChild("counters");
+  for (const auto &it : counters)
+    countersElement.AddChild(it.first).SetValue(it.second);
+
+  return gd::Serializer::ToJSON(element);
+}
+
+}  // namespace gd
@@ -0,0 +1,108 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Measure the time spent in the load, save, export and refactoring
+ * operations, to find which one is slow on large projects.
+ *
+ * A timed operation is enclosed in a gd::PerfScope, named after the
+ * operation:
+ * \code
+ * gd::PerfScope perfScope("Project::UnserializeFrom");
+ * \endcode
+ * Timings are hierarchical: a scope is recorded as a child of the scope
+ * enclosing it, and the calls of a scope with the same parent are
+ * aggregated (number of calls and total duration). Named counters can also
+ * be incremented (for example, the number of scenes loaded).
+ *
+ * Nothing is recorded until gd::PerfScope::Enable is called: scopes then
+ * cost a single test. Names must be string literals (they are not copied).
+ * Only the scopes of the thread which enabled the recording are recorded:
+ * scopes in other threads (code generation threads, for example) are
+ * ignored.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API PerfScope {
+ public:
+  /**
+   * \brief Start timing an operation, until the scope is destroyed.
+   */
+  PerfScope(const char *name);
+  ~PerfScope();
+
+  PerfScope(const PerfScope &) = delete;
+  PerfScope &operator=(const PerfScope &) = delete;
+
+  /**
+   * \brief Start or stop recording the timings and the counters, in the
+   * calling thread.
+   */
+  static void Enable(bool enable);
+
+  /**
+   * \brief Return true if the timings and the counters are recorded.
+   */
+  static bool IsEnabled();
+
+  /**
+   * \brief Remove all the recorded timings and counters.
+   *
+   * \warning Must not be called while a scope is alive.
+   */
+  static void Reset();
+
+  /**
+   * \brief Add a value to a named counter (if recording is enabled).
+   */
+  static void IncrementCounter(const char *name, double value = 1);
+
+  /**
+   * \brief Return the value of a counter, or 0 if it was never incremented.
+   */
+  static double GetCounter(const gd::String &name);
+
+  /**
+   * \brief Return how many times a scope was entered.
+   *
+   * \param path The names of the scope and of its parents, from the
+   * outermost one, separated by "/" (for example
+   * "Project::UnserializeFrom/Layout::UnserializeFrom").
+   */
+  static std::size_t GetCallsCount(const gd::String &path);
+
+  /**
+   * \brief Return the total time spent in a scope, in milliseconds.
+   *
+   * \param path See GetCallsCount.
+   */
+  static double GetTotalDuration(const gd::String &path);
+
+  /**
+   * \brief Return the timings tree and the counters, as JSON.
+   */
+  static gd::String ToJSON();
+
+  /**
+   * \brief A node of the timings tree (internal).
+   */
+  struct Node;
+
+ private:
+  Node *node;  ///< The node of the scope, or nullptr if not recording.
+  Node *parentNode;
+  std::chrono::steady_clock::time_point startTime;
+};
+
+}  // namespace gd
@@ -0,0 +1,51 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/TasksRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#if !defined(EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#include <thread>
+#define GD_TASKS_RUNNER_USE_THREADS
+#endif
+
+namespace gd {
+
+void TasksRunner::Run(std::size_t tasksCount,
+                      std::size_t threadsCount,
+                      const std::function<void(std::size_t)> &task) {
+  std::atomic<std::size_t> nextTaskIndex(0);
+  auto runNextTasks = [&]() {
+    for (std::size_t index = nextTaskIndex++; index < tasksCount;
+         index = nextTaskIndex++) {
+      task(index);
+    }
+  };
+
+#if defined(GD_TASKS_RUNNER_USE_THREADS)
+  if (threadsCount == 0) threadsCount = std::thread::hardware_concurrency();
+  threadsCount = std::min(threadsCount, tasksCount);
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < threadsCount; i++)
+    threads.emplace_back(runNextTasks);
+  runNextTasks();
+  for (auto &thread : threads) thread.join();
+#else
+  runNextTasks();
+#endif
+}
+
+bool TasksRunner::AreThreadsSupported() {
+#if defined(GD_TASKS_RUNNER_USE_THREADS)
+  return true;
+#else
+  return false;
+#endif
+}
+
+}  // namespace gd
@@ -0,0 +1,50 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace gd {
+
+/**
+ * \brief Tool class to run independent tasks on several threads.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API TasksRunner {
+ public:
+  /**
+   * \brief Run \a task for each index from 0 to \a tasksCount, on
+   * \a threadsCount threads (including the calling one), and wait for all of
+   * them to be done.
+   *
+   * Each thread takes the next task not started yet, so that threads
+   * finishing early don't wait for the others. Tasks must not depend on
+   * each other's results.
+   *
+   * \param threadsCount The number of threads to use. 0 means as many as the
+   * hardware can run concurrently.
+   *
+   * \note Tasks are run one after the other on the calling thread when
+   * threads are not supported (Emscripten without threads support).
+   */
+  static void Run(std::size_t tasksCount,
+                  std::size_t threadsCount,
+                  const std::function<void(std::size_t)> &task);
+
+  /**
+   * \brief Return true if tasks are really run on several threads on this
+   * platform.
+   */
+  static bool AreThreadsSupported();
+
+ private:
+  TasksRunner(){};
+  virtual ~TasksRunner(){};
+};
+
+}  // namespace gd
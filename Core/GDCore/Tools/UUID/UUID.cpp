@@ -0,0 +1,59 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/UUID/UUID.h"
+
+#include <cstdint>
+#include <random>
+
+namespace gd {
+namespace UUID {
+
+namespace {
+std::mt19937_64 MakeGenerator() {
+  std::random_device device;
+  std::seed_seq seed{device(), device(), device(), device(),
+                     device(), device(), device(), device()};
+  return std::mt19937_64(seed);
+}
+
+void WriteHexDigits(std::uint64_t value,
+                    std::size_t firstDigit,
+                    std::size_t digitsCount,
+                    std::string& output) {
+  static const char hexDigits[] = "0123456789abcdef";
+  for (std::size_t i = firstDigit; i < firstDigit + digitsCount; ++i) {
+    output.push_back(hexDigits[(value >> (60 - i * 4)) & 0xF]);
+  }
+}
+}  // namespace
+
+gd::String MakeUuid4() {
+  thread_local std::mt19937_64 generator = MakeGenerator();
+
+  // Set the version (4) and the variant (RFC 4122) bits.
+  const std::uint64_t ab =
+      (generator() & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL;
+  const std::uint64_t cd =
+      (generator() & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;
+
+  // Written as xxxxxxxx-xxxx-4xxx-yxxx-xxxxxxxxxxxx.
+  gd::String uuid;
+  std::string& output = uuid.Raw();
+  output.reserve(36);
+  WriteHexDigits(ab, 0, 8, output);
+  output.push_back('-');
+  WriteHexDigits(ab, 8, 4, output);
+  output.push_back('-');
+  WriteHexDigits(ab, 12, 4, output);
+  output.push_back('-');
+  WriteHexDigits(cd, 0, 4, output);
+  output.push_back('-');
+  WriteHexDigits(cd, 4, 12, output);
+  return uuid;
+}
+
+}  // namespace UUID
+}  // namespace gd
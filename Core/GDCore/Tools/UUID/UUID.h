@@ -8,15 +8,18 @@
 #define GDCORE_TOOLS_UUID_UUID_H
 
 #include "GDCore/String.h"
-#include "sole.h"
 
 namespace gd {
 namespace UUID {
 
 /**
  * Generate a random UUID v4
+ *
+ * \note The random numbers come from a generator for each thread, seeded
+ * from std::random_device when first used. std::random_device is not called
+ * for each UUID as it can be slow (with Emscripten, it calls the crypto API).
  */
-inline gd::String MakeUuid4() { return gd::String::From(sole::uuid4()); }
+gd::String GD_CORE_API MakeUuid4();
 
 }  // namespace UUID
 }  // namespace gd
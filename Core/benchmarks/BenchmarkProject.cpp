@@ -0,0 +1,211 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkProject.h"
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/PlatformManager.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+
+class BenchmarkPlatform : public gd::Platform {
+ public:
+  gd::String GetName() const override { return "GDevelop JS platform"; }
+  gd::String GetFullName() const override {
+    return "GDevelop JS platform (GDCore extensions)";
+  }
+};
+
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const std::vector<gd::String> &parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); i++)
+    instruction.SetParameter(i, parameters[i]);
+  return instruction;
+}
+
+void InsertBenchmarkEvents(gd::EventsList &events,
+                           const BenchmarkProjectSize &size,
+                           std::size_t sceneIndex,
+                           std::size_t index,
+                           std::size_t depth) {
+  gd::String objectName =
+      "Object" + gd::String::From(index % size.objectsCount);
+  gd::String groupName = "Group" + gd::String::From(index % size.groupsCount);
+  gd::String counterName = "Counter" + gd::String::From(index % 10);
+
+  gd::StandardEvent event;
+  event.SetType("BuiltinCommonInstructions::Standard");
+  event.GetConditions().Insert(MakeInstruction(
+      "NumberVariable", {counterName, ">", gd::String::From(index) + " * 2"}));
+  event.GetConditions().Insert(
+      MakeInstruction("PosX", {objectName, "<", "SceneWidth / 2 + 100"}));
+  event.GetActions().Insert(MakeInstruction(
+      "MettreX",
+      {objectName,
+       "+",
+       objectName + ".Variable(Health) * 2 + cos(TimeDelta())"}));
+  event.GetActions().Insert(
+      MakeInstruction("MettreX", {groupName, "=", objectName + ".X() + 16"}));
+  event.GetActions().Insert(
+      MakeInstruction("SetNumberVariable", {counterName, "+", "1"}));
+  if (depth == 1 && index % 10 == 0) {
+    gd::String nextSceneName =
+        "Scene" + gd::String::From((sceneIndex + 1) % size.scenesCount);
+    event.GetActions().Insert(MakeInstruction(
+        "Scene", {"", "\"" + nextSceneName + "\"", "yes"}));
+  }
+
+  gd::BaseEvent &insertedEvent = events.InsertEvent(event);
+  if (depth > 1) {
+    InsertBenchmarkEvents(
+        insertedEvent.GetSubEvents(), size, sceneIndex, index, depth - 1);
+  }
+}
+
+}  // namespace
+
+gd::Platform &GetBenchmarkPlatform() {
+  static std::shared_ptr<gd::Platform> platform;
+  if (platform) return *platform;
+
+  platform = std::make_shared<BenchmarkPlatform>();
+  using Implementer = void (*)(gd::PlatformExtension &);
+  const Implementer implementers[] = {
+      &gd::BuiltinExtensionsImplementer::ImplementsAdvancedExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsAudioExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsBaseObjectExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsCameraExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsCommonInstructionsExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsExternalLayoutsExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsFileExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsKeyboardExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsMouseExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsNetworkExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsSceneExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsSpriteExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsTimeExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsVariablesExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsWindowExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsAsyncExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsResizableExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsScalableExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsFlippableExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsAnimatableExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsEffectExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsOpacityExtension,
+      &gd::BuiltinExtensionsImplementer::ImplementsTextContainerExtension,
+  };
+
+  for (Implementer implementer : implementers) {
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    implementer(*extension);
+    platform->AddExtension(extension);
+  }
+  gd::PlatformManager::Get()->AddPlatform(platform);
+  return *platform;
+}
+
+void GenerateBenchmarkProject(gd::Project &project, std::size_t scale) {
+  BenchmarkProjectSize size;
+  size.scenesCount *= scale;
+  size.objectsCount *= scale;
+  size.instancesCount *= scale;
+  size.eventsCount *= scale;
+  size.resourcesCount *= scale;
+
+  project.SetName("Benchmark project");
+  project.SetProjectFile("/project/game.json");
+  for (std::size_t i = 0; i < size.resourcesCount; i++) {
+    project.GetResourcesManager().AddResource(
+        "Image" + gd::String::From(i),
+        "images/image" + gd::String::From(i) + ".png",
+        "image");
+  }
+
+  for (std::size_t i = 0; i < size.scenesCount; i++) {
+    gd::Layout &layout =
+        project.InsertNewLayout("Scene" + gd::String::From(i), i);
+    for (std::size_t j = 0; j < 10; j++) {
+      layout.GetVariables()
+          .InsertNew("Counter" + gd::String::From(j), j)
+          .SetValue(j);
+    }
+
+    auto &objects = layout.GetObjects();
+    for (std::size_t j = 0; j < size.objectsCount; j++) {
+      gd::Object &object = objects.InsertNewObject(
+          project, "Sprite", "Object" + gd::String::From(j), j);
+      object.GetVariables().InsertNew("Health", 0).SetValue(100);
+    }
+    for (std::size_t j = 0; j < size.groupsCount; j++) {
+      gd::ObjectGroup &group = objects.GetObjectGroups().InsertNew(
+          "Group" + gd::String::From(j), j);
+      for (std::size_t k = j; k < size.objectsCount; k += size.groupsCount)
+        group.AddObject("Object" + gd::String::From(k));
+    }
+
+    for (std::size_t j = 0; j < size.instancesCount; j++) {
+      gd::InitialInstance &instance =
+          layout.GetInitialInstances().InsertNewInitialInstance();
+      instance.SetObjectName("Object" +
+                             gd::String::From(j % size.objectsCount));
+      instance.SetX(j % 100 * 32);
+      instance.SetY(j / 100 * 32);
+      instance.SetZOrder(j);
+    }
+
+    for (std::size_t j = 0; j < size.eventsCount; j++)
+      InsertBenchmarkEvents(layout.GetEvents(), size, i, j, size.eventsDepth);
+  }
+}
+
+bool LoadBenchmarkProject(gd::Project &project, const gd::String &path) {
+  std::ifstream file(path.ToLocale().c_str(), std::ios::binary);
+  if (!file) return false;
+
+  std::stringstream content;
+  content << file.rdbuf();
+  gd::SerializerElement element =
+      gd::Serializer::FromJSON(gd::String::FromUTF8(content.str()));
+  project.UnserializeFrom(element);
+  project.SetProjectFile(path);
+  return true;
+}
+
+bool SaveBenchmarkProject(const gd::Project &project, const gd::String &path) {
+  std::ofstream file(path.ToLocale().c_str(), std::ios::binary);
+  if (!file) return false;
+
+  gd::SerializerElement element;
+  project.SerializeTo(element);
+  file << gd::Serializer::ToJSON(element).Raw();
+  return static_cast<bool>(file);
+}
@@ -0,0 +1,67 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class Platform;
+class Project;
+}  // namespace gd
+
+/**
+ * \brief The size of the project generated for the benchmarks, for a scale
+ * of 1.
+ */
+struct BenchmarkProjectSize {
+  std::size_t scenesCount = 4;
+  std::size_t objectsCount = 50;  ///< Per scene.
+  std::size_t groupsCount = 5;    ///< Per scene.
+  std::size_t instancesCount = 2000;  ///< Per scene.
+  std::size_t eventsCount = 50;       ///< Per scene, at the root.
+  std::size_t eventsDepth = 4;
+  std::size_t resourcesCount = 100;
+};
+
+/**
+ * \brief Return the platform used by the benchmarks, with the extensions
+ * declared by GDCore (objects, behaviors and instructions of the builtin
+ * extensions).
+ *
+ * The platform is named like the one of the editor and registered in
+ * gd::PlatformManager, so that projects saved by the editor use it when
+ * loaded. The objects and instructions of the other extensions are unknown
+ * to the platform: they are still loaded, refactored and saved, but are not
+ * validated and generate no code.
+ */
+gd::Platform &GetBenchmarkPlatform();
+
+/**
+ * \brief Fill the project with scenes, objects, groups, instances, events and
+ * resources, looking like the ones of a large game.
+ *
+ * \param scale The factor applied to the number of scenes, objects,
+ * instances, events and resources (see BenchmarkProjectSize).
+ */
+void GenerateBenchmarkProject(gd::Project &project, std::size_t scale);
+
+/**
+ * \brief Load a project from a JSON file (a game saved by the editor, or
+ * generated and saved by the benchmarks).
+ *
+ * \return false if the file can't be read.
+ */
+bool LoadBenchmarkProject(gd::Project &project, const gd::String &path);
+
+/**
+ * \brief Save a project to a JSON file, to be loaded again with
+ * LoadBenchmarkProject.
+ *
+ * \return false if the file can't be written.
+ */
+bool SaveBenchmarkProject(const gd::Project &project, const gd::String &path);
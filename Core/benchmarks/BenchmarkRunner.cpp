@@ -0,0 +1,136 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+#include "BenchmarkTools.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/PerfScope.h"
+
+namespace {
+long long GetPercentile(const std::vector<long long> &sortedTimes,
+                        std::size_t percent) {
+  if (sortedTimes.empty()) return 0;
+  return sortedTimes[(sortedTimes.size() - 1) * percent / 100];
+}
+}  // namespace
+
+void BenchmarkRunner::AddScenario(const gd::String &name,
+                                  std::function<void()> run) {
+  scenarios.push_back({name, std::move(run)});
+}
+
+bool BenchmarkRunner::MatchesFilters(const gd::String &name) const {
+  if (filters.empty()) return true;
+
+  return std::any_of(
+      filters.begin(), filters.end(), [&name](const gd::String &filter) {
+        return name.find(filter) != gd::String::npos;
+      });
+}
+
+std::vector<gd::String> BenchmarkRunner::GetScenarioNames() const {
+  std::vector<gd::String> names;
+  for (const auto &scenario : scenarios) {
+    if (MatchesFilters(scenario.name)) names.push_back(scenario.name);
+  }
+  return names;
+}
+
+void BenchmarkRunner::Run() {
+  results.clear();
+  for (const auto &scenario : scenarios) {
+    if (!MatchesFilters(scenario.name)) continue;
+
+    scenario.run();  // Warm up.
+
+    Result result;
+    result.name = scenario.name;
+    gd::PerfScope::Reset();
+    gd::PerfScope::Enable(true);
+    std::size_t allocationsCountBefore = GetBenchmarkAllocationsCount();
+    for (std::size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      scenario.run();
+      auto end = std::chrono::steady_clock::now();
+
+      result.timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+    gd::PerfScope::Enable(false);
+    result.allocationsPerRun =
+        runsCount ? (GetBenchmarkAllocationsCount() - allocationsCountBefore) /
+                        runsCount
+                  : 0;
+    result.perfScopesJSON = gd::PerfScope::ToJSON();
+    gd::PerfScope::Reset();
+
+    auto &times = result.timesInMicroseconds;
+    std::sort(times.begin(), times.end());
+    std::cout << scenario.name << " (" << runsCount
+              << " runs): p50=" << GetPercentile(times, 50)
+              << "us, p95=" << GetPercentile(times, 95)
+              << "us, max=" << GetPercentile(times, 100)
+              << "us, allocations per run=" << result.allocationsPerRun
+              << std::endl;
+
+    results.push_back(std::move(result));
+  }
+}
+
+void BenchmarkRunner::SerializeResultTo(const Result &result,
+                                        gd::SerializerElement &element) {
+  const auto &times = result.timesInMicroseconds;
+  element.SetAttribute("name", result.name)
+      .SetAttribute("runsCount", static_cast<int>(times.size()))
+      .SetAttribute("p50", static_cast<double>(GetPercentile(times, 50)))
+      .SetAttribute("p95", static_cast<double>(GetPercentile(times, 95)))
+      .SetAttribute("min", static_cast<double>(GetPercentile(times, 0)))
+      .SetAttribute("max", static_cast<double>(GetPercentile(times, 100)))
+      .SetAttribute("allocationsPerRun",
+                    static_cast<double>(result.allocationsPerRun));
+}
+
+void BenchmarkRunner::SerializeResultsTo(
+    gd::SerializerElement &element) const {
+  element.ConsiderAsArrayOf("scenario");
+  for (const auto &result : results) {
+    auto &scenarioElement = element.AddChild("scenario");
+    SerializeResultTo(result, scenarioElement);
+    scenarioElement.AddChild("perfScopes") =
+        gd::Serializer::FromJSON(result.perfScopesJSON);
+  }
+}
+
+bool BenchmarkRunner::CheckThresholds(
+    const gd::SerializerElement &thresholds) const {
+  bool success = true;
+  for (const auto &result : results) {
+    if (!thresholds.HasChild(result.name)) continue;
+
+    const auto &scenarioThresholds = thresholds.GetChild(result.name);
+    gd::SerializerElement resultElement;
+    SerializeResultTo(result, resultElement);
+    for (const auto &value : {"p50", "p95", "max", "allocationsPerRun"}) {
+      if (!scenarioThresholds.HasChild(value)) continue;
+
+      double threshold = scenarioThresholds.GetDoubleAttribute(value);
+      double actual = resultElement.GetDoubleAttribute(value);
+      if (actual > threshold) {
+        std::cout << result.name << ": " << value << "=" << actual
+                  << " exceeds the threshold (" << threshold << ")."
+                  << std::endl;
+        success = false;
+      }
+    }
+  }
+  return success;
+}
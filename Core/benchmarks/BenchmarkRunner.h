@@ -0,0 +1,98 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class SerializerElement;
+}  // namespace gd
+
+/**
+ * \brief Run the benchmark scenarios and collect their timings.
+ *
+ * Each scenario is run once to warm up, then the given number of times. The
+ * time of each run, the allocations made and the timings of the gd::PerfScope
+ * entered during the runs are recorded.
+ */
+class BenchmarkRunner {
+ public:
+  /**
+   * \brief The results of a scenario.
+   */
+  struct Result {
+    gd::String name;
+    std::vector<long long> timesInMicroseconds;  ///< Sorted.
+    std::size_t allocationsPerRun = 0;
+    gd::String perfScopesJSON;  ///< See gd::PerfScope::ToJSON.
+  };
+
+  BenchmarkRunner() : runsCount(5){};
+
+  /**
+   * \brief Add a scenario. The function is called for each run and must
+   * leave the project as it was, so that runs are identical.
+   */
+  void AddScenario(const gd::String &name, std::function<void()> run);
+
+  /**
+   * \brief Only run the scenarios having a name containing one of the
+   * filters (all of them if there is no filter).
+   */
+  void SetFilters(const std::vector<gd::String> &filters_) {
+    filters = filters_;
+  }
+
+  void SetRunsCount(std::size_t runsCount_) { runsCount = runsCount_; }
+
+  /**
+   * \brief Return the names of the scenarios matching the filters.
+   */
+  std::vector<gd::String> GetScenarioNames() const;
+
+  /**
+   * \brief Run the scenarios matching the filters, printing their timings.
+   */
+  void Run();
+
+  const std::vector<Result> &GetResults() const { return results; }
+
+  /**
+   * \brief Serialize the results (timings in microseconds).
+   */
+  void SerializeResultsTo(gd::SerializerElement &element) const;
+
+  /**
+   * \brief Check the results against thresholds, printing the ones exceeded.
+   *
+   * The thresholds give, for each scenario name, the maximum allowed values
+   * of some of the serialized results. For example:
+   * `{"parser/parse/long-concatenation": {"p95": 80, "allocationsPerRun":
+   * 300}}`.
+   *
+   * \return false if a threshold is exceeded.
+   */
+  bool CheckThresholds(const gd::SerializerElement &thresholds) const;
+
+ private:
+  struct Scenario {
+    gd::String name;
+    std::function<void()> run;
+  };
+
+  bool MatchesFilters(const gd::String &name) const;
+  static void SerializeResultTo(const Result &result,
+                                gd::SerializerElement &element);
+
+  std::vector<Scenario> scenarios;
+  std::vector<gd::String> filters;
+  std::size_t runsCount;
+  std::vector<Result> results;
+};
@@ -0,0 +1,56 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkTools.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#if defined(LINUX) || defined(MACOS)
+#include <sys/resource.h>
+#endif
+
+// Count the allocations made by the whole program, so that benchmarks can
+// report how many allocations an operation is doing.
+namespace {
+std::atomic<std::size_t> allocationsCount(0);
+std::atomic<std::size_t> allocatedBytes(0);
+}  // namespace
+
+void *operator new(std::size_t size) {
+  allocationsCount++;
+  allocatedBytes += size;
+  if (void *pointer = std::malloc(size ? size : 1)) return pointer;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+std::size_t GetBenchmarkAllocationsCount() { return allocationsCount; }
+
+std::size_t GetBenchmarkAllocatedBytes() { return allocatedBytes; }
+
+long GetPeakMemoryInKilobytes() {
+#if defined(LINUX)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) return usage.ru_maxrss;
+#elif defined(MACOS)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) return usage.ru_maxrss / 1024;
+#endif
+  return -1;
+}
+
+std::size_t GetBenchmarkScale() {
+  if (const char *scaleString = std::getenv("GD_BENCHMARK_SCALE")) {
+    int value = std::atoi(scaleString);
+    if (value > 0) return value;
+  }
+  return 1;
+}
@@ -0,0 +1,35 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Return the number of allocations made by the whole program since it was
+ * started.
+ *
+ * \note Allocations made inside a dynamic library are not counted on
+ * platforms where the global operator new can't be replaced for it (Windows).
+ */
+std::size_t GetBenchmarkAllocationsCount();
+
+/**
+ * Return the number of bytes allocated by the whole program since it was
+ * started (freed memory is not subtracted).
+ */
+std::size_t GetBenchmarkAllocatedBytes();
+
+/**
+ * Return the peak memory used by the process, or -1 if unknown on this
+ * platform.
+ */
+long GetPeakMemoryInKilobytes();
+
+/**
+ * Return the factor applied to the size of the benchmarks, read from the
+ * GD_BENCHMARK_SCALE environment variable (1 by default).
+ */
+std::size_t GetBenchmarkScale();
@@ -0,0 +1,128 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "ExpressionParserBenchmarks.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchmarkRunner.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/Project/Variable.h"
+
+namespace {
+
+struct BenchmarkExpression {
+  gd::String name;
+  gd::String type;
+  std::vector<gd::String> expressions;
+};
+
+gd::String Repeat(const gd::String &text, std::size_t count) {
+  gd::String result;
+  for (std::size_t i = 0; i < count; i++) result += text;
+  return result;
+}
+
+std::vector<BenchmarkExpression> GetBenchmarkCorpus() {
+  std::vector<BenchmarkExpression> corpus;
+
+  corpus.push_back(
+      {"long-concatenation",
+       "number",
+       {Repeat("MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+", 40) +
+        "0"}});
+  corpus.push_back(
+      {"long-string-concatenation",
+       "string",
+       {Repeat("\"Score: \" + ToString(MyVariable) + NewLine() + ", 30) +
+        "\"\""}});
+
+  gd::String nestedCalls = "1";
+  for (std::size_t i = 0; i < 32; i++)
+    nestedCalls = "clamp(" + nestedCalls + ", 0, 2)";
+  corpus.push_back({"deeply-nested-calls", "number", {nestedCalls}});
+  corpus.push_back({"deeply-nested-sub-expressions",
+                    "number",
+                    {Repeat("(1 + ", 100) + "2" + Repeat(")", 100)}});
+
+  corpus.push_back(
+      {"variables-with-accessors",
+       "number",
+       {Repeat("MyVariable.Child[\"Key\" + ToString(2)].Other[3] "
+               "* MySpriteObject.MyVariable[MyVariable.Index] + ",
+               10) +
+        "0"}});
+  corpus.push_back(
+      {"heavy-unicode",
+       "string",
+       {Repeat("\"Ελληνικά 日本語 😀 \\\"ünïcödé\\\" \" + ", 30) + "\"🎮\""}});
+  corpus.push_back(
+      {"long-identifier",
+       "number",
+       {"MyLoooooongIdentifierThatNeverStoooooopsAndContinueAgainAndAgainAndA"
+        "gainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"
+        "AndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"}});
+
+  // The same strings as the "Naughty strings" test, parsed as a whole.
+  BenchmarkExpression naughtyStrings = {"naughty-strings", "string", {}};
+  std::string file = __FILE__;
+  std::ifstream naughtyStringsFile(
+      file.substr(0, file.find_last_of("/\\") + 1) +
+      "../tests/ExpressionParser2NaugtyStrings.cpp-blns.txt");
+  std::string line;
+  while (std::getline(naughtyStringsFile, line))
+    naughtyStrings.expressions.push_back(line.c_str());
+  if (!naughtyStrings.expressions.empty()) corpus.push_back(naughtyStrings);
+
+  return corpus;
+}
+
+}  // namespace
+
+void AddExpressionParserScenarios(BenchmarkRunner &runner,
+                                  gd::Project &project,
+                                  const gd::Platform &platform) {
+  gd::Layout &layout = project.InsertNewLayout(
+      "ExpressionParserBenchmark", project.GetLayoutsCount());
+  layout.GetVariables().InsertNew("MyVariable", 0);
+  layout.GetObjects()
+      .InsertNewObject(project, "Sprite", "MySpriteObject", 0)
+      .GetVariables()
+      .InsertNew("MyVariable", 0);
+
+  // Shared by the scenarios, which are kept by the runner.
+  auto projectScopedContainers = std::make_shared<gd::ProjectScopedContainers>(
+      gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForProjectAndLayout(project, layout));
+  auto parser = std::make_shared<gd::ExpressionParser2>();
+
+  for (const auto &benchmarkExpression : GetBenchmarkCorpus()) {
+    runner.AddScenario(
+        "parser/parse/" + benchmarkExpression.name,
+        [parser, benchmarkExpression]() {
+          for (const auto &expression : benchmarkExpression.expressions)
+            parser->ParseExpression(expression);
+        });
+    runner.AddScenario(
+        "parser/parse-and-validate/" + benchmarkExpression.name,
+        [parser, projectScopedContainers, &platform, benchmarkExpression]() {
+          for (const auto &expression : benchmarkExpression.expressions) {
+            auto node = parser->ParseExpression(expression);
+            gd::ExpressionValidator validator(
+                platform, *projectScopedContainers, benchmarkExpression.type);
+            node->Visit(validator);
+          }
+        });
+  }
+}
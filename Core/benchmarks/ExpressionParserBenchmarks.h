@@ -0,0 +1,23 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+class BenchmarkRunner;
+namespace gd {
+class Platform;
+class Project;
+}  // namespace gd
+
+/**
+ * \brief Add the scenarios parsing (and validating) a corpus of expressions
+ * looking like the ones of real games, with the worst cases of the parser.
+ *
+ * A scene, with the objects and variables used by the expressions, is added
+ * to \a project, which must outlive the runner.
+ */
+void AddExpressionParserScenarios(BenchmarkRunner &runner,
+                                  gd::Project &project,
+                                  const gd::Platform &platform);
@@ -0,0 +1,92 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/String.h"
+
+/**
+ * \brief A file system keeping files in memory, so that exports are
+ * benchmarked without the cost (and the noise) of the disk.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  void MkDir(const gd::String &path) override {}
+  bool DirExists(const gd::String &path) override { return true; }
+  bool FileExists(const gd::String &path) override {
+    return files.find(path) != files.end();
+  }
+  bool ClearDir(const gd::String &directory) override {
+    auto it = files.lower_bound(directory + "/");
+    while (it != files.end() && it->first.find(directory + "/") == 0)
+      it = files.erase(it);
+    return true;
+  }
+  gd::String GetTempDir() override { return "/tmp"; }
+  gd::String FileNameFrom(const gd::String &file) override {
+    return file.substr(file.rfind("/") + 1);
+  }
+  gd::String DirNameFrom(const gd::String &file) override {
+    return file.substr(0, file.rfind("/"));
+  }
+  bool MakeAbsolute(gd::String &filename,
+                    const gd::String &baseDirectory) override {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  }
+  bool IsAbsolute(const gd::String &filename) override {
+    return !filename.empty() && filename[0] == '/';
+  }
+  bool MakeRelative(gd::String &filename,
+                    const gd::String &baseDirectory) override {
+    if (filename.find(baseDirectory + "/") != 0) return false;
+    filename = filename.substr(baseDirectory.size() + 1);
+    return true;
+  }
+  bool CopyFile(const gd::String &file,
+                const gd::String &destination) override {
+    auto it = files.find(file);
+    if (it == files.end()) return false;
+    files[destination] = it->second;
+    return true;
+  }
+  bool WriteToFile(const gd::String &file,
+                   const gd::String &content) override {
+    files[file] = content;
+    return true;
+  }
+  gd::String ReadFile(const gd::String &file) override {
+    auto it = files.find(file);
+    return it != files.end() ? it->second : "";
+  }
+  std::vector<gd::String> ReadDir(const gd::String &path,
+                                  const gd::String &extension) override {
+    std::vector<gd::String> result;
+    for (auto it = files.lower_bound(path + "/");
+         it != files.end() && it->first.find(path + "/") == 0;
+         ++it) {
+      const std::string &name = it->first.Raw();
+      const std::string &suffix = extension.Raw();
+      if (name.size() >= suffix.size() &&
+          name.compare(name.size() - suffix.size(), suffix.size(), suffix) ==
+              0)
+        result.push_back(it->first);
+    }
+    return result;
+  }
+  gd::String GetFileFingerprint(const gd::String &file) override {
+    return ReadFile(file);
+  }
+  bool RemoveFile(const gd::String &file) override {
+    return files.erase(file) > 0;
+  }
+
+  std::map<gd::String, gd::String> files;
+};
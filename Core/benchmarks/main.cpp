@@ -0,0 +1,321 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the operations made by the editor on large projects:
+ * load, save, refactoring, validation, code generation and export, and of
+ * the expression parser.
+ *
+ * The project is generated (its size is given by --scale) or loaded from a
+ * JSON file (--project), for example a real game with anonymized content.
+ * Run with --help for the options.
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "BenchmarkProject.h"
+#include "BenchmarkRunner.h"
+#include "BenchmarkTools.h"
+#include "ExpressionParserBenchmarks.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/ObjectAssetSerializer.h"
+#include "GDCore/IDE/Events/ProjectExpressionsValidator.h"
+#include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+#include "GDCore/IDE/ProjectStripper.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "InMemoryFileSystem.h"
+
+namespace {
+
+struct Options {
+  gd::String projectPath;
+  gd::String saveProjectPath;
+  gd::String jsonPath;
+  gd::String thresholdsPath;
+  std::vector<gd::String> filters;
+  std::size_t scale = GetBenchmarkScale();
+  std::size_t runsCount = 5;
+  bool listOnly = false;
+  bool help = false;
+};
+
+void PrintUsage() {
+  std::cout
+      << "Usage: GDCore_benchmarks [options]\n"
+         "  --project <file>       Load the project from a JSON file instead "
+         "of generating it.\n"
+         "  --scale <n>            Scale of the generated project (default: "
+         "GD_BENCHMARK_SCALE, or 1).\n"
+         "  --save-project <file>  Save the generated project, to load it "
+         "again with --project.\n"
+         "  --filter <text>        Only run the scenarios with a name "
+         "containing the text (can be repeated).\n"
+         "  --runs <n>             Number of runs of each scenario (default: "
+         "5).\n"
+         "  --json <file>          Write the results as JSON to the file.\n"
+         "  --thresholds <file>    Fail if results exceed the thresholds of "
+         "the JSON file.\n"
+         "  --list                 List the scenarios and exit.\n";
+}
+
+bool ParseOptions(int argc, char *argv[], Options &options) {
+  for (int i = 1; i < argc; i++) {
+    gd::String argument = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (argument == "--help") {
+      options.help = true;
+    } else if (argument == "--list") {
+      options.listOnly = true;
+    } else if (argument == "--project" && hasValue) {
+      options.projectPath = argv[++i];
+    } else if (argument == "--save-project" && hasValue) {
+      options.saveProjectPath = argv[++i];
+    } else if (argument == "--json" && hasValue) {
+      options.jsonPath = argv[++i];
+    } else if (argument == "--thresholds" && hasValue) {
+      options.thresholdsPath = argv[++i];
+    } else if (argument == "--filter" && hasValue) {
+      options.filters.push_back(argv[++i]);
+    } else if (argument == "--scale" && hasValue) {
+      int scale = std::atoi(argv[++i]);
+      if (scale <= 0) return false;
+      options.scale = scale;
+    } else if (argument == "--runs" && hasValue) {
+      int runsCount = std::atoi(argv[++i]);
+      if (runsCount <= 0) return false;
+      options.runsCount = runsCount;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+void AddScenarios(BenchmarkRunner &runner,
+                  gd::Project &project,
+                  gd::Platform &platform,
+                  const gd::String &projectJSON,
+                  InMemoryFileSystem &fs) {
+  runner.AddScenario("load/parse-json", [&]() {
+    gd::SerializerElement element = gd::Serializer::FromJSON(projectJSON);
+  });
+  gd::SerializerElement projectElement = gd::Serializer::FromJSON(projectJSON);
+  runner.AddScenario("load/unserialize", [&, projectElement]() {
+    gd::Project loadedProject;
+    loadedProject.UnserializeFrom(projectElement);
+  });
+
+  runner.AddScenario("save/serialize", [&]() {
+    gd::SerializerElement element;
+    project.SerializeTo(element);
+  });
+  runner.AddScenario("save/stringify-json", [&, projectElement]() {
+    gd::String json = gd::Serializer::ToJSON(projectElement);
+  });
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); i++) {
+    const gd::Layout &layout = project.GetLayout(i);
+    if (layout.GetObjects().GetObjectsCount() == 0) continue;
+
+    runner.AddScenario("save/object-asset", [&project, &layout]() {
+      gd::SerializerElement assetElement;
+      std::vector<gd::String> usedResourceNames;
+      const gd::Object &object = layout.GetObjects().GetObject(0);
+      gd::ObjectAssetSerializer::SerializeTo(
+          project, object, object.GetName(), assetElement, usedResourceNames);
+    });
+    break;
+  }
+
+  // Refactorings are made, then reverted, so that all the runs are the same.
+  gd::Layout *layoutWithObjects = nullptr;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); i++) {
+    if (project.GetLayout(i).GetObjects().GetObjectsCount() > 0) {
+      layoutWithObjects = &project.GetLayout(i);
+      break;
+    }
+  }
+  if (layoutWithObjects) {
+    runner.AddScenario("refactor/rename-object", [&, layoutWithObjects]() {
+      gd::Object &object = layoutWithObjects->GetObjects().GetObject(0);
+      const gd::String oldName = object.GetName();
+      const gd::String newName = oldName + "Renamed";
+      object.SetName(newName);
+      gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+          project, *layoutWithObjects, oldName, newName, false);
+      object.SetName(oldName);
+      gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+          project, *layoutWithObjects, newName, oldName, false);
+    });
+  }
+  if (project.GetLayoutsCount() > 0) {
+    runner.AddScenario("refactor/rename-scene", [&]() {
+      gd::Layout &layout = project.GetLayout(0);
+      const gd::String oldName = layout.GetName();
+      const gd::String newName = oldName + "Renamed";
+      layout.SetName(newName);
+      gd::WholeProjectRefactorer::RenameLayout(project, oldName, newName);
+      layout.SetName(oldName);
+      gd::WholeProjectRefactorer::RenameLayout(project, newName, oldName);
+    });
+  }
+
+  runner.AddScenario("validation/expressions", [&]() {
+    gd::ProjectExpressionsValidator::ValidateProject(project);
+  });
+  runner.AddScenario("validation/expressions-in-parallel", [&]() {
+    gd::ProjectExpressionsValidator::ValidateProjectInParallel(project);
+  });
+
+  // GDCore generates code without the code generation information of a
+  // platform (given by GDJS): this measures the events preprocessing and
+  // the generation common to all platforms.
+  runner.AddScenario("codegen/scenes", [&]() {
+    for (std::size_t i = 0; i < project.GetLayoutsCount(); i++) {
+      const gd::Layout &layout = project.GetLayout(i);
+      gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+      unsigned int maxDepthLevelReached = 0;
+      gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
+
+      gd::EventsList events = layout.GetEvents();
+      codeGenerator.PreprocessEventList(events);
+      gd::EventsCodeGenerator::DeleteUselessEvents(events);
+      codeGenerator.GenerateEventsListCode(events, context);
+    }
+  });
+
+  // The resources are files in memory, so that only the export is measured.
+  gd::String projectDirectory = fs.DirNameFrom(project.GetProjectFile());
+  auto &resourcesManager = project.GetResourcesManager();
+  for (const gd::String &name : resourcesManager.GetAllResourceNames()) {
+    gd::String file = resourcesManager.GetResource(name).GetFile();
+    if (file.empty()) continue;
+    fs.MakeAbsolute(file, projectDirectory);
+    fs.files[file] = name;
+  }
+  runner.AddScenario("export/copy-resources", [&]() {
+    fs.ClearDir("/export");
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, true, false);
+  });
+  runner.AddScenario("export/copy-changed-resources", [&]() {
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, true, true);
+  });
+  runner.AddScenario("export/project-data", [&]() {
+    gd::Project exportedProject = project;
+    gd::ProjectStripper::StripProjectForExport(exportedProject);
+    gd::SerializerElement element;
+    exportedProject.SerializeTo(element);
+    fs.WriteToFile(
+        "/export/data.js",
+        "gdjs.projectData = " + gd::Serializer::ToJSON(element) + ";");
+  });
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  Options options;
+  if (!ParseOptions(argc, argv, options) || options.help) {
+    PrintUsage();
+    return options.help ? 0 : 1;
+  }
+
+  gd::Platform &platform = GetBenchmarkPlatform();
+  gd::Project project;
+  project.AddPlatform(platform);
+  if (!options.projectPath.empty()) {
+    if (!LoadBenchmarkProject(project, options.projectPath)) {
+      std::cerr << "Unable to read the project " << options.projectPath
+                << std::endl;
+      return 1;
+    }
+  } else {
+    GenerateBenchmarkProject(project, options.scale);
+  }
+  if (!options.saveProjectPath.empty() &&
+      !SaveBenchmarkProject(project, options.saveProjectPath)) {
+    std::cerr << "Unable to save the project to " << options.saveProjectPath
+              << std::endl;
+    return 1;
+  }
+
+  gd::SerializerElement projectElement;
+  project.SerializeTo(projectElement);
+  const gd::String projectJSON = gd::Serializer::ToJSON(projectElement);
+
+  InMemoryFileSystem fs;
+  BenchmarkRunner runner;
+  runner.SetFilters(options.filters);
+  runner.SetRunsCount(options.runsCount);
+  AddScenarios(runner, project, platform, projectJSON, fs);
+
+  gd::Project expressionsProject;
+  expressionsProject.AddPlatform(platform);
+  AddExpressionParserScenarios(runner, expressionsProject, platform);
+
+  if (options.listOnly) {
+    for (const gd::String &name : runner.GetScenarioNames())
+      std::cout << name << std::endl;
+    return 0;
+  }
+
+  std::cout << "Project \"" << project.GetName() << "\": "
+            << project.GetLayoutsCount() << " scenes, " << projectJSON.size()
+            << " characters of JSON." << std::endl;
+  runner.Run();
+  std::cout << "Process peak memory: " << GetPeakMemoryInKilobytes() << "KiB"
+            << std::endl;
+
+  if (!options.jsonPath.empty()) {
+    gd::SerializerElement resultsElement;
+    resultsElement.SetAttribute("projectName", project.GetName())
+        .SetAttribute("scenesCount",
+                      static_cast<int>(project.GetLayoutsCount()))
+        .SetAttribute("projectJSONSize",
+                      static_cast<double>(projectJSON.size()))
+        .SetAttribute("peakMemoryInKilobytes",
+                      static_cast<double>(GetPeakMemoryInKilobytes()));
+    runner.SerializeResultsTo(resultsElement.AddChild("scenarios"));
+    gd::String json = gd::Serializer::ToJSON(resultsElement);
+
+    std::ofstream file(options.jsonPath.ToLocale().c_str(), std::ios::binary);
+    file << json.Raw();
+    if (!file) {
+      std::cerr << "Unable to write the results to " << options.jsonPath
+                << std::endl;
+      return 1;
+    }
+  }
+
+  if (!options.thresholdsPath.empty()) {
+    std::ifstream file(options.thresholdsPath.ToLocale().c_str(),
+                       std::ios::binary);
+    if (!file) {
+      std::cerr << "Unable to read the thresholds " << options.thresholdsPath
+                << std::endl;
+      return 1;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    gd::SerializerElement thresholds =
+        gd::Serializer::FromJSON(gd::String::FromUTF8(content.str()));
+    if (!runner.CheckThresholds(thresholds)) return 2;
+  }
+
+  return 0;
+}
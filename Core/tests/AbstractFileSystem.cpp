@@ -4,8 +4,55 @@
  * reserved. This project is released under the MIT License.
  */
 #include "GDCore/IDE/AbstractFileSystem.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "catch.hpp"
 
+namespace {
+
+class CopyRecordingFileSystem : public gd::AbstractFileSystem {
+ public:
+  void MkDir(const gd::String& path) override {}
+  bool DirExists(const gd::String& path) override { return true; }
+  bool FileExists(const gd::String& path) override { return true; }
+  bool ClearDir(const gd::String& directory) override { return true; }
+  gd::String GetTempDir() override { return "/tmp/"; }
+  gd::String FileNameFrom(const gd::String& file) override { return file; }
+  gd::String DirNameFrom(const gd::String& file) override { return ""; }
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    return true;
+  }
+  bool IsAbsolute(const gd::String& filename) override { return true; }
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    return true;
+  }
+  bool CopyFile(const gd::String& file,
+                const gd::String& destination) override {
+    copiedFiles.push_back(file);
+    return file != "missing.png";
+  }
+  bool WriteToFile(const gd::String& file,
+                   const gd::String& content) override {
+    writtenFiles[file] = content;
+    return true;
+  }
+  gd::String ReadFile(const gd::String& file) override { return ""; }
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension) override {
+    return {};
+  }
+
+  std::vector<gd::String> copiedFiles;
+  std::map<gd::String, gd::String> writtenFiles;
+};
+
+}  // namespace
+
 TEST_CASE("AbstractFileSystem", "[common]") {
   SECTION("Basics") {
     REQUIRE(gd::AbstractFileSystem::NormalizeSeparator(u8"C:\\Test\\Test2\\") ==
@@ -15,4 +62,32 @@ TEST_CASE("AbstractFileSystem", "[common]") {
     REQUIRE(gd::AbstractFileSystem::NormalizeSeparator(u8"/TestԘ/Test2") ==
             u8"/TestԘ/Test2");
   }
+  SECTION("Copy several files at once") {
+    CopyRecordingFileSystem fs;
+    std::vector<std::pair<gd::String, gd::String>> filesAndDestinations = {
+        {"image.png", "/export/image.png"},
+        {"missing.png", "/export/missing.png"},
+        {"audio.mp3", "/export/audio.mp3"}};
+
+    // By default, files are copied one after the other.
+    REQUIRE((fs.CopyFiles(filesAndDestinations) ==
+             std::vector<bool>{true, false, true}));
+    REQUIRE((fs.copiedFiles ==
+             std::vector<gd::String>{"image.png", "missing.png", "audio.mp3"}));
+  }
+  SECTION("Write a file piece by piece") {
+    CopyRecordingFileSystem fs;
+    REQUIRE_FALSE(fs.Append("data.js", "Not opened"));
+
+    // By default, the file is written at once when closed.
+    REQUIRE(fs.OpenForWrite("data.js"));
+    REQUIRE(fs.Append("data.js", "gdjs.projectData = "));
+    REQUIRE(fs.Append("data.js", "{};"));
+    REQUIRE(fs.writtenFiles.empty());
+    REQUIRE(fs.Close("data.js"));
+    REQUIRE(fs.writtenFiles["data.js"] == "gdjs.projectData = {};");
+
+    REQUIRE_FALSE(fs.Close("data.js"));
+    REQUIRE(fs.writtenFiles.size() == 1);
+  }
 }
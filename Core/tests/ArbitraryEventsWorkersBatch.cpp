@@ -0,0 +1,94 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersBatch.h"
+
+#include <vector>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/IDE/Events/InstructionsTypeRenamer.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+class InstructionsTypesLister : public gd::ArbitraryEventsWorker {
+ public:
+  std::vector<gd::String> types;
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    types.push_back(instruction.GetType());
+    return false;
+  }
+};
+
+class InstructionsRemover : public gd::ArbitraryEventsWorkerWithContext {
+ public:
+  InstructionsRemover(const gd::String &type_) : type(type_){};
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    return instruction.GetType() == type;
+  }
+
+  gd::String type;
+};
+
+gd::Instruction MakeInstruction(const gd::String &type) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  return instruction;
+}
+
+}  // namespace
+
+TEST_CASE("ArbitraryEventsWorkersBatch", "[events]") {
+  gd::Project project;
+  gd::EventsList events;
+  gd::StandardEvent event;
+  event.GetConditions().Insert(MakeInstruction("MyExtension::OldCondition"));
+  event.GetActions().Insert(MakeInstruction("MyExtension::OldAction"));
+  event.GetActions().Insert(MakeInstruction("MyExtension::RemovedAction"));
+  event.GetActions().Insert(MakeInstruction("MyExtension::OtherAction"));
+  events.InsertEvent(event);
+
+  gd::InstructionsTypeRenamer conditionRenamer(
+      project, "MyExtension::OldCondition", "MyExtension::NewCondition");
+  gd::InstructionsTypeRenamer actionRenamer(project, "MyExtension::OldAction",
+                                            "MyExtension::NewAction");
+  InstructionsRemover remover("MyExtension::RemovedAction");
+  InstructionsTypesLister lister;
+
+  gd::ArbitraryEventsWorkersBatch batch;
+  batch.AddWorker(conditionRenamer)
+      .AddWorker(actionRenamer)
+      .AddWorker(remover)
+      .AddWorker(lister);
+  REQUIRE(batch.GetWorkersCount() == 4);
+
+  gd::ProjectScopedContainers projectScopedContainers =
+      gd::ProjectScopedContainers::MakeNewProjectScopedContainersForProject(
+          project);
+  batch.Launch(events, projectScopedContainers);
+
+  // The workers see the changes done by the previous ones, and removed
+  // instructions are not given to the next workers.
+  REQUIRE((lister.types == std::vector<gd::String>{
+                               "MyExtension::NewCondition",
+                               "MyExtension::NewAction",
+                               "MyExtension::OtherAction"}));
+
+  auto &resultEvent = dynamic_cast<gd::StandardEvent &>(events.GetEvent(0));
+  REQUIRE(resultEvent.GetConditions()[0].GetType() ==
+          "MyExtension::NewCondition");
+  REQUIRE(resultEvent.GetActions().size() == 2);
+  REQUIRE(resultEvent.GetActions()[0].GetType() == "MyExtension::NewAction");
+  REQUIRE(resultEvent.GetActions()[1].GetType() == "MyExtension::OtherAction");
+}
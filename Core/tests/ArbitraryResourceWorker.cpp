@@ -109,7 +109,9 @@ TEST_CASE("ArbitraryResourceWorker", "[common][resources]") {
 
         REQUIRE(uselessResources.size() == 2);
 
-        gd::ProjectResourcesAdder::RemoveAllUseless(project, "image");
+        std::vector<gd::String> removedResources =
+            gd::ProjectResourcesAdder::RemoveAllUseless(project, "image");
+        REQUIRE(removedResources == uselessResources);
         std::vector<gd::String> remainingResources =
             project.GetResourcesManager().GetAllResourceNames();
         REQUIRE(remainingResources.size() == 2);
@@ -0,0 +1,37 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/CodeOutputBuffer.h"
+
+#include "catch.hpp"
+
+TEST_CASE("CodeOutputBuffer", "[common][events]") {
+  SECTION("Chunks are concatenated in order") {
+    gd::CodeOutputBuffer buffer;
+    REQUIRE(buffer.IsEmpty());
+    REQUIRE(buffer.ToString() == "");
+
+    gd::String bigChunk = "let a = 1;\n";
+    buffer += "{";
+    buffer += std::move(bigChunk);
+    buffer.Append("").Append("}\n");
+    REQUIRE(buffer.GetSize() == 14);
+    REQUIRE(buffer.ToString() == "{let a = 1;\n}\n");
+
+    gd::String output = "// Code: ";
+    buffer.AppendTo(output);
+    REQUIRE(output == "// Code: {let a = 1;\n}\n");
+
+    buffer.Clear();
+    REQUIRE(buffer.IsEmpty());
+  }
+
+  SECTION("Sizes are counted in bytes") {
+    gd::CodeOutputBuffer buffer;
+    buffer += u8"\"Ünïcödé\"";
+    REQUIRE(buffer.GetSize() == gd::String(u8"\"Ünïcödé\"").Raw().size());
+    REQUIRE(buffer.ToString() == u8"\"Ünïcödé\"");
+  }
+}
@@ -8,6 +8,7 @@
  */
 #include "GDCore/IDE/DependenciesAnalyzer.h"
 #include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/Layout.h"
@@ -138,4 +139,121 @@ TEST_CASE("DependenciesAnalyzer", "[common]") {
     DependenciesAnalyzer analyzer(project, layout3);
     REQUIRE(analyzer.Analyze() == false);
   }
+
+  SECTION("Can share the links found between analyzers") {
+    gd::Project project;
+    auto& layout1 = project.InsertNewLayout("Layout1", 0);
+    auto& layout2 = project.InsertNewLayout("Layout2", 0);
+    auto& externalEvents1 =
+        project.InsertNewExternalEvents("ExternalEvents1", 0);
+
+    gd::LinkEvent linkEvent1;
+    linkEvent1.SetTarget("ExternalEvents1");
+    layout1.GetEvents().InsertEvent(linkEvent1);
+    gd::LinkEvent linkEvent2;
+    linkEvent2.SetTarget("Layout2");
+    externalEvents1.GetEvents().InsertEvent(linkEvent2);
+
+    DependenciesAnalyzer::LinksCache linksCache;
+    DependenciesAnalyzer analyzer1(project, layout1, linksCache);
+    REQUIRE(analyzer1.Analyze() == true);
+    REQUIRE(analyzer1.GetScenesDependencies().size() == 1);
+    REQUIRE(analyzer1.GetExternalEventsDependencies().size() == 1);
+
+    DependenciesAnalyzer analyzer2(project, layout2, linksCache);
+    REQUIRE(analyzer2.Analyze() == true);
+    REQUIRE(analyzer2.GetScenesDependencies().size() == 0);
+    REQUIRE(analyzer2.GetExternalEventsDependencies().size() == 0);
+
+    REQUIRE(linksCache.GetLinksTargets(externalEvents1) ==
+            std::vector<gd::String>{"Layout2"});
+
+    // Changed links are found without invalidating the cache.
+    // Layout2 now links to ExternalEvents1 which links back to Layout2.
+    layout2.GetEvents().InsertEvent(linkEvent1);
+    DependenciesAnalyzer analyzer3(project, layout2, linksCache);
+    REQUIRE(analyzer3.Analyze() == false);
+
+    // Also when the external events are modified.
+    externalEvents1.GetEvents().RemoveEvent(0);
+    DependenciesAnalyzer analyzer4(project, layout2, linksCache);
+    REQUIRE(analyzer4.Analyze() == true);
+    REQUIRE(analyzer4.GetScenesDependencies().size() == 0);
+    REQUIRE(analyzer4.GetExternalEventsDependencies().size() == 1);
+    REQUIRE(linksCache.GetLinksTargets(externalEvents1).empty());
+
+    // And when the target of a link is changed.
+    dynamic_cast<gd::LinkEvent&>(layout2.GetEvents().GetEvent(0))
+        .SetTarget("Layout1");
+    DependenciesAnalyzer analyzer5(project, layout2, linksCache);
+    REQUIRE(analyzer5.Analyze() == true);
+    REQUIRE(analyzer5.GetScenesDependencies().size() == 1);
+    REQUIRE(analyzer5.GetExternalEventsDependencies().size() == 1);
+
+    // Copying events, or modifying events without links or external layouts,
+    // keeps what was found.
+    const std::size_t linksGeneration = gd::EventsList::GetLinksGeneration();
+    gd::EventsList copiedEvents(layout2.GetEvents());
+    layout1.GetEvents().InsertEvent(gd::StandardEvent());
+    layout1.GetEvents().RemoveEvent(1);
+    REQUIRE(gd::EventsList::GetLinksGeneration() == linksGeneration);
+  }
+
+  SECTION("Can detect the external layouts used by events and their links") {
+    gd::Project project;
+    auto& layout1 = project.InsertNewLayout("Layout1", 0);
+    auto& layout2 = project.InsertNewLayout("Layout2", 0);
+    auto& externalEvents1 =
+        project.InsertNewExternalEvents("ExternalEvents1", 0);
+
+    auto makeEventCreatingObjects = [](const gd::String& externalLayoutName) {
+      gd::Instruction action;
+      action.SetType(
+          "BuiltinExternalLayouts::CreateObjectsFromExternalLayout");
+      action.SetParametersCount(5);
+      action.SetParameter(1, externalLayoutName);
+      gd::StandardEvent event;
+      event.GetActions().Insert(action);
+      return event;
+    };
+    layout1.GetEvents().InsertEvent(
+        makeEventCreatingObjects("\"ExternalLayout1\""));
+    gd::LinkEvent linkEvent1;
+    linkEvent1.SetTarget("ExternalEvents1");
+    layout1.GetEvents().InsertEvent(linkEvent1);
+    externalEvents1.GetEvents().InsertEvent(
+        makeEventCreatingObjects("\"ExternalLayout2\""));
+    layout2.GetEvents().InsertEvent(
+        makeEventCreatingObjects("\"ExternalLayout\" + ToString(1)"));
+
+    DependenciesAnalyzer analyzer1(project, layout1);
+    REQUIRE(analyzer1.Analyze() == true);
+    std::set<gd::String> expectedExternalLayouts = {"ExternalLayout1",
+                                                    "ExternalLayout2"};
+    REQUIRE(analyzer1.GetExternalLayoutsDependencies() ==
+            expectedExternalLayouts);
+    REQUIRE(analyzer1.HasUnknownExternalLayoutsDependencies() == false);
+
+    // Computed names can't be known.
+    DependenciesAnalyzer analyzer2(project, layout2);
+    REQUIRE(analyzer2.Analyze() == true);
+    REQUIRE(analyzer2.GetExternalLayoutsDependencies().empty());
+    REQUIRE(analyzer2.HasUnknownExternalLayoutsDependencies() == true);
+
+    // A parameter changed through its reference is taken into account.
+    DependenciesAnalyzer::LinksCache linksCache;
+    DependenciesAnalyzer analyzer3(project, layout2, linksCache);
+    REQUIRE(analyzer3.Analyze() == true);
+    REQUIRE(analyzer3.HasUnknownExternalLayoutsDependencies() == true);
+
+    dynamic_cast<gd::StandardEvent &>(layout2.GetEvents().GetEvent(0))
+        .GetActions()
+        .Get(0)
+        .GetParameter(1) = gd::Expression("\"ExternalLayout3\"");
+    DependenciesAnalyzer analyzer4(project, layout2, linksCache);
+    REQUIRE(analyzer4.Analyze() == true);
+    REQUIRE(analyzer4.GetExternalLayoutsDependencies() ==
+            std::set<gd::String>{"ExternalLayout3"});
+    REQUIRE(analyzer4.HasUnknownExternalLayoutsDependencies() == false);
+  }
 }
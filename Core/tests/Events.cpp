@@ -12,6 +12,7 @@
 #include "GDCore/Events/Builtin/GroupEvent.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsArena.h"
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/Project/Layout.h"
@@ -84,4 +85,33 @@ TEST_CASE("Events", "[common][events]") {
     REQUIRE(cloned->GetBackgroundColorG() == 2);
     REQUIRE(cloned->GetBackgroundColorB() == 3);
   }
+
+  SECTION("Copies in an arena") {
+    gd::EventsList events;
+    gd::StandardEvent event;
+    event.GetConditions().Insert(gd::Instruction("ConditionType"));
+    event.GetActions().Insert(gd::Instruction("ActionType"));
+    event.GetSubEvents().InsertEvent(event);
+    events.InsertEvent(event);
+
+    gd::EventsArena arena;
+    {
+      gd::EventsArena::Scope scope(&arena);
+      gd::EventsList copy = events;
+      REQUIRE(arena.GetReservedSize() > 0);
+      REQUIRE(copy.size() == 1);
+      REQUIRE(copy[0].GetSubEvents().size() == 1);
+      auto &copiedEvent =
+          dynamic_cast<gd::StandardEvent &>(copy[0].GetSubEvents()[0]);
+      REQUIRE(copiedEvent.GetConditions()[0].GetType() == "ConditionType");
+      REQUIRE(copiedEvent.GetActions()[0].GetType() == "ActionType");
+    }
+    REQUIRE(gd::EventsArena::GetCurrentArena() == nullptr);
+
+    // Copies made outside of the scope are not in the arena.
+    std::size_t reservedSize = arena.GetReservedSize();
+    gd::EventsList copy = events;
+    REQUIRE(copy.size() == 1);
+    REQUIRE(arena.GetReservedSize() == reservedSize);
+  }
 }
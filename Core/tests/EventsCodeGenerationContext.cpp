@@ -183,6 +183,65 @@ TEST_CASE("EventsCodeGenerationContext", "[common][events]") {
     REQUIRE(c7.IsSameObjectsList("c5.empty1", c5) == false);
   }
 
+  SECTION("Children see the lists declared when they inherited") {
+    gd::EventsCodeGenerationContext c6;
+    c6.InheritsFrom(c5);
+
+    c5.ObjectsListNeeded("c5.object2");
+    gd::EventsCodeGenerationContext c7;
+    c7.InheritsFrom(c5);
+
+    REQUIRE(c6.ObjectAlreadyDeclaredByParents("c5.object1") == true);
+    REQUIRE(c6.ObjectAlreadyDeclaredByParents("c5.object2") == false);
+    REQUIRE(c7.ObjectAlreadyDeclaredByParents("c5.object1") == true);
+    REQUIRE(c7.ObjectAlreadyDeclaredByParents("c5.object2") == true);
+    REQUIRE(c7.GetLastDepthObjectListWasNeeded("c5.object2") == 2);
+    REQUIRE(c7.GetObjectsListsAlreadyDeclaredByParents() ==
+            std::set<gd::String>({"c1.object1",
+                                  "c1.object2",
+                                  "c1.noPicking1",
+                                  "c2.object1",
+                                  "c5.object1",
+                                  "c5.object2",
+                                  "c5.noPicking1",
+                                  "c5.empty1"}));
+
+    // Lists used by a child don't change the parent:
+    c7.ObjectsListNeeded("c1.object1");
+    REQUIRE(c7.GetLastDepthObjectListWasNeeded("c1.object1") == 3);
+    REQUIRE(c5.GetLastDepthObjectListWasNeeded("c1.object1") == 0);
+  }
+
+  SECTION("Objects lists only read") {
+    gd::EventsCodeGenerationContext c6;
+    c6.InheritsFrom(c5);
+    c6.ObjectsListNeededForReading("c5.object1");
+    c6.ObjectsListNeededForReading("c1.object2");
+    c6.ObjectsListNeededForReading("c6.object1");
+
+    // Lists declared by parents are used as is:
+    REQUIRE(c6.GetObjectsListsToBeDeclared() ==
+            std::set<gd::String>({"c6.object1"}));
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c5.object1") == 2);
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c1.object2") == 2);
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c6.object1") == 3);
+
+    // ...until they are needed to be modified:
+    c6.ObjectsListNeeded("c5.object1");
+    c6.ObjectsListNeededForReading("c5.object1");
+    REQUIRE(c6.GetObjectsListsToBeDeclared() ==
+            std::set<gd::String>({"c5.object1", "c6.object1"}));
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c5.object1") == 3);
+
+    // Lists are always declared in asynchronous callbacks:
+    gd::EventsCodeGenerationContext c7;
+    c7.InheritsAsAsyncCallbackFrom(c6);
+    c7.ObjectsListNeededForReading("c1.object2");
+    REQUIRE(c7.GetObjectsListsToBeDeclared() ==
+            std::set<gd::String>({"c1.object2"}));
+    REQUIRE(c7.GetLastDepthObjectListWasNeeded("c1.object2") == 4);
+  }
+
   SECTION("Async") {
     gd::EventsCodeGenerationContext c1;
     c1.ObjectsListNeeded("c1.object1");
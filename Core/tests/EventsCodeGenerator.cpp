@@ -9,9 +9,22 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include <memory>
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/CommentEvent.h"
+#include "GDCore/Events/Builtin/GroupEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/CodeGenerationReport.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectConfiguration.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
@@ -31,4 +44,210 @@ TEST_CASE("EventsCodeGenerator", "[common][events]") {
     REQUIRE(codeGenerator.ConvertToString("{\"hello\":\r\n\"world \\\" \"}") ==
             "{\\\"hello\\\":\\r\\n\\\"world \\\\\\\" \\\"}");
   }
+
+  SECTION("Conditions evaluation order") {
+    gd::Platform platform;
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+    extension->SetExtensionInformation(
+        "MyExtension", "My testing extension", "", "", "");
+    extension
+        ->AddCondition("PureCondition", "", "", "", "", "", "")
+        .AddParameter("expression", "Value")
+        .MarkAsPure()
+        .MarkAsCheapToEvaluate();
+    extension
+        ->AddCondition("PickingCondition", "", "", "", "", "", "")
+        .AddParameter("objectList", "Object")
+        .MarkAsWithoutSideEffects()
+        .MarkAsExpensiveToEvaluate();
+    extension->AddCondition("OtherCondition", "", "", "", "", "", "")
+        .AddParameter("expression", "Value");
+    platform.AddExtension(extension);
+
+    std::shared_ptr<gd::PlatformExtension> baseObjectExtension =
+        std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+    baseObjectExtension->SetExtensionInformation(
+        "BuiltinObject", "Base object extension", "", "", "");
+    baseObjectExtension->AddObject<gd::ObjectConfiguration>(
+        "", "Base object", "Base object", "");
+    platform.AddExtension(baseObjectExtension);
+
+    gd::Project project;
+    project.AddPlatform(platform);
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    layout.GetObjects().InsertNewObject(project, "", "MyObject", 0);
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+
+    auto makeCondition = [](const gd::String& type,
+                            const gd::String& parameter) {
+      gd::Instruction condition(type);
+      condition.SetParametersCount(1);
+      condition.SetParameter(0, gd::Expression(parameter));
+      return condition;
+    };
+    gd::Instruction pureCondition =
+        makeCondition("MyExtension::PureCondition", "1 + MyVariable");
+    gd::Instruction pureConditionWithObject =
+        makeCondition("MyExtension::PureCondition", "MyObject.MyVariable");
+    gd::Instruction pureConditionWithCall =
+        makeCondition("MyExtension::PureCondition", "abs(1)");
+    gd::Instruction pickingCondition =
+        makeCondition("MyExtension::PickingCondition", "MyObject");
+    gd::Instruction otherCondition =
+        makeCondition("MyExtension::OtherCondition", "1");
+
+    {
+      // Pure conditions are evaluated before expensive picking conditions.
+      gd::InstructionsList conditions;
+      conditions.Insert(pickingCondition);
+      conditions.Insert(pickingCondition);
+      conditions.Insert(pureCondition);
+      REQUIRE(codeGenerator.GetConditionsEvaluationOrder(conditions) ==
+              std::vector<std::size_t>({2, 0, 1}));
+    }
+    {
+      // ...unless they use objects or call functions.
+      gd::InstructionsList conditions;
+      conditions.Insert(pickingCondition);
+      conditions.Insert(pureConditionWithObject);
+      conditions.Insert(pureConditionWithCall);
+      REQUIRE(codeGenerator.GetConditionsEvaluationOrder(conditions) ==
+              std::vector<std::size_t>({0, 1, 2}));
+    }
+    {
+      // Conditions that can have side effects are always evaluated first.
+      gd::InstructionsList conditions;
+      conditions.Insert(pickingCondition);
+      conditions.Insert(otherCondition);
+      conditions.Insert(pickingCondition);
+      conditions.Insert(pureCondition);
+      REQUIRE(codeGenerator.GetConditionsEvaluationOrder(conditions) ==
+              std::vector<std::size_t>({0, 1, 3, 2}));
+    }
+    {
+      // Conditions are not moved before cheaper ones.
+      gd::InstructionsList conditions;
+      conditions.Insert(pureCondition);
+      conditions.Insert(pickingCondition);
+      conditions.Insert(otherCondition);
+      REQUIRE(codeGenerator.GetConditionsEvaluationOrder(conditions) ==
+              std::vector<std::size_t>({0, 1, 2}));
+    }
+  }
+
+  SECTION("Events that can't generate code are deleted") {
+    gd::EventsList events;
+
+    // A group of comments.
+    auto &commentsGroup = events.InsertEvent(gd::GroupEvent());
+    commentsGroup.GetSubEvents().InsertEvent(gd::CommentEvent());
+    commentsGroup.GetSubEvents().InsertEvent(gd::CommentEvent());
+
+    // A disabled group with an action.
+    gd::StandardEvent eventWithAction;
+    eventWithAction.GetActions().Insert(gd::Instruction("MyAction"));
+    auto &disabledGroup = events.InsertEvent(gd::GroupEvent());
+    disabledGroup.GetSubEvents().InsertEvent(eventWithAction);
+    disabledGroup.SetDisabled(true);
+
+    // A link that was not replaced by its events.
+    events.InsertEvent(gd::LinkEvent());
+
+    // A standard event with only an empty sub event.
+    auto &emptyEvent = events.InsertEvent(gd::StandardEvent());
+    emptyEvent.GetSubEvents().InsertEvent(gd::StandardEvent());
+
+    // A group with a comment and an event with an action.
+    auto &group = events.InsertEvent(gd::GroupEvent());
+    group.GetSubEvents().InsertEvent(gd::CommentEvent());
+    group.GetSubEvents().InsertEvent(eventWithAction);
+
+    gd::EventsCodeGenerator::DeleteUselessEvents(events);
+
+    REQUIRE(events.size() == 1);
+    REQUIRE(dynamic_cast<gd::GroupEvent *>(&events[0]) != nullptr);
+    REQUIRE(events[0].GetSubEvents().size() == 1);
+    auto &remainingEvent =
+        dynamic_cast<gd::StandardEvent &>(events[0].GetSubEvents()[0]);
+    REQUIRE(remainingEvent.GetActions()[0].GetType() == "MyAction");
+  }
+}
+
+TEST_CASE("CodeGenerationReport", "[common][events]") {
+  gd::CodeGenerationReport report;
+  report.BeginEntry(
+      gd::CodeGenerationReport::Scene, "MyScene", "gdjs.MySceneCode");
+  report.AddObjectListsDeclared(2);
+  report.BeginEntry(gd::CodeGenerationReport::EventsGroup, "MyGroup");
+  report.SetProfilerSectionId(3);
+  report.AddObjectListsDeclared();
+  report.AddObjectListsCopied();
+  report.AddAsyncCallback();
+  report.EndEntry(100);
+  report.EndEntry(250);
+
+  SECTION("Entries are nested and their counts include their children") {
+    REQUIRE(report.GetEntriesCount() == 2);
+
+    const auto &scene = report.GetEntry(0);
+    REQUIRE(scene.type == gd::CodeGenerationReport::Scene);
+    REQUIRE(scene.parent == gd::CodeGenerationReport::NoParent);
+    REQUIRE(scene.profilerSectionId == -1);
+    REQUIRE(scene.codeSize == 250);
+    REQUIRE(scene.objectListsDeclared == 3);
+    REQUIRE(scene.objectListsCopied == 1);
+    REQUIRE(scene.asyncCallbacks == 1);
+
+    const auto &group = report.GetEntry(1);
+    REQUIRE(group.type == gd::CodeGenerationReport::EventsGroup);
+    REQUIRE(group.name == "MyGroup");
+    REQUIRE(group.parent == 0);
+    REQUIRE(group.profilerSectionId == 3);
+    REQUIRE(group.codeSize == 100);
+    REQUIRE(group.objectListsDeclared == 1);
+  }
+
+  SECTION("Counts made when no entry is begun are ignored") {
+    report.AddObjectListsCopied();
+    report.EndEntry(1);
+    REQUIRE(report.GetEntry(0).objectListsCopied == 1);
+    REQUIRE(report.GetEntry(0).codeSize == 250);
+  }
+
+  SECTION("Reports can be appended, keeping their entries nested") {
+    gd::CodeGenerationReport otherReport;
+    otherReport.BeginEntry(gd::CodeGenerationReport::Scene, "OtherScene");
+    otherReport.BeginEntry(gd::CodeGenerationReport::EventsGroup, "Group");
+    otherReport.EndEntry(10);
+    otherReport.EndEntry(20);
+
+    report.Append(otherReport);
+    REQUIRE(report.GetEntriesCount() == 4);
+    REQUIRE(report.GetEntry(2).name == "OtherScene");
+    REQUIRE(report.GetEntry(2).parent == gd::CodeGenerationReport::NoParent);
+    REQUIRE(report.GetEntry(2).codeSize == 20);
+    REQUIRE(report.GetEntry(3).name == "Group");
+    REQUIRE(report.GetEntry(3).parent == 2);
+    REQUIRE(report.GetEntry(1).parent == 0);
+  }
+
+  SECTION("The report can be exported as JSON") {
+    gd::SerializerElement element =
+        gd::Serializer::FromJSON(report.ToJSON());
+    auto &entries = element.GetChild("entries");
+    entries.ConsiderAsArrayOf("entry");
+    REQUIRE(entries.GetChildrenCount() == 2);
+    REQUIRE(entries.GetChild(0).GetStringAttribute("type") == "scene");
+    REQUIRE(entries.GetChild(0).GetStringAttribute("codeNamespace") ==
+            "gdjs.MySceneCode");
+    REQUIRE(entries.GetChild(0).GetIntAttribute("parent") == -1);
+    REQUIRE(entries.GetChild(1).GetStringAttribute("type") == "eventsGroup");
+    REQUIRE(entries.GetChild(1).GetIntAttribute("parent") == 0);
+    REQUIRE(entries.GetChild(1).GetIntAttribute("profilerSectionId") == 3);
+    REQUIRE(entries.GetChild(1).GetIntAttribute("codeSize") == 100);
+
+    report.Clear();
+    REQUIRE(report.GetEntriesCount() == 0);
+  }
 }
@@ -0,0 +1,127 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsFunctionsCallGraph.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+void AddCallingEvent(gd::EventsFunction &eventsFunction,
+                     const gd::String &type,
+                     const gd::String &parameter = "") {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(1);
+  instruction.SetParameter(0, parameter);
+
+  gd::StandardEvent event;
+  event.GetActions().Insert(instruction);
+  eventsFunction.GetEvents().InsertEvent(event);
+}
+
+}  // namespace
+
+TEST_CASE("EventsFunctionsCallGraph", "[events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto &extension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  auto &functions = extension.GetEventsFunctions();
+  auto &functionA = functions.InsertNewEventsFunction("A", 0);
+  auto &functionB = functions.InsertNewEventsFunction("B", 1);
+  functions.InsertNewEventsFunction("C", 2).SetFunctionType(
+      gd::EventsFunction::Expression);
+
+  // A calls B, and C in an expression. B calls A.
+  AddCallingEvent(functionA, "MyEventsExtension::B");
+  AddCallingEvent(
+      functionA, "MyExtension::DoSomething", "1 + MyEventsExtension::C()");
+  AddCallingEvent(functionB, "MyEventsExtension::A");
+
+  // A behavior function calls another one in an expression, which calls C.
+  auto &behavior = extension.GetEventsBasedBehaviors().InsertNew(
+      "MyBehavior", 0);
+  auto &behaviorFunctions = behavior.GetEventsFunctions();
+  auto &functionF = behaviorFunctions.InsertNewEventsFunction("F", 0);
+  auto &functionG = behaviorFunctions.InsertNewEventsFunction("G", 1);
+  functionG.SetFunctionType(gd::EventsFunction::Expression);
+  for (gd::EventsFunction *behaviorFunction : {&functionF, &functionG}) {
+    behaviorFunction->GetParameters()
+        .InsertNewParameter("Object", 0)
+        .SetType("object");
+    behaviorFunction->GetParameters()
+        .InsertNewParameter("Behavior", 1)
+        .SetType("behavior")
+        .SetExtraInfo("MyEventsExtension::MyBehavior");
+  }
+  AddCallingEvent(
+      functionF, "MyExtension::DoSomething", "Object.Behavior::G()");
+  AddCallingEvent(functionG, "MyEventsExtension::C");
+
+  gd::EventsFunctionsCallGraph callGraph;
+  callGraph.Build(project);
+
+  SECTION("Calls are found in instructions and expressions") {
+    REQUIRE(callGraph.HasFunction("MyEventsExtension::A"));
+    REQUIRE(callGraph.HasFunction("MyEventsExtension::MyBehavior::F"));
+    REQUIRE_FALSE(callGraph.HasFunction("MyExtension::DoSomething"));
+
+    std::set<gd::String> expectedFunctions = {"MyEventsExtension::B",
+                                              "MyEventsExtension::C"};
+    REQUIRE(callGraph.GetCalledFunctions("MyEventsExtension::A") ==
+            expectedFunctions);
+    expectedFunctions = {"MyEventsExtension::MyBehavior::G"};
+    REQUIRE(callGraph.GetCalledFunctions("MyEventsExtension::MyBehavior::F") ==
+            expectedFunctions);
+    expectedFunctions = {"MyEventsExtension::A",
+                         "MyEventsExtension::MyBehavior::G"};
+    REQUIRE(callGraph.GetCallingFunctions("MyEventsExtension::C") ==
+            expectedFunctions);
+  }
+
+  SECTION("Recursion and affected functions") {
+    REQUIRE(callGraph.IsRecursive("MyEventsExtension::A"));
+    REQUIRE(callGraph.IsRecursive("MyEventsExtension::B"));
+    REQUIRE_FALSE(callGraph.IsRecursive("MyEventsExtension::C"));
+    REQUIRE_FALSE(callGraph.IsRecursive("MyEventsExtension::MyBehavior::F"));
+
+    std::set<gd::String> expectedFunctions = {
+        "MyEventsExtension::A",
+        "MyEventsExtension::B",
+        "MyEventsExtension::MyBehavior::F",
+        "MyEventsExtension::MyBehavior::G"};
+    REQUIRE(callGraph.GetAffectedFunctions("MyEventsExtension::C") ==
+            expectedFunctions);
+  }
+
+  SECTION("The graph is updated when an extension is modified or removed") {
+    REQUIRE(callGraph.IsRecursive("MyEventsExtension::A"));
+
+    functionB.GetEvents().RemoveEvent(0);
+    callGraph.UpdateExtension(project, extension);
+    REQUIRE_FALSE(callGraph.IsRecursive("MyEventsExtension::A"));
+    std::set<gd::String> expectedFunctions = {
+        "MyEventsExtension::A",
+        "MyEventsExtension::MyBehavior::F",
+        "MyEventsExtension::MyBehavior::G"};
+    REQUIRE(callGraph.GetAffectedFunctions("MyEventsExtension::C") ==
+            expectedFunctions);
+
+    callGraph.RemoveExtension("MyEventsExtension");
+    REQUIRE_FALSE(callGraph.HasFunction("MyEventsExtension::A"));
+    REQUIRE(callGraph.GetAffectedFunctions("MyEventsExtension::C").empty());
+  }
+}
@@ -0,0 +1,104 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsListRows.h"
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "catch.hpp"
+
+TEST_CASE("EventsListRows", "[common][events]") {
+  // Event 0
+  //   Event 0.0 (disabled, folded)
+  //     Event 0.0.0
+  //   Event 0.1
+  // Event 1
+  gd::EventsList events;
+  auto &event0 = events.InsertEvent(gd::StandardEvent());
+  auto &event00 = event0.GetSubEvents().InsertEvent(gd::StandardEvent());
+  auto &event000 = event00.GetSubEvents().InsertEvent(gd::StandardEvent());
+  auto &event01 = event0.GetSubEvents().InsertEvent(gd::StandardEvent());
+  auto &event1 = events.InsertEvent(gd::StandardEvent());
+  event00.SetDisabled(true);
+  event00.SetFolded(true);
+
+  SECTION("Rows don't contain the sub-events of folded events") {
+    gd::EventsListRows rows;
+    rows.Build(events);
+
+    REQUIRE(rows.GetRowsCount() == 4);
+    REQUIRE(&rows.GetEventAt(0) == &event0);
+    REQUIRE(&rows.GetEventAt(1) == &event00);
+    REQUIRE(&rows.GetEventAt(2) == &event01);
+    REQUIRE(&rows.GetEventAt(3) == &event1);
+    REQUIRE(rows.GetDepthAt(0) == 0);
+    REQUIRE(rows.GetDepthAt(1) == 1);
+    REQUIRE(rows.GetDepthAt(3) == 0);
+    REQUIRE(rows.GetRowIndexOf(event01) == 2);
+    REQUIRE(rows.GetRowIndexOf(event000) == gd::String::npos);
+
+    event00.SetFolded(false);
+    rows.Build(events);
+    REQUIRE(rows.GetRowsCount() == 5);
+    REQUIRE(&rows.GetEventAt(2) == &event000);
+    REQUIRE(rows.GetDepthAt(2) == 2);
+  }
+
+  SECTION("Rows are disabled when their event or a parent is disabled") {
+    event00.SetFolded(false);
+    gd::EventsListRows rows;
+    rows.Build(events);
+
+    REQUIRE(rows.IsDisabledAt(0) == false);
+    REQUIRE(rows.IsDisabledAt(1) == true);
+    REQUIRE(rows.IsDisabledAt(2) == true);
+    REQUIRE(rows.IsDisabledAt(3) == false);
+  }
+
+  SECTION("Rows offsets are computed from the events heights") {
+    gd::EventsListRows rows;
+    rows.Build(events);
+    rows.SetDefaultEventHeight(10);
+    rows.SetEventHeight(event00, 50);
+
+    REQUIRE(rows.GetRowHeight(0) == 10);
+    REQUIRE(rows.GetRowHeight(1) == 50);
+    REQUIRE(rows.GetRowOffset(0) == 0);
+    REQUIRE(rows.GetRowOffset(1) == 10);
+    REQUIRE(rows.GetRowOffset(2) == 60);
+    REQUIRE(rows.GetRowOffset(3) == 70);
+    REQUIRE(rows.GetTotalHeight() == 80);
+
+    REQUIRE(rows.GetRowIndexAtOffset(-5) == 0);
+    REQUIRE(rows.GetRowIndexAtOffset(0) == 0);
+    REQUIRE(rows.GetRowIndexAtOffset(9.5) == 0);
+    REQUIRE(rows.GetRowIndexAtOffset(10) == 1);
+    REQUIRE(rows.GetRowIndexAtOffset(59) == 1);
+    REQUIRE(rows.GetRowIndexAtOffset(65) == 2);
+    REQUIRE(rows.GetRowIndexAtOffset(75) == 3);
+    REQUIRE(rows.GetRowIndexAtOffset(1000) == 3);
+
+    // Heights are kept when rows are built again.
+    event0.SetFolded(true);
+    rows.Build(events);
+    REQUIRE(rows.GetRowsCount() == 2);
+    REQUIRE(rows.GetTotalHeight() == 20);
+    REQUIRE(rows.GetRowIndexAtOffset(15) == 1);
+
+    rows.ClearEventsHeights();
+    rows.SetDefaultEventHeight(0);
+    REQUIRE(rows.GetTotalHeight() == 0);
+  }
+
+  SECTION("Empty list") {
+    gd::EventsList emptyEvents;
+    gd::EventsListRows rows;
+    rows.Build(emptyEvents);
+    REQUIRE(rows.GetRowsCount() == 0);
+    REQUIRE(rows.GetTotalHeight() == 0);
+    REQUIRE(rows.GetRowIndexAtOffset(10) == 0);
+  }
+}
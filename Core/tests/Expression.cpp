@@ -0,0 +1,63 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering gd::Expression.
+ */
+#include "GDCore/Events/Expression.h"
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "catch.hpp"
+
+TEST_CASE("Expression", "[common][events]") {
+  SECTION("Parsed trees are shared between copies") {
+    gd::Expression expression("MyObject.X() + 1");
+    gd::Expression copy(expression);
+    gd::Expression assigned;
+    assigned = expression;
+
+    REQUIRE(expression.GetRootNode() != nullptr);
+    REQUIRE(copy.GetRootNode() == expression.GetRootNode());
+    REQUIRE(assigned.GetRootNode() == expression.GetRootNode());
+  }
+
+  SECTION("Parsed trees are shared between identical expressions") {
+    gd::Expression expression1("MyObject.X() + 1");
+    gd::Expression expression2("MyObject.X() + 1");
+    gd::Expression expression3("MyObject.X() + 2");
+
+    REQUIRE(expression1.GetRootNode() == expression2.GetRootNode());
+    REQUIRE(expression1.GetRootNode() != expression3.GetRootNode());
+  }
+
+  SECTION("Assigning a new string gives a new tree") {
+    gd::Expression expression("1 + 1");
+    gd::Expression copy(expression);
+    REQUIRE(copy.GetRootNode() == expression.GetRootNode());
+
+    copy = gd::Expression("2 + 2");
+    REQUIRE(copy.GetRootNode() != expression.GetRootNode());
+    REQUIRE(dynamic_cast<gd::OperatorNode *>(copy.GetRootNode()) != nullptr);
+  }
+
+  SECTION("Recently parsed trees are kept when no expression uses them") {
+    gd::Expression::SetKeptParsedTreesCount(16);
+    gd::ExpressionNode *rootNode = nullptr;
+    {
+      gd::Expression expression("MyObject.X() + 3");
+      rootNode = expression.GetRootNode();
+    }
+    {
+      // Allocate other trees that could reuse the memory of the first one.
+      gd::Expression otherExpression("MyObject.Y() + 3");
+      otherExpression.GetRootNode();
+    }
+    gd::Expression expression("MyObject.X() + 3");
+    REQUIRE(expression.GetRootNode() == rootNode);
+
+    // Free the kept trees, like when a project is closed.
+    gd::Expression::SetKeptParsedTreesCount(0);
+  }
+}
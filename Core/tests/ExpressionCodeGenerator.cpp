@@ -109,7 +109,8 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
 
       REQUIRE(node);
       node->Visit(expressionCodeGenerator);
-      REQUIRE(expressionCodeGenerator.GetOutput() == "\"hello\" + \"world\"");
+      // Operations on literals are folded.
+      REQUIRE(expressionCodeGenerator.GetOutput() == "\"helloworld\"");
     }
     {
       auto node = parser.ParseExpression(
@@ -185,7 +186,81 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
                                                           context);
       REQUIRE(node);
       node->Visit(expressionCodeGenerator);
-      REQUIRE(expressionCodeGenerator.GetOutput() == "12.5 + -(2.) / (0.3)");
+      REQUIRE(expressionCodeGenerator.GetOutput() == "5.833333333333333");
+    }
+  }
+
+  SECTION("Operations on literals are folded") {
+    {
+      auto node = parser.ParseExpression("2 * 3.14159 / 180");
+      gd::ExpressionCodeGenerator expressionCodeGenerator("number",
+                                                          "",
+                                                          codeGenerator,
+                                                          context);
+      REQUIRE(node);
+      node->Visit(expressionCodeGenerator);
+      REQUIRE(expressionCodeGenerator.GetOutput() == "0.03490655555555555");
+    }
+    {
+      auto node = parser.ParseExpression("-(1 + 2) * 4");
+      gd::ExpressionCodeGenerator expressionCodeGenerator("number",
+                                                          "",
+                                                          codeGenerator,
+                                                          context);
+      REQUIRE(node);
+      node->Visit(expressionCodeGenerator);
+      REQUIRE(expressionCodeGenerator.GetOutput() == "-12");
+    }
+    {
+      auto node = parser.ParseExpression("\"Score: \" + \"0\"");
+      gd::ExpressionCodeGenerator expressionCodeGenerator("string",
+                                                          "",
+                                                          codeGenerator,
+                                                          context);
+      REQUIRE(node);
+      node->Visit(expressionCodeGenerator);
+      REQUIRE(expressionCodeGenerator.GetOutput() == "\"Score: 0\"");
+    }
+    {
+      // Only the constant part is folded.
+      auto node = parser.ParseExpression("MyExtension::GetNumber() + (2 * 3)");
+      gd::ExpressionCodeGenerator expressionCodeGenerator("number",
+                                                          "",
+                                                          codeGenerator,
+                                                          context);
+      REQUIRE(node);
+      node->Visit(expressionCodeGenerator);
+      REQUIRE(expressionCodeGenerator.GetOutput() == "getNumber() + (6)");
+    }
+    {
+      // Long chains of operations are only evaluated once.
+      gd::String expression;
+      gd::String expectedOutput;
+      for (std::size_t i = 0; i < 5000; ++i) {
+        expression += "(1 + 2) + ";
+        expectedOutput += "(3) + ";
+      }
+      expression += "MyExtension::GetNumber()";
+      expectedOutput += "getNumber()";
+      auto node = parser.ParseExpression(expression);
+      gd::ExpressionCodeGenerator expressionCodeGenerator("number",
+                                                          "",
+                                                          codeGenerator,
+                                                          context);
+      REQUIRE(node);
+      node->Visit(expressionCodeGenerator);
+      REQUIRE(expressionCodeGenerator.GetOutput() == expectedOutput);
+    }
+    {
+      // Infinities are left to be computed at runtime.
+      auto node = parser.ParseExpression("1 / 0");
+      gd::ExpressionCodeGenerator expressionCodeGenerator("number",
+                                                          "",
+                                                          codeGenerator,
+                                                          context);
+      REQUIRE(node);
+      node->Visit(expressionCodeGenerator);
+      REQUIRE(expressionCodeGenerator.GetOutput() == "1 / 0");
     }
   }
 
@@ -267,7 +342,7 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
       REQUIRE(node);
       node->Visit(expressionCodeGenerator);
       REQUIRE(expressionCodeGenerator.GetOutput() ==
-              "getCursorX(\"\", \"layer1\", 2 + 2)");
+              "getCursorX(\"\", \"layer1\", 4)");
       // (first argument is the currentScene)
     }
     SECTION("with last optional parameter omit") {
@@ -1119,7 +1194,7 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
       REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
                   codeGenerator, context, "variable", "MySceneVariable[ \"hello\" + "
             "\"world\" ]", "")
-              == "getAnyVariable(MySceneVariable).getChild(\"hello\" + \"world\")");
+              == "getAnyVariable(MySceneVariable).getChild(\"helloworld\")");
     }
     SECTION("bracket access (using a string object variable inside)") {
       REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
@@ -1296,7 +1371,7 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
         node->Visit(expressionCodeGenerator);
         REQUIRE(expressionCodeGenerator.GetOutput() ==
                 "returnVariable(getLayoutVariable(myVariable).getChild("
-                "\"hello\" + \"world\").getChild(\"child2\"))");
+                "\"helloworld\").getChild(\"child2\"))");
       }
       SECTION("bracket access with nested variable") {
         auto node = parser.ParseExpression(
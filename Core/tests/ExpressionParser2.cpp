@@ -3958,6 +3958,20 @@ TEST_CASE("ExpressionParser2", "[common][events]") {
         REQUIRE(operatorNode.rightHandSide->location.GetEndPosition() == 10);
       }
     }
+    SECTION("Locations with non ASCII characters") {
+      // Locations are expressed in code points, not in bytes.
+      auto node = parser.ParseExpression("\"日本語\" +  12");
+      REQUIRE(node != nullptr);
+      auto &operatorNode = dynamic_cast<gd::OperatorNode &>(*node);
+      REQUIRE(operatorNode.location.GetStartPosition() == 0);
+      REQUIRE(operatorNode.location.GetEndPosition() == 11);
+      auto &textNode = dynamic_cast<gd::TextNode &>(*operatorNode.leftHandSide);
+      REQUIRE(textNode.text == "日本語");
+      REQUIRE(textNode.location.GetStartPosition() == 0);
+      REQUIRE(textNode.location.GetEndPosition() == 5);
+      REQUIRE(operatorNode.rightHandSide->location.GetStartPosition() == 9);
+      REQUIRE(operatorNode.rightHandSide->location.GetEndPosition() == 11);
+    }
     SECTION("Variable locations (simple variable name)") {
       auto node = parser.ParseExpression("MyVariable");
       REQUIRE(node != nullptr);
@@ -4327,4 +4341,69 @@ TEST_CASE("ExpressionParser2", "[common][events]") {
       }
     }
   }
+
+  SECTION("Locations") {
+    // Locations are kept for every node of every expression, so they must
+    // stay small.
+    REQUIRE(sizeof(gd::ExpressionParserLocation) == 2 * sizeof(std::uint32_t));
+
+    gd::ExpressionParserLocation invalidLocation;
+    REQUIRE(!invalidLocation.IsValid());
+    REQUIRE(invalidLocation.GetStartPosition() == 0);
+    REQUIRE(invalidLocation.GetEndPosition() == 0);
+
+    gd::ExpressionParserLocation location(3, 7);
+    REQUIRE(location.IsValid());
+    REQUIRE(location.GetStartPosition() == 3);
+    REQUIRE(location.GetEndPosition() == 7);
+    location.MovePositionsFrom(5, -2);
+    REQUIRE(location.GetStartPosition() == 3);
+    REQUIRE(location.GetEndPosition() == 5);
+
+    invalidLocation.MovePositionsFrom(0, 4);
+    REQUIRE(!invalidLocation.IsValid());
+  }
+
+  SECTION("Parsing in an arena") {
+    gd::ExpressionNodeArena arena(16 * 1024);
+    for (int i = 0; i < 3; i++) {
+      {
+        auto node = parser.ParseExpression(
+            "MySpriteObject.GetObjectNumber() + 1 + \"unterminated", arena);
+        REQUIRE(node != nullptr);
+        auto &operatorNode = dynamic_cast<gd::OperatorNode &>(*node);
+        auto &rightOperatorNode =
+            dynamic_cast<gd::OperatorNode &>(*operatorNode.rightHandSide);
+        REQUIRE(rightOperatorNode.rightHandSide->diagnostic != nullptr);
+
+        gd::ExpressionValidator validator(platform, projectScopedContainers, "number");
+        node->Visit(validator);
+        REQUIRE(!validator.GetFatalErrors().empty());
+
+        // Nodes allocated on the heap can be mixed with the nodes of the
+        // arena, each one being released (or not) when deleted.
+        std::unique_ptr<gd::ExpressionNode> heapNode(new gd::NumberNode("2"));
+        heapNode->diagnostic.reset(new gd::ExpressionParserError(
+            gd::ExpressionParserError::ErrorType::SyntaxError, "Error", 0));
+        rightOperatorNode.rightHandSide = std::move(heapNode);
+        {
+          gd::ExpressionNodeArena::Scope arenaScope(&arena);
+          operatorNode.leftHandSide->diagnostic.reset(
+              new gd::ExpressionParserError(
+                  gd::ExpressionParserError::ErrorType::SyntaxError,
+                  "Error",
+                  0));
+        }
+      }
+
+      // Memory is reused after a reset.
+      REQUIRE(arena.GetReservedSize() == 16 * 1024);
+      arena.Reset();
+    }
+
+    // Nodes are allocated on the heap outside of an arena.
+    auto node = parser.ParseExpression("1 + 2");
+    REQUIRE(node != nullptr);
+    REQUIRE(arena.GetReservedSize() == 16 * 1024);
+  }
 }
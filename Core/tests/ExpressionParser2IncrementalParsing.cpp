@@ -0,0 +1,159 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <memory>
+#include <vector>
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/IDE/Events/ExpressionNodeLocationFinder.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::String DescribeNode(gd::ExpressionNode *node) {
+  if (!node) return "no node";
+
+  gd::String description = gd::ExpressionParser2NodePrinter::PrintNode(*node);
+  description += " [" + gd::String::From(node->location.GetStartPosition()) +
+                 ", " + gd::String::From(node->location.GetEndPosition()) +
+                 "]";
+  if (node->diagnostic)
+    description +=
+        " error [" +
+        gd::String::From(node->diagnostic->GetStartPosition()) + ", " +
+        gd::String::From(node->diagnostic->GetEndPosition()) + "]";
+  return description;
+}
+
+/**
+ * Check that the nodes found at each position of an expression are the same
+ * in both trees.
+ */
+void RequireSameTrees(gd::ExpressionNode &node,
+                      gd::ExpressionNode &expectedNode,
+                      const gd::String &expression) {
+  REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(node) ==
+          gd::ExpressionParser2NodePrinter::PrintNode(expectedNode));
+  for (size_t position = 0; position <= expression.size(); position++) {
+    INFO("Position " << position << " in: " << expression);
+    REQUIRE(DescribeNode(gd::ExpressionNodeLocationFinder::GetNodeAtPosition(
+                node, position)) ==
+            DescribeNode(gd::ExpressionNodeLocationFinder::GetNodeAtPosition(
+                expectedNode, position)));
+  }
+}
+
+bool ReparseAndCompare(const gd::String &expression,
+                       size_t position,
+                       size_t deletedLength,
+                       const gd::String &insertedText) {
+  gd::ExpressionParser2 parser;
+  auto node = parser.ParseExpression(expression);
+  bool isIncremental = parser.ReparseExpression(
+      node, expression, position, deletedLength, insertedText);
+
+  gd::String newExpression = expression.substr(0, position) + insertedText +
+                             expression.substr(position + deletedLength);
+  INFO("Edited expression: " << newExpression);
+  gd::ExpressionParser2 fullParser;
+  auto expectedNode = fullParser.ParseExpression(newExpression);
+  RequireSameTrees(*node, *expectedNode, newExpression);
+  return isIncremental;
+}
+
+}  // namespace
+
+TEST_CASE("ExpressionParser2 - Incremental parsing", "[common][events]") {
+  SECTION("Edit in a parameter") {
+    gd::String expression =
+        "MyExtension::GetNumberWith2Params(1 + 2, \"abc\") * 3";
+    REQUIRE(ReparseAndCompare(expression, 38, 1, "20"));
+    REQUIRE(ReparseAndCompare(expression, 42, 3, "Hello world"));
+    REQUIRE(ReparseAndCompare(expression, 34, 5, "7"));
+  }
+
+  SECTION("Edit at the end of a parameter") {
+    gd::String expression = "MyExtension::GetNumberWith2Params(1 , 2)";
+    REQUIRE(ReparseAndCompare(expression, 35, 0, "+ 3"));
+    REQUIRE(ReparseAndCompare(expression, 36, 0, " * 4"));
+  }
+
+  SECTION("Edit in a parameter ending with a nested call") {
+    gd::String expression =
+        "MyExtension::GetNumberWith2Params(MyExtension::GetNumberWith2Params(1, "
+        "\"a\"), \"b\")";
+    REQUIRE(ReparseAndCompare(expression, 68, 1, "12"));
+    REQUIRE(ReparseAndCompare(expression, 72, 1, "abc"));
+    REQUIRE(ReparseAndCompare(expression, 75, 0, " + 1"));
+    REQUIRE_FALSE(ReparseAndCompare(expression, 74, 1, ""));
+    REQUIRE_FALSE(ReparseAndCompare(expression, 75, 0, ")"));
+  }
+
+  SECTION("Edit in a parameter ending with a string") {
+    gd::String expression =
+        "MyExtension::GetNumberWith2Params(1, MyExtension::ToString(\"abc\"))";
+    REQUIRE(ReparseAndCompare(expression, 60, 3, "Hello"));
+    REQUIRE(ReparseAndCompare(expression, 63, 0, "d"));
+    REQUIRE(ReparseAndCompare(expression, 64, 0, " + \"d\""));
+    REQUIRE(ReparseAndCompare(expression, 65, 0, " + 1"));
+    REQUIRE_FALSE(ReparseAndCompare(expression, 63, 1, ""));
+    REQUIRE_FALSE(ReparseAndCompare(expression, 63, 0, "\\"));
+  }
+
+  SECTION("Edit in a parameter ending with a variable with accessors") {
+    gd::String expression =
+        "MyExtension::GetNumberWith2Params(MyVariable.Child[\"Key\"][3], 2)";
+    REQUIRE(ReparseAndCompare(expression, 52, 3, "Other"));
+    REQUIRE(ReparseAndCompare(expression, 58, 1, "MyVariable"));
+    REQUIRE(ReparseAndCompare(expression, 60, 0, ".Other"));
+    REQUIRE(ReparseAndCompare(expression, 60, 0, "[4]"));
+    ReparseAndCompare(expression, 59, 1, "");
+    REQUIRE_FALSE(ReparseAndCompare(expression, 60, 0, ")"));
+  }
+
+  SECTION("Edit in nested sub expressions") {
+    gd::String expression = "(1 + (2 * MySpriteObject.GetObjectNumber())) - 4";
+    REQUIRE(ReparseAndCompare(expression, 6, 1, "3"));
+    REQUIRE(ReparseAndCompare(expression, 25, 15, "X"));
+    REQUIRE(ReparseAndCompare(expression, 1, 1, "10"));
+  }
+
+  SECTION("Edit with non ASCII characters") {
+    gd::String expression = "\"é\" + MyExtension::ToString(\"à\") + \"ü\"";
+    REQUIRE(ReparseAndCompare(expression, 29, 1, "ééé"));
+  }
+
+  SECTION("Edits changing the structure parse the whole expression") {
+    gd::String expression =
+        "MyExtension::GetNumberWith2Params(1 + 2, \"abc\") * 3";
+    REQUIRE_FALSE(ReparseAndCompare(expression, 39, 0, ", "));
+    REQUIRE_FALSE(ReparseAndCompare(expression, 38, 0, ")"));
+    REQUIRE_FALSE(ReparseAndCompare(expression, 34, 5, " "));
+    REQUIRE_FALSE(ReparseAndCompare(expression, 0, 1, "N"));
+    REQUIRE_FALSE(ReparseAndCompare("1 + 2", 2, 1, "-"));
+  }
+
+  SECTION("Any edit gives the same tree as a full parse") {
+    std::vector<gd::String> expressions = {
+        "MyExtension::GetNumberWith2Params(1 + 2, \"a,b\") * (3 + -4)",
+        "MyObject.MyBehavior::Func( ,MyVar[\"x\"].Child , ) + \"unterminated",
+        "Fn(A(1), (2)) * (  )"};
+    std::vector<gd::String> insertedTexts = {
+        "", "1", " ", ",", "(", ")", "\"", "[", "a", "+", "\\"};
+    for (const auto &expression : expressions) {
+      for (size_t position = 0; position <= expression.size(); position++) {
+        for (size_t deletedLength = 0;
+             deletedLength <= 2 && position + deletedLength <= expression.size();
+             deletedLength++) {
+          for (const auto &insertedText : insertedTexts) {
+            ReparseAndCompare(expression, position, deletedLength, insertedText);
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,114 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ExpressionVariablePathFinder.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::ExpressionNode &GetLastAccessorNode(gd::ExpressionNode &node) {
+  auto *variableNode = dynamic_cast<gd::VariableNode *>(&node);
+  REQUIRE(variableNode != nullptr);
+  gd::VariableAccessorOrVariableBracketAccessorNode *accessorNode =
+      variableNode->child.get();
+  REQUIRE(accessorNode != nullptr);
+  while (accessorNode->child) accessorNode = accessorNode->child.get();
+  return *accessorNode;
+}
+
+}  // namespace
+
+TEST_CASE("ExpressionVariablePathFinder", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  auto &structure = layout.GetVariables().InsertNew("MyStructure");
+  auto &array = structure.GetChild("MyArray");
+  array.CastTo(gd::Variable::Array);
+  auto &item = array.PushNew();
+  item.GetChild("MyString").SetString("Hello");
+  item.GetChild("MyNumber").SetValue(1);
+
+  auto projectScopedContainers = gd::ProjectScopedContainers::
+      MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+  gd::ExpressionParser2 parser;
+
+  auto getVariableType = [&](const gd::String &expression,
+                             gd::VariablePathsCache *cache) {
+    auto node = parser.ParseExpression(expression);
+    REQUIRE(node != nullptr);
+    return gd::ExpressionVariablePathFinder::GetVariableType(
+        platform, projectScopedContainers, *node, "", cache);
+  };
+
+  SECTION("Variables are found with or without a cache") {
+    gd::VariablePathsCache cache;
+    for (gd::VariablePathsCache *usedCache :
+         {static_cast<gd::VariablePathsCache *>(nullptr), &cache}) {
+      REQUIRE(getVariableType("MyStructure", usedCache) ==
+              gd::Variable::Structure);
+      REQUIRE(getVariableType("MyStructure.MyArray", usedCache) ==
+              gd::Variable::Array);
+      REQUIRE(getVariableType("MyStructure.MyArray[Index].MyString",
+                              usedCache) == gd::Variable::String);
+      REQUIRE(getVariableType("MyStructure.MyArray[Index].MyNumber",
+                              usedCache) == gd::Variable::Number);
+      REQUIRE(getVariableType("MyStructure.MyArray[Index].MyUnknown",
+                              usedCache) == gd::Variable::Unknown);
+      REQUIRE(getVariableType("MyStructure.MyUnknown.MyString", usedCache) ==
+              gd::Variable::Unknown);
+      REQUIRE(getVariableType("MyUnknown", usedCache) ==
+              gd::Variable::Unknown);
+    }
+  }
+
+  SECTION("Cached paths are used again until the cache is cleared") {
+    gd::VariablePathsCache cache;
+    REQUIRE(getVariableType("MyStructure.MyArray[Index].MyString", &cache) ==
+            gd::Variable::String);
+
+    item.GetChild("MyString").SetValue(2);
+    REQUIRE(getVariableType("MyStructure.MyArray[Index].MyString", &cache) ==
+            gd::Variable::Number);
+
+    // A removed variable must not be used anymore after the cache is cleared.
+    item.RemoveChild("MyString");
+    cache.Clear();
+    REQUIRE(getVariableType("MyStructure.MyArray[Index].MyString", &cache) ==
+            gd::Variable::Unknown);
+    REQUIRE(getVariableType("MyStructure.MyArray[Index].MyNumber", &cache) ==
+            gd::Variable::Number);
+  }
+
+  SECTION("Last parents are found with a cache") {
+    gd::VariablePathsCache cache;
+    auto node = parser.ParseExpression("MyStructure.MyArray[Index].MyNumber");
+    REQUIRE(node != nullptr);
+    auto lastParentOfNode =
+        gd::ExpressionVariablePathFinder::GetLastParentOfNode(
+            platform, projectScopedContainers, GetLastAccessorNode(*node),
+            &cache);
+    REQUIRE(lastParentOfNode.parentVariable == &item);
+
+    // The same parent is found by a sibling accessor.
+    auto siblingNode =
+        parser.ParseExpression("MyStructure.MyArray[Index].MyString");
+    REQUIRE(siblingNode != nullptr);
+    auto siblingLastParentOfNode =
+        gd::ExpressionVariablePathFinder::GetLastParentOfNode(
+            platform, projectScopedContainers,
+            GetLastAccessorNode(*siblingNode), &cache);
+    REQUIRE(siblingLastParentOfNode.parentVariable == &item);
+  }
+}
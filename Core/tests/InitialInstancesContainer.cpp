@@ -14,6 +14,7 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/VersionWrapper.h"
 
 void AddNewInitialInstance(gd::InitialInstancesContainer &container,
@@ -219,10 +220,61 @@ TEST_CASE("InitialInstancesContainer", "[common][instances]") {
                           MakeInstance("object3", "layer2", 9)}) == true);
   }
 
+  SECTION("Serialization") {
+    gd::SerializerElement element;
+    container.SerializeTo(element);
+
+    gd::InitialInstancesContainer unserializedContainer;
+    unserializedContainer.UnserializeFrom(element);
+    REQUIRE(unserializedContainer.GetInstancesCount() == 7);
+
+    AllInstancesFunctor func;
+    unserializedContainer.IterateOverInstances(func);
+    REQUIRE(func.Compare({MakeInstance("object1", "layer1", 10),
+                          MakeInstance("object1", "layer2", 10),
+                          MakeInstance("object1", "layer1", 14),
+                          MakeInstance("object2", "layer1", 12),
+                          MakeInstance("object2", "layer1", 10),
+                          MakeInstance("object3", "layer2", 11),
+                          MakeInstance("object3", "layer2", 9)}) == true);
+  }
+
   SECTION("SomeInstancesAreOnLayer") {
     REQUIRE(container.SomeInstancesAreOnLayer("layer1") == true);
     REQUIRE(container.SomeInstancesAreOnLayer("layer2") == true);
     REQUIRE(container.SomeInstancesAreOnLayer("layer3") == false);
     REQUIRE(container.SomeInstancesAreOnLayer("layer5") == false);
   }
+
+  SECTION("Batch operations") {
+    gd::InitialInstancesContainer batchContainer;
+    auto &instance1 = batchContainer.InsertNewInitialInstance();
+    instance1.SetX(10);
+    instance1.SetY(0);
+    instance1.SetZOrder(1);
+    auto &instance2 = batchContainer.InsertNewInitialInstance();
+    instance2.SetX(20);
+    instance2.SetY(30);
+    instance2.SetZOrder(2);
+    std::vector<gd::InitialInstance *> instances = {&instance1};
+
+    batchContainer.MoveInstances(instances, 5, -5, 2);
+    REQUIRE(instance1.GetX() == 15);
+    REQUIRE(instance1.GetY() == -5);
+    REQUIRE(instance1.GetZ() == 2);
+    REQUIRE(instance2.GetX() == 20);
+
+    batchContainer.RotateInstances(instances, 90, 10, -5);
+    REQUIRE(instance1.GetX() == Approx(10));
+    REQUIRE(instance1.GetY() == Approx(0));
+    REQUIRE(instance1.GetAngle() == 90);
+
+    instances.push_back(&instance2);
+    batchContainer.SetInstancesLayer(instances, "layer1");
+    batchContainer.ChangeInstancesZOrder(instances, 3);
+    REQUIRE(instance1.GetLayer() == "layer1");
+    REQUIRE(instance2.GetLayer() == "layer1");
+    REQUIRE(instance1.GetZOrder() == 4);
+    REQUIRE(instance2.GetZOrder() == 5);
+  }
 }
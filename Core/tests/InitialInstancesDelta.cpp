@@ -0,0 +1,78 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/InitialInstancesDelta.h"
+
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("InitialInstancesDelta", "[common][instances]") {
+  gd::InitialInstancesContainer container;
+  auto &instance1 = container.InsertNewInitialInstance();
+  instance1.SetX(10);
+  instance1.SetY(20);
+  instance1.SetLayer("Layer");
+  auto &instance2 = container.InsertNewInitialInstance();
+  instance2.SetX(30);
+  auto &unchangedInstance = container.InsertNewInitialInstance();
+  unchangedInstance.SetX(50);
+
+  gd::InitialInstancesDelta delta;
+  std::vector<gd::InitialInstance *> instances = {
+      &instance1, &instance2, &unchangedInstance};
+  delta.RecordBefore(instances);
+  instances.pop_back();
+  container.MoveInstances(instances, 5, 0);
+  container.SetInstancesLayer(instances, "OtherLayer");
+  instance2.SetLocked(true);
+  delta.RecordAfter();
+
+  SECTION("Only the changed instances and fields are kept") {
+    REQUIRE(delta.GetInstancesCount() == 2);
+
+    gd::SerializerElement element;
+    delta.SerializeTo(element);
+    gd::String json = gd::Serializer::ToJSON(element);
+    REQUIRE(json.find(instance1.GetPersistentUuid()) != gd::String::npos);
+    REQUIRE(json.find(unchangedInstance.GetPersistentUuid()) ==
+            gd::String::npos);
+    REQUIRE(json.find("\"x\":15") != gd::String::npos);
+    REQUIRE(json.find("\"y\"") == gd::String::npos);
+    REQUIRE(json.find("\"layer\":\"OtherLayer\"") != gd::String::npos);
+  }
+
+  SECTION("Changes can be undone and redone") {
+    delta.Undo(container);
+    REQUIRE(instance1.GetX() == 10);
+    REQUIRE(instance1.GetY() == 20);
+    REQUIRE(instance1.GetLayer() == "Layer");
+    REQUIRE(instance2.GetX() == 30);
+    REQUIRE(instance2.IsLocked() == false);
+
+    delta.Redo(container);
+    REQUIRE(instance1.GetX() == 15);
+    REQUIRE(instance1.GetLayer() == "OtherLayer");
+    REQUIRE(instance2.GetLayer() == "OtherLayer");
+    REQUIRE(instance2.IsLocked() == true);
+    REQUIRE(unchangedInstance.GetX() == 50);
+  }
+
+  SECTION("Unserialized changes can be undone") {
+    gd::SerializerElement element;
+    delta.SerializeTo(element);
+    gd::InitialInstancesDelta unserializedDelta;
+    unserializedDelta.UnserializeFrom(
+        gd::Serializer::FromJSON(gd::Serializer::ToJSON(element)));
+    REQUIRE(unserializedDelta.GetInstancesCount() == 2);
+
+    unserializedDelta.Undo(container);
+    REQUIRE(instance1.GetX() == 10);
+    REQUIRE(instance1.GetLayer() == "Layer");
+    REQUIRE(instance2.IsLocked() == false);
+  }
+}
@@ -0,0 +1,132 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/InitialInstancesSpatialIndex.h"
+
+#include <set>
+
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "catch.hpp"
+
+namespace {
+gd::InitialInstance &AddInstance(gd::InitialInstancesContainer &container,
+                                 const gd::String &name,
+                                 double x,
+                                 double y,
+                                 double width = 0,
+                                 double height = 0) {
+  gd::InitialInstance &instance = container.InsertNewInitialInstance();
+  instance.SetObjectName(name);
+  instance.SetX(x);
+  instance.SetY(y);
+  if (width != 0 || height != 0) {
+    instance.SetHasCustomSize(true);
+    instance.SetCustomWidth(width);
+    instance.SetCustomHeight(height);
+  }
+  return instance;
+}
+
+std::set<gd::String> GetNamesInRectangle(
+    const gd::InitialInstancesSpatialIndex &index,
+    double left,
+    double top,
+    double right,
+    double bottom) {
+  std::set<gd::String> names;
+  index.IterateOverInstancesInRectangle(
+      left, top, right, bottom, [&names](gd::InitialInstance &instance) {
+        // Each instance must be given once.
+        REQUIRE(names.insert(instance.GetObjectName()).second);
+        return false;
+      });
+  return names;
+}
+}  // namespace
+
+TEST_CASE("InitialInstancesSpatialIndex", "[common][instances]") {
+  gd::InitialInstancesContainer container;
+  AddInstance(container, "Point", 10, 10);
+  AddInstance(container, "Negative", -300, -40);
+  gd::InitialInstance &big = AddInstance(container, "Big", 100, 100, 600, 300);
+  AddInstance(container, "Huge", -5000, -5000, 10000, 10000);
+  AddInstance(container, "Far", 100000, 100000);
+
+  gd::InitialInstancesSpatialIndex index(100);
+  index.Build(container);
+  REQUIRE(index.GetInstancesCount() == 5);
+
+  SECTION("Rectangle queries") {
+    REQUIRE((GetNamesInRectangle(index, 0, 0, 50, 50) ==
+            std::set<gd::String>{"Point", "Huge"}));
+    REQUIRE((GetNamesInRectangle(index, -310, -50, -290, -30) ==
+            std::set<gd::String>{"Negative", "Huge"}));
+    REQUIRE((GetNamesInRectangle(index, 650, 350, 800, 800) ==
+            std::set<gd::String>{"Big", "Huge"}));
+    REQUIRE((GetNamesInRectangle(index, 99000, 99000, 101000, 101000) ==
+            std::set<gd::String>{"Far"}));
+    REQUIRE(GetNamesInRectangle(index, -1e9, -1e9, 1e9, 1e9).size() == 5);
+  }
+
+  SECTION("Point queries") {
+    std::set<gd::String> names;
+    index.IterateOverInstancesAtPoint(
+        300, 200, [&names](gd::InitialInstance &instance) {
+          names.insert(instance.GetObjectName());
+          return false;
+        });
+    REQUIRE((names == std::set<gd::String>{"Big", "Huge"}));
+  }
+
+  SECTION("Stop the iteration") {
+    std::size_t count = 0;
+    index.IterateOverInstancesInRectangle(
+        -1e9, -1e9, 1e9, 1e9, [&count](gd::InitialInstance &instance) {
+          count++;
+          return true;
+        });
+    REQUIRE(count == 1);
+  }
+
+  SECTION("Iterate over cells") {
+    std::vector<gd::String> cellsAndNames;
+    index.IterateOverCells(
+        [&cellsAndNames](int cellX,
+                         int cellY,
+                         const std::vector<gd::InitialInstance *> &instances) {
+          for (auto *instance : instances) {
+            cellsAndNames.push_back(gd::String::From(cellX) + ";" +
+                                    gd::String::From(cellY) + ";" +
+                                    instance->GetObjectName());
+          }
+        });
+    // Instances covering too many cells ("Huge") are not given.
+    REQUIRE((cellsAndNames == std::vector<gd::String>{"-3;-1;Negative",
+                                                      "0;0;Point",
+                                                      "1;1;Big",
+                                                      "1000;1000;Far"}));
+  }
+
+  SECTION("Update and remove instances") {
+    big.SetX(2000);
+    REQUIRE((GetNamesInRectangle(index, 650, 350, 800, 800) ==
+            std::set<gd::String>{"Big", "Huge"}));
+    index.Update(big);
+    REQUIRE((GetNamesInRectangle(index, 650, 350, 800, 800) ==
+            std::set<gd::String>{"Huge"}));
+    REQUIRE((GetNamesInRectangle(index, 2500, 200, 2500, 200) ==
+            std::set<gd::String>{"Big", "Huge"}));
+
+    index.Remove(big);
+    container.RemoveInstance(big);
+    REQUIRE(index.GetInstancesCount() == 4);
+    REQUIRE((GetNamesInRectangle(index, 2500, 200, 2500, 200) ==
+            std::set<gd::String>{"Huge"}));
+
+    index.Clear();
+    REQUIRE(GetNamesInRectangle(index, -1e9, -1e9, 1e9, 1e9).empty());
+  }
+}
@@ -0,0 +1,69 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
+
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "catch.hpp"
+
+TEST_CASE("InstructionSentenceFormatter", "[common][events]") {
+  gd::InstructionMetadata metadata("MyExtension",
+                                   "MoveObject",
+                                   "Move an object",
+                                   "",
+                                   "Move _PARAM0_ to _PARAM1_;_PARAM2_",
+                                   "",
+                                   "",
+                                   "");
+  metadata.AddParameter("object", "Object")
+      .AddParameter("expression", "X")
+      .AddParameter("expression", "Y");
+
+  gd::Instruction instruction("MyExtension::MoveObject");
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(0, "Player");
+  instruction.SetParameter(1, "10");
+  instruction.SetParameter(2, "20\n+ 1");
+
+  auto *formatter = gd::InstructionSentenceFormatter::Get();
+
+  SECTION("Format the sentence with the parameters") {
+    auto formattedText = formatter->GetAsFormattedText(instruction, metadata);
+    REQUIRE(formattedText.size() == 6);
+    REQUIRE(formattedText[0].first == "Move ");
+    REQUIRE(formattedText[1].first == "Player");
+    REQUIRE(formattedText[1].second.userData == 0);
+    REQUIRE(formattedText[2].first == " to ");
+    REQUIRE(formattedText[3].first == "10");
+    REQUIRE(formattedText[4].first == ";");
+    REQUIRE(formattedText[5].first == "20 + 1");
+    REQUIRE(formattedText[5].second.userData == 2);
+  }
+
+  SECTION("Reuse the parsed sentence for other parameters") {
+    REQUIRE(formatter->GetFullText(instruction, metadata) ==
+            "Move Player to 10;20 + 1");
+
+    instruction.SetParameter(0, "Enemy");
+    REQUIRE(formatter->GetFullText(instruction, metadata) ==
+            "Move Enemy to 10;20 + 1");
+
+    // Another sentence (for example, after changing the language) is parsed.
+    gd::InstructionMetadata translatedMetadata("MyExtension",
+                                               "MoveObject",
+                                               "Déplacer un objet",
+                                               "",
+                                               "Déplacer _PARAM0_ en _PARAM1_",
+                                               "",
+                                               "",
+                                               "");
+    translatedMetadata.AddParameter("object", "Object")
+        .AddParameter("expression", "X")
+        .AddParameter("expression", "Y");
+    REQUIRE(formatter->GetFullText(instruction, translatedMetadata) ==
+            "Déplacer Enemy en 10");
+  }
+}
@@ -0,0 +1,120 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/LayoutSnapshot.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+gd::String SerializeToJSON(const gd::Layout &layout) {
+  gd::SerializerElement element;
+  layout.SerializeTo(element);
+  return gd::Serializer::ToJSON(element);
+}
+}  // namespace
+
+TEST_CASE("LayoutSnapshot", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  layout.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                      "MyObject", 0);
+  auto &instance1 = layout.GetInitialInstances().InsertNewInitialInstance();
+  instance1.SetObjectName("MyObject");
+  instance1.SetX(10);
+  auto &instance2 = layout.GetInitialInstances().InsertNewInitialInstance();
+  instance2.SetObjectName("MyObject");
+  instance2.SetX(20);
+  auto &instance3 = layout.GetInitialInstances().InsertNewInitialInstance();
+  instance3.SetObjectName("MyObject");
+  instance3.SetX(30);
+
+  gd::LayoutSnapshot snapshot1;
+  snapshot1.Take(layout);
+  gd::String json1 = SerializeToJSON(layout);
+
+  SECTION("Unchanged parts are shared") {
+    layout.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                        "MyOtherObject", 1);
+    gd::LayoutSnapshot snapshot2;
+    snapshot2.TakeNext(snapshot1, layout, gd::LayoutSnapshot::Objects);
+
+    REQUIRE_FALSE(
+        snapshot2.IsPartSharedWith(snapshot1, gd::LayoutSnapshot::Objects));
+    REQUIRE(
+        snapshot2.IsPartSharedWith(snapshot1, gd::LayoutSnapshot::Instances));
+    REQUIRE(snapshot2.IsPartSharedWith(snapshot1, gd::LayoutSnapshot::Events));
+    REQUIRE(
+        snapshot2.IsPartSharedWith(snapshot1, gd::LayoutSnapshot::Settings));
+    REQUIRE(snapshot2.GetSharedInstancesCount(snapshot1) == 3);
+  }
+
+  SECTION("Only the changed instances are serialized again") {
+    instance2.SetX(25);
+    auto &instance4 = layout.GetInitialInstances().InsertNewInitialInstance();
+    instance4.SetObjectName("MyObject");
+    gd::String removedUuid = instance3.GetPersistentUuid();
+    layout.GetInitialInstances().RemoveInstance(instance3);
+
+    gd::LayoutSnapshot snapshot2;
+    snapshot2.TakeNext(
+        snapshot1,
+        layout,
+        0,
+        {instance2.GetPersistentUuid(),
+         instance4.GetPersistentUuid(),
+         removedUuid});
+    gd::String json2 = SerializeToJSON(layout);
+
+    REQUIRE_FALSE(
+        snapshot2.IsPartSharedWith(snapshot1, gd::LayoutSnapshot::Instances));
+    REQUIRE(snapshot2.IsPartSharedWith(snapshot1, gd::LayoutSnapshot::Objects));
+    REQUIRE(snapshot2.GetSharedInstancesCount(snapshot1) == 1);
+
+    // Changing the same instance again reuses the snapshot of the others.
+    instance2.SetX(26);
+    gd::LayoutSnapshot snapshot3;
+    snapshot3.TakeNext(
+        snapshot2, layout, 0, {instance2.GetPersistentUuid()});
+    REQUIRE(snapshot3.GetSharedInstancesCount(snapshot2) == 2);
+
+    snapshot1.RestoreTo(project, layout);
+    REQUIRE(SerializeToJSON(layout) == json1);
+    snapshot2.RestoreTo(project, layout);
+    REQUIRE(SerializeToJSON(layout) == json2);
+  }
+
+  SECTION("Layouts can be restored") {
+    layout.SetWindowDefaultTitle("New title");
+    layout.GetObjects().RemoveObject("MyObject");
+    layout.GetInitialInstances().RemoveInitialInstancesOfObject("MyObject");
+    gd::LayoutSnapshot snapshot2;
+    snapshot2.TakeNext(
+        snapshot1,
+        layout,
+        gd::LayoutSnapshot::Settings | gd::LayoutSnapshot::Objects |
+            gd::LayoutSnapshot::Instances);
+    gd::String json2 = SerializeToJSON(layout);
+    REQUIRE(json2 != json1);
+
+    snapshot1.RestoreTo(project, layout);
+    REQUIRE(SerializeToJSON(layout) == json1);
+    REQUIRE(layout.GetObjects().HasObjectNamed("MyObject"));
+    REQUIRE(layout.GetInitialInstances().GetInstancesCount() == 3);
+
+    snapshot2.RestoreTo(project, layout);
+    REQUIRE(SerializeToJSON(layout) == json2);
+  }
+}
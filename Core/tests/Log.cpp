@@ -0,0 +1,74 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Log.h"
+
+#include <vector>
+
+#include "catch.hpp"
+
+TEST_CASE("LogSink", "[common]") {
+  std::vector<gd::String> loggedMessages;
+  gd::LogSink::SetHandler(
+      [&loggedMessages](gd::LogSink::Level level, const gd::String &msg) {
+        loggedMessages.push_back(gd::LogSink::GetLevelPrefix(level) + msg);
+      });
+
+  SECTION("Messages are sent to the handler") {
+    gd::LogWarning("Warning 1");
+    gd::LogError("Error 1");
+    gd::LogStatus("Status 1");
+
+    std::vector<gd::String> expectedMessages = {
+        "WARNING: Warning 1", "ERROR: Error 1", "STATUS: Status 1"};
+    REQUIRE(loggedMessages == expectedMessages);
+  }
+
+  SECTION("Messages below the minimum level are ignored") {
+    gd::LogSink::SetMinimumLevel(gd::LogSink::Warning);
+    gd::LogStatus("Status 1");
+    gd::LogMessage("Message 1");
+    gd::LogWarning("Warning 1");
+    gd::LogFatalError("Fatal error 1");
+    gd::LogSink::SetMinimumLevel(gd::LogSink::Status);
+
+    std::vector<gd::String> expectedMessages = {
+        "WARNING: Warning 1", "FATAL ERROR: Fatal error 1"};
+    REQUIRE(loggedMessages == expectedMessages);
+  }
+
+  SECTION("Repeated messages are logged once") {
+    for (int i = 0; i < 1000; i++) gd::LogWarning("Child not found");
+    gd::LogError("Child not found");
+    gd::LogError("Other error");
+    gd::LogError("Other error");
+    gd::LogSink::Flush();
+
+    std::vector<gd::String> expectedMessages = {
+        "WARNING: Child not found",
+        "WARNING: (previous message repeated 999 more times)",
+        "ERROR: Child not found",
+        "ERROR: Other error",
+        "ERROR: (previous message repeated 1 more times)"};
+    REQUIRE(loggedMessages == expectedMessages);
+  }
+
+  SECTION("Messages over the limit per second are dropped, except errors") {
+    gd::LogSink::SetMaximumMessagesPerSecond(3);
+    for (int i = 0; i < 10; i++) gd::LogWarning("Warning " + gd::String::From(i));
+    gd::LogError("Error 1");
+    gd::LogSink::Flush();
+    gd::LogSink::SetMaximumMessagesPerSecond(0);
+
+    REQUIRE(loggedMessages.size() == 5);
+    REQUIRE(loggedMessages[2] == "WARNING: Warning 2");
+    REQUIRE(loggedMessages[3] == "ERROR: Error 1");
+    REQUIRE(loggedMessages[4] ==
+            "WARNING: 7 messages were not logged because too many messages "
+            "were logged in a second.");
+  }
+
+  gd::LogSink::SetHandler(nullptr);
+}
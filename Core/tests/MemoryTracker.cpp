@@ -0,0 +1,64 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/MemoryTracker.h"
+
+#include <vector>
+
+#include "catch.hpp"
+
+TEST_CASE("MemoryTracker", "[common]") {
+  SECTION("Scopes can be nested") {
+    REQUIRE(gd::MemoryTracker::GetCurrentSubsystem() ==
+            gd::MemoryTracker::Other);
+    {
+      gd::MemoryTracker::Scope projectScope(gd::MemoryTracker::ProjectModel);
+      REQUIRE(gd::MemoryTracker::GetCurrentSubsystem() ==
+              gd::MemoryTracker::ProjectModel);
+      {
+        gd::MemoryTracker::Scope eventsScope(gd::MemoryTracker::Events);
+        REQUIRE(gd::MemoryTracker::GetCurrentSubsystem() ==
+                gd::MemoryTracker::Events);
+      }
+      REQUIRE(gd::MemoryTracker::GetCurrentSubsystem() ==
+              gd::MemoryTracker::ProjectModel);
+    }
+    REQUIRE(gd::MemoryTracker::GetCurrentSubsystem() ==
+            gd::MemoryTracker::Other);
+  }
+
+  SECTION("Allocations are given back to the subsystem allocating them") {
+    std::size_t allocatedBytes =
+        gd::MemoryTracker::GetAllocatedBytes(gd::MemoryTracker::Metadata);
+
+    std::vector<char> *buffer = nullptr;
+    {
+      gd::MemoryTracker::Scope scope(gd::MemoryTracker::Metadata);
+      buffer = new std::vector<char>(4096);
+    }
+    if (gd::MemoryTracker::IsEnabled()) {
+      REQUIRE(gd::MemoryTracker::GetAllocatedBytes(
+                  gd::MemoryTracker::Metadata) >= allocatedBytes + 4096);
+      REQUIRE(gd::MemoryTracker::GetPeakAllocatedBytes(
+                  gd::MemoryTracker::Metadata) >= allocatedBytes + 4096);
+    } else {
+      REQUIRE(gd::MemoryTracker::GetAllocatedBytes(
+                  gd::MemoryTracker::Metadata) == 0);
+    }
+
+    {
+      gd::MemoryTracker::Scope scope(gd::MemoryTracker::Events);
+      delete buffer;
+    }
+    REQUIRE(gd::MemoryTracker::GetAllocatedBytes(gd::MemoryTracker::Metadata) ==
+            allocatedBytes);
+  }
+
+  SECTION("Measures are reported as JSON") {
+    gd::String json = gd::MemoryTracker::ToJSON();
+    REQUIRE(json.find("\"metadata\"") != gd::String::npos);
+    REQUIRE(json.find("\"allocatedBytes\"") != gd::String::npos);
+  }
+}
@@ -0,0 +1,251 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering gd::MetadataProvider.
+ */
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Metadata/PlatformMetadataIndex.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("MetadataProvider", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  SECTION("Finds metadata of instructions and expressions") {
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "MyExtension::DoSomething")
+                .GetFullName() == "Do something");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform, "Unknown")));
+
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetExpressionMetadata(platform,
+                                                    "MyExtension::GetNumber")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetObjectNumber")));
+    // Expressions of the base object are found for any object.
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetFromBaseExpression")));
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "Unknown")));
+  }
+
+  SECTION("Finds metadata of extensions added after a lookup") {
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "MyNewExtension::DoNewThing")));
+
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(
+        "MyNewExtension", "My new extension", "", "", "");
+    extension
+        ->AddAction("DoNewThing", "Do a new thing", "", "", "", "", "")
+        .SetFunctionName("doNewThing");
+    platform.AddExtension(extension);
+
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "MyNewExtension::DoNewThing")
+                .GetFullName() == "Do a new thing");
+
+    platform.RemoveExtension("MyNewExtension");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "MyNewExtension::DoNewThing")));
+  }
+
+  SECTION("Finds metadata of extensions updated after a lookup") {
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(
+        "MyNewExtension", "My new extension", "", "", "");
+    extension
+        ->AddAction("DoNewThing", "Do a new thing", "", "", "", "", "")
+        .SetFunctionName("doNewThing");
+    platform.AddExtension(extension);
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "MyNewExtension::DoNewThing")
+                .GetFullName() == "Do a new thing");
+
+    auto extensionToUpdate = platform.GetExtensionToUpdate("MyNewExtension");
+    REQUIRE(extensionToUpdate != nullptr);
+    REQUIRE(extensionToUpdate != extension);
+    extensionToUpdate->RemoveInstructionsAndExpressions("DoNewThing");
+    extensionToUpdate
+        ->AddAction("DoNewThing", "Do a modified thing", "", "", "", "", "")
+        .SetFunctionName("doNewThing");
+    platform.NotifyExtensionChanged("MyNewExtension");
+
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "MyNewExtension::DoNewThing")
+                .GetFullName() == "Do a modified thing");
+    // The extension added before is not modified.
+    REQUIRE(extension->GetAllActions()["MyNewExtension::DoNewThing"]
+                .GetFullName() == "Do a new thing");
+    REQUIRE(platform.GetAllPlatformExtensions().back() == extensionToUpdate);
+    REQUIRE(platform.GetExtensionToUpdate("Unknown") == nullptr);
+
+    platform.RemoveExtension("MyNewExtension");
+  }
+
+  SECTION("Finds events") {
+    const auto *standardEventEntry =
+        platform.GetMetadataIndex().FindEvent("BuiltinCommonInstructions::Standard");
+    REQUIRE(standardEventEntry != nullptr);
+    REQUIRE(standardEventEntry->extension->GetName() ==
+            "BuiltinCommonInstructions");
+    REQUIRE(platform.GetMetadataIndex().FindEvent("Unknown") == nullptr);
+    REQUIRE(platform.CreateEvent("BuiltinCommonInstructions::Standard")
+                ->GetType() == "BuiltinCommonInstructions::Standard");
+    REQUIRE(platform.CreateEvent("Unknown") == nullptr);
+
+    // Events are found in the extension named like their namespace first,
+    // then in the first extension declaring them.
+    for (const gd::String &name : {"MyNewExtension", "MyOtherExtension"}) {
+      std::shared_ptr<gd::PlatformExtension> extension =
+          std::make_shared<gd::PlatformExtension>();
+      extension->SetExtensionInformation(name, name, "", "", "");
+      for (const gd::String &eventType :
+           {"BuiltinCommonInstructions::Standard", "Unknown::MyEvent"}) {
+        extension->GetAllEvents()[eventType] = gd::EventMetadata(
+            eventType, "", "", "", "", std::make_shared<gd::StandardEvent>());
+      }
+      platform.AddExtension(extension);
+    }
+    REQUIRE(platform.GetMetadataIndex()
+                .FindEvent("BuiltinCommonInstructions::Standard")
+                ->extension->GetName() == "BuiltinCommonInstructions");
+    REQUIRE(platform.GetMetadataIndex()
+                .FindEvent("Unknown::MyEvent")
+                ->extension->GetName() == "MyNewExtension");
+    REQUIRE(platform.CreateEvent("Unknown::MyEvent") != nullptr);
+
+    platform.RemoveExtension("MyNewExtension");
+    platform.RemoveExtension("MyOtherExtension");
+    REQUIRE(platform.CreateEvent("Unknown::MyEvent") == nullptr);
+  }
+
+  SECTION("Finds expressions starting with a prefix") {
+    const auto &metadataIndex = platform.GetMetadataIndex();
+    std::vector<gd::String> expressionTypes;
+    auto addExpressionType =
+        [&expressionTypes](
+            const gd::String &expressionType,
+            const gd::PlatformMetadataIndex::Entry<gd::ExpressionMetadata>
+                &entry) { expressionTypes.push_back(expressionType); };
+
+    metadataIndex.ForEachExpressionWithPrefix(
+        "myextension::GETNUMBER", false, addExpressionType);
+    REQUIRE((expressionTypes == std::vector<gd::String>{
+                                    "MyExtension::GetNumber",
+                                    "MyExtension::GetNumberWith2Params",
+                                    "MyExtension::GetNumberWith3Params"}));
+
+    expressionTypes.clear();
+    metadataIndex.ForEachExpressionWithPrefix(
+        "MyExtension::GetNumber", true, addExpressionType);
+    REQUIRE(expressionTypes.empty());
+
+    // Expressions of the object are given before the ones of the base object.
+    expressionTypes.clear();
+    metadataIndex.ForEachObjectExpressionWithPrefix(
+        "MyExtension::Sprite", "Get", false, addExpressionType);
+    REQUIRE(expressionTypes.size() >= 3);
+    REQUIRE(expressionTypes[0] == "GetObjectNumber");
+    REQUIRE(expressionTypes[1] == "GetObjectVariableAsNumber");
+    REQUIRE(std::find(expressionTypes.begin() + 2,
+                      expressionTypes.end(),
+                      "GetFromBaseExpression") != expressionTypes.end());
+  }
+
+  SECTION("Creates lazy extensions only when they are needed") {
+    int creationsCount = 0;
+    auto createExtension = [&creationsCount]() {
+      creationsCount++;
+      std::shared_ptr<gd::PlatformExtension> extension =
+          std::make_shared<gd::PlatformExtension>();
+      extension->SetExtensionInformation(
+          "MyLazyExtension", "My lazy extension", "", "", "");
+      extension->AddObject<gd::ObjectConfiguration>(
+          "LazyObject", "Lazy object", "", "");
+      extension
+          ->AddAction("DoLazyThing", "Do a lazy thing", "", "", "", "", "")
+          .SetFunctionName("doLazyThing");
+      return extension;
+    };
+
+    // Got by its name.
+    platform.AddLazyExtension("MyLazyExtension", {}, createExtension);
+    REQUIRE(creationsCount == 0);
+    REQUIRE(platform.IsExtensionLoaded("MyLazyExtension"));
+    REQUIRE(creationsCount == 0);
+    REQUIRE(platform.GetExtension("MyLazyExtension") != nullptr);
+    REQUIRE(creationsCount == 1);
+    REQUIRE(platform.GetExtension("MyLazyExtension") != nullptr);
+    REQUIRE(creationsCount == 1);
+
+    // Created with one of its objects.
+    platform.AddLazyExtension(
+        "MyLazyExtension", {"MyLazyExtension::LazyObject"}, createExtension);
+    REQUIRE(creationsCount == 1);
+    REQUIRE(platform.CreateObjectConfiguration("MyLazyExtension::LazyObject")
+                ->GetType() == "MyLazyExtension::LazyObject");
+    REQUIRE(creationsCount == 2);
+
+    // Created when metadata are looked up.
+    platform.AddLazyExtension("MyLazyExtension", {}, createExtension);
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "MyLazyExtension::DoLazyThing")
+                .GetFullName() == "Do a lazy thing");
+    REQUIRE(creationsCount == 3);
+
+    // Kept in the order they were added, even if created later.
+    platform.AddLazyExtension("MyLazyExtension", {}, createExtension);
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(
+        "MyNewExtension", "My new extension", "", "", "");
+    platform.AddExtension(extension);
+    REQUIRE(platform.GetExtension("MyLazyExtension") != nullptr);
+    const auto &extensions = platform.GetAllPlatformExtensions();
+    REQUIRE(extensions.size() >= 2);
+    REQUIRE(extensions[extensions.size() - 2]->GetName() == "MyLazyExtension");
+    REQUIRE(extensions.back()->GetName() == "MyNewExtension");
+
+    platform.RemoveExtension("MyNewExtension");
+    platform.RemoveExtension("MyLazyExtension");
+    REQUIRE(!platform.IsExtensionLoaded("MyLazyExtension"));
+
+    // Created before the platform is used by tasks running in parallel.
+    platform.AddLazyExtension("MyLazyExtension", {}, createExtension);
+    REQUIRE(creationsCount == 4);
+    platform.PrepareForConcurrentUse();
+    REQUIRE(creationsCount == 5);
+    REQUIRE(platform.GetMetadataIndex().FindAction(
+                "MyLazyExtension::DoLazyThing") != nullptr);
+    REQUIRE(creationsCount == 5);
+    platform.RemoveExtension("MyLazyExtension");
+  }
+}
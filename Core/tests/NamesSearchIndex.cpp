@@ -0,0 +1,57 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/NamesSearchIndex.h"
+
+#include <vector>
+
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "catch.hpp"
+
+TEST_CASE("NamesSearchIndex", "[common]") {
+  SECTION("Find the names containing a search, ignoring the case") {
+    gd::NamesSearchIndex index;
+    index.Add("PlayerScore");
+    index.Add("playerLives");
+    index.Add("EnemyCount");
+    index.Add(u8"Straße");
+
+    REQUIRE(index.GetNamesCount() == 4);
+    REQUIRE((index.GetNamesMatchingSearch("player") ==
+             std::vector<gd::String>{"PlayerScore", "playerLives"}));
+    REQUIRE((index.GetNamesMatchingSearch("COUNT") ==
+             std::vector<gd::String>{"EnemyCount"}));
+    REQUIRE((index.GetNamesMatchingSearch("STRASSE") ==
+             std::vector<gd::String>{u8"Straße"}));
+    REQUIRE(index.GetNamesMatchingSearch("Missing").empty());
+    REQUIRE(index.GetNamesMatchingSearch("").size() == 4);
+
+    std::vector<std::size_t> indices;
+    index.ForEachNameMatchingSearch(
+        "e", [&indices](std::size_t index, const gd::String &name) {
+          indices.push_back(index);
+        });
+    REQUIRE((indices == std::vector<std::size_t>{0, 1, 2, 3}));
+
+    index.Clear();
+    REQUIRE(index.GetNamesCount() == 0);
+  }
+
+  SECTION("Index variables and resources") {
+    gd::VariablesContainer variables;
+    variables.InsertNew("MyVariable");
+    variables.InsertNew("OtherVariable");
+    gd::ResourcesManager resourcesManager;
+    resourcesManager.AddResource("MyImage", "image.png", "image");
+
+    gd::NamesSearchIndex index;
+    index.AddVariables(variables);
+    index.AddResources(resourcesManager);
+    REQUIRE((index.GetNamesMatchingSearch("my") ==
+             std::vector<gd::String>{"MyVariable", "MyImage"}));
+    REQUIRE(index.GetNameAt(1) == "OtherVariable");
+  }
+}
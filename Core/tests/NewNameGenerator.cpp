@@ -7,6 +7,10 @@
  * @file Tests covering common features of GDevelop Core.
  */
 #include "GDCore/IDE/NewNameGenerator.h"
+
+#include <algorithm>
+#include <vector>
+
 #include "GDCore/String.h"
 #include "catch.hpp"
 
@@ -29,4 +33,33 @@ TEST_CASE("NewNameGenerator", "[common]") {
                          name == "abcTest2";
                 }) == "abcTest3");
   }
+  SECTION("Generate many names") {
+    std::vector<gd::String> noUsedNames;
+    std::vector<gd::String> expectedNames = {"Enemy", "Enemy2", "Enemy3"};
+    REQUIRE(gd::NewNameGenerator::GenerateMany("Enemy", 3, noUsedNames) ==
+            expectedNames);
+    REQUIRE(gd::NewNameGenerator::GenerateMany("Enemy", 0, noUsedNames)
+                .empty());
+
+    std::vector<gd::String> usedNames = {
+        "Enemy", "Enemy3", "Enemy03", "Enemy4a", "Player2", "Enemy"};
+    expectedNames = {"Enemy2", "Enemy4", "Enemy5", "Enemy6"};
+    REQUIRE(gd::NewNameGenerator::GenerateMany("Enemy", 4, usedNames) ==
+            expectedNames);
+  }
+  SECTION("Generate many names like generating them one by one") {
+    std::vector<gd::String> usedNames = {"Enemy2", "Enemy", "Enemy5", "Enem"};
+    std::vector<gd::String> names =
+        gd::NewNameGenerator::GenerateMany("Enemy", 5, usedNames);
+
+    for (std::size_t i = 0; i < names.size(); ++i) {
+      gd::String name = gd::NewNameGenerator::Generate(
+          "Enemy", [&usedNames](const gd::String &name) {
+            return std::find(usedNames.begin(), usedNames.end(), name) !=
+                   usedNames.end();
+          });
+      REQUIRE(name == names[i]);
+      usedNames.push_back(name);
+    }
+  }
 }
@@ -42,4 +42,32 @@ TEST_CASE("Object", "[common]") {
     REQUIRE(object.HasBehaviorNamed("Effect"));
     REQUIRE(object.GetBehavior("Effect").IsDefaultBehavior());
   }
+
+  SECTION("Serialize the size of the pool of instances") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    gd::Object &object = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    REQUIRE(object.GetInstancesPoolSize() == 0);
+
+    gd::SerializerElement defaultElement;
+    object.SerializeTo(defaultElement);
+    REQUIRE(!defaultElement.HasAttribute("instancesPoolSize"));
+
+    object.SetInstancesPoolSize(500);
+    gd::SerializerElement element;
+    object.SerializeTo(element);
+    REQUIRE(element.GetIntAttribute("instancesPoolSize") == 500);
+
+    gd::Object &otherObject = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyOtherObject", 1);
+    otherObject.UnserializeFrom(project, element);
+    REQUIRE(otherObject.GetInstancesPoolSize() == 500);
+
+    gd::Object copiedObject(object);
+    REQUIRE(copiedObject.GetInstancesPoolSize() == 500);
+  }
 }
\ No newline at end of file
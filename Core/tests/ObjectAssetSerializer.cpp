@@ -271,4 +271,62 @@ TEST_CASE("ObjectAssetSerializer", "[common]") {
     auto &spriteElement = spritesElement.GetChild(0);
     REQUIRE(spriteElement.GetStringAttribute("image") == "assets/Idle.png");
   }
+
+  SECTION("Can serialize objects as assets of a pack") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &eventsExtension =
+        project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    auto &eventsBasedObject = eventsExtension.GetEventsBasedObjects().InsertNew(
+        "MyEventsBasedObject", 0);
+    auto &childObject = eventsBasedObject.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyChild", 0);
+    eventsBasedObject.GetInitialInstances()
+        .InsertNewInitialInstance()
+        .SetObjectName("MyChild");
+
+    auto &resourceManager = project.GetResourcesManager();
+    gd::ImageResource imageResource;
+    imageResource.SetName("assets/Idle.png");
+    imageResource.SetFile("assets/Idle.png");
+    resourceManager.AddResource(imageResource);
+
+    auto *spriteConfiguration =
+        dynamic_cast<gd::SpriteObject *>(&childObject.GetConfiguration());
+    REQUIRE(spriteConfiguration != nullptr);
+    {
+      gd::Animation animation;
+      animation.SetName("Idle");
+      animation.SetDirectionsCount(1);
+      gd::Sprite frame;
+      frame.SetImageName("assets/Idle.png");
+      animation.GetDirection(0).AddSprite(frame);
+      spriteConfiguration->GetAnimations().AddAnimation(animation);
+    }
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    gd::Object &object1 = layout.GetObjects().InsertNewObject(
+        project, "MyEventsExtension::MyEventsBasedObject", "MyObject1", 0);
+    gd::Object &object2 = layout.GetObjects().InsertNewObject(
+        project, "MyEventsExtension::MyEventsBasedObject", "MyObject2", 1);
+
+    // The assets of the pack are the same as the ones serialized alone, even
+    // if the resource and the variant are only serialized once.
+    gd::ObjectAssetsPackSerializer packSerializer(project);
+    for (gd::Object *object : {&object1, &object2}) {
+      std::vector<gd::String> usedResourceNames;
+      gd::String json = packSerializer.SerializeAssetToJSON(
+          *object, "My Object", usedResourceNames);
+      REQUIRE(usedResourceNames.size() == 1);
+      REQUIRE(usedResourceNames[0] == "assets/Idle.png");
+
+      SerializerElement assetElement;
+      std::vector<gd::String> expectedUsedResourceNames;
+      ObjectAssetSerializer::SerializeTo(project, *object, "My Object",
+                                         assetElement,
+                                         expectedUsedResourceNames);
+      REQUIRE(json == gd::Serializer::ToJSON(assetElement));
+    }
+  }
 }
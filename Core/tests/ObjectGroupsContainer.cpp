@@ -0,0 +1,87 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/ObjectGroupsContainer.h"
+
+#include <vector>
+
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("ObjectGroupsContainer", "[common]") {
+  gd::ObjectGroupsContainer groups;
+  gd::ObjectGroup &enemies = groups.InsertNew("Enemies");
+  enemies.AddObject("Bat");
+  enemies.AddObject("Ghost");
+  gd::ObjectGroup &flying = groups.InsertNew("Flying");
+  flying.AddObject("Bat");
+
+  SECTION("Find the groups containing an object") {
+    REQUIRE(groups.IsObjectInAnyGroup("Bat"));
+    REQUIRE_FALSE(groups.IsObjectInAnyGroup("Player"));
+    REQUIRE(groups.IsObjectInGroup("Ghost", "Enemies"));
+    REQUIRE_FALSE(groups.IsObjectInGroup("Ghost", "Flying"));
+    REQUIRE((groups.GetGroupsContainingObject("Bat") ==
+             std::vector<gd::String>{"Enemies", "Flying"}));
+    REQUIRE(groups.GetGroupsContainingObject("Player").empty());
+    REQUIRE(flying.Find("Bat"));
+    REQUIRE_FALSE(flying.Find("Ghost"));
+  }
+
+  SECTION("Keep up to date when groups are changed") {
+    flying.AddObject("Ghost");
+    enemies.RemoveObject("Bat");
+    REQUIRE((groups.GetGroupsContainingObject("Ghost") ==
+             std::vector<gd::String>{"Enemies", "Flying"}));
+    REQUIRE((groups.GetGroupsContainingObject("Bat") ==
+             std::vector<gd::String>{"Flying"}));
+
+    groups.Rename("Flying", "Flyers");
+    REQUIRE(groups.IsObjectInGroup("Bat", "Flyers"));
+
+    groups.Remove("Flyers");
+    REQUIRE_FALSE(groups.IsObjectInAnyGroup("Bat"));
+    REQUIRE((groups.GetGroupsContainingObject("Ghost") ==
+             std::vector<gd::String>{"Enemies"}));
+
+    gd::ObjectGroup otherGroup;
+    otherGroup.SetName("Enemies");
+    otherGroup.AddObject("Player");
+    groups.Get("Enemies") = otherGroup;
+    REQUIRE_FALSE(groups.IsObjectInAnyGroup("Ghost"));
+    REQUIRE(groups.IsObjectInGroup("Player", "Enemies"));
+  }
+
+  SECTION("Rename and remove an object in all groups") {
+    enemies.AddObject("Vampire");
+    groups.RenameObjectInGroups("Bat", "Vampire");
+    REQUIRE_FALSE(groups.IsObjectInAnyGroup("Bat"));
+    REQUIRE((groups.GetGroupsContainingObject("Vampire") ==
+             std::vector<gd::String>{"Enemies", "Flying"}));
+    REQUIRE(flying.GetAllObjectsNames() == std::vector<gd::String>{"Vampire"});
+
+    groups.RemoveObjectFromGroups("Vampire");
+    REQUIRE_FALSE(groups.IsObjectInAnyGroup("Vampire"));
+    REQUIRE(enemies.GetAllObjectsNames() == std::vector<gd::String>{"Ghost"});
+    REQUIRE(flying.GetAllObjectsNames().empty());
+  }
+
+  SECTION("Find the groups after a copy or an unserialization") {
+    gd::ObjectGroupsContainer copiedGroups = groups;
+    enemies.RemoveObject("Bat");
+    REQUIRE((copiedGroups.GetGroupsContainingObject("Bat") ==
+             std::vector<gd::String>{"Enemies", "Flying"}));
+
+    gd::SerializerElement element;
+    copiedGroups.SerializeTo(element);
+    gd::ObjectGroupsContainer unserializedGroups;
+    unserializedGroups.UnserializeFrom(element);
+    REQUIRE((unserializedGroups.GetGroupsContainingObject("Bat") ==
+             std::vector<gd::String>{"Enemies", "Flying"}));
+    unserializedGroups.Clear();
+    REQUIRE_FALSE(unserializedGroups.IsObjectInAnyGroup("Bat"));
+  }
+}
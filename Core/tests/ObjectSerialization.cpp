@@ -226,6 +226,37 @@ TEST_CASE("ObjectSerialization", "[common]") {
     CheckCustomObjectConfiguration(*(clonedObject.get()));
   }
 
+  SECTION("Clone a custom object without copying its children until modified") {
+    gd::Platform platform;
+    gd::Project project;
+    auto &object = SetupProjectWithCustomObject(project, platform);
+    const auto &configuration =
+        dynamic_cast<const gd::CustomObjectConfiguration &>(
+            object.GetConfiguration());
+
+    auto clonedObject = object.Clone();
+    auto &clonedConfiguration =
+        dynamic_cast<gd::CustomObjectConfiguration &>(
+            clonedObject->GetConfiguration());
+    const auto &constClonedConfiguration = clonedConfiguration;
+    REQUIRE(&constClonedConfiguration.GetChildObjectConfiguration("MyChild") ==
+            &configuration.GetChildObjectConfiguration("MyChild"));
+
+    // The child configuration is copied when it can be modified.
+    auto &clonedSpriteConfiguration =
+        clonedConfiguration.GetChildObjectConfiguration("MyChild");
+    REQUIRE(&clonedSpriteConfiguration !=
+            &configuration.GetChildObjectConfiguration("MyChild"));
+    dynamic_cast<gd::SpriteObject &>(clonedSpriteConfiguration)
+        .GetAnimations()
+        .RemoveAllAnimations();
+    CheckCustomObjectConfiguration(object);
+    REQUIRE(dynamic_cast<gd::SpriteObject &>(
+                clonedConfiguration.GetChildObjectConfiguration("MyChild"))
+                .GetAnimations()
+                .GetAnimationsCount() == 0);
+  }
+
   SECTION("Exclude default behaviors from serialization") {
     gd::Platform platform;
     gd::Project project;
@@ -0,0 +1,141 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/ObjectsContainer.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectFolderOrObject.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("ObjectsContainer", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  gd::ObjectsContainer container(gd::ObjectsContainer::SourceType::Scene);
+  container.InsertNewObject(project, "MyExtension::Sprite", "Object1", 0);
+  container.InsertNewObject(project, "MyExtension::Sprite", "Object2", 1);
+  container.InsertNewObject(project, "MyExtension::Sprite", "Object3", 2);
+
+  SECTION("Find objects by name") {
+    REQUIRE(container.HasObjectNamed("Object1"));
+    REQUIRE(container.HasObjectNamed("Object3"));
+    REQUIRE_FALSE(container.HasObjectNamed("MissingObject"));
+    REQUIRE(container.GetObjectPosition("Object2") == 1);
+    REQUIRE(container.GetObjectPosition("MissingObject") == gd::String::npos);
+    REQUIRE(container.GetObject("Object3").GetName() == "Object3");
+  }
+
+  SECTION("Find objects after they are inserted, moved or removed") {
+    container.InsertNewObject(project, "MyExtension::Sprite", "Object0", 0);
+    REQUIRE(container.GetObjectPosition("Object0") == 0);
+    REQUIRE(container.GetObjectPosition("Object3") == 3);
+
+    container.InsertObject(container.GetObject("Object1"), 1);
+    REQUIRE(container.GetObjectPosition("Object1") == 1);
+
+    container.MoveObject(0, 4);
+    REQUIRE(container.GetObjectPosition("Object0") == 4);
+    REQUIRE(container.GetObjectPosition("Object2") == 2);
+
+    container.RemoveObject("Object2");
+    REQUIRE_FALSE(container.HasObjectNamed("Object2"));
+    REQUIRE(container.GetObjectPosition("Object3") == 2);
+    REQUIRE(container.GetObjectPosition("Object0") == 3);
+
+    container.InsertNewObject(
+        project, "MyExtension::Sprite", "Object4", gd::String::npos);
+    REQUIRE(container.GetObjectPosition("Object4") == 4);
+    REQUIRE(container.GetObjectPosition("Object0") == 3);
+
+    container.RemoveObject("Object4");
+    REQUIRE_FALSE(container.HasObjectNamed("Object4"));
+    REQUIRE(container.GetObjectPosition("Object0") == 3);
+  }
+
+  SECTION("Find objects after they are renamed") {
+    container.GetObject("Object2").SetName("RenamedObject");
+    REQUIRE_FALSE(container.HasObjectNamed("Object2"));
+    REQUIRE(container.GetObjectPosition("RenamedObject") == 1);
+
+    gd::SerializerElement element;
+    container.GetObject("Object3").SerializeTo(element);
+    element.SetAttribute("name", "UnserializedObject");
+    container.GetObject("Object3").UnserializeFrom(project, element);
+    REQUIRE_FALSE(container.HasObjectNamed("Object3"));
+    REQUIRE(container.GetObjectPosition("UnserializedObject") == 2);
+
+    gd::Object copiedObject = container.GetObject(0);
+    copiedObject.SetName("CopiedObject");
+    REQUIRE_FALSE(container.HasObjectNamed("CopiedObject"));
+    REQUIRE(container.GetObjectPosition("Object1") == 0);
+  }
+
+  SECTION("Find the first of the objects with the same name") {
+    container.GetObject("Object3").SetName("Object1");
+    REQUIRE(container.GetObjectPosition("Object1") == 0);
+
+    container.GetObject(0).SetName("Object0");
+    REQUIRE(container.GetObjectPosition("Object0") == 0);
+    REQUIRE(container.GetObjectPosition("Object1") == 2);
+
+    container.InsertObject(container.GetObject("Object2"), 0);
+    REQUIRE(container.GetObjectPosition("Object2") == 0);
+    REQUIRE(container.GetObjectPosition("Object1") == 3);
+
+    container.RemoveObject("Object2");
+    REQUIRE(container.GetObjectPosition("Object2") == 1);
+    REQUIRE(container.GetObjectPosition("Object1") == 2);
+
+    container.MoveObject(1, 0);
+    REQUIRE(container.GetObjectPosition("Object2") == 0);
+    REQUIRE(container.GetObjectPosition("Object0") == 1);
+  }
+
+  SECTION("Find objects after a copy or an unserialization") {
+    gd::ObjectsContainer copiedContainer = container;
+    REQUIRE(copiedContainer.GetObjectPosition("Object3") == 2);
+
+    gd::SerializerElement element;
+    container.SerializeObjectsTo(element);
+    gd::ObjectsContainer unserializedContainer(
+        gd::ObjectsContainer::SourceType::Scene);
+    unserializedContainer.UnserializeObjectsFrom(project, element);
+    REQUIRE(unserializedContainer.GetObjectPosition("Object2") == 1);
+
+    container.Clear();
+    REQUIRE_FALSE(container.HasObjectNamed("Object1"));
+  }
+
+  SECTION("Copy the objects folders") {
+    gd::ObjectFolderOrObject &rootFolder = container.GetRootFolder();
+    gd::ObjectFolderOrObject &folder = rootFolder.InsertNewFolder("Folder", 0);
+    folder.SetQuickCustomizationVisibility(
+        gd::QuickCustomization::Visibility::Hidden);
+    rootFolder.MoveObjectFolderOrObjectToAnotherFolder(
+        rootFolder.GetObjectNamed("Object2"), folder, 0);
+
+    gd::ObjectsContainer copiedContainer = container;
+    gd::ObjectFolderOrObject &copiedRootFolder =
+        copiedContainer.GetRootFolder();
+    REQUIRE(copiedRootFolder.GetChildrenCount() == 3);
+    gd::ObjectFolderOrObject &copiedFolder = copiedRootFolder.GetChildAt(0);
+    REQUIRE(copiedFolder.GetFolderName() == "Folder");
+    REQUIRE(copiedFolder.GetQuickCustomizationVisibility() ==
+            gd::QuickCustomization::Visibility::Hidden);
+    REQUIRE(copiedFolder.GetChildrenCount() == 1);
+    REQUIRE(&copiedFolder.GetChildAt(0).GetObject() ==
+            &copiedContainer.GetObject("Object2"));
+    REQUIRE(&copiedRootFolder.GetChildAt(1).GetObject() ==
+            &copiedContainer.GetObject("Object1"));
+    REQUIRE(&copiedRootFolder.GetChildAt(2).GetObject() ==
+            &copiedContainer.GetObject("Object3"));
+  }
+}
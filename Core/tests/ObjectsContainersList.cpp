@@ -16,6 +16,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/TasksRunner.h"
 #include "catch.hpp"
 
 #include <algorithm>
@@ -486,3 +487,119 @@ TEST_CASE("ObjectContainersList (GetAnimationNamesOfObject)", "[common]") {
     REQUIRE(animationNames.size() == 2);
   }
 }
+
+TEST_CASE("ObjectContainersList (remembered resolutions)", "[common]") {
+
+  SECTION("Update the resolutions when objects and groups are modified") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    gd::Object &object1 = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject1", 0);
+    gd::Object &object2 = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject2", 1);
+    object1.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    object2.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    auto &group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+    group.AddObject("MyObject1");
+    group.AddObject("MyObject2");
+
+    auto objectsContainersList = gd::ObjectsContainersList::
+        MakeNewObjectsContainersListForProjectAndLayout(project, layout);
+
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") ==
+            "MyExtension::Sprite");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup").size() == 1);
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").size() == 2);
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup", "MyObject2") ==
+            std::vector<gd::String>{"MyObject2"});
+    REQUIRE(!objectsContainersList.HasObjectOrGroupNamed("MyObject3"));
+
+    object2.RemoveBehavior("MyBehavior");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup").empty());
+
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::FakeObjectWithDefaultBehavior", "MyObject3", 2);
+    group.AddObject("MyObject3");
+    REQUIRE(objectsContainersList.HasObjectOrGroupNamed("MyObject3"));
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") == "");
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").size() == 3);
+
+    layout.GetObjects().RemoveObject("MyObject1");
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").size() == 2);
+
+    layout.GetObjects().GetObjectGroups().Rename("MyGroup", "MyRenamedGroup");
+    REQUIRE(!objectsContainersList.HasObjectOrGroupNamed("MyGroup"));
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").empty());
+    REQUIRE(objectsContainersList.ExpandObjectName("MyRenamedGroup").size() ==
+            2);
+  }
+
+  SECTION("Update the resolutions when objects and groups are modified "
+          "directly") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    gd::Object &object = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    auto &group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+    group.AddObject("MyObject");
+
+    auto objectsContainersList = gd::ObjectsContainersList::
+        MakeNewObjectsContainersListForProjectAndLayout(project, layout);
+    REQUIRE(objectsContainersList.HasObjectOrGroupNamed("MyObject"));
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyObject") ==
+            std::vector<gd::String>{"MyBehavior"});
+
+    object.RenameBehavior("MyBehavior", "MyRenamedBehavior");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyObject") ==
+            std::vector<gd::String>{"MyRenamedBehavior"});
+
+    object.SetName("MyRenamedObject");
+    REQUIRE(!objectsContainersList.HasObjectOrGroupNamed("MyObject"));
+    REQUIRE(objectsContainersList.HasObjectOrGroupNamed("MyRenamedObject"));
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").empty());
+
+    group.RenameObject("MyObject", "MyRenamedObject");
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup") ==
+            std::vector<gd::String>{"MyRenamedObject"});
+
+    group = gd::ObjectGroup();
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").empty());
+  }
+
+  SECTION("Resolve names from tasks running in parallel") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    for (std::size_t i = 0; i < 50; i++) {
+      layout.GetObjects()
+          .InsertNewObject(project, "MyExtension::Sprite",
+                           "MyObject" + gd::String::From(i), i)
+          .AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    }
+
+    auto objectsContainersList = gd::ObjectsContainersList::
+        MakeNewObjectsContainersListForProjectAndLayout(project, layout);
+    std::vector<int> resolved(200, 0);
+    gd::TasksRunner::Run(
+        resolved.size(), 4, [&](std::size_t task) {
+          gd::String name = "MyObject" + gd::String::From(task % 50);
+          resolved[task] =
+              objectsContainersList.HasObjectOrGroupNamed(name) &&
+              objectsContainersList.GetTypeOfObject(name) ==
+                  "MyExtension::Sprite" &&
+              objectsContainersList.GetBehaviorsOfObject(name).size() == 1 &&
+              objectsContainersList.ExpandObjectName(name).size() == 1;
+        });
+    REQUIRE(std::find(resolved.begin(), resolved.end(), 0) ==
+            resolved.end());
+  }
+}
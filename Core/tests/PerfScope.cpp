@@ -0,0 +1,94 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/PerfScope.h"
+
+#include <thread>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("PerfScope", "[common]") {
+  gd::PerfScope::Reset();
+
+  SECTION("Nothing is recorded when disabled") {
+    REQUIRE_FALSE(gd::PerfScope::IsEnabled());
+    {
+      gd::PerfScope perfScope("Operation");
+      gd::PerfScope::IncrementCounter("counter");
+    }
+    REQUIRE(gd::PerfScope::GetCallsCount("Operation") == 0);
+    REQUIRE(gd::PerfScope::GetCounter("counter") == 0);
+  }
+
+  SECTION("Timings are hierarchical and aggregated") {
+    gd::PerfScope::Enable(true);
+    for (int i = 0; i < 3; i++) {
+      gd::PerfScope perfScope("Operation");
+      gd::PerfScope::IncrementCounter("counter", 2);
+      {
+        gd::PerfScope childPerfScope("Child");
+      }
+    }
+    {
+      gd::PerfScope perfScope("Child");
+    }
+    gd::PerfScope::Enable(false);
+
+    REQUIRE(gd::PerfScope::GetCallsCount("Operation") == 3);
+    REQUIRE(gd::PerfScope::GetCallsCount("Operation/Child") == 3);
+    REQUIRE(gd::PerfScope::GetCallsCount("Child") == 1);
+    REQUIRE(gd::PerfScope::GetCallsCount("Operation/Unknown") == 0);
+    REQUIRE(gd::PerfScope::GetTotalDuration("Operation") >=
+            gd::PerfScope::GetTotalDuration("Operation/Child"));
+    REQUIRE(gd::PerfScope::GetCounter("counter") == 6);
+
+    gd::String json = gd::PerfScope::ToJSON();
+    REQUIRE(json.find("\"name\":\"Operation\"") != gd::String::npos);
+    REQUIRE(json.find("\"counter\":6") != gd::String::npos);
+
+    gd::PerfScope::Reset();
+    REQUIRE(gd::PerfScope::GetCallsCount("Operation") == 0);
+    REQUIRE(gd::PerfScope::GetCounter("counter") == 0);
+  }
+
+  SECTION("Scopes of other threads are ignored") {
+    gd::PerfScope::Enable(true);
+    std::thread thread([]() { gd::PerfScope perfScope("Operation"); });
+    thread.join();
+    gd::PerfScope::Enable(false);
+
+    REQUIRE(gd::PerfScope::GetCallsCount("Operation") == 0);
+  }
+
+  SECTION("Loading a project is timed") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    project.InsertNewLayout("Scene1", 0);
+    project.InsertNewLayout("Scene2", 1);
+    gd::SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+    gd::String json = gd::Serializer::ToJSON(projectElement);
+
+    gd::PerfScope::Enable(true);
+    gd::Project loadedProject;
+    loadedProject.AddPlatform(platform);
+    loadedProject.UnserializeFrom(gd::Serializer::FromJSON(json));
+    gd::PerfScope::Enable(false);
+
+    REQUIRE(gd::PerfScope::GetCallsCount("Serializer::FromJSON") == 1);
+    REQUIRE(gd::PerfScope::GetCallsCount("Project::UnserializeFrom") == 1);
+    REQUIRE(gd::PerfScope::GetCallsCount(
+                "Project::UnserializeFrom/Layout::UnserializeFrom") == 2);
+    REQUIRE(gd::PerfScope::GetCounter("layoutsLoaded") == 2);
+  }
+
+  gd::PerfScope::Reset();
+}
@@ -0,0 +1,69 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/PlatformSnapshot.h"
+
+#include <memory>
+
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+std::shared_ptr<gd::PlatformExtension> MakeExtension(const gd::String &name) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(name, name, "", "", "");
+  return extension;
+}
+
+}  // namespace
+
+TEST_CASE("PlatformSnapshot", "[common]") {
+  SECTION("Compute keys from the events functions extensions") {
+    gd::Project project;
+    gd::String emptyProjectKey = gd::PlatformSnapshot::ComputeKey(project);
+    REQUIRE(emptyProjectKey == gd::PlatformSnapshot::ComputeKey(project));
+
+    auto &eventsFunctionsExtension =
+        project.InsertNewEventsFunctionsExtension("MyExtension", 0);
+    gd::String key = gd::PlatformSnapshot::ComputeKey(project);
+    REQUIRE(key != emptyProjectKey);
+
+    eventsFunctionsExtension.SetDescription("A new description");
+    REQUIRE(gd::PlatformSnapshot::ComputeKey(project) != key);
+  }
+
+  SECTION("Restore the extensions of a platform") {
+    gd::Platform platform;
+    platform.AddExtension(MakeExtension("BuiltinExtension"));
+
+    gd::PlatformSnapshot snapshot;
+    REQUIRE(!snapshot.Restore(platform, "Key"));
+
+    platform.AddExtension(MakeExtension("DeclaredExtension"));
+    snapshot.Take(platform, "Key");
+    REQUIRE(snapshot.GetKey() == "Key");
+
+    platform.RemoveExtension("DeclaredExtension");
+    REQUIRE(!platform.IsExtensionLoaded("DeclaredExtension"));
+
+    // Nothing is restored with another key.
+    REQUIRE(!snapshot.Restore(platform, "OtherKey"));
+    REQUIRE(!platform.IsExtensionLoaded("DeclaredExtension"));
+
+    REQUIRE(snapshot.Restore(platform, "Key"));
+    REQUIRE(platform.IsExtensionLoaded("BuiltinExtension"));
+    REQUIRE(platform.IsExtensionLoaded("DeclaredExtension"));
+    REQUIRE(platform.GetAllPlatformExtensions().size() == 2);
+
+    snapshot.Clear();
+    REQUIRE(snapshot.GetKey() == "");
+    REQUIRE(!snapshot.Restore(platform, "Key"));
+  }
+}
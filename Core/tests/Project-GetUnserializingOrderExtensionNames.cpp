@@ -309,4 +309,54 @@ TEST_CASE("Project::GetUnserializingOrderExtensionNames", "[common]") {
     REQUIRE(orderedNames[2] == "Extension3DependingOn2");
     REQUIRE(orderedNames[3] == "Extension4DependsOn1And3");
   }
+
+  SECTION("Extensions are loaded in the list order when possible") {
+    gd::SerializerElement extensionsElement = gd::Serializer::FromJSON(
+        R"([
+        {
+          "name": "Extension1DependsOn2",
+          "eventsBasedObjects": [
+            {
+              "name": "MyObject",
+              "objects": [
+                { "name": "MyChildObject", "type": "Extension2DependsNothing::MyObject" }
+              ]
+            }
+          ]
+        },
+        { "name": "Extension2DependsNothing", "eventsBasedObjects": [] },
+        { "name": "Extension3DependsNothing", "eventsBasedObjects": [] },
+        {
+          "name": "Extension4DependsOn5",
+          "eventsBasedObjects": [
+            {
+              "name": "MyObject",
+              "objects": [
+                { "name": "MyChildObject", "type": "Extension5DependsOn4::MyObject" }
+              ]
+            }
+          ]
+        },
+        {
+          "name": "Extension5DependsOn4",
+          "eventsBasedObjects": [
+            {
+              "name": "MyObject",
+              "objects": [
+                { "name": "MyChildObject", "type": "Extension4DependsOn5::MyObject" }
+              ]
+            }
+          ]
+        }
+      ])");
+
+    // Extensions are loaded as if the list was walked until nothing can be
+    // loaded anymore. Extensions with cyclic dependencies are not loaded.
+    std::vector<gd::String> orderedNames =
+        gd::Project::GetUnserializingOrderExtensionNames(extensionsElement);
+    REQUIRE(orderedNames.size() == 3);
+    REQUIRE(orderedNames[0] == "Extension2DependsNothing");
+    REQUIRE(orderedNames[1] == "Extension3DependsNothing");
+    REQUIRE(orderedNames[2] == "Extension1DependsOn2");
+  }
 }
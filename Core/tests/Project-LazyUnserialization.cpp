@@ -0,0 +1,87 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lazy unserialization of layouts of a project.
+ */
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("Project::UnserializeLazilyFrom", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto& layout1 = project.InsertNewLayout("Scene1", 0);
+  layout1.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                       "MyObject1", 0);
+  auto& layout2 = project.InsertNewLayout("Scene2", 1);
+  layout2.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                       "MyObject2", 0);
+  auto& externalLayout = project.InsertNewExternalLayout("External", 0);
+  externalLayout.SetAssociatedLayout("Scene2");
+
+  gd::SerializerElement projectElement;
+  project.SerializeTo(projectElement);
+
+  SECTION("Layouts are unserialized on first access") {
+    gd::Project lazyProject;
+    SetupProjectWithDummyPlatform(lazyProject, platform);
+    lazyProject.UnserializeLazilyFrom(projectElement);
+
+    REQUIRE(lazyProject.GetLayoutsCount() == 2);
+    REQUIRE(lazyProject.HasLayoutNamed("Scene1"));
+    REQUIRE(lazyProject.GetLayoutPosition("Scene2") == 1);
+    REQUIRE(lazyProject.HasExternalLayoutNamed("External"));
+
+    REQUIRE(lazyProject.GetLayout("Scene2").GetObjects().HasObjectNamed(
+        "MyObject2"));
+    REQUIRE(lazyProject.GetLayout(0).GetObjects().HasObjectNamed("MyObject1"));
+    REQUIRE(lazyProject.GetExternalLayout("External").GetAssociatedLayout() ==
+            "Scene2");
+  }
+
+  SECTION("Serializing or copying a lazily unserialized project") {
+    gd::Project lazyProject;
+    SetupProjectWithDummyPlatform(lazyProject, platform);
+    lazyProject.UnserializeLazilyFrom(projectElement);
+
+    gd::Project copiedProject = lazyProject;
+    REQUIRE(copiedProject.GetLayout("Scene1").GetObjects().HasObjectNamed(
+        "MyObject1"));
+
+    // Compare with a project unserialized entirely, as unserializing can
+    // itself change some properties (for compatibility with old versions).
+    gd::Project unserializedProject;
+    SetupProjectWithDummyPlatform(unserializedProject, platform);
+    unserializedProject.UnserializeFrom(projectElement);
+    gd::SerializerElement expectedElement;
+    unserializedProject.SerializeTo(expectedElement);
+
+    gd::SerializerElement lazyProjectElement;
+    lazyProject.SerializeTo(lazyProjectElement);
+    REQUIRE(gd::Serializer::ToJSON(lazyProjectElement) ==
+            gd::Serializer::ToJSON(expectedElement));
+  }
+
+  SECTION("Removing a layout not unserialized yet") {
+    gd::Project lazyProject;
+    SetupProjectWithDummyPlatform(lazyProject, platform);
+    lazyProject.UnserializeLazilyFrom(projectElement);
+
+    lazyProject.RemoveLayout("Scene1");
+    lazyProject.RemoveExternalLayout("External");
+    REQUIRE(lazyProject.GetLayoutsCount() == 1);
+    REQUIRE(lazyProject.GetExternalLayoutsCount() == 0);
+    REQUIRE(lazyProject.GetLayout(0).GetObjects().HasObjectNamed("MyObject2"));
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+class ActionsTypesLister : public gd::ArbitraryEventsWorkerWithContext {
+ public:
+  std::vector<gd::String> types;
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    types.push_back(instruction.GetType());
+    return false;
+  }
+};
+
+void AddAction(gd::EventsList &events, const gd::String &type) {
+  gd::StandardEvent event;
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  event.GetActions().Insert(instruction);
+  events.InsertEvent(event);
+}
+
+}  // namespace
+
+TEST_CASE("ProjectBrowserHelper", "[common][events]") {
+  SECTION("Browse the events of a project in parallel") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    for (std::size_t i = 0; i < 10; i++) {
+      auto &layout =
+          project.InsertNewLayout("Layout" + gd::String::From(i), i);
+      AddAction(layout.GetEvents(), "Layout" + gd::String::From(i));
+    }
+    auto &externalEvents =
+        project.InsertNewExternalEvents("MyExternalEvents", 0);
+    externalEvents.SetAssociatedLayout("Layout3");
+    AddAction(externalEvents.GetEvents(), "MyExternalEvents");
+    auto &extension =
+        project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    auto &function = extension.GetEventsFunctions().InsertNewEventsFunction(
+        "MyFunction", 0);
+    AddAction(function.GetEvents(), "MyFunction");
+
+    ActionsTypesLister sequentialLister;
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, sequentialLister);
+    REQUIRE(sequentialLister.types.size() == 12);
+
+    const std::thread::id callingThreadId = std::this_thread::get_id();
+    for (std::size_t threadsCount : {0, 1, 4}) {
+      std::vector<gd::String> types;
+      std::size_t workersCreatedOnCallingThread = 0;
+      gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+          project,
+          [&]() {
+            if (std::this_thread::get_id() == callingThreadId)
+              workersCreatedOnCallingThread++;
+            return std::unique_ptr<gd::ArbitraryEventsWorkerWithContext>(
+                new ActionsTypesLister());
+          },
+          [&types](gd::ArbitraryEventsWorkerWithContext &worker) {
+            auto &lister = static_cast<ActionsTypesLister &>(worker);
+            types.insert(types.end(), lister.types.begin(), lister.types.end());
+          },
+          threadsCount);
+
+      // The results are merged in the same order as a sequential browse.
+      REQUIRE(types == sequentialLister.types);
+      REQUIRE(workersCreatedOnCallingThread == 12);
+    }
+  }
+}
@@ -0,0 +1,146 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ProjectExpressionsValidator.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+void InsertDoSomethingAction(
+    gd::EventsList &events,
+    const gd::String &expression,
+    const gd::String &type = "MyExtension::DoSomething") {
+  gd::StandardEvent event;
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(1);
+  instruction.SetParameter(0, expression);
+  event.GetActions().Insert(instruction);
+  events.InsertEvent(event);
+}
+
+TEST_CASE("ProjectExpressionsValidator", "[events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  layout.GetVariables().InsertNew("MyVariable", 0).SetValue(1);
+
+  SECTION("Valid expressions give no diagnostic") {
+    InsertDoSomethingAction(layout.GetEvents(), "1 + 2");
+    InsertDoSomethingAction(layout.GetEvents(), "MyVariable * 2");
+
+    REQUIRE(gd::ProjectExpressionsValidator::ValidateProject(project).empty());
+  }
+
+  SECTION("Errors of every expression are listed") {
+    InsertDoSomethingAction(layout.GetEvents(), "1 + 2");
+    InsertDoSomethingAction(layout.GetEvents(), "1 +");
+    InsertDoSomethingAction(
+        layout.GetEvents().GetEvent(1).GetSubEvents(), "\"Text\"");
+
+    auto diagnostics =
+        gd::ProjectExpressionsValidator::ValidateLayout(project, layout);
+    REQUIRE(diagnostics.size() == 2);
+
+    REQUIRE(diagnostics[0].event == &layout.GetEvents().GetEvent(1));
+    REQUIRE(diagnostics[0].instruction != nullptr);
+    REQUIRE(diagnostics[0].instruction->GetType() ==
+            "MyExtension::DoSomething");
+    REQUIRE(diagnostics[0].parameterIndex == 0);
+    REQUIRE(diagnostics[0].isFatal);
+    // The missing operand is reported by the validator.
+    REQUIRE(diagnostics[0].type ==
+            gd::ExpressionParserError::ErrorType::MismatchedType);
+
+    REQUIRE(diagnostics[1].event ==
+            &layout.GetEvents().GetEvent(1).GetSubEvents().GetEvent(0));
+    REQUIRE(diagnostics[1].type ==
+            gd::ExpressionParserError::ErrorType::MismatchedType);
+    REQUIRE(diagnostics[1].startPosition == 0);
+    REQUIRE(diagnostics[1].endPosition == 6);
+  }
+
+  SECTION("Events functions are validated with their own scope") {
+    auto &extension =
+        project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    auto &eventsFunction =
+        extension.GetEventsFunctions().InsertNewEventsFunction(
+            "MyFunction", 0);
+    eventsFunction.GetParameters()
+        .AddNewParameter("MyParameter")
+        .GetValueTypeMetadata()
+        .SetName("number");
+    InsertDoSomethingAction(eventsFunction.GetEvents(), "MyParameter + 1");
+    InsertDoSomethingAction(eventsFunction.GetEvents(), "MyVariable + 1");
+
+    auto diagnostics = gd::ProjectExpressionsValidator::ValidateEventsFunction(
+        project, extension, eventsFunction);
+    REQUIRE(diagnostics.size() == 1);
+    REQUIRE(diagnostics[0].event == &eventsFunction.GetEvents().GetEvent(1));
+
+    // The whole project includes extensions.
+    InsertDoSomethingAction(layout.GetEvents(), "1 +");
+    auto allDiagnostics =
+        gd::ProjectExpressionsValidator::ValidateProject(project);
+    REQUIRE(allDiagnostics.size() == 2);
+  }
+
+  SECTION("Scenes and extensions can be validated in parallel") {
+    for (std::size_t i = 0; i < 20; i++) {
+      auto &otherLayout =
+          project.InsertNewLayout("Scene" + gd::String::From(i), i + 1);
+      for (std::size_t j = 0; j < 10; j++) {
+        InsertDoSomethingAction(otherLayout.GetEvents(), "1 + 2");
+        InsertDoSomethingAction(otherLayout.GetEvents(),
+                                "UndeclaredVariable" + gd::String::From(i),
+                                "MyExtension::DoSomethingWithAnyVariable");
+      }
+    }
+    auto &extension =
+        project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    auto &eventsFunction =
+        extension.GetEventsFunctions().InsertNewEventsFunction(
+            "MyFunction", 0);
+    InsertDoSomethingAction(eventsFunction.GetEvents(), "1 +");
+
+    auto diagnostics =
+        gd::ProjectExpressionsValidator::ValidateProjectInParallel(project, 4);
+    REQUIRE(diagnostics.size() == 20 * 10 + 1);
+    REQUIRE(diagnostics[0].event ==
+            &project.GetLayout(1).GetEvents().GetEvent(1));
+    REQUIRE(diagnostics[0].actualValue == "UndeclaredVariable0");
+    REQUIRE(diagnostics.back().event ==
+            &eventsFunction.GetEvents().GetEvent(0));
+
+    gd::WholeProjectDiagnosticReport wholeProjectDiagnosticReport;
+    gd::ProjectExpressionsValidator::AddProjectDiagnosticReports(
+        project, wholeProjectDiagnosticReport, 4);
+    REQUIRE(wholeProjectDiagnosticReport.Count() == 21 + 1);
+    REQUIRE(wholeProjectDiagnosticReport.Get(0).GetSceneName() == "Scene");
+    REQUIRE(wholeProjectDiagnosticReport.Get(0).Count() == 0);
+    REQUIRE(wholeProjectDiagnosticReport.Get(1).GetSceneName() == "Scene0");
+    REQUIRE(wholeProjectDiagnosticReport.Get(1).Count() == 10);
+    REQUIRE(wholeProjectDiagnosticReport.Get(1).Get(0).GetActualValue() ==
+            "UndeclaredVariable0");
+    // Errors other than undeclared variables are not reported, like in the code generation.
+    REQUIRE(wholeProjectDiagnosticReport.Get(21).GetSceneName() ==
+            "MyEventsExtension");
+    REQUIRE(wholeProjectDiagnosticReport.Get(21).Count() == 0);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,138 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+
+#include <map>
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * A file system keeping files in memory, the content of a file being used as
+ * its fingerprint.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  void MkDir(const gd::String& path) override {}
+  bool DirExists(const gd::String& path) override { return true; }
+  bool FileExists(const gd::String& path) override {
+    return files.find(path) != files.end();
+  }
+  bool ClearDir(const gd::String& directory) override { return true; }
+  gd::String GetTempDir() override { return "/tmp"; }
+  gd::String FileNameFrom(const gd::String& file) override {
+    return file.substr(file.rfind("/") + 1);
+  }
+  gd::String DirNameFrom(const gd::String& file) override {
+    return file.substr(0, file.rfind("/"));
+  }
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  }
+  bool IsAbsolute(const gd::String& filename) override {
+    return !filename.empty() && filename[0] == '/';
+  }
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    return false;
+  }
+  bool CopyFile(const gd::String& file,
+                const gd::String& destination) override {
+    if (!FileExists(file)) return false;
+    copiedFiles.push_back(file);
+    files[destination] = files[file];
+    return true;
+  }
+  bool WriteToFile(const gd::String& file,
+                   const gd::String& content) override {
+    files[file] = content;
+    return true;
+  }
+  gd::String ReadFile(const gd::String& file) override { return files[file]; }
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension) override {
+    return {};
+  }
+  gd::String GetFileFingerprint(const gd::String& file) override {
+    return FileExists(file) ? files[file] : "";
+  }
+  bool RemoveFile(const gd::String& file) override {
+    return files.erase(file) > 0;
+  }
+
+  std::map<gd::String, gd::String> files;
+  std::vector<gd::String> copiedFiles;
+};
+
+}  // namespace
+
+TEST_CASE("ProjectResourcesCopier", "[common][resources]") {
+  SECTION("Only copy new or changed resources") {
+    InMemoryFileSystem fs;
+    fs.files["/project/image.png"] = "image";
+    fs.files["/project/audio.mp3"] = "audio";
+    fs.files["/project/other.png"] = "other";
+
+    gd::Project project;
+    project.SetProjectFile("/project/game.json");
+    auto& resourcesManager = project.GetResourcesManager();
+    resourcesManager.AddResource("Image", "image.png", "image");
+    resourcesManager.AddResource("Audio", "audio.mp3", "audio");
+    resourcesManager.AddResource("Other", "other.png", "image");
+
+    auto copyResources = [&]() {
+      fs.copiedFiles.clear();
+      gd::ProjectResourcesCopier::CopyAllResourcesTo(
+          project, fs, "/export", false, false, false, true);
+    };
+
+    copyResources();
+    REQUIRE(fs.copiedFiles.size() == 3);
+    REQUIRE(fs.files["/export/image.png"] == "image");
+    REQUIRE(fs.FileExists(
+        "/export/" + gd::ProjectResourcesCopier::GetCopyManifestFilename()));
+
+    // Nothing changed: nothing is copied.
+    copyResources();
+    REQUIRE(fs.copiedFiles.empty());
+
+    // Only the changed file is copied, and unused files are removed.
+    fs.files["/project/audio.mp3"] = "new audio";
+    resourcesManager.RemoveResource("Other");
+    copyResources();
+    REQUIRE(fs.copiedFiles == std::vector<gd::String>{"/project/audio.mp3"});
+    REQUIRE(fs.files["/export/audio.mp3"] == "new audio");
+    REQUIRE_FALSE(fs.FileExists("/export/other.png"));
+
+    // Files removed from the destination are copied again.
+    fs.files.erase("/export/image.png");
+    copyResources();
+    REQUIRE(fs.copiedFiles == std::vector<gd::String>{"/project/image.png"});
+  }
+
+  SECTION("Copy all resources without a manifest by default") {
+    InMemoryFileSystem fs;
+    fs.files["/project/image.png"] = "image";
+
+    gd::Project project;
+    project.SetProjectFile("/project/game.json");
+    project.GetResourcesManager().AddResource("Image", "image.png", "image");
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, false);
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, false);
+    REQUIRE(fs.copiedFiles.size() == 2);
+    REQUIRE_FALSE(fs.FileExists(
+        "/export/" + gd::ProjectResourcesCopier::GetCopyManifestFilename()));
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ProjectStatisticsEvaluator.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const gd::String &parameter) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(2);
+  instruction.SetParameter(0, parameter);
+  return instruction;
+}
+
+}  // namespace
+
+TEST_CASE("ProjectStatisticsEvaluator", "[events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  project.GetResourcesManager().AddResource("Image1", "image1.png", "image");
+  project.GetResourcesManager().AddResource("Image2", "image2.png", "image");
+  project.GetResourcesManager().AddResource("Sound", "sound.mp3", "audio");
+  project.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                       "MyGlobalObject", 0);
+
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  layout.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                      "MyObject", 0);
+  layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+      "MyObject");
+  layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+      "MyObject");
+
+  // An event with a condition and an action, with 2 sub-events (one of them
+  // having an action), then an event without instructions.
+  gd::StandardEvent event;
+  event.GetConditions().Insert(
+      MakeInstruction("UnknownExtension::Condition", "1"));
+  event.GetActions().Insert(MakeInstruction("MyExtension::DoSomething", "2"));
+  gd::StandardEvent subEvent;
+  subEvent.GetActions().Insert(MakeInstruction("MyExtension::DoSomething", ""));
+  event.GetSubEvents().InsertEvent(subEvent);
+  event.GetSubEvents().InsertEvent(gd::StandardEvent());
+  layout.GetEvents().InsertEvent(event);
+  layout.GetEvents().InsertEvent(gd::StandardEvent());
+
+  auto &externalEvents = project.InsertNewExternalEvents("External", 0);
+  gd::StandardEvent externalEvent;
+  externalEvent.GetActions().Insert(
+      MakeInstruction("MyExtension::DoSomething", "3"));
+  externalEvents.GetEvents().InsertEvent(externalEvent);
+
+  SECTION("Statistics of a scene") {
+    gd::ProjectStatistics statistics =
+        gd::ProjectStatisticsEvaluator::ComputeLayoutStatistics(project,
+                                                                layout);
+    REQUIRE(statistics.GetEventsCount() == 4);
+    std::vector<std::size_t> expectedEventsCountByDepth = {2, 2};
+    REQUIRE(statistics.GetEventsCountByDepth() == expectedEventsCountByDepth);
+    REQUIRE(statistics.GetConditionsCount() == 1);
+    REQUIRE(statistics.GetActionsCount() == 2);
+    REQUIRE(statistics.GetExpressionsCount() == 2);
+    REQUIRE(statistics.GetInstructionsCountByExtension().at("MyExtension") ==
+            2);
+    REQUIRE(statistics.GetInstructionsCountByExtension().at(
+                "UnknownExtension") == 1);
+    REQUIRE(statistics.GetObjectsCount() == 1);
+    REQUIRE(statistics.GetInstancesCount() == 2);
+    REQUIRE(statistics.GetResourcesCountByKind().empty());
+  }
+
+  SECTION("Statistics of the whole project") {
+    gd::ProjectStatistics statistics =
+        gd::ProjectStatisticsEvaluator::ComputeProjectStatistics(project);
+    REQUIRE(statistics.GetEventsCount() == 5);
+    std::vector<std::size_t> expectedEventsCountByDepth = {3, 2};
+    REQUIRE(statistics.GetEventsCountByDepth() == expectedEventsCountByDepth);
+    REQUIRE(statistics.GetInstructionsCount() == 4);
+    REQUIRE(statistics.GetExpressionsCount() == 3);
+    REQUIRE(statistics.GetInstructionsCountByExtension().at("MyExtension") ==
+            3);
+    REQUIRE(statistics.GetObjectsCount() == 2);
+    REQUIRE(statistics.GetInstancesCount() == 2);
+    REQUIRE(statistics.GetResourcesCountByKind().at("image") == 2);
+    REQUIRE(statistics.GetResourcesCountByKind().at("audio") == 1);
+
+    REQUIRE(statistics.ToJSON().find("\"eventsCountByDepth\":[3,2]") !=
+            gd::String::npos);
+  }
+}
@@ -0,0 +1,94 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectStripper.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+void SetupProjectToStrip(gd::Project &project) {
+  auto &globalObject = project.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MyGlobalObject", 0);
+  globalObject.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior")
+      ->SetDefaultBehavior(true);
+  project.GetObjects().GetObjectGroups().InsertNew("MyGlobalGroup").AddObject(
+      "MyGlobalObject");
+
+  auto &layout = project.InsertNewLayout("MyLayout", 0);
+  layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MyObject", 0);
+  layout.GetObjects().GetObjectGroups().InsertNew("MyGroup").AddObject(
+      "MyObject");
+  layout.GetEvents().InsertEvent(gd::StandardEvent());
+
+  project.InsertNewExternalEvents("MyExternalEvents", 0)
+      .GetEvents()
+      .InsertEvent(gd::StandardEvent());
+
+  auto &usedExtension =
+      project.InsertNewEventsFunctionsExtension("MyUsedExtension", 0);
+  usedExtension.SetFullName("My used extension");
+  usedExtension.SetDescription("Some description.");
+  usedExtension.SetOrigin("origin", "identifier");
+  usedExtension.GetEventsFunctions().InsertNewEventsFunction("MyFunction", 0);
+  usedExtension.GetEventsBasedBehaviors().InsertNew("MyEventsBasedBehavior", 0);
+  auto &eventsBasedObject = usedExtension.GetEventsBasedObjects().InsertNew(
+      "MyEventsBasedObject", 0);
+  eventsBasedObject.SetFullName("My events-based object");
+  eventsBasedObject.GetEventsFunctions().InsertNewEventsFunction(
+      "MyObjectFunction", 0);
+  eventsBasedObject.GetObjects()
+      .InsertNewObject(project, "MyExtension::Sprite", "MyChildObject", 0)
+      .AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior")
+      ->SetDefaultBehavior(true);
+
+  auto &variablesExtension =
+      project.InsertNewEventsFunctionsExtension("MyVariablesExtension", 1);
+  variablesExtension.GetGlobalVariables().InsertNew("MyVariable");
+
+  project.InsertNewEventsFunctionsExtension("MyFunctionsExtension", 2)
+      .GetEventsFunctions()
+      .InsertNewEventsFunction("MyFunction", 0);
+}
+
+}  // namespace
+
+TEST_CASE("ProjectStripper", "[common]") {
+  SECTION("Serialize a project for export like a stripped project") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    SetupProjectToStrip(project);
+
+    gd::Project strippedProject = project;
+    gd::ProjectStripper::StripProjectForExport(strippedProject);
+    REQUIRE(strippedProject.GetEventsFunctionsExtensionsCount() == 2);
+    gd::SerializerElement strippedElement;
+    strippedProject.SerializeTo(strippedElement);
+
+    gd::SerializerElement exportElement;
+    project.SerializeForExportTo(exportElement);
+    REQUIRE(gd::Serializer::ToJSON(exportElement) ==
+            gd::Serializer::ToJSON(strippedElement));
+
+    // The project itself is left untouched.
+    REQUIRE(project.GetExternalEventsCount() == 1);
+    REQUIRE(project.GetLayout("MyLayout").GetEvents().GetEventsCount() == 1);
+    REQUIRE(project.GetEventsFunctionsExtensionsCount() == 3);
+  }
+}
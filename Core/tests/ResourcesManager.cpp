@@ -0,0 +1,80 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/ResourcesManager.h"
+
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("ResourcesManager", "[common][resources]") {
+  gd::ResourcesManager resourcesManager;
+  resourcesManager.AddResource("Resource1", "res/image1.png", "image");
+  resourcesManager.AddResource("Resource2", "res/image2.png", "image");
+  resourcesManager.AddResource("Resource3", "res/sound.mp3", "audio");
+
+  SECTION("Find resources by name") {
+    REQUIRE(resourcesManager.HasResource("Resource2"));
+    REQUIRE_FALSE(resourcesManager.HasResource("MissingResource"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource3") == 2);
+    REQUIRE(resourcesManager.GetResource("Resource1").GetFile() ==
+            "res/image1.png");
+    REQUIRE(resourcesManager.GetResourceSPtr("MissingResource") == nullptr);
+    REQUIRE_FALSE(resourcesManager.AddResource("Resource1", "", "image"));
+  }
+
+  SECTION("Find resources after they are moved, renamed or removed") {
+    resourcesManager.MoveResource(0, 2);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 2);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource2") == 0);
+
+    REQUIRE(resourcesManager.MoveResourceUpInList("Resource1"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 1);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource3") == 2);
+
+    resourcesManager.RenameResource("Resource1", "RenamedResource");
+    REQUIRE_FALSE(resourcesManager.HasResource("Resource1"));
+    REQUIRE(resourcesManager.GetResourcePosition("RenamedResource") == 1);
+
+    // Resources can also be renamed directly.
+    resourcesManager.GetResource("Resource3").SetName("OtherResource");
+    REQUIRE_FALSE(resourcesManager.HasResource("Resource3"));
+    REQUIRE(resourcesManager.GetResourcePosition("OtherResource") == 2);
+
+    resourcesManager.RemoveResource("Resource2");
+    REQUIRE_FALSE(resourcesManager.HasResource("Resource2"));
+    REQUIRE(resourcesManager.GetResourcePosition("RenamedResource") == 0);
+    REQUIRE(resourcesManager.GetResourcePosition("OtherResource") == 1);
+  }
+
+  SECTION("Remove several resources at once") {
+    resourcesManager.CreateFolder("Folder");
+    resourcesManager.GetFolder("Folder").AddResource("Resource1",
+                                                     resourcesManager);
+    resourcesManager.GetFolder("Folder").AddResource("Resource3",
+                                                     resourcesManager);
+
+    resourcesManager.RemoveResources({"Resource1", "Resource3", "Missing"});
+    REQUIRE_FALSE(resourcesManager.HasResource("Resource1"));
+    REQUIRE_FALSE(resourcesManager.HasResource("Resource3"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource2") == 0);
+    REQUIRE_FALSE(
+        resourcesManager.GetFolder("Folder").HasResource("Resource1"));
+    REQUIRE_FALSE(
+        resourcesManager.GetFolder("Folder").HasResource("Resource3"));
+  }
+
+  SECTION("Find resources after a copy or an unserialization") {
+    gd::ResourcesManager copiedResourcesManager = resourcesManager;
+    REQUIRE(copiedResourcesManager.GetResourcePosition("Resource3") == 2);
+
+    gd::SerializerElement element;
+    resourcesManager.SerializeTo(element);
+    gd::ResourcesManager unserializedResourcesManager;
+    unserializedResourcesManager.UnserializeFrom(element);
+    REQUIRE(unserializedResourcesManager.GetResourcePosition("Resource2") == 1);
+    REQUIRE(unserializedResourcesManager.GetResource("Resource3").GetKind() ==
+            "audio");
+  }
+}
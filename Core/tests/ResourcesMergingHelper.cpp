@@ -31,6 +31,7 @@ class MockFileSystem : public gd::AbstractFileSystem {
   };
   virtual bool MakeAbsolute(gd::String& filename,
                             const gd::String& baseDirectory) {
+    makeAbsoluteCallsCount++;
     filename = "MakeAbsolute(" + filename + ")";
     return true;
   };
@@ -59,8 +60,10 @@ class MockFileSystem : public gd::AbstractFileSystem {
     return dir;
   }
 
-  MockFileSystem(){};
+  MockFileSystem() : makeAbsoluteCallsCount(0){};
   virtual ~MockFileSystem(){};
+
+  std::size_t makeAbsoluteCallsCount;
 };
 
 TEST_CASE("ResourcesMergingHelper", "[common]") {
@@ -115,4 +118,26 @@ TEST_CASE("ResourcesMergingHelper", "[common]") {
     REQUIRE(resourcesFilenames["MakeAbsolute(subfolder/image3.png)"] ==
             "MakeRelative(MakeAbsolute(subfolder/image3.png))");
   }
+  SECTION("Resolves a file used by several resources once") {
+    gd::Project project;
+    MockFileSystem fs;
+    gd::ResourcesMergingHelper resourcesMerger(project.GetResourcesManager(), fs);
+    resourcesMerger.SetBaseDirectory("/game/base/folder/");
+
+    project.GetResourcesManager().AddResource("Image1", "image.png", "image");
+    project.GetResourcesManager().AddResource("Image2", "image.png", "image");
+    project.GetResourcesManager().AddResource("Image3", "image.png", "image");
+    project.GetResourcesManager().AddResource("Image4", "other.png", "image");
+
+    gd::ResourceExposer::ExposeWholeProjectResources(project, resourcesMerger);
+
+    REQUIRE(fs.makeAbsoluteCallsCount == 2);
+    REQUIRE(resourcesMerger.GetAllResourcesOldAndNewFilename().size() == 2);
+    for (const gd::String& name : {"Image1", "Image2", "Image3"}) {
+      REQUIRE(project.GetResourcesManager().GetResource(name).GetFile() ==
+              "FileNameFrom(MakeAbsolute(image.png))");
+    }
+    REQUIRE(project.GetResourcesManager().GetResource("Image4").GetFile() ==
+            "FileNameFrom(MakeAbsolute(other.png))");
+  }
 }
@@ -7,6 +7,10 @@
  * @file Tests covering serialization to JSON.
  */
 #include "GDCore/Serialization/Serializer.h"
+
+#include <cstdio>
+#include <fstream>
+
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
@@ -15,6 +19,8 @@
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/SerializerElementArena.h"
+#include "GDCore/Tools/MappedFile.h"
 #include "GDCore/Tools/SystemStats.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
@@ -57,6 +63,40 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetChild("child2").GetDoubleValue() == 45.6);
   }
 
+  SECTION("Accessing children, in objects with many children") {
+    SerializerElement element;
+    for (int i = 0; i < 100; ++i) {
+      element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+    }
+    element.AddChild("child50").SetIntValue(500);
+
+    REQUIRE(element.GetAllChildren().size() == 100);
+    REQUIRE(element.HasChild("child0"));
+    REQUIRE(element.HasChild("child99"));
+    REQUIRE(!element.HasChild("child100"));
+    REQUIRE(element.HasChild("child100", "child42"));
+    REQUIRE(element.GetChild("child50").GetIntValue() == 500);
+    REQUIRE(element.GetChild("child100", 0, "child42").GetIntValue() == 42);
+    REQUIRE(element.GetIntAttribute("child99") == 99);
+
+    element.RemoveChild("child10");
+    REQUIRE(!element.HasChild("child10"));
+    REQUIRE(element.GetChild("child11").GetIntValue() == 11);
+    REQUIRE(element.GetChild("child99").GetIntValue() == 99);
+    element.AddChild("child10").SetIntValue(1000);
+    REQUIRE(element.GetChild("child10").GetIntValue() == 1000);
+
+    SerializerElement copiedElement = element;
+    copiedElement.RemoveChild("child20");
+    REQUIRE(element.HasChild("child20"));
+    REQUIRE(!copiedElement.HasChild("child20"));
+    REQUIRE(copiedElement.GetChild("child98").GetIntValue() == 98);
+
+    // Order of children is kept.
+    REQUIRE(element.GetAllChildren()[0].first == "child0");
+    REQUIRE(element.GetAllChildren()[99].first == "child10");
+  }
+
   SECTION("Adding multiple named children, in arrays") {
     SerializerElement element;
     element.ConsiderAsArrayOf("namedElement");
@@ -81,6 +121,29 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetChild(2).GetDoubleValue() == 45.6);
   }
 
+  SECTION("Elements allocated in an arena") {
+    SerializerElementArena arena(1024);
+    {
+      SerializerElement element(arena);
+      auto& array = element.AddChild("array");
+      array.ConsiderAsArray();
+      for (int i = 0; i < 100; ++i)
+        array.AddChild("").AddChild("value").SetIntValue(i);
+      element.AddChild("child").SetStringValue("value123");
+
+      REQUIRE(arena.GetReservedSize() > 1024);
+      REQUIRE(element.GetChild("array").GetChild(99).GetChild("value")
+                  .GetIntValue() == 99);
+      REQUIRE(element.GetChild("child").GetStringValue() == "value123");
+
+      // Copies are not allocated in the arena.
+      std::size_t reservedSize = arena.GetReservedSize();
+      SerializerElement copiedElement = element;
+      REQUIRE(arena.GetReservedSize() == reservedSize);
+      REQUIRE(Serializer::ToJSON(copiedElement) == Serializer::ToJSON(element));
+    }
+  }
+
   SECTION("Multiline strings") {
     SerializerElement element;
 
@@ -206,6 +269,134 @@ TEST_CASE("Serializer", "[common]") {
     }
   }
 
+  SECTION("Writing JSON to a sink") {
+    SerializerElement element;
+    element.SetStringAttribute("attr", "attribute");
+    auto& array = element.AddChild("array");
+    array.ConsiderAsArray();
+    for (int i = 0; i < 20000; ++i) array.AddChild("").SetIntValue(i);
+
+    gd::String json;
+    std::size_t chunksCount = 0;
+    Serializer::ToJSON(element, [&](const char* data, std::size_t size) {
+      json.Raw().append(data, size);
+      chunksCount++;
+    });
+    REQUIRE(chunksCount > 1);
+    REQUIRE(json == Serializer::ToJSON(element));
+  }
+
+  SECTION("Deeply nested and invalid JSON") {
+    gd::String deepJSON;
+    for (int i = 0; i < 10000; ++i) deepJSON += "[";
+    for (int i = 0; i < 10000; ++i) deepJSON += "]";
+    SerializerElement deepElement = Serializer::FromJSON(deepJSON);
+    REQUIRE(deepElement.ConsideredAsArray() == true);
+    REQUIRE(deepElement.GetChildrenCount() == 1);
+
+    SerializerElement invalidElement =
+        Serializer::FromJSON("{\"ok\":true,\"hello\":");
+    REQUIRE(invalidElement.GetAllChildren().empty());
+    REQUIRE(invalidElement.IsValueUndefined());
+  }
+
+  SECTION("JSON of a given size, from a mapped file") {
+    // The text is parsed up to the given size, even if not null-terminated.
+    gd::String json = "{\"hello\":\"world\"}{\"ignored\":true}";
+    SerializerElement element = Serializer::FromJSON(json.c_str(), 17);
+    REQUIRE(Serializer::ToJSON(element) == "{\"hello\":\"world\"}");
+
+    gd::String filename = gd::String("gdcore-mapped-file-test.json");
+    {
+      std::ofstream file(filename.ToLocale().c_str(), std::ios::binary);
+      file << "{\"hello\":[1,2,3]}";
+    }
+    {
+      gd::MappedFile mappedFile(filename);
+      REQUIRE(mappedFile.IsOpened());
+      REQUIRE(mappedFile.GetSize() == 17);
+      SerializerElement fileElement =
+          Serializer::FromJSON(mappedFile.GetData(), mappedFile.GetSize());
+      REQUIRE(Serializer::ToJSON(fileElement) == "{\"hello\":[1,2,3]}");
+    }
+    std::remove(filename.ToLocale().c_str());
+
+    gd::MappedFile missingFile("gdcore-missing-mapped-file-test.json");
+    REQUIRE_FALSE(missingFile.IsOpened());
+  }
+
+  SECTION("Binary format") {
+    gd::String originalJSON =
+        u8"{\"hello\":{\"world\":[{},[],3,\"4\",-123456,1.5,null,false],"
+        u8"\"Hello 官话 world\":\"官话\"},\"world\":[{\"world\":true},"
+        u8"{\"world\":\"\"}]}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+
+    std::string binary = Serializer::ToBinary(element);
+    REQUIRE(Serializer::IsBinary(binary.data(), binary.size()));
+    REQUIRE(!Serializer::IsBinary(originalJSON.c_str(), originalJSON.size()));
+    REQUIRE(binary.size() < originalJSON.size());
+
+    SerializerElement binaryElement = Serializer::FromBinary(binary);
+    REQUIRE(Serializer::ToJSON(binaryElement) == originalJSON);
+
+    // Truncated data is rejected.
+    SerializerElement truncatedElement =
+        Serializer::FromBinary(binary.data(), binary.size() - 1);
+    REQUIRE(truncatedElement.GetAllChildren().empty());
+
+    // Strings can contain null characters.
+    SerializerElement stringElement;
+    gd::String stringWithNull;
+    stringWithNull.Raw().assign("a\0b", 3);
+    stringElement.AddChild("string").SetStringValue(stringWithNull);
+    SerializerElement stringBinaryElement =
+        Serializer::FromBinary(Serializer::ToBinary(stringElement));
+    REQUIRE(stringBinaryElement.GetChild("string").GetStringValue().Raw() ==
+            stringWithNull.Raw());
+
+    // Integers out of the range of int are kept (as doubles).
+    SerializerElement bigIntegersElement =
+        Serializer::FromJSON("{\"big\":3000000000,\"small\":-3000000000}");
+    REQUIRE(bigIntegersElement.GetChild("big").GetDoubleValue() ==
+            3000000000.0);
+    SerializerElement bigIntegersBinaryElement =
+        Serializer::FromBinary(Serializer::ToBinary(bigIntegersElement));
+    REQUIRE(bigIntegersBinaryElement.GetChild("big").GetDoubleValue() ==
+            3000000000.0);
+    REQUIRE(bigIntegersBinaryElement.GetChild("small").GetDoubleValue() ==
+            -3000000000.0);
+
+    // Also when written as an integer in the binary data.
+    SerializerElement intElement;
+    intElement.AddChild("int").SetIntValue(1);
+    std::string intBinary = Serializer::ToBinary(intElement);
+    REQUIRE(intBinary.substr(intBinary.size() - 2) == "\x03\x02");
+    intBinary.pop_back();
+    intBinary += "\x80\xF8\x82\xAD\x16";  // 3000000000, zigzag encoded.
+    SerializerElement intBinaryElement = Serializer::FromBinary(intBinary);
+    REQUIRE(intBinaryElement.GetChild("int").GetDoubleValue() == 3000000000.0);
+
+    // Data nested too deeply is rejected.
+    std::string deepBinary = binary.substr(0, 4);
+    for (std::size_t i = 0; i < 100000; ++i) deepBinary += "\x06\x01";
+    deepBinary.push_back('\0');
+    SerializerElement deepElement = Serializer::FromBinary(deepBinary);
+    REQUIRE(deepElement.GetAllChildren().empty());
+  }
+
+  SECTION("Null values") {
+    gd::String originalJSON = "{\"a\":null,\"b\":[null,1]}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+    REQUIRE(element.GetChild("a").IsNull());
+    REQUIRE(element.GetChild("a").IsValueUndefined());
+    REQUIRE(element.GetIntAttribute("a", 42) == 42);
+    REQUIRE(Serializer::ToJSON(element) == originalJSON);
+
+    element.GetChild("a").AddChild("c").SetIntValue(1);
+    REQUIRE(Serializer::ToJSON(element) == "{\"a\":{\"c\":1},\"b\":[null,1]}");
+  }
+
   SECTION("(Deprecated) attributes") {
     gd::String originalJSON = "{\"ok\":true,\"hello\":\"world\"}";
     SerializerElement element = Serializer::FromJSON(originalJSON);
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <limits>
 #include <map>
 
 #include "GDCore/CommonTools.h"
@@ -36,4 +37,64 @@ TEST_CASE("String", "[common]") {
     REQUIRE(str.RemoveConsecutiveOccurrences(str.begin(), str.end(), ' ') ==
             "Set animation of NewSprite to ");
   }
+
+  SECTION("Size, indexing and IsAscii") {
+    gd::String ascii = "Hello World";
+    REQUIRE(ascii.size() == 11);
+    REQUIRE(ascii.IsAscii());
+    REQUIRE(ascii[0] == U'H');
+    REQUIRE(ascii[10] == U'd');
+
+    gd::String unicode = u8"Opacité: 100€ 😀!";
+    REQUIRE(unicode.size() == 16);
+    REQUIRE_FALSE(unicode.IsAscii());
+    REQUIRE(unicode[5] == U't');
+    REQUIRE(unicode[6] == U'é');
+    REQUIRE(unicode[12] == U'€');
+    REQUIRE(unicode[14] == U'😀');
+    REQUIRE(unicode[15] == U'!');
+
+    REQUIRE(gd::String().size() == 0);
+    REQUIRE(gd::String().IsAscii());
+  }
+
+  SECTION("From numbers") {
+    REQUIRE(gd::String::From(0) == "0");
+    REQUIRE(gd::String::From(-42) == "-42");
+    REQUIRE(gd::String::From(std::numeric_limits<long long>::min()) ==
+            "-9223372036854775808");
+    REQUIRE(gd::String::From(std::numeric_limits<std::size_t>::max()) ==
+            gd::String(std::to_string(std::numeric_limits<std::size_t>::max()).c_str()));
+    REQUIRE(gd::String::From(1.5) == "1.5");
+    REQUIRE(gd::String::From(-0.1f) == "-0.1");
+    REQUIRE(gd::String::From(3.14159265) == "3.14159");
+    REQUIRE(gd::String::From(1234567.0) == "1.23457e+06");
+    REQUIRE(gd::String::From(1e-7) == "1e-07");
+    REQUIRE(gd::String::From('a') == "a");
+    REQUIRE(gd::String::From(true) == "1");
+  }
+
+  SECTION("To numbers") {
+    REQUIRE(gd::String("42").To<int>() == 42);
+    REQUIRE(gd::String("-42").To<int>() == -42);
+    REQUIRE(gd::String("+7").To<long>() == 7);
+    REQUIRE(gd::String("12.9").To<int>() == 12);
+    REQUIRE(gd::String(" 5").To<int>() == 5);
+    REQUIRE(gd::String("").To<int>() == 0);
+    REQUIRE(gd::String("abc").To<int>() == 0);
+    REQUIRE(gd::String("99999999999").To<int>() ==
+            std::numeric_limits<int>::max());
+    REQUIRE(gd::String("99999999999").To<long long>() == 99999999999LL);
+    REQUIRE(gd::String("12").To<std::size_t>() == 12);
+
+    REQUIRE(gd::String("1.5").To<double>() == 1.5);
+    REQUIRE(gd::String("-2.5e3").To<double>() == -2500);
+    REQUIRE(gd::String(".5").To<float>() == 0.5f);
+    REQUIRE(gd::String("0.1").To<float>() == 0.1f);
+    REQUIRE(gd::String("3.5px").To<double>() == 3.5);
+    REQUIRE(gd::String("0x10").To<double>() == 0);
+    REQUIRE(gd::String("").To<double>() == 0);
+    REQUIRE(gd::String("1e999").To<double>() ==
+            std::numeric_limits<double>::max());
+  }
 }
\ No newline at end of file
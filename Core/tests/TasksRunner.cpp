@@ -0,0 +1,34 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/TasksRunner.h"
+
+#include <vector>
+
+#include "catch.hpp"
+
+TEST_CASE("TasksRunner", "[common]") {
+  SECTION("Every task is run once") {
+    for (std::size_t threadsCount : {0, 1, 2, 4, 100}) {
+      std::vector<int> runsCount(50, 0);
+      gd::TasksRunner::Run(runsCount.size(),
+                           threadsCount,
+                           [&runsCount](std::size_t index) {
+                             runsCount[index]++;
+                           });
+
+      for (std::size_t i = 0; i < runsCount.size(); i++) {
+        INFO("Task " << i << " with " << threadsCount << " threads");
+        REQUIRE(runsCount[i] == 1);
+      }
+    }
+  }
+
+  SECTION("No task") {
+    bool hasRun = false;
+    gd::TasksRunner::Run(0, 4, [&hasRun](std::size_t) { hasRun = true; });
+    REQUIRE_FALSE(hasRun);
+  }
+}
@@ -0,0 +1,50 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/TextSearchPattern.h"
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("TextSearchPattern", "[common]") {
+  SECTION("Search with the same case") {
+    gd::TextSearchPattern pattern("Player", true);
+    REQUIRE(pattern.IsFoundIn("Player"));
+    REQUIRE(pattern.IsFoundIn("MyPlayer.X()"));
+    REQUIRE(pattern.IsFoundIn("PlayPlayer"));
+    REQUIRE_FALSE(pattern.IsFoundIn("player"));
+    REQUIRE_FALSE(pattern.IsFoundIn("Playe"));
+    REQUIRE_FALSE(pattern.IsFoundIn(""));
+  }
+
+  SECTION("Search ignoring the case") {
+    gd::TextSearchPattern pattern("pLaYeR", false);
+    REQUIRE(pattern.IsFoundIn("MyPlayer.X()"));
+    REQUIRE(pattern.IsFoundIn("PLAYER"));
+    REQUIRE_FALSE(pattern.IsFoundIn("Playe"));
+
+    // Strings with other characters than ASCII are case-folded.
+    REQUIRE(pattern.IsFoundIn("Le PLAYER évolue"));
+    gd::TextSearchPattern germanPattern("STRASSE", false);
+    REQUIRE(germanPattern.IsFoundIn("Die Straße"));
+    gd::TextSearchPattern accentsPattern("ÉVOLUE", false);
+    REQUIRE(accentsPattern.IsFoundIn("Le joueur évolue"));
+    REQUIRE_FALSE(accentsPattern.IsFoundIn("Le joueur evolue"));
+  }
+
+  SECTION("Give the same results as searching in gd::String") {
+    const gd::String texts[] = {
+        "", "a", "abcabd", "ABCABD", "éèàù", "ß", "Player1", "xxabdab"};
+    const gd::String searches[] = {"", "a", "b", "abd", "AbD", "È", "ss", "1"};
+    for (const auto &text : texts) {
+      for (const auto &search : searches) {
+        REQUIRE(gd::TextSearchPattern(search, true).IsFoundIn(text) ==
+                (text.find(search) != gd::String::npos));
+        REQUIRE(gd::TextSearchPattern(search, false).IsFoundIn(text) ==
+                (text.FindCaseInsensitive(search) != gd::String::npos));
+      }
+    }
+  }
+}
@@ -0,0 +1,69 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/TextureAtlasPacker.h"
+
+#include <vector>
+
+#include "catch.hpp"
+
+namespace {
+
+gd::TextureAtlasPacker::Frame MakeImage(const gd::String &name,
+                                        unsigned int width,
+                                        unsigned int height) {
+  return gd::TextureAtlasPacker::Frame{name, 0, 0, width, height};
+}
+
+}  // namespace
+
+TEST_CASE("TextureAtlasPacker", "[common][resources]") {
+  SECTION("Pack images in rows sorted by height") {
+    gd::TextureAtlasPacker packer(100, 2);
+    auto atlases = packer.Pack({MakeImage("Small", 20, 10),
+                                MakeImage("Tall", 30, 40),
+                                MakeImage("Wide", 60, 40),
+                                MakeImage("Medium", 50, 20)},
+                               true);
+
+    REQUIRE(atlases.size() == 1);
+    const auto &atlas = atlases[0];
+    REQUIRE(atlas.smoothed == true);
+    REQUIRE(atlas.frames.size() == 4);
+
+    // The tallest images are on the first row, then a new row is started.
+    REQUIRE(atlas.frames[0].resourceName == "Wide");
+    REQUIRE(atlas.frames[0].x == 0);
+    REQUIRE(atlas.frames[0].y == 0);
+    REQUIRE(atlas.frames[1].resourceName == "Tall");
+    REQUIRE(atlas.frames[1].x == 62);
+    REQUIRE(atlas.frames[1].y == 0);
+    REQUIRE(atlas.frames[2].resourceName == "Medium");
+    REQUIRE(atlas.frames[2].x == 0);
+    REQUIRE(atlas.frames[2].y == 42);
+    REQUIRE(atlas.frames[3].resourceName == "Small");
+    REQUIRE(atlas.frames[3].x == 52);
+    REQUIRE(atlas.frames[3].y == 42);
+    REQUIRE(atlas.width == 92);
+    REQUIRE(atlas.height == 62);
+  }
+
+  SECTION("Start new atlases when full, and skip too large images") {
+    gd::TextureAtlasPacker packer(64, 0);
+    auto atlases = packer.Pack({MakeImage("A", 64, 64),
+                                MakeImage("B", 32, 64),
+                                MakeImage("C", 32, 64),
+                                MakeImage("TooLarge", 65, 10)},
+                               false);
+
+    REQUIRE(atlases.size() == 2);
+    REQUIRE(atlases[0].frames.size() == 1);
+    REQUIRE(atlases[0].frames[0].resourceName == "A");
+    REQUIRE(atlases[1].frames.size() == 2);
+    REQUIRE(atlases[1].frames[1].x == 32);
+    REQUIRE(atlases[1].width == 64);
+    REQUIRE(atlases[1].smoothed == false);
+  }
+}
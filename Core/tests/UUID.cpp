@@ -0,0 +1,32 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/UUID/UUID.h"
+
+#include <set>
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("UUID", "[common]") {
+  SECTION("Generate version 4 UUIDs") {
+    std::set<gd::String> uuids;
+    for (std::size_t i = 0; i < 1000; ++i) {
+      gd::String uuid = gd::UUID::MakeUuid4();
+      REQUIRE(uuid.size() == 36);
+      for (std::size_t j : {8, 13, 18, 23}) REQUIRE(uuid.Raw()[j] == '-');
+      REQUIRE(uuid.Raw()[14] == '4');
+      const char variant = uuid.Raw()[19];
+      REQUIRE((variant == '8' || variant == '9' || variant == 'a' ||
+               variant == 'b'));
+      for (char character : uuid.Raw()) {
+        REQUIRE(((character >= '0' && character <= '9') ||
+                 (character >= 'a' && character <= 'f') || character == '-'));
+      }
+      uuids.insert(uuid);
+    }
+    REQUIRE(uuids.size() == 1000);
+  }
+}
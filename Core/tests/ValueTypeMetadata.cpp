@@ -0,0 +1,61 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the kinds of the types of parameters
+ */
+#include "GDCore/Extensions/Metadata/ValueTypeMetadata.h"
+
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("ValueTypeMetadata", "[common]") {
+  SECTION("Kinds are resolved from the type") {
+    gd::ValueTypeMetadata valueTypeMetadata;
+    REQUIRE(!valueTypeMetadata.IsNumber());
+    REQUIRE(!valueTypeMetadata.IsObject());
+
+    valueTypeMetadata.SetName("expression");
+    REQUIRE(valueTypeMetadata.IsNumber());
+    REQUIRE(!valueTypeMetadata.IsString());
+
+    valueTypeMetadata.SetName("sceneName");
+    REQUIRE(valueTypeMetadata.IsString());
+    REQUIRE(valueTypeMetadata.IsStringExpression());
+    REQUIRE(!valueTypeMetadata.IsNumber());
+
+    valueTypeMetadata.SetName("key");
+    REQUIRE(valueTypeMetadata.IsString());
+    REQUIRE(!valueTypeMetadata.IsStringExpression());
+
+    valueTypeMetadata.SetName("objectList");
+    REQUIRE(valueTypeMetadata.IsObject());
+    REQUIRE(!valueTypeMetadata.IsBehavior());
+
+    valueTypeMetadata.SetName("behavior");
+    REQUIRE(valueTypeMetadata.IsBehavior());
+
+    valueTypeMetadata.SetName("yesorno");
+    REQUIRE(valueTypeMetadata.IsBoolean());
+
+    valueTypeMetadata.SetName("scenevar");
+    REQUIRE(valueTypeMetadata.IsVariableExpression());
+
+    valueTypeMetadata.SetName("spineResource");
+    REQUIRE(valueTypeMetadata.IsResource());
+    REQUIRE(!valueTypeMetadata.IsString());
+  }
+
+  SECTION("Kinds are resolved when unserialized") {
+    gd::ValueTypeMetadata valueTypeMetadata;
+    valueTypeMetadata.SetName("imageResource");
+
+    gd::SerializerElement element;
+    valueTypeMetadata.SerializeTo(element);
+    gd::ValueTypeMetadata unserializedValueTypeMetadata;
+    unserializedValueTypeMetadata.UnserializeFrom(element);
+    REQUIRE(unserializedValueTypeMetadata.IsResource());
+  }
+}
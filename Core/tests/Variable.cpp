@@ -91,6 +91,36 @@ TEST_CASE("Variable", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(variable3.GetChild("Child2").GetValue() == 44);
   }
+
+  SECTION("Copy assignment of arrays") {
+    gd::Variable variable1;
+    variable1.CastTo(gd::Variable::Type::Array);
+    variable1.PushNew().SetValue(1);
+    variable1.PushNew().SetValue(2);
+
+    gd::Variable variable2;
+    variable2.CastTo(gd::Variable::Type::Array);
+    variable2.PushNew().SetValue(3);
+    variable2 = variable1;
+
+    REQUIRE(variable2.GetChildrenCount() == 2);
+    REQUIRE(variable2.GetAtIndex(0).GetValue() == 1);
+    REQUIRE(variable2.GetAtIndex(1).GetValue() == 2);
+  }
+
+  SECTION("Move") {
+    gd::Variable variable1;
+    gd::Variable &child = variable1.GetChild("Child1");
+    child.SetString("Hello World");
+
+    gd::Variable variable2(std::move(variable1));
+    REQUIRE(&variable2.GetChild("Child1") == &child);
+
+    gd::Variable variable3;
+    variable3 = std::move(variable2);
+    REQUIRE(&variable3.GetChild("Child1") == &child);
+    REQUIRE(variable3.GetChild("Child1").GetString() == "Hello World");
+  }
   SECTION("Can find identical number variables") {
     gd::Variable variable;
     variable.SetValue(123);
@@ -49,4 +49,50 @@ TEST_CASE("VariablesContainer", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(container3.Get("Variable2").GetValue() == 44);
   }
+
+  SECTION("Find variables after they are inserted, moved or removed") {
+    gd::VariablesContainer container;
+    container.InsertNew("Variable1");
+    container.InsertNew("Variable2");
+    container.InsertNew("Variable3");
+    container.InsertNew("Variable0", 0);
+    REQUIRE(container.GetPosition("Variable0") == 0);
+    REQUIRE(container.GetPosition("Variable3") == 3);
+
+    container.Move(0, 3);
+    REQUIRE(container.GetPosition("Variable0") == 3);
+    REQUIRE(container.GetPosition("Variable1") == 0);
+
+    container.Swap(0, 2);
+    REQUIRE(container.GetPosition("Variable3") == 0);
+    REQUIRE(container.GetPosition("Variable1") == 2);
+
+    container.Remove("Variable2");
+    REQUIRE(container.Has("Variable2") == false);
+    REQUIRE(container.GetPosition("Variable2") == gd::String::npos);
+    REQUIRE(container.GetPosition("Variable1") == 1);
+    REQUIRE(container.GetPosition("Variable0") == 2);
+
+    REQUIRE(container.Rename("Variable1", "RenamedVariable") == true);
+    REQUIRE(container.Has("Variable1") == false);
+    REQUIRE(container.GetPosition("RenamedVariable") == 1);
+    REQUIRE(container.Rename("Variable3", "Variable0") == false);
+
+    container.Clear();
+    REQUIRE(container.Has("Variable0") == false);
+  }
+
+  SECTION("Find the first variable of several with the same name") {
+    gd::VariablesContainer container;
+    container.InsertNew("Variable1").SetValue(1);
+    container.InsertNew("Variable1").SetValue(2);
+    REQUIRE(container.Get("Variable1").GetValue() == 1);
+
+    container.Swap(0, 1);
+    REQUIRE(container.Get("Variable1").GetValue() == 2);
+
+    REQUIRE(container.Rename("Variable1", "Variable2") == true);
+    REQUIRE(container.Get("Variable1").GetValue() == 1);
+    REQUIRE(container.Get("Variable2").GetValue() == 2);
+  }
 }
@@ -27,6 +27,7 @@ namespace gdjs {
       tint: string | undefined;
       isCastingShadow: boolean;
       isReceivingShadow: boolean;
+      isInstancedRenderingEnabled: boolean | undefined;
       materialType: 'Basic' | 'StandardWithoutMetalness';
     };
   }
@@ -77,6 +78,7 @@ namespace gdjs {
     _tint: string;
     _isCastingShadow: boolean = true;
     _isReceivingShadow: boolean = true;
+    private _isInstancedRenderingEnabled: boolean = true;
 
     constructor(
       instanceContainer: gdjs.RuntimeInstanceContainer,
@@ -127,6 +129,8 @@ namespace gdjs {
       this._tint = objectData.content.tint || '255;255;255';
       this._isCastingShadow = objectData.content.isCastingShadow || false;
       this._isReceivingShadow = objectData.content.isReceivingShadow || false;
+      this._isInstancedRenderingEnabled =
+        objectData.content.isInstancedRenderingEnabled !== false;
 
       this._materialType = this._convertMaterialType(
         objectData.content.materialType
@@ -448,13 +452,23 @@ namespace gdjs {
       ) {
         this.updateShadowReceiving(newObjectData.content.isReceivingShadow);
       }
+      if (
+        oldObjectData.content.isInstancedRenderingEnabled !==
+        newObjectData.content.isInstancedRenderingEnabled
+      ) {
+        this.setInstancedRenderingEnabled(
+          newObjectData.content.isInstancedRenderingEnabled !== false
+        );
+      }
 
       return true;
     }
 
-    getNetworkSyncData(): Cube3DObjectNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): Cube3DObjectNetworkSyncData {
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         mt: this._materialType,
         fo: this._facesOrientation,
         bfu: this._backFaceUpThroughWhichAxisRotation,
@@ -557,6 +571,26 @@ namespace gdjs {
       this._isReceivingShadow = value;
       this._renderer.updateShadowReceiving();
     }
+
+    /**
+     * Return true if the box can be drawn at once with the other boxes having
+     * the same faces, tint and shadows.
+     */
+    isInstancedRenderingEnabled(): boolean {
+      return this._isInstancedRenderingEnabled;
+    }
+
+    /**
+     * Allow (or forbid) the box to be drawn at once with the other boxes
+     * having the same faces, tint and shadows.
+     */
+    setInstancedRenderingEnabled(enable: boolean): void {
+      if (this._isInstancedRenderingEnabled === enable) {
+        return;
+      }
+      this._isInstancedRenderingEnabled = enable;
+      this._renderer._updateInstancedRendering();
+    }
   }
 
   export namespace Cube3DRuntimeObject {
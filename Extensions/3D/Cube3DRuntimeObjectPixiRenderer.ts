@@ -69,6 +69,7 @@ namespace gdjs {
   class Cube3DRuntimeObjectPixiRenderer extends gdjs.RuntimeObject3DRenderer {
     private _cube3DRuntimeObject: gdjs.Cube3DRuntimeObject;
     private _boxMesh: THREE.Mesh;
+    private _instancedMeshesItem: gdjs.InstancedMeshesBatchItem;
 
     constructor(
       runtimeObject: gdjs.Cube3DRuntimeObject,
@@ -86,6 +87,8 @@ namespace gdjs {
       super(runtimeObject, instanceContainer, boxMesh);
       this._boxMesh = boxMesh;
       this._cube3DRuntimeObject = runtimeObject;
+      this._instancedMeshesItem =
+        gdjs.instancedMeshesBatcher.createItem(boxMesh);
 
       boxMesh.receiveShadow = this._cube3DRuntimeObject._isReceivingShadow;
       boxMesh.castShadow = this._cube3DRuntimeObject._isCastingShadow;
@@ -95,6 +98,65 @@ namespace gdjs {
       this.updateTint();
     }
 
+    updatePosition() {
+      super.updatePosition();
+      this._instancedMeshesItem.invalidate();
+    }
+
+    updateRotation() {
+      super.updateRotation();
+      this._instancedMeshesItem.invalidate();
+    }
+
+    updateVisibility() {
+      this._updateInstancedRendering();
+    }
+
+    /**
+     * Draw the box with the other ones having the same faces, tint and
+     * shadows (in the same layer) when possible, or alone otherwise.
+     */
+    _updateInstancedRendering() {
+      const key = this._getInstancedRenderingKey();
+      this._instancedMeshesItem.setKey(key);
+      this._boxMesh.visible = !this._object.isHidden() && key === null;
+    }
+
+    private _getInstancedRenderingKey(): string | null {
+      const object = this._cube3DRuntimeObject;
+      if (
+        object.isHidden() ||
+        !object.isInstancedRenderingEnabled() ||
+        // Transparent faces must be sorted by the distance of each box.
+        object.shouldUseTransparentTexture()
+      ) {
+        return null;
+      }
+      for (let faceIndex = 0; faceIndex < 6; faceIndex++) {
+        // The texture coordinates depend on the size of the box.
+        if (
+          object.isFaceAtIndexVisible(faceIndex) &&
+          object.shouldRepeatTextureOnFaceAtIndex(faceIndex)
+        ) {
+          return null;
+        }
+      }
+      const materials = this._boxMesh.material as THREE.Material[];
+      let key = '';
+      for (let index = 0; index < materials.length; index++) {
+        key += materials[index].uuid + ';';
+      }
+      return (
+        key +
+        object.getFacesOrientation() +
+        object.getBackFaceUpThroughWhichAxisRotation() +
+        (this._boxMesh.castShadow ? '1' : '0') +
+        (this._boxMesh.receiveShadow ? '1' : '0') +
+        ';' +
+        object.getColor()
+      );
+    }
+
     updateTint() {
       const tints: number[] = [];
 
@@ -114,13 +176,16 @@ namespace gdjs {
         'color',
         new THREE.BufferAttribute(new Float32Array(tints), 3)
       );
+      this._updateInstancedRendering();
     }
     updateShadowCasting() {
       this._boxMesh.castShadow = this._cube3DRuntimeObject._isCastingShadow;
+      this._updateInstancedRendering();
     }
     updateShadowReceiving() {
       this._boxMesh.receiveShadow =
         this._cube3DRuntimeObject._isReceivingShadow;
+      this._updateInstancedRendering();
     }
 
     updateFace(faceIndex: integer) {
@@ -134,11 +199,13 @@ namespace gdjs {
       if (this._cube3DRuntimeObject.isFaceAtIndexVisible(faceIndex)) {
         this.updateTextureUvMapping(faceIndex);
       }
+      this._updateInstancedRendering();
     }
 
     updateSize(): void {
       super.updateSize();
       this.updateTextureUvMapping();
+      this._instancedMeshesItem.invalidate();
     }
 
     /**
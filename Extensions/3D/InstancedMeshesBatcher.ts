@@ -0,0 +1,279 @@
+namespace gdjs {
+  /**
+   * A mesh that can be drawn by a {@link gdjs.InstancedMeshesBatcher}.
+   *
+   * The mesh stays in the scene (so that its position, rotation and scale
+   * can still be read and changed) but must be hidden while it has a key.
+   * A mesh removed from its layer is removed from its batch.
+   */
+  export class InstancedMeshesBatchItem {
+    mesh: THREE.Mesh;
+    /** The key of the batch the mesh should be in, or `null` if it must be drawn alone. */
+    key: string | null = null;
+    batch: gdjs.InstancedMeshesBatch | null = null;
+    /** The index of the mesh in the instances of its batch. */
+    index: integer = -1;
+    isDirty: boolean = false;
+    private _batcher: gdjs.InstancedMeshesBatcher;
+
+    constructor(mesh: THREE.Mesh, batcher: gdjs.InstancedMeshesBatcher) {
+      this.mesh = mesh;
+      this._batcher = batcher;
+    }
+
+    /**
+     * Draw the mesh with the other ones having the same key (and being in the
+     * same layer).
+     *
+     * Meshes with the same key must have the same geometry, the same
+     * materials and the same shadow settings.
+     * @param key The key of the batch, or `null` to draw the mesh alone.
+     */
+    setKey(key: string | null): void {
+      if (this.key === key) {
+        return;
+      }
+      this.key = key;
+      this.invalidate();
+    }
+
+    /**
+     * Signal that the transformation of the mesh changed.
+     */
+    invalidate(): void {
+      if (this.isDirty) {
+        return;
+      }
+      this.isDirty = true;
+      this._batcher._addDirtyItem(this);
+    }
+  }
+
+  /**
+   * The meshes of a layer sharing the same geometry and materials, drawn
+   * with a `THREE.InstancedMesh`.
+   */
+  export class InstancedMeshesBatch {
+    key: string;
+    parent: THREE.Object3D;
+    items: gdjs.InstancedMeshesBatchItem[] = [];
+    private _geometry: THREE.BufferGeometry;
+    private _materials: THREE.Material | THREE.Material[];
+    private _castShadow: boolean;
+    private _receiveShadow: boolean;
+    private _instancedMesh: THREE.InstancedMesh | null = null;
+    private _needsRebuild: boolean = true;
+    private _dirtyStart: integer = Number.MAX_SAFE_INTEGER;
+    private _dirtyEnd: integer = -1;
+
+    constructor(
+      key: string,
+      parent: THREE.Object3D,
+      modelMesh: THREE.Mesh
+    ) {
+      this.key = key;
+      this.parent = parent;
+      // The mesh geometry and materials can be changed later on, so the batch
+      // keeps its own.
+      this._geometry = modelMesh.geometry.clone();
+      this._materials = Array.isArray(modelMesh.material)
+        ? modelMesh.material.slice()
+        : modelMesh.material;
+      this._castShadow = modelMesh.castShadow;
+      this._receiveShadow = modelMesh.receiveShadow;
+    }
+
+    addItem(item: gdjs.InstancedMeshesBatchItem): void {
+      item.batch = this;
+      item.index = this.items.length;
+      this.items.push(item);
+      if (
+        !this._instancedMesh ||
+        this.items.length > this._instancedMesh.instanceMatrix.count
+      ) {
+        this._needsRebuild = true;
+      }
+      this.invalidateIndex(item.index);
+    }
+
+    removeItem(item: gdjs.InstancedMeshesBatchItem): void {
+      if (item.batch !== this) {
+        return;
+      }
+      // Move the last instance to the place of the removed one.
+      const lastItem = this.items.pop()!;
+      if (lastItem !== item) {
+        this.items[item.index] = lastItem;
+        lastItem.index = item.index;
+        this.invalidateIndex(item.index);
+      }
+      item.batch = null;
+      item.index = -1;
+    }
+
+    invalidateIndex(index: integer): void {
+      this._dirtyStart = Math.min(this._dirtyStart, index);
+      this._dirtyEnd = Math.max(this._dirtyEnd, index);
+    }
+
+    /**
+     * Copy the transformations of the changed meshes in the instance buffer.
+     */
+    update(): void {
+      const items = this.items;
+      if (this._needsRebuild) {
+        this._rebuild();
+      } else if (this._instancedMesh && this._dirtyEnd >= this._dirtyStart) {
+        const instancedMesh = this._instancedMesh;
+        const dirtyEnd = Math.min(this._dirtyEnd, items.length - 1);
+        for (let index = this._dirtyStart; index <= dirtyEnd; index++) {
+          const mesh = items[index].mesh;
+          mesh.updateMatrix();
+          instancedMesh.setMatrixAt(index, mesh.matrix);
+        }
+        instancedMesh.count = items.length;
+        const instanceMatrix = instancedMesh.instanceMatrix;
+        instanceMatrix.clearUpdateRanges();
+        if (dirtyEnd >= this._dirtyStart) {
+          instanceMatrix.addUpdateRange(
+            this._dirtyStart * 16,
+            (dirtyEnd - this._dirtyStart + 1) * 16
+          );
+        }
+        instanceMatrix.needsUpdate = true;
+      }
+      this._dirtyStart = Number.MAX_SAFE_INTEGER;
+      this._dirtyEnd = -1;
+    }
+
+    private _rebuild(): void {
+      this._needsRebuild = false;
+      const items = this.items;
+      if (this._instancedMesh) {
+        this.parent.remove(this._instancedMesh);
+        this._instancedMesh.dispose();
+        this._instancedMesh = null;
+      }
+
+      // Leave some room for the meshes added later.
+      const capacity = Math.max(16, Math.ceil(items.length * 1.5));
+      const instancedMesh = new THREE.InstancedMesh(
+        this._geometry,
+        this._materials,
+        capacity
+      );
+      instancedMesh.instanceMatrix.setUsage(THREE.DynamicDrawUsage);
+      instancedMesh.castShadow = this._castShadow;
+      instancedMesh.receiveShadow = this._receiveShadow;
+      // The bounding sphere of the geometry is not the one of the instances.
+      instancedMesh.frustumCulled = false;
+      for (let index = 0; index < items.length; index++) {
+        const mesh = items[index].mesh;
+        mesh.updateMatrix();
+        instancedMesh.setMatrixAt(index, mesh.matrix);
+      }
+      instancedMesh.count = items.length;
+      this.parent.add(instancedMesh);
+      this._instancedMesh = instancedMesh;
+    }
+
+    /**
+     * Remove the instanced mesh from the layer.
+     */
+    dispose(): void {
+      if (this._instancedMesh) {
+        this.parent.remove(this._instancedMesh);
+        this._instancedMesh.dispose();
+        this._instancedMesh = null;
+      }
+      this._geometry.dispose();
+    }
+  }
+
+  /**
+   * Draw the meshes sharing the same geometry and materials with one
+   * `THREE.InstancedMesh` per layer, instead of one draw call per mesh.
+   *
+   * The items are updated after the events of each frame, and only the
+   * instances of the meshes that changed are sent to the GPU.
+   */
+  export class InstancedMeshesBatcher {
+    private _batches = new Map<string, gdjs.InstancedMeshesBatch>();
+    private _dirtyItems: gdjs.InstancedMeshesBatchItem[] = [];
+    private _batchedItems = new Set<gdjs.InstancedMeshesBatchItem>();
+
+    /**
+     * Create an item for a mesh. Call `setKey` on it to draw it in a batch.
+     */
+    createItem(mesh: THREE.Mesh): gdjs.InstancedMeshesBatchItem {
+      return new gdjs.InstancedMeshesBatchItem(mesh, this);
+    }
+
+    /**
+     * Update the batches with the meshes that changed since the last call.
+     */
+    update(): void {
+      // Meshes moved to another layer (or removed from theirs) must change
+      // of batch.
+      for (const item of this._batchedItems) {
+        if (item.batch && item.mesh.parent !== item.batch.parent) {
+          item.invalidate();
+        }
+      }
+
+      const dirtyItems = this._dirtyItems;
+      for (let i = 0; i < dirtyItems.length; i++) {
+        const item = dirtyItems[i];
+        item.isDirty = false;
+        const parent = item.mesh.parent;
+        const batch = item.batch;
+        if (
+          batch &&
+          (item.key === null ||
+            batch.key !== item.key ||
+            batch.parent !== parent)
+        ) {
+          batch.removeItem(item);
+          this._batchedItems.delete(item);
+        }
+        if (item.key === null || !parent) {
+          continue;
+        }
+        if (item.batch) {
+          item.batch.invalidateIndex(item.index);
+          continue;
+        }
+        const batchId = parent.id + '|' + item.key;
+        let newBatch = this._batches.get(batchId);
+        if (!newBatch) {
+          newBatch = new gdjs.InstancedMeshesBatch(item.key, parent, item.mesh);
+          this._batches.set(batchId, newBatch);
+        }
+        newBatch.addItem(item);
+        this._batchedItems.add(item);
+      }
+      dirtyItems.length = 0;
+
+      for (const [batchId, batch] of this._batches) {
+        if (batch.items.length === 0) {
+          batch.dispose();
+          this._batches.delete(batchId);
+          continue;
+        }
+        batch.update();
+      }
+    }
+
+    /** @internal */
+    _addDirtyItem(item: gdjs.InstancedMeshesBatchItem): void {
+      this._dirtyItems.push(item);
+    }
+  }
+
+  /** The batcher used by the 3D objects of the game. */
+  export const instancedMeshesBatcher = new gdjs.InstancedMeshesBatcher();
+
+  gdjs.registerRuntimeScenePostEventsCallback(() => {
+    instancedMeshesBatcher.update();
+  });
+}
@@ -861,7 +861,8 @@ module.exports = {
         propertyName === 'bottomFaceResourceRepeat' ||
         propertyName === 'enableTextureTransparency' ||
         propertyName === 'isCastingShadow' ||
-        propertyName === 'isReceivingShadow'
+        propertyName === 'isReceivingShadow' ||
+        propertyName === 'isInstancedRenderingEnabled'
       ) {
         objectContent[propertyName] = newValue === '1';
         return true;
@@ -1109,6 +1110,20 @@ module.exports = {
         .setLabel(_('Shadow receiving'))
         .setGroup(_('Lighting'));
 
+      objectProperties
+        .getOrCreate('isInstancedRenderingEnabled')
+        .setValue(
+          objectContent.isInstancedRenderingEnabled !== false ? 'true' : 'false'
+        )
+        .setType('boolean')
+        .setLabel(_('Draw with the other identical boxes'))
+        .setDescription(
+          _(
+            'Boxes with the same faces, tint and shadows are drawn at once, which is faster. Boxes with transparent or repeated textures are always drawn separately.'
+          )
+        )
+        .setAdvanced(true);
+
       return objectProperties;
     };
     Cube3DObject.content = {
@@ -1140,6 +1155,7 @@ module.exports = {
       tint: '255;255;255',
       isCastingShadow: true,
       isReceivingShadow: true,
+      isInstancedRenderingEnabled: true,
     };
 
     Cube3DObject.updateInitialInstanceProperty = function (
@@ -1172,6 +1188,7 @@ module.exports = {
       .markAsRenderedIn3D()
       .setIncludeFile('Extensions/3D/A_RuntimeObject3D.js')
       .addIncludeFile('Extensions/3D/A_RuntimeObject3DRenderer.js')
+      .addIncludeFile('Extensions/3D/InstancedMeshesBatcher.js')
       .addIncludeFile('Extensions/3D/Cube3DRuntimeObject.js')
       .addIncludeFile('Extensions/3D/Cube3DRuntimeObjectPixiRenderer.js');
 
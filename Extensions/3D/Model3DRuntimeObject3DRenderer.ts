@@ -28,10 +28,24 @@ namespace gdjs {
   const traverseToRemoveMetalnessFromMeshes = (node: THREE.Object3D) =>
     node.traverse(removeMetalnessFromMesh);
 
+  /**
+   * The basic materials converted from the materials of the models. They are
+   * shared by every instance instead of being created for each of them.
+   */
+  const basicMaterials = new WeakMap<
+    THREE.Material,
+    THREE.MeshBasicMaterial
+  >();
+
   const convertToBasicMaterial = (
     material: THREE.Material
   ): THREE.MeshBasicMaterial => {
+    const existingBasicMaterial = basicMaterials.get(material);
+    if (existingBasicMaterial) {
+      return existingBasicMaterial;
+    }
     const basicMaterial = new THREE.MeshBasicMaterial();
+    basicMaterials.set(material, basicMaterial);
     //@ts-ignore
     if (material.color) {
       //@ts-ignore
@@ -0,0 +1,87 @@
+// @ts-check
+describe('gdjs.InstancedMeshesBatcher', () => {
+  /**
+   * @param {THREE.Object3D} parent
+   * @returns {THREE.InstancedMesh[]}
+   */
+  const getInstancedMeshes = (parent) =>
+    // @ts-ignore
+    parent.children.filter((child) => child instanceof THREE.InstancedMesh);
+
+  const geometry = new THREE.BoxGeometry(1, 1, 1);
+  const material = new THREE.MeshBasicMaterial();
+
+  /**
+   * @param {THREE.Object3D} parent
+   * @param {gdjs.InstancedMeshesBatcher} batcher
+   */
+  const addMesh = (parent, batcher) => {
+    const mesh = new THREE.Mesh(geometry, material);
+    parent.add(mesh);
+    return batcher.createItem(mesh);
+  };
+
+  it('draws the meshes with the same key with an instanced mesh', () => {
+    const batcher = new gdjs.InstancedMeshesBatcher();
+    const layerGroup = new THREE.Group();
+    const items = [
+      addMesh(layerGroup, batcher),
+      addMesh(layerGroup, batcher),
+      addMesh(layerGroup, batcher),
+    ];
+    items[0].setKey('box');
+    items[1].setKey('box');
+    items[2].setKey('other-box');
+    batcher.update();
+
+    const instancedMeshes = getInstancedMeshes(layerGroup);
+    expect(instancedMeshes.length).to.be(2);
+    expect(
+      instancedMeshes.map((instancedMesh) => instancedMesh.count).sort()
+    ).to.eql([1, 2]);
+
+    // Move a mesh: its instance is updated.
+    items[1].mesh.position.set(10, 20, 30);
+    items[1].invalidate();
+    batcher.update();
+    const matrix = new THREE.Matrix4();
+    const position = new THREE.Vector3();
+    const boxInstancedMesh = getInstancedMeshes(layerGroup).filter(
+      (instancedMesh) => instancedMesh.count === 2
+    )[0];
+    boxInstancedMesh.getMatrixAt(items[1].index, matrix);
+    position.setFromMatrixPosition(matrix);
+    expect(position.toArray()).to.eql([10, 20, 30]);
+  });
+
+  it('removes the meshes without key or removed from their layer', () => {
+    const batcher = new gdjs.InstancedMeshesBatcher();
+    const layerGroup = new THREE.Group();
+    const otherLayerGroup = new THREE.Group();
+    const items = [
+      addMesh(layerGroup, batcher),
+      addMesh(layerGroup, batcher),
+      addMesh(layerGroup, batcher),
+    ];
+    for (const item of items) item.setKey('box');
+    batcher.update();
+    expect(getInstancedMeshes(layerGroup)[0].count).to.be(3);
+
+    items[0].setKey(null);
+    batcher.update();
+    expect(getInstancedMeshes(layerGroup)[0].count).to.be(2);
+    expect(items[0].batch).to.be(null);
+
+    // Moving a mesh to another layer moves it to another batch.
+    layerGroup.remove(items[1].mesh);
+    otherLayerGroup.add(items[1].mesh);
+    batcher.update();
+    expect(getInstancedMeshes(layerGroup)[0].count).to.be(1);
+    expect(getInstancedMeshes(otherLayerGroup)[0].count).to.be(1);
+
+    // Empty batches are removed.
+    layerGroup.remove(items[2].mesh);
+    batcher.update();
+    expect(getInstancedMeshes(layerGroup).length).to.be(0);
+  });
+});
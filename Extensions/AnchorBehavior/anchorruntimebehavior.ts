@@ -114,12 +114,14 @@ namespace gdjs {
         this._oldHeight = this.owner.getHeight();
       }
       this._updateAnchorDistances(instanceContainer);
-      this._followAnchor(instanceContainer);
-
-      this._oldDrawableX = this.owner.getDrawableX();
-      this._oldDrawableY = this.owner.getDrawableY();
-      this._oldWidth = this.owner.getWidth();
-      this._oldHeight = this.owner.getHeight();
+      if (this._followAnchor(instanceContainer)) {
+        // The object is only moved or resized when the viewport changed, so
+        // its bounds are read again only in this case.
+        this._oldDrawableX = this.owner.getDrawableX();
+        this._oldDrawableY = this.owner.getDrawableY();
+        this._oldWidth = this.owner.getWidth();
+        this._oldHeight = this.owner.getHeight();
+      }
     }
 
     /**
@@ -236,14 +238,13 @@ namespace gdjs {
     private _updateAnchorDistances(
       instanceContainer: gdjs.RuntimeInstanceContainer
     ) {
-      if (
-        this._oldDrawableX !== this.owner.getDrawableX() ||
-        this._oldWidth !== this.owner.getWidth()
-      ) {
+      const drawableX = this.owner.getDrawableX();
+      const width = this.owner.getWidth();
+      if (this._oldDrawableX !== drawableX || this._oldWidth !== width) {
         const parentOldWidth = this._parentOldMaxX - this._parentOldMinX;
 
         // Left edge
-        const deltaMinX = this.owner.getDrawableX() - this._oldDrawableX;
+        const deltaMinX = drawableX - this._oldDrawableX;
         if (this._leftEdgeAnchor === HorizontalAnchor.Proportional) {
           this._leftEdgeDistance += deltaMinX / parentOldWidth;
         } else {
@@ -251,21 +252,22 @@ namespace gdjs {
         }
 
         // Right edge
-        const deltaMaxX = deltaMinX + this.owner.getWidth() - this._oldWidth;
+        const deltaMaxX = deltaMinX + width - this._oldWidth;
         if (this._rightEdgeAnchor === HorizontalAnchor.Proportional) {
           this._rightEdgeDistance += deltaMaxX / parentOldWidth;
         } else {
           this._rightEdgeDistance += deltaMaxX;
         }
+        this._oldDrawableX = drawableX;
+        this._oldWidth = width;
       }
-      if (
-        this._oldDrawableY !== this.owner.getDrawableY() ||
-        this._oldHeight !== this.owner.getHeight()
-      ) {
+      const drawableY = this.owner.getDrawableY();
+      const height = this.owner.getHeight();
+      if (this._oldDrawableY !== drawableY || this._oldHeight !== height) {
         const parentOldHeight = this._parentOldMaxY - this._parentOldMinY;
 
         // Top edge
-        const deltaMinY = this.owner.getDrawableY() - this._oldDrawableY;
+        const deltaMinY = drawableY - this._oldDrawableY;
         if (this._topEdgeAnchor === VerticalAnchor.Proportional) {
           this._topEdgeDistance += deltaMinY / parentOldHeight;
         } else {
@@ -273,12 +275,14 @@ namespace gdjs {
         }
 
         // Bottom edge
-        const deltaMaxY = deltaMinY + this.owner.getHeight() - this._oldHeight;
+        const deltaMaxY = deltaMinY + height - this._oldHeight;
         if (this._bottomEdgeAnchor === VerticalAnchor.Proportional) {
           this._bottomEdgeDistance += deltaMaxY / parentOldHeight;
         } else {
           this._bottomEdgeDistance += deltaMaxY;
         }
+        this._oldDrawableY = drawableY;
+        this._oldHeight = height;
       }
     }
 
@@ -287,8 +291,12 @@ namespace gdjs {
      * anchor distances.
      *
      * The camera is taken into account.
+     *
+     * @returns true if the viewport changed and the object was updated.
      */
-    private _followAnchor(instanceContainer: gdjs.RuntimeInstanceContainer) {
+    private _followAnchor(
+      instanceContainer: gdjs.RuntimeInstanceContainer
+    ): boolean {
       let parentMinX = instanceContainer.getUnrotatedViewportMinX();
       let parentMinY = instanceContainer.getUnrotatedViewportMinY();
       let parentMaxX = instanceContainer.getUnrotatedViewportMaxX();
@@ -300,7 +308,7 @@ namespace gdjs {
         this._parentOldMaxX === parentMaxX &&
         this._parentOldMaxY === parentMaxY
       ) {
-        return;
+        return false;
       }
 
       const workingPoint: FloatPoint = gdjs.staticArray(
@@ -471,6 +479,7 @@ namespace gdjs {
       this._parentOldMinY = instanceContainer.getUnrotatedViewportMinY();
       this._parentOldMaxX = instanceContainer.getUnrotatedViewportMaxX();
       this._parentOldMaxY = instanceContainer.getUnrotatedViewportMaxY();
+      return true;
     }
 
     doStepPostEvents(instanceContainer: gdjs.RuntimeInstanceContainer) {}
@@ -9,6 +9,9 @@ namespace gdjs {
    */
   export class DestroyOutsideRuntimeBehavior extends gdjs.RuntimeBehavior {
     _extraBorder: any;
+    private _lastWidth: float = 0;
+    private _lastHeight: float = 0;
+    private _boundingCircleRadius: float = 0;
 
     constructor(
       instanceContainer: gdjs.RuntimeInstanceContainer,
@@ -31,19 +34,30 @@ namespace gdjs {
       // is not necessarily in the middle of the object (for sprites for example).
       const ow = this.owner.getWidth();
       const oh = this.owner.getHeight();
+      if (ow !== this._lastWidth || oh !== this._lastHeight) {
+        this._lastWidth = ow;
+        this._lastHeight = oh;
+        this._boundingCircleRadius = Math.sqrt(ow * ow + oh * oh) / 2.0;
+      }
+      const margin = this._boundingCircleRadius + this._extraBorder;
+      const layer = instanceContainer.getLayer(this.owner.getLayer());
+      const cameraHalfWidth = layer.getCameraWidth() / 2;
+      const cameraHalfHeight = layer.getCameraHeight() / 2;
       const ocx = this.owner.getDrawableX() + this.owner.getCenterX();
+      const cameraX = layer.getCameraX();
+      if (
+        ocx + margin < cameraX - cameraHalfWidth ||
+        ocx - margin > cameraX + cameraHalfWidth
+      ) {
+        //We are outside the camera area.
+        this.owner.deleteFromScene();
+        return;
+      }
       const ocy = this.owner.getDrawableY() + this.owner.getCenterY();
-      const layer = instanceContainer.getLayer(this.owner.getLayer());
-      const boundingCircleRadius = Math.sqrt(ow * ow + oh * oh) / 2.0;
+      const cameraY = layer.getCameraY();
       if (
-        ocx + boundingCircleRadius + this._extraBorder <
-          layer.getCameraX() - layer.getCameraWidth() / 2 ||
-        ocx - boundingCircleRadius - this._extraBorder >
-          layer.getCameraX() + layer.getCameraWidth() / 2 ||
-        ocy + boundingCircleRadius + this._extraBorder <
-          layer.getCameraY() - layer.getCameraHeight() / 2 ||
-        ocy - boundingCircleRadius - this._extraBorder >
-          layer.getCameraY() + layer.getCameraHeight() / 2
+        ocy + margin < cameraY - cameraHalfHeight ||
+        ocy - margin > cameraY + cameraHalfHeight
       ) {
         //We are outside the camera area.
         this.owner.deleteFromScene();
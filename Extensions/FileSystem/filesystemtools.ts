@@ -15,6 +15,47 @@ namespace gdjs {
         'Filesystem is not supported on this platform! Only PC builds support filesystem access.'
       );
 
+    let temporaryFilesCount = 0;
+    const getTemporaryPath = (savePath: string): string =>
+      savePath + '.' + temporaryFilesCount++ + '.tmp';
+
+    /**
+     * Write a file in a temporary file, then rename it to its path, so that
+     * the file is never left partially written if the game is closed or
+     * crashes while it is saved.
+     */
+    const writeFileAtomically = (savePath: string, text: string): void => {
+      if (!fs) throw new Error('Filesystem is not supported.');
+      const temporaryPath = getTemporaryPath(savePath);
+      try {
+        fs.writeFileSync(temporaryPath, text, 'utf8');
+        fs.renameSync(temporaryPath, savePath);
+      } catch (err) {
+        fs.rmSync(temporaryPath, { force: true });
+        throw err;
+      }
+    };
+
+    /**
+     * Write a file in a temporary file, then rename it to its path, without
+     * blocking the game.
+     * @see writeFileAtomically
+     */
+    const writeFileAtomicallyAsync = async (
+      savePath: string,
+      text: string
+    ): Promise<void> => {
+      if (!asyncFs) throw new Error('Filesystem is not supported.');
+      const temporaryPath = getTemporaryPath(savePath);
+      try {
+        await asyncFs.writeFile(temporaryPath, text, { encoding: 'utf8' });
+        await asyncFs.rename(temporaryPath, savePath);
+      } catch (err) {
+        await asyncFs.rm(temporaryPath, { force: true });
+        throw err;
+      }
+    };
+
     export const getDirectoryName = function (fileOrFolderPath: string) {
       if (!path) {
         return '';
@@ -258,17 +299,19 @@ namespace gdjs {
       savePath: string,
       resultVar: gdjs.Variable
     ) {
-      if (fs) {
-        fs.writeFile(savePath, text, 'utf8', (err) => {
-          resultVar.setString('ok');
-          if (err) {
+      if (asyncFs) {
+        writeFileAtomicallyAsync(savePath, text).then(
+          () => {
+            resultVar.setString('ok');
+          },
+          (err) => {
             logger.error(
               "Unable to save the text to path: '" + savePath + "': ",
               err
             );
             resultVar.setString('error');
           }
-        });
+        );
       }
     };
 
@@ -279,8 +322,7 @@ namespace gdjs {
     ) =>
       asyncFs
         ? new gdjs.PromiseTask(
-            asyncFs
-              .writeFile(savePath, text, { encoding: 'utf8' })
+            writeFileAtomicallyAsync(savePath, text)
               .then(() => {
                 resultVar.setString('ok');
               })
@@ -308,7 +350,7 @@ namespace gdjs {
       let result = 'error';
       if (fs) {
         try {
-          fs.writeFileSync(savePath, text, 'utf8');
+          writeFileAtomically(savePath, text);
           result = 'ok';
         } catch (err) {
           logger.error(
@@ -334,11 +376,7 @@ namespace gdjs {
       let result = 'error';
       if (fs) {
         try {
-          fs.writeFileSync(
-            savePath,
-            JSON.stringify(variable.toJSObject()),
-            'utf8'
-          );
+          writeFileAtomically(savePath, JSON.stringify(variable.toJSObject()));
           result = 'ok';
         } catch (err) {
           logger.error(
@@ -361,20 +399,20 @@ namespace gdjs {
       savePath: string,
       resultVar: gdjs.Variable
     ) {
-      if (fs) {
-        fs.writeFile(
+      if (asyncFs) {
+        writeFileAtomicallyAsync(
           savePath,
-          JSON.stringify(variable.toJSObject()),
-          'utf8',
-          (err) => {
+          JSON.stringify(variable.toJSObject())
+        ).then(
+          () => {
             resultVar.setString('ok');
-            if (err) {
-              logger.error(
-                "Unable to save the variable to path: '" + savePath + "': ",
-                err
-              );
-              resultVar.setString('error');
-            }
+          },
+          (err) => {
+            logger.error(
+              "Unable to save the variable to path: '" + savePath + "': ",
+              err
+            );
+            resultVar.setString('error');
           }
         );
       }
@@ -387,10 +425,10 @@ namespace gdjs {
     ) =>
       asyncFs
         ? new gdjs.PromiseTask(
-            asyncFs
-              .writeFile(savePath, JSON.stringify(variable.toJSObject()), {
-                encoding: 'utf8',
-              })
+            writeFileAtomicallyAsync(
+              savePath,
+              JSON.stringify(variable.toJSObject())
+            )
               .then(() => {
                 resultVar.setString('ok');
               })
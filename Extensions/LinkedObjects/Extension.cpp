@@ -107,4 +107,45 @@ void DeclareLinkedObjectsExtension(gd::PlatformExtension& extension) {
       .AddCodeOnlyParameter("eventsFunctionContext", "")
 
       .SetFunctionName("GDpriv::LinkedObjects::PickObjectsLinkedTo");
+
+  extension
+      .AddCondition(
+          "PickObjectsLinkedToAnyOf",
+          _("Take into account objects linked to any instance"),
+          _("Take some objects linked to any of the picked instances of "
+            "another object into account for next conditions and actions. "
+            "This is faster than taking into account linked objects in a "
+            "\"For each object\" event.\nThe condition will return false if "
+            "no object was taken into account."),
+          _("Take into account all \"_PARAM1_\" linked to any of _PARAM2_"),
+          _("Objects"),
+          "CppPlatform/Extensions/LinkedObjectsicon24.png",
+          "CppPlatform/Extensions/LinkedObjectsicon24.png")
+
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("objectList", _("Pick these objects..."))
+      .AddParameter("objectList",
+                    _("...if they are linked to any of these objects"))
+      .AddCodeOnlyParameter("eventsFunctionContext", "")
+      .MarkAsAdvanced();
+
+  extension
+      .AddAction(
+          "PickObjectsLinkedToAnyOf",
+          _("Take into account objects linked to any instance"),
+          _("Take objects linked to any of the picked instances of another "
+            "object into account for next actions. This is faster than "
+            "taking into account linked objects in a \"For each object\" "
+            "event."),
+          _("Take into account all \"_PARAM1_\" linked to any of _PARAM2_"),
+          _("Objects"),
+          "CppPlatform/Extensions/LinkedObjectsicon24.png",
+          "CppPlatform/Extensions/LinkedObjectsicon24.png")
+
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("objectList", _("Pick these objects..."))
+      .AddParameter("objectList",
+                    _("...if they are linked to any of these objects"))
+      .AddCodeOnlyParameter("eventsFunctionContext", "")
+      .MarkAsAdvanced();
 }
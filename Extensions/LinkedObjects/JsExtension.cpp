@@ -40,6 +40,14 @@ class LinkedObjectsJsExtension : public gd::PlatformExtension {
     GetAllConditions()["LinkedObjects::PickObjectsLinkedTo"]
         .SetIncludeFile("Extensions/LinkedObjects/linkedobjects.js")
         .SetFunctionName("gdjs.evtTools.linkedObjects.pickObjectsLinkedTo");
+    GetAllActions()["LinkedObjects::PickObjectsLinkedToAnyOf"]
+        .SetIncludeFile("Extensions/LinkedObjects/linkedobjects.js")
+        .SetFunctionName(
+            "gdjs.evtTools.linkedObjects.pickObjectsLinkedToAnyOf");
+    GetAllConditions()["LinkedObjects::PickObjectsLinkedToAnyOf"]
+        .SetIncludeFile("Extensions/LinkedObjects/linkedobjects.js")
+        .SetFunctionName(
+            "gdjs.evtTools.linkedObjects.pickObjectsLinkedToAnyOf");
 
     StripUnimplementedInstructionsAndExpressions();
     GD_COMPLETE_EXTENSION_COMPILATION_INFORMATION();
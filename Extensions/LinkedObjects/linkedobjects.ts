@@ -235,19 +235,26 @@ namespace gdjs {
         LinksManager.getManager(instanceContainer).removeAllLinksOf(objA);
       };
 
-      export const pickObjectsLinkedTo = function (
+      /** Used to check in constant time if an object was picked. */
+      const pickedObjectsSet = new Set<gdjs.RuntimeObject>();
+      /** Used to not pick twice an object linked to several objects. */
+      const addedObjectsSet = new Set<gdjs.RuntimeObject>();
+      const linkedObjectMaps: Map<string, gdjs.RuntimeObject[]>[] = [];
+
+      /**
+       * Pick the objects of the lists that are linked to at least one of the
+       * objects whose links are given.
+       * @param linkedObjectMaps The linked objects by name of each object.
+       * @returns true if at least one object was picked.
+       */
+      const pickObjectsLinkedToMaps = function (
         instanceContainer: gdjs.RuntimeInstanceContainer,
         objectsLists: Hashtable<gdjs.RuntimeObject[]>,
-        obj: gdjs.RuntimeObject | null,
+        linkedObjectMaps: Map<string, gdjs.RuntimeObject[]>[],
         eventsFunctionContext: EventsFunctionContext | undefined
-      ) {
-        if (obj === null) {
-          return false;
-        }
-        const linkedObjectMap =
-          LinksManager.getManager(instanceContainer)._getMapOfObjectsLinkedWith(
-            obj
-          );
+      ): boolean {
+        // Objects linked to several objects must only be picked once.
+        const mustRemoveDuplicates = linkedObjectMaps.length > 1;
 
         let pickedSomething = false;
         for (const contextObjectName in objectsLists.items) {
@@ -261,7 +268,7 @@ namespace gdjs {
 
             // Find the object names in the scene
             const parentEventPickedObjectNames = gdjs.staticArray2(
-              gdjs.evtTools.linkedObjects.pickObjectsLinkedTo
+              pickObjectsLinkedToMaps
             );
             parentEventPickedObjectNames.length = 0;
             if (eventsFunctionContext) {
@@ -292,56 +299,123 @@ namespace gdjs {
               objectCount += instanceContainer.getObjects(objectName)!.length;
             }
 
-            if (parentEventPickedObjects.length === objectCount) {
-              // The parent event didn't make any selection on the current object,
-              // (because the number of picked objects is the total object count on the scene).
-              // There is no need to make an intersection.
-              // We will only replace the picked list with the linked object list.
-              parentEventPickedObjects.length = 0;
-              for (const objectName of parentEventPickedObjectNames) {
-                if (linkedObjectMap.has(objectName)) {
-                  const linkedObjects = linkedObjectMap.get(objectName)!;
-
-                  pickedSomething = pickedSomething || linkedObjects.length > 0;
-                  parentEventPickedObjects.push.apply(
-                    parentEventPickedObjects,
-                    linkedObjects
-                  );
-                }
+            // When the parent event didn't make any selection on the current object,
+            // (because the number of picked objects is the total object count on the scene),
+            // there is no need to make an intersection:
+            // the picked list is replaced with the linked object list.
+            const mustIntersect =
+              parentEventPickedObjects.length !== objectCount;
+            if (mustIntersect) {
+              for (let i = 0; i < parentEventPickedObjects.length; i++) {
+                pickedObjectsSet.add(parentEventPickedObjects[i]);
               }
-            } else {
-              // Run an intersection between objects picked by parent events
-              // and the linked ones.
-              const pickedAndLinkedObjects = gdjs.staticArray(
-                gdjs.evtTools.linkedObjects.pickObjectsLinkedTo
-              );
-              pickedAndLinkedObjects.length = 0;
-
-              for (const objectName of parentEventPickedObjectNames) {
-                if (linkedObjectMap.has(objectName)) {
-                  const linkedObjects = linkedObjectMap.get(objectName)!;
+            }
 
-                  for (const otherObject of linkedObjects) {
-                    if (parentEventPickedObjects.indexOf(otherObject) >= 0) {
-                      pickedAndLinkedObjects.push(otherObject);
+            const pickedAndLinkedObjects = gdjs.staticArray(
+              pickObjectsLinkedToMaps
+            );
+            pickedAndLinkedObjects.length = 0;
+            for (const objectName of parentEventPickedObjectNames) {
+              for (const linkedObjectMap of linkedObjectMaps) {
+                const linkedObjects = linkedObjectMap.get(objectName);
+                if (!linkedObjects) {
+                  continue;
+                }
+                for (let i = 0; i < linkedObjects.length; i++) {
+                  const otherObject = linkedObjects[i];
+                  if (mustIntersect && !pickedObjectsSet.has(otherObject)) {
+                    continue;
+                  }
+                  if (mustRemoveDuplicates) {
+                    if (addedObjectsSet.has(otherObject)) {
+                      continue;
                     }
+                    addedObjectsSet.add(otherObject);
                   }
+                  pickedAndLinkedObjects.push(otherObject);
                 }
               }
-              pickedSomething =
-                pickedSomething || pickedAndLinkedObjects.length > 0;
-              parentEventPickedObjects.length = 0;
-              parentEventPickedObjects.push.apply(
-                parentEventPickedObjects,
-                pickedAndLinkedObjects
-              );
-              pickedAndLinkedObjects.length = 0;
             }
+            pickedSomething =
+              pickedSomething || pickedAndLinkedObjects.length > 0;
+            parentEventPickedObjects.length = 0;
+            parentEventPickedObjects.push.apply(
+              parentEventPickedObjects,
+              pickedAndLinkedObjects
+            );
+            pickedAndLinkedObjects.length = 0;
+            pickedObjectsSet.clear();
+            addedObjectsSet.clear();
             parentEventPickedObjectNames.length = 0;
           }
         }
         return pickedSomething;
       };
+
+      export const pickObjectsLinkedTo = function (
+        instanceContainer: gdjs.RuntimeInstanceContainer,
+        objectsLists: Hashtable<gdjs.RuntimeObject[]>,
+        obj: gdjs.RuntimeObject | null,
+        eventsFunctionContext: EventsFunctionContext | undefined
+      ) {
+        if (obj === null) {
+          return false;
+        }
+        linkedObjectMaps.length = 0;
+        linkedObjectMaps.push(
+          LinksManager.getManager(instanceContainer)._getMapOfObjectsLinkedWith(
+            obj
+          )
+        );
+        const pickedSomething = pickObjectsLinkedToMaps(
+          instanceContainer,
+          objectsLists,
+          linkedObjectMaps,
+          eventsFunctionContext
+        );
+        linkedObjectMaps.length = 0;
+        return pickedSomething;
+      };
+
+      /**
+       * Pick the objects linked to any of the picked instances of other
+       * objects, in a single pass (instead of picking the objects linked to
+       * each instance in a "For each" event).
+       * @param objectsLists The objects to pick.
+       * @param linkedToObjectsLists The objects to which the picked objects
+       * must be linked.
+       * @returns true if at least one object was picked.
+       */
+      export const pickObjectsLinkedToAnyOf = function (
+        instanceContainer: gdjs.RuntimeInstanceContainer,
+        objectsLists: Hashtable<gdjs.RuntimeObject[]>,
+        linkedToObjectsLists: Hashtable<gdjs.RuntimeObject[]>,
+        eventsFunctionContext: EventsFunctionContext | undefined
+      ) {
+        const manager = LinksManager.getManager(instanceContainer);
+        // The maps are read before the lists are changed, as both lists can
+        // contain the same objects.
+        linkedObjectMaps.length = 0;
+        for (const linkedToObjectName in linkedToObjectsLists.items) {
+          if (linkedToObjectsLists.containsKey(linkedToObjectName)) {
+            const linkedToObjects =
+              linkedToObjectsLists.items[linkedToObjectName];
+            for (let i = 0; i < linkedToObjects.length; i++) {
+              linkedObjectMaps.push(
+                manager._getMapOfObjectsLinkedWith(linkedToObjects[i])
+              );
+            }
+          }
+        }
+        const pickedSomething = pickObjectsLinkedToMaps(
+          instanceContainer,
+          objectsLists,
+          linkedObjectMaps,
+          eventsFunctionContext
+        );
+        linkedObjectMaps.length = 0;
+        return pickedSomething;
+      };
     }
   }
 }
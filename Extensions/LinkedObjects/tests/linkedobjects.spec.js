@@ -261,6 +261,62 @@ describe('gdjs.LinksManager', function () {
         expect(objectsLists.get('obj1')[0]).to.be(object1B);
       }
     });
+    it('can select objects linked to any of several objects', function () {
+      manager.linkObjects(object1A, object2A);
+      manager.linkObjects(object1C, object2A);
+      manager.linkObjects(object1C, object2B);
+      // object1A <--> object2A
+      // object1B <--> object2C
+      // object1C <--> object2A, object2B
+      {
+        const objectsLists = Hashtable.newFrom({
+          obj2: [object2A, object2B, object2C],
+        });
+        const pickedSomething =
+          gdjs.evtTools.linkedObjects.pickObjectsLinkedToAnyOf(
+            runtimeScene,
+            objectsLists,
+            Hashtable.newFrom({ obj1: [object1A, object1C] }),
+            eventsFunctionContext
+          );
+        expect(pickedSomething).to.be(true);
+        // object2A is only picked once.
+        expect(objectsLists.get('obj2').length).to.be(2);
+        expect(objectsLists.get('obj2')).to.contain(object2A);
+        expect(objectsLists.get('obj2')).to.contain(object2B);
+      }
+      {
+        // object2B was discarded from a parent condition
+        const objectsLists = Hashtable.newFrom({
+          obj2: [object2A, object2C],
+        });
+        const pickedSomething =
+          gdjs.evtTools.linkedObjects.pickObjectsLinkedToAnyOf(
+            runtimeScene,
+            objectsLists,
+            Hashtable.newFrom({ obj1: [object1A, object1B, object1C] }),
+            eventsFunctionContext
+          );
+        expect(pickedSomething).to.be(true);
+        expect(objectsLists.get('obj2').length).to.be(2);
+        expect(objectsLists.get('obj2')).to.contain(object2A);
+        expect(objectsLists.get('obj2')).to.contain(object2C);
+      }
+      {
+        const objectsLists = Hashtable.newFrom({
+          obj2: [object2A, object2B, object2C],
+        });
+        const pickedSomething =
+          gdjs.evtTools.linkedObjects.pickObjectsLinkedToAnyOf(
+            runtimeScene,
+            objectsLists,
+            Hashtable.newFrom({ obj1: [] }),
+            eventsFunctionContext
+          );
+        expect(pickedSomething).to.be(false);
+        expect(objectsLists.get('obj2').length).to.be(0);
+      }
+    });
   };
 
   // Following object names are the names of the objects in the scene.
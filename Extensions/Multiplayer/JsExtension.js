@@ -1218,6 +1218,12 @@ module.exports = {
         behaviorContent.getChild('playerNumber').setIntValue(numberValue);
         return true;
       }
+      if (propertyName === 'numbersPrecision') {
+        behaviorContent
+          .getChild('numbersPrecision')
+          .setDoubleValue(Math.max(0, parseFloat(newValue) || 0));
+        return true;
+      }
 
       return false;
     };
@@ -1263,6 +1269,22 @@ module.exports = {
         .addExtraInfo('GiveOwnershipToHost')
         .addExtraInfo('DoNothing');
 
+      behaviorProperties
+        .getOrCreate('numbersPrecision')
+        .setValue(
+          behaviorContent.hasChild('numbersPrecision')
+            ? behaviorContent.getChild('numbersPrecision').getDoubleValue() + ''
+            : '0'
+        )
+        .setType('Number')
+        .setLabel(_('Precision of the synchronized numbers'))
+        .setDescription(
+          _(
+            'The numbers of the behaviors of the object are rounded to a multiple of this value when synchronized, to reduce the data sent to the players (for example, 0.01). Leave 0 to synchronize the exact values.'
+          )
+        )
+        .setAdvanced(true);
+
       return behaviorProperties;
     };
 
@@ -1271,6 +1293,7 @@ module.exports = {
       behaviorContent
         .addChild('actionOnPlayerDisconnect')
         .setStringValue('DestroyObject');
+      behaviorContent.addChild('numbersPrecision').setDoubleValue(0);
     };
 
     const sharedData = new gd.BehaviorsSharedData();
@@ -613,10 +613,145 @@ namespace gdjs {
       messageData: any;
     } => {
       return {
-        messageName: `${updateInstanceMessageNamePrefix}#owner_${objectOwner}#object_${objectName}#instance_${instanceNetworkId}#scene_${sceneNetworkId}`,
+        messageName: getUpdateInstanceMessageName(
+          objectOwner,
+          objectName,
+          instanceNetworkId,
+          sceneNetworkId
+        ),
         messageData: objectNetworkSyncData,
       };
     };
+    const getUpdateInstanceMessageName = (
+      objectOwner: number,
+      objectName: string,
+      instanceNetworkId: string,
+      sceneNetworkId: string
+    ): string =>
+      `${updateInstanceMessageNamePrefix}#owner_${objectOwner}#object_${objectName}#instance_${instanceNetworkId}#scene_${sceneNetworkId}`;
+
+    // The updates of the instances owned by the player are sent at the end of the frame,
+    // all in a single message, to avoid sending one packet per instance.
+    // Instead of the message names, each update only has the owner, the instance id and
+    // the indices of its object name and scene id in a list of strings sent once per batch
+    // (as many instances share the same object and scene).
+    const batchedUpdateInstancesMessageName = '#batchedUpdateInstances';
+    type BatchedUpdateInstance = [
+      objectOwner: number,
+      objectNameIndex: number,
+      instanceNetworkId: string,
+      sceneNetworkIdIndex: number,
+      objectNetworkSyncData: ObjectNetworkSyncData,
+    ];
+    let updateInstancesToSend: BatchedUpdateInstance[] = [];
+    let updateInstancesStringsToSend: string[] = [];
+    const updateInstancesStringIndices = new Map<string, number>();
+    const getUpdateInstancesStringIndex = (string: string): number => {
+      let index = updateInstancesStringIndices.get(string);
+      if (index === undefined) {
+        index = updateInstancesStringsToSend.length;
+        updateInstancesStringsToSend.push(string);
+        updateInstancesStringIndices.set(string, index);
+      }
+      return index;
+    };
+
+    /**
+     * Queue an update of an instance (the data of an update instance message,
+     * see `createUpdateInstanceMessage`), to be sent with the other updates at the end of the frame.
+     */
+    const queueUpdateInstanceMessage = ({
+      objectOwner,
+      objectName,
+      instanceNetworkId,
+      objectNetworkSyncData,
+      sceneNetworkId,
+    }: {
+      objectOwner: number;
+      objectName: string;
+      instanceNetworkId: string;
+      objectNetworkSyncData: ObjectNetworkSyncData;
+      sceneNetworkId: string;
+    }): void => {
+      updateInstancesToSend.push([
+        objectOwner,
+        getUpdateInstancesStringIndex(objectName),
+        instanceNetworkId,
+        getUpdateInstancesStringIndex(sceneNetworkId),
+        objectNetworkSyncData,
+      ]);
+    };
+
+    const handleUpdateInstanceMessagesToSend = (): void => {
+      if (!updateInstancesToSend.length) return;
+
+      const connectedPeerIds = gdjs.multiplayerPeerJsHelper.getAllPeers();
+      sendDataTo(connectedPeerIds, batchedUpdateInstancesMessageName, {
+        strings: updateInstancesStringsToSend,
+        updates: updateInstancesToSend,
+      });
+      updateInstancesToSend = [];
+      updateInstancesStringsToSend = [];
+      updateInstancesStringIndices.clear();
+    };
+
+    /**
+     * Split the batched update instance messages received into the update instance messages
+     * they contain, so that they are handled like the ones sent individually.
+     */
+    const unbatchUpdateInstanceMessagesReceived = (
+      p2pMessagesMap: Map<string, gdjs.multiplayerPeerJsHelper.IMessagesList>
+    ): void => {
+      const batchedMessagesList = p2pMessagesMap.get(
+        batchedUpdateInstancesMessageName
+      );
+      if (!batchedMessagesList) return;
+
+      const batchedMessages = batchedMessagesList.getMessages();
+      for (const batchedMessage of batchedMessages) {
+        const batchedMessageData = batchedMessage.getData();
+        if (
+          !batchedMessageData ||
+          !Array.isArray(batchedMessageData.strings) ||
+          !Array.isArray(batchedMessageData.updates)
+        )
+          continue;
+
+        const strings: unknown[] = batchedMessageData.strings;
+        for (const update of batchedMessageData.updates) {
+          if (!Array.isArray(update) || update.length !== 5) continue;
+          const [
+            objectOwner,
+            objectNameIndex,
+            instanceNetworkId,
+            sceneNetworkIdIndex,
+            objectNetworkSyncData,
+          ] = update;
+          const objectName = strings[objectNameIndex];
+          const sceneNetworkId = strings[sceneNetworkIdIndex];
+          if (
+            typeof objectOwner !== 'number' ||
+            typeof objectName !== 'string' ||
+            typeof instanceNetworkId !== 'string' ||
+            typeof sceneNetworkId !== 'string'
+          )
+            continue;
+
+          gdjs.multiplayerPeerJsHelper
+            .getOrCreateMessagesList(
+              getUpdateInstanceMessageName(
+                objectOwner,
+                objectName,
+                instanceNetworkId,
+                sceneNetworkId
+              )
+            )
+            .pushMessage(objectNetworkSyncData, batchedMessage.getSender());
+        }
+      }
+      batchedMessages.length = 0;
+    };
+
     const handleUpdateInstanceMessagesReceived = (
       runtimeScene: gdjs.RuntimeScene
     ) => {
@@ -627,6 +762,7 @@ namespace gdjs {
       }
 
       const p2pMessagesMap = gdjs.multiplayerPeerJsHelper.getAllMessagesMap();
+      unbatchUpdateInstanceMessagesReceived(p2pMessagesMap);
       const messageNamesArray = Array.from(p2pMessagesMap.keys());
 
       // When we receive update messages, update the instances in the scene.
@@ -2476,6 +2612,8 @@ namespace gdjs {
       handleChangeInstanceOwnerMessagesReceived,
       // Instance update.
       createUpdateInstanceMessage,
+      queueUpdateInstanceMessage,
+      handleUpdateInstanceMessagesToSend,
       handleUpdateInstanceMessagesReceived,
       // Instance destruction.
       createDestroyInstanceMessage,
@@ -23,6 +23,9 @@ namespace gdjs {
     // The action to be executed when the player disconnects.
     actionOnPlayerDisconnect: string;
 
+    // If not 0, the numbers of the behaviors are rounded to a multiple of this value when synchronized.
+    numbersPrecision: float;
+
     // The last time the object has been synchronized.
     // This is to avoid synchronizing the object too often, see _objectMaxSyncRate.
     _lastObjectSyncTimestamp: number = 0;
@@ -61,6 +64,12 @@ namespace gdjs {
     // to ensure they are received, without the need of an acknowledgment.
     _numberOfForcedEffectsUpdates: number = 0;
 
+    // The last time all the properties of the behaviors have been synchronized.
+    // Between these, behaviors can send only the properties that changed.
+    _lastBehaviorsFullSyncTimestamp: number = 0;
+    // The number of times per second all the properties of the behaviors should be synchronized.
+    _behaviorsFullSyncRate: number = 1;
+
     // To avoid seeing too many logs.
     _lastLogTimestamp: number = 0;
     _logSyncRate: number = 1;
@@ -81,6 +90,7 @@ namespace gdjs {
           ? 0
           : parseInt(behaviorData.playerNumber, 10);
       this.actionOnPlayerDisconnect = behaviorData.actionOnPlayerDisconnect;
+      this.numbersPrecision = behaviorData.numbersPrecision || 0;
 
       // When a synchronized object is created, we assume it will be assigned a networkId quickly if:
       // - It is a new object created by the current player. -> will be assigned a networkId when sending the update message.
@@ -278,7 +288,13 @@ namespace gdjs {
 
       const instanceNetworkId = this._getOrCreateInstanceNetworkId();
       const objectName = this.owner.getName();
-      const objectNetworkSyncData = this.owner.getNetworkSyncData();
+      const shouldSyncAllBehaviorsProperties =
+        getTimeNow() - this._lastBehaviorsFullSyncTimestamp >=
+        1000 / this._behaviorsFullSyncRate;
+      const objectNetworkSyncData = this.owner.getNetworkSyncData({
+        syncOnlyChangedProperties: !shouldSyncAllBehaviorsProperties,
+        numbersPrecision: this.numbersPrecision,
+      });
 
       // this._logToConsoleWithThrottle(
       //   `Synchronizing object ${this.owner.getName()} (instance ${
@@ -313,6 +329,9 @@ namespace gdjs {
       if (!shouldSyncObjectBasicInfo) {
         // If the basic info has not changed, assume we don't need to sync the whole object data at a high rate.
         // TODO: allow sending the variables, behaviors and effects still?
+        // The behaviors assume that the properties that changed were sent,
+        // so send all of them next time.
+        this._lastBehaviorsFullSyncTimestamp = 0;
         return;
       }
 
@@ -347,25 +366,27 @@ namespace gdjs {
       const sceneNetworkId = this.owner.getRuntimeScene().networkId;
       if (!sceneNetworkId) {
         // No networkId for the scene yet, it will be set soon, let's not sync the object yet.
+        this._lastBehaviorsFullSyncTimestamp = 0;
         return;
       }
 
-      const { messageName: updateMessageName, messageData: updateMessageData } =
-        gdjs.multiplayerMessageManager.createUpdateInstanceMessage({
-          objectOwner: this.playerNumber,
-          objectName,
-          instanceNetworkId,
-          objectNetworkSyncData,
-          sceneNetworkId,
-        });
-      this._sendDataToPeersWithIncreasedClock(
-        updateMessageName,
-        updateMessageData
-      );
+      // Sent at the end of the frame with the updates of the other instances.
+      this._clock++;
+      objectNetworkSyncData['_clock'] = this._clock;
+      gdjs.multiplayerMessageManager.queueUpdateInstanceMessage({
+        objectOwner: this.playerNumber,
+        objectName,
+        instanceNetworkId,
+        objectNetworkSyncData,
+        sceneNetworkId,
+      });
 
       const now = getTimeNow();
 
       this._lastObjectSyncTimestamp = now;
+      if (shouldSyncAllBehaviorsProperties) {
+        this._lastBehaviorsFullSyncTimestamp = now;
+      }
       if (shouldSyncObjectBasicInfo) {
         this._lastBasicObjectSyncTimestamp = now;
         this._lastSentBasicObjectSyncData = {
@@ -448,7 +469,9 @@ namespace gdjs {
           objectOwner: this.playerNumber,
           objectName,
           instanceNetworkId,
-          objectNetworkSyncData: this.owner.getNetworkSyncData(),
+          objectNetworkSyncData: this.owner.getNetworkSyncData({
+            numbersPrecision: this.numbersPrecision,
+          }),
           sceneNetworkId,
         });
       this._sendDataToPeersWithIncreasedClock(
@@ -598,7 +621,9 @@ namespace gdjs {
         debugLogger.info(
           'Sending update message to move the object immediately.'
         );
-        const objectNetworkSyncData = this.owner.getNetworkSyncData();
+        const objectNetworkSyncData = this.owner.getNetworkSyncData({
+          numbersPrecision: this.numbersPrecision,
+        });
         const {
           messageName: updateMessageName,
           messageData: updateMessageData,
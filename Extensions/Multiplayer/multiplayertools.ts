@@ -242,6 +242,8 @@ namespace gdjs {
         gdjs.multiplayerMessageManager.handleUpdateSceneMessagesToSend(
           runtimeScene
         );
+        // Send in a single message the updates of the instances done by their behaviors.
+        gdjs.multiplayerMessageManager.handleUpdateInstanceMessagesToSend();
       }
     );
 
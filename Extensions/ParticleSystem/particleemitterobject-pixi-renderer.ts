@@ -15,7 +15,7 @@ namespace gdjs {
   };
 
   export class ParticleEmitterObjectPixiRenderer {
-    renderer: PIXI.Container;
+    renderer: PIXI.ParticleContainer;
     emitter: PIXI.particles.Emitter;
     started: boolean = false;
 
@@ -199,7 +199,27 @@ namespace gdjs {
         ],
       };
 
-      this.renderer = new PIXI.Container();
+      // Particles all have the same texture and blend mode, so they can be
+      // drawn by a ParticleContainer: their positions, rotations, scales and
+      // tints are uploaded from typed arrays in a single draw call, without
+      // updating the transform of each sprite like a Container does.
+      const particleContainer = new PIXI.ParticleContainer(
+        objectData.maxParticleNb,
+        {
+          vertices: true,
+          position: true,
+          rotation: true,
+          uvs: false,
+          tint: true,
+        },
+        undefined,
+        // The maximum number of particles can be changed by events.
+        true
+      );
+      particleContainer.blendMode = objectData.additive
+        ? PIXI.BLEND_MODES.ADD
+        : PIXI.BLEND_MODES.NORMAL;
+      this.renderer = particleContainer;
       // The embedded particle emitter is supposed to be the last minor version
       // of the version 5 of the particle emitter object
       // See source https://github.com/pixijs/particle-emitter/blob/v5.0.8/src/Emitter.ts
@@ -333,6 +353,10 @@ namespace gdjs {
       // Access private members of the behavior to apply changes right away.
       const behavior: any = this.emitter.getBehavior('blendMode');
       behavior.value = enabled ? 'ADD' : 'NORMAL';
+      // The ParticleContainer draws all the particles with its blend mode.
+      this.renderer.blendMode = enabled
+        ? PIXI.BLEND_MODES.ADD
+        : PIXI.BLEND_MODES.NORMAL;
     }
 
     setAlpha(alpha1: number, alpha2: number): void {
@@ -9,6 +9,125 @@ namespace gdjs {
   }
   declare var rbush: any;
 
+  /**
+   * The cells of the paths computed by the pathfinding behaviors of a
+   * container, so that objects going to the same destination (for instance
+   * units of a RTS going to a rally point) don't compute the same path again.
+   *
+   * The cache is cleared when the obstacles change (see
+   * `PathfindingObstaclesManager.getObstaclesVersion`). The least recently
+   * used paths are removed when there are more than `maxPathsCount` paths.
+   */
+  export class PathfindingPathsCache {
+    static maxPathsCount: integer = 256;
+
+    /**
+     * The cells (x and y, one after the other) of the paths by their key,
+     * or `null` if no path was found. The `Map` is iterated in insertion
+     * order, so the first paths are the least recently used ones.
+     */
+    private _paths = new Map<string, integer[] | null>();
+    private _obstaclesVersion: integer = 0;
+
+    /**
+     * Return the cells of a cached path, `null` if it was cached that no path
+     * exists, or `undefined` if the path is not in the cache.
+     * @param key The key of the path (see `getPathKey`).
+     * @param obstaclesVersion The current version of the obstacles.
+     */
+    getPath(
+      key: string,
+      obstaclesVersion: integer
+    ): integer[] | null | undefined {
+      if (this._obstaclesVersion !== obstaclesVersion) {
+        this._paths.clear();
+        this._obstaclesVersion = obstaclesVersion;
+        return undefined;
+      }
+      const path = this._paths.get(key);
+      if (path !== undefined) {
+        // Move the path at the end of the LRU order.
+        this._paths.delete(key);
+        this._paths.set(key, path);
+      }
+      return path;
+    }
+
+    /**
+     * Store the cells of a path, or `null` if no path was found.
+     * @param key The key of the path (see `getPathKey`).
+     * @param obstaclesVersion The version of the obstacles used to compute the path.
+     * @param path The cells of the path.
+     */
+    setPath(
+      key: string,
+      obstaclesVersion: integer,
+      path: integer[] | null
+    ): void {
+      if (this._obstaclesVersion !== obstaclesVersion) {
+        this._paths.clear();
+        this._obstaclesVersion = obstaclesVersion;
+      }
+      this._paths.delete(key);
+      this._paths.set(key, path);
+      if (this._paths.size > PathfindingPathsCache.maxPathsCount) {
+        this._paths.delete(this._paths.keys().next().value);
+      }
+    }
+
+    getPathsCount(): integer {
+      return this._paths.size;
+    }
+
+    /**
+     * Return the key of a path: every parameter changing the cells of the
+     * path must be in it.
+     */
+    static getPathKey(
+      startCellX: integer,
+      startCellY: integer,
+      targetCellX: integer,
+      targetCellY: integer,
+      cellWidth: float,
+      cellHeight: float,
+      gridOffsetX: float,
+      gridOffsetY: float,
+      allowDiagonals: boolean,
+      leftBorder: float,
+      topBorder: float,
+      rightBorder: float,
+      bottomBorder: float
+    ): string {
+      return (
+        startCellX +
+        ';' +
+        startCellY +
+        ';' +
+        targetCellX +
+        ';' +
+        targetCellY +
+        ';' +
+        cellWidth +
+        ';' +
+        cellHeight +
+        ';' +
+        gridOffsetX +
+        ';' +
+        gridOffsetY +
+        ';' +
+        (allowDiagonals ? 1 : 0) +
+        ';' +
+        leftBorder +
+        ';' +
+        topBorder +
+        ';' +
+        rightBorder +
+        ';' +
+        bottomBorder
+      );
+    }
+  }
+
   /**
    * PathfindingObstaclesManager manages the common objects shared by objects
    * having a pathfinding behavior: In particular, the obstacles behaviors are
@@ -19,6 +138,9 @@ namespace gdjs {
    */
   export class PathfindingObstaclesManager {
     _obstaclesRBush: any;
+    /** Incremented each time an obstacle is added, removed or changed. */
+    _obstaclesVersion: integer = 0;
+    _pathsCache: gdjs.PathfindingPathsCache = new gdjs.PathfindingPathsCache();
 
     constructor(instanceContainer: gdjs.RuntimeInstanceContainer) {
       this._obstaclesRBush = new rbush();
@@ -49,6 +171,7 @@ namespace gdjs {
           new gdjs.BehaviorRBushAABB(pathfindingObstacleBehavior);
 
       this._obstaclesRBush.insert(pathfindingObstacleBehavior.currentRBushAABB);
+      this._obstaclesVersion++;
     }
 
     /**
@@ -59,6 +182,30 @@ namespace gdjs {
       pathfindingObstacleBehavior: PathfindingObstacleRuntimeBehavior
     ) {
       this._obstaclesRBush.remove(pathfindingObstacleBehavior.currentRBushAABB);
+      this._obstaclesVersion++;
+    }
+
+    /**
+     * Signal that the cost of an obstacle, or the fact that it's impassable,
+     * changed: the paths computed before must not be used anymore.
+     */
+    invalidatePaths(): void {
+      this._obstaclesVersion++;
+    }
+
+    /**
+     * Return a number that changes each time an obstacle is added, removed,
+     * moved or changed.
+     */
+    getObstaclesVersion(): integer {
+      return this._obstaclesVersion;
+    }
+
+    /**
+     * Return the cache of the paths computed with these obstacles.
+     */
+    getPathsCache(): gdjs.PathfindingPathsCache {
+      return this._pathsCache;
     }
 
     /**
@@ -197,7 +344,11 @@ namespace gdjs {
     }
 
     setCost(cost: float): void {
+      if (this._cost === cost) {
+        return;
+      }
       this._cost = cost;
+      this._manager.invalidatePaths();
     }
 
     isImpassable(): boolean {
@@ -205,7 +356,11 @@ namespace gdjs {
     }
 
     setImpassable(impassable: boolean): void {
+      if (this._impassable === impassable) {
+        return;
+      }
       this._impassable = impassable;
+      this._manager.invalidatePaths();
     }
   }
   gdjs.registerBehavior(
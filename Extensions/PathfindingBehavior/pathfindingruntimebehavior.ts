@@ -133,9 +133,11 @@ namespace gdjs {
       return true;
     }
 
-    getNetworkSyncData(): PathfindingNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): PathfindingNetworkSyncData {
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         props: {
           path: this._path,
           pf: this._pathFound,
@@ -419,39 +421,79 @@ namespace gdjs {
         return;
       }
 
-      //Start searching for a path
-      this._searchContext.allowDiagonals(this._allowDiagonals);
-      this._searchContext.setObstacles(this._manager);
-      this._searchContext.setCellSize(this._cellWidth, this._cellHeight);
-      this._searchContext.setGridOffset(this._gridOffsetX, this._gridOffsetY);
-      this._searchContext.setStartPosition(owner.getX(), owner.getY());
-      this._searchContext.setObjectSize(
-        owner.getX() - owner.getDrawableX() + this._extraBorder,
-        owner.getY() - owner.getDrawableY() + this._extraBorder,
+      const leftBorder =
+        owner.getX() - owner.getDrawableX() + this._extraBorder;
+      const topBorder = owner.getY() - owner.getDrawableY() + this._extraBorder;
+      const rightBorder =
         owner.getWidth() -
-          (owner.getX() - owner.getDrawableX()) +
-          this._extraBorder,
+        (owner.getX() - owner.getDrawableX()) +
+        this._extraBorder;
+      const bottomBorder =
         owner.getHeight() -
-          (owner.getY() - owner.getDrawableY()) +
-          this._extraBorder
+        (owner.getY() - owner.getDrawableY()) +
+        this._extraBorder;
+
+      // Objects of the same size going to the same cell share their paths.
+      const pathsCache = this._manager.getPathsCache();
+      const obstaclesVersion = this._manager.getObstaclesVersion();
+      const pathKey = gdjs.PathfindingPathsCache.getPathKey(
+        startCellX,
+        startCellY,
+        targetCellX,
+        targetCellY,
+        this._cellWidth,
+        this._cellHeight,
+        this._gridOffsetX,
+        this._gridOffsetY,
+        this._allowDiagonals,
+        leftBorder,
+        topBorder,
+        rightBorder,
+        bottomBorder
       );
-      if (this._searchContext.computePathTo(x, y)) {
-        //Path found: memorize it
-        let node = this._searchContext.getFinalNode();
-        let finalPathLength = 0;
-        while (node) {
-          if (finalPathLength === this._path.length) {
+      let pathCells = pathsCache.getPath(pathKey, obstaclesVersion);
+      if (pathCells === undefined) {
+        //Start searching for a path
+        this._searchContext.allowDiagonals(this._allowDiagonals);
+        this._searchContext.setObstacles(this._manager);
+        this._searchContext.setCellSize(this._cellWidth, this._cellHeight);
+        this._searchContext.setGridOffset(
+          this._gridOffsetX,
+          this._gridOffsetY
+        );
+        this._searchContext.setStartPosition(owner.getX(), owner.getY());
+        this._searchContext.setObjectSize(
+          leftBorder,
+          topBorder,
+          rightBorder,
+          bottomBorder
+        );
+        pathCells = null;
+        if (this._searchContext.computePathTo(x, y)) {
+          pathCells = [];
+          let node = this._searchContext.getFinalNode();
+          while (node) {
+            pathCells.push(node.pos[0], node.pos[1]);
+            node = node.parent;
+          }
+        }
+        pathsCache.setPath(pathKey, obstaclesVersion, pathCells);
+      }
+
+      if (pathCells) {
+        //Path found: memorize it (the cells are from the end to the start).
+        const finalPathLength = pathCells.length / 2;
+        for (let index = 0; index < finalPathLength; index++) {
+          if (index === this._path.length) {
             this._path.push([0, 0]);
           }
-          this._path[finalPathLength][0] =
-            node.pos[0] * this._cellWidth + this._gridOffsetX;
-          this._path[finalPathLength][1] =
-            node.pos[1] * this._cellHeight + this._gridOffsetY;
-          node = node.parent;
-          finalPathLength++;
+          const cellIndex = (finalPathLength - 1 - index) * 2;
+          this._path[index][0] =
+            pathCells[cellIndex] * this._cellWidth + this._gridOffsetX;
+          this._path[index][1] =
+            pathCells[cellIndex + 1] * this._cellHeight + this._gridOffsetY;
         }
         this._path.length = finalPathLength;
-        this._path.reverse();
         this._path[0][0] = owner.getX();
         this._path[0][1] = owner.getY();
 
@@ -212,6 +212,49 @@ describe('gdjs.PathfindingRuntimeBehavior', function () {
       player.getBehavior(pathFindingName).moveTo(runtimeScene, 600, 300);
       expect(player.getBehavior(pathFindingName).pathFound()).to.be(false);
     });
+
+    it('reuses the path of an object going to the same cell', function () {
+      const obstacle = addObstacle(runtimeScene);
+
+      obstacle.setPosition(600, 300);
+      // To ensure obstacles are registered.
+      runtimeScene.renderAndStep(1000 / 60);
+      const pathsCache =
+        gdjs.PathfindingObstaclesManager.getManager(
+          runtimeScene
+        ).getPathsCache();
+
+      player.setPosition(480, 300);
+      player.getBehavior(pathFindingName).moveTo(runtimeScene, 720, 300);
+      expect(pathsCache.getPathsCount()).to.be(1);
+
+      const otherPlayer = addPlayer(runtimeScene);
+      otherPlayer.setPosition(482, 301);
+      otherPlayer.getBehavior(pathFindingName).moveTo(runtimeScene, 721, 299);
+      expect(pathsCache.getPathsCount()).to.be(1);
+      expect(otherPlayer.getBehavior(pathFindingName).pathFound()).to.be(true);
+      expect(otherPlayer.getBehavior(pathFindingName).getNodeCount()).to.be(
+        player.getBehavior(pathFindingName).getNodeCount()
+      );
+      expect(otherPlayer.getBehavior(pathFindingName).getNodeX(0)).to.be(482);
+      expect(otherPlayer.getBehavior(pathFindingName).getNodeY(0)).to.be(301);
+    });
+
+    it('computes the path again when an obstacle is added', function () {
+      player.setPosition(480, 300);
+      player.getBehavior(pathFindingName).moveTo(runtimeScene, 720, 300);
+      expect(getPathLength(player)).to.be(720 - 480);
+
+      const obstacle = addObstacle(runtimeScene);
+      obstacle.setPosition(600, 300);
+      // To ensure obstacles are registered.
+      runtimeScene.renderAndStep(1000 / 60);
+
+      player.setPosition(480, 300);
+      player.getBehavior(pathFindingName).moveTo(runtimeScene, 720, 300);
+      expect(player.getBehavior(pathFindingName).pathFound()).to.be(true);
+      expect(getPathLength(player)).to.be.above(720 - 480 + 50);
+    });
   };
 
   ['Legacy'].forEach((collisionMethod) => {
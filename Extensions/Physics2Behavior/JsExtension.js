@@ -462,6 +462,32 @@ module.exports = {
         return true;
       }
 
+      if (propertyName === 'stepsPerSecond') {
+        const newValueAsNumber = parseFloat(newValue);
+        if (newValueAsNumber !== newValueAsNumber || newValueAsNumber <= 0)
+          return false;
+        if (!sharedContent.hasChild('stepsPerSecond')) {
+          sharedContent.addChild('stepsPerSecond');
+        }
+        sharedContent
+          .getChild('stepsPerSecond')
+          .setDoubleValue(newValueAsNumber);
+        return true;
+      }
+
+      if (propertyName === 'maxStepsPerFrame') {
+        const newValueAsNumber = parseInt(newValue, 10);
+        if (newValueAsNumber !== newValueAsNumber || newValueAsNumber < 1)
+          return false;
+        if (!sharedContent.hasChild('maxStepsPerFrame')) {
+          sharedContent.addChild('maxStepsPerFrame');
+        }
+        sharedContent
+          .getChild('maxStepsPerFrame')
+          .setDoubleValue(newValueAsNumber);
+        return true;
+      }
+
       return false;
     };
     sharedData.getProperties = function (sharedContent) {
@@ -500,12 +526,47 @@ module.exports = {
         )
         .setType('Number');
 
+      sharedProperties
+        .getOrCreate('stepsPerSecond')
+        .setValue(
+          (sharedContent.hasChild('stepsPerSecond')
+            ? sharedContent.getChild('stepsPerSecond').getDoubleValue()
+            : 60
+          ).toString(10)
+        )
+        .setType('Number')
+        .setLabel(_('Simulation steps per second'))
+        .setDescription(
+          _(
+            'The world is simulated with this fixed rate, whatever the frame rate of the game.'
+          )
+        )
+        .setAdvanced(true);
+      sharedProperties
+        .getOrCreate('maxStepsPerFrame')
+        .setValue(
+          (sharedContent.hasChild('maxStepsPerFrame')
+            ? sharedContent.getChild('maxStepsPerFrame').getDoubleValue()
+            : 5
+          ).toString(10)
+        )
+        .setType('Number')
+        .setLabel(_('Maximum simulation steps per frame'))
+        .setDescription(
+          _(
+            'When the game is too slow, the simulation is slowed down rather than doing more steps.'
+          )
+        )
+        .setAdvanced(true);
+
       return sharedProperties;
     };
     sharedData.initializeContent = function (behaviorContent) {
       behaviorContent.addChild('gravityX').setDoubleValue(0);
       behaviorContent.addChild('gravityY').setDoubleValue(9.8);
       behaviorContent.addChild('worldScale').setDoubleValue(100);
+      behaviorContent.addChild('stepsPerSecond').setDoubleValue(60);
+      behaviorContent.addChild('maxStepsPerFrame').setDoubleValue(5);
       // Set deprecated properties for compatibility with 5.4.209-
       behaviorContent.addChild('scaleX').setDoubleValue(100);
       behaviorContent.addChild('scaleY').setDoubleValue(100);
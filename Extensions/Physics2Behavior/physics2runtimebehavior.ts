@@ -37,6 +37,8 @@ namespace gdjs {
     invScaleY: float;
 
     timeStep: float;
+    /** The maximum number of world steps done in one frame. */
+    maxStepsPerFrame: integer;
     frameTime: float = 0;
     stepped: boolean = false;
     timeScale: float = 1;
@@ -71,7 +73,8 @@ namespace gdjs {
       this.worldScale =
         sharedData.worldScale || Math.sqrt(this.scaleX * this.scaleY);
       this.worldInvScale = 1 / this.worldScale;
-      this.timeStep = 1 / 60;
+      this.timeStep = 1 / (sharedData.stepsPerSecond || 60);
+      this.maxStepsPerFrame = sharedData.maxStepsPerFrame || 5;
       this.world = new Box2D.b2World(this.b2Vec2(this.gravityX, this.gravityY));
       this.world.SetAutoClearForces(false);
       this.staticBody = this.world.CreateBody(new Box2D.b2BodyDef());
@@ -198,8 +201,8 @@ namespace gdjs {
         Math.round(this.frameTime / this.timeStep)
       );
       this.frameTime -= numberOfSteps * this.timeStep;
-      if (numberOfSteps > 5) {
-        numberOfSteps = 5;
+      if (numberOfSteps > this.maxStepsPerFrame) {
+        numberOfSteps = this.maxStepsPerFrame;
       }
       for (let i = 0; i < numberOfSteps; i++) {
         this.world.Step(this.timeStep * this.timeScale, 8, 10);
@@ -499,7 +502,9 @@ namespace gdjs {
       return true;
     }
 
-    getNetworkSyncData(): Physics2NetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): Physics2NetworkSyncData {
       const bodyProps = this._body
         ? {
             tpx: this._body.GetTransform().get_p().get_x(),
@@ -520,7 +525,7 @@ namespace gdjs {
             aw: undefined,
           };
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         props: {
           ...bodyProps,
           layers: this.layers,
@@ -414,6 +414,45 @@ describe('Physics2RuntimeBehavior', () => {
     });
   });
 
+  describe('Simulation steps', () => {
+    it('steps the world with the configured rate and maximum of steps', () => {
+      const [, runtimeScene] = createGameWithSceneWithPhysics2SharedData();
+      runtimeScene.setInitialSharedDataForBehavior('Physics2', {
+        gravityX: 0,
+        gravityY: 0,
+        scaleX: 1,
+        scaleY: 1,
+        stepsPerSecond: 30,
+        maxStepsPerFrame: 2,
+      });
+      const sharedData = gdjs.Physics2SharedData.getSharedData(
+        runtimeScene,
+        'Physics2'
+      );
+      expect(sharedData.timeStep).to.be(1 / 30);
+
+      let stepsCount = 0;
+      const world = sharedData.world;
+      const step = world.Step.bind(world);
+      world.Step = (timeStep, velocityIterations, positionIterations) => {
+        stepsCount++;
+        step(timeStep, velocityIterations, positionIterations);
+      };
+
+      // It's a bit early but the step is done.
+      sharedData.step(1 / 40);
+      expect(stepsCount).to.be(1);
+      // The world is already ahead.
+      sharedData.step(1 / 240);
+      expect(stepsCount).to.be(1);
+      sharedData.step(1 / 30);
+      expect(stepsCount).to.be(2);
+      // The game is slow but the number of steps is limited.
+      sharedData.step(1);
+      expect(stepsCount).to.be(4);
+    });
+  });
+
   describe('Contacts computation', () => {
     let runtimeGame;
     let runtimeScene;
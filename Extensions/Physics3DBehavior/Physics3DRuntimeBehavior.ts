@@ -66,6 +66,7 @@ namespace gdjs {
     _tempVec3 = new Jolt.Vec3();
     _tempRVec3 = new Jolt.RVec3();
     _tempQuat = new Jolt.Quat();
+    _tempEuler = new THREE.Euler(0, 0, 0, 'ZYX');
 
     stepped: boolean = false;
     /**
@@ -495,7 +496,9 @@ namespace gdjs {
       return true;
     }
 
-    override getNetworkSyncData(): Physics3DNetworkSyncData {
+    override getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): Physics3DNetworkSyncData {
       let bodyProps;
       if (this._body) {
         const position = this._body.GetPosition();
@@ -537,7 +540,7 @@ namespace gdjs {
         };
       }
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         props: {
           ...bodyProps,
           layers: this.layers,
@@ -1042,9 +1045,8 @@ namespace gdjs {
       threeObject.quaternion.y = physicsRotation.GetY();
       threeObject.quaternion.z = physicsRotation.GetZ();
       threeObject.quaternion.w = physicsRotation.GetW();
-      // TODO Avoid this instantiation
-      const euler = new THREE.Euler(0, 0, 0, 'ZYX');
-      euler.setFromQuaternion(threeObject.quaternion);
+      const euler = this._sharedData._tempEuler;
+      euler.setFromQuaternion(threeObject.quaternion, 'ZYX');
       this.owner3D.setRotationX(gdjs.toDegrees(euler.x));
       this.owner3D.setRotationY(gdjs.toDegrees(euler.y));
       this.owner3D.setAngle(gdjs.toDegrees(euler.z));
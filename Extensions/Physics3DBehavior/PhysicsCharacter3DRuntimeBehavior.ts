@@ -277,13 +277,15 @@ namespace gdjs {
       return true;
     }
 
-    override getNetworkSyncData(): PhysicsCharacter3DNetworkSyncData {
+    override getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): PhysicsCharacter3DNetworkSyncData {
       // This method is called, so we are synchronizing this object.
       // Let's clear the inputs between frames as we control it.
       this._dontClearInputsBetweenFrames = false;
 
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         props: {
           fwa: this._forwardAngle,
           fws: this._currentForwardSpeed,
@@ -391,9 +393,8 @@ namespace gdjs {
       threeObject.quaternion.y = physicsRotation.GetY();
       threeObject.quaternion.z = physicsRotation.GetZ();
       threeObject.quaternion.w = physicsRotation.GetW();
-      // TODO Avoid this instantiation
-      const euler = new THREE.Euler(0, 0, 0, 'ZYX');
-      euler.setFromQuaternion(threeObject.quaternion);
+      const euler = this._sharedData._tempEuler;
+      euler.setFromQuaternion(threeObject.quaternion, 'ZYX');
       // No need to update the rotation for X and Y as CharacterVirtual doesn't change it.
       this.owner3D.setAngle(gdjs.toDegrees(euler.z));
     }
@@ -22,6 +22,8 @@ void ScenePhysicsDatas::InitializeContent(
   behaviorSharedDataContent.SetAttribute("gravityY", 9);
   behaviorSharedDataContent.SetAttribute("scaleX", 100);
   behaviorSharedDataContent.SetAttribute("scaleY", 100);
+  behaviorSharedDataContent.SetAttribute("stepsPerSecond", 60);
+  behaviorSharedDataContent.SetAttribute("maxStepsPerFrame", 5);
 };
 
 #if defined(GD_IDE_ONLY)
@@ -36,6 +38,11 @@ std::map<gd::String, gd::PropertyDescriptor> ScenePhysicsDatas::GetProperties(
       gd::String::From(behaviorSharedDataContent.GetDoubleAttribute("scaleX")));
   properties[_("Y Scale: number of pixels for 1 meter")].SetValue(
       gd::String::From(behaviorSharedDataContent.GetDoubleAttribute("scaleY")));
+  properties[_("Simulation steps per second")].SetValue(gd::String::From(
+      behaviorSharedDataContent.GetDoubleAttribute("stepsPerSecond", 60)));
+  properties[_("Maximum simulation steps per frame")].SetValue(
+      gd::String::From(
+          behaviorSharedDataContent.GetIntAttribute("maxStepsPerFrame", 5)));
 
   return properties;
 }
@@ -56,6 +63,15 @@ bool ScenePhysicsDatas::UpdateProperty(
   if (name == _("Y scale: number of pixels for 1 meter")) {
     behaviorSharedDataContent.SetAttribute("scaleY", value.To<float>());
   }
+  if (name == _("Simulation steps per second")) {
+    if (value.To<float>() <= 0) return false;
+    behaviorSharedDataContent.SetAttribute("stepsPerSecond",
+                                           value.To<float>());
+  }
+  if (name == _("Maximum simulation steps per frame")) {
+    if (value.To<int>() < 1) return false;
+    behaviorSharedDataContent.SetAttribute("maxStepsPerFrame", value.To<int>());
+  }
 
   return true;
 }
@@ -13,6 +13,7 @@ namespace gdjs {
     stepped: boolean = false;
     totalTime: float = 0;
     fixedTimeStep: any;
+    maxStepsPerFrame: any;
     scaleX: any;
     scaleY: any;
     invScaleX: any;
@@ -24,7 +25,8 @@ namespace gdjs {
     contactListener: any;
 
     constructor(runtimeScene, sharedData) {
-      this.fixedTimeStep = 1 / 60;
+      this.fixedTimeStep = 1 / (sharedData.stepsPerSecond || 60);
+      this.maxStepsPerFrame = sharedData.maxStepsPerFrame || 5;
       this.scaleX = sharedData.scaleX;
       this.scaleY = sharedData.scaleY;
       this.invScaleX = 1 / this.scaleX;
@@ -107,11 +109,11 @@ namespace gdjs {
       if (this.totalTime > this.fixedTimeStep) {
         let numberOfSteps = Math.floor(this.totalTime / this.fixedTimeStep);
         this.totalTime -= numberOfSteps * this.fixedTimeStep;
-        if (numberOfSteps > 5) {
-          numberOfSteps = 5;
+        if (numberOfSteps > this.maxStepsPerFrame) {
+          numberOfSteps = this.maxStepsPerFrame;
         }
 
-        //Process 5 steps at max.
+        //Process a limited number of steps to avoid to slow down the game.
         for (let a = 0; a < numberOfSteps; a++) {
           this.world.Step(this.fixedTimeStep, 6, 10);
         }
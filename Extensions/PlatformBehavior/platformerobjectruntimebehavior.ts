@@ -172,8 +172,15 @@ namespace gdjs {
     _grabbingPlatform: GrabbingPlatform;
     _onLadder: OnLadder;
 
-    /** Platforms near the object, updated with `_updatePotentialCollidingObjects`. */
+    /**
+     * Platforms and jumpthrus (but not ladders) near the object, updated with
+     * `_updatePotentialCollidingObjects`.
+     */
     _potentialCollidingObjects: Array<gdjs.PlatformRuntimeBehavior>;
+    /** Jumpthrus near the object, updated with `_updatePotentialCollidingObjects`. */
+    _potentialCollidingJumpThrus: Array<gdjs.PlatformRuntimeBehavior>;
+    /** Ladders near the object, updated with `_updatePotentialCollidingObjects`. */
+    _potentialCollidingLadders: Array<gdjs.PlatformRuntimeBehavior>;
 
     /** Overlapped jump-thru platforms, updated with `_updateOverlappedJumpThru`. */
     _overlappedJumpThru: Array<gdjs.PlatformRuntimeBehavior>;
@@ -215,6 +222,8 @@ namespace gdjs {
       this.setSlopeMaxAngle(behaviorData.slopeMaxAngle);
 
       this._potentialCollidingObjects = [];
+      this._potentialCollidingJumpThrus = [];
+      this._potentialCollidingLadders = [];
       this._overlappedJumpThru = [];
 
       this._manager = gdjs.PlatformObjectsManager.getManager(instanceContainer);
@@ -227,14 +236,16 @@ namespace gdjs {
       this._state = this._falling;
     }
 
-    getNetworkSyncData(): PlatformerObjectNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): PlatformerObjectNetworkSyncData {
       // This method is called, so we are synchronizing this object.
       // Let's clear the inputs between frames as we control it.
       this._dontClearInputsBetweenFrames = false;
       this._ignoreDefaultControlsAsSyncedByNetwork = false;
 
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         props: {
           cs: this._currentSpeed,
 
@@ -1269,11 +1280,9 @@ namespace gdjs {
      */
     private _updateOverlappedJumpThru() {
       this._overlappedJumpThru.length = 0;
-      for (let i = 0; i < this._potentialCollidingObjects.length; ++i) {
-        const platform = this._potentialCollidingObjects[i];
+      for (let i = 0; i < this._potentialCollidingJumpThrus.length; ++i) {
+        const platform = this._potentialCollidingJumpThrus[i];
         if (
-          platform.getPlatformType() ===
-            gdjs.PlatformRuntimeBehavior.JUMPTHRU &&
           gdjs.RuntimeObject.collisionTest(
             this.owner,
             platform.owner,
@@ -1290,14 +1299,8 @@ namespace gdjs {
      * Note: _updatePotentialCollidingObjects must have been called before.
      */
     _isOverlappingLadder() {
-      for (let i = 0; i < this._potentialCollidingObjects.length; ++i) {
-        const platform = this._potentialCollidingObjects[i];
-        if (
-          platform.getPlatformType() !== gdjs.PlatformRuntimeBehavior.LADDER
-        ) {
-          continue;
-        }
-
+      for (let i = 0; i < this._potentialCollidingLadders.length; ++i) {
+        const platform = this._potentialCollidingLadders[i];
         if (
           gdjs.RuntimeObject.collisionTest(
             this.owner,
@@ -1321,27 +1324,20 @@ namespace gdjs {
     }
 
     /**
-     * Update _potentialCollidingObjects member with platforms near the object.
+     * Update _potentialCollidingObjects, _potentialCollidingJumpThrus and
+     * _potentialCollidingLadders members with platforms near the object.
      */
     private _updatePotentialCollidingObjects(maxMovementLength: float) {
-      const object = this.owner;
-
-      this._manager.getAllPlatformsAround(
-        object,
+      // The object owning the behavior is excluded so that it's not considered
+      // as colliding with itself, in the case that it also has the platform
+      // behavior.
+      this._manager.getPlatformsAroundByType(
+        this.owner,
         maxMovementLength,
-        this._potentialCollidingObjects
+        this._potentialCollidingObjects,
+        this._potentialCollidingJumpThrus,
+        this._potentialCollidingLadders
       );
-
-      // Filter the potential colliding platforms to ensure that the object owning the behavior
-      // is not considered as colliding with itself, in the case that it also has the
-      // platform behavior.
-      for (let i = 0; i < this._potentialCollidingObjects.length; ) {
-        if (this._potentialCollidingObjects[i].owner === object) {
-          this._potentialCollidingObjects.splice(i, 1);
-        } else {
-          i++;
-        }
-      }
     }
 
     /**
@@ -11,12 +11,17 @@ namespace gdjs {
    * platform behavior: in particular, the platforms behaviors are required to
    * declare themselves (see PlatformObjectsManager.addPlatform) to the manager
    * of their associated container (see PlatformRuntimeBehavior.getManager).
+   *
+   * Platforms are stored in one RBush per platform type, so that characters
+   * can get the platforms, jumpthrus and ladders around them already sorted
+   * (see PlatformObjectsManager.getPlatformsAroundByType).
    */
   export class PlatformObjectsManager {
-    private _platformRBush: any;
+    /** The RBushes of the platforms, indexed by platform type. */
+    private _platformRBushes: any[];
 
     constructor(instanceContainer: gdjs.RuntimeInstanceContainer) {
-      this._platformRBush = new rbush();
+      this._platformRBushes = [new rbush(), new rbush(), new rbush()];
     }
 
     /**
@@ -44,7 +49,10 @@ namespace gdjs {
         platformBehavior.currentRBushAABB = new gdjs.BehaviorRBushAABB(
           platformBehavior
         );
-      this._platformRBush.insert(platformBehavior.currentRBushAABB);
+      platformBehavior._rBushPlatformType = platformBehavior.getPlatformType();
+      this._platformRBushes[platformBehavior._rBushPlatformType].insert(
+        platformBehavior.currentRBushAABB
+      );
     }
 
     /**
@@ -52,19 +60,18 @@ namespace gdjs {
      * added before.
      */
     removePlatform(platformBehavior: gdjs.PlatformRuntimeBehavior) {
-      this._platformRBush.remove(platformBehavior.currentRBushAABB);
+      this._platformRBushes[platformBehavior._rBushPlatformType].remove(
+        platformBehavior.currentRBushAABB
+      );
     }
 
     /**
-     * Returns all the platforms around the specified object.
-     * @param maxMovementLength The maximum distance, in pixels, the object is going to do.
-     * @return An array with all platforms near the object.
+     * Set the area around the object where platforms can be reached.
      */
-    getAllPlatformsAround(
+    private static _getSearchArea(
       object: gdjs.RuntimeObject,
-      maxMovementLength: number,
-      result: PlatformRuntimeBehavior[]
-    ): any {
+      maxMovementLength: number
+    ): SearchArea {
       // TODO: This would better be done using the object AABB (getAABB), as (`getCenterX`;`getCenterY`) point
       // is not necessarily in the middle of the object (for sprites for example).
       const ow = object.getWidth();
@@ -72,22 +79,39 @@ namespace gdjs {
       const x = object.getDrawableX() + object.getCenterX();
       const y = object.getDrawableY() + object.getCenterY();
       const searchArea: SearchArea = gdjs.staticObject(
-        PlatformObjectsManager.prototype.getAllPlatformsAround
+        PlatformObjectsManager._getSearchArea
       ) as SearchArea;
       searchArea.minX = x - ow / 2 - maxMovementLength;
       searchArea.minY = y - oh / 2 - maxMovementLength;
       searchArea.maxX = x + ow / 2 + maxMovementLength;
       searchArea.maxY = y + oh / 2 + maxMovementLength;
-      const nearbyPlatforms: gdjs.BehaviorRBushAABB<PlatformRuntimeBehavior>[] =
-        this._platformRBush.search(searchArea);
+      return searchArea;
+    }
 
-      result.length = 0;
+    /**
+     * Add the platforms of a RBush which are in the search area to an array.
+     * @param platformRBush The RBush to search in.
+     * @param searchArea The area to search.
+     * @param excludedObject An object whose platform must not be added.
+     * @param result The array where platforms are added.
+     */
+    private static _addPlatformsInArea(
+      platformRBush: any,
+      searchArea: SearchArea,
+      excludedObject: gdjs.RuntimeObject | null,
+      result: PlatformRuntimeBehavior[]
+    ): void {
+      const nearbyPlatforms: gdjs.BehaviorRBushAABB<PlatformRuntimeBehavior>[] =
+        platformRBush.search(searchArea);
 
       // Extra check on the platform owner AABB
       // TODO: PR https://github.com/4ian/GDevelop/pull/2602 should remove the need
       // for this extra check once merged.
       for (let i = 0; i < nearbyPlatforms.length; i++) {
         const platform = nearbyPlatforms[i].behavior;
+        if (platform.owner === excludedObject) {
+          continue;
+        }
         const platformAABB = platform.owner.getAABB();
         const platformIsStillAround =
           platformAABB.min[0] <= searchArea.maxX &&
@@ -102,6 +126,79 @@ namespace gdjs {
         }
       }
     }
+
+    /**
+     * Find the platforms around the specified object, sorted by type, with a
+     * search in the RBush of each type.
+     * @param object The object searching for platforms. Its own platform
+     * behavior, if any, is excluded.
+     * @param maxMovementLength The maximum distance, in pixels, the object is going to do.
+     * @param platforms An array filled with the normal platforms and the
+     * jumpthrus around the object (the platforms the object can collide with).
+     * @param jumpThrus An array filled with the jumpthrus around the object.
+     * @param ladders An array filled with the ladders around the object.
+     */
+    getPlatformsAroundByType(
+      object: gdjs.RuntimeObject,
+      maxMovementLength: number,
+      platforms: PlatformRuntimeBehavior[],
+      jumpThrus: PlatformRuntimeBehavior[],
+      ladders: PlatformRuntimeBehavior[]
+    ): void {
+      const searchArea = PlatformObjectsManager._getSearchArea(
+        object,
+        maxMovementLength
+      );
+      platforms.length = 0;
+      jumpThrus.length = 0;
+      ladders.length = 0;
+      PlatformObjectsManager._addPlatformsInArea(
+        this._platformRBushes[PlatformRuntimeBehavior.JUMPTHRU],
+        searchArea,
+        object,
+        jumpThrus
+      );
+      PlatformObjectsManager._addPlatformsInArea(
+        this._platformRBushes[PlatformRuntimeBehavior.NORMALPLATFORM],
+        searchArea,
+        object,
+        platforms
+      );
+      for (let i = 0; i < jumpThrus.length; i++) {
+        platforms.push(jumpThrus[i]);
+      }
+      PlatformObjectsManager._addPlatformsInArea(
+        this._platformRBushes[PlatformRuntimeBehavior.LADDER],
+        searchArea,
+        object,
+        ladders
+      );
+    }
+
+    /**
+     * Returns all the platforms around the specified object.
+     * @param maxMovementLength The maximum distance, in pixels, the object is going to do.
+     * @return An array with all platforms near the object.
+     */
+    getAllPlatformsAround(
+      object: gdjs.RuntimeObject,
+      maxMovementLength: number,
+      result: PlatformRuntimeBehavior[]
+    ): any {
+      const searchArea = PlatformObjectsManager._getSearchArea(
+        object,
+        maxMovementLength
+      );
+      result.length = 0;
+      for (let i = 0; i < this._platformRBushes.length; i++) {
+        PlatformObjectsManager._addPlatformsInArea(
+          this._platformRBushes[i],
+          searchArea,
+          null,
+          result
+        );
+      }
+    }
   }
 
   /**
@@ -124,6 +221,8 @@ namespace gdjs {
       null;
     _manager: gdjs.PlatformObjectsManager;
     _registeredInManager: boolean = false;
+    /** The type of the platform when it was added in the manager RBushes. */
+    _rBushPlatformType: integer = 0;
 
     constructor(
       instanceContainer: gdjs.RuntimeInstanceContainer,
@@ -224,6 +323,7 @@ namespace gdjs {
     }
 
     changePlatformType(platformType: string) {
+      const oldPlatformType = this._platformType;
       if (platformType === 'Ladder') {
         this._platformType = PlatformRuntimeBehavior.LADDER;
       } else if (platformType === 'Jumpthru') {
@@ -231,6 +331,11 @@ namespace gdjs {
       } else {
         this._platformType = PlatformRuntimeBehavior.NORMALPLATFORM;
       }
+      if (this._registeredInManager && oldPlatformType !== this._platformType) {
+        // Move the platform to the RBush of its new type.
+        this._manager.removePlatform(this);
+        this._manager.addPlatform(this);
+      }
     }
 
     getPlatformType() {
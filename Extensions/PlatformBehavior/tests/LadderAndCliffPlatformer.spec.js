@@ -530,6 +530,24 @@ describe('gdjs.PlatformerObjectRuntimeBehavior', function () {
       }
     });
 
+    it('can climb a ladder after its platform type changed', function () {
+      object.setPosition(30, -32);
+      // Ensure the object falls on the platform
+      fallOnPlatform(10);
+
+      // The ladder is now a jumpthru: it can't be climbed.
+      ladder.getBehavior('Platform').changePlatformType('Jumpthru');
+      object.getBehavior('auto1').simulateLadderKey();
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(object.getBehavior('auto1').isOnLadder()).to.be(false);
+      expect(object.getY()).to.be(-30);
+
+      // The jumpthru is a ladder again.
+      ladder.getBehavior('Platform').changePlatformType('Ladder');
+      object.getBehavior('auto1').simulateLadderKey();
+      climbLadder(10);
+    });
+
     it('can jump and grab a ladder even on the ascending phase of a jump the 1st time', function () {
       object.setPosition(30, -32);
       // Ensure the object falls on the platform
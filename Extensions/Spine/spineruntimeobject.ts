@@ -47,6 +47,11 @@ namespace gdjs {
     private _animationSpeedScale: float = 1;
     private _animationPaused: boolean = false;
     private _isPausedFrameDirty = false;
+    /**
+     * The animation time (in seconds, multiplied by the speed scale) not
+     * applied to the skeleton yet, because the object was not visible.
+     */
+    private _pendingAnimationTime: float = 0;
     /** The duration in second for the smooth transition between 2 animations */
     private _animationMixingDuration: number;
     private _renderer: gdjs.SpineRuntimeObjectPixiRenderer;
@@ -81,17 +86,40 @@ namespace gdjs {
     update(instanceContainer: gdjs.RuntimeInstanceContainer): void {
       if (this._animationPaused) {
         if (this._isPausedFrameDirty) {
-          this._renderer.updateAnimation(0);
-          this.invalidateHitboxes();
+          this._updateAnimation();
           this._isPausedFrameDirty = false;
         }
         return;
       }
       const elapsedTime = this.getElapsedTime() / 1000;
-      this._renderer.updateAnimation(elapsedTime * this._animationSpeedScale);
+      this._pendingAnimationTime += elapsedTime * this._animationSpeedScale;
+      // Updating the skeletons of a lot of objects outside the screen is
+      // costly. The elapsed time is kept and applied when the object is
+      // visible again, or when its animation state is read.
+      if (!this._renderer.getRendererObject().visible) {
+        return;
+      }
+      this._updateAnimation();
+    }
+
+    updatePreRender(instanceContainer: gdjs.RuntimeInstanceContainer): void {
+      // The object was not visible during the last update but will be
+      // rendered: catch up with its animation.
+      this._ensureAnimationIsUpToDate();
+    }
+
+    private _updateAnimation(): void {
+      this._renderer.updateAnimation(this._pendingAnimationTime);
+      this._pendingAnimationTime = 0;
       this.invalidateHitboxes();
     }
 
+    private _ensureAnimationIsUpToDate(): void {
+      if (this._pendingAnimationTime !== 0) {
+        this._updateAnimation();
+      }
+    }
+
     getRendererObject(): pixi_spine.Spine | PIXI.Container {
       return this._renderer.getRendererObject();
     }
@@ -111,9 +139,11 @@ namespace gdjs {
       return true;
     }
 
-    getNetworkSyncData(): SpineNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): SpineNetworkSyncData {
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         opa: this._opacity,
         scaX: this.getScaleX(),
         scaY: this.getScaleY(),
@@ -391,6 +421,8 @@ namespace gdjs {
       ) {
         return;
       }
+      // Mix from the pose the object should have now.
+      this._ensureAnimationIsUpToDate();
       const previousAnimation = this._animations[this._currentAnimationIndex];
       const newAnimation = this._animations[animationIndex];
       this._currentAnimationIndex = animationIndex;
@@ -462,6 +494,7 @@ namespace gdjs {
     }
 
     hasAnimationEnded(): boolean {
+      this._ensureAnimationIsUpToDate();
       return this._renderer.isAnimationComplete();
     }
 
@@ -489,6 +522,7 @@ namespace gdjs {
       if (this._animations.length === 0) {
         return 0;
       }
+      this._ensureAnimationIsUpToDate();
       return this._renderer.getAnimationElapsedTime();
     }
 
@@ -496,16 +530,19 @@ namespace gdjs {
       if (this._animations.length === 0) {
         return;
       }
+      this._pendingAnimationTime = 0;
       this._renderer.setAnimationElapsedTime(time);
       this._isPausedFrameDirty = true;
     }
 
     getPointAttachmentX(attachmentName: string, slotName?: string): number {
+      this._ensureAnimationIsUpToDate();
       return this._renderer.getPointAttachmentPosition(attachmentName, slotName)
         .x;
     }
 
     getPointAttachmentY(attachmentName: string, slotName?: string): number {
+      this._ensureAnimationIsUpToDate();
       return this._renderer.getPointAttachmentPosition(attachmentName, slotName)
         .y;
     }
@@ -36,7 +36,8 @@ TextObject::TextObject()
       shadowOpacity(127),
       shadowAngle(90),
       shadowDistance(4),
-      shadowBlurRadius(2) {}
+      shadowBlurRadius(2),
+      useGlyphAtlas(false) {}
 
 TextObject::~TextObject() {};
 
@@ -110,6 +111,10 @@ bool TextObject::UpdateProperty(const gd::String& propertyName,
     shadowBlurRadius = newValue.To<double>();
     return true;
   }
+  if (propertyName == "useGlyphAtlas") {
+    useGlyphAtlas = newValue == "1";
+    return true;
+  }
 
   return false;
 }
@@ -255,6 +260,17 @@ std::map<gd::String, gd::PropertyDescriptor> TextObject::GetProperties() const {
       .SetAdvanced()
       .SetQuickCustomizationVisibility(gd::QuickCustomization::Hidden);
 
+  objectProperties["useGlyphAtlas"]
+      .SetValue(useGlyphAtlas ? "true" : "false")
+      .SetType("boolean")
+      .SetLabel(_("Render with a glyph atlas"))
+      .SetDescription(_("Faster for texts changing often (like a score or a "
+                        "timer), but gradients are applied to each character "
+                        "instead of the whole text."))
+      .SetGroup(_("Rendering"))
+      .SetAdvanced()
+      .SetQuickCustomizationVisibility(gd::QuickCustomization::Hidden);
+
   return objectProperties;
 }
 
@@ -304,6 +320,8 @@ void TextObject::DoUnserializeFrom(gd::Project& project,
     SetShadowAngle(content.GetIntAttribute("shadowAngle", 90));
     SetShadowDistance(content.GetIntAttribute("shadowDistance", 4));
     SetShadowBlurRadius(content.GetIntAttribute("shadowBlurRadius", 2));
+
+    SetUsingGlyphAtlas(content.GetBoolAttribute("useGlyphAtlas", false));
   }
 }
 
@@ -356,6 +374,8 @@ void TextObject::DoSerializeTo(gd::SerializerElement& element) const {
   content.SetAttribute("shadowAngle", shadowAngle);
   content.SetAttribute("shadowDistance", shadowDistance);
   content.SetAttribute("shadowBlurRadius", shadowBlurRadius);
+
+  content.SetAttribute("useGlyphAtlas", useGlyphAtlas);
 }
 
 void TextObject::ExposeResources(gd::ArbitraryResourceWorker& worker) {
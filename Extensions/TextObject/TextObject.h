@@ -113,6 +113,12 @@ class GD_EXTENSION_API TextObject : public gd::ObjectConfiguration {
   void SetShadowBlurRadius(double value) { shadowBlurRadius = value; };
   double GetShadowBlurRadius() const { return shadowBlurRadius; };
 
+  /** \brief Return true if the text is rendered with a glyph atlas, which is
+   * faster for texts changing often, instead of a canvas.
+   */
+  bool IsUsingGlyphAtlas() const { return useGlyphAtlas; };
+  void SetUsingGlyphAtlas(bool enable) { useGlyphAtlas = enable; };
+
  private:
   virtual void DoUnserializeFrom(gd::Project& project,
                                  const gd::SerializerElement& element) override;
@@ -137,4 +143,6 @@ class GD_EXTENSION_API TextObject : public gd::ObjectConfiguration {
   double shadowAngle;
   double shadowDistance;
   double shadowBlurRadius;
+
+  bool useGlyphAtlas;
 };
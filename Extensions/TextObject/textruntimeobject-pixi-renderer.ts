@@ -1,8 +1,35 @@
 namespace gdjs {
+  /**
+   * Return the characters of the text that are not printable ASCII
+   * characters, each one only once and sorted.
+   */
+  const getNonAsciiCharacters = (text: string): string => {
+    const characters = new Set<string>();
+    for (const character of text) {
+      const code = character.codePointAt(0) || 0;
+      // Spaces used for the layout are not glyphs.
+      if ((code < 32 || code > 126) && !/\s/.test(character)) {
+        characters.add(character);
+      }
+    }
+    return Array.from(characters).sort().join('');
+  };
+
   class TextRuntimeObjectPixiRenderer {
     _object: gdjs.TextRuntimeObject;
     _fontManager: any;
+    /**
+     * The text rendered with a canvas. When a glyph atlas is used, it's not
+     * displayed but still holds the style of the text.
+     */
     _text: PIXI.Text;
+    /** The text rendered with a glyph atlas, if used. */
+    _bitmapText: PIXI.BitmapText | null = null;
+    /** The name of the glyph atlas obtained for the style of the text. */
+    _bitmapFontName: string | null = null;
+    /** The characters of the glyph atlas that are not ASCII characters. */
+    _bitmapFontExtraCharacters: string = '';
+    _rendererObject: PIXI.Text | PIXI.BitmapText;
     _justCreated: boolean = true;
 
     constructor(
@@ -14,12 +41,28 @@ namespace gdjs {
       this._text = new PIXI.Text(' ', { align: 'left' });
       this._text.anchor.x = 0.5;
       this._text.anchor.y = 0.5;
+      this._text.text =
+        runtimeObject._str.length === 0 ? ' ' : runtimeObject._str;
+      if (runtimeObject._useGlyphAtlas) {
+        this._bitmapText = new PIXI.BitmapText(this._text.text, {
+          fontName: instanceContainer
+            .getGame()
+            .getBitmapFontManager()
+            .getDefaultBitmapFont().font,
+        });
+        this._bitmapText.anchor.x = 0.5;
+        this._bitmapText.anchor.y = 0.5;
+        this._bitmapFontExtraCharacters = getNonAsciiCharacters(
+          runtimeObject._str
+        );
+        this._rendererObject = this._bitmapText;
+      } else {
+        this._rendererObject = this._text;
+      }
       instanceContainer
         .getLayer('')
         .getRenderer()
-        .addRendererObject(this._text, runtimeObject.getZOrder());
-      this._text.text =
-        runtimeObject._str.length === 0 ? ' ' : runtimeObject._str;
+        .addRendererObject(this._rendererObject, runtimeObject.getZOrder());
 
       //Work around a PIXI.js bug. See updateTime method.
       this.updateStyle();
@@ -27,13 +70,13 @@ namespace gdjs {
     }
 
     getRendererObject() {
-      return this._text;
+      return this._rendererObject;
     }
 
     ensureUpToDate() {
       if (this._justCreated) {
         //Work around a PIXI.js bug:
-        this._text.updateText(false);
+        if (!this._bitmapText) this._text.updateText(false);
 
         //Width seems not to be correct when text is not rendered yet.
         this.updatePosition();
@@ -45,6 +88,7 @@ namespace gdjs {
       const fontName =
         '"' + this._fontManager.getFontFamily(this._object._fontName) + '"';
       const style = this._text.style;
+      const previousStyleID = style.styleID;
       style.fontStyle = this._object._italic ? 'italic' : 'normal';
       style.fontWeight = this._object._bold ? 'bold' : 'normal';
       style.fontSize = this._object._characterSize;
@@ -89,16 +133,55 @@ namespace gdjs {
 
       // Prevent spikey outlines by adding a miter limit
       style.miterLimit = 3;
+
+      if (this._bitmapText) {
+        // @ts-ignore
+        this._bitmapText.align = this._object._textAlign;
+        this._bitmapText.maxWidth = style.wordWrap ? style.wordWrapWidth : 0;
+        if (
+          style.styleID !== previousStyleID ||
+          this._bitmapFontName === null
+        ) {
+          this._updateBitmapFont(this._bitmapFontExtraCharacters);
+        }
+      } else if (style.styleID !== previousStyleID) {
+        // Manually ask the PIXI object to re-render as we changed a style property
+        // see http://www.html5gamedevs.com/topic/16924-change-text-style-post-render/
+        // Unchanged styles are not rendered again.
+        // @ts-ignore
+        this._text.dirty = true;
+      }
       this.updatePosition();
+    }
 
-      // Manually ask the PIXI object to re-render as we changed a style property
-      // see http://www.html5gamedevs.com/topic/16924-change-text-style-post-render/
-      // @ts-ignore
-      this._text.dirty = true;
+    /**
+     * Use a glyph atlas drawn with the style of the text and having the glyphs
+     * of all the characters of the text.
+     */
+    private _updateBitmapFont(extraCharacters: string): void {
+      const bitmapText = this._bitmapText;
+      if (!bitmapText) {
+        return;
+      }
+      const bitmapFontManager = this._object
+        .getInstanceContainer()
+        .getGame()
+        .getBitmapFontManager();
+      const bitmapFont = bitmapFontManager.obtainBitmapFontFromTextStyle(
+        this._text.style,
+        extraCharacters
+      );
+      if (this._bitmapFontName !== null) {
+        bitmapFontManager.releaseBitmapFont(this._bitmapFontName);
+      }
+      this._bitmapFontName = bitmapFont.font;
+      this._bitmapFontExtraCharacters = extraCharacters;
+      bitmapText.fontName = bitmapFont.font;
+      bitmapText.fontSize = bitmapFont.size;
     }
 
     updatePosition(): void {
-      if (this._object.isWrapping() && this._text.width !== 0) {
+      if (this._object.isWrapping() && this._rendererObject.width !== 0) {
         const alignmentX =
           this._object._textAlign === 'right'
             ? 1
@@ -109,13 +192,13 @@ namespace gdjs {
         const width = this._object.getWrappingWidth();
 
         // A vector from the custom size center to the renderer center.
-        const centerToCenterX = (width - this._text.width) * (alignmentX - 0.5);
+        const centerToCenterX = (width - this._rendererObject.width) * (alignmentX - 0.5);
 
-        this._text.position.x = this._object.x + width / 2;
-        this._text.anchor.x = 0.5 - centerToCenterX / this._text.width;
+        this._rendererObject.position.x = this._object.x + width / 2;
+        this._rendererObject.anchor.x = 0.5 - centerToCenterX / this._rendererObject.width;
       } else {
-        this._text.position.x = this._object.x + this._text.width / 2;
-        this._text.anchor.x = 0.5;
+        this._rendererObject.position.x = this._object.x + this._rendererObject.width / 2;
+        this._rendererObject.anchor.x = 0.5;
       }
 
       const alignmentY =
@@ -124,33 +207,53 @@ namespace gdjs {
           : this._object._verticalTextAlignment === 'center'
             ? 0.5
             : 0;
-      this._text.position.y =
-        this._object.y + this._text.height * (0.5 - alignmentY);
-      this._text.anchor.y = 0.5;
+      this._rendererObject.position.y =
+        this._object.y + this._rendererObject.height * (0.5 - alignmentY);
+      this._rendererObject.anchor.y = 0.5;
     }
 
     updateAngle(): void {
-      this._text.rotation = gdjs.toRad(this._object.angle);
+      this._rendererObject.rotation = gdjs.toRad(this._object.angle);
     }
 
     updateOpacity(): void {
-      this._text.alpha = this._object.opacity / 255;
+      this._rendererObject.alpha = this._object.opacity / 255;
     }
 
     updateString(): void {
-      this._text.text =
-        this._object._str.length === 0 ? ' ' : this._object._str;
+      const text = this._object._str.length === 0 ? ' ' : this._object._str;
+      if (this._bitmapText) {
+        this._bitmapText.text = text;
+        const extraCharacters = getNonAsciiCharacters(text);
+        // Add the new characters to the glyph atlas (without removing the
+        // ones that are not used anymore, to avoid drawing it again and again).
+        let hasNewCharacters = false;
+        for (const character of extraCharacters) {
+          if (!this._bitmapFontExtraCharacters.includes(character)) {
+            hasNewCharacters = true;
+            break;
+          }
+        }
+        if (hasNewCharacters) {
+          this._updateBitmapFont(
+            getNonAsciiCharacters(this._bitmapFontExtraCharacters + text)
+          );
+        }
+        return;
+      }
+      this._text.text = text;
 
       //Work around a PIXI.js bug.
-      this._text.updateText(false);
+      // Only re-render the text if it changed.
+      this._text.updateText(true);
     }
 
     getWidth(): float {
-      return this._text.width;
+      return this._rendererObject.width;
     }
 
     getHeight(): float {
-      return this._text.height;
+      return this._rendererObject.height;
     }
 
     _getColorHex() {
@@ -184,14 +287,14 @@ namespace gdjs {
      * Get x-scale of the text.
      */
     getScaleX(): float {
-      return this._text.scale.x;
+      return this._rendererObject.scale.x;
     }
 
     /**
      * Get y-scale of the text.
      */
     getScaleY(): float {
-      return this._text.scale.y;
+      return this._rendererObject.scale.y;
     }
 
     /**
@@ -199,8 +302,8 @@ namespace gdjs {
      * @param newScale The new scale for the text object.
      */
     setScale(newScale: float): void {
-      this._text.scale.x = newScale;
-      this._text.scale.y = newScale;
+      this._rendererObject.scale.x = newScale;
+      this._rendererObject.scale.y = newScale;
     }
 
     /**
@@ -208,7 +311,7 @@ namespace gdjs {
      * @param newScale The new x-scale for the text object.
      */
     setScaleX(newScale: float): void {
-      this._text.scale.x = newScale;
+      this._rendererObject.scale.x = newScale;
     }
 
     /**
@@ -216,10 +319,20 @@ namespace gdjs {
      * @param newScale The new y-scale for the text object.
      */
     setScaleY(newScale: float): void {
-      this._text.scale.y = newScale;
+      this._rendererObject.scale.y = newScale;
     }
 
     destroy() {
+      if (this._bitmapText) {
+        if (this._bitmapFontName !== null) {
+          this._object
+            .getInstanceContainer()
+            .getGame()
+            .getBitmapFontManager()
+            .releaseBitmapFont(this._bitmapFontName);
+        }
+        this._bitmapText.destroy();
+      }
       this._text.destroy(true);
     }
   }
@@ -34,6 +34,8 @@ namespace gdjs {
       shadowDistance: float;
       shadowAngle: float;
       shadowBlurRadius: float;
+      /** Render the text with a glyph atlas instead of a canvas */
+      useGlyphAtlas?: boolean;
     };
   };
 
@@ -103,6 +105,7 @@ namespace gdjs {
 
     _padding: integer = 5;
     _str: string;
+    _useGlyphAtlas: boolean;
     _renderer: gdjs.TextRuntimeObjectRenderer;
 
     // We can store the scale as nothing else can change it.
@@ -139,6 +142,7 @@ namespace gdjs {
       this._shadowDistance = content.shadowDistance;
       this._shadowBlur = content.shadowBlurRadius;
       this._shadowAngle = content.shadowAngle;
+      this._useGlyphAtlas = !!content.useGlyphAtlas;
 
       this._renderer = new gdjs.TextRuntimeObjectRenderer(
         this,
@@ -176,6 +180,9 @@ namespace gdjs {
       if (oldContent.underlined !== newContent.underlined) {
         return false;
       }
+      if (!!oldContent.useGlyphAtlas !== !!newContent.useGlyphAtlas) {
+        return false;
+      }
       if (oldContent.textAlignment !== newContent.textAlignment) {
         this.setTextAlignment(newContent.textAlignment);
       }
@@ -214,9 +221,11 @@ namespace gdjs {
       return true;
     }
 
-    getNetworkSyncData(): TextObjectNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): TextObjectNetworkSyncData {
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         str: this._str,
         o: this.opacity,
         cs: this._characterSize,
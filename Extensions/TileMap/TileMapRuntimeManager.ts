@@ -31,12 +31,21 @@ namespace gdjs {
        * It allows to factorize code with the IDE.
        */
       private _manager: TileMapHelper.TileMapManager;
+      /**
+       * Delegate shared by all the scenes of the game to keep the tile maps
+       * parsed from files. These tile maps are never modified, so they can be
+       * reused when a scene is restarted or when another scene uses them.
+       */
+      private _gameManager: TileMapHelper.TileMapManager;
       /**
        * @param instanceContainer The instance container.
        */
       private constructor(instanceContainer: gdjs.RuntimeInstanceContainer) {
         this._instanceContainer = instanceContainer;
         this._manager = new TileMapHelper.TileMapManager();
+        this._gameManager = TileMapHelper.TileMapManager.getManager(
+          instanceContainer.getGame()
+        );
       }
 
       /**
@@ -68,7 +77,15 @@ namespace gdjs {
           tileMapFileContent: TileMapHelper.EditableTileMap | null
         ) => void
       ): void {
-        this._manager.getOrLoadTileMap(
+        const jsonManager = this._instanceContainer.getGame().getJsonManager();
+        // Only keep the tile map for the whole game while its files are
+        // loaded: they can be unloaded with the resources of a scene.
+        const areFilesLoaded =
+          jsonManager.isJsonLoaded(tileMapJsonResourceName) &&
+          (!tileSetJsonResourceName ||
+            jsonManager.isJsonLoaded(tileSetJsonResourceName));
+        const manager = areFilesLoaded ? this._gameManager : this._manager;
+        manager.getOrLoadTileMap(
           this._loadTileMap.bind(this),
           tileMapJsonResourceName,
           tileSetJsonResourceName,
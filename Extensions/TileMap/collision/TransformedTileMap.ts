@@ -121,6 +121,7 @@ namespace gdjs {
           const tile = layer.get(x, y);
           if (tile) {
             tile.invalidate();
+            layer.invalidateChunkTaggedTiles(x, y);
           }
         }
       }
@@ -410,8 +411,18 @@ namespace gdjs {
 
     /**
      * A tile map layer transformed with an affine transformation.
+     *
+     * Tiles are grouped in square chunks that are only built when one of
+     * their tiles is accessed. Building the hitboxes of a big tile map is done
+     * progressively and the chunks without any tile with the tag are skipped
+     * when iterating over hitboxes.
      */
     export class TransformedCollisionTileMapLayer {
+      /**
+       * The number of tile columns and rows of a chunk.
+       */
+      static readonly chunkSize: integer = 16;
+
       /**
        * The time map that contains this layer.
        */
@@ -420,7 +431,16 @@ namespace gdjs {
        * The model that describes the tile map.
        */
       readonly _source: TileMapHelper.EditableTileMapLayer;
-      private readonly _tiles: TransformedCollisionTile[][];
+      private readonly _dimensionX: integer;
+      private readonly _dimensionY: integer;
+      private readonly _chunkCountX: integer;
+      private readonly _chunkCountY: integer;
+      /**
+       * The chunks (row by row), undefined until they are built.
+       */
+      private readonly _chunks: Array<
+        TransformedCollisionTileChunk | undefined
+      >;
 
       /**
        * @param tileMap The time map that contains this layer.
@@ -432,17 +452,40 @@ namespace gdjs {
       ) {
         this.tileMap = tileMap;
         this._source = source;
-        this._tiles = [];
-        const dimX = this._source.getDimensionX();
-        const dimY = this._source.getDimensionY();
-        this._tiles.length = dimY;
-        for (let y = 0; y < dimY; y++) {
-          this._tiles[y] = [];
-          this._tiles[y].length = dimX;
-          for (let x = 0; x < dimX; x++) {
-            this._tiles[y][x] = new TransformedCollisionTile(this, x, y);
-          }
+        this._dimensionX = this._source.getDimensionX();
+        this._dimensionY = this._source.getDimensionY();
+        const chunkSize = TransformedCollisionTileMapLayer.chunkSize;
+        this._chunkCountX = Math.ceil(this._dimensionX / chunkSize);
+        this._chunkCountY = Math.ceil(this._dimensionY / chunkSize);
+        this._chunks = [];
+        this._chunks.length = this._chunkCountX * this._chunkCountY;
+      }
+
+      /**
+       * @param chunkX The chunk column.
+       * @param chunkY The chunk row.
+       * @return The chunk, built if necessary, or undefined if it's outside
+       * of the layer.
+       */
+      getChunk(
+        chunkX: integer,
+        chunkY: integer
+      ): TransformedCollisionTileChunk | undefined {
+        if (
+          chunkX < 0 ||
+          chunkY < 0 ||
+          chunkX >= this._chunkCountX ||
+          chunkY >= this._chunkCountY
+        ) {
+          return undefined;
+        }
+        const chunkIndex = chunkY * this._chunkCountX + chunkX;
+        let chunk = this._chunks[chunkIndex];
+        if (!chunk) {
+          chunk = new TransformedCollisionTileChunk(this, chunkX, chunkY);
+          this._chunks[chunkIndex] = chunk;
         }
+        return chunk;
       }
 
       /**
@@ -451,22 +494,49 @@ namespace gdjs {
        * @return The tile from the tile set.
        */
       get(x: integer, y: integer): TransformedCollisionTile | undefined {
-        const row = this._tiles[y];
-        return row ? row[x] : undefined;
+        if (x < 0 || y < 0 || x >= this._dimensionX || y >= this._dimensionY) {
+          return undefined;
+        }
+        const chunkSize = TransformedCollisionTileMapLayer.chunkSize;
+        const chunk = this.getChunk(
+          Math.floor(x / chunkSize),
+          Math.floor(y / chunkSize)
+        );
+        return chunk ? chunk.get(x, y) : undefined;
+      }
+
+      /**
+       * Make the chunk of a tile find again which of its tiles have the tag.
+       * @param x The layer column of the tile that was changed.
+       * @param y The layer row of the tile that was changed.
+       */
+      invalidateChunkTaggedTiles(x: integer, y: integer): void {
+        if (x < 0 || y < 0 || x >= this._dimensionX || y >= this._dimensionY) {
+          return;
+        }
+        const chunkSize = TransformedCollisionTileMapLayer.chunkSize;
+        const chunk =
+          this._chunks[
+            Math.floor(y / chunkSize) * this._chunkCountX +
+              Math.floor(x / chunkSize)
+          ];
+        if (chunk) {
+          chunk.invalidateTaggedTiles();
+        }
       }
 
       /**
        * The number of tile columns in the layer.
        */
       getDimensionX() {
-        return this._tiles.length === 0 ? 0 : this._tiles[0].length;
+        return this._dimensionX;
       }
 
       /**
        * The number of tile rows in the layer.
        */
       getDimensionY() {
-        return this._tiles.length;
+        return this._dimensionY;
       }
 
       /**
@@ -594,11 +664,30 @@ namespace gdjs {
       }
 
       [Symbol.iterator]() {
-        // Flatten the iterable of each tile into one.
-
-        // xMin and yMin next increment
-        let x = this.xMax;
-        let y = this.yMin - 1;
+        // Flatten the iterable of each tile of each chunk into one.
+        if (this.xMin > this.xMax || this.yMin > this.yMax) {
+          return LayerCollisionMaskIterable.emptyItr;
+        }
+        const chunkSize = TransformedCollisionTileMapLayer.chunkSize;
+        const chunkXMin = Math.floor(this.xMin / chunkSize);
+        const chunkYMin = Math.floor(this.yMin / chunkSize);
+        const chunkXMax = Math.floor(this.xMax / chunkSize);
+        const chunkYMax = Math.floor(this.yMax / chunkSize);
+        // Chunks only know the tiles having the tag of the tile map.
+        const canSkipTiles = this.tag === this.layer.tileMap.tag;
+
+        // chunkXMin and chunkYMin next increment
+        let chunkX = chunkXMax;
+        let chunkY = chunkYMin - 1;
+        let chunk: TransformedCollisionTileChunk | undefined = undefined;
+        // The tiles of the current chunk to iterate over.
+        // They are empty to start with the first chunk.
+        let tileXMin = 0;
+        let tileYMin = 0;
+        let tileXMax = -1;
+        let tileYMax = -1;
+        let x = 0;
+        let y = 0;
         let polygonItr: Iterator<gdjs.Polygon> =
           LayerCollisionMaskIterable.emptyItr;
 
@@ -607,15 +696,55 @@ namespace gdjs {
             let listNext = polygonItr.next();
             while (listNext.done) {
               x++;
-              if (x > this.xMax) {
+              if (x > tileXMax) {
                 y++;
-                x = this.xMin;
+                x = tileXMin;
               }
-              if (y > this.yMax) {
-                // done
-                return listNext;
+              if (y > tileYMax) {
+                // Go to the next chunk having tiles in the area.
+                while (true) {
+                  chunkX++;
+                  if (chunkX > chunkXMax) {
+                    chunkY++;
+                    chunkX = chunkXMin;
+                  }
+                  if (chunkY > chunkYMax) {
+                    // done
+                    return listNext;
+                  }
+                  chunk = this.layer.getChunk(chunkX, chunkY);
+                  if (!chunk) {
+                    continue;
+                  }
+                  if (canSkipTiles) {
+                    if (!chunk.hasTaggedTiles()) {
+                      continue;
+                    }
+                    // Only look at the tiles with the tag.
+                    tileXMin = Math.max(this.xMin, chunk.getTaggedTilesXMin());
+                    tileYMin = Math.max(this.yMin, chunk.getTaggedTilesYMin());
+                    tileXMax = Math.min(this.xMax, chunk.getTaggedTilesXMax());
+                    tileYMax = Math.min(this.yMax, chunk.getTaggedTilesYMax());
+                  } else {
+                    tileXMin = Math.max(this.xMin, chunkX * chunkSize);
+                    tileYMin = Math.max(this.yMin, chunkY * chunkSize);
+                    tileXMax = Math.min(
+                      this.xMax,
+                      (chunkX + 1) * chunkSize - 1
+                    );
+                    tileYMax = Math.min(
+                      this.yMax,
+                      (chunkY + 1) * chunkSize - 1
+                    );
+                  }
+                  if (tileXMin <= tileXMax && tileYMin <= tileYMax) {
+                    break;
+                  }
+                }
+                x = tileXMin;
+                y = tileYMin;
               }
-              const tile = this.layer.get(x, y);
+              const tile = chunk!.get(x, y);
               if (!tile) {
                 continue;
               }
@@ -634,6 +763,154 @@ namespace gdjs {
       }
     }
 
+    /**
+     * A square of tiles of a layer.
+     *
+     * It keeps the area where tiles have the tag of the tile map to avoid to
+     * look at empty tiles.
+     */
+    class TransformedCollisionTileChunk {
+      /**
+       * The layer that contains this chunk.
+       */
+      readonly layer: TransformedCollisionTileMapLayer;
+      /**
+       * The first column of the chunk in the layer.
+       */
+      private readonly _x: integer;
+      /**
+       * The first row of the chunk in the layer.
+       */
+      private readonly _y: integer;
+      private readonly _dimensionX: integer;
+      private readonly _dimensionY: integer;
+      /**
+       * The tiles (row by row).
+       */
+      private readonly _tiles: TransformedCollisionTile[];
+      private _areTaggedTilesUpToDate: boolean = false;
+      private _taggedTilesXMin: integer = 0;
+      private _taggedTilesYMin: integer = 0;
+      private _taggedTilesXMax: integer = -1;
+      private _taggedTilesYMax: integer = -1;
+
+      /**
+       * @param layer The layer that contains this chunk.
+       * @param chunkX The chunk column in the layer.
+       * @param chunkY The chunk row in the layer.
+       */
+      constructor(
+        layer: TransformedCollisionTileMapLayer,
+        chunkX: integer,
+        chunkY: integer
+      ) {
+        this.layer = layer;
+        const chunkSize = TransformedCollisionTileMapLayer.chunkSize;
+        this._x = chunkX * chunkSize;
+        this._y = chunkY * chunkSize;
+        this._dimensionX = Math.min(
+          chunkSize,
+          layer.getDimensionX() - this._x
+        );
+        this._dimensionY = Math.min(
+          chunkSize,
+          layer.getDimensionY() - this._y
+        );
+        this._tiles = [];
+        this._tiles.length = this._dimensionX * this._dimensionY;
+        for (let y = 0; y < this._dimensionY; y++) {
+          for (let x = 0; x < this._dimensionX; x++) {
+            this._tiles[y * this._dimensionX + x] =
+              new TransformedCollisionTile(layer, this._x + x, this._y + y);
+          }
+        }
+      }
+
+      /**
+       * @param x The layer column.
+       * @param y The layer row.
+       * @return The tile from the tile set.
+       */
+      get(x: integer, y: integer): TransformedCollisionTile | undefined {
+        const localX = x - this._x;
+        const localY = y - this._y;
+        if (
+          localX < 0 ||
+          localY < 0 ||
+          localX >= this._dimensionX ||
+          localY >= this._dimensionY
+        ) {
+          return undefined;
+        }
+        return this._tiles[localY * this._dimensionX + localX];
+      }
+
+      invalidateTaggedTiles(): void {
+        this._areTaggedTilesUpToDate = false;
+      }
+
+      private _updateTaggedTiles(): void {
+        if (this._areTaggedTilesUpToDate) {
+          return;
+        }
+        const tag = this.layer.tileMap.tag;
+        this._taggedTilesXMin = Number.MAX_SAFE_INTEGER;
+        this._taggedTilesYMin = Number.MAX_SAFE_INTEGER;
+        this._taggedTilesXMax = -1;
+        this._taggedTilesYMax = -1;
+        for (const tile of this._tiles) {
+          const definition = tile.getDefinition();
+          if (definition && definition.hasTaggedHitBox(tag)) {
+            this._taggedTilesXMin = Math.min(this._taggedTilesXMin, tile.x);
+            this._taggedTilesYMin = Math.min(this._taggedTilesYMin, tile.y);
+            this._taggedTilesXMax = Math.max(this._taggedTilesXMax, tile.x);
+            this._taggedTilesYMax = Math.max(this._taggedTilesYMax, tile.y);
+          }
+        }
+        this._areTaggedTilesUpToDate = true;
+      }
+
+      /**
+       * @returns true if at least one tile has the tag of the tile map.
+       */
+      hasTaggedTiles(): boolean {
+        this._updateTaggedTiles();
+        return this._taggedTilesXMax >= 0;
+      }
+
+      /**
+       * @returns The first layer column with a tile having the tag.
+       */
+      getTaggedTilesXMin(): integer {
+        this._updateTaggedTiles();
+        return this._taggedTilesXMin;
+      }
+
+      /**
+       * @returns The first layer row with a tile having the tag.
+       */
+      getTaggedTilesYMin(): integer {
+        this._updateTaggedTiles();
+        return this._taggedTilesYMin;
+      }
+
+      /**
+       * @returns The last layer column with a tile having the tag.
+       */
+      getTaggedTilesXMax(): integer {
+        this._updateTaggedTiles();
+        return this._taggedTilesXMax;
+      }
+
+      /**
+       * @returns The last layer row with a tile having the tag.
+       */
+      getTaggedTilesYMax(): integer {
+        this._updateTaggedTiles();
+        return this._taggedTilesYMax;
+      }
+    }
+
     /**
      * A tile transformed with an affine transformation.
      */
@@ -33,6 +33,16 @@ export declare namespace PixiTileMapHelper {
     rowCount: number,
     tileSize: number
   ): TileTextureCache;
+  /**
+   * A part of the grid of a tile map, in tile coordinates.
+   * Maximums are excluded.
+   */
+  type GridArea = {
+    minColumn: integer;
+    minRow: integer;
+    maxColumn: integer;
+    maxRow: integer;
+  };
   /**
    * Re-renders the tile map whenever its rendering settings have been changed
    *
@@ -45,13 +55,18 @@ export declare namespace PixiTileMapHelper {
    * - everything (`all`).
    * @param layerIndex If `displayMode` is set to `index`, the layer index to be
    * displayed.
+   * @param area If set, only the tiles of this area are rendered (the
+   * background and the objects are only rendered with the area starting at the
+   * first column and row). It allows to split big tile maps into chunks
+   * rendered separately.
    */
   function updatePixiTileMap(
     untypedPixiTileMap: any,
     tileMap: EditableTileMap,
     textureCache: TileTextureCache,
     displayMode: 'index' | 'visible' | 'all',
-    layerIndex: number
+    layerIndex: number,
+    area?: GridArea
   ): void;
   /**
    * Re-renders the collision mask
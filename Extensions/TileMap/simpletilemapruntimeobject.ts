@@ -47,6 +47,12 @@ namespace gdjs {
     _initialTileMapAsJsObject: TileMapHelper.EditableTileMapAsJsObject;
     readonly _initialTilesWithHitBox: number[];
     _isTileMapDirty: boolean = false;
+    /**
+     * True if only some tiles were changed (see
+     * `gdjs.TileMapRuntimeObjectPixiRenderer.invalidateTile`), so only their
+     * chunks need to be rendered again.
+     */
+    _areTilesDirty: boolean = false;
     _sceneToTileMapTransformation: gdjs.AffineTransformation =
       new gdjs.AffineTransformation();
     _tileMapToSceneTransformation: gdjs.AffineTransformation =
@@ -107,7 +113,8 @@ namespace gdjs {
     }
 
     updatePreRender(instanceContainer: gdjs.RuntimeInstanceContainer): void {
-      if (this._isTileMapDirty) {
+      if (this._isTileMapDirty || this._areTilesDirty) {
+        const isTileMapDirty = this._isTileMapDirty;
         let shouldContinue = true;
         this._tileMapManager.getOrLoadSimpleTileMapTextureCache(
           (textureName) => {
@@ -127,7 +134,11 @@ namespace gdjs {
               // getOrLoadTextureCache already log warns and errors.
               return;
             }
-            this._renderer.refreshPixiTileMap(textureCache);
+            if (isTileMapDirty) {
+              this._renderer.refreshPixiTileMap(textureCache);
+            } else {
+              this._renderer.refreshDirtyChunks(textureCache);
+            }
           },
           (error) => {
             shouldContinue = false;
@@ -143,6 +154,7 @@ namespace gdjs {
           if (tileMap) this._collisionTileMap.updateFromTileMap(tileMap);
         }
         this._isTileMapDirty = false;
+        this._areTilesDirty = false;
       }
     }
 
@@ -163,9 +175,11 @@ namespace gdjs {
       return true;
     }
 
-    getNetworkSyncData(): SimpleTileMapNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): SimpleTileMapNetworkSyncData {
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         op: this._opacity,
         ai: this._atlasImage,
       };
@@ -667,6 +681,7 @@ namespace gdjs {
         return;
       }
       layer.setTile(columnIndex, rowIndex, tileId);
+      this._renderer.invalidateTile(columnIndex, rowIndex);
 
       if (this._collisionTileMap) {
         const oldTileDefinition =
@@ -686,7 +701,7 @@ namespace gdjs {
           );
         }
       }
-      this._isTileMapDirty = true;
+      this._areTilesDirty = true;
       this.invalidateHitboxes();
     }
 
@@ -708,7 +723,7 @@ namespace gdjs {
       flip: boolean
     ) {
       this._renderer.flipTileOnY(columnIndex, rowIndex, 0, flip);
-      this._isTileMapDirty = true;
+      this._areTilesDirty = true;
       // No need to invalidate hit boxes since at the moment, collision mask
       // cannot be configured on each tile.
     }
@@ -719,7 +734,7 @@ namespace gdjs {
       flip: boolean
     ) {
       this._renderer.flipTileOnX(columnIndex, rowIndex, 0, flip);
-      this._isTileMapDirty = true;
+      this._areTilesDirty = true;
       // No need to invalidate hit boxes since at the moment, collision mask
       // cannot be configured on each tile.
     }
@@ -766,6 +781,7 @@ namespace gdjs {
         return;
       }
       layer.removeTile(columnIndex, rowIndex);
+      this._renderer.invalidateTile(columnIndex, rowIndex);
       if (this._collisionTileMap) {
         this._collisionTileMap.invalidateTile(
           this._layerIndex,
@@ -773,7 +789,7 @@ namespace gdjs {
           rowIndex
         );
       }
-      this._isTileMapDirty = true;
+      this._areTilesDirty = true;
       this.invalidateHitboxes();
     }
 
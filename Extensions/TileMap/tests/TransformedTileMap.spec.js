@@ -0,0 +1,147 @@
+// @ts-check
+describe('gdjs.TileMap.TransformedCollisionTileMap', function () {
+  const tileSize = 8;
+  const dimension = 40;
+
+  /**
+   * @param {Array<[number, number]>} obstaclePositions
+   */
+  const createTileMap = (obstaclePositions) => {
+    /** @type {number[][]} */
+    const tiles = [];
+    for (let y = 0; y < dimension; y++) {
+      tiles.push(new Array(dimension).fill(-1));
+    }
+    for (const [x, y] of obstaclePositions) {
+      tiles[y][x] = 1;
+    }
+    const tileMap = TileMapHelper.EditableTileMap.from(
+      {
+        tileWidth: tileSize,
+        tileHeight: tileSize,
+        dimX: dimension,
+        dimY: dimension,
+        layers: [{ id: 0, alpha: 1, tiles }],
+      },
+      { tileSize, tileSetColumnCount: 2, tileSetRowCount: 1 }
+    );
+    const tileDefinition = tileMap.getTileDefinition(1);
+    if (!tileDefinition) {
+      throw new Error('The tile definition was not created.');
+    }
+    tileDefinition.addHitBox(
+      'obstacle',
+      [
+        [0, 0],
+        [0, tileSize],
+        [tileSize, tileSize],
+        [tileSize, 0],
+      ],
+      true
+    );
+    return tileMap;
+  };
+
+  /**
+   * @param {Iterable<gdjs.Polygon>} hitboxes
+   */
+  const getFirstVertices = (hitboxes) =>
+    Array.from(hitboxes).map((polygon) => polygon.vertices[0].slice());
+
+  it('iterates over the hitboxes of all the chunks', function () {
+    const collisionTileMap = new gdjs.TileMap.TransformedCollisionTileMap(
+      createTileMap([
+        [1, 1],
+        [20, 3],
+        [39, 39],
+      ]),
+      'obstacle'
+    );
+
+    expect(
+      getFirstVertices(collisionTileMap.getAllHitboxes('obstacle'))
+    ).to.eql([
+      [8, 8],
+      [160, 24],
+      [312, 312],
+    ]);
+    expect(getFirstVertices(collisionTileMap.getAllHitboxes('other'))).to.eql(
+      []
+    );
+  });
+
+  it('only iterates over the hitboxes of the given area', function () {
+    const collisionTileMap = new gdjs.TileMap.TransformedCollisionTileMap(
+      createTileMap([
+        [1, 1],
+        [15, 15],
+        [16, 16],
+        [20, 3],
+      ]),
+      'obstacle'
+    );
+
+    expect(
+      getFirstVertices(collisionTileMap.getHitboxes('obstacle', 0, 0, 15, 15))
+    ).to.eql([
+      [8, 8],
+      [120, 120],
+    ]);
+    expect(
+      getFirstVertices(collisionTileMap.getHitboxes('obstacle', 15, 3, 20, 16))
+    ).to.eql([
+      [120, 120],
+      [160, 24],
+      [128, 128],
+    ]);
+    expect(
+      getFirstVertices(collisionTileMap.getHitboxes('obstacle', 2, 2, 14, 14))
+    ).to.eql([]);
+    expect(
+      getFirstVertices(
+        collisionTileMap.getHitboxes('obstacle', -10, -10, -1, -1)
+      )
+    ).to.eql([]);
+  });
+
+  it('skips the chunks without any hitbox', function () {
+    const collisionTileMap = new gdjs.TileMap.TransformedCollisionTileMap(
+      createTileMap([[1, 1]]),
+      'obstacle'
+    );
+    const layer = collisionTileMap.getLayer(0);
+    if (!layer) {
+      throw new Error('The layer was not created.');
+    }
+
+    expect(layer.getChunk(0, 0).hasTaggedTiles()).to.be(true);
+    expect(layer.getChunk(1, 1).hasTaggedTiles()).to.be(false);
+    // The last chunks are smaller than the others.
+    expect(layer.getChunk(2, 2).get(39, 39)).not.to.be(undefined);
+    expect(layer.getChunk(3, 0)).to.be(undefined);
+  });
+
+  it('finds the hitboxes of the tiles that are changed', function () {
+    const tileMap = createTileMap([[1, 1]]);
+    const collisionTileMap = new gdjs.TileMap.TransformedCollisionTileMap(
+      tileMap,
+      'obstacle'
+    );
+    expect(
+      getFirstVertices(collisionTileMap.getAllHitboxes('obstacle'))
+    ).to.eql([[8, 8]]);
+
+    const layer = tileMap.getTileLayer(0);
+    if (!layer) {
+      throw new Error('The layer was not created.');
+    }
+    layer.setTile(30, 20, 1);
+    collisionTileMap.invalidateTile(0, 30, 20);
+    layer.removeTile(1, 1);
+    collisionTileMap.invalidateTile(0, 1, 1);
+
+    expect(
+      getFirstVertices(collisionTileMap.getAllHitboxes('obstacle'))
+    ).to.eql([[240, 160]]);
+  });
+});
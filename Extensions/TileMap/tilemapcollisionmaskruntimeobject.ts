@@ -189,9 +189,11 @@ namespace gdjs {
       return true;
     }
 
-    getNetworkSyncData(): TilemapCollisionMaskNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): TilemapCollisionMaskNetworkSyncData {
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         tmjf: this.getTilemapJsonFile(),
         tsjf: this.getTilesetJsonFile(),
         dm: this.getDebugMode(),
@@ -257,11 +259,10 @@ namespace gdjs {
             this._collisionMaskTag,
             this._layerIndex
           );
-          // The tile map polygons always keep the same references.
-          // It works because the tilemap is never modified.
-          this.hitBoxes = Array.from(
-            this._collisionTileMap.getAllHitboxes(this._collisionMaskTag)
-          );
+          // The hitboxes are only listed when they are used by
+          // updateHitBoxes() because tiles are built progressively.
+          this.hitBoxes = [];
+          this.invalidateHitboxes();
           this._renderer.redrawCollisionMask();
 
           this._width = this._collisionTileMap.getWidth() * this._scaleX;
@@ -273,7 +274,8 @@ namespace gdjs {
     updateHitBoxes(): void {
       this.updateTransformation();
       // Update the RuntimeObject hitboxes attribute.
-      for (const _ of this._collisionTileMap.getAllHitboxes(
+      this.hitBoxes.length = 0;
+      for (const polygon of this._collisionTileMap.getAllHitboxes(
         this._collisionMaskTag
       )) {
         // RuntimeObject.hitBoxes contains the same polygons instances as the
@@ -282,8 +284,7 @@ namespace gdjs {
         // When hitboxes for a tile is asked to the model, they are updated
         // according to the new object location if needed.
         // Iterating over all the tiles forces them to update their hitboxes.
-        //
-        // The hitboxes array is built by _updateTileMap().
+        this.hitBoxes.push(polygon);
       }
       this.hitBoxesDirty = false;
       this._renderer.redrawCollisionMask();
@@ -1,9 +1,18 @@
 /// <reference path="helper/TileMapHelper.d.ts" />
 /// <reference path="pixi-tilemap/dist/pixi-tilemap.d.ts" />
 namespace gdjs {
+  /**
+   * The number of columns and rows of the chunks of a tile map.
+   */
+  const chunkSize = 64;
+
   /**
    * The PIXI.js renderer for the Tile map runtime object.
    *
+   * Tiles are rendered in chunks of `chunkSize` columns and rows, so that only
+   * the chunks with changed tiles are filled again and the chunks outside of
+   * the screen are culled.
+   *
    * @class TileMapRuntimeObjectPixiRenderer
    */
   export class TileMapRuntimeObjectPixiRenderer {
@@ -13,7 +22,13 @@ namespace gdjs {
     // TODO Move this attribute in the object as it's a model.
     _tileMap: TileMapHelper.EditableTileMap | null = null;
 
-    private _pixiObject: PIXI.tilemap.CompositeTilemap;
+    private _pixiObject: PIXI.Container;
+    /** The chunks of the tile map, row by row. */
+    private _chunks: PIXI.tilemap.CompositeTilemap[] = [];
+    private _chunkColumnCount: integer = 0;
+    /** The chunks to fill again by `refreshDirtyChunks`. */
+    private _dirtyChunkIndices = new Set<integer>();
+    private _animationFrameX: integer = 0;
 
     /**
      * @param runtimeObject The object to render
@@ -31,8 +46,7 @@ namespace gdjs {
       PIXI.tilemap.settings.use32bitIndex = true;
 
       // Load (or reset)
-      this._pixiObject = new PIXI.tilemap.CompositeTilemap();
-      this._pixiObject.tileAnim = [0, 0];
+      this._pixiObject = new PIXI.Container();
 
       instanceContainer
         .getLayer('')
@@ -48,7 +62,10 @@ namespace gdjs {
     }
 
     incrementAnimationFrameX(instanceContainer: gdjs.RuntimeInstanceContainer) {
-      this._pixiObject.tileAnim[0] += 1;
+      this._animationFrameX++;
+      for (const chunk of this._chunks) {
+        chunk.tileAnim[0] = this._animationFrameX;
+      }
     }
 
     updatePixiTileMap(
@@ -56,26 +73,94 @@ namespace gdjs {
       textureCache: TileMapHelper.TileTextureCache
     ) {
       this._tileMap = tileMap;
-      TileMapHelper.PixiTileMapHelper.updatePixiTileMap(
-        this._pixiObject,
-        tileMap,
-        textureCache,
-        // @ts-ignore
-        this._object._displayMode,
-        this._object._layerIndex
-      );
+      this._updateChunks(textureCache, false);
     }
 
     refreshPixiTileMap(textureCache: TileMapHelper.TileTextureCache) {
-      if (!this._tileMap) return;
-      TileMapHelper.PixiTileMapHelper.updatePixiTileMap(
-        this._pixiObject,
-        this._tileMap,
-        textureCache,
-        // @ts-ignore
-        this._object._displayMode,
-        this._object._layerIndex
+      this._updateChunks(textureCache, false);
+    }
+
+    /**
+     * Fill again only the chunks containing the tiles given to `invalidateTile`
+     * since the last refresh.
+     */
+    refreshDirtyChunks(textureCache: TileMapHelper.TileTextureCache) {
+      this._updateChunks(textureCache, true);
+    }
+
+    /**
+     * Mark the chunk containing a tile to be filled again by
+     * `refreshDirtyChunks`.
+     * @param x The layer column.
+     * @param y The layer row.
+     */
+    invalidateTile(x: integer, y: integer): void {
+      this._dirtyChunkIndices.add(
+        Math.floor(y / chunkSize) * this._chunkColumnCount +
+          Math.floor(x / chunkSize)
+      );
+    }
+
+    private _updateChunks(
+      textureCache: TileMapHelper.TileTextureCache,
+      onlyDirtyChunks: boolean
+    ): void {
+      const tileMap = this._tileMap;
+      if (!tileMap) return;
+
+      const chunkColumnCount = Math.max(
+        1,
+        Math.ceil(tileMap.getDimensionX() / chunkSize)
+      );
+      const chunkRowCount = Math.max(
+        1,
+        Math.ceil(tileMap.getDimensionY() / chunkSize)
       );
+      const chunkCount = chunkColumnCount * chunkRowCount;
+      if (
+        chunkColumnCount !== this._chunkColumnCount ||
+        chunkCount !== this._chunks.length
+      ) {
+        // The grid was resized: every chunk must be filled again.
+        onlyDirtyChunks = false;
+        this._chunkColumnCount = chunkColumnCount;
+        while (this._chunks.length > chunkCount) {
+          const chunk = this._chunks.pop();
+          if (chunk) chunk.destroy();
+        }
+        while (this._chunks.length < chunkCount) {
+          const chunk = new PIXI.tilemap.CompositeTilemap();
+          chunk.tileAnim = [this._animationFrameX, 0];
+          // The first chunk also has the background and the objects
+          // (from Tiled object layers), which can be anywhere.
+          chunk.cullable = this._chunks.length > 0;
+          this._pixiObject.addChild(chunk);
+          this._chunks.push(chunk);
+        }
+      }
+
+      for (let index = 0; index < chunkCount; index++) {
+        if (onlyDirtyChunks && !this._dirtyChunkIndices.has(index)) {
+          continue;
+        }
+        const minColumn = (index % chunkColumnCount) * chunkSize;
+        const minRow = Math.floor(index / chunkColumnCount) * chunkSize;
+        TileMapHelper.PixiTileMapHelper.updatePixiTileMap(
+          this._chunks[index],
+          tileMap,
+          textureCache,
+          // @ts-ignore
+          this._object._displayMode,
+          this._object._layerIndex,
+          {
+            minColumn,
+            minRow,
+            maxColumn: minColumn + chunkSize,
+            maxRow: minRow + chunkSize,
+          }
+        );
+      }
+      this._dirtyChunkIndices.clear();
     }
 
     getTileMap(): TileMapHelper.EditableTileMap | null {
@@ -184,6 +269,7 @@ namespace gdjs {
       const tileMap = this._tileMap;
       if (!tileMap) return;
       tileMap.flipTileOnY(x, y, layerIndex, flip);
+      this.invalidateTile(x, y);
     }
 
     /**
@@ -196,6 +282,7 @@ namespace gdjs {
       const tileMap = this._tileMap;
       if (!tileMap) return;
       tileMap.flipTileOnX(x, y, layerIndex, flip);
+      this.invalidateTile(x, y);
     }
 
     /**
@@ -251,7 +338,7 @@ namespace gdjs {
 
     destroy(): void {
       // Keep textures because they are shared by all tile maps.
-      this._pixiObject.destroy(false);
+      this._pixiObject.destroy({ children: true });
     }
   }
   export const TileMapRuntimeObjectRenderer =
@@ -12,6 +12,10 @@ namespace gdjs {
         private _tweens = new Map<string, TweenInstance>();
         /**
          * Allow fast iteration on tween that are active.
+         *
+         * Tweens that are paused, stopped or removed are only taken out of
+         * this array at the next step (see {@link TweenInstance.isActive}) to
+         * avoid to search them and to shift the array each time.
          */
         private _activeTweens = new Array<TweenInstance>();
 
@@ -30,9 +34,16 @@ namespace gdjs {
             readIndex++
           ) {
             const tween = this._activeTweens[readIndex];
+            if (!tween.isActive) {
+              tween.isInActiveTweens = false;
+              continue;
+            }
 
             tween.step();
-            if (!tween.hasFinished()) {
+            if (tween.hasFinished()) {
+              tween.isActive = false;
+              tween.isInActiveTweens = false;
+            } else {
               this._activeTweens[writeIndex] = tween;
               writeIndex++;
             }
@@ -195,14 +206,16 @@ namespace gdjs {
         }
 
         _addActiveTween(tween: TweenInstance): void {
-          this._activeTweens.push(tween);
+          tween.isActive = true;
+          if (!tween.isInActiveTweens) {
+            tween.isInActiveTweens = true;
+            this._activeTweens.push(tween);
+          }
         }
 
         _removeActiveTween(tween: TweenInstance): void {
-          const index = this._activeTweens.findIndex(
-            (activeTween) => activeTween === tween
-          );
-          this._activeTweens.splice(index, 1);
+          // The tween is removed from the array at the next step.
+          tween.isActive = false;
         }
 
         /**
@@ -256,6 +269,15 @@ namespace gdjs {
        * @ignore
        */
       export interface TweenInstance {
+        /**
+         * True when the tween must be stepped by its manager.
+         */
+        isActive: boolean;
+        /**
+         * True when the tween is in the active tweens array of its manager
+         * (even if it's no longer active but not yet removed).
+         */
+        isInActiveTweens: boolean;
         /**
          * Step toward the end.
          * @param timeDelta the duration from the previous step in seconds
@@ -283,6 +305,8 @@ namespace gdjs {
         protected onFinish: () => void;
         protected timeSource: TimeSource;
         protected isPaused = false;
+        isActive = false;
+        isInActiveTweens = false;
 
         constructor(
           timeSource: TimeSource,
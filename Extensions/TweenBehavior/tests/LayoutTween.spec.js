@@ -131,6 +131,41 @@ describe('gdjs.TweenRuntimeBehavior', () => {
     expect(camera.getCameraRotation(runtimeScene, '', 0)).to.be(440);
   });
 
+  it('can pause and resume a tween before the next step', () => {
+    camera.setCameraRotation(runtimeScene, 200, '', 0);
+    tween.tweenCameraRotation2(
+      runtimeScene,
+      'MyTween',
+      600,
+      '',
+      'linear',
+      0.25
+    );
+    for (let i = 0; i < 5; i++) {
+      runtimeScene.renderAndStep(1000 / 60);
+    }
+    expect(camera.getCameraRotation(runtimeScene, '', 0)).to.be(400);
+
+    // The tween is only stepped once.
+    tween.pauseSceneTween(runtimeScene, 'MyTween');
+    tween.resumeSceneTween(runtimeScene, 'MyTween');
+    runtimeScene.renderAndStep(1000 / 60);
+    expect(tween.sceneTweenIsPlaying(runtimeScene, 'MyTween')).to.be(true);
+    expect(camera.getCameraRotation(runtimeScene, '', 0)).to.be(440);
+
+    // A tween replaced by another one is no longer stepped.
+    tween.tweenCameraRotation2(
+      runtimeScene,
+      'MyTween',
+      0,
+      '',
+      'linear',
+      0.25
+    );
+    runtimeScene.renderAndStep(1000 / 60);
+    expect(camera.getCameraRotation(runtimeScene, '', 0)).to.be(396);
+  });
+
   it('can stop and restart a tween', () => {
     camera.setCameraRotation(runtimeScene, 200, '', 0);
 
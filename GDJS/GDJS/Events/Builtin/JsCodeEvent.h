@@ -6,6 +6,7 @@
 #ifndef JSCODEEVENT_H
 #define JSCODEEVENT_H
 #include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/Expression.h"
 namespace gd {
 class Instruction;
@@ -30,7 +31,10 @@ class JsCodeEvent : public gd::BaseEvent {
   virtual bool CanHaveSubEvents() const { return false; }
 
   const gd::String& GetInlineCode() const { return inlineCode; };
-  void SetInlineCode(const gd::String& code) { inlineCode = code; };
+  void SetInlineCode(const gd::String& code) {
+    inlineCode = code;
+    gd::EventsList::NotifyLinksModified();
+  };
 
   const gd::String& GetParameterObjects() const { return parameterObjects.GetPlainString(); };
   void SetParameterObjects(const gd::String& objectName) {
@@ -104,7 +104,8 @@ gd::String BehaviorCodeGenerator::GenerateRuntimeBehaviorCompleteCode(
                   ? GenerateDoStepPreEventsPreludeCode()
                   : "",
               includeFiles,
-              compilationForRuntime);
+              compilationForRuntime,
+              codeGenerationReport);
 
       // Compatibility with GD <= 5.0 beta 75
       if (functionName == "onOwnerRemovedFromScene") {
@@ -198,6 +199,7 @@ CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME = class RUNTIME_BEHAVIOR_CLASSNAME ext
     this._runtimeScene = instanceContainer;
 
     this._onceTriggers = new gdjs.OnceTriggers();
+    this._networkSyncPropertiesTracker = new gdjs.NetworkSyncPropertiesTracker();
     this._behaviorData = {};
     this._sharedData = CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME.getSharedData(
       instanceContainer,
@@ -214,12 +216,12 @@ CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME = class RUNTIME_BEHAVIOR_CLASSNAME ext
   }
 
   // Network sync:
-  getNetworkSyncData() {
+  getNetworkSyncData(syncOptions) {
+    const props = {};
+    GET_NETWORK_SYNC_DATA_CODE
     return {
-      ...super.getNetworkSyncData(),
-      props: {
-        GET_NETWORK_SYNC_DATA_CODE
-      }
+      ...super.getNetworkSyncData(syncOptions),
+      props,
     };
   }
   updateFromNetworkSyncData(networkSyncData) {
@@ -405,7 +407,7 @@ gd::String BehaviorCodeGenerator::GenerateGetPropertyNetworkSyncDataCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
   return gd::String(R"jscode_template(
-    PROPERTY_NAME: this._behaviorData.PROPERTY_NAME,)jscode_template")
+    this._networkSyncPropertiesTracker.addProperty(props, "PROPERTY_NAME", this._behaviorData.PROPERTY_NAME, syncOptions);)jscode_template")
       .FindAndReplace("PROPERTY_NAME", property.GetName());
 }
 
@@ -16,6 +16,7 @@
 namespace gd {
 class NamedPropertyDescriptor;
 class EventsBasedBehavior;
+class CodeGenerationReport;
 }
 
 namespace gdjs {
@@ -28,7 +29,8 @@ namespace gdjs {
  */
 class BehaviorCodeGenerator {
  public:
-  BehaviorCodeGenerator(gd::Project& project_) : project(project_){};
+  BehaviorCodeGenerator(gd::Project& project_)
+      : project(project_), codeGenerationReport(nullptr){};
 
   /**
    * \brief Generate the complete JS class (`gdjs.RuntimeBehavior`) for the
@@ -42,6 +44,15 @@ class BehaviorCodeGenerator {
       std::set<gd::String>& includeFiles,
       bool compilationForRuntime = false);
 
+  /**
+   * \brief Set the report where the size of the code generated for the
+   * functions of the behavior is recorded, or nullptr to not record it (the
+   * default).
+   */
+  void SetCodeGenerationReport(gd::CodeGenerationReport* codeGenerationReport_) {
+    codeGenerationReport = codeGenerationReport_;
+  }
+
   /**
    * \brief Generate the name of the method to get the value of the property
    * of a behavior.
@@ -175,6 +186,7 @@ class BehaviorCodeGenerator {
   gd::String GenerateDoStepPreEventsPreludeCode();
 
   gd::Project& project;
+  gd::CodeGenerationReport* codeGenerationReport;
 
   static gd::String doStepPreEventsFunctionName;
 };
@@ -8,7 +8,9 @@
 #include <algorithm>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/CodeGeneration/CodeGenerationReport.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
@@ -53,6 +55,7 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   // need to do the work on a copy of the events.
   gd::EventsList generatedEvents = events;
   codeGenerator.PreprocessEventList(generatedEvents);
+  gd::EventsCodeGenerator::DeleteUselessEvents(generatedEvents);
   gd::String wholeEventsCode =
       codeGenerator.GenerateEventsListCode(generatedEvents, context);
 
@@ -63,8 +66,7 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
 
   // Global objects lists
   auto allObjectsDeclarationsAndResets =
-      codeGenerator.GenerateAllObjectsDeclarationsAndResets(
-          maxDepthLevelReached);
+      codeGenerator.GenerateAllObjectsDeclarationsAndResets();
   gd::String globalObjectLists = allObjectsDeclarationsAndResets.first;
   gd::String globalObjectListsReset = allObjectsDeclarationsAndResets.second;
 
@@ -74,25 +76,59 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
         codeGenerator.GetCodeNamespace() + ".localVariables = [];\n";
   }
 
-  gd::String output =
-      // clang-format off
+  // Table of the sections measured by the generated code, if any.
+  gd::String profilerSectionsDeclaration;
+  if (!codeGenerator.profilerSectionNames.empty()) {
+    gd::String sectionNamesCode;
+    for (const auto& sectionName : codeGenerator.profilerSectionNames) {
+      if (!sectionNamesCode.empty()) sectionNamesCode += ", ";
+      sectionNamesCode += codeGenerator.ConvertToStringExplicit(sectionName);
+    }
+    profilerSectionsDeclaration =
+        codeGenerator.GetEventsSectionsTimingsAccessor() +
+        " = gdjs.EventsSectionsTimings.getOrCreate(" +
+        codeGenerator.ConvertToStringExplicit(
+            codeGenerator.GetCodeNamespace()) +
+        ", [" + sectionNamesCode + "]);\n";
+    functionPreEventsCode +=
+        codeGenerator.GetEventsSectionsTimingsAccessor() + ".beginFrame();\n";
+  }
+
+  // clang-format off
+  const gd::String outputBegin =
       codeGenerator.GetCodeNamespace() + " = {};\n" +
       localVariablesInitializationCode +
+      profilerSectionsDeclaration +
       globalDeclarations +
-      globalObjectLists + "\n\n" +
-      codeGenerator.GetCustomCodeOutsideMain() + "\n\n" +
+      globalObjectLists + "\n\n";
+  const gd::String functionBegin =
+      "\n\n" +
       fullyQualifiedFunctionName + " = function(" +
         functionArgumentsCode +
       ") {\n" +
-        functionPreEventsCode + "\n" +
-        globalObjectListsReset + "\n" +
-        wholeEventsCode + "\n" +
+        functionPreEventsCode + "\n";
+  const gd::String functionEnd =
+        "\n" +
         globalObjectListsReset + "\n" +
         functionPostEventsCode + "\n" +
         functionReturnCode + "\n" +
       "}\n";
   // clang-format on
 
+  // The code outside main (the code of all the lists of events) is kept in
+  // chunks, and only copied once here.
+  const gd::CodeOutputBuffer& customCodeOutsideMain =
+      codeGenerator.GetCustomCodeOutsideMain();
+  gd::String output;
+  output.reserve(outputBegin.Raw().size() + customCodeOutsideMain.GetSize() +
+                 functionBegin.Raw().size() + wholeEventsCode.Raw().size() +
+                 functionEnd.Raw().size());
+  output += outputBegin;
+  customCodeOutsideMain.AppendTo(output);
+  output += functionBegin;
+  output += wholeEventsCode;
+  output += functionEnd;
+
   return output;
 }
 
@@ -102,11 +138,20 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
     const gd::String& codeNamespace,
     std::set<gd::String>& includeFiles,
     gd::DiagnosticReport& diagnosticReport,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    bool compactCode,
+    bool eventsProfiling,
+    gd::CodeGenerationReport* codeGenerationReport) {
   EventsCodeGenerator codeGenerator(project, scene);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetGenerateCompactCode(compactCode);
+  codeGenerator.SetGenerateEventsProfiling(eventsProfiling);
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
+  codeGenerator.SetCodeGenerationReport(codeGenerationReport);
+  if (codeGenerationReport)
+    codeGenerationReport->BeginEntry(
+        gd::CodeGenerationReport::Scene, scene.GetName(), codeNamespace);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       codeGenerator,
@@ -116,6 +161,7 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
       scene.GetEvents(),
       "",
       "return;\n");
+  if (codeGenerationReport) codeGenerationReport->EndEntry(output.Raw().size());
 
   includeFiles.insert(codeGenerator.GetIncludeFiles().begin(),
                       codeGenerator.GetIncludeFiles().end());
@@ -128,7 +174,8 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
     const gd::EventsFunction& eventsFunction,
     const gd::String& codeNamespace,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    gd::CodeGenerationReport* codeGenerationReport) {
   gd::ObjectsContainer parameterObjectsAndGroups(
       gd::ObjectsContainer::SourceType::Function);
   gd::VariablesContainer parameterVariablesContainer(
@@ -144,6 +191,12 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
 
   gd::DiagnosticReport diagnosticReport;
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
+  codeGenerator.SetCodeGenerationReport(codeGenerationReport);
+  if (codeGenerationReport)
+    codeGenerationReport->BeginEntry(
+        gd::CodeGenerationReport::EventsFunction,
+        eventsFunctionsExtension.GetName() + "::" + eventsFunction.GetName(),
+        codeNamespace);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       codeGenerator, codeGenerator.GetCodeNamespaceAccessor() + "func",
@@ -156,6 +209,7 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
           "runtimeScene.getOnceTriggers()"),
       eventsFunction.GetEvents(), "",
       codeGenerator.GenerateEventsFunctionReturn(eventsFunction));
+  if (codeGenerationReport) codeGenerationReport->EndEntry(output.Raw().size());
 
   // TODO: the editor should pass the diagnostic report and display it to the
   // user. For now, display it in the console.
@@ -181,7 +235,8 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
     const gd::String& onceTriggersVariable,
     const gd::String& preludeCode,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    gd::CodeGenerationReport* codeGenerationReport) {
   gd::ObjectsContainer parameterObjectsContainers(
       gd::ObjectsContainer::SourceType::Function);
   gd::VariablesContainer parameterVariablesContainer(
@@ -200,6 +255,13 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
 
   gd::DiagnosticReport diagnosticReport;
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
+  codeGenerator.SetCodeGenerationReport(codeGenerationReport);
+  if (codeGenerationReport)
+    codeGenerationReport->BeginEntry(
+        gd::CodeGenerationReport::EventsFunction,
+        eventsFunctionsExtension.GetName() + "::" +
+            eventsBasedBehavior.GetName() + "::" + eventsFunction.GetName(),
+        codeNamespace);
 
   // Generate the code setting up the context of the function.
   gd::String fullPreludeCode =
@@ -240,6 +302,7 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
       eventsFunction.GetEvents(),
       "",
       codeGenerator.GenerateEventsFunctionReturn(eventsFunction));
+  if (codeGenerationReport) codeGenerationReport->EndEntry(output.Raw().size());
 
   // TODO: the editor should pass the diagnostic report and display it to the
   // user. For now, display it in the console.
@@ -266,7 +329,8 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionCode(
     const gd::String& preludeCode,
     const gd::String& endingCode,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    gd::CodeGenerationReport* codeGenerationReport) {
   gd::ObjectsContainer parameterObjectsContainers(
       gd::ObjectsContainer::SourceType::Function);
   gd::VariablesContainer parameterVariablesContainer(
@@ -285,6 +349,13 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionCode(
 
   gd::DiagnosticReport diagnosticReport;
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
+  codeGenerator.SetCodeGenerationReport(codeGenerationReport);
+  if (codeGenerationReport)
+    codeGenerationReport->BeginEntry(
+        gd::CodeGenerationReport::EventsFunction,
+        eventsFunctionsExtension.GetName() + "::" +
+            eventsBasedObject.GetName() + "::" + eventsFunction.GetName(),
+        codeNamespace);
 
   // Generate the code setting up the context of the function.
   gd::String fullPreludeCode =
@@ -335,6 +406,7 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionCode(
       eventsFunction.GetEvents(),
       endingCode,
       codeGenerator.GenerateEventsFunctionReturn(eventsFunction));
+  if (codeGenerationReport) codeGenerationReport->EndEntry(output.Raw().size());
 
   // TODO: the editor should pass the diagnostic report and display it to the
   // user. For now, display it in the console.
@@ -686,28 +758,20 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionReturn(
 }
 
 std::pair<gd::String, gd::String>
-EventsCodeGenerator::GenerateAllObjectsDeclarationsAndResets(
-    unsigned int maxDepthLevelReached) {
+EventsCodeGenerator::GenerateAllObjectsDeclarationsAndResets() {
   gd::String globalObjectLists;
   gd::String globalObjectListsReset;
 
-  auto generateDeclarations =
-      [this,
-       &maxDepthLevelReached,
-       &globalObjectLists,
-       &globalObjectListsReset](const gd::Object& object) {
-        // Generate declarations for the objects lists
-        for (unsigned int j = 1; j <= maxDepthLevelReached; ++j) {
-          globalObjectLists += GetCodeNamespaceAccessor() +
-                               ManObjListName(object.GetName()) +
-                               gd::String::From(j) + "= [];\n";
-          globalObjectListsReset += GetCodeNamespaceAccessor() +
-                                    ManObjListName(object.GetName()) +
-                                    gd::String::From(j) + ".length = 0;\n";
-        }
-      };
-
-  GetObjectsContainersList().ForEachObject(generateDeclarations);
+  // Only the lists used by the events are declared (instead of one list per
+  // object and per depth). They are reset once, at the end of the function,
+  // so that they don't keep references to the objects: the events always
+  // fill (or empty) a list before using it.
+  for (const auto& objectListName : usedObjectListNames) {
+    globalObjectLists +=
+        GetCodeNamespaceAccessor() + objectListName + "= [];\n";
+    globalObjectListsReset +=
+        GetCodeNamespaceAccessor() + objectListName + ".length = 0;\n";
+  }
 
   return std::make_pair(globalObjectLists, globalObjectListsReset);
 }
@@ -1054,8 +1118,11 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
 
 gd::String EventsCodeGenerator::GetObjectListName(
     const gd::String& name, const gd::EventsCodeGenerationContext& context) {
-  return GetCodeNamespaceAccessor() + ManObjListName(name) +
-         gd::String::From(context.GetLastDepthObjectListWasNeeded(name));
+  gd::String objectListName =
+      ManObjListName(name) +
+      gd::String::From(context.GetLastDepthObjectListWasNeeded(name));
+  usedObjectListNames.insert(objectListName);
+  return GetCodeNamespaceAccessor() + objectListName;
 }
 
 gd::String EventsCodeGenerator::GenerateGetBehaviorNameCode(
@@ -1078,10 +1145,12 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
               << "ERROR: During code generation, a context tried to use an "
                  "already declared object list without having a parent"
               << std::endl;
-          return "/* Could not declare " + objectListName + " */";
+          return GenerateComment("Could not declare " + objectListName);
         }
 
         if (context.ShouldUseAsyncObjectsList(object)) {
+          if (GetCodeGenerationReport())
+            GetCodeGenerationReport()->AddObjectListsCopied();
           gd::String copiedListName = "asyncObjectsList.getObjects(" +
                                       ConvertToStringExplicit(object) + ")";
           return "gdjs.copyArray(" + copiedListName + ", " + objectListName +
@@ -1091,18 +1160,28 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
         //*Optimization*: Avoid expensive copy of the object list if we're using
         // the same list as the one from the parent context.
         if (context.IsSameObjectsList(object, *context.GetParentContext()))
-          return "/* Reuse " + objectListName + " */";
+          return GenerateComment("Reuse " + objectListName);
 
+        if (GetCodeGenerationReport())
+          GetCodeGenerationReport()->AddObjectListsCopied();
         gd::String copiedListName =
             GetObjectListName(object, *context.GetParentContext());
         return "gdjs.copyArray(" + copiedListName + ", " + objectListName +
                ");\n";
       };
 
+  if (GetCodeGenerationReport())
+    GetCodeGenerationReport()->AddObjectListsDeclared(
+        context.GetObjectsListsToBeDeclared().size() +
+        context.GetObjectsListsToBeEmptyIfJustDeclared().size() +
+        context.GetObjectsListsToBeDeclaredEmpty().size());
+
   gd::String declarationsCode;
   for (auto object : context.GetObjectsListsToBeDeclared()) {
     gd::String objectListDeclaration = "";
     if (!context.ObjectAlreadyDeclaredByParents(object)) {
+      if (GetCodeGenerationReport())
+        GetCodeGenerationReport()->AddObjectListsCopied();
       objectListDeclaration += "gdjs.copyArray(" +
                                GenerateAllInstancesGetterCode(object, context) +
                                ", " + GetObjectListName(object, context) + ");";
@@ -1156,8 +1235,15 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // stress on the JS engines, we generate a new function for each list of
   // events.
 
+  variableReferencesScopes.emplace_back();
   gd::String code =
       gd::EventsCodeGenerator::GenerateEventsListCode(events, context);
+  gd::String variableReferencesDeclarationsCode;
+  for (const auto& variableReference : variableReferencesScopes.back())
+    variableReferencesDeclarationsCode += "const " + variableReference.first +
+                                          " = " + variableReference.second +
+                                          ";\n";
+  variableReferencesScopes.pop_back();
 
   gd::String parametersCode = GenerateEventsParameters(context);
 
@@ -1172,7 +1258,9 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // are stored in static variables that are globally available by the whole
   // code.
   AddCustomCodeOutsideMain(functionName + " = function(" + parametersCode +
-                           ") {\n" + code + "\n" + "};");
+                           ") {\n" + variableReferencesDeclarationsCode);
+  AddCustomCodeOutsideMain(std::move(code));
+  AddCustomCodeOutsideMain("\n};");
 
   // Replace the code of the events by the call to the function. This does not
   // interfere with the objects picking as the lists are in static variables
@@ -1188,15 +1276,18 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
   outputCode +=
       GenerateBooleanInitializationToFalse("isConditionTrue", context);
 
+  std::vector<std::size_t> conditionsOrder =
+      GetConditionsEvaluationOrder(conditions);
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
     if (cId != 0) {
       outputCode += "if (" +
                     GenerateBooleanFullName("isConditionTrue", context) +
                     ") {\n";
     }
+    gd::Instruction& condition = conditions[conditionsOrder[cId]];
     gd::String conditionCode =
-        GenerateConditionCode(conditions[cId], "isConditionTrue", context);
-    if (!conditions[cId].GetType().empty()) {
+        GenerateConditionCode(condition, "isConditionTrue", context);
+    if (!condition.GetType().empty()) {
       outputCode +=
           GenerateBooleanFullName("isConditionTrue", context) + " = false;\n";
       outputCode += conditionCode;
@@ -1236,6 +1327,25 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(
     argOutput =
         "(typeof eventsFunctionContext !== 'undefined' ? eventsFunctionContext "
         ": undefined)";
+  }
+  // Timers with a constant name are accessed by their slot, resolved once
+  // when the code is loaded (see gdjs.Timer.getSlot).
+  else if (metadata.GetType() == "identifier" &&
+           (metadata.GetExtraInfo() == "sceneTimer" ||
+            metadata.GetExtraInfo() == "objectTimer") &&
+           dynamic_cast<gd::TextNode*>(parameter.GetRootNode())) {
+    const gd::String& timerName =
+        dynamic_cast<gd::TextNode*>(parameter.GetRootNode())->text;
+    auto it = timerSlotNames.find(timerName);
+    if (it == timerSlotNames.end()) {
+      gd::String timerSlotName =
+          GetCodeNamespaceAccessor() + "timerSlot" +
+          gd::String::From(timerSlotNames.size());
+      AddCustomCodeOutsideMain(timerSlotName + " = gdjs.Timer.getSlot(" +
+                               ConvertToStringExplicit(timerName) + ");\n");
+      it = timerSlotNames.emplace(timerName, timerSlotName).first;
+    }
+    argOutput = it->second;
   } else
     return gd::EventsCodeGenerator::GenerateParameterCodes(
         parameter,
@@ -1363,6 +1473,9 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
     bool hasChild) {
   gd::String output;
   const gd::VariablesContainer* variables = NULL;
+  // The prefix of the name of the local referencing the variable, if the
+  // variables container can't change during a call of the function.
+  gd::String referencePrefix;
   if (scope == ANY_VARIABLE || scope == VARIABLE_OR_PROPERTY ||
       scope == VARIABLE_OR_PROPERTY_OR_PARAMETER) {
     const auto variablesContainersList =
@@ -1382,9 +1495,11 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
     if (sourceType == gd::VariablesContainer::SourceType::Scene) {
       variables = &variablesContainer;
       output = "runtimeScene.getScene().getVariables()";
+      referencePrefix = "sceneVariable";
     } else if (sourceType == gd::VariablesContainer::SourceType::Global) {
       variables = &variablesContainer;
       output = "runtimeScene.getGame().getVariables()";
+      referencePrefix = "gameVariable";
     } else if (sourceType == gd::VariablesContainer::SourceType::Local) {
       variables = &variablesContainer;
       std::size_t localVariablesIndex =
@@ -1396,10 +1511,12 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
                gd::VariablesContainer::SourceType::ExtensionGlobal) {
       variables = &variablesContainer;
       output = "eventsFunctionContext.globalVariablesForExtension";
+      referencePrefix = "extensionGlobalVariable";
     } else if (sourceType ==
                gd::VariablesContainer::SourceType::ExtensionScene) {
       variables = &variablesContainer;
       output = "eventsFunctionContext.sceneVariablesForExtension";
+      referencePrefix = "extensionSceneVariable";
     } else if (sourceType ==
                gd::VariablesContainer::SourceType::Properties) {
       if (hasChild) {
@@ -1427,6 +1544,7 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
     }
   } else if (scope == LAYOUT_VARIABLE) {
     output = "runtimeScene.getScene().getVariables()";
+    referencePrefix = "sceneVariable";
 
     const auto *legacySceneVariables = GetProjectScopedContainers().GetLegacySceneVariables();
     if (HasProjectAndLayout()) {
@@ -1434,9 +1552,11 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
     } else if (legacySceneVariables && legacySceneVariables->Has(variableName)) {
       variables = legacySceneVariables;
       output = "eventsFunctionContext.sceneVariablesForExtension";
+      referencePrefix = "extensionSceneVariable";
     }
   } else if (scope == PROJECT_VARIABLE) {
     output = "runtimeScene.getGame().getVariables()";
+    referencePrefix = "gameVariable";
 
     const auto *legacyGlobalVariables = GetProjectScopedContainers().GetLegacyGlobalVariables();
     if (HasProjectAndLayout()) {
@@ -1444,6 +1564,7 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
     } else if (legacyGlobalVariables && legacyGlobalVariables->Has(variableName)) {
       variables = legacyGlobalVariables;
       output = "eventsFunctionContext.globalVariablesForExtension";
+      referencePrefix = "extensionGlobalVariable";
     }
   } else {
     std::vector<gd::String> realObjects =
@@ -1452,7 +1573,12 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
 
     output = "gdjs.VariablesContainer.badVariablesContainer";
     for (std::size_t i = 0; i < realObjects.size(); ++i) {
-      context.ObjectsListNeeded(realObjects[i]);
+      // The objects list of the object used by the instruction is only read
+      // (the instruction itself declares it if needed).
+      if (realObjects[i] == context.GetCurrentObject())
+        context.ObjectsListNeededForReading(realObjects[i]);
+      else
+        context.ObjectsListNeeded(realObjects[i]);
 
       // Generate the call to GetVariables() method.
       if (context.GetCurrentObject() == realObjects[i] &&
@@ -1485,6 +1611,9 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
     std::size_t index = variables->GetPosition(variableName);
     if (index < variables->Count()) {
       output += ".getFromIndex(" + gd::String::From(index) + ")";
+      if (!referencePrefix.empty())
+        return GenerateVariableReference(
+            referencePrefix + gd::String::From(index), output, context);
       return output;
     }
   }
@@ -1493,6 +1622,19 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
   return output;
 }
 
+gd::String EventsCodeGenerator::GenerateVariableReference(
+    const gd::String& referenceName,
+    const gd::String& variableCode,
+    gd::EventsCodeGenerationContext& context) {
+  // Callbacks of asynchronous actions are generated in their own functions,
+  // where the references are not declared.
+  if (variableReferencesScopes.empty() || context.IsInsideAsync())
+    return variableCode;
+
+  variableReferencesScopes.back()[referenceName] = variableCode;
+  return referenceName;
+}
+
 gd::String EventsCodeGenerator::GenerateUpperScopeBooleanFullName(
     const gd::String& boolName,
     const gd::EventsCodeGenerationContext& context) {
@@ -1518,7 +1660,19 @@ gd::String EventsCodeGenerator::GenerateBooleanFullName(
 
 gd::String EventsCodeGenerator::GenerateProfilerSectionBegin(
     const gd::String& section) {
-  if (GenerateCodeForRuntime()) return "";
+  if (GenerateCodeForRuntime()) {
+    if (!eventsProfiling) return "";
+
+    std::size_t sectionId = profilerSectionNames.size();
+    profilerSectionNames.push_back(section);
+    openedProfilerSections.push_back(sectionId);
+    if (GetCodeGenerationReport())
+      GetCodeGenerationReport()->SetProfilerSectionId(
+          static_cast<int>(sectionId));
+    return "if (" + GetEventsSectionsTimingsAccessor() + ".sampling) " +
+           GetEventsSectionsTimingsAccessor() + ".begin(" +
+           gd::String::From(sectionId) + ");\n";
+  }
 
   return "if (runtimeScene.getProfiler()) { runtimeScene.getProfiler().begin(" +
          ConvertToStringExplicit(section) + "); }";
@@ -1526,7 +1680,15 @@ gd::String EventsCodeGenerator::GenerateProfilerSectionBegin(
 
 gd::String EventsCodeGenerator::GenerateProfilerSectionEnd(
     const gd::String& section) {
-  if (GenerateCodeForRuntime()) return "";
+  if (GenerateCodeForRuntime()) {
+    if (!eventsProfiling || openedProfilerSections.empty()) return "";
+
+    std::size_t sectionId = openedProfilerSections.back();
+    openedProfilerSections.pop_back();
+    return "if (" + GetEventsSectionsTimingsAccessor() + ".sampling) " +
+           GetEventsSectionsTimingsAccessor() + ".end(" +
+           gd::String::From(sectionId) + ");\n";
+  }
 
   return "if (runtimeScene.getProfiler()) { runtimeScene.getProfiler().end(" +
          ConvertToStringExplicit(section) + "); }";
@@ -1624,7 +1786,7 @@ gd::String EventsCodeGenerator::GeneratePropertyGetter(
     }
   } else {
     gd::LogError("Unrecognized expression type for using a property: " + type);
-    return "0 /* Unrecognized type */";
+    return "0" + GenerateComment("Unrecognized type");
   }
 }
 
@@ -1670,17 +1832,19 @@ gd::String EventsCodeGenerator::GenerateParameterGetter(
     }
   } else {
     gd::LogError("Unrecognized expression type for using a parameter: " + type);
-    return "0 /* Unrecognized type */";
+    return "0" + GenerateComment("Unrecognized type");
   }
 }
 
 EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project,
                                          const gd::Layout& layout)
-    : gd::EventsCodeGenerator(project, layout, JsPlatform::Get()) {}
+    : gd::EventsCodeGenerator(project, layout, JsPlatform::Get()),
+      eventsProfiling(false) {}
 
 EventsCodeGenerator::EventsCodeGenerator(
     const gd::ProjectScopedContainers& projectScopedContainers)
-    : gd::EventsCodeGenerator(JsPlatform::Get(), projectScopedContainers) {}
+    : gd::EventsCodeGenerator(JsPlatform::Get(), projectScopedContainers),
+      eventsProfiling(false) {}
 
 EventsCodeGenerator::~EventsCodeGenerator() {}
 
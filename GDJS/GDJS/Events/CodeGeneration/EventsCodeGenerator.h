@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -45,15 +46,25 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code is generated for
    * runtime.
+   * \param compactCode Set this to true to generate the code without comments.
+   * \param eventsProfiling Set this to true to measure the time spent in the
+   * groups of events when the code is generated for runtime (see
+   * `gdjs.EventsSectionsTimings`).
+   * \param codeGenerationReport If not null, the size of the code generated
+   * for the scene and its groups of events is recorded in it.
    *
    * \return JavaScript code
    */
-  static gd::String GenerateLayoutCode(const gd::Project& project,
-                                       const gd::Layout& scene,
-                                       const gd::String& codeNamespace,
-                                       std::set<gd::String>& includeFiles,
-                                       gd::DiagnosticReport& diagnosticReport,
-                                       bool compilationForRuntime = false);
+  static gd::String GenerateLayoutCode(
+      const gd::Project& project,
+      const gd::Layout& scene,
+      const gd::String& codeNamespace,
+      std::set<gd::String>& includeFiles,
+      gd::DiagnosticReport& diagnosticReport,
+      bool compilationForRuntime = false,
+      bool compactCode = false,
+      bool eventsProfiling = false,
+      gd::CodeGenerationReport* codeGenerationReport = nullptr);
 
   /**
    * Generate JavaScript for executing events of an events based function.
@@ -65,6 +76,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code is generated for
    * runtime.
+   * \param codeGenerationReport If not null, the size of the code generated
+   * for the function and its groups of events is recorded in it.
    *
    * \return JavaScript code
    */
@@ -74,7 +87,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::EventsFunction& eventsFunction,
       const gd::String& codeNamespace,
       std::set<gd::String>& includeFiles,
-      bool compilationForRuntime = false);
+      bool compilationForRuntime = false,
+      gd::CodeGenerationReport* codeGenerationReport = nullptr);
 
   /**
    * Generate JavaScript for executing events of a events based behavior
@@ -91,6 +105,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code
    * is generated for runtime.
+   * \param codeGenerationReport If not null, the size of the code generated
+   * for the function and its groups of events is recorded in it.
    *
    * \return JavaScript code
    */
@@ -104,7 +120,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::String& onceTriggersVariable,
       const gd::String& preludeCode,
       std::set<gd::String>& includeFiles,
-      bool compilationForRuntime = false);
+      bool compilationForRuntime = false,
+      gd::CodeGenerationReport* codeGenerationReport = nullptr);
 
   /**
    * Generate JavaScript for executing events of a events based object
@@ -124,6 +141,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code
    * is generated for runtime.
+   * \param codeGenerationReport If not null, the size of the code generated
+   * for the function and its groups of events is recorded in it.
    *
    * \return JavaScript code
    */
@@ -138,7 +157,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::String& preludeCode,
       const gd::String& endingCode,
       std::set<gd::String>& includeFiles,
-      bool compilationForRuntime = false);
+      bool compilationForRuntime = false,
+      gd::CodeGenerationReport* codeGenerationReport = nullptr);
 
   /**
    * \brief Generate code for executing an event list
@@ -225,6 +245,19 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
     codeNamespace = codeNamespace_;
   };
 
+  /**
+   * \brief Set if the time spent in the groups of events must be measured
+   * in the code generated for runtime.
+   *
+   * Each group is given an id in a table of sections declared with the
+   * code, and is measured only for the frames sampled by
+   * `gdjs.EventsSectionsTimings`. This must only be used for the code of a
+   * scene, as the sampling is decided each time its events are run.
+   */
+  void SetGenerateEventsProfiling(bool eventsProfiling_) {
+    eventsProfiling = eventsProfiling_;
+  };
+
   virtual gd::String GeneratePropertySetterWithoutCasting(
       const gd::PropertiesContainer &propertiesContainer,
       const gd::NamedPropertyDescriptor &property,
@@ -311,6 +344,25 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::String& objectName,
       bool hasChild) override;
 
+  /**
+   * \brief Return the name of a local constant referencing the variable
+   * returned by \a variableCode, declared at the beginning of the function
+   * generated for the current list of events.
+   *
+   * This avoids to look for the variable in its container at each access
+   * (in particular in loops). This must only be used for the root variables
+   * of the scene, of the game, or of an extension: these containers keep the
+   * same `gdjs.Variable` for a given index (the values and children of the
+   * variables can change, but the variables themselves are only replaced when
+   * the scene is hot-reloaded, between two frames). Children are never
+   * referenced, as they can be replaced by events (for example when a
+   * structure is modified or converted).
+   */
+  gd::String GenerateVariableReference(
+      const gd::String& referenceName,
+      const gd::String& variableCode,
+      gd::EventsCodeGenerationContext& context);
+
   virtual gd::String GenerateVariableAccessor(gd::String childName) override {
     // This could be probably optimised by using `getChildNamed`.
     return ".getChild(" + ConvertToStringExplicit(childName) + ")";
@@ -365,6 +417,14 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   virtual gd::String GenerateProfilerSectionBegin(const gd::String& section) override;
   virtual gd::String GenerateProfilerSectionEnd(const gd::String& section) override;
 
+  /**
+   * \brief Get the full name of the `gdjs.EventsSectionsTimings` used by the
+   * code when events profiling is enabled.
+   */
+  gd::String GetEventsSectionsTimingsAccessor() {
+    return GetCodeNamespaceAccessor() + "eventsSectionsTimings";
+  };
+
   virtual gd::String GenerateRelationalOperation(
     const gd::String& relationalOperator,
     const gd::String& lhs,
@@ -390,13 +450,12 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   gd::String GenerateAllConditionsBooleanDeclarations();
 
   /**
-   * \brief Generate the declarations of all the objects list arrays.
+   * \brief Generate the declarations and the resets of the objects list arrays
+   * used by the generated code.
    *
-   * This should be called after generating events list code, with the maximum
-   * depth reached by events.
+   * This should be called after generating events list code.
    */
-  std::pair<gd::String, gd::String> GenerateAllObjectsDeclarationsAndResets(
-      unsigned int maxDepthLevelReached);
+  std::pair<gd::String, gd::String> GenerateAllObjectsDeclarationsAndResets();
 
   /**
    * \brief Generate the list of parameters of a function.
@@ -461,6 +520,23 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   gd::String codeNamespace;  ///< Optional namespace for the generated code,
                              ///< used when generating events function.
 
+  /// For each function generated for a list of events (innermost last), the
+  /// code of the variables referenced by locals, by name of the local.
+  std::vector<std::map<gd::String, gd::String>> variableReferencesScopes;
+
+  std::set<gd::String>
+      usedObjectListNames;  ///< The objects lists (mangled object name and
+                            ///< depth) used by the generated code.
+
+  /// The names of the declared timer slots, by timer name.
+  std::map<gd::String, gd::String> timerSlotNames;
+
+  bool eventsProfiling;  ///< True to measure the groups of events at runtime.
+  std::vector<gd::String>
+      profilerSectionNames;  ///< The names of the measured sections, by id.
+  std::vector<std::size_t>
+      openedProfilerSections;  ///< The ids of the sections being generated.
+
  private:
   /**
    * \brief Generate the "eventsFunctionContext" object that allow a function
@@ -5,10 +5,90 @@
  */
 #include "EventsFunctionsExtensionCodeGenerator.h"
 
+#include <cstdint>
+
 #include "EventsCodeGenerator.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/VersionWrapper.h"
+
+namespace {
+
+/**
+ * \brief Compute a 64 bits FNV-1a hash of serialized elements.
+ */
+class Hasher {
+ public:
+  Hasher() : hash(14695981039346656037ULL){};
+
+  void Add(const char* data, std::size_t size) {
+    for (std::size_t i = 0; i < size; i++) {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+
+  void Add(const gd::String& value) {
+    Add(value.c_str(), value.Raw().size() + 1);
+  }
+
+  void Add(const gd::SerializerElement& element) {
+    gd::Serializer::ToJSON(element, [this](const char* data, std::size_t size) {
+      Add(data, size);
+    });
+    Add("", 1);
+  }
+
+  gd::String GetKey() const {
+    static const char* hexDigits = "0123456789abcdef";
+    gd::String key;
+    for (int shift = 60; shift >= 0; shift -= 4)
+      key += hexDigits[(hash >> shift) & 0xf];
+    return key;
+  }
+
+ private:
+  std::uint64_t hash;
+};
+
+void RemoveEvents(gd::SerializerElement& element) {
+  element.RemoveChild("events");
+  for (const auto& child : element.GetAllChildren())
+    RemoveEvents(*child.second);
+}
+
+}  // namespace
 
 namespace gdjs {
+
+gd::String
+EventsFunctionsExtensionCodeGenerator::ComputeProjectExtensionsDeclarationsKey(
+    const gd::Project& project) {
+  Hasher hasher;
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       i++) {
+    gd::SerializerElement element;
+    project.GetEventsFunctionsExtension(i).SerializeTo(element);
+    RemoveEvents(element);
+    hasher.Add(element);
+  }
+  return hasher.GetKey();
+}
+
+gd::String EventsFunctionsExtensionCodeGenerator::ComputeExtensionCodeKey(
+    const gd::EventsFunctionsExtension& extension,
+    const gd::String& declarationsKey) {
+  Hasher hasher;
+  hasher.Add(gd::VersionWrapper::FullString());
+  hasher.Add(declarationsKey);
+  gd::SerializerElement element;
+  extension.SerializeTo(element);
+  hasher.Add(element);
+  return hasher.GetKey();
+}
+
 gd::String
 EventsFunctionsExtensionCodeGenerator::GenerateFreeEventsFunctionCompleteCode(
     const gd::EventsFunctionsExtension& extension,
@@ -32,7 +112,8 @@ if (typeof CODE_NAMESPACE !== "undefined") {
                                                       eventsFunction,
                                                       codeNamespace,
                                                       includeFiles,
-                                                      compilationForRuntime);
+                                                      compilationForRuntime,
+                                                      codeGenerationReport);
 
   gd::String lifecycleRegistrationCode = "";
   lifecycleRegistrationCode +=
@@ -10,6 +10,9 @@
 #include <string>
 #include <vector>
 #include "GDCore/Project/EventsFunctionsExtension.h"
+namespace gd {
+class CodeGenerationReport;
+}
 
 namespace gdjs {
 
@@ -23,7 +26,7 @@ namespace gdjs {
 class EventsFunctionsExtensionCodeGenerator {
  public:
   EventsFunctionsExtensionCodeGenerator(gd::Project& project_)
-      : project(project_){};
+      : project(project_), codeGenerationReport(nullptr){};
 
   /**
    * \brief Generate the complete code for the specified events function.
@@ -35,6 +38,38 @@ class EventsFunctionsExtensionCodeGenerator {
       std::set<gd::String>& includeFiles,
       bool compilationForRuntime);
 
+  /**
+   * \brief Set the report where the size of the code generated for the free
+   * events functions is recorded, or nullptr to not record it (the default).
+   */
+  void SetCodeGenerationReport(gd::CodeGenerationReport* codeGenerationReport_) {
+    codeGenerationReport = codeGenerationReport_;
+  }
+
+  /**
+   * \brief Compute a key identifying the declarations of all the events
+   * functions extensions of the project (their functions, behaviors and
+   * objects, without the events). The code generated for an extension
+   * depends on them, not on the events of the other extensions.
+   *
+   * \see ComputeExtensionCodeKey
+   */
+  static gd::String ComputeProjectExtensionsDeclarationsKey(
+      const gd::Project& project);
+
+  /**
+   * \brief Compute a key identifying everything used to generate the code of
+   * the functions, behaviors and objects of the extension, so that the code
+   * is only generated again when the key changes.
+   *
+   * \param extension The extension for which code will be generated.
+   * \param declarationsKey The key computed by
+   * ComputeProjectExtensionsDeclarationsKey for the project of the extension.
+   */
+  static gd::String ComputeExtensionCodeKey(
+      const gd::EventsFunctionsExtension& extension,
+      const gd::String& declarationsKey);
+
  private:
   /**
    * \brief Generate the code to register an events function which is an extension
@@ -45,6 +80,7 @@ class EventsFunctionsExtensionCodeGenerator {
       const gd::String& codeNamespace);
 
   gd::Project& project;
+  gd::CodeGenerationReport* codeGenerationReport;
 };
 
 }  // namespace gdjs
@@ -0,0 +1,320 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/Events/CodeGeneration/LayoutCodeGenerationCache.h"
+
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/DependenciesAnalyzer.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/LayersContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/VersionWrapper.h"
+
+namespace {
+
+/**
+ * \brief Compute a 64 bits FNV-1a hash of strings and serialized elements.
+ */
+class Hasher {
+ public:
+  Hasher() : hash(14695981039346656037ULL){};
+
+  void Add(const char *data, std::size_t size) {
+    for (std::size_t i = 0; i < size; i++) {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+
+  void Add(const gd::String &value) {
+    Add(value.c_str(), value.Raw().size());
+    AddSeparator();
+  }
+
+  void Add(std::uint64_t value) {
+    for (std::size_t i = 0; i < 8; i++) {
+      char byte = static_cast<char>(value >> (i * 8));
+      Add(&byte, 1);
+    }
+  }
+
+  void Add(const gd::SerializerElement &element) {
+    gd::Serializer::ToJSON(element, [this](const char *data, std::size_t size) {
+      Add(data, size);
+    });
+    AddSeparator();
+  }
+
+  void Add(const gd::EventsList &events) {
+    gd::SerializerElement element;
+    events.SerializeTo(element);
+    Add(element);
+  }
+
+  void Add(const gd::ObjectsContainer &objectsContainer) {
+    gd::SerializerElement objectsElement;
+    objectsContainer.SerializeObjectsTo(objectsElement);
+    Add(objectsElement);
+    gd::SerializerElement groupsElement;
+    objectsContainer.GetObjectGroups().SerializeTo(groupsElement);
+    Add(groupsElement);
+  }
+
+  void Add(const gd::VariablesContainer &variablesContainer) {
+    gd::SerializerElement element;
+    variablesContainer.SerializeTo(element);
+    Add(element);
+  }
+
+  /**
+   * \brief Add the metadata of an extension used to generate the code: the
+   * functions called for its instructions and expressions (including the ones
+   * of its objects and behaviors), their include files and parameters.
+   *
+   * Extensions have no version and their metadata can be declared again with
+   * the same name (see gd::Platform::GetExtensionToUpdate), so the name alone
+   * is not enough.
+   */
+  void Add(gd::PlatformExtension &extension) {
+    Add(extension.GetName());
+    AddFunctions(extension.GetAllActions());
+    AddFunctions(extension.GetAllConditions());
+    AddFunctions(extension.GetAllExpressions());
+    AddFunctions(extension.GetAllStrExpressions());
+    for (const auto &objectType : extension.GetExtensionObjectsTypes()) {
+      Add(objectType);
+      auto &objectMetadata = extension.GetObjectMetadata(objectType);
+      AddFunctions(objectMetadata.GetAllActions());
+      AddFunctions(objectMetadata.GetAllConditions());
+      AddFunctions(objectMetadata.GetAllExpressions());
+      AddFunctions(objectMetadata.GetAllStrExpressions());
+    }
+    for (const auto &behaviorType : extension.GetBehaviorsTypes()) {
+      Add(behaviorType);
+      auto &behaviorMetadata = extension.GetBehaviorMetadata(behaviorType);
+      AddFunctions(behaviorMetadata.GetAllActions());
+      AddFunctions(behaviorMetadata.GetAllConditions());
+      AddFunctions(behaviorMetadata.GetAllExpressions());
+      AddFunctions(behaviorMetadata.GetAllStrExpressions());
+    }
+  }
+
+  std::uint64_t GetHash() const {
+    // 0 is used for "not cacheable".
+    return hash == 0 ? 1 : hash;
+  }
+
+ private:
+  void AddSeparator() { Add("", 1); }
+
+  void AddFunctions(
+      std::map<gd::String, gd::InstructionMetadata> &instructionsMetadata) {
+    for (auto &it : instructionsMetadata) {
+      Add(it.first);
+      Add(it.second.GetFunctionName());
+      Add(it.second.GetAsyncFunctionName());
+      for (const auto &includeFile : it.second.GetIncludeFiles())
+        Add(includeFile);
+      AddParameters(it.second.GetParameters());
+    }
+  }
+
+  void AddFunctions(
+      std::map<gd::String, gd::ExpressionMetadata> &expressionsMetadata) {
+    for (auto &it : expressionsMetadata) {
+      Add(it.first);
+      Add(it.second.GetFunctionName());
+      for (const auto &includeFile : it.second.GetIncludeFiles())
+        Add(includeFile);
+      AddParameters(it.second.GetParameters());
+    }
+  }
+
+  void AddParameters(const gd::ParameterMetadataContainer &parameters) {
+    for (std::size_t i = 0; i < parameters.GetParametersCount(); i++) {
+      gd::SerializerElement element;
+      parameters.GetParameter(i).SerializeTo(element);
+      Add(element);
+    }
+    AddSeparator();
+  }
+
+  std::uint64_t hash;
+};
+
+}  // namespace
+
+namespace gdjs {
+
+std::uint64_t LayoutCodeGenerationCache::ComputeProjectHash(
+    const gd::Project &project,
+    const gd::Platform &platform,
+    bool compilationForRuntime,
+    bool compactCode,
+    bool eventsProfiling) {
+  Hasher hasher;
+  hasher.Add(gd::VersionWrapper::FullString());
+  hasher.Add(compilationForRuntime ? "runtime" : "preview");
+  hasher.Add(compactCode ? "compact" : "commented");
+  hasher.Add(eventsProfiling ? "profiled" : "not profiled");
+  for (const auto &extension : platform.GetAllPlatformExtensions())
+    hasher.Add(*extension);
+
+  // Scenes names are used by the events (to change of scene for example).
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); i++)
+    hasher.Add(project.GetLayout(i).GetName());
+  hasher.Add(project.GetObjects());
+  hasher.Add(project.GetVariables());
+
+  // Functions of extensions are called from the events, and their metadata
+  // are declared from them.
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       i++) {
+    gd::SerializerElement element;
+    project.GetEventsFunctionsExtension(i).SerializeTo(element);
+    hasher.Add(element);
+  }
+
+  return hasher.GetHash();
+}
+
+std::uint64_t LayoutCodeGenerationCache::ComputeLayoutHash(
+    const gd::Project &project,
+    const gd::Layout &layout,
+    std::uint64_t projectHash,
+    DependenciesAnalyzer::LinksCache *linksCache) {
+  DependenciesAnalyzer::LinksCache ownLinksCache;
+  DependenciesAnalyzer analyzer(
+      project, layout, linksCache ? *linksCache : ownLinksCache);
+  if (!analyzer.Analyze()) return 0;
+
+  Hasher hasher;
+  hasher.Add(projectHash);
+  hasher.Add(layout.GetName());
+  hasher.Add(layout.GetEvents());
+  hasher.Add(layout.GetObjects());
+  hasher.Add(layout.GetVariables());
+
+  // Linked events are generated in the code of the scene.
+  for (const auto &sceneName : analyzer.GetScenesDependencies()) {
+    hasher.Add(sceneName);
+    if (project.HasLayoutNamed(sceneName))
+      hasher.Add(project.GetLayout(sceneName).GetEvents());
+  }
+  for (const auto &externalEventsName :
+       analyzer.GetExternalEventsDependencies()) {
+    hasher.Add(externalEventsName);
+    if (project.HasExternalEventsNamed(externalEventsName))
+      hasher.Add(project.GetExternalEvents(externalEventsName).GetEvents());
+  }
+
+  return hasher.GetHash();
+}
+
+std::uint64_t LayoutCodeGenerationCache::ComputeLayoutResourcesHash(
+    const gd::Project &project,
+    const gd::Layout &layout,
+    std::uint64_t projectHash,
+    DependenciesAnalyzer::LinksCache *linksCache) {
+  std::uint64_t layoutHash =
+      ComputeLayoutHash(project, layout, projectHash, linksCache);
+  if (layoutHash == 0) return 0;
+
+  Hasher hasher;
+  hasher.Add(layoutHash);
+  gd::SerializerElement layersElement;
+  layout.GetLayers().SerializeLayersTo(layersElement);
+  hasher.Add(layersElement);
+
+  return hasher.GetHash();
+}
+
+const LayoutCodeGenerationCache::Entry *LayoutCodeGenerationCache::Get(
+    const gd::String &layoutName, std::uint64_t hash) const {
+  if (hash == 0) return nullptr;
+
+  auto it = entries.find(layoutName);
+  if (it == entries.end() || it->second.hash != hash) return nullptr;
+
+  return &it->second;
+}
+
+void LayoutCodeGenerationCache::Store(
+    const gd::String &layoutName,
+    std::uint64_t hash,
+    const gd::String &code,
+    const std::set<gd::String> &includeFiles,
+    const gd::DiagnosticReport &diagnosticReport) {
+  if (hash == 0) {
+    entries.erase(layoutName);
+    return;
+  }
+
+  Entry &entry = entries[layoutName];
+  entry.hash = hash;
+  entry.code = code;
+  entry.includeFiles = includeFiles;
+  entry.diagnostics.clear();
+  for (std::size_t i = 0; i < diagnosticReport.Count(); i++)
+    entry.diagnostics.push_back(diagnosticReport.Get(i));
+}
+
+const std::set<gd::String> *LayoutCodeGenerationCache::GetSceneResources(
+    const gd::String &layoutName, std::uint64_t hash) const {
+  if (hash == 0) return nullptr;
+
+  auto it = sceneResourcesEntries.find(layoutName);
+  if (it == sceneResourcesEntries.end() || it->second.hash != hash)
+    return nullptr;
+
+  return &it->second.resourceNames;
+}
+
+void LayoutCodeGenerationCache::StoreSceneResources(
+    const gd::String &layoutName,
+    std::uint64_t hash,
+    const std::set<gd::String> &resourceNames) {
+  if (hash == 0) {
+    sceneResourcesEntries.erase(layoutName);
+    return;
+  }
+
+  SceneResourcesEntry &entry = sceneResourcesEntries[layoutName];
+  entry.hash = hash;
+  entry.resourceNames = resourceNames;
+}
+
+bool LayoutCodeGenerationCache::IsCodeFileUpToDate(const gd::String &filename,
+                                                   std::uint64_t hash) const {
+  if (hash == 0) return false;
+
+  auto it = codeFilesHashes.find(filename);
+  return it != codeFilesHashes.end() && it->second == hash;
+}
+
+void LayoutCodeGenerationCache::StoreCodeFile(const gd::String &filename,
+                                              std::uint64_t hash) {
+  if (hash == 0) {
+    codeFilesHashes.erase(filename);
+    return;
+  }
+
+  codeFilesHashes[filename] = hash;
+}
+
+}  // namespace gdjs
@@ -0,0 +1,164 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/IDE/DependenciesAnalyzer.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class Layout;
+class Platform;
+class Project;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Keep the code generated for the events of scenes, and the resources
+ * used by scenes, so that they can be reused by the next exports (typically,
+ * previews) for the scenes that were not modified.
+ *
+ * A scene is identified by a hash of everything used to generate its code:
+ * its events and objects, the linked external events and scenes, the global
+ * objects and variables, the events functions extensions and the extensions
+ * of the platform.
+ *
+ * \see gdjs::ExporterHelper::ExportEventsCode
+ */
+class LayoutCodeGenerationCache {
+ public:
+  /**
+   * \brief The code generated for a scene.
+   */
+  struct Entry {
+    std::uint64_t hash;
+    gd::String code;
+    std::set<gd::String> includeFiles;
+    std::vector<gd::ProjectDiagnostic> diagnostics;
+  };
+
+  LayoutCodeGenerationCache(){};
+  virtual ~LayoutCodeGenerationCache(){};
+
+  /**
+   * \brief Compute the hash of what is shared by the code generation of all
+   * the scenes of the project.
+   */
+  static std::uint64_t ComputeProjectHash(const gd::Project &project,
+                                          const gd::Platform &platform,
+                                          bool compilationForRuntime,
+                                          bool compactCode = false,
+                                          bool eventsProfiling = false);
+
+  /**
+   * \brief Compute the hash of everything used to generate the code of the
+   * scene. \a projectHash must be the one computed by ComputeProjectHash.
+   *
+   * Give a \a linksCache when computing the hashes of several scenes of the
+   * project to only search once the links of each scene or external events.
+   *
+   * \return The hash, or 0 if the generated code must not be cached (in case
+   * of circular dependencies between the events).
+   */
+  static std::uint64_t ComputeLayoutHash(
+      const gd::Project &project,
+      const gd::Layout &layout,
+      std::uint64_t projectHash,
+      DependenciesAnalyzer::LinksCache *linksCache = nullptr);
+
+  /**
+   * \brief Compute the hash of everything used to find the resources used by
+   * the scene: what is used to generate its code, and its layers (the
+   * resources of their effects). \a projectHash must be the one computed by
+   * ComputeProjectHash.
+   *
+   * \return The hash, or 0 if the resources must not be cached.
+   */
+  static std::uint64_t ComputeLayoutResourcesHash(
+      const gd::Project &project,
+      const gd::Layout &layout,
+      std::uint64_t projectHash,
+      DependenciesAnalyzer::LinksCache *linksCache = nullptr);
+
+  /**
+   * \brief Return the code stored for the scene, or nullptr if there is none
+   * or if it was generated from different events (a different hash).
+   */
+  const Entry *Get(const gd::String &layoutName, std::uint64_t hash) const;
+
+  /**
+   * \brief Store the code generated for the scene, replacing the previous
+   * one.
+   */
+  void Store(const gd::String &layoutName,
+             std::uint64_t hash,
+             const gd::String &code,
+             const std::set<gd::String> &includeFiles,
+             const gd::DiagnosticReport &diagnosticReport);
+
+  /**
+   * \brief Return the resources stored for the scene, or nullptr if there are
+   * none or if they were found for a different scene (a different hash).
+   *
+   * \see ComputeLayoutResourcesHash
+   */
+  const std::set<gd::String> *GetSceneResources(const gd::String &layoutName,
+                                                std::uint64_t hash) const;
+
+  /**
+   * \brief Store the resources used by the scene, replacing the previous ones.
+   */
+  void StoreSceneResources(const gd::String &layoutName,
+                           std::uint64_t hash,
+                           const std::set<gd::String> &resourceNames);
+
+  /**
+   * \brief Return true if the code file was last written with the code of a
+   * scene having this hash, so that it does not need to be written again.
+   *
+   * \see StoreCodeFile
+   */
+  bool IsCodeFileUpToDate(const gd::String &filename,
+                          std::uint64_t hash) const;
+
+  /**
+   * \brief Remember that the code file was written with the code of a scene
+   * having this hash.
+   */
+  void StoreCodeFile(const gd::String &filename, std::uint64_t hash);
+
+  /**
+   * \brief Remove all the code, resources and code files stored.
+   */
+  void Clear() {
+    entries.clear();
+    sceneResourcesEntries.clear();
+    codeFilesHashes.clear();
+  };
+
+ private:
+  /**
+   * \brief The resources used by a scene.
+   */
+  struct SceneResourcesEntry {
+    std::uint64_t hash;
+    std::set<gd::String> resourceNames;
+  };
+
+  std::map<gd::String, Entry> entries;  ///< The code stored, by scene name.
+  std::map<gd::String, SceneResourcesEntry>
+      sceneResourcesEntries;  ///< The resources stored, by scene name.
+  std::map<gd::String, std::uint64_t>
+      codeFilesHashes;  ///< The hashes of the scenes written, by code file.
+};
+
+}  // namespace gdjs
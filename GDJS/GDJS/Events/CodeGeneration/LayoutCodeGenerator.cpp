@@ -18,7 +18,8 @@ gd::String LayoutCodeGenerator::GenerateLayoutCompleteCode(
   gd::String codeNamespace = "gdjs." + sceneMangledName + "Code";
 
   gd::String layoutCode = EventsCodeGenerator::GenerateLayoutCode(
-      project, layout, codeNamespace, includeFiles, diagnosticReport, compilationForRuntime);
+      project, layout, codeNamespace, includeFiles, diagnosticReport, compilationForRuntime,
+      compactCode, eventsProfiling, codeGenerationReport);
 
   // Export the symbols to avoid them being stripped by the Closure Compiler:
   gd::String exportCode =
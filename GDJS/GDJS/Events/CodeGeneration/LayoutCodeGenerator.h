@@ -11,6 +11,9 @@
 #include <vector>
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+namespace gd {
+class CodeGenerationReport;
+}
 
 namespace gdjs {
 
@@ -24,7 +27,10 @@ namespace gdjs {
 class LayoutCodeGenerator {
  public:
   LayoutCodeGenerator(const gd::Project& project_)
-      : project(project_){};
+      : project(project_),
+        compactCode(false),
+        eventsProfiling(false),
+        codeGenerationReport(nullptr){};
 
   /**
    * \brief Generate the complete code for the events of the specified scene.
@@ -35,8 +41,33 @@ class LayoutCodeGenerator {
       gd::DiagnosticReport& diagnosticReport,
       bool compilationForRuntime);
 
+  /**
+   * \brief Set if the code must be generated without the comments explaining
+   * it, to reduce the size of the exported code.
+   */
+  void SetGenerateCompactCode(bool compactCode_) { compactCode = compactCode_; }
+
+  /**
+   * \brief Set if the time spent in the groups of events must be measured by
+   * the code generated for runtime (see `gdjs.EventsSectionsTimings`).
+   */
+  void SetGenerateEventsProfiling(bool eventsProfiling_) {
+    eventsProfiling = eventsProfiling_;
+  }
+
+  /**
+   * \brief Set the report where the size of the generated code is recorded,
+   * or nullptr to not record it (the default).
+   */
+  void SetCodeGenerationReport(gd::CodeGenerationReport* codeGenerationReport_) {
+    codeGenerationReport = codeGenerationReport_;
+  }
+
  private:
   const gd::Project& project;
+  bool compactCode;
+  bool eventsProfiling;
+  gd::CodeGenerationReport* codeGenerationReport;
 };
 
 }  // namespace gdjs
@@ -5,6 +5,8 @@
  */
 #include "MetadataDeclarationHelper.h"
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/MultipleInstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -19,9 +21,9 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/PerfScope.h"
 #include "GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h"
 #include "GDJS/Events/CodeGeneration/ObjectCodeGenerator.h"
-#include <regex>
 
 namespace gdjs {
 
@@ -31,6 +33,8 @@ namespace gdjs {
 void MetadataDeclarationHelper::DeclareExtension(
     gd::PlatformExtension &extension,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension) {
+  gd::PerfScope perfScope("MetadataDeclarationHelper::DeclareExtension");
+  gd::PerfScope::IncrementCounter("extensionsDeclared");
   gd::String fullName = GetTranslation(eventsFunctionsExtension.GetFullName()) ||
                         eventsFunctionsExtension.GetName();
   extension
@@ -485,27 +489,29 @@ gd::String MetadataDeclarationHelper::GetDefaultSentence(
 };
 
 gd::String MetadataDeclarationHelper::GetFreeFunctionSentence(const gd::EventsFunction &eventsFunction) {
-  return GetTranslation(eventsFunction.GetSentence()).empty()
-             ? GetDefaultSentence(eventsFunction, 0, 1)
-             : GetTranslation(eventsFunction.GetSentence());
+  gd::String sentence = GetTranslation(eventsFunction.GetSentence());
+  return sentence.empty() ? GetDefaultSentence(eventsFunction, 0, 1)
+                          : sentence;
 };
 
 gd::String MetadataDeclarationHelper::GetBehaviorFunctionSentence(
     const gd::EventsFunction &eventsFunction,
     const bool excludeObjectParameter) {
-  return GetTranslation(eventsFunction.GetSentence()).empty()
+  gd::String sentence = GetTranslation(eventsFunction.GetSentence());
+  return sentence.empty()
              ? GetDefaultSentence(eventsFunction,
                                   excludeObjectParameter ? 2 : 0, 0)
-             : GetTranslation(eventsFunction.GetSentence());
+             : sentence;
 };
 
 gd::String MetadataDeclarationHelper::GetObjectFunctionSentence(
     const gd::EventsFunction &eventsFunction,
     const bool excludeObjectParameter) {
-  return GetTranslation(eventsFunction.GetSentence()).empty()
+  gd::String sentence = GetTranslation(eventsFunction.GetSentence());
+  return sentence.empty()
              ? GetDefaultSentence(eventsFunction,
                                   excludeObjectParameter ? 1 : 0, 0)
-             : GetTranslation(eventsFunction.GetSentence());
+             : sentence;
 };
 
 /**
@@ -639,29 +645,143 @@ gd::InstructionMetadata &MetadataDeclarationHelper::DeclareInstructionMetadata(
 
 gd::String MetadataDeclarationHelper::ShiftSentenceParamIndexes(
     const gd::String &sentence_, const int offset) {
+  // This is called for each declared function: scan the sentence instead of
+  // compiling a regex, and only build a new string if there is a parameter.
   const std::string &sentence = sentence_.Raw();
-  const std::regex paramRegex("_PARAM(\\d+)_");
-
-  auto words_begin =
-      std::sregex_iterator(sentence.begin(), sentence.end(), paramRegex);
-  auto words_end = std::sregex_iterator();
+  static const std::string paramPrefix = "_PARAM";
+
+  std::string shiftedSentence;
+  std::size_t copiedUntil = 0;
+  std::size_t searchFrom = 0;
+  while (true) {
+    std::size_t prefixPosition = sentence.find(paramPrefix, searchFrom);
+    if (prefixPosition == std::string::npos) break;
+
+    std::size_t indexStart = prefixPosition + paramPrefix.size();
+    std::size_t indexEnd = indexStart;
+    while (indexEnd < sentence.size() && sentence[indexEnd] >= '0' &&
+           sentence[indexEnd] <= '9')
+      indexEnd++;
+    if (indexEnd == indexStart || indexEnd == sentence.size() ||
+        sentence[indexEnd] != '_') {
+      searchFrom = indexStart;
+      continue;
+    }
 
-  if (words_begin == words_end) {
-    return sentence_;
+    if (shiftedSentence.empty()) shiftedSentence.reserve(sentence.size() + 8);
+    int parameterIndex =
+        std::stoi(sentence.substr(indexStart, indexEnd - indexStart));
+    shiftedSentence.append(sentence, copiedUntil, indexStart - copiedUntil);
+    shiftedSentence += std::to_string(parameterIndex + offset);
+    shiftedSentence += '_';
+    copiedUntil = indexEnd + 1;
+    searchFrom = copiedUntil;
   }
-  gd::String shiftedSentence = "";
-  std::smatch paramMatch;
-  for (std::sregex_iterator i = words_begin; i != words_end; ++i) {
-    paramMatch = *i;
-
-    shiftedSentence += gd::String::FromUTF8(paramMatch.prefix().str());
-    int parameterIndex = std::stoi(paramMatch[1]);
-    shiftedSentence +=
-        "_PARAM" + gd::String::From(parameterIndex + offset) + "_";
+  if (copiedUntil == 0) return sentence_;
+
+  shiftedSentence.append(sentence, copiedUntil, std::string::npos);
+  return gd::String::FromUTF8(shiftedSentence);
+}
+
+gd::String MetadataDeclarationHelper::GetEquivalentPropertyAccessorName(
+    const gd::String &behaviorType,
+    const gd::EventsBasedBehavior &eventsBasedBehavior,
+    const gd::EventsFunction &eventsFunction) {
+  if (eventsFunction.IsAsync() ||
+      IsBehaviorLifecycleEventsFunction(eventsFunction.GetName()))
+    return "";
+
+  auto functionType = eventsFunction.GetFunctionType();
+  bool isGetter = functionType == gd::EventsFunction::Expression ||
+                  functionType == gd::EventsFunction::ExpressionAndCondition;
+  bool isSetter = functionType == gd::EventsFunction::Action;
+  auto &parameters = eventsFunction.GetParameters();
+  // The object and the behavior are always the first parameters, and a
+  // setter has the new value as only other parameter.
+  if (!(isGetter && parameters.GetParametersCount() == 2) &&
+      !(isSetter && parameters.GetParametersCount() == 3))
+    return "";
+
+  // The function must be made of a single event with a single action.
+  auto &events = eventsFunction.GetEvents();
+  if (events.GetEventsCount() != 1) return "";
+  auto standardEvent =
+      dynamic_cast<const gd::StandardEvent *>(&events.GetEvent(0));
+  if (!standardEvent || standardEvent->IsDisabled() ||
+      !standardEvent->GetConditions().IsEmpty() ||
+      standardEvent->GetActions().GetCount() != 1 ||
+      !standardEvent->GetSubEvents().IsEmpty())
+    return "";
+  auto &action = standardEvent->GetActions().Get(0);
+  if (action.IsInverted() || action.IsAwaited()) return "";
+
+  const gd::String &objectName = parameters.GetParameter(0).GetName();
+  const gd::String &behaviorName = parameters.GetParameter(1).GetName();
+  auto &properties = eventsBasedBehavior.GetPropertyDescriptors();
+  auto getPropertyValueType =
+      [&properties](const gd::String &propertyName) -> gd::String {
+    if (!properties.Has(propertyName)) return "";
+    auto &propertyType = properties.Get(propertyName).GetType();
+    // Other properties can have their values converted by their setters.
+    if (propertyType != "Number" && propertyType != "String") return "";
+    return gd::ValueTypeMetadata::GetPrimitiveValueType(
+        gd::ValueTypeMetadata::ConvertPropertyTypeToValueType(propertyType));
+  };
+
+  if (isGetter) {
+    const gd::String &returnType =
+        gd::ValueTypeMetadata::GetPrimitiveValueType(
+            eventsFunction.GetExpressionType().GetName());
+    if (action.GetType() !=
+            (returnType == "number" ? "SetReturnNumber" : "SetReturnString") ||
+        action.GetParametersCount() < 1)
+      return "";
+
+    // The returned value must be `Object.Behavior::PropertyXxx()`.
+    auto functionCall = dynamic_cast<gd::FunctionCallNode *>(
+        action.GetParameter(0).GetRootNode());
+    if (!functionCall || functionCall->objectName != objectName ||
+        functionCall->behaviorName != behaviorName ||
+        !functionCall->parameters.empty() ||
+        functionCall->functionName.find("Property") != 0)
+      return "";
+
+    gd::String propertyName = functionCall->functionName.substr(
+        gd::String("Property").size());
+    if (getPropertyValueType(propertyName) != returnType) return "";
+
+    return gdjs::BehaviorCodeGenerator::GetBehaviorPropertyGetterName(
+        propertyName);
   }
-  shiftedSentence += gd::String::FromUTF8(paramMatch.suffix().str());
 
-  return shiftedSentence;
+  // The action must be `SetPropertyXxx` of the behavior, with the `=`
+  // operator and the value parameter.
+  const gd::String actionPrefix = behaviorType +
+                                  gd::PlatformExtension::GetNamespaceSeparator() +
+                                  "SetProperty";
+  if (action.GetType().find(actionPrefix) != 0 ||
+      action.GetParametersCount() != 4 ||
+      action.GetParameter(0).GetPlainString() != objectName ||
+      action.GetParameter(1).GetPlainString() != behaviorName ||
+      action.GetParameter(2).GetPlainString() != "=")
+    return "";
+
+  gd::String propertyName = action.GetType().substr(actionPrefix.size());
+  auto &valueParameter = parameters.GetParameter(2);
+  const gd::String &valueType =
+      gd::ValueTypeMetadata::GetPrimitiveValueType(valueParameter.GetType());
+  if (getPropertyValueType(propertyName) != valueType ||
+      properties.Has(valueParameter.GetName()))
+    return "";
+
+  auto identifier = dynamic_cast<gd::IdentifierNode *>(
+      action.GetParameter(3).GetRootNode());
+  if (!identifier || identifier->identifierName != valueParameter.GetName() ||
+      !identifier->childIdentifierName.empty())
+    return "";
+
+  return gdjs::BehaviorCodeGenerator::GetBehaviorPropertySetterName(
+      propertyName);
 }
 
 /**
@@ -679,11 +799,19 @@ MetadataDeclarationHelper::DeclareBehaviorInstructionOrExpressionMetadata(
   objectMethodMangledNames[eventsFunction.GetName()] =
       eventsFunctionMangledName;
 
+  // The events function is still generated (it can be called from
+  // JavaScript), but the events call the property accessor directly.
+  auto propertyAccessorName = GetEquivalentPropertyAccessorName(
+      behaviorMetadata.GetName(), eventsBasedBehavior, eventsFunction);
+  const gd::String &calledFunctionName = propertyAccessorName.empty()
+                                             ? eventsFunctionMangledName
+                                             : propertyAccessorName;
+
   if (eventsFunction.IsExpression()) {
     auto &expression = DeclareBehaviorExpressionMetadata(
         extension, behaviorMetadata, eventsBasedBehavior, eventsFunction);
 
-    expression.SetFunctionName(eventsFunctionMangledName);
+    expression.SetFunctionName(calledFunctionName);
 
     return expression;
   } else {
@@ -693,7 +821,7 @@ MetadataDeclarationHelper::DeclareBehaviorInstructionOrExpressionMetadata(
     if (eventsFunction.IsAsync()) {
       instruction.SetAsyncFunctionName(eventsFunctionMangledName);
     } else {
-      instruction.SetFunctionName(eventsFunctionMangledName);
+      instruction.SetFunctionName(calledFunctionName);
     }
 
     return instruction;
@@ -1104,16 +1232,13 @@ void MetadataDeclarationHelper::DeclarePropertyInstructionAndExpression(
     auto parameterOptions = gd::ParameterOptions::MakeNewOptions();
     if (!typeExtraInfo.empty())
       parameterOptions.SetTypeExtraInfo(typeExtraInfo);
+    auto description = _("the property value for <property_name>")
+                           .FindAndReplace("<property_name>", property.GetName());
     auto propertyInstructionMetadata =
         entityMetadata.AddExpressionAndConditionAndAction(
             gd::ValueTypeMetadata::GetPrimitiveValueType(
               gd::ValueTypeMetadata::ConvertPropertyTypeToValueType(propertyType)),
-            expressionName, propertyLabel,
-            _("the property value for <property_name>")
-                .FindAndReplace("<property_name>", property.GetName()),
-            _("the property value for <property_name>")
-                .FindAndReplace("<property_name>", property.GetName()),
-            group,
+            expressionName, propertyLabel, description, description, group,
             GetExtensionIconUrl(extension));
     addObjectAndBehaviorParameters(propertyInstructionMetadata);
     propertyInstructionMetadata
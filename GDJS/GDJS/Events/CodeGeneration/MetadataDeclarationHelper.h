@@ -119,6 +119,21 @@ public:
   static bool
   IsExtensionLifecycleEventsFunction(const gd::String &functionName);
 
+  /**
+   * \brief Return the name of the method of the behavior that does exactly
+   * what the given behavior function does, or an empty string if there is
+   * none.
+   *
+   * This is the case for functions only made of an action returning a
+   * property or setting a property to a parameter. The call to such
+   * functions is replaced by a call to the property getter or setter, which
+   * avoids to create a context for the function at each call.
+   */
+  static gd::String GetEquivalentPropertyAccessorName(
+      const gd::String &behaviorType,
+      const gd::EventsBasedBehavior &eventsBasedBehavior,
+      const gd::EventsFunction &eventsFunction);
+
   static gd::String ShiftSentenceParamIndexes(const gd::String &sentence,
                                               const int offset);
 
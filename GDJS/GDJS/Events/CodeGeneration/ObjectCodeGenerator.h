@@ -15,6 +15,7 @@
 namespace gd {
 class NamedPropertyDescriptor;
 class EventsBasedObject;
+class CodeGenerationReport;
 }
 
 namespace gdjs {
@@ -27,7 +28,8 @@ namespace gdjs {
  */
 class ObjectCodeGenerator {
  public:
-  ObjectCodeGenerator(gd::Project& project_) : project(project_){};
+  ObjectCodeGenerator(gd::Project& project_)
+      : project(project_), codeGenerationReport(nullptr){};
 
   /**
    * \brief Generate the complete JS class (`gdjs.CustomRuntimeObject`) for the
@@ -41,6 +43,15 @@ class ObjectCodeGenerator {
       std::set<gd::String>& includeFiles,
       bool compilationForRuntime = false);
 
+  /**
+   * \brief Set the report where the size of the code generated for the
+   * functions of the object is recorded, or nullptr to not record it (the
+   * default).
+   */
+  void SetCodeGenerationReport(gd::CodeGenerationReport* codeGenerationReport_) {
+    codeGenerationReport = codeGenerationReport_;
+  }
+
   /**
    * \brief Generate the name of the method to get the value of the property
    * of a object.
@@ -113,6 +124,7 @@ class ObjectCodeGenerator {
       const gd::EventsBasedObject& eventsBasedObject);
 
   gd::Project& project;
+  gd::CodeGenerationReport* codeGenerationReport;
 
   static gd::String onCreatedFunctionName;
   static gd::String doStepPreEventsFunctionName;
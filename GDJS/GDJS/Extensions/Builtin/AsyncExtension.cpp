@@ -29,9 +29,13 @@ AsyncExtension::AsyncExtension() {
             event.GetActions(),
             event.HasSubEvents() ? &event.GetSubEvents() : nullptr);
 
+        // The callback and its arguments are given to the tasks manager,
+        // rather than a closure calling it, so that awaiting doesn't allocate
+        // a function each time.
         const gd::String callbackCallCode =
-            "(runtimeScene) => (" + callbackDescriptor.functionName + "(" +
-            callbackDescriptor.argumentsList + "))";
+            callbackDescriptor.functionName + ", asyncObjectsList" +
+            (codeGenerator.HasProjectAndLayout() ? ""
+                                                 : ", eventsFunctionContext");
 
         // Generate the action and store the generated task.
         const gd::String asyncActionCode = codeGenerator.GenerateActionCode(
@@ -58,8 +62,10 @@ AsyncExtension::AsyncExtension() {
              callbackDescriptor.requiredObjects) {
           if (parentContext.ShouldUseAsyncObjectsList(objectNameToBackup))
             asyncContextBuilder +=
-                "/* Don't save " + objectNameToBackup +
-                " as it will be provided by the parent asyncObjectsList. */\n";
+                codeGenerator.GenerateComment(
+                    "Don't save " + objectNameToBackup +
+                    " as it will be provided by the parent asyncObjectsList.") +
+                "\n";
           else
             asyncContextBuilder +=
                 "for (const obj of " +
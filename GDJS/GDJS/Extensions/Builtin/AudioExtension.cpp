@@ -46,6 +46,10 @@ AudioExtension::AudioExtension() {
       "gdjs.evtTools.sound.unloadSound");
   GetAllActions()["UnloadAllAudio"].SetFunctionName(
       "gdjs.evtTools.sound.unloadAllAudio");
+  GetAllActions()["SetMaxSoundVoices"].SetFunctionName(
+      "gdjs.evtTools.sound.setMaxSoundVoices");
+  GetAllActions()["SetSoundDeduplicationDelay"].SetFunctionName(
+      "gdjs.evtTools.sound.setSoundDeduplicationDelay");
   GetAllActions()["FadeSoundVolume"].SetFunctionName(
       "gdjs.evtTools.sound.fadeSoundVolume");
       
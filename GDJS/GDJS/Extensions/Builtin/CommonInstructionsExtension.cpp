@@ -17,6 +17,7 @@
 #include "GDCore/Events/Builtin/RepeatEvent.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Builtin/WhileEvent.h"
+#include "GDCore/Events/CodeGeneration/CodeGenerationReport.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
@@ -109,8 +110,9 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
       .SetCodeGenerator([](gd::BaseEvent &event_,
                            gd::EventsCodeGenerator &codeGenerator,
                            gd::EventsCodeGenerationContext &context) {
-        return "/*Link should not have any generated code. You probably "
-               "wrongly used a link in events without a layout.*/";
+        return codeGenerator.GenerateComment(
+            "Link should not have any generated code. You probably wrongly "
+            "used a link in events without a layout.");
       })
       .SetPreprocessing([](gd::BaseEvent &event_,
                            gd::EventsCodeGenerator &codeGenerator,
@@ -149,10 +151,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
             event.GetActions(), actionsContext);
         if (event.HasSubEvents()) // Sub events
         {
-          actionsCode += "\n{ //Subevents\n";
+          actionsCode += "\n{" + codeGenerator.GenerateComment("Subevents") + "\n";
           actionsCode += codeGenerator.GenerateEventsListCode(
               event.GetSubEvents(), actionsContext);
-          actionsCode += "} //End of subevents\n";
+          actionsCode +=
+              "}" + codeGenerator.GenerateComment("End of subevents") + "\n";
         }
         gd::String actionsDeclarationsCode =
             codeGenerator.GenerateObjectsDeclarationCode(actionsContext);
@@ -366,8 +369,10 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         // get the game stuck in a never ending loop.
         if (event.GetWhileConditions().empty() &&
             event.GetConditions().empty() && event.GetActions().empty())
-          return gd::String(
-              "\n// While event not generated to prevent an infinite loop.\n");
+          return "\n" +
+                 codeGenerator.GenerateComment(
+                     "While event not generated to prevent an infinite loop.") +
+                 "\n";
 
         gd::String outputCode;
 
@@ -406,12 +411,13 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         outputCode += conditionsCode;
         outputCode += "if (" + ifPredicate + ") {\n";
         outputCode += actionsCode;
-        outputCode += "\n{ //Subevents: \n";
+        outputCode += "\n{" + codeGenerator.GenerateComment("Subevents") + "\n";
         // TODO: check (and heavily test) if sub events should be generated
         // before the call to GenerateObjectsDeclarationCode.
         outputCode +=
             codeGenerator.GenerateEventsListCode(event.GetSubEvents(), context);
-        outputCode += "} //Subevents end.\n";
+        outputCode +=
+            "}" + codeGenerator.GenerateComment("Subevents end.") + "\n";
         outputCode += "}\n";
         outputCode += "} else " + whileBoolean + " = true; \n";
 
@@ -503,10 +509,10 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
             "    if($STRUCTURE_CHILD_VARIABLE.isPrimitive()) {\n"
             "        $VALUE_ITERATOR_REFERENCE.setValue($STRUCTURE_CHILD_VARIABLE.getValue());\n"
             "    } else if ($STRUCTURE_CHILD_VARIABLE.getType() === \"structure\") {\n"
-            "        // Structures are passed by reference like JS objects\n"
+            "        " + codeGenerator.GenerateComment("Structures are passed by reference like JS objects") + "\n"
             "        $VALUE_ITERATOR_REFERENCE.replaceChildren($STRUCTURE_CHILD_VARIABLE.getAllChildren());\n"
             "    } else if ($STRUCTURE_CHILD_VARIABLE.getType() === \"array\") {\n"
-            "        // Arrays are passed by reference like JS objects\n"
+            "        " + codeGenerator.GenerateComment("Arrays are passed by reference like JS objects") + "\n"
             "        $VALUE_ITERATOR_REFERENCE.replaceChildrenArray($STRUCTURE_CHILD_VARIABLE.getAllChildrenArray());\n"
             "    } else console.warn(\"Cannot identify type: \", type);\n";
         // clang-format on
@@ -518,9 +524,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         outputCode += "{\n";
         outputCode += actionsCode;
         if (event.HasSubEvents()) {
-          outputCode += "\n{ //Subevents: \n";
+          outputCode +=
+              "\n{" + codeGenerator.GenerateComment("Subevents") + "\n";
           outputCode += subevents;
-          outputCode += "} //Subevents end.\n";
+          outputCode +=
+              "}" + codeGenerator.GenerateComment("Subevents end.") + "\n";
         }
         outputCode += "}\n";
         // End of standard event code generation
@@ -620,9 +628,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         outputCode += "{\n";
         outputCode += actionsCode;
         if (event.HasSubEvents()) {
-          outputCode += "\n{ //Subevents: \n";
+          outputCode +=
+              "\n{" + codeGenerator.GenerateComment("Subevents") + "\n";
           outputCode += subevents;
-          outputCode += "} //Subevents end.\n";
+          outputCode +=
+              "}" + codeGenerator.GenerateComment("Subevents end.") + "\n";
         }
         outputCode += "}\n";
 
@@ -712,17 +722,33 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
           }
         }
 
+        // The iterated list is the one of the parent context: the events
+        // of the loop only modify the lists of their own context, so the list
+        // and its length are read once, before the loop (like the counts of
+        // the lists when several lists are iterated).
+        gd::String iteratedObjectsVar =
+            "forEachIteratedObjects" +
+            gd::String::From(context.GetContextDepth());
+        gd::String iteratedObjectsCountVar =
+            "forEachIteratedObjectsCount" +
+            gd::String::From(context.GetContextDepth());
+
         // Write final code :
 
         // For loop declaration
         if (realObjects.size() ==
-            1) // We write a slightly more simple ( and optimized ) output code
+            1) { // We write a slightly more simple ( and optimized ) output code
                // when only one object list is used.
           outputCode +=
-              "for (" + forEachIndexVar + " = 0;" + forEachIndexVar + " < " +
+              "const " + iteratedObjectsVar + " = " +
               codeGenerator.GetObjectListName(realObjects[0], parentContext) +
-              ".length;++" + forEachIndexVar + ") {\n";
-        else
+              ";\n";
+          outputCode += "const " + iteratedObjectsCountVar + " = " +
+                        iteratedObjectsVar + ".length;\n";
+          outputCode += "for (" + forEachIndexVar + " = 0;" + forEachIndexVar +
+                        " < " + iteratedObjectsCountVar + ";++" +
+                        forEachIndexVar + ") {\n";
+        } else
           outputCode += "for (" + forEachIndexVar + " = 0;" + forEachIndexVar +
                         " < " + forEachTotalCountVar + ";++" + forEachIndexVar +
                         ") {\n";
@@ -738,10 +764,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                                  "forEachTemporary" +
                                  gd::String::From(context.GetContextDepth());
           codeGenerator.AddGlobalDeclaration(temporary + " = null;\n");
-          outputCode +=
-              temporary + " = " +
-              codeGenerator.GetObjectListName(realObjects[0], parentContext) +
-              "[" + forEachIndexVar + "];\n";
+          outputCode += temporary + " = " + iteratedObjectsVar + "[" +
+                        forEachIndexVar + "];\n";
 
           outputCode +=
               codeGenerator.GetObjectListName(realObjects[0], context) +
@@ -776,9 +800,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         outputCode += "if (" + ifPredicate + ") {\n";
         outputCode += actionsCode;
         if (event.HasSubEvents()) {
-          outputCode += "\n{ //Subevents: \n";
+          outputCode +=
+              "\n{" + codeGenerator.GenerateComment("Subevents") + "\n";
           outputCode += subevents;
-          outputCode += "} //Subevents end.\n";
+          outputCode +=
+              "}" + codeGenerator.GenerateComment("Subevents end.") + "\n";
         }
         outputCode += "}\n";
 
@@ -793,12 +819,27 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         gd::String outputCode;
         gd::GroupEvent &event = dynamic_cast<gd::GroupEvent &>(event_);
 
+        // The events of the group can be generated as functions outside of
+        // the main function: count them in the size of the group.
+        gd::CodeGenerationReport *report =
+            codeGenerator.GetCodeGenerationReport();
+        std::size_t codeOutsideMainSize =
+            codeGenerator.GetCustomCodeOutsideMain().GetSize();
+        if (report)
+          report->BeginEntry(gd::CodeGenerationReport::EventsGroup,
+                             event.GetName());
+
         outputCode +=
             codeGenerator.GenerateProfilerSectionBegin(event.GetName());
         outputCode +=
             codeGenerator.GenerateEventsListCode(event.GetSubEvents(), context);
         outputCode += codeGenerator.GenerateProfilerSectionEnd(event.GetName());
 
+        if (report)
+          report->EndEntry(outputCode.Raw().size() +
+                           codeGenerator.GetCustomCodeOutsideMain().GetSize() -
+                           codeOutsideMainSize);
+
         return outputCode;
       });
 
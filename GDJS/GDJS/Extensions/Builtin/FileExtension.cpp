@@ -37,6 +37,8 @@ FileExtension::FileExtension() {
       "gdjs.evtTools.storage.deleteElementFromJSONFile");
   GetAllActions()["DeleteFichier"]
       .SetFunctionName("gdjs.evtTools.storage.clearJSONFile");
+  GetAllActions()["SetWriteBehindEnabled"].SetFunctionName(
+      "gdjs.evtTools.storage.setWriteBehindEnabled");
 
   StripUnimplementedInstructionsAndExpressions();  // Unimplemented things are
                                                    // listed here:
@@ -43,6 +43,10 @@ SceneExtension::SceneExtension() {
       "gdjs.evtTools.runtimeScene.prioritizeLoadingOfScene");
   GetAllConditions()["AreSceneAssetsLoaded"].SetFunctionName(
       "gdjs.evtTools.runtimeScene.areSceneAssetsLoaded");
+  GetAllActions()["PreInstantiateScene"].SetFunctionName(
+      "gdjs.evtTools.runtimeScene.preInstantiateScene");
+  GetAllConditions()["IsScenePreInstantiated"].SetFunctionName(
+      "gdjs.evtTools.runtimeScene.isScenePreInstantiated");
   GetAllConditions()["SceneLoadingProgress"].SetFunctionName(
       "gdjs.evtTools.runtimeScene.getSceneLoadingProgress");
   GetAllExpressions()["SceneLoadingProgress"].SetFunctionName(
@@ -10,6 +10,7 @@
 #include "GDCore/IDE/ExtensionsLoader.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MemoryTracker.h"
 
 // Built-in extensions
 #include "GDJS/Extensions/Builtin/AdvancedExtension.h"
@@ -67,136 +68,146 @@ gd::PlatformExtension *CreateGDJSParticleSystemExtension();
 }
 #endif
 
+namespace {
+template <class T>
+std::shared_ptr<gd::PlatformExtension> CreateExtension() {
+  return std::shared_ptr<gd::PlatformExtension>(new T);
+}
+}  // namespace
+
 void JsPlatform::ReloadBuiltinExtensions() {
-  // Adding built-in extensions.
+  // Adding built-in extensions. The base object and the common instructions
+  // (declaring the standard events) are always needed: other extensions are
+  // only created when they are needed (see gd::Platform::AddLazyExtension).
+  gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Metadata);
   std::cout << "* Loading builtin extensions... ";
   std::cout.flush();
   AddExtension(std::shared_ptr<gd::PlatformExtension>(new BaseObjectExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SpriteExtension));
-  std::cout.flush();
+  AddLazyExtension("Sprite", {"Sprite"}, CreateExtension<SpriteExtension>);
   AddExtension(
       std::shared_ptr<gd::PlatformExtension>(new CommonInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AsyncExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonConversionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new VariablesExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new MouseExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new KeyboardExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SceneExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new TimeExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new MathematicalToolsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new CameraExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AudioExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new FileExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new NetworkExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new WindowExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new StringInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AdvancedExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ExternalLayoutsExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new AnimatableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new EffectExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new FlippableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ResizableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ScalableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new OpacityExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new TextContainerExtension));
-  std::cout.flush();
+  AddLazyExtension("BuiltinAsync", {}, CreateExtension<AsyncExtension>);
+  AddLazyExtension("BuiltinCommonConversions",
+                   {},
+                   CreateExtension<CommonConversionsExtension>);
+  AddLazyExtension("BuiltinVariables", {}, CreateExtension<VariablesExtension>);
+  AddLazyExtension("BuiltinMouse", {}, CreateExtension<MouseExtension>);
+  AddLazyExtension("BuiltinKeyboard", {}, CreateExtension<KeyboardExtension>);
+  AddLazyExtension("BuiltinScene", {}, CreateExtension<SceneExtension>);
+  AddLazyExtension("BuiltinTime", {}, CreateExtension<TimeExtension>);
+  AddLazyExtension("BuiltinMathematicalTools",
+                   {},
+                   CreateExtension<MathematicalToolsExtension>);
+  AddLazyExtension("BuiltinCamera", {}, CreateExtension<CameraExtension>);
+  AddLazyExtension("BuiltinAudio", {}, CreateExtension<AudioExtension>);
+  AddLazyExtension("BuiltinFile", {}, CreateExtension<FileExtension>);
+  AddLazyExtension("BuiltinNetwork", {}, CreateExtension<NetworkExtension>);
+  AddLazyExtension("BuiltinWindow", {}, CreateExtension<WindowExtension>);
+  AddLazyExtension("BuiltinStringInstructions",
+                   {},
+                   CreateExtension<StringInstructionsExtension>);
+  AddLazyExtension("BuiltinAdvanced", {}, CreateExtension<AdvancedExtension>);
+  AddLazyExtension("BuiltinExternalLayouts",
+                   {},
+                   CreateExtension<ExternalLayoutsExtension>);
+  AddLazyExtension("AnimatableCapability",
+                   {},
+                   CreateExtension<AnimatableExtension>);
+  AddLazyExtension("EffectCapability", {}, CreateExtension<EffectExtension>);
+  AddLazyExtension("FlippableCapability",
+                   {},
+                   CreateExtension<FlippableExtension>);
+  AddLazyExtension("ResizableCapability",
+                   {},
+                   CreateExtension<ResizableExtension>);
+  AddLazyExtension("ScalableCapability",
+                   {},
+                   CreateExtension<ScalableExtension>);
+  AddLazyExtension("OpacityCapability", {}, CreateExtension<OpacityExtension>);
+  AddLazyExtension("TextContainerCapability",
+                   {},
+                   CreateExtension<TextContainerExtension>);
   std::cout << "done." << std::endl;
 
 #if defined(EMSCRIPTEN) // When compiling with emscripten, hardcode extensions
                         // to load.
   std::cout << "* Loading other extensions... ";
   std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPlatformBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDestroyOutsideBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTiledSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDraggableBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTopDownMovementBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSTextObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSParticleSystemExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPanelSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSAnchorBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPrimitiveDrawingExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTextEntryObjectExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSInventoryExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSLinkedObjectsExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSSystemInfoExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSShopifyExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPathfindingBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPhysicsBehaviorExtension()));
-  std::cout.flush();
+  AddLazyExtension("PlatformBehavior", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPlatformBehaviorExtension());
+  });
+  AddLazyExtension("DestroyOutsideBehavior", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSDestroyOutsideBehaviorExtension());
+  });
+  AddLazyExtension(
+      "TiledSpriteObject", {"TiledSpriteObject::TiledSprite"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTiledSpriteObjectExtension());
+  });
+  AddLazyExtension("DraggableBehavior", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSDraggableBehaviorExtension());
+  });
+  AddLazyExtension("TopDownMovementBehavior", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTopDownMovementBehaviorExtension());
+  });
+  AddLazyExtension("TextObject", {"TextObject::Text"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTextObjectExtension());
+  });
+  AddLazyExtension("ParticleSystem", {"ParticleSystem::ParticleEmitter"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSParticleSystemExtension());
+  });
+  AddLazyExtension(
+      "PanelSpriteObject", {"PanelSpriteObject::PanelSprite"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPanelSpriteObjectExtension());
+  });
+  AddLazyExtension("AnchorBehavior", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSAnchorBehaviorExtension());
+  });
+  AddLazyExtension("PrimitiveDrawing", {"PrimitiveDrawing::Drawer"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPrimitiveDrawingExtension());
+  });
+  AddLazyExtension("TextEntryObject", {"TextEntryObject::TextEntry"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTextEntryObjectExtension());
+  });
+  AddLazyExtension("Inventory", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSInventoryExtension());
+  });
+  AddLazyExtension("LinkedObjects", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSLinkedObjectsExtension());
+  });
+  AddLazyExtension("SystemInfo", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSSystemInfoExtension());
+  });
+  AddLazyExtension("Shopify", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(CreateGDJSShopifyExtension());
+  });
+  AddLazyExtension("PathfindingBehavior", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPathfindingBehaviorExtension());
+  });
+  AddLazyExtension("PhysicsBehavior", {}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPhysicsBehaviorExtension());
+  });
 #endif
   std::cout << "done." << std::endl;
 };
 
 void JsPlatform::AddNewExtension(const gd::PlatformExtension &extension) {
+  gd::MemoryTracker::Scope memoryScope(gd::MemoryTracker::Metadata);
   AddExtension(std::shared_ptr<gd::PlatformExtension>(
       new gd::PlatformExtension(extension)));
 }
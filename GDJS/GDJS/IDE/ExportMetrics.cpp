@@ -0,0 +1,80 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/IDE/ExportMetrics.h"
+
+#if defined(EMSCRIPTEN)
+#include <emscripten.h>
+#endif
+#include <algorithm>
+#include <chrono>
+
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/SystemStats.h"
+
+namespace gdjs {
+
+double ExportMetrics::GetTimeNow() {
+#if defined(EMSCRIPTEN)
+  return emscripten_get_now();
+#else
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+void ExportMetrics::AddStage(const gd::String &name, double timeSpent) {
+  stages.push_back(Stage{name, timeSpent});
+  peakVirtualMemory =
+      std::max(peakVirtualMemory, gd::SystemStats::GetUsedVirtualMemory());
+}
+
+void ExportMetrics::AddScene(const gd::String &name,
+                             double codeGenerationTime,
+                             std::size_t codeSize,
+                             bool isCodeFromCache) {
+  scenes.push_back(Scene{name, codeGenerationTime, codeSize, isCodeFromCache});
+}
+
+gd::String ExportMetrics::ToJSON() const {
+  gd::SerializerElement element;
+
+  auto &stagesElement = element.AddChild("stages");
+  stagesElement.ConsiderAsArrayOf("stage");
+  for (const auto &stage : stages) {
+    stagesElement.AddChild("stage")
+        .SetAttribute("name", stage.name)
+        .SetAttribute("timeSpent", stage.timeSpent);
+  }
+
+  auto &scenesElement = element.AddChild("scenes");
+  scenesElement.ConsiderAsArrayOf("scene");
+  for (const auto &scene : scenes) {
+    scenesElement.AddChild("scene")
+        .SetAttribute("name", scene.name)
+        .SetAttribute("codeGenerationTime", scene.codeGenerationTime)
+        .SetAttribute("codeSize", static_cast<double>(scene.codeSize))
+        .SetAttribute("isCodeFromCache", scene.isCodeFromCache);
+  }
+
+  element.SetAttribute("bytesWritten", static_cast<double>(bytesWritten));
+  element.SetAttribute("filesCopied", static_cast<double>(filesCopied));
+  element.SetAttribute("peakVirtualMemory",
+                       static_cast<double>(peakVirtualMemory));
+
+  return gd::Serializer::ToJSON(element);
+}
+
+void ExportMetrics::Clear() {
+  stages.clear();
+  scenes.clear();
+  bytesWritten = 0;
+  filesCopied = 0;
+  peakVirtualMemory = 0;
+}
+
+}  // namespace gdjs
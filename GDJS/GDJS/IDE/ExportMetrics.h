@@ -0,0 +1,93 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gdjs {
+
+/**
+ * \brief Measures done during an export: the time spent in each stage, the
+ * time spent to generate the code of each scene, the bytes written and the
+ * files copied.
+ *
+ * The report can be serialized to JSON to track the exports (for example,
+ * to find regressions or the scenes that are slow to generate).
+ *
+ * \see gdjs::ExporterHelper
+ */
+class ExportMetrics {
+ public:
+  ExportMetrics() : bytesWritten(0), filesCopied(0), peakVirtualMemory(0){};
+  virtual ~ExportMetrics(){};
+
+  /**
+   * \brief Return the current time, in milliseconds, to measure the time
+   * spent in stages.
+   */
+  static double GetTimeNow();
+
+  /**
+   * \brief Record the time spent in a stage of the export. The peak of the
+   * virtual memory used is updated at the same time.
+   */
+  void AddStage(const gd::String &name, double timeSpent);
+
+  /**
+   * \brief Record the time spent to generate the code of a scene (0 if the
+   * code was reused from a cache) and the size of this code.
+   */
+  void AddScene(const gd::String &name,
+                double codeGenerationTime,
+                std::size_t codeSize,
+                bool isCodeFromCache);
+
+  void AddBytesWritten(std::size_t bytes) { bytesWritten += bytes; }
+  void AddFilesCopied(std::size_t count) { filesCopied += count; }
+
+  std::size_t GetBytesWritten() const { return bytesWritten; }
+  std::size_t GetFilesCopied() const { return filesCopied; }
+
+  /**
+   * \brief Return the peak of the virtual memory used (in KiB) when a stage
+   * was recorded, or 0 if not available on the system.
+   */
+  std::size_t GetPeakVirtualMemory() const { return peakVirtualMemory; }
+
+  /**
+   * \brief Return the report of the measures, as JSON.
+   */
+  gd::String ToJSON() const;
+
+  /**
+   * \brief Remove all the measures.
+   */
+  void Clear();
+
+ private:
+  struct Stage {
+    gd::String name;
+    double timeSpent;
+  };
+
+  struct Scene {
+    gd::String name;
+    double codeGenerationTime;
+    std::size_t codeSize;
+    bool isCodeFromCache;
+  };
+
+  std::vector<Stage> stages;
+  std::vector<Scene> scenes;
+  std::size_t bytesWritten;
+  std::size_t filesCopied;
+  std::size_t peakVirtualMemory;
+};
+
+}  // namespace gdjs
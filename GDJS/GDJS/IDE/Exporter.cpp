@@ -13,11 +13,11 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Events/EventsArena.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/Events/UsedExtensionsFinder.h"
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
 #include "GDCore/IDE/Project/SceneResourcesFinder.h"
-#include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
 #include "GDCore/Project/Layout.h"
@@ -25,6 +25,7 @@
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/PerfScope.h"
 #include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDJS/IDE/ExporterHelper.h"
 
@@ -38,7 +39,8 @@ static void InsertUnique(std::vector<gd::String> &container, gd::String str) {
 }
 
 Exporter::Exporter(gd::AbstractFileSystem &fileSystem, gd::String gdjsRoot_)
-    : fs(fileSystem), gdjsRoot(gdjsRoot_) {
+    : fs(fileSystem), gdjsRoot(gdjsRoot_), codeGenerationThreadsCount(1),
+      codeGenerationCache(nullptr), codeGenerationReport(nullptr) {
   SetCodeOutputDirectory(fs.GetTempDir() + "/GDTemporaries/JSCodeTemp");
 }
 
@@ -47,11 +49,24 @@ Exporter::~Exporter() {}
 bool Exporter::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
-  return helper.ExportProjectForPixiPreview(options);
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
+  helper.SetCodeGenerationCache(codeGenerationCache);
+  helper.SetCodeGenerationReport(codeGenerationReport);
+  bool isExported = helper.ExportProjectForPixiPreview(options);
+  lastMetricsReport = helper.GetMetrics().ToJSON();
+  return isExported;
 }
 
 bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
+  gd::PerfScope perfScope("Exporter::ExportWholePixiProject");
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
+  helper.SetCodeGenerationCache(codeGenerationCache);
+  helper.SetCodeGenerationReport(codeGenerationReport);
+  // The copy of the project is only used for this export: allocate its
+  // events and instructions in an arena, released at once at the end.
+  gd::EventsArena eventsArena;
+  gd::EventsArena::Scope eventsArenaScope(&eventsArena);
   gd::Project exportedProject = options.project;
 
   auto usedExtensionsResult =
@@ -63,6 +78,13 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
                         &options,
                         &helper,
                         &usedExtensionsResult](gd::String exportDir) {
+    auto addStage = [&helper](const gd::String &name, double previousTime) {
+      helper.metrics.AddStage(name,
+                              ExportMetrics::GetTimeNow() - previousTime);
+      return ExportMetrics::GetTimeNow();
+    };
+    double previousTime = ExportMetrics::GetTimeNow();
+
     gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport =
         options.project.GetWholeProjectDiagnosticReport();
     wholeProjectDiagnosticReport.Clear();
@@ -86,6 +108,7 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
     // Export the resources (before generating events as some resources
     // filenames may be updated)
     helper.ExportResources(fs, exportedProject, exportDir);
+    previousTime = addStage("Resource export", previousTime);
 
     // Compatibility with GD <= 5.0-beta56
     // Stay compatible with text objects declaring their font as just a filename
@@ -119,12 +142,16 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
     // to the engine)
     helper.ExportEffectIncludes(exportedProject, includesFiles);
 
+    previousTime = addStage("Include files export", previousTime);
+
     // Export events
     if (!helper.ExportEventsCode(exportedProject,
                                  codeOutputDir,
                                  includesFiles,
                                  wholeProjectDiagnosticReport,
-                                 false)) {
+                                 false,
+                                 options.compactEventsCode,
+                                 options.eventsProfiling)) {
       gd::LogError(_("Error during exporting! Unable to export events:\n") +
                    lastError);
       return false;
@@ -141,22 +168,47 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
           gd::SceneResourcesFinder::FindSceneResources(exportedProject, layout);
     }
 
-    // Strip the project (*after* generating events as the events may use
-    // stripped things like objects groups...)...
-    gd::ProjectStripper::StripProjectForExport(exportedProject);
+    previousTime = addStage("Events code export", previousTime);
 
-    //...and export it
+    // Export the project, stripped of the data only used by the editor
+    // (*after* generating events as the events may use stripped things like
+    // objects groups...)
     gd::SerializerElement noRuntimeGameOptions;
     helper.ExportProjectData(fs,
                              exportedProject,
                              codeOutputDir + "/data.js",
                              noRuntimeGameOptions,
                              projectUsedResources,
-                             scenesUsedResources);
+                             scenesUsedResources,
+                             options.splitScenesData ? exportDir : "",
+                             options.projectDataAsJsonString,
+                             &helper.metrics,
+                             options.instancesChunkSize);
     includesFiles.push_back(codeOutputDir + "/data.js");
-
-    helper.ExportIncludesAndLibs(includesFiles, exportDir, false);
+    previousTime = addStage("Project data export", previousTime);
+
+    // Desktop and mobile games load their scripts from the device: the
+    // bundle is always used, so that they start by parsing a single file.
+    const bool bundleScripts = options.bundleScripts ||
+                               options.target == "cordova" ||
+                               options.target == "electron";
+    if (bundleScripts) {
+      // The bundle is relative to the export directory, like the relative
+      // includes copied from the Runtime folder.
+      const gd::String bundleFilename = "bundle.js";
+      if (!helper.ExportIncludesAndLibsAsBundle(
+              includesFiles, exportDir, bundleFilename)) {
+        gd::LogError(_("Error during export:\n") +
+                     _("Unable to write the bundle of the scripts."));
+        return false;
+      }
+      includesFiles.clear();
+      includesFiles.push_back(bundleFilename);
+    } else {
+      helper.ExportIncludesAndLibs(includesFiles, exportDir, false);
+    }
     helper.ExportIncludesAndLibs(resourcesFiles, exportDir, false);
+    previousTime = addStage("Include and libs export", previousTime);
 
     gd::String source = gdjsRoot + "/Runtime/index.html";
     if (options.target == "cordova")
@@ -178,11 +230,18 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
     return true;
   };
 
+  auto exportProjectAndMeasure = [this, &exportProject, &helper](
+                                     gd::String exportDir) {
+    bool isExported = exportProject(exportDir);
+    lastMetricsReport = helper.GetMetrics().ToJSON();
+    return isExported;
+  };
+
   if (options.target == "cordova") {
     fs.MkDir(options.exportPath);
     fs.MkDir(options.exportPath + "/www");
 
-    if (!exportProject(options.exportPath + "/www")) return false;
+    if (!exportProjectAndMeasure(options.exportPath + "/www")) return false;
 
     if (!helper.ExportCordovaFiles(
             exportedProject, options.exportPath, usedExtensions))
@@ -190,7 +249,7 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
   } else if (options.target == "electron") {
     fs.MkDir(options.exportPath);
 
-    if (!exportProject(options.exportPath + "/app")) return false;
+    if (!exportProjectAndMeasure(options.exportPath + "/app")) return false;
 
     if (!helper.ExportElectronFiles(
             exportedProject, options.exportPath, usedExtensions))
@@ -200,13 +259,13 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
                                                   options.exportPath))
       return false;
   } else if (options.target == "facebookInstantGames") {
-    if (!exportProject(options.exportPath)) return false;
+    if (!exportProjectAndMeasure(options.exportPath)) return false;
 
     if (!helper.ExportFacebookInstantGamesFiles(exportedProject,
                                                 options.exportPath))
       return false;
   } else {
-    if (!exportProject(options.exportPath)) return false;
+    if (!exportProjectAndMeasure(options.exportPath)) return false;
 
     if (!helper.ExportHtml5Files(exportedProject, options.exportPath))
       return false;
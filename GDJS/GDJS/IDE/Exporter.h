@@ -16,10 +16,12 @@ class Project;
 class Layout;
 class ExternalLayout;
 class AbstractFileSystem;
+class CodeGenerationReport;
 }  // namespace gd
 namespace gdjs {
 struct PreviewExportOptions;
 struct ExportOptions;
+class LayoutCodeGenerationCache;
 }
 
 namespace gdjs {
@@ -55,6 +57,16 @@ class Exporter {
    */
   const gd::String& GetLastError() const { return lastError; };
 
+  /**
+   * \brief Return the measures done during the last export, as JSON: the
+   * time spent in each stage, the time spent to generate the code of each
+   * scene and its size, the bytes written, the files copied and the peak of
+   * the virtual memory used.
+   *
+   * \see gdjs::ExportMetrics
+   */
+  const gd::String& GetLastMetricsReport() const { return lastMetricsReport; };
+
   /**
    * \brief Change the directory where code files are generated.
    *
@@ -64,14 +76,55 @@ class Exporter {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Change the number of threads used to generate the code of the
+   * scenes. 0 means as many as the hardware can run concurrently.
+   *
+   * By default, this is set to 1: scenes are generated one after the other.
+   * The generated code is the same whatever the number of threads.
+   */
+  void SetCodeGenerationThreadsCount(std::size_t threadsCount) {
+    codeGenerationThreadsCount = threadsCount;
+  }
+
+  /**
+   * \brief Set a cache of the code generated for scenes, so that the scenes
+   * not modified since a previous export using the same cache are not
+   * generated again. The cache must outlive the exporter.
+   *
+   * By default, no cache is used.
+   */
+  void SetCodeGenerationCache(LayoutCodeGenerationCache &cache) {
+    codeGenerationCache = &cache;
+  }
+
+  /**
+   * \brief Set a report where the size of the code generated for each scene
+   * and its groups of events is recorded at each export. The report must
+   * outlive the exporter.
+   *
+   * By default, no report is filled. When a report is set, the code of all
+   * the scenes is generated, even if it's in the cache.
+   */
+  void SetCodeGenerationReport(gd::CodeGenerationReport &report) {
+    codeGenerationReport = &report;
+  }
+
  private:
   gd::AbstractFileSystem&
       fs;  ///< The abstract file system to be used for exportation.
   gd::String lastError;  ///< The last error that occurred.
+  gd::String lastMetricsReport;  ///< The measures of the last export, as JSON.
   gd::String
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::size_t codeGenerationThreadsCount;  ///< The number of threads used to
+                                           ///< generate the code of scenes.
+  LayoutCodeGenerationCache *codeGenerationCache;  ///< The cache of the code of
+                                                   ///< scenes, if any.
+  gd::CodeGenerationReport *codeGenerationReport;  ///< The report of the code
+                                                   ///< generated, if any.
 };
 
 }  // namespace gdjs
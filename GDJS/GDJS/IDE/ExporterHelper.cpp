@@ -5,9 +5,6 @@
  */
 #include "GDJS/IDE/ExporterHelper.h"
 
-#if defined(EMSCRIPTEN)
-#include <emscripten.h>
-#endif
 #include <algorithm>
 #include <array>
 #include <fstream>
@@ -17,7 +14,9 @@
 #include <string>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/CodeGeneration/CodeGenerationReport.h"
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Events/CodeGeneration/EffectsCodeGenerator.h"
 #include "GDCore/Extensions/Metadata/DependencyMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -25,41 +24,69 @@
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/CaptureOptions.h"
+#include "GDCore/IDE/DependenciesAnalyzer.h"
 #include "GDCore/IDE/Events/UsedExtensionsFinder.h"
 #include "GDCore/IDE/ExportedDependencyResolver.h"
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
 #include "GDCore/IDE/Project/SceneResourcesFinder.h"
-#include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/IDE/SceneNameMangler.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
 #include "GDCore/Project/EventsBasedObject.h"
 #include "GDCore/Project/EventsFunctionsExtension.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/InitialInstancesSpatialIndex.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElementArena.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/PerfScope.h"
+#include "GDCore/Tools/TasksRunner.h"
+#include "GDJS/Events/CodeGeneration/LayoutCodeGenerationCache.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
 
 namespace {
-double GetTimeNow() {
-#if defined(EMSCRIPTEN)
-  double currentTime = emscripten_get_now();
-  return currentTime;
-#else
-  return 0;
-#endif
-}
-double GetTimeSpent(double previousTime) { return GetTimeNow() - previousTime; }
-double LogTimeSpent(const gd::String &name, double previousTime) {
-  gd::LogStatus(name + " took " + gd::String::From(GetTimeSpent(previousTime)) +
-                "ms");
+double LogTimeSpent(const gd::String &name,
+                    double previousTime,
+                    gdjs::ExportMetrics &metrics) {
+  double timeSpent = gdjs::ExportMetrics::GetTimeNow() - previousTime;
+  metrics.AddStage(name, timeSpent);
+  gd::LogStatus(name + " took " + gd::String::From(timeSpent) + "ms");
   std::cout << std::endl;
-  return GetTimeNow();
+  return gdjs::ExportMetrics::GetTimeNow();
+}
+
+/**
+ * Escape a JSON text so that it can be written in a single quoted JavaScript
+ * string.
+ */
+gd::String EscapeJsonForSingleQuotedString(const gd::String &json) {
+  const std::string &raw = json.Raw();
+  std::string escaped;
+  escaped.reserve(raw.size() + raw.size() / 16);
+  for (std::size_t i = 0; i < raw.size(); ++i) {
+    char c = raw[i];
+    if (c == '\\' || c == '\'') {
+      escaped += '\\';
+      escaped += c;
+    } else if (c == '\xE2' && i + 2 < raw.size() && raw[i + 1] == '\x80' &&
+               (raw[i + 2] == '\xA8' || raw[i + 2] == '\xA9')) {
+      // Line and paragraph separators are not allowed in strings by older
+      // JavaScript engines.
+      escaped += raw[i + 2] == '\xA8' ? "\\u2028" : "\\u2029";
+      i += 2;
+    } else {
+      escaped += c;
+    }
+  }
+  return gd::String::FromUTF8(escaped);
 }
 }  // namespace
 
@@ -101,56 +128,30 @@ static gd::String CleanProjectName(gd::String projectName) {
 ExporterHelper::ExporterHelper(gd::AbstractFileSystem &fileSystem,
                                gd::String gdjsRoot_,
                                gd::String codeOutputDir_)
-    : fs(fileSystem), gdjsRoot(gdjsRoot_), codeOutputDir(codeOutputDir_) {};
+    : fs(fileSystem),
+      gdjsRoot(gdjsRoot_),
+      codeOutputDir(codeOutputDir_),
+      codeGenerationThreadsCount(1),
+      codeGenerationCache(nullptr),
+      codeGenerationReport(nullptr) {};
 
 bool ExporterHelper::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
-  double previousTime = GetTimeNow();
+  gd::PerfScope perfScope("ExporterHelper::ExportProjectForPixiPreview");
+  metrics.Clear();
+  double previousTime = ExportMetrics::GetTimeNow();
   fs.MkDir(options.exportPath);
-  fs.ClearDir(options.exportPath);
+  if (!options.incrementalResourcesExport) fs.ClearDir(options.exportPath);
   std::vector<gd::String> includesFiles;
   std::vector<gd::String> resourcesFiles;
 
-  // TODO Try to remove side effects to avoid the copy
-  // that destroys the AST in cache.
-  gd::Project exportedProject = options.project;
-  const gd::Project &immutableProject = exportedProject;
-
-  if (options.fullLoadingScreen) {
-    // Use project properties fallback to set empty properties
-    if (exportedProject.GetAuthorIds().empty() &&
-        !options.fallbackAuthorId.empty()) {
-      exportedProject.GetAuthorIds().push_back(options.fallbackAuthorId);
-    }
-    if (exportedProject.GetAuthorUsernames().empty() &&
-        !options.fallbackAuthorUsername.empty()) {
-      exportedProject.GetAuthorUsernames().push_back(
-          options.fallbackAuthorUsername);
-    }
-  } else {
-    // Most of the time, we skip the logo and minimum duration so that
-    // the preview start as soon as possible.
-    exportedProject.GetLoadingScreen()
-        .ShowGDevelopLogoDuringLoadingScreen(false)
-        .SetMinDuration(0);
-    exportedProject.GetWatermark().ShowGDevelopWatermark(false);
-  }
-
-  // Export resources (*before* generating events as some resources filenames
-  // may be updated)
-  ExportResources(fs, exportedProject, options.exportPath);
-
-  previousTime = LogTimeSpent("Resource export", previousTime);
-
-  // Compatibility with GD <= 5.0-beta56
-  // Stay compatible with text objects declaring their font as just a filename
-  // without a font resource - by manually adding these resources.
-  AddDeprecatedFontFilesToFontResources(
-      fs, exportedProject.GetResourcesManager(), options.exportPath);
-  // end of compatibility code
+  // The events code, the extensions and the effects used are found from the
+  // project itself, before the export-time modifications: these don't change
+  // them, and the expressions ASTs cached in the project events are reused.
+  const gd::Project &immutableProject = options.project;
 
   auto usedExtensionsResult =
-      gd::UsedExtensionsFinder::ScanProject(exportedProject);
+      gd::UsedExtensionsFinder::ScanProject(options.project);
 
   // Export engine libraries
   AddLibsInclude(/*pixiRenderers=*/true,
@@ -178,9 +179,9 @@ bool ExporterHelper::ExportProjectForPixiPreview(
 
   // Export effects (after engine libraries as they auto-register themselves to
   // the engine)
-  ExportEffectIncludes(exportedProject, includesFiles);
+  ExportEffectIncludes(options.project, includesFiles);
 
-  previousTime = LogTimeSpent("Include files export", previousTime);
+  previousTime = LogTimeSpent("Include files export", previousTime, metrics);
 
   if (!options.projectDataOnlyExport) {
     gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport =
@@ -196,27 +197,88 @@ bool ExporterHelper::ExportProjectForPixiPreview(
       return false;
     }
 
-    previousTime = LogTimeSpent("Events code export", previousTime);
+    previousTime = LogTimeSpent("Events code export", previousTime, metrics);
   }
 
+  // The exported data is modified (resources files, loading screen,
+  // stripping...), so it's done on a copy of the project.
+  gd::Project exportedProject = options.project;
+
+  if (options.fullLoadingScreen) {
+    // Use project properties fallback to set empty properties
+    if (exportedProject.GetAuthorIds().empty() &&
+        !options.fallbackAuthorId.empty()) {
+      exportedProject.GetAuthorIds().push_back(options.fallbackAuthorId);
+    }
+    if (exportedProject.GetAuthorUsernames().empty() &&
+        !options.fallbackAuthorUsername.empty()) {
+      exportedProject.GetAuthorUsernames().push_back(
+          options.fallbackAuthorUsername);
+    }
+  } else {
+    // Most of the time, we skip the logo and minimum duration so that
+    // the preview start as soon as possible.
+    exportedProject.GetLoadingScreen()
+        .ShowGDevelopLogoDuringLoadingScreen(false)
+        .SetMinDuration(0);
+    exportedProject.GetWatermark().ShowGDevelopWatermark(false);
+  }
+
+  // Export resources (the resources filenames are updated in the exported
+  // project).
+  ExportResources(fs,
+                  exportedProject,
+                  options.exportPath,
+                  options.incrementalResourcesExport);
+
+  previousTime = LogTimeSpent("Resource export", previousTime, metrics);
+
+  // Compatibility with GD <= 5.0-beta56
+  // Stay compatible with text objects declaring their font as just a filename
+  // without a font resource - by manually adding these resources.
+  AddDeprecatedFontFilesToFontResources(
+      fs, exportedProject.GetResourcesManager(), options.exportPath);
+  // end of compatibility code
+
   auto projectUsedResources =
       gd::SceneResourcesFinder::FindProjectResources(exportedProject);
   std::unordered_map<gd::String, std::set<gd::String>> scenesUsedResources;
+  // Finding the resources of a scene goes through the events of all the
+  // extensions, so the resources of unchanged scenes are reused if possible.
+  const std::uint64_t resourcesProjectHash =
+      codeGenerationCache
+          ? LayoutCodeGenerationCache::ComputeProjectHash(
+                exportedProject, JsPlatform::Get(), false)
+          : 0;
+  DependenciesAnalyzer::LinksCache linksCache;
   for (std::size_t layoutIndex = 0;
        layoutIndex < exportedProject.GetLayoutsCount();
        layoutIndex++) {
     auto &layout = exportedProject.GetLayout(layoutIndex);
+    std::uint64_t resourcesHash = 0;
+    if (codeGenerationCache) {
+      resourcesHash = LayoutCodeGenerationCache::ComputeLayoutResourcesHash(
+          exportedProject, layout, resourcesProjectHash, &linksCache);
+      if (const auto *resourceNames = codeGenerationCache->GetSceneResources(
+              layout.GetName(), resourcesHash)) {
+        scenesUsedResources[layout.GetName()] = *resourceNames;
+        continue;
+      }
+    }
+
     scenesUsedResources[layout.GetName()] =
         gd::SceneResourcesFinder::FindSceneResources(exportedProject, layout);
+    if (codeGenerationCache) {
+      codeGenerationCache->StoreSceneResources(
+          layout.GetName(), resourcesHash, scenesUsedResources[layout.GetName()]);
+    }
   }
 
-  // Strip the project (*after* generating events as the events may use stripped
-  // things (objects groups...))
-  gd::ProjectStripper::StripProjectForExport(exportedProject);
+  // The project is stripped when serialized by ExportProjectData (the events
+  // code is already generated and may use stripped things like objects
+  // groups...).
   exportedProject.SetFirstLayout(options.layoutName);
 
-  previousTime = LogTimeSpent("Data stripping", previousTime);
-
   // Create the setup options passed to the gdjs.RuntimeGame
   gd::SerializerElement runtimeGameOptions;
   runtimeGameOptions.AddChild("isPreview").SetBoolValue(true);
@@ -297,12 +359,15 @@ bool ExporterHelper::ExportProjectForPixiPreview(
 
   for (const auto &includeFile : includesFiles) {
     auto hashIt = options.includeFileHashes.find(includeFile);
+    auto codeFileHashIt = codeFilesHashes.find(includeFile);
     gd::String scriptSrc = GetExportedIncludeFilename(includeFile);
     scriptFilesElement.AddChild("scriptFile")
         .SetStringAttribute("path", scriptSrc)
         .SetIntAttribute(
             "hash",
-            hashIt != options.includeFileHashes.end() ? hashIt->second : 0);
+            hashIt != options.includeFileHashes.end() ? hashIt->second
+            : codeFileHashIt != codeFilesHashes.end() ? codeFileHashIt->second
+                                                      : 0);
   }
 
   // Export the project
@@ -311,10 +376,13 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                     codeOutputDir + "/data.js",
                     runtimeGameOptions,
                     projectUsedResources,
-                    scenesUsedResources);
+                    scenesUsedResources,
+                    "",
+                    false,
+                    &metrics);
   includesFiles.push_back(codeOutputDir + "/data.js");
 
-  previousTime = LogTimeSpent("Project data export", previousTime);
+  previousTime = LogTimeSpent("Project data export", previousTime, metrics);
 
   // Copy all the dependencies and their source maps
   ExportIncludesAndLibs(includesFiles, options.exportPath, true);
@@ -330,7 +398,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                            "gdjs.runtimeGameOptions"))
     return false;
 
-  previousTime = LogTimeSpent("Include and libs export", previousTime);
+  previousTime = LogTimeSpent("Include and libs export", previousTime, metrics);
   return true;
 }
 
@@ -340,24 +408,211 @@ gd::String ExporterHelper::ExportProjectData(
     gd::String filename,
     const gd::SerializerElement &runtimeGameOptions,
     std::set<gd::String> &projectUsedResources,
-    std::unordered_map<gd::String, std::set<gd::String>> &scenesUsedResources) {
+    std::unordered_map<gd::String, std::set<gd::String>> &scenesUsedResources,
+    const gd::String &scenesDataExportDir,
+    bool projectDataAsJsonString,
+    ExportMetrics *metrics,
+    double instancesChunkSize) {
+  gd::PerfScope perfScope("ExporterHelper::ExportProjectData");
   fs.MkDir(fs.DirNameFrom(filename));
 
-  // Save the project to JSON
-  gd::SerializerElement rootElement;
-  project.SerializeTo(rootElement);
+  // Save the project to JSON. The serialized project is temporary:
+  // allocate it in an arena to avoid lots of small allocations.
+  gd::SerializerElementArena arena;
+  gd::SerializerElement rootElement(arena);
+  project.SerializeForExportTo(rootElement);
   SerializeUsedResources(
       rootElement, projectUsedResources, scenesUsedResources);
-  gd::String output =
-      "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
-      "gdjs.runtimeGameOptions = " +
-      gd::Serializer::ToJSON(runtimeGameOptions) + ";\n";
+  if (instancesChunkSize > 0)
+    SplitInstancesInChunks(project, rootElement, instancesChunkSize);
+
+  if (!scenesDataExportDir.empty()) {
+    // Before a scene is started, the game only needs its name and the
+    // resources it uses: the rest is loaded with the resources of the scene.
+    MoveExternalLayoutsInScenes(project, rootElement);
+    fs.MkDir(scenesDataExportDir + "/scenes");
+    auto &layoutsElement = rootElement.GetChild("layouts");
+    for (std::size_t layoutIndex = 0;
+         layoutIndex < layoutsElement.GetChildrenCount();
+         layoutIndex++) {
+      auto &layoutElement = layoutsElement.GetChild(layoutIndex);
+      gd::String dataFile =
+          "scenes/scene" + gd::String::From(layoutIndex) + ".json";
+      gd::String dataFilename = scenesDataExportDir + "/" + dataFile;
+      gd::String sceneJson = gd::Serializer::ToJSON(layoutElement);
+      if (!fs.WriteToFile(dataFilename, sceneJson))
+        return "Unable to write " + dataFilename;
+      if (metrics) metrics->AddBytesWritten(sceneJson.Raw().size());
+
+      gd::SerializerElement sceneElement;
+      sceneElement.SetAttribute("name",
+                                layoutElement.GetStringAttribute("name"));
+      for (const gd::String &attributeName :
+           {"resourcesPreloading", "resourcesUnloading"}) {
+        if (layoutElement.HasAttribute(attributeName))
+          sceneElement.SetAttribute(
+              attributeName, layoutElement.GetStringAttribute(attributeName));
+      }
+      sceneElement.AddChild("usedResources") =
+          layoutElement.GetChild("usedResources");
+      sceneElement.SetAttribute("dataFile", dataFile);
+      layoutElement = sceneElement;
+    }
+  }
+
+  // Write the file piece by piece, so that the (large) JSON of the project is
+  // not copied again into another string.
+  gd::String projectJson = gd::Serializer::ToJSON(rootElement);
+  gd::LogStatus("Project data is " + gd::String::From(projectJson.Raw().size()) +
+                " bytes");
+  if (projectDataAsJsonString) {
+    // Browsers parse JSON faster than the equivalent object literal.
+    projectJson =
+        "JSON.parse('" + EscapeJsonForSingleQuotedString(projectJson) + "')";
+  }
 
-  if (!fs.WriteToFile(filename, output)) return "Unable to write " + filename;
+  if (!fs.OpenForWrite(filename)) return "Unable to write " + filename;
+  bool written =
+      fs.Append(filename, "gdjs.projectData = ") &&
+      fs.Append(filename, projectJson) &&
+      fs.Append(filename, ";\ngdjs.runtimeGameOptions = ") &&
+      fs.Append(filename, gd::Serializer::ToJSON(runtimeGameOptions)) &&
+      fs.Append(filename, ";\n");
+  bool closed = fs.Close(filename);
+  if (!written || !closed) return "Unable to write " + filename;
+  if (metrics) metrics->AddBytesWritten(projectJson.Raw().size());
 
   return "";
 }
 
+void ExporterHelper::SplitInstancesInChunks(
+    gd::Project &project,
+    gd::SerializerElement &rootElement,
+    double chunkSize) {
+  auto &layoutsElement = rootElement.GetChild("layouts");
+  for (std::size_t layoutIndex = 0;
+       layoutIndex < layoutsElement.GetChildrenCount() &&
+       layoutIndex < project.GetLayoutsCount();
+       layoutIndex++) {
+    auto &layoutElement = layoutsElement.GetChild(layoutIndex);
+    auto &instancesElement = layoutElement.GetChild("instances");
+    auto &instances = project.GetLayout(layoutIndex).GetInitialInstances();
+    if (instancesElement.GetChildrenCount() != instances.GetInstancesCount())
+      continue;
+
+    // The instances are serialized in the order of the container.
+    std::unordered_map<const gd::InitialInstance *, std::size_t>
+        instancesIndexes;
+    std::size_t instanceIndex = 0;
+    instances.IterateOverInstances([&](gd::InitialInstance &instance) {
+      instancesIndexes[&instance] = instanceIndex++;
+      return false;
+    });
+
+    gd::InitialInstancesSpatialIndex spatialIndex(chunkSize);
+    spatialIndex.Build(instances);
+
+    std::vector<bool> isInChunk(instancesIndexes.size(), false);
+    gd::SerializerElement chunksElement;
+    chunksElement.ConsiderAsArrayOf("instancesChunk");
+    spatialIndex.IterateOverCells(
+        [&](int cellX,
+            int cellY,
+            const std::vector<gd::InitialInstance *> &cellInstances) {
+          auto &chunkElement = chunksElement.AddChild("instancesChunk");
+          chunkElement.SetAttribute("x", cellX);
+          chunkElement.SetAttribute("y", cellY);
+          auto &chunkInstancesElement = chunkElement.AddChild("instances");
+          chunkInstancesElement.ConsiderAsArrayOf("instance");
+          for (const gd::InitialInstance *instance : cellInstances) {
+            std::size_t index = instancesIndexes[instance];
+            isInChunk[index] = true;
+            chunkInstancesElement.AddChild("instance") =
+                instancesElement.GetChild(index);
+          }
+        });
+
+    gd::SerializerElement remainingInstancesElement;
+    remainingInstancesElement.ConsiderAsArrayOf("instance");
+    for (std::size_t index = 0; index < isInChunk.size(); index++) {
+      if (!isInChunk[index])
+        remainingInstancesElement.AddChild("instance") =
+            instancesElement.GetChild(index);
+    }
+    instancesElement = remainingInstancesElement;
+    layoutElement.SetAttribute("instancesChunkSize", chunkSize);
+    layoutElement.AddChild("instancesChunks") = chunksElement;
+  }
+}
+
+void ExporterHelper::MoveExternalLayoutsInScenes(
+    gd::Project &project, gd::SerializerElement &rootElement) {
+  auto usesExternalLayouts =
+      [](const gd::EventsFunctionsContainer &eventsFunctions) {
+        for (std::size_t i = 0; i < eventsFunctions.GetEventsFunctionsCount();
+             i++) {
+          DependenciesAnalyzer::LinksCache::EventsDependencies dependencies;
+          DependenciesAnalyzer::LinksCache::FindEventsDependencies(
+              eventsFunctions.GetEventsFunction(i).GetEvents(), dependencies);
+          if (!dependencies.externalLayouts.empty() ||
+              dependencies.hasUnknownExternalLayouts)
+            return true;
+        }
+        return false;
+      };
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    const auto &extension = project.GetEventsFunctionsExtension(e);
+    if (usesExternalLayouts(extension.GetEventsFunctions())) return;
+    const auto &behaviors = extension.GetEventsBasedBehaviors();
+    for (std::size_t i = 0; i < behaviors.GetCount(); i++) {
+      if (usesExternalLayouts(behaviors.Get(i).GetEventsFunctions())) return;
+    }
+    const auto &objects = extension.GetEventsBasedObjects();
+    for (std::size_t i = 0; i < objects.GetCount(); i++) {
+      if (usesExternalLayouts(objects.Get(i).GetEventsFunctions())) return;
+    }
+  }
+
+  // Find the scenes using each external layout.
+  DependenciesAnalyzer::LinksCache linksCache;
+  std::map<gd::String, std::vector<std::size_t>> externalLayoutsScenes;
+  for (std::size_t layoutIndex = 0; layoutIndex < project.GetLayoutsCount();
+       layoutIndex++) {
+    DependenciesAnalyzer analyzer(
+        project, project.GetLayout(layoutIndex), linksCache);
+    if (!analyzer.Analyze() ||
+        analyzer.HasUnknownExternalLayoutsDependencies())
+      return;
+    for (const gd::String &name : analyzer.GetExternalLayoutsDependencies())
+      externalLayoutsScenes[name].push_back(layoutIndex);
+  }
+
+  auto &layoutsElement = rootElement.GetChild("layouts");
+  auto &externalLayoutsElement = rootElement.GetChild("externalLayouts");
+  gd::SerializerElement sharedExternalLayoutsElement;
+  sharedExternalLayoutsElement.ConsiderAsArrayOf("externalLayout");
+  for (std::size_t i = 0; i < externalLayoutsElement.GetChildrenCount(); i++) {
+    auto &externalLayoutElement = externalLayoutsElement.GetChild(i);
+    auto it = externalLayoutsScenes.find(
+        externalLayoutElement.GetStringAttribute("name"));
+    if (it == externalLayoutsScenes.end() || it->second.size() != 1 ||
+        it->second[0] >= layoutsElement.GetChildrenCount()) {
+      sharedExternalLayoutsElement.AddChild("externalLayout") =
+          externalLayoutElement;
+      continue;
+    }
+
+    auto &layoutElement = layoutsElement.GetChild(it->second[0]);
+    if (!layoutElement.HasChild("externalLayouts"))
+      layoutElement.AddChild("externalLayouts")
+          .ConsiderAsArrayOf("externalLayout");
+    layoutElement.GetChild("externalLayouts").AddChild("externalLayout") =
+        externalLayoutElement;
+  }
+  externalLayoutsElement = sharedExternalLayoutsElement;
+}
+
 void ExporterHelper::SerializeUsedResources(
     gd::SerializerElement &rootElement,
     std::set<gd::String> &projectUsedResources,
@@ -823,6 +1078,8 @@ void ExporterHelper::AddLibsInclude(bool pixiRenderers,
   InsertUnique(includesFiles, "timemanager.js");
   InsertUnique(includesFiles, "polygon.js");
   InsertUnique(includesFiles, "runtimeobject.js");
+  InsertUnique(includesFiles, "ObjectsVisibilityIndex.js");
+  InsertUnique(includesFiles, "InstancesStreamer.js");
   InsertUnique(includesFiles, "profiler.js");
   InsertUnique(includesFiles, "RuntimeInstanceContainer.js");
   InsertUnique(includesFiles, "runtimescene.js");
@@ -963,27 +1220,120 @@ bool ExporterHelper::ExportEventsCode(
     gd::String outputDir,
     std::vector<gd::String> &includesFiles,
     gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport,
-    bool exportForPreview) {
+    bool exportForPreview,
+    bool compactCode,
+    bool eventsProfiling) {
+  gd::PerfScope perfScope("ExporterHelper::ExportEventsCode");
   fs.MkDir(outputDir);
 
-  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
-    std::set<gd::String> eventsIncludes;
-    const gd::Layout &layout = project.GetLayout(i);
+  // Everything lazily built when read must be built before the threads are
+  // started: the layouts (if the project was lazily unserialized), the lazy
+  // extensions, the metadata index and the name manglers.
+  const std::size_t layoutsCount = project.GetLayoutsCount();
+  std::vector<gd::DiagnosticReport *> diagnosticReports;
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    diagnosticReports.push_back(
+        &wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
+            project.GetLayout(i).GetName()));
+  }
+  JsPlatform::Get().PrepareForConcurrentUse();
+  gd::SceneNameMangler::Get();
+  EventsCodeNameMangler::Get();
+
+  std::uint64_t projectHash =
+      codeGenerationCache
+          ? LayoutCodeGenerationCache::ComputeProjectHash(
+                project, JsPlatform::Get(), !exportForPreview, compactCode,
+                eventsProfiling)
+          : 0;
+
+  // Each scene only reads the project, with its own code generator and
+  // diagnostic report. The cache is only read until all scenes are done.
+  std::vector<gd::String> eventsOutputs(layoutsCount);
+  std::vector<std::set<gd::String>> eventsIncludes(layoutsCount);
+  std::vector<std::uint64_t> layoutHashes(layoutsCount, 0);
+  std::vector<bool> isGenerated(layoutsCount, false);
+  std::vector<double> generationTimes(layoutsCount, 0);
+  // Each scene is reported in its own report, merged in the order of the
+  // scenes once all of them are generated.
+  std::vector<gd::CodeGenerationReport> sceneReports(
+      codeGenerationReport ? layoutsCount : 0);
+  gd::TasksRunner::Run(
+      layoutsCount, codeGenerationThreadsCount, [&](std::size_t i) {
+        double startTime = ExportMetrics::GetTimeNow();
+        const gd::Layout &layout = project.GetLayout(i);
+        if (codeGenerationCache) {
+          layoutHashes[i] = LayoutCodeGenerationCache::ComputeLayoutHash(
+              project, layout, projectHash);
+          const auto *entry =
+              codeGenerationReport
+                  ? nullptr
+                  : codeGenerationCache->Get(layout.GetName(), layoutHashes[i]);
+          if (entry) {
+            eventsOutputs[i] = entry->code;
+            eventsIncludes[i] = entry->includeFiles;
+            for (const auto &diagnostic : entry->diagnostics)
+              diagnosticReports[i]->Add(diagnostic);
+            return;
+          }
+        }
+
+        LayoutCodeGenerator layoutCodeGenerator(project);
+        layoutCodeGenerator.SetGenerateCompactCode(compactCode);
+        layoutCodeGenerator.SetGenerateEventsProfiling(eventsProfiling);
+        if (codeGenerationReport)
+          layoutCodeGenerator.SetCodeGenerationReport(&sceneReports[i]);
+        eventsOutputs[i] = layoutCodeGenerator.GenerateLayoutCompleteCode(
+            layout, eventsIncludes[i], *diagnosticReports[i], !exportForPreview);
+        isGenerated[i] = true;
+        generationTimes[i] = ExportMetrics::GetTimeNow() - startTime;
+      });
+  if (codeGenerationReport) {
+    codeGenerationReport->Clear();
+    for (const auto &sceneReport : sceneReports)
+      codeGenerationReport->Append(sceneReport);
+  }
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    metrics.AddScene(project.GetLayout(i).GetName(),
+                     generationTimes[i],
+                     eventsOutputs[i].Raw().size(),
+                     !isGenerated[i]);
+  }
+
+  if (codeGenerationCache) {
+    for (std::size_t i = 0; i < layoutsCount; ++i) {
+      if (!isGenerated[i]) continue;
+      codeGenerationCache->Store(project.GetLayout(i).GetName(),
+                                 layoutHashes[i],
+                                 eventsOutputs[i],
+                                 eventsIncludes[i],
+                                 *diagnosticReports[i]);
+    }
+  }
 
-    auto &diagnosticReport =
-        wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
-            layout.GetName());
-    LayoutCodeGenerator layoutCodeGenerator(project);
-    gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, diagnosticReport, !exportForPreview);
+  codeFilesHashes.clear();
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
     gd::String filename =
         outputDir + "/" + "code" + gd::String::From(i) + ".js";
 
-    // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
-      for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+    // Export the code, unless the file already contains it (in which case the
+    // hot-reloader won't reload it either).
+    bool isUpToDate = codeGenerationCache &&
+                      codeGenerationCache->IsCodeFileUpToDate(
+                          filename, layoutHashes[i]) &&
+                      fs.FileExists(filename);
+    if (!isUpToDate) metrics.AddBytesWritten(eventsOutputs[i].Raw().size());
+    if (isUpToDate || fs.WriteToFile(filename, eventsOutputs[i])) {
+      for (auto &include : eventsIncludes[i])
+        InsertUnique(includesFiles, include);
 
       InsertUnique(includesFiles, filename);
+      if (codeGenerationCache) {
+        codeGenerationCache->StoreCodeFile(filename, layoutHashes[i]);
+        if (layoutHashes[i] != 0)
+          codeFilesHashes[filename] = static_cast<int>(
+              (layoutHashes[i] ^ (layoutHashes[i] >> 32)) | 1);
+      }
     } else {
       lastError = _("Unable to write ") + filename;
       return false;
@@ -1047,11 +1397,13 @@ bool ExporterHelper::ExportIncludesAndLibs(
         if (!fs.DirExists(path)) fs.MkDir(path);
 
         fs.CopyFile(source, exportDir + "/" + include);
+        metrics.AddFilesCopied(1);
 
         gd::String sourceMap = source + ".map";
         // Copy source map if present
         if (exportSourceMaps && fs.FileExists(sourceMap)) {
           fs.CopyFile(sourceMap, exportDir + "/" + include + ".map");
+          metrics.AddFilesCopied(1);
         }
       } else {
         std::cout << "Could not find GDJS include file " << include
@@ -1062,6 +1414,7 @@ bool ExporterHelper::ExportIncludesAndLibs(
       // folder and fall in this case:
       if (fs.FileExists(include)) {
         fs.CopyFile(include, exportDir + "/" + fs.FileNameFrom(include));
+        metrics.AddFilesCopied(1);
       } else {
         std::cout << "Could not find include file " << include << std::endl;
       }
@@ -1071,11 +1424,53 @@ bool ExporterHelper::ExportIncludesAndLibs(
   return true;
 }
 
+bool ExporterHelper::ExportIncludesAndLibsAsBundle(
+    const std::vector<gd::String> &includesFiles,
+    gd::String exportDir,
+    const gd::String &bundleFilename) {
+  const gd::String bundleFile = exportDir + "/" + bundleFilename;
+  gd::String path = fs.DirNameFrom(bundleFile);
+  if (!fs.DirExists(path)) fs.MkDir(path);
+  if (!fs.OpenForWrite(bundleFile)) return false;
+
+  bool written = true;
+  for (auto &include : includesFiles) {
+    // Files are found like in ExportIncludesAndLibs.
+    gd::String source =
+        fs.IsAbsolute(include) ? include : gdjsRoot + "/Runtime/" + include;
+    if (!fs.FileExists(source)) {
+      std::cout << "Could not find include file " << include << std::endl;
+      continue;
+    }
+
+    gd::String content = fs.ReadFile(source);
+
+    // The source map of the file (declared at its end) would be wrongly
+    // applied to the bundle.
+    const size_t sourceMappingUrlPosition =
+        content.rfind("//# sourceMappingURL=");
+    if (sourceMappingUrlPosition != gd::String::npos) {
+      const size_t lineEnd = content.find("\n", sourceMappingUrlPosition);
+      if (lineEnd == gd::String::npos ||
+          content.find_first_not_of(" \t\r\n", lineEnd) == gd::String::npos)
+        content.erase(sourceMappingUrlPosition);
+    }
+
+    // Files are separated by a semicolon in case a file was not ending with
+    // one and the next file starts with a parenthesis.
+    written = fs.Append(bundleFile, content) &&
+              fs.Append(bundleFile, "\n;\n") && written;
+  }
+
+  return fs.Close(bundleFile) && written;
+}
+
 void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
                                      gd::Project &project,
-                                     gd::String exportDir) {
+                                     gd::String exportDir,
+                                     bool onlyNewOrChangedFiles) {
   gd::ProjectResourcesCopier::CopyAllResourcesTo(
-      project, fs, exportDir, true, false, false);
+      project, fs, exportDir, true, false, false, onlyNewOrChangedFiles);
 }
 
 void ExporterHelper::AddDeprecatedFontFilesToFontResources(
@@ -13,6 +13,7 @@
 
 #include "GDCore/IDE/CaptureOptions.h"
 #include "GDCore/String.h"
+#include "GDJS/IDE/ExportMetrics.h"
 namespace gd {
 class Project;
 class Layout;
@@ -24,7 +25,11 @@ class SourceFileMetadata;
 class WholeProjectDiagnosticReport;
 class CaptureOptions;
 class Screenshot;
+class CodeGenerationReport;
 }  // namespace gd
+namespace gdjs {
+class LayoutCodeGenerationCache;
+}
 
 namespace gdjs {
 
@@ -44,6 +49,7 @@ struct PreviewExportOptions {
         nativeMobileApp(false),
         projectDataOnlyExport(false),
         fullLoadingScreen(false),
+        incrementalResourcesExport(false),
         isDevelopmentEnvironment(false),
         nonRuntimeScriptsCacheBurst(0),
         inAppTutorialMessageInPreview(""),
@@ -173,6 +179,16 @@ struct PreviewExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the export directory should be kept from a preview to
+   * another, so that only the resources that are new or changed are copied
+   * (false by default, the directory is cleared).
+   */
+  PreviewExportOptions &SetIncrementalResourcesExport(bool enable) {
+    incrementalResourcesExport = enable;
+    return *this;
+  }
+
   /**
    * \brief Set if the export should consider to be in a development environment
    * of GDevelop (the game should use GDevelop development APIs).
@@ -305,6 +321,7 @@ struct PreviewExportOptions {
   std::map<gd::String, int> includeFileHashes;
   bool projectDataOnlyExport;
   bool fullLoadingScreen;
+  bool incrementalResourcesExport;
   bool isDevelopmentEnvironment;
   unsigned int nonRuntimeScriptsCacheBurst;
   gd::String electronRemoteRequirePath;
@@ -331,7 +348,13 @@ struct ExportOptions {
         exportPath(exportPath_),
         target(""),
         fallbackAuthorId(""),
-        fallbackAuthorUsername("") {};
+        fallbackAuthorUsername(""),
+        compactEventsCode(false),
+        eventsProfiling(false),
+        bundleScripts(false),
+        splitScenesData(false),
+        projectDataAsJsonString(false),
+        instancesChunkSize(0) {};
 
   /**
    * \brief Set the fallback author info (if info not present in project
@@ -355,11 +378,78 @@ struct ExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the code of the events must be generated without comments,
+   * to reduce the size of the code to load when the game starts.
+   */
+  ExportOptions &SetCompactEventsCode(bool enable) {
+    compactEventsCode = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the time spent in the groups of events must be measured in
+   * the exported game, to profile it on real devices. The measures are only
+   * done once a sampling rate is set in `gdjs.EventsSectionsTimings`.
+   */
+  ExportOptions &SetEventsProfiling(bool enable) {
+    eventsProfiling = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the scripts of the game (game engine, extensions, events
+   * code and project data) must be concatenated into a single file, so that
+   * they are loaded with a single request.
+   * Always done for the `cordova` and `electron` targets.
+   */
+  ExportOptions &SetBundleScripts(bool enable) {
+    bundleScripts = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the data of each scene must be exported in its own file,
+   * only loaded by the game with the resources of the scene, instead of
+   * being loaded with the rest of the project when the game starts.
+   */
+  ExportOptions &SetSplitScenesData(bool enable) {
+    splitScenesData = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the project data must be written as a JSON string, parsed
+   * when the game starts, instead of a JavaScript object. Browsers parse JSON
+   * faster, which reduces the startup time of big games.
+   */
+  ExportOptions &SetProjectDataAsJsonString(bool enable) {
+    projectDataAsJsonString = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set the size (in pixels) of the chunks of the scenes in which the
+   * initial instances are grouped, so that the game creates them only when
+   * their chunk is near the cameras and deletes them when it's far.
+   * 0 (the default) to create all the instances when scenes start.
+   */
+  ExportOptions &SetInstancesChunkSize(double size) {
+    instancesChunkSize = size;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String target;
   gd::String fallbackAuthorUsername;
   gd::String fallbackAuthorId;
+  bool compactEventsCode;
+  bool eventsProfiling;
+  bool bundleScripts;
+  bool splitScenesData;
+  bool projectDataAsJsonString;
+  double instancesChunkSize;
 };
 
 /**
@@ -379,14 +469,26 @@ class ExporterHelper {
   const gd::String &GetLastError() const { return lastError; };
 
   /**
-   * \brief Export a project to JSON
+   * \brief Export a project to JSON, stripped of the data only used by the
+   * editor (see gd::Project::SerializeForExportTo).
    *
    * \param fs The abstract file system to use to write the file
    * \param project The project to be exported.
    * \param filename The filename where export the project
    * \param runtimeGameOptions The content of the extra configuration to store
-   * in gdjs.runtimeGameOptions \return Empty string if everything is ok,
-   * description of the error otherwise.
+   * in gdjs.runtimeGameOptions
+   * \param scenesDataExportDir If not empty, the data of each scene is
+   * written in its own file ("scenes/sceneX.json") in this directory, and
+   * only the name of the scene and the resources it uses are kept in the
+   * project data. The external layouts only used by a scene are written with
+   * it (see MoveExternalLayoutsInScenes).
+   * \param projectDataAsJsonString If true, the project data is written as a
+   * JSON string parsed by the game instead of a JavaScript object.
+   * \param metrics If set, the bytes written are added to these metrics.
+   * \param instancesChunkSize If not 0, the initial instances of the scenes
+   * are grouped in chunks of this size (see SplitInstancesInChunks).
+   * \return Empty string if everything is ok, description of the error
+   * otherwise.
    */
   static gd::String ExportProjectData(
       gd::AbstractFileSystem &fs,
@@ -395,7 +497,42 @@ class ExporterHelper {
       const gd::SerializerElement &runtimeGameOptions,
       std::set<gd::String> &projectUsedResources,
       std::unordered_map<gd::String, std::set<gd::String>>
-          &layersUsedResources);
+          &layersUsedResources,
+      const gd::String &scenesDataExportDir = "",
+      bool projectDataAsJsonString = false,
+      ExportMetrics *metrics = nullptr,
+      double instancesChunkSize = 0);
+
+  /**
+   * \brief Move the initial instances of the serialized scenes in chunks
+   * ("instancesChunks"), using the cells of a
+   * gd::InitialInstancesSpatialIndex of \a chunkSize pixels. An instance is
+   * in the chunk where its top-left corner is. Instances covering too many
+   * chunks stay in "instances", to be created when the scene starts.
+   *
+   * \param project The project that was serialized.
+   * \param rootElement The serialized project.
+   * \param chunkSize The size of the chunks, in pixels.
+   */
+  static void SplitInstancesInChunks(gd::Project &project,
+                                     gd::SerializerElement &rootElement,
+                                     double chunkSize);
+
+  /**
+   * \brief Move the serialized external layouts only used by the events of
+   * one scene (and the events it links to) in this scene ("externalLayouts"),
+   * so that they are loaded with the data of the scene (see
+   * ExportProjectData).
+   *
+   * Nothing is moved if the names of some external layouts used by the
+   * events can't be known before the game runs, or if extensions use
+   * external layouts.
+   *
+   * \param project The project that was serialized.
+   * \param rootElement The serialized project.
+   */
+  static void MoveExternalLayoutsInScenes(gd::Project &project,
+                                          gd::SerializerElement &rootElement);
 
   /**
    * \brief Copy all the resources of the project to to the export directory,
@@ -404,12 +541,14 @@ class ExporterHelper {
    * \param fs The abstract file system to use
    * \param project The project with resources to be exported.
    * \param exportDir The directory where the preview must be created.
-   * \param progressDlg Optional wxProgressDialog which will be updated with the
-   * progress.
+   * \param onlyNewOrChangedFiles If true, only the resources that are new or
+   * changed since the previous export to the same directory are copied (see
+   * gd::ProjectResourcesCopier::CopyAllResourcesTo).
    */
   static void ExportResources(gd::AbstractFileSystem &fs,
                               gd::Project &project,
-                              gd::String exportDir);
+                              gd::String exportDir,
+                              bool onlyNewOrChangedFiles = false);
 
   /**
    * \brief Add libraries files to the list of includes.
@@ -444,6 +583,25 @@ class ExporterHelper {
                              gd::String exportDir,
                              bool exportSourceMaps);
 
+  /**
+   * \brief Concatenate all the specified files, in the same order, into a
+   * single file of the export directory. Relative files are read from
+   * "<GDJS root>/Runtime" directory.
+   *
+   * Source maps are not merged: this is meant for exports, which don't
+   * include them.
+   *
+   * \param includesFiles A vector with filenames to be concatenated.
+   * \param exportDir The directory where the bundle must be written.
+   * \param bundleFilename The name of the bundle, relative to the export
+   * directory.
+   * \return true if the bundle was written.
+   */
+  bool ExportIncludesAndLibsAsBundle(
+      const std::vector<gd::String> &includesFiles,
+      gd::String exportDir,
+      const gd::String &bundleFilename);
+
   /**
    * \brief Generate the events JS code, and save them to the export directory.
    *
@@ -452,13 +610,30 @@ class ExporterHelper {
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   *
+   * The code of the scenes can be generated by several threads (see
+   * SetCodeGenerationThreadsCount). Files and includes are then written in
+   * the order of the scenes, so that the output is the same as when the
+   * scenes are generated one after the other.
+   *
+   * \param compactCode Set this to true to generate the code without the
+   * comments explaining it.
+   * \param eventsProfiling Set this to true to measure the time spent in the
+   * groups of events (only for exports, not previews).
+   *
+   * When a cache is set (see SetCodeGenerationCache), the files already
+   * containing the code of their scene are not written again, and the hash of
+   * each file is given to the hot-reloader so that it only reloads the files
+   * that changed.
    */
   bool ExportEventsCode(
       const gd::Project &project,
       gd::String outputDir,
       std::vector<gd::String> &includesFiles,
       gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport,
-      bool exportForPreview);
+      bool exportForPreview,
+      bool compactCode = false,
+      bool eventsProfiling = false);
 
   /**
    * \brief Add the project effects include files.
@@ -597,6 +772,43 @@ class ExporterHelper {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Change the number of threads used by ExportEventsCode to generate
+   * the code of the scenes. 0 means as many as the hardware can run
+   * concurrently.
+   */
+  void SetCodeGenerationThreadsCount(std::size_t threadsCount) {
+    codeGenerationThreadsCount = threadsCount;
+  }
+
+  /**
+   * \brief Set the cache used by ExportEventsCode to reuse the code of the
+   * scenes that were not modified since the last export, or nullptr to
+   * always generate the code of all the scenes.
+   */
+  void SetCodeGenerationCache(LayoutCodeGenerationCache *cache) {
+    codeGenerationCache = cache;
+  }
+
+  /**
+   * \brief Set the report where ExportEventsCode records the size of the code
+   * generated for each scene and its groups of events, or nullptr to not
+   * record it (the default).
+   *
+   * The report is cleared at each export. When it's set, all the scenes are
+   * generated, even if their code is in the cache, so that the report is
+   * complete.
+   */
+  void SetCodeGenerationReport(gd::CodeGenerationReport *report) {
+    codeGenerationReport = report;
+  }
+
+  /**
+   * \brief Return the measures done during the last export (time spent in
+   * each stage and to generate the code of each scene, bytes written...).
+   */
+  const ExportMetrics &GetMetrics() const { return metrics; }
+
   static void AddDeprecatedFontFilesToFontResources(
       gd::AbstractFileSystem &fs,
       gd::ResourcesManager &resourcesManager,
@@ -610,8 +822,19 @@ class ExporterHelper {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::size_t codeGenerationThreadsCount;  ///< The number of threads used to
+                                           ///< generate the code of scenes.
+  LayoutCodeGenerationCache *codeGenerationCache;  ///< The cache of the code of
+                                                   ///< scenes, if any.
+  gd::CodeGenerationReport *codeGenerationReport;  ///< The report of the code
+                                                   ///< generated, if any.
+  ExportMetrics metrics;  ///< The measures done during the last export.
 
  private:
+  std::map<gd::String, int>
+      codeFilesHashes;  ///< The hashes of the code files written by the last
+                        ///< call to ExportEventsCode, if a cache is set.
+
   static void SerializeUsedResources(
       gd::SerializerElement &rootElement,
       std::set<gd::String> &projectUsedResources,
@@ -4,6 +4,15 @@
  * This project is released under the MIT License.
  */
 namespace gdjs {
+  /**
+   * A callback to run once an {@link AsyncTask} is finished.
+   * @see {@link AsyncTasksManager.addTask}
+   */
+  export type AsyncTaskCallback = (
+    runtimeScene: gdjs.RuntimeScene,
+    ...callbackArguments: any[]
+  ) => void;
+
   /**
    * This stores all asynchronous tasks waiting to be completed,
    * for a given scene.
@@ -15,33 +24,67 @@ namespace gdjs {
      */
     private tasksWithCallback = new Array<{
       asyncTask: AsyncTask;
-      callback: (runtimeScene: gdjs.RuntimeScene) => void;
+      callback: AsyncTaskCallback;
+      asyncObjectsList: gdjs.LongLivedObjectsList | null;
+      eventsFunctionContext: EventsFunctionContext | null;
     }>();
 
     /**
      * Run all pending asynchronous tasks.
      */
     processTasks(runtimeScene: RuntimeScene): void {
+      // Finished tasks are removed by moving the pending ones at the beginning
+      // of the array, to avoid a splice for each finished task.
+      // Callbacks can add new tasks: they are at the end and are kept.
+      let pendingTasksCount = 0;
       for (let i = 0; i < this.tasksWithCallback.length; i++) {
         const taskWithCallback = this.tasksWithCallback[i];
         if (taskWithCallback.asyncTask.update(runtimeScene)) {
           // The task has finished, run the callback and remove it.
-          taskWithCallback.callback(runtimeScene);
-          this.tasksWithCallback.splice(i--, 1);
+          if (taskWithCallback.eventsFunctionContext) {
+            taskWithCallback.callback(
+              runtimeScene,
+              taskWithCallback.eventsFunctionContext,
+              taskWithCallback.asyncObjectsList
+            );
+          } else {
+            taskWithCallback.callback(
+              runtimeScene,
+              taskWithCallback.asyncObjectsList
+            );
+          }
+        } else {
+          this.tasksWithCallback[pendingTasksCount] = taskWithCallback;
+          pendingTasksCount++;
         }
       }
+      this.tasksWithCallback.length = pendingTasksCount;
     }
 
     /**
      * Adds a task to be processed between frames and a callback for when it is done to the manager.
+     *
+     * The callback is called with the scene, then the events function context
+     * (if any) and the objects lists (if any). This is used by the events to
+     * give their callback directly, without creating a closure for each task.
+     *
      * @param asyncTask The {@link AsyncTask} to run.
      * @param callback The callback to execute once the task is finished.
+     * @param asyncObjectsList The objects lists to give to the callback.
+     * @param eventsFunctionContext The events function context to give to the callback.
      */
     addTask(
       asyncTask: AsyncTask,
-      callback: (runtimeScene: RuntimeScene) => void
+      callback: AsyncTaskCallback,
+      asyncObjectsList?: gdjs.LongLivedObjectsList | null,
+      eventsFunctionContext?: EventsFunctionContext | null
     ): void {
-      this.tasksWithCallback.push({ asyncTask, callback });
+      this.tasksWithCallback.push({
+        asyncTask,
+        callback,
+        asyncObjectsList: asyncObjectsList || null,
+        eventsFunctionContext: eventsFunctionContext || null,
+      });
     }
 
     /**
@@ -73,10 +116,15 @@ namespace gdjs {
     }
 
     update(runtimeScene: gdjs.RuntimeScene) {
+      let pendingTasksCount = 0;
       for (let i = 0; i < this.tasks.length; i++) {
         const task = this.tasks[i];
-        if (task.update(runtimeScene)) this.tasks.splice(i--, 1);
+        if (!task.update(runtimeScene)) {
+          this.tasks[pendingTasksCount] = task;
+          pendingTasksCount++;
+        }
       }
+      this.tasks.length = pendingTasksCount;
 
       return this.tasks.length === 0;
     }
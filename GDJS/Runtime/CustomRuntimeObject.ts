@@ -221,9 +221,11 @@ namespace gdjs {
       return true;
     }
 
-    getNetworkSyncData(): CustomObjectNetworkSyncDataType {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): CustomObjectNetworkSyncDataType {
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         ifx: this.isFlippedX(),
         ify: this.isFlippedY(),
       };
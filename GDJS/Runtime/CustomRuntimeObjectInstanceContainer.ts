@@ -4,6 +4,15 @@
  * This project is released under the MIT License.
  */
 namespace gdjs {
+  /**
+   * The data of the children of custom objects, for each custom object data
+   * and variant. It's shared by every instance to save memory.
+   */
+  const childrenObjectsDataCache = new WeakMap<
+    ObjectData,
+    WeakMap<EventsBasedObjectVariantData, ObjectData[]>
+  >();
+
   /**
    * The instance container of a custom object, containing instances of objects rendered on screen.
    *
@@ -74,34 +83,15 @@ namespace gdjs {
         this.onDeletedFromScene(this._parent);
       }
 
-      const isForcedToOverrideEventsBasedObjectChildrenConfiguration =
-        !eventsBasedObjectVariantData.name &&
-        eventsBasedObjectVariantData.instances.length == 0;
-
       this._setOriginalInnerArea(eventsBasedObjectVariantData);
 
       // Registering objects
-      for (
-        let i = 0, len = eventsBasedObjectVariantData.objects.length;
-        i < len;
-        ++i
-      ) {
-        const childObjectData = eventsBasedObjectVariantData.objects[i];
-        // The children configuration override only applies to the default variant.
-        if (
-          customObjectData.childrenContent &&
-          (!eventsBasedObjectVariantData.name ||
-            isForcedToOverrideEventsBasedObjectChildrenConfiguration)
-        ) {
-          this.registerObject({
-            ...childObjectData,
-            // The custom object overrides its events-based object configuration.
-            ...customObjectData.childrenContent[childObjectData.name],
-          });
-        } else {
-          // The custom object follows its events-based object configuration.
-          this.registerObject(childObjectData);
-        }
+      const childrenObjectsData = this._getChildrenObjectsData(
+        customObjectData,
+        eventsBasedObjectVariantData
+      );
+      for (let i = 0, len = childrenObjectsData.length; i < len; ++i) {
+        this.registerObject(childrenObjectsData[i]);
       }
 
       if (eventsBasedObjectVariantData.layers.length > 0) {
@@ -154,6 +144,58 @@ namespace gdjs {
       this._isLoaded = true;
     }
 
+    /**
+     * Return the data of the children objects, with the configuration
+     * overridden by the custom object if any.
+     * The data is built once and shared by every instance of the custom object
+     * (instead of each instance having its own copy), to save memory when a
+     * scene has a lot of instances of a custom object.
+     */
+    private _getChildrenObjectsData(
+      customObjectData: ObjectData & CustomObjectConfiguration,
+      eventsBasedObjectVariantData: EventsBasedObjectVariantData
+    ): ObjectData[] {
+      const isForcedToOverrideEventsBasedObjectChildrenConfiguration =
+        !eventsBasedObjectVariantData.name &&
+        eventsBasedObjectVariantData.instances.length == 0;
+      // The children configuration override only applies to the default variant.
+      if (
+        !customObjectData.childrenContent ||
+        (eventsBasedObjectVariantData.name &&
+          !isForcedToOverrideEventsBasedObjectChildrenConfiguration)
+      ) {
+        // The custom object follows its events-based object configuration.
+        return eventsBasedObjectVariantData.objects;
+      }
+
+      let childrenObjectsDataByVariant =
+        childrenObjectsDataCache.get(customObjectData);
+      if (!childrenObjectsDataByVariant) {
+        childrenObjectsDataByVariant = new WeakMap();
+        childrenObjectsDataCache.set(
+          customObjectData,
+          childrenObjectsDataByVariant
+        );
+      }
+      let childrenObjectsData = childrenObjectsDataByVariant.get(
+        eventsBasedObjectVariantData
+      );
+      if (!childrenObjectsData) {
+        childrenObjectsData = eventsBasedObjectVariantData.objects.map(
+          (childObjectData) => ({
+            ...childObjectData,
+            // The custom object overrides its events-based object configuration.
+            ...customObjectData.childrenContent[childObjectData.name],
+          })
+        );
+        childrenObjectsDataByVariant.set(
+          eventsBasedObjectVariantData,
+          childrenObjectsData
+        );
+      }
+      return childrenObjectsData;
+    }
+
     /**
      * Initialize `_initialInnerArea` if it doesn't exist.
      * `_initialInnerArea` is shared by every instance to save memory.
@@ -273,7 +315,12 @@ namespace gdjs {
           obj.update(this);
         }
         obj.updateTimers(elapsedTime);
-        obj.stepBehaviorsPreEvents(this);
+        if (!this.areBehaviorsSteppedByType()) {
+          obj.stepBehaviorsPreEvents(this);
+        }
+      }
+      if (this.areBehaviorsSteppedByType()) {
+        this._stepBehaviorsPreEventsByType();
       }
 
       // Some behaviors may have request objects to be deleted.
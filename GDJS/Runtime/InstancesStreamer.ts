@@ -0,0 +1,209 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2013-present Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+namespace gdjs {
+  /**
+   * A chunk of the initial instances of a scene, with the objects created
+   * from them while the chunk is near the cameras.
+   */
+  export class InstancesStreamerChunk {
+    data: InstancesChunkData;
+    /** The objects created from the instances, by index of instance. */
+    objects: Array<gdjs.RuntimeObject | null> = [];
+    /**
+     * The indexes of the instances whose objects were deleted by the game:
+     * they are not created again when the chunk is loaded again.
+     */
+    deletedInstanceIndexes: Set<integer> | null = null;
+    isLoaded: boolean = false;
+    isReleasing: boolean = false;
+
+    constructor(data: InstancesChunkData) {
+      this.data = data;
+    }
+  }
+
+  /**
+   * Create the initial instances of a scene exported with its instances
+   * grouped in chunks (see `ExportOptions::SetInstancesChunkSize`) only when
+   * their chunk is near the camera of a layer, and delete them when the
+   * chunk is far from the cameras.
+   *
+   * Objects deleted by the game are not created again, but the changes done
+   * to the other objects (position, variables...) are lost when their chunk
+   * is released.
+   */
+  export class InstancesStreamer {
+    private _instanceContainer: gdjs.RuntimeInstanceContainer;
+    private _chunkSize: float;
+    private _chunks = new Map<number, gdjs.InstancesStreamerChunk>();
+    private _loadedChunks: gdjs.InstancesStreamerChunk[] = [];
+
+    /**
+     * @param instanceContainer The container where the objects are created.
+     * @param chunkSize The size of the chunks, in pixels.
+     * @param chunksData The chunks of initial instances.
+     */
+    constructor(
+      instanceContainer: gdjs.RuntimeInstanceContainer,
+      chunkSize: float,
+      chunksData: InstancesChunkData[]
+    ) {
+      this._instanceContainer = instanceContainer;
+      this._chunkSize = chunkSize;
+      for (const chunkData of chunksData) {
+        this._chunks.set(
+          InstancesStreamer._getChunkKey(chunkData.x, chunkData.y),
+          new gdjs.InstancesStreamerChunk(chunkData)
+        );
+      }
+    }
+
+    private static _getChunkKey(chunkX: integer, chunkY: integer): number {
+      // Chunks coordinates are between -2^24 and 2^24 (see the GDCore
+      // spatial index), so the key is a safe integer.
+      return chunkX * 67108864 + chunkY;
+    }
+
+    /**
+     * Create the objects of the chunks near the cameras and delete the objects
+     * of the chunks that are now far from them.
+     *
+     * A chunk is released only when it's more than a chunk away from the
+     * cameras, so that objects at the limit are not created and deleted at
+     * each frame.
+     *
+     * @param layersCameraCoordinates The bounds of the cameras, by layer.
+     */
+    update(
+      layersCameraCoordinates: Record<string, [float, float, float, float]>
+    ): void {
+      const chunkSize = this._chunkSize;
+      for (const layerName in layersCameraCoordinates) {
+        const cameraCoords = layersCameraCoordinates[layerName];
+        const minChunkX = Math.floor(cameraCoords[0] / chunkSize);
+        const minChunkY = Math.floor(cameraCoords[1] / chunkSize);
+        const maxChunkX = Math.floor(cameraCoords[2] / chunkSize);
+        const maxChunkY = Math.floor(cameraCoords[3] / chunkSize);
+        const cameraChunksCount =
+          (maxChunkX - minChunkX + 1) * (maxChunkY - minChunkY + 1);
+        if (cameraChunksCount > this._chunks.size) {
+          // The camera is bigger than the chunks area: check the chunks
+          // rather than all the positions in the camera.
+          for (const chunk of this._chunks.values()) {
+            if (
+              !chunk.isLoaded &&
+              chunk.data.x >= minChunkX &&
+              chunk.data.x <= maxChunkX &&
+              chunk.data.y >= minChunkY &&
+              chunk.data.y <= maxChunkY
+            ) {
+              this._loadChunk(chunk);
+            }
+          }
+          continue;
+        }
+        for (let chunkX = minChunkX; chunkX <= maxChunkX; chunkX++) {
+          for (let chunkY = minChunkY; chunkY <= maxChunkY; chunkY++) {
+            const chunk = this._chunks.get(
+              InstancesStreamer._getChunkKey(chunkX, chunkY)
+            );
+            if (chunk && !chunk.isLoaded) {
+              this._loadChunk(chunk);
+            }
+          }
+        }
+      }
+
+      const loadedChunks = this._loadedChunks;
+      let loadedChunksCount = 0;
+      for (let i = 0, len = loadedChunks.length; i < len; i++) {
+        const chunk = loadedChunks[i];
+        if (this._isNearCameras(chunk, layersCameraCoordinates)) {
+          loadedChunks[loadedChunksCount++] = chunk;
+        } else {
+          this._releaseChunk(chunk);
+        }
+      }
+      loadedChunks.length = loadedChunksCount;
+    }
+
+    /**
+     * Return the number of chunks having their objects created.
+     */
+    getLoadedChunksCount(): integer {
+      return this._loadedChunks.length;
+    }
+
+    private _isNearCameras(
+      chunk: gdjs.InstancesStreamerChunk,
+      layersCameraCoordinates: Record<string, [float, float, float, float]>
+    ): boolean {
+      const chunkSize = this._chunkSize;
+      // Keep a margin of one chunk around the chunk.
+      const minX = (chunk.data.x - 1) * chunkSize;
+      const minY = (chunk.data.y - 1) * chunkSize;
+      const maxX = (chunk.data.x + 2) * chunkSize;
+      const maxY = (chunk.data.y + 2) * chunkSize;
+      for (const layerName in layersCameraCoordinates) {
+        const cameraCoords = layersCameraCoordinates[layerName];
+        if (
+          minX <= cameraCoords[2] &&
+          maxX >= cameraCoords[0] &&
+          minY <= cameraCoords[3] &&
+          maxY >= cameraCoords[1]
+        ) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    private _loadChunk(chunk: gdjs.InstancesStreamerChunk): void {
+      const instances = chunk.data.instances;
+      const deletedInstanceIndexes = chunk.deletedInstanceIndexes;
+      for (let index = 0; index < instances.length; index++) {
+        if (deletedInstanceIndexes && deletedInstanceIndexes.has(index)) {
+          chunk.objects.push(null);
+          continue;
+        }
+        const object = this._instanceContainer.createObjectFromInstance(
+          instances[index],
+          0,
+          0,
+          0,
+          /*trackByPersistentUuid=*/
+          true
+        );
+        chunk.objects.push(object);
+        if (object) {
+          object.registerDestroyCallback(() => {
+            chunk.objects[index] = null;
+            if (!chunk.isReleasing) {
+              // The object was deleted by the game.
+              chunk.deletedInstanceIndexes =
+                chunk.deletedInstanceIndexes || new Set<integer>();
+              chunk.deletedInstanceIndexes.add(index);
+            }
+          });
+        }
+      }
+      chunk.isLoaded = true;
+      this._loadedChunks.push(chunk);
+    }
+
+    private _releaseChunk(chunk: gdjs.InstancesStreamerChunk): void {
+      chunk.isReleasing = true;
+      for (const object of chunk.objects) {
+        if (object) {
+          object.deleteFromScene();
+        }
+      }
+      chunk.isReleasing = false;
+      chunk.objects.length = 0;
+      chunk.isLoaded = false;
+    }
+  }
+}
@@ -8,6 +8,37 @@ namespace gdjs {
 
   const resourceKinds: Array<ResourceKind> = ['model3D'];
 
+  const glbMagic = 0x46546c67; // "glTF" in little-endian.
+  const glbJsonChunkType = 0x4e4f534a; // "JSON" in little-endian.
+  const dracoExtensionName = 'KHR_draco_mesh_compression';
+
+  /**
+   * Check if a model file (GLB or glTF) has meshes compressed with Draco,
+   * by only reading its JSON part.
+   */
+  const isUsingDracoCompression = (data: ArrayBuffer): boolean => {
+    if (typeof TextDecoder === 'undefined') {
+      return false;
+    }
+    let json: Uint8Array;
+    const header = new DataView(data);
+    if (data.byteLength >= 20 && header.getUint32(0, true) === glbMagic) {
+      // The JSON chunk is always the first one of a GLB file.
+      const jsonChunkLength = header.getUint32(12, true);
+      if (header.getUint32(16, true) !== glbJsonChunkType) {
+        return false;
+      }
+      json = new Uint8Array(
+        data,
+        20,
+        Math.min(jsonChunkLength, data.byteLength - 20)
+      );
+    } else {
+      json = new Uint8Array(data);
+    }
+    return new TextDecoder().decode(json).includes(dracoExtensionName);
+  };
+
   /**
    * Load GLB files (using `Three.js`), using the "model3D" resources
    * registered in the game resources.
@@ -18,11 +49,14 @@ namespace gdjs {
      */
     private _loadedThreeModels = new gdjs.ResourceCache<THREE_ADDONS.GLTF>();
     private _downloadedArrayBuffers = new gdjs.ResourceCache<ArrayBuffer>();
+    /** The size of the files of the parsed models, in bytes. */
+    private _loadedThreeModelsFileSizes = new gdjs.ResourceCache<number>();
 
     _resourceLoader: gdjs.ResourceLoader;
 
     _loader: THREE_ADDONS.GLTFLoader | null = null;
     _dracoLoader: THREE_ADDONS.DRACOLoader | null = null;
+    private _isDracoDecoderPreloaded = false;
 
     //@ts-ignore Can only be null if THREE is not loaded.
     _invalidModel: THREE_ADDONS.GLTF;
@@ -88,6 +122,7 @@ namespace gdjs {
       try {
         const gltf: THREE_ADDONS.GLTF = await loader.parseAsync(data, '');
         this._loadedThreeModels.set(resource, gltf);
+        this._loadedThreeModelsFileSizes.set(resource, data.byteLength);
       } catch (error) {
         logger.error(
           "Can't fetch the 3D model file " + resource.file + ', error: ' + error
@@ -122,6 +157,7 @@ namespace gdjs {
         }
         const data = await response.arrayBuffer();
         this._downloadedArrayBuffers.set(resource, data);
+        this._preloadDracoDecoderIfNeeded(data);
       } catch (error) {
         logger.error(
           "Can't fetch the 3D model file " + resource.file + ', error: ' + error
@@ -129,6 +165,22 @@ namespace gdjs {
       }
     }
 
+    /**
+     * Start to load the Draco decoder (and its Web Workers) as soon as a model
+     * using it is downloaded, so that it's ready when models are parsed
+     * instead of stalling the parsing of the first model.
+     */
+    private _preloadDracoDecoderIfNeeded(data: ArrayBuffer): void {
+      if (this._isDracoDecoderPreloaded || !this._dracoLoader) {
+        return;
+      }
+      if (!isUsingDracoCompression(data)) {
+        return;
+      }
+      this._isDracoDecoderPreloaded = true;
+      this._dracoLoader.preload();
+    }
+
     /**
      * Return a 3D model.
      *
@@ -150,6 +202,7 @@ namespace gdjs {
     dispose(): void {
       this._loadedThreeModels.clear();
       this._downloadedArrayBuffers.clear();
+      this._loadedThreeModelsFileSizes.clear();
       this._loader = null;
       this._dracoLoader = null;
 
@@ -177,6 +230,7 @@ namespace gdjs {
         if (loadedThreeModel) {
           loadedThreeModel.scene.clear();
           this._loadedThreeModels.delete(resourceData);
+          this._loadedThreeModelsFileSizes.delete(resourceData);
         }
 
         const downloadedArrayBuffer =
@@ -186,5 +240,21 @@ namespace gdjs {
         }
       });
     }
+
+    /**
+     * Return an estimation of the memory used by the specified model (the
+     * size of its file), or 0 if it's not loaded.
+     *
+     * @param resource The resource of the model
+     */
+    getResourceMemorySize(resource: ResourceData): number {
+      const downloadedArrayBuffer = this._downloadedArrayBuffers.getFromName(
+        resource.name
+      );
+      if (downloadedArrayBuffer) {
+        return downloadedArrayBuffer.byteLength;
+      }
+      return this._loadedThreeModelsFileSizes.getFromName(resource.name) || 0;
+    }
   }
 }
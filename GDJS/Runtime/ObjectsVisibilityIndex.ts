@@ -0,0 +1,301 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2013-present Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+namespace gdjs {
+  declare var rbush: any;
+
+  /**
+   * An object of the scene in a {@link gdjs.ObjectsVisibilityIndex}, with the
+   * bounds of its visibility AABB when it was inserted in the RBush of its
+   * layer.
+   */
+  export class ObjectVisibilityIndexItem {
+    minX: float = 0;
+    minY: float = 0;
+    maxX: float = 0;
+    maxY: float = 0;
+    object: gdjs.RuntimeObject;
+    /** The layer of the RBush the item is in, or `null` if not in a RBush. */
+    indexedLayer: string | null = null;
+    /** True if the object is checked at each frame, not in a RBush. */
+    isDynamic: boolean = false;
+    isDirty: boolean = false;
+    isRemoved: boolean = false;
+    lastMoveFrame: integer = -2;
+    lastSearchId: integer = -1;
+    private _index: gdjs.ObjectsVisibilityIndex;
+
+    constructor(
+      object: gdjs.RuntimeObject,
+      index: gdjs.ObjectsVisibilityIndex
+    ) {
+      this.object = object;
+      this._index = index;
+    }
+
+    /**
+     * Signal that the position, the size or the layer of the object
+     * changed. Called by {@link gdjs.RuntimeObject.invalidateHitboxes}.
+     */
+    invalidate(): void {
+      if (this.isDirty || this.isRemoved) {
+        return;
+      }
+      this.isDirty = true;
+      this._index._addDirtyItem(this);
+    }
+  }
+
+  /**
+   * Find the objects of a scene that are near the cameras of their layers,
+   * without iterating over all the instances at each frame.
+   *
+   * Objects that don't move are kept in a RBush per layer, using their
+   * visibility AABB. Objects that moved during the last frames (or having no
+   * renderer object or no visibility AABB) are "dynamic": they are checked at
+   * each frame by the scene, like before the index existed.
+   *
+   * @see gdjs.RuntimeScene._updateObjectsPreRender
+   */
+  export class ObjectsVisibilityIndex {
+    /**
+     * The number of frames an object must not move (after having moved during
+     * two consecutive frames) to be put back in the RBush of its layer.
+     */
+    static staticFramesCount: integer = 30;
+
+    private _layersRBushes: Record<string, any> = {};
+    private _dirtyItems: gdjs.ObjectVisibilityIndexItem[] = [];
+    private _dynamicItems: gdjs.ObjectVisibilityIndexItem[] = [];
+    /** Items near the cameras at the last search, or just inserted. */
+    private _itemsToHide: gdjs.ObjectVisibilityIndexItem[] = [];
+    private _itemsNearCameras: gdjs.ObjectVisibilityIndexItem[] = [];
+    private _objectsNearCameras: gdjs.RuntimeObject[] = [];
+    private _dynamicObjects: gdjs.RuntimeObject[] = [];
+    private _searchBox = { minX: 0, minY: 0, maxX: 0, maxY: 0 };
+    private _frame: integer = 0;
+    private _searchId: integer = 0;
+
+    /**
+     * Start tracking an object added to the scene.
+     */
+    addObject(object: gdjs.RuntimeObject): void {
+      if (object._visibilityIndexItem) {
+        return;
+      }
+      const item = new gdjs.ObjectVisibilityIndexItem(object, this);
+      object._visibilityIndexItem = item;
+      item.invalidate();
+    }
+
+    /**
+     * Stop tracking an object removed from the scene.
+     */
+    removeObject(object: gdjs.RuntimeObject): void {
+      const item = object._visibilityIndexItem;
+      if (!item) {
+        return;
+      }
+      this._removeFromRBush(item);
+      item.isRemoved = true;
+      object._visibilityIndexItem = null;
+    }
+
+    /**
+     * Update the RBushes with the objects that moved since the last call and
+     * find the objects near the cameras.
+     *
+     * @param layersCameraCoordinates The bounds of the cameras, by layer.
+     */
+    update(
+      layersCameraCoordinates: Record<string, [float, float, float, float]>
+    ): void {
+      this._frame++;
+
+      const dirtyItems = this._dirtyItems;
+      for (let i = 0; i < dirtyItems.length; i++) {
+        const item = dirtyItems[i];
+        if (item.isRemoved) {
+          continue;
+        }
+        item.isDirty = false;
+        if (item.isDynamic) {
+          item.lastMoveFrame = this._frame;
+          continue;
+        }
+        // Objects moving at each frame (bullets, players...) are not
+        // updated in the RBushes as it would be slower than checking them.
+        const hasMovedDuringLastFrame = item.lastMoveFrame >= this._frame - 1;
+        item.lastMoveFrame = this._frame;
+        this._removeFromRBush(item);
+        if (
+          hasMovedDuringLastFrame ||
+          !this._insertInRBush(item, layersCameraCoordinates)
+        ) {
+          item.isDynamic = true;
+          this._dynamicItems.push(item);
+        }
+      }
+      dirtyItems.length = 0;
+
+      const dynamicItems = this._dynamicItems;
+      const dynamicObjects = this._dynamicObjects;
+      dynamicObjects.length = 0;
+      let dynamicItemsCount = 0;
+      for (let i = 0, len = dynamicItems.length; i < len; i++) {
+        const item = dynamicItems[i];
+        if (item.isRemoved) {
+          continue;
+        }
+        if (
+          this._frame - item.lastMoveFrame >=
+          ObjectsVisibilityIndex.staticFramesCount
+        ) {
+          item.isDynamic = false;
+          if (this._insertInRBush(item, layersCameraCoordinates)) {
+            continue;
+          }
+          // The object can't be indexed (yet): try again later.
+          item.isDynamic = true;
+          item.lastMoveFrame = this._frame;
+        }
+        dynamicItems[dynamicItemsCount++] = item;
+        dynamicObjects.push(item.object);
+      }
+      dynamicItems.length = dynamicItemsCount;
+
+      this._searchNearCameras(layersCameraCoordinates);
+    }
+
+    /**
+     * Return the objects of the RBushes that are near the cameras of their
+     * layers, as found by the last `update`.
+     */
+    getObjectsNearCameras(): gdjs.RuntimeObject[] {
+      return this._objectsNearCameras;
+    }
+
+    /**
+     * Return the objects that must be checked at each frame, as found by the
+     * last `update`.
+     */
+    getDynamicObjects(): gdjs.RuntimeObject[] {
+      return this._dynamicObjects;
+    }
+
+    /**
+     * Hide the renderer objects of the objects that were near the cameras at
+     * the previous frame (or just inserted in a RBush) but aren't anymore.
+     */
+    hideObjectsNotNearCameras(): void {
+      const itemsToHide = this._itemsToHide;
+      for (let i = 0, len = itemsToHide.length; i < len; i++) {
+        const item = itemsToHide[i];
+        if (
+          item.lastSearchId === this._searchId ||
+          item.isRemoved ||
+          item.isDynamic
+        ) {
+          continue;
+        }
+        const rendererObject = item.object.getRendererObject();
+        if (rendererObject) {
+          rendererObject.visible = false;
+        }
+      }
+      // The items near the cameras are the ones to hide at the next frame
+      // if they are not near the cameras anymore.
+      this._itemsToHide = this._itemsNearCameras;
+      this._itemsNearCameras = itemsToHide;
+      this._itemsNearCameras.length = 0;
+    }
+
+    /**
+     * Remove all the objects.
+     */
+    clear(): void {
+      this._layersRBushes = {};
+      this._dirtyItems.length = 0;
+      this._dynamicItems.length = 0;
+      this._itemsToHide.length = 0;
+      this._itemsNearCameras.length = 0;
+      this._objectsNearCameras.length = 0;
+      this._dynamicObjects.length = 0;
+    }
+
+    /** @internal */
+    _addDirtyItem(item: gdjs.ObjectVisibilityIndexItem): void {
+      this._dirtyItems.push(item);
+    }
+
+    private _insertInRBush(
+      item: gdjs.ObjectVisibilityIndexItem,
+      layersCameraCoordinates: Record<string, [float, float, float, float]>
+    ): boolean {
+      const object = item.object;
+      const layer = object.getLayer();
+      if (!object.getRendererObject() || !layersCameraCoordinates[layer]) {
+        return false;
+      }
+      const aabb = object.getVisibilityAABB();
+      if (!aabb) {
+        return false;
+      }
+      item.minX = aabb.min[0];
+      item.minY = aabb.min[1];
+      item.maxX = aabb.max[0];
+      item.maxY = aabb.max[1];
+      let layerRBush = this._layersRBushes[layer];
+      if (!layerRBush) {
+        layerRBush = this._layersRBushes[layer] = new rbush();
+      }
+      layerRBush.insert(item);
+      item.indexedLayer = layer;
+      // Hide the object at the next search if it's not near the cameras.
+      this._itemsToHide.push(item);
+      return true;
+    }
+
+    private _removeFromRBush(item: gdjs.ObjectVisibilityIndexItem): void {
+      if (item.indexedLayer === null) {
+        return;
+      }
+      const layerRBush = this._layersRBushes[item.indexedLayer];
+      if (layerRBush) {
+        layerRBush.remove(item);
+      }
+      item.indexedLayer = null;
+    }
+
+    private _searchNearCameras(
+      layersCameraCoordinates: Record<string, [float, float, float, float]>
+    ): void {
+      this._searchId++;
+      const objectsNearCameras = this._objectsNearCameras;
+      const itemsNearCameras = this._itemsNearCameras;
+      objectsNearCameras.length = 0;
+      const searchBox = this._searchBox;
+      for (const layer in this._layersRBushes) {
+        const cameraCoords = layersCameraCoordinates[layer];
+        if (!cameraCoords) {
+          continue;
+        }
+        searchBox.minX = cameraCoords[0];
+        searchBox.minY = cameraCoords[1];
+        searchBox.maxX = cameraCoords[2];
+        searchBox.maxY = cameraCoords[3];
+        const items: gdjs.ObjectVisibilityIndexItem[] = this._layersRBushes[
+          layer
+        ].search(searchBox);
+        for (let i = 0, len = items.length; i < len; i++) {
+          const item = items[i];
+          item.lastSearchId = this._searchId;
+          itemsNearCameras.push(item);
+          objectsNearCameras.push(item.object);
+        }
+      }
+    }
+  }
+}
@@ -28,6 +28,22 @@ namespace gdjs {
     );
   };
 
+  /**
+   * The time spent to load a resource, in milliseconds.
+   * @see gdjs.ResourceLoader.getResourcesLoadingTimings
+   */
+  export type ResourceLoadingTimings = {
+    /** The time spent to download the resource, or 0 if not downloaded yet. */
+    loadingTime: float;
+    /** The time spent to process (parse, decode...) the resource, or 0 if not processed yet. */
+    processingTime: float;
+  };
+
+  const getTimeNow =
+    typeof performance !== 'undefined' && typeof performance.now === 'function'
+      ? () => performance.now()
+      : () => Date.now();
+
   const maxForegroundConcurrency = 20;
   const maxBackgroundConcurrency = 5;
   const maxAttempt = 3;
@@ -104,6 +120,8 @@ namespace gdjs {
       {
         resourceNames: Array<string>;
         status: 'not-loaded' | 'loaded' | 'ready';
+        /** The file containing the data of the scene, until it's loaded. */
+        dataFile: string | null;
       }
     > = new Map();
     /**
@@ -140,6 +158,27 @@ namespace gdjs {
      * or music streaming or online multiplayer).
      */
     private _isLoadingInForeground = true;
+    /**
+     * The maximum estimated memory (in bytes) of the loaded resources before
+     * resources of the scenes that were exited are unloaded, or 0 to unload
+     * them as soon as the scenes are exited.
+     * @see setResourcesMemoryBudget
+     */
+    private _resourcesMemoryBudget: integer = 0;
+    /**
+     * The scenes that were exited but whose resources are kept loaded
+     * because of the memory budget, from the least recently used one.
+     */
+    private _unusedSceneNames = new Set<string>();
+    /**
+     * The time spent to download and to process each resource, indexed by
+     * resource name. Only the first loading is measured (the resource managers
+     * don't load again a resource already loaded), until the resource is unloaded.
+     */
+    private _resourcesLoadingTimings = new Map<
+      string,
+      ResourceLoadingTimings
+    >();
 
     /**
      * @param runtimeGame The game.
@@ -229,6 +268,7 @@ namespace gdjs {
             (resource) => resource.name
           ),
           status: 'not-loaded',
+          dataFile: layoutData.dataFile || null,
         });
       }
       // TODO Clearing the queue doesn't abort the running task, but it should
@@ -276,6 +316,9 @@ namespace gdjs {
           onProgress(loadedCount, this._resources.size);
         }
       );
+      for (const sceneName of this._sceneLoadingStates.keys()) {
+        await this._loadSceneData(sceneName);
+      }
 
       for (const sceneLoadingState of this._sceneLoadingStates.values()) {
         sceneLoadingState.status = 'ready';
@@ -318,6 +361,7 @@ namespace gdjs {
           onProgress(loadedCount, resourceNames.length);
         }
       );
+      await this._loadSceneData(firstSceneName);
 
       firstSceneState.status = 'ready';
     }
@@ -403,9 +447,59 @@ namespace gdjs {
             (await onProgress(loadedCount, sceneState.resourceNames.length));
         }
       );
+      await this._loadSceneData(sceneName);
       sceneState.status = 'loaded';
     }
 
+    /**
+     * Load the data of a scene that was exported in its own file, and give it
+     * to the game. Scenes with data already loaded are skipped.
+     */
+    private async _loadSceneData(sceneName: string): Promise<void> {
+      const sceneState = this._sceneLoadingStates.get(sceneName);
+      if (!sceneState || !sceneState.dataFile) return;
+
+      const dataFile = sceneState.dataFile;
+      const output = await processAndRetryIfNeededWithPromisePool(
+        [dataFile],
+        1,
+        maxAttempt,
+        (file) =>
+          new Promise<LayoutData>((resolve, reject) => {
+            const xhr = new XMLHttpRequest();
+            xhr.responseType = 'json';
+            xhr.withCredentials = this.checkIfCredentialsRequired(file);
+            xhr.open('GET', this.getFullUrl(file));
+            xhr.onload = () => {
+              if (xhr.status !== 200) {
+                reject(
+                  new Error(
+                    'HTTP error: ' + xhr.status + '(' + xhr.statusText + ')'
+                  )
+                );
+                return;
+              }
+              resolve(xhr.response);
+            };
+            xhr.onerror = () => reject(new Error('Network error'));
+            xhr.send();
+          })
+      );
+      if (output.results.length === 0) {
+        logger.error(
+          'Unable to load the data of scene "' +
+            sceneName +
+            '" from "' +
+            dataFile +
+            '".'
+        );
+        return;
+      }
+
+      sceneState.dataFile = null;
+      this._runtimeGame.setSceneData(output.results[0]);
+    }
+
     private async _loadResource(resource: ResourceData): Promise<void> {
       const resourceManager = this._resourceManagersMap.get(resource.kind);
       if (!resourceManager) {
@@ -418,7 +512,34 @@ namespace gdjs {
         );
         return;
       }
+      const timings = this._getOrCreateResourceLoadingTimings(resource.name);
+      if (timings.loadingTime > 0) {
+        await resourceManager.loadResource(resource.name);
+        return;
+      }
+      const startTime = getTimeNow();
       await resourceManager.loadResource(resource.name);
+      timings.loadingTime = getTimeNow() - startTime;
+    }
+
+    private _getOrCreateResourceLoadingTimings(
+      resourceName: string
+    ): ResourceLoadingTimings {
+      let timings = this._resourcesLoadingTimings.get(resourceName);
+      if (!timings) {
+        timings = { loadingTime: 0, processingTime: 0 };
+        this._resourcesLoadingTimings.set(resourceName, timings);
+      }
+      return timings;
+    }
+
+    /**
+     * Return the time spent to download and to process each loaded resource,
+     * indexed by resource name. Useful to profile the loading of a game
+     * (for instance, what delays the first frame).
+     */
+    getResourcesLoadingTimings(): ReadonlyMap<string, ResourceLoadingTimings> {
+      return this._resourcesLoadingTimings;
     }
 
     /**
@@ -430,6 +551,7 @@ namespace gdjs {
       sceneName: string,
       onProgress?: (count: number, total: number) => Promise<void>
     ): Promise<void> {
+      this._unusedSceneNames.delete(sceneName);
       if (this.areSceneAssetsReady(sceneName)) {
         return;
       }
@@ -456,6 +578,7 @@ namespace gdjs {
           (await onProgress(parsedCount, sceneState.resourceNames.length));
       }
       sceneState.status = 'ready';
+      this._unloadUnusedScenesResourcesOverBudget(sceneName);
     }
 
     /**
@@ -515,6 +638,102 @@ namespace gdjs {
       newSceneName: string | null;
     }): void {
       if (!unloadedSceneName) return;
+      if (newSceneName) {
+        this._unusedSceneNames.delete(newSceneName);
+      }
+
+      if (this._resourcesMemoryBudget > 0) {
+        // Keep the resources in case the scene is used again: they are only
+        // unloaded when the loaded resources don't fit in the budget anymore.
+        this._unusedSceneNames.delete(unloadedSceneName);
+        this._unusedSceneNames.add(unloadedSceneName);
+        this._unloadUnusedScenesResourcesOverBudget(newSceneName);
+        return;
+      }
+      this._unloadSceneResources({ unloadedSceneName, newSceneName });
+    }
+
+    /**
+     * Set the maximum estimated memory (in bytes) of the loaded resources.
+     *
+     * When set, the resources of the exited scenes are kept until this budget
+     * is exceeded, so that going back to a recent scene doesn't need to load
+     * them again. The resources of the least recently used scenes are then
+     * unloaded first. Resources used by another loaded scene are never
+     * unloaded.
+     *
+     * @param budget The budget in bytes, or 0 to unload resources as soon as
+     * their scene is exited.
+     */
+    setResourcesMemoryBudget(budget: integer): void {
+      this._resourcesMemoryBudget = Math.max(0, budget);
+      if (this._resourcesMemoryBudget === 0) {
+        for (const unloadedSceneName of this._unusedSceneNames) {
+          this._unloadSceneResources({ unloadedSceneName, newSceneName: null });
+        }
+        this._unusedSceneNames.clear();
+      } else {
+        this._unloadUnusedScenesResourcesOverBudget(null);
+      }
+    }
+
+    /**
+     * @returns the maximum estimated memory (in bytes) of the loaded
+     * resources, or 0 if resources are unloaded at scene exit.
+     */
+    getResourcesMemoryBudget(): integer {
+      return this._resourcesMemoryBudget;
+    }
+
+    /**
+     * Mark a scene as used, so that its resources are not unloaded because
+     * of the memory budget. To be called when a scene is started.
+     */
+    markSceneAsUsed(sceneName: string): void {
+      this._unusedSceneNames.delete(sceneName);
+    }
+
+    /**
+     * @returns an estimation of the memory (in bytes) used by the loaded
+     * resources, for the managers that can give it.
+     */
+    getLoadedResourcesMemorySize(): integer {
+      let memorySize = 0;
+      for (const resource of this._resources.values()) {
+        const resourceManager = this._resourceManagersMap.get(resource.kind);
+        if (resourceManager && resourceManager.getResourceMemorySize) {
+          memorySize += resourceManager.getResourceMemorySize(resource);
+        }
+      }
+      return memorySize;
+    }
+
+    /**
+     * Unload the resources of the least recently used scenes until the
+     * loaded resources fit in the memory budget.
+     */
+    private _unloadUnusedScenesResourcesOverBudget(
+      newSceneName: string | null
+    ): void {
+      if (this._resourcesMemoryBudget <= 0) return;
+
+      let memorySize = this.getLoadedResourcesMemorySize();
+      for (const unloadedSceneName of this._unusedSceneNames) {
+        if (memorySize <= this._resourcesMemoryBudget) break;
+
+        this._unusedSceneNames.delete(unloadedSceneName);
+        this._unloadSceneResources({ unloadedSceneName, newSceneName });
+        memorySize = this.getLoadedResourcesMemorySize();
+      }
+    }
+
+    private _unloadSceneResources({
+      unloadedSceneName,
+      newSceneName,
+    }: {
+      unloadedSceneName: string;
+      newSceneName: string | null;
+    }): void {
       debugLogger.log(
         `Unloading of resources for scene ${unloadedSceneName} was requested.`
       );
@@ -535,6 +754,9 @@ namespace gdjs {
             resources.map((resource) => resource.name).join(', ')
           );
           resourceManager.unloadResourcesList(resources);
+          for (const resource of resources) {
+            this._resourcesLoadingTimings.delete(resource.name);
+          }
         }
       }
 
@@ -556,6 +778,7 @@ namespace gdjs {
      * this scene will be the next to be loaded.
      */
     private _prioritizeScene(sceneName: string): SceneLoadingTask | null {
+      this._unusedSceneNames.delete(sceneName);
       const sceneState = this._sceneLoadingStates.get(sceneName);
       if (!sceneState) return null;
       if (sceneState.status === 'loaded' || sceneState.status === 'ready') {
@@ -606,7 +829,14 @@ namespace gdjs {
         );
         return;
       }
+      const timings = this._getOrCreateResourceLoadingTimings(resource.name);
+      if (timings.processingTime > 0) {
+        await resourceManager.processResource(resource.name);
+        return;
+      }
+      const startTime = getTimeNow();
       await resourceManager.processResource(resource.name);
+      timings.processingTime = getTimeNow() - startTime;
     }
 
     getSceneLoadingProgress(sceneName: string): float {
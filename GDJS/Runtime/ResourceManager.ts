@@ -45,5 +45,16 @@ namespace gdjs {
      * @param resourcesList The list of specific resources that need to be clear
      */
     unloadResourcesList(resourcesList: ResourceData[]): void;
+
+    /**
+     * Return an estimation of the memory used by the specified resource, in
+     * bytes, or 0 if it's not loaded.
+     *
+     * Managers that don't implement it are not taken into account for the
+     * resources memory budget.
+     *
+     * @see gdjs.ResourceLoader.setResourcesMemoryBudget
+     */
+    getResourceMemorySize?(resource: ResourceData): number;
   }
 }
@@ -22,9 +22,27 @@ namespace gdjs {
     private _allInstancesList: gdjs.RuntimeObject[] = [];
     _allInstancesListIsUpToDate = true;
 
+    /**
+     * True if behaviors are stepped grouped by type.
+     * @see gdjs.RuntimeInstanceContainer#setBehaviorsSteppedByType
+     */
+    private _behaviorsSteppedByType: boolean = false;
+    /**
+     * The behaviors of all the instances grouped by type, or `null` if they
+     * must be grouped again.
+     */
+    private _behaviorsGroups: gdjs.RuntimeInstanceContainer.BehaviorsGroup[] | null =
+      null;
+
     /** Used to recycle destroyed instance instead of creating new ones. */
     _instancesCache: Hashtable<RuntimeObject[]>;
 
+    /**
+     * The maximum number of destroyed instances kept in the cache, for each
+     * object not giving its own `instancesPoolSize`.
+     */
+    static defaultInstancesPoolSize = 128;
+
     /** The instances removed from the container and waiting to be sent to the cache. */
     _instancesRemoved: gdjs.RuntimeObject[] = [];
 
@@ -330,33 +348,59 @@ namespace gdjs {
       }
 
       for (let i = 0, len = data.length; i < len; ++i) {
-        const instanceData = data[i];
-        const objectName = instanceData.name;
-        const newObject = this.createObject(objectName);
-        if (newObject !== null) {
-          if (shouldTrackByPersistentUuid) {
-            // Give the object the same persistentUuid as the instance, so that
-            // it can be hot-reloaded.
-            newObject.persistentUuid = instanceData.persistentUuid || null;
-          }
-          newObject.setPosition(instanceData.x + xPos, instanceData.y + yPos);
-          newObject.setAngle(instanceData.angle);
-          if (gdjs.Base3DHandler && gdjs.Base3DHandler.is3D(newObject)) {
-            newObject.setZ((instanceData.z || 0) + zOffset);
-            if (instanceData.rotationX !== undefined)
-              newObject.setRotationX(instanceData.rotationX);
-            if (instanceData.rotationY !== undefined)
-              newObject.setRotationY(instanceData.rotationY);
-          }
+        this.createObjectFromInstance(
+          data[i],
+          xPos,
+          yPos,
+          zOffset,
+          shouldTrackByPersistentUuid
+        );
+      }
+    }
 
-          newObject.setZOrder(instanceData.zOrder);
-          newObject.setLayer(instanceData.layer);
-          newObject
-            .getVariables()
-            .initFrom(instanceData.initialVariables, true);
-          newObject.extraInitializationFromInitialInstance(instanceData);
-        }
+    /**
+     * Create an object from an initial instance data.
+     *
+     * @param instanceData The instance data
+     * @param xPos The offset on X axis
+     * @param yPos The offset on Y axis
+     * @param zOffset The offset on Z axis
+     * @param trackByPersistentUuid If true, the object is tracked by setting its `persistentUuid`
+     * to the same as the instance.
+     * @returns The new object, or null if the object of the instance doesn't exist.
+     * @see gdjs.RuntimeInstanceContainer#createObjectsFrom
+     */
+    createObjectFromInstance(
+      instanceData: InstanceData,
+      xPos: float,
+      yPos: float,
+      zOffset: float,
+      trackByPersistentUuid: boolean
+    ): gdjs.RuntimeObject | null {
+      const newObject = this.createObject(instanceData.name);
+      if (newObject === null) {
+        return null;
+      }
+      if (trackByPersistentUuid) {
+        // Give the object the same persistentUuid as the instance, so that
+        // it can be hot-reloaded.
+        newObject.persistentUuid = instanceData.persistentUuid || null;
       }
+      newObject.setPosition(instanceData.x + xPos, instanceData.y + yPos);
+      newObject.setAngle(instanceData.angle);
+      if (gdjs.Base3DHandler && gdjs.Base3DHandler.is3D(newObject)) {
+        newObject.setZ((instanceData.z || 0) + zOffset);
+        if (instanceData.rotationX !== undefined)
+          newObject.setRotationX(instanceData.rotationX);
+        if (instanceData.rotationY !== undefined)
+          newObject.setRotationY(instanceData.rotationY);
+      }
+
+      newObject.setZOrder(instanceData.zOrder);
+      newObject.setLayer(instanceData.layer);
+      newObject.getVariables().initFrom(instanceData.initialVariables, true);
+      newObject.extraInitializationFromInitialInstance(instanceData);
+      return newObject;
     }
 
     /**
@@ -492,7 +536,11 @@ namespace gdjs {
         // If the object does not support recycling, the cache won't be defined.
         const cache = this._instancesCache.get(instance.getName());
         if (cache) {
-          if (cache.length < 128) {
+          const objectData = this._objects.get(instance.getName());
+          const maxCacheSize =
+            (objectData && objectData.instancesPoolSize) ||
+            RuntimeInstanceContainer.defaultInstancesPoolSize;
+          if (cache.length < maxCacheSize) {
             cache.push(instance);
           }
         }
@@ -522,6 +570,131 @@ namespace gdjs {
       }
       this._allInstancesList.length = currentListSize;
       this._allInstancesListIsUpToDate = true;
+      this._behaviorsGroups = null;
+    }
+
+    /**
+     * Step the behaviors grouped by type rather than object by object: the
+     * behaviors of a type are stepped for all the instances, then the ones of
+     * the next type...
+     *
+     * This is faster when lots of instances have behaviors, but be careful
+     * that the order in which the behaviors of *different* objects are
+     * stepped changes. The behaviors are still all stepped before the events
+     * (after the objects forces and timers are updated) or after them, and
+     * the behaviors of an object are in the same order as long as the objects
+     * having these behaviors declare them in the same order.
+     *
+     * Behaviors that don't redefine `doStepPreEvents` (or `doStepPostEvents`)
+     * and deactivated behaviors are skipped.
+     *
+     * @param enable true to step behaviors grouped by type.
+     */
+    setBehaviorsSteppedByType(enable: boolean): void {
+      this._behaviorsSteppedByType = enable;
+      this._behaviorsGroups = null;
+    }
+
+    /**
+     * Return true if behaviors are stepped grouped by type.
+     * @see gdjs.RuntimeInstanceContainer#setBehaviorsSteppedByType
+     */
+    areBehaviorsSteppedByType(): boolean {
+      return this._behaviorsSteppedByType;
+    }
+
+    /**
+     * Signal that behaviors were added to or removed from an instance, so that
+     * behaviors must be grouped again.
+     */
+    invalidateBehaviorsGroups(): void {
+      this._behaviorsGroups = null;
+    }
+
+    /**
+     * Return the behaviors of all the instances grouped by type, in the order
+     * in which types are found in the instances.
+     */
+    private _getBehaviorsGroups(): gdjs.RuntimeInstanceContainer.BehaviorsGroup[] {
+      const allInstancesList = this.getAdhocListOfAllInstances();
+      if (this._behaviorsGroups) {
+        return this._behaviorsGroups;
+      }
+      const behaviorsGroups: gdjs.RuntimeInstanceContainer.BehaviorsGroup[] =
+        [];
+      const behaviorsGroupsByType = new Map<
+        Function,
+        gdjs.RuntimeInstanceContainer.BehaviorsGroup
+      >();
+      const baseBehaviorPrototype = gdjs.RuntimeBehavior.prototype;
+      for (let i = 0, len = allInstancesList.length; i < len; ++i) {
+        const behaviors =
+          allInstancesList[i].getBehaviorsUsingLifecycleFunction();
+        for (let j = 0, count = behaviors.length; j < count; ++j) {
+          const behavior = behaviors[j];
+          let behaviorsGroup = behaviorsGroupsByType.get(behavior.constructor);
+          if (!behaviorsGroup) {
+            behaviorsGroup = {
+              behaviors: [],
+              hasStepPreEvents:
+                behavior.doStepPreEvents !==
+                baseBehaviorPrototype.doStepPreEvents,
+              hasStepPostEvents:
+                behavior.doStepPostEvents !==
+                baseBehaviorPrototype.doStepPostEvents,
+            };
+            behaviorsGroupsByType.set(behavior.constructor, behaviorsGroup);
+            behaviorsGroups.push(behaviorsGroup);
+          }
+          behaviorsGroup.behaviors.push(behavior);
+        }
+      }
+      this._behaviorsGroups = behaviorsGroups;
+      return behaviorsGroups;
+    }
+
+    /**
+     * Step the behaviors of all the instances before the events, grouped by
+     * type.
+     * @see gdjs.RuntimeInstanceContainer#setBehaviorsSteppedByType
+     */
+    _stepBehaviorsPreEventsByType(): void {
+      const behaviorsGroups = this._getBehaviorsGroups();
+      for (let i = 0, len = behaviorsGroups.length; i < len; ++i) {
+        const behaviorsGroup = behaviorsGroups[i];
+        if (!behaviorsGroup.hasStepPreEvents) {
+          continue;
+        }
+        const behaviors = behaviorsGroup.behaviors;
+        for (let j = 0, count = behaviors.length; j < count; ++j) {
+          const behavior = behaviors[j];
+          if (behavior._activated) {
+            behavior.stepPreEvents(this);
+          }
+        }
+      }
+    }
+
+    /**
+     * Step the behaviors of all the instances after the events, grouped by
+     * type.
+     * @see gdjs.RuntimeInstanceContainer#setBehaviorsSteppedByType
+     */
+    _stepBehaviorsPostEventsByType(): void {
+      const behaviorsGroups = this._getBehaviorsGroups();
+      for (let i = 0, len = behaviorsGroups.length; i < len; ++i) {
+        const behaviorsGroup = behaviorsGroups[i];
+        if (!behaviorsGroup.hasStepPostEvents) {
+          continue;
+        }
+        const behaviors = behaviorsGroup.behaviors;
+        for (let j = 0, count = behaviors.length; j < count; ++j) {
+          const behavior = behaviors[j];
+          if (behavior._activated) {
+            behavior.stepPostEvents(this);
+          }
+        }
+      }
     }
 
     /**
@@ -568,7 +741,12 @@ namespace gdjs {
           obj.update(this);
         }
         obj.updateTimers(elapsedTime);
-        allInstancesList[i].stepBehaviorsPreEvents(this);
+        if (!this._behaviorsSteppedByType) {
+          obj.stepBehaviorsPreEvents(this);
+        }
+      }
+      if (this._behaviorsSteppedByType) {
+        this._stepBehaviorsPreEventsByType();
       }
 
       // Some behaviors may have request objects to be deleted.
@@ -581,11 +759,15 @@ namespace gdjs {
     _updateObjectsPostEvents() {
       this._cacheOrClearRemovedInstances();
 
-      // It is *mandatory* to create and iterate on a external list of all objects, as the behaviors
-      // may delete the objects.
-      const allInstancesList = this.getAdhocListOfAllInstances();
-      for (let i = 0, len = allInstancesList.length; i < len; ++i) {
-        allInstancesList[i].stepBehaviorsPostEvents(this);
+      if (this._behaviorsSteppedByType) {
+        this._stepBehaviorsPostEventsByType();
+      } else {
+        // It is *mandatory* to create and iterate on a external list of all objects, as the behaviors
+        // may delete the objects.
+        const allInstancesList = this.getAdhocListOfAllInstances();
+        for (let i = 0, len = allInstancesList.length; i < len; ++i) {
+          allInstancesList[i].stepBehaviorsPostEvents(this);
+        }
       }
 
       // Some behaviors may have request objects to be deleted.
@@ -810,9 +992,24 @@ namespace gdjs {
       this._instancesCache = new Hashtable();
       this._objectsCtor = new Hashtable();
       this._allInstancesList = [];
+      this._behaviorsGroups = null;
       this._instancesRemoved = [];
       this._layersCameraCoordinates = {};
       this._initialBehaviorSharedData = new Hashtable();
     }
   }
+
+  export namespace RuntimeInstanceContainer {
+    /**
+     * The behaviors of a type, stepped together.
+     * @see gdjs.RuntimeInstanceContainer#setBehaviorsSteppedByType
+     */
+    export type BehaviorsGroup = {
+      behaviors: gdjs.RuntimeBehavior[];
+      /** False if the behaviors don't redefine `doStepPreEvents`. */
+      hasStepPreEvents: boolean;
+      /** False if the behaviors don't redefine `doStepPostEvents`. */
+      hasStepPostEvents: boolean;
+    };
+  }
 }
@@ -193,6 +193,47 @@ namespace gdjs {
         ? this.points.get(name)
         : this.origin;
     }
+
+    /**
+     * Check if an object has the same hitboxes when it displays this frame
+     * or the other one: they have the same size, origin, center and custom
+     * hitboxes.
+     */
+    hasSameHitBoxesAs(
+      other: SpriteAnimationFrame<T>,
+      textureManager: gdjs.AnimationFrameTextureManager<T>
+    ): boolean {
+      if (
+        this.origin.x !== other.origin.x ||
+        this.origin.y !== other.origin.y ||
+        this.center.x !== other.center.x ||
+        this.center.y !== other.center.y ||
+        this.hasCustomHitBoxes !== other.hasCustomHitBoxes ||
+        this.customHitBoxes.length !== other.customHitBoxes.length ||
+        textureManager.getAnimationFrameWidth(this.texture) !==
+          textureManager.getAnimationFrameWidth(other.texture) ||
+        textureManager.getAnimationFrameHeight(this.texture) !==
+          textureManager.getAnimationFrameHeight(other.texture)
+      ) {
+        return false;
+      }
+      for (let i = 0; i < this.customHitBoxes.length; i++) {
+        const vertices = this.customHitBoxes[i].vertices;
+        const otherVertices = other.customHitBoxes[i].vertices;
+        if (vertices.length !== otherVertices.length) {
+          return false;
+        }
+        for (let j = 0; j < vertices.length; j++) {
+          if (
+            vertices[j][0] !== otherVertices[j][0] ||
+            vertices[j][1] !== otherVertices[j][1]
+          ) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
   }
 
   /**
@@ -202,6 +243,11 @@ namespace gdjs {
     timeBetweenFrames: float;
     loop: boolean;
     frames: SpriteAnimationFrame<T>[] = [];
+    /**
+     * True if all the frames give the same hitboxes to the object, so that
+     * they don't need to be updated when the frame changes.
+     */
+    framesHaveSameHitBoxes: boolean = false;
 
     /**
      * @param directionData The direction data used to initialize the direction
@@ -242,6 +288,10 @@ namespace gdjs {
         }
       }
       this.frames.length = i;
+
+      this.framesHaveSameHitBoxes = this.frames.every((frame) =>
+        frame.hasSameHitBoxesAs(this.frames[0], textureManager)
+      );
     }
   }
 
@@ -413,6 +463,19 @@ namespace gdjs {
     /**
      * @returns Returns the current frame or null if the current animation doesn't have any frame.
      */
+    /**
+     * Check if all the frames of the current direction give the same hitboxes
+     * to the object, so that changing the frame doesn't change them.
+     */
+    haveCurrentFramesSameHitBoxes(): boolean {
+      const animation = this._animations[this._currentAnimation];
+      if (!animation) {
+        return false;
+      }
+      const direction = animation.directions[this._currentDirection];
+      return !!direction && direction.framesHaveSameHitBoxes;
+    }
+
     getCurrentFrame(): gdjs.SpriteAnimationFrame<T> | null {
       if (!this._animationFrameDirty) {
         return this._animationFrame;
@@ -443,36 +506,53 @@ namespace gdjs {
      * @param timeDelta in seconds
      */
     step(timeDelta: float): boolean {
-      if (
-        this._currentAnimation >= this._animations.length ||
-        this._currentDirection >=
-          this._animations[this._currentAnimation].directions.length
-      ) {
+      // This is called for every animated object at every frame, so the
+      // direction is only looked up once and the elapsed time and frame
+      // index are updated without calling the other methods.
+      if (this._animationPaused) {
         return false;
       }
-      const direction =
-        this._animations[this._currentAnimation].directions[
-          this._currentDirection
-        ];
-      const animationDuration = this.getAnimationDuration();
+      const animation = this._animations[this._currentAnimation];
+      if (!animation) {
+        return false;
+      }
+      const direction = animation.directions[this._currentDirection];
+      if (!direction) {
+        return false;
+      }
+      const timeBetweenFrames = direction.timeBetweenFrames;
+      const framesCount = direction.frames.length;
+      const animationDuration = framesCount * timeBetweenFrames;
       if (
-        !this._animationPaused &&
-        (direction.loop || this._animationElapsedTime !== animationDuration) &&
-        direction.timeBetweenFrames
+        !timeBetweenFrames ||
+        !framesCount ||
+        (!direction.loop && this._animationElapsedTime === animationDuration)
       ) {
-        const animationElapsedTime =
-          this._animationElapsedTime + timeDelta * this._animationSpeedScale;
-        return this.setAnimationElapsedTime(
-          direction.loop
-            ? gdjs.evtTools.common.mod(animationElapsedTime, animationDuration)
-            : gdjs.evtTools.common.clamp(
-                animationElapsedTime,
-                0,
-                animationDuration
-              )
-        );
+        return false;
       }
-      return false;
+      let animationElapsedTime =
+        this._animationElapsedTime + timeDelta * this._animationSpeedScale;
+      if (direction.loop) {
+        animationElapsedTime -=
+          animationDuration *
+          Math.floor(animationElapsedTime / animationDuration);
+      }
+      animationElapsedTime = Math.min(
+        Math.max(animationElapsedTime, 0),
+        animationDuration
+      );
+      this._animationElapsedTime = animationElapsedTime;
+
+      const frameIndex = Math.min(
+        Math.floor(animationElapsedTime / timeBetweenFrames),
+        framesCount - 1
+      );
+      if (frameIndex === this._currentFrameIndex) {
+        return false;
+      }
+      this._currentFrameIndex = frameIndex;
+      this.invalidateFrame();
+      return true;
     }
 
     /**
@@ -13,19 +13,25 @@ namespace gdjs {
   };
 
   /**
-   * Helper function to convert a base64 string to a Blob, which can be uploaded to a server.
+   * Helper function to get the content of a canvas as a Blob, which can be uploaded to a server.
+   *
+   * Unlike `toDataURL`, `toBlob` lets the browser encode the image
+   * asynchronously (off the main thread), so the game doesn't freeze while
+   * the image is encoded. It also avoids a conversion from base64.
    */
-  const base64ToBlob = (base64) => {
-    const byteString = atob(base64.split(',')[1]);
-    const mimeString = base64.split(',')[0].split(':')[1].split(';')[0];
-
-    const arrayBuffer = new Uint8Array(byteString.length);
-    for (let i = 0; i < byteString.length; i++) {
-      arrayBuffer[i] = byteString.charCodeAt(i);
-    }
-
-    return new Blob([arrayBuffer], { type: mimeString });
-  };
+  const canvasToBlob = (
+    canvas: HTMLCanvasElement,
+    mimeType: string
+  ): Promise<Blob> =>
+    new Promise((resolve, reject) => {
+      canvas.toBlob((blob) => {
+        if (blob) {
+          resolve(blob);
+        } else {
+          reject(new Error('The canvas could not be encoded.'));
+        }
+      }, mimeType);
+    });
 
   /**
    * Manage the captures (screenshots, videos, etc...) that need to be taken during the game.
@@ -64,8 +70,7 @@ namespace gdjs {
       const canvas = this._gameRenderer.getCanvas();
       if (canvas) {
         try {
-          const base64Data = canvas.toDataURL('image/png');
-          const blobData = base64ToBlob(base64Data);
+          const blobData = await canvasToBlob(canvas, 'image/png');
 
           await fetch(signedUrl, {
             method: 'PUT',
@@ -103,6 +103,64 @@ namespace gdjs {
     return value;
   };
 
+  /**
+   * The keys of the data that are big and/or not useful for the debugger,
+   * excluded from the dumps of the game.
+   */
+  const runtimeGameDumpExcludedKeys = new Set<string>([
+    // Exclude reference to the debugger
+    '_debuggerClient',
+    // Exclude some RuntimeScene fields:
+    '_allInstancesList',
+    '_objectsVisibilityIndex',
+    // Exclude circular references to parent runtimeGame or runtimeScene:
+    '_runtimeGame',
+    '_runtimeScene',
+    // Exclude some runtimeObject duplicated data:
+    '_behaviorsTable',
+    '_visibilityIndexItem',
+    // Exclude some objects data:
+    '_animations',
+    '_animationFrame',
+    // Exclude linked objects to avoid too much repetitions:
+    'linkedObjectsManager',
+    // Could be improved by using private fields and excluding these (_)
+    // Exclude some behaviors data:
+    '_platformRBushes',
+    // PlatformBehavior
+    'HSHG',
+    // Pathfinding
+    '_obstaclesHSHG',
+    // Pathfinding
+    'owner',
+    // Avoid circular reference from behavior to parent runtimeObject
+    // Exclude rendering related objects:
+    '_renderer',
+    '_gameRenderer',
+    '_imageManager',
+    '_rendererEffects',
+    // Exclude PIXI textures:
+    'baseTexture',
+    '_baseTexture',
+    '_invalidTexture',
+  ]);
+
+  /**
+   * Return the replacer used to stringify the game (or a part of it) for the
+   * debugger, excluding some known data that are big and/or not useful.
+   */
+  const getRuntimeGameDumpReplacer = (
+    runtimeGame: gdjs.RuntimeGame
+  ): DebuggerClientCycleReplacer => {
+    const gameData = runtimeGame.getGameData();
+    return function (key, value) {
+      if (value === gameData || runtimeGameDumpExcludedKeys.has(key)) {
+        return '[Removed from the debugger]';
+      }
+      return value;
+    };
+  };
+
   const buildGameCrashReport = (
     exception: Error,
     runtimeGame: gdjs.RuntimeGame
@@ -164,6 +222,9 @@ namespace gdjs {
 
     _hasLoggedUncaughtException = false;
 
+    /** The last profiler stopped, kept to export its trace on demand. */
+    _lastStoppedProfiler: gdjs.Profiler | null = null;
+
     constructor(runtimeGame: RuntimeGame) {
       this._runtimegame = runtimeGame;
       this._hotReloader = new gdjs.HotReloader(runtimeGame);
@@ -246,12 +307,15 @@ namespace gdjs {
         that.sendRuntimeGameDump();
       } else if (data.command === 'refresh') {
         that.sendRuntimeGameDump();
+      } else if (data.command === 'refreshPath') {
+        that.sendRuntimeGameDumpAtPath(data.path);
       } else if (data.command === 'set') {
         that.set(data.path, data.newValue);
       } else if (data.command === 'call') {
         that.call(data.path, data.args);
       } else if (data.command === 'profiler.start') {
         runtimeGame.startCurrentSceneProfiler(function (stoppedProfiler) {
+          that._lastStoppedProfiler = stoppedProfiler;
           that.sendProfilerOutput(
             stoppedProfiler.getFramesAverageMeasures(),
             stoppedProfiler.getStats()
@@ -261,6 +325,10 @@ namespace gdjs {
         that.sendProfilerStarted();
       } else if (data.command === 'profiler.stop') {
         runtimeGame.stopCurrentSceneProfiler();
+      } else if (data.command === 'profiler.exportTrace') {
+        if (that._lastStoppedProfiler) {
+          that.sendProfilerTrace(that._lastStoppedProfiler.getChromeTrace());
+        }
       } else if (data.command === 'hotReload') {
         that._hotReloader.hotReload().then((logs) => {
           that.sendHotReloaderLogs(logs);
@@ -439,59 +507,14 @@ namespace gdjs {
      * Dump all the relevant data from the {@link RuntimeGame} instance and send it to the server.
      */
     sendRuntimeGameDump(): void {
-      const that = this;
       const message = { command: 'dump', payload: this._runtimegame };
       const serializationStartTime = Date.now();
 
       // Stringify the message, excluding some known data that are big and/or not
       // useful for the debugger.
-      const excludedValues = [that._runtimegame.getGameData()];
-      const excludedKeys = [
-        // Exclude reference to the debugger
-        '_debuggerClient',
-        // Exclude some RuntimeScene fields:
-        '_allInstancesList',
-        // Exclude circular references to parent runtimeGame or runtimeScene:
-        '_runtimeGame',
-        '_runtimeScene',
-        // Exclude some runtimeObject duplicated data:
-        '_behaviorsTable',
-        // Exclude some objects data:
-        '_animations',
-        '_animationFrame',
-        // Exclude linked objects to avoid too much repetitions:
-        'linkedObjectsManager',
-        // Could be improved by using private fields and excluding these (_)
-        // Exclude some behaviors data:
-        '_platformRBush',
-        // PlatformBehavior
-        'HSHG',
-        // Pathfinding
-        '_obstaclesHSHG',
-        // Pathfinding
-        'owner',
-        // Avoid circular reference from behavior to parent runtimeObject
-        // Exclude rendering related objects:
-        '_renderer',
-        '_gameRenderer',
-        '_imageManager',
-        '_rendererEffects',
-        // Exclude PIXI textures:
-        'baseTexture',
-        '_baseTexture',
-        '_invalidTexture',
-      ];
       const stringifiedMessage = circularSafeStringify(
         message,
-        function (key, value) {
-          if (
-            excludedValues.indexOf(value) !== -1 ||
-            excludedKeys.indexOf(key) !== -1
-          ) {
-            return '[Removed from the debugger]';
-          }
-          return value;
-        },
+        getRuntimeGameDumpReplacer(this._runtimegame),
         /* Limit maximum depth to prevent any crashes */
         18
       );
@@ -507,6 +530,39 @@ namespace gdjs {
       this._sendMessage(stringifiedMessage);
     }
 
+    /**
+     * Dump the data at a path, starting from the {@link RuntimeGame} instance,
+     * and send it to the server. This is used to refresh only the part of the
+     * game shown by the debugger (for example, after a value was edited),
+     * which is much faster than dumping the whole game.
+     *
+     * @param path - The path to the data, starting from {@link RuntimeGame}.
+     */
+    sendRuntimeGameDumpAtPath(path: string[]): void {
+      if (!path) {
+        logger.warn('No path specified, dump operation from debugger aborted');
+        return;
+      }
+      let value: any = this._runtimegame;
+      for (let index = 0; index < path.length; index++) {
+        if (value === null || value === undefined) {
+          break;
+        }
+        value = value[path[index]];
+      }
+      this._sendMessage(
+        circularSafeStringify(
+          {
+            command: 'dump.path',
+            payload: { path, value: value === undefined ? null : value },
+          },
+          getRuntimeGameDumpReplacer(this._runtimegame),
+          /* Limit maximum depth to prevent any crashes */
+          18
+        )
+      );
+    }
+
     /**
      * Send logs from the hot reloader to the server.
      * @param logs The hot reloader logs.
@@ -587,5 +643,19 @@ namespace gdjs {
         })
       );
     }
+
+    /**
+     * Send the sections measured by the last profiler run, in the Chrome
+     * trace event format.
+     * @param trace The trace of the profiler.
+     */
+    sendProfilerTrace(trace: ProfilerTrace): void {
+      this._sendMessage(
+        JSON.stringify({
+          command: 'profiler.trace',
+          payload: trace,
+        })
+      );
+    }
   }
 }
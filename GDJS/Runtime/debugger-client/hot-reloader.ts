@@ -285,10 +285,17 @@ namespace gdjs {
     ): Promise<void[]> {
       const reloadPromises: Array<Promise<void>> = [];
 
-      // Reload events, only if they were exported.
+      // Reload events, only if they were exported. The code files having a
+      // hash are only reloaded if they changed, like other script files.
       if (!projectDataOnlyExport) {
         newProjectData.layouts.forEach((_layoutData, index) => {
-          reloadPromises.push(this._reloadScript('code' + index + '.js'));
+          const codeFilePath = 'code' + index + '.js';
+          const hasHash = newScriptFiles.some(
+            (scriptFile) => scriptFile.path === codeFilePath && scriptFile.hash
+          );
+          if (!hasHash) {
+            reloadPromises.push(this._reloadScript(codeFilePath));
+          }
         });
       }
       for (let i = 0; i < newScriptFiles.length; ++i) {
@@ -506,11 +513,13 @@ namespace gdjs {
       newVariablesData: RootVariableData[],
       variablesContainer: gdjs.VariablesContainer
     ): void {
+      // Variables are looked up by name in maps so that containers with a lot
+      // of variables are not browsed for each variable.
+      const oldVariablesDataMap = HotReloader.indexByName(oldVariablesData);
+      const newVariablesDataMap = HotReloader.indexByName(newVariablesData);
       newVariablesData.forEach((newVariableData) => {
         const variableName = newVariableData.name;
-        const oldVariableData = oldVariablesData.find(
-          (variable) => variable.name === variableName
-        );
+        const oldVariableData = oldVariablesDataMap.get(variableName);
         const variable = variablesContainer.get(newVariableData.name);
 
         if (!oldVariableData) {
@@ -559,9 +568,7 @@ namespace gdjs {
         }
       });
       oldVariablesData.forEach((oldVariableData) => {
-        const newVariableData = newVariablesData.find(
-          (variable) => variable.name === oldVariableData.name
-        );
+        const newVariableData = newVariablesDataMap.get(oldVariableData.name);
 
         if (!newVariableData) {
           // Variable was removed
@@ -577,10 +584,11 @@ namespace gdjs {
       variable: gdjs.Variable
     ): void {
       if (oldChildren) {
+        const oldChildrenMap = HotReloader.indexByName(oldChildren);
+        const newChildrenMap = HotReloader.indexByName(newChildren);
         oldChildren.forEach((oldChildVariableData) => {
-          const newChildVariableData = newChildren.find(
-            (childVariableData) =>
-              childVariableData.name === oldChildVariableData.name
+          const newChildVariableData = newChildrenMap.get(
+            oldChildVariableData.name
           );
 
           if (!newChildVariableData) {
@@ -624,9 +632,8 @@ namespace gdjs {
           }
         });
         newChildren.forEach((newChildVariableData) => {
-          const oldChildVariableData = oldChildren.find(
-            (childVariableData) =>
-              childVariableData.name === newChildVariableData.name
+          const oldChildVariableData = oldChildrenMap.get(
+            newChildVariableData.name
           );
 
           if (!oldChildVariableData) {
@@ -793,11 +800,15 @@ namespace gdjs {
       newBehaviorsSharedData: BehaviorSharedData[],
       runtimeScene: gdjs.RuntimeScene
     ): void {
+      const oldBehaviorsSharedDataMap = HotReloader.indexByName(
+        oldBehaviorsSharedData
+      );
+      const newBehaviorsSharedDataMap = HotReloader.indexByName(
+        newBehaviorsSharedData
+      );
       oldBehaviorsSharedData.forEach((oldBehaviorSharedData) => {
         const name = oldBehaviorSharedData.name;
-        const newBehaviorSharedData = newBehaviorsSharedData.filter(
-          (behaviorSharedData) => behaviorSharedData.name === name
-        )[0];
+        const newBehaviorSharedData = newBehaviorsSharedDataMap.get(name);
         if (!newBehaviorSharedData) {
           // Behavior shared data was removed.
           runtimeScene.setInitialSharedDataForBehavior(
@@ -818,9 +829,7 @@ namespace gdjs {
       });
       newBehaviorsSharedData.forEach((newBehaviorSharedData) => {
         const name = newBehaviorSharedData.name;
-        const oldBehaviorSharedData = oldBehaviorsSharedData.filter(
-          (behaviorSharedData) => behaviorSharedData.name === name
-        )[0];
+        const oldBehaviorSharedData = oldBehaviorsSharedDataMap.get(name);
         if (!oldBehaviorSharedData) {
           // Behavior shared data was added
           runtimeScene.setInitialSharedDataForBehavior(
@@ -926,11 +935,11 @@ namespace gdjs {
       newObjects: ObjectData[],
       runtimeInstanceContainer: gdjs.RuntimeInstanceContainer
     ): void {
+      const oldObjectsMap = HotReloader.indexByName(oldObjects);
+      const newObjectsMap = HotReloader.indexByName(newObjects);
       oldObjects.forEach((oldObjectData) => {
         const name = oldObjectData.name;
-        const newObjectData = newObjects.filter(
-          (objectData) => objectData.name === name
-        )[0];
+        const newObjectData = newObjectsMap.get(name);
 
         // Note: if an object is renamed in the editor, it will be considered as removed,
         // and the new object name as a new object to register.
@@ -952,9 +961,7 @@ namespace gdjs {
       });
       newObjects.forEach((newObjectData) => {
         const name = newObjectData.name;
-        const oldObjectData = oldObjects.filter(
-          (layerData) => layerData.name === name
-        )[0];
+        const oldObjectData = oldObjectsMap.get(name);
         if (
           (!oldObjectData || oldObjectData.type !== newObjectData.type) &&
           !runtimeInstanceContainer.isObjectRegistered(name)
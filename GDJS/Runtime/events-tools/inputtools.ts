@@ -380,8 +380,69 @@ namespace gdjs {
           .isMouseInsideCanvas();
       };
 
+      /**
+       * The positions of the cursor and of the touches, converted to the
+       * coordinates of the layers of the objects tested by `cursorOnObject`.
+       * They are converted once for each layer (instead of once for each
+       * object), which matters when there are many objects.
+       */
+      const cursorOnObjectStatics: {
+        layers: gdjs.RuntimeLayer[];
+        positions: float[][];
+        workingPoint: FloatPoint;
+      } = {
+        layers: [],
+        positions: [],
+        workingPoint: [0, 0],
+      };
+
+      const getCursorPositionsOnLayer = function (
+        layer: gdjs.RuntimeLayer
+      ): float[] {
+        const { layers, positions, workingPoint } = cursorOnObjectStatics;
+        const layerIndex = layers.indexOf(layer);
+        if (layerIndex !== -1) return positions[layerIndex];
+
+        if (positions.length <= layers.length) positions.push([]);
+        const layerPositions = positions[layers.length];
+        layers.push(layer);
+        layerPositions.length = 0;
+
+        const inputManager = layer
+          .getRuntimeScene()
+          .getGame()
+          .getInputManager();
+        layer.convertCoords(
+          inputManager.getCursorX(),
+          inputManager.getCursorY(),
+          0,
+          workingPoint
+        );
+        layerPositions.push(workingPoint[0], workingPoint[1]);
+        const touchIds = inputManager.getAllTouchIdentifiers();
+        for (let i = 0; i < touchIds.length; ++i) {
+          layer.convertCoords(
+            inputManager.getTouchX(touchIds[i]),
+            inputManager.getTouchY(touchIds[i]),
+            0,
+            workingPoint
+          );
+          layerPositions.push(workingPoint[0], workingPoint[1]);
+        }
+        return layerPositions;
+      };
+
+      // Same as gdjs.RuntimeObject.cursorOnObject, with the positions
+      // converted once for each layer.
       const _cursorIsOnObject = function (obj: gdjs.RuntimeObject) {
-        return obj.cursorOnObject();
+        const layer = obj.getInstanceContainer().getLayer(obj.getLayer());
+        const positions = getCursorPositionsOnLayer(layer);
+        for (let i = 0; i < positions.length; i += 2) {
+          if (obj.insideObject(positions[i], positions[i + 1])) {
+            return true;
+          }
+        }
+        return false;
       };
 
       export const cursorOnObject = function (
@@ -390,12 +451,15 @@ namespace gdjs {
         accurate: boolean,
         inverted: boolean
       ) {
-        return gdjs.evtTools.object.pickObjectsIf(
+        const isTrue = gdjs.evtTools.object.pickObjectsIf(
           _cursorIsOnObject,
           objectsLists,
           inverted,
           null
         );
+        // The cursor and the layers can change before the next call.
+        cursorOnObjectStatics.layers.length = 0;
+        return isTrue;
       };
 
       export const getTouchX = function (
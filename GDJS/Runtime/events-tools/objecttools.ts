@@ -218,6 +218,352 @@ namespace gdjs {
         arr.length = finalSize;
       };
 
+
+      /**
+       * Write the bounds (min X, min Y, max X, max Y) of an object in `bounds`,
+       * used to find the pairs of objects that can fulfill a predicate: when
+       * the bounds of two objects don't overlap, the predicate must be false.
+       */
+      type BroadPhaseBoundsGetter = (
+        object: gdjs.RuntimeObject,
+        extraArg: any,
+        bounds: float[]
+      ) => void;
+
+      /**
+       * The number of pairs of objects under which all the pairs are tested.
+       */
+      const broadPhaseMinimumPairsCount = 256;
+      /**
+       * The number of cells, on each axis, above which the bounds of an object
+       * are considered too big to be put in the grid.
+       */
+      const broadPhaseMaximumCellsPerAxis = 8;
+
+      /**
+       * A uniform grid of the objects of the second lists of
+       * {@link twoListsTestWithBroadPhase}, rebuilt at each test from the
+       * picked objects (which can be moving or can be a few of the instances).
+       * The data are kept between tests to avoid allocations.
+       */
+      const broadPhase = {
+        objects: [] as gdjs.RuntimeObject[],
+        bounds: [] as float[],
+        /** The indexes of the objects in each cell, by cell key. */
+        cells: new Map<integer, integer[]>(),
+        usedCells: [] as integer[][],
+        /** The objects too big to be put in the grid, always tested. */
+        bigObjects: [] as integer[],
+        /** For each object, the last query it was found by. */
+        queryIds: [] as integer[],
+        queryId: 0,
+        candidates: [] as integer[],
+        cellSize: 1,
+        tempBounds: [0, 0, 0, 0] as float[],
+      };
+
+      const getCellKey = (cellX: integer, cellY: integer): integer =>
+        // Different cells can share a key: this only gives more candidates.
+        ((cellX & 0xffff) << 16) | (cellY & 0xffff);
+
+      const buildBroadPhase = (
+        objects2Lists: Array<gdjs.RuntimeObject[]>,
+        objects1Lists: Array<gdjs.RuntimeObject[]>,
+        getObject2Bounds: BroadPhaseBoundsGetter,
+        getObject1Bounds: BroadPhaseBoundsGetter,
+        extraArg: any
+      ) => {
+        const { objects, bounds, bigObjects, usedCells, tempBounds } =
+          broadPhase;
+        objects.length = 0;
+        bounds.length = 0;
+        bigObjects.length = 0;
+        for (let i = 0; i < usedCells.length; i++) usedCells[i].length = 0;
+        usedCells.length = 0;
+        if (broadPhase.cells.size > 4096) broadPhase.cells.clear();
+
+        let extentsSum = 0;
+        for (let i = 0, leni = objects2Lists.length; i < leni; ++i) {
+          const arr = objects2Lists[i];
+          for (let k = 0, lenk = arr.length; k < lenk; ++k) {
+            getObject2Bounds(arr[k], extraArg, tempBounds);
+            objects.push(arr[k]);
+            bounds.push(
+              tempBounds[0],
+              tempBounds[1],
+              tempBounds[2],
+              tempBounds[3]
+            );
+            extentsSum += Math.max(
+              tempBounds[2] - tempBounds[0],
+              tempBounds[3] - tempBounds[1]
+            );
+          }
+        }
+        // The queries can be bigger than the objects (for example,
+        // the objects are points when testing distances).
+        let queriesExtentsSum = 0;
+        let queriesCount = 0;
+        for (let i = 0, leni = objects1Lists.length; i < leni; ++i) {
+          const arr = objects1Lists[i];
+          for (let k = 0, lenk = arr.length; k < lenk; ++k) {
+            getObject1Bounds(arr[k], extraArg, tempBounds);
+            queriesExtentsSum += Math.max(
+              tempBounds[2] - tempBounds[0],
+              tempBounds[3] - tempBounds[1]
+            );
+            queriesCount++;
+          }
+        }
+        const cellSize = Math.max(
+          1,
+          objects.length ? extentsSum / objects.length : 0,
+          queriesCount ? queriesExtentsSum / queriesCount : 0
+        );
+        broadPhase.cellSize = cellSize;
+
+        const queryIds = broadPhase.queryIds;
+        for (let index = 0; index < objects.length; index++) {
+          queryIds[index] = 0;
+          const minCellX = Math.floor(bounds[index * 4] / cellSize);
+          const minCellY = Math.floor(bounds[index * 4 + 1] / cellSize);
+          const maxCellX = Math.floor(bounds[index * 4 + 2] / cellSize);
+          const maxCellY = Math.floor(bounds[index * 4 + 3] / cellSize);
+          if (
+            !(maxCellX - minCellX < broadPhaseMaximumCellsPerAxis) ||
+            !(maxCellY - minCellY < broadPhaseMaximumCellsPerAxis)
+          ) {
+            bigObjects.push(index);
+            continue;
+          }
+          for (let cellX = minCellX; cellX <= maxCellX; cellX++) {
+            for (let cellY = minCellY; cellY <= maxCellY; cellY++) {
+              const key = getCellKey(cellX, cellY);
+              let cell = broadPhase.cells.get(key);
+              if (!cell) {
+                cell = [];
+                broadPhase.cells.set(key, cell);
+              }
+              if (cell.length === 0) usedCells.push(cell);
+              cell.push(index);
+            }
+          }
+        }
+      };
+
+      /**
+       * Fill `candidates` with the indexes (in `broadPhase.objects`) of the
+       * objects whose bounds can overlap the given bounds, once for each object.
+       * Return false if the bounds are too big: all the objects must be tested.
+       */
+      const queryBroadPhase = (
+        queryBounds: float[],
+        candidates: integer[]
+      ): boolean => {
+        const { cellSize, queryIds, bigObjects } = broadPhase;
+        candidates.length = 0;
+        // A margin avoids missing objects with bounds touching the query
+        // because of rounding errors.
+        const minCellX = Math.floor((queryBounds[0] - 1) / cellSize);
+        const minCellY = Math.floor((queryBounds[1] - 1) / cellSize);
+        const maxCellX = Math.floor((queryBounds[2] + 1) / cellSize);
+        const maxCellY = Math.floor((queryBounds[3] + 1) / cellSize);
+        if (
+          !(maxCellX - minCellX < broadPhaseMaximumCellsPerAxis) ||
+          !(maxCellY - minCellY < broadPhaseMaximumCellsPerAxis)
+        ) {
+          return false;
+        }
+
+        const queryId = ++broadPhase.queryId;
+        for (let i = 0; i < bigObjects.length; i++) {
+          queryIds[bigObjects[i]] = queryId;
+          candidates.push(bigObjects[i]);
+        }
+        for (let cellX = minCellX; cellX <= maxCellX; cellX++) {
+          for (let cellY = minCellY; cellY <= maxCellY; cellY++) {
+            const cell = broadPhase.cells.get(getCellKey(cellX, cellY));
+            if (!cell) continue;
+            for (let i = 0; i < cell.length; i++) {
+              const index = cell[i];
+              if (queryIds[index] === queryId) continue;
+              queryIds[index] = queryId;
+              candidates.push(index);
+            }
+          }
+        }
+        return true;
+      };
+
+      /**
+       * Same as {@link twoListsTest}, but the predicate is only called for the
+       * pairs of objects whose bounds overlap, found with a uniform grid of the
+       * objects of the second lists. This avoids testing all the pairs when
+       * the lists are big (for example, bullets against enemies).
+       *
+       * The bounds getters must ensure that the predicate is false for the
+       * objects with bounds that don't overlap (touching bounds overlap).
+       */
+      export const twoListsTestWithBroadPhase = function (
+        predicate: (
+          object1: gdjs.RuntimeObject,
+          object2: gdjs.RuntimeObject,
+          extraArg: any
+        ) => boolean,
+        getObject1Bounds: BroadPhaseBoundsGetter,
+        getObject2Bounds: BroadPhaseBoundsGetter,
+        objectsLists1: ObjectsLists,
+        objectsLists2: ObjectsLists,
+        inverted: boolean,
+        extraArg: any
+      ) {
+        const objects1Lists = gdjs.staticArray(
+          gdjs.evtTools.object.twoListsTestWithBroadPhase
+        );
+        objectsLists1.values(objects1Lists);
+        const objects2Lists = gdjs.staticArray2(
+          gdjs.evtTools.object.twoListsTestWithBroadPhase
+        );
+        objectsLists2.values(objects2Lists);
+        let objects1Count = 0;
+        for (let i = 0, leni = objects1Lists.length; i < leni; ++i) {
+          objects1Count += objects1Lists[i].length;
+        }
+        let objects2Count = 0;
+        for (let i = 0, leni = objects2Lists.length; i < leni; ++i) {
+          objects2Count += objects2Lists[i].length;
+        }
+        if (objects1Count * objects2Count < broadPhaseMinimumPairsCount) {
+          return gdjs.evtTools.object.twoListsTest(
+            predicate,
+            objectsLists1,
+            objectsLists2,
+            inverted,
+            extraArg
+          );
+        }
+
+        for (let i = 0, leni = objects1Lists.length; i < leni; ++i) {
+          let arr = objects1Lists[i];
+          for (let k = 0, lenk = arr.length; k < lenk; ++k) {
+            arr[k].pick = false;
+          }
+        }
+        for (let i = 0, leni = objects2Lists.length; i < leni; ++i) {
+          let arr = objects2Lists[i];
+          for (let k = 0, lenk = arr.length; k < lenk; ++k) {
+            arr[k].pick = false;
+          }
+        }
+        buildBroadPhase(
+          objects2Lists,
+          objects1Lists,
+          getObject2Bounds,
+          getObject1Bounds,
+          extraArg
+        );
+
+        let isTrue = false;
+        const objects2 = broadPhase.objects;
+        const queryBounds = broadPhase.tempBounds;
+        const candidates = broadPhase.candidates;
+        for (let i = 0, leni = objects1Lists.length; i < leni; ++i) {
+          const arr1 = objects1Lists[i];
+          for (let k = 0, lenk = arr1.length; k < lenk; ++k) {
+            const object1 = arr1[k];
+            let atLeastOneObject = false;
+            getObject1Bounds(object1, extraArg, queryBounds);
+            const hasCandidates = queryBroadPhase(queryBounds, candidates);
+            const candidatesCount = hasCandidates
+              ? candidates.length
+              : objects2.length;
+            for (let l = 0; l < candidatesCount; ++l) {
+              const object2 = objects2[hasCandidates ? candidates[l] : l];
+              if (object1.pick && object2.pick) {
+                continue;
+              }
+
+              //Avoid unnecessary costly call to predicate.
+              if (
+                object1.id !== object2.id &&
+                predicate(object1, object2, extraArg)
+              ) {
+                if (!inverted) {
+                  isTrue = true;
+
+                  //Pick the objects
+                  object1.pick = true;
+                  object2.pick = true;
+                }
+                atLeastOneObject = true;
+              }
+            }
+            if (!atLeastOneObject && inverted) {
+              //For example, the object is not overlapping any other object.
+              isTrue = true;
+              object1.pick = true;
+            }
+          }
+        }
+        // Don't keep references to the objects, which could be deleted.
+        objects2.length = 0;
+        candidates.length = 0;
+
+        //Trim not picked objects from lists.
+        for (let i = 0, leni = objects1Lists.length; i < leni; ++i) {
+          gdjs.evtTools.object.filterPickedObjectsList(objects1Lists[i]);
+        }
+        if (!inverted) {
+          for (let i = 0, leni = objects2Lists.length; i < leni; ++i) {
+            gdjs.evtTools.object.filterPickedObjectsList(objects2Lists[i]);
+          }
+        }
+        return isTrue;
+      };
+
+      const getCollisionBounds: BroadPhaseBoundsGetter = (
+        object,
+        extraArg,
+        bounds
+      ) => {
+        // Objects are never in collision when their bounding circles (see
+        // RuntimeObject.collisionTest) don't overlap.
+        const radius = object.getCollisionBoundingRadius();
+        const centerX = object.getDrawableX() + object.getCenterX();
+        const centerY = object.getDrawableY() + object.getCenterY();
+        bounds[0] = centerX - radius;
+        bounds[1] = centerY - radius;
+        bounds[2] = centerX + radius;
+        bounds[3] = centerY + radius;
+      };
+
+      const getCenterBounds: BroadPhaseBoundsGetter = (
+        object,
+        extraArg,
+        bounds
+      ) => {
+        const centerX = object.getDrawableX() + object.getCenterX();
+        const centerY = object.getDrawableY() + object.getCenterY();
+        bounds[0] = centerX;
+        bounds[1] = centerY;
+        bounds[2] = centerX;
+        bounds[3] = centerY;
+      };
+
+      const getDistanceQueryBounds: BroadPhaseBoundsGetter = (
+        object,
+        sqDistance,
+        bounds
+      ) => {
+        const distance = Math.sqrt(sqDistance);
+        const centerX = object.getDrawableX() + object.getCenterX();
+        const centerY = object.getDrawableY() + object.getCenterY();
+        bounds[0] = centerX - distance;
+        bounds[1] = centerY - distance;
+        bounds[2] = centerX + distance;
+        bounds[3] = centerY + distance;
+      };
+
       export const hitBoxesCollisionTest = function (
         objectsLists1: ObjectsLists,
         objectsLists2: ObjectsLists,
@@ -225,8 +571,10 @@ namespace gdjs {
         instanceContainer: gdjs.RuntimeInstanceContainer,
         ignoreTouchingEdges: boolean
       ) {
-        return gdjs.evtTools.object.twoListsTest(
+        return gdjs.evtTools.object.twoListsTestWithBroadPhase(
           gdjs.RuntimeObject.collisionTest,
+          getCollisionBounds,
+          getCollisionBounds,
           objectsLists1,
           objectsLists2,
           inverted,
@@ -244,8 +592,10 @@ namespace gdjs {
         distance: float,
         inverted: boolean
       ) {
-        return gdjs.evtTools.object.twoListsTest(
+        return gdjs.evtTools.object.twoListsTestWithBroadPhase(
           gdjs.evtTools.object._distanceBetweenObjects,
+          getDistanceQueryBounds,
+          getCenterBounds,
           objectsLists1,
           objectsLists2,
           inverted,
@@ -627,6 +977,12 @@ namespace gdjs {
    * It automatically removes objects that were destroyed from the objects lists.
    */
   export class LongLivedObjectsList {
+    /**
+     * The list returned for objects that were not saved. It must not be
+     * modified.
+     */
+    private static readonly emptyList: Array<RuntimeObject> = [];
+
     private objectsLists = new Map<string, Array<RuntimeObject>>();
     private localVariablesContainers: Array<gdjs.VariablesContainer> = [];
     private callbacks = new Map<RuntimeObject, () => void>();
@@ -649,20 +1005,30 @@ namespace gdjs {
     }
 
     private getOrCreateList(objectName: string): RuntimeObject[] {
-      if (!this.objectsLists.has(objectName))
-        this.objectsLists.set(objectName, []);
-      return this.objectsLists.get(objectName)!;
+      let list = this.objectsLists.get(objectName);
+      if (!list) {
+        list = [];
+        this.objectsLists.set(objectName, list);
+      }
+      return list;
     }
 
+    /**
+     * Get the objects saved with the given name (in this container or in its
+     * parents). The returned array must not be modified.
+     */
     getObjects(objectName: string): RuntimeObject[] {
-      if (!this.objectsLists.has(objectName) && this.parent)
-        return this.parent.getObjects(objectName);
-      return this.objectsLists.get(objectName) || [];
+      const list = this.objectsLists.get(objectName);
+      if (list) return list;
+      if (this.parent) return this.parent.getObjects(objectName);
+      return LongLivedObjectsList.emptyList;
     }
 
     addObject(objectName: string, runtimeObject: gdjs.RuntimeObject): void {
+      // An object is only saved with its own name, so a registered callback
+      // means it's already in the list.
+      if (this.callbacks.has(runtimeObject)) return;
       const list = this.getOrCreateList(objectName);
-      if (list.includes(runtimeObject)) return;
       list.push(runtimeObject);
 
       // Register callbacks for when the object is destroyed
@@ -672,7 +1038,8 @@ namespace gdjs {
     }
 
     removeObject(objectName: string, runtimeObject: gdjs.RuntimeObject): void {
-      const list = this.getOrCreateList(objectName);
+      const list = this.objectsLists.get(objectName);
+      if (!list) return;
       const index = list.indexOf(runtimeObject);
       if (index === -1) return;
       list.splice(index, 1);
@@ -69,66 +69,64 @@ namespace gdjs {
       export const timerElapsedTime = function (
         runtimeScene: gdjs.RuntimeScene,
         timeInSeconds: float,
-        timerName: string
+        timerName: gdjs.TimerNameOrSlot
       ) {
         const timeManager = runtimeScene.getScene().getTimeManager();
-        if (!timeManager.hasTimer(timerName)) {
+        const timer = timeManager.getTimer(timerName);
+        if (!timer) {
           timeManager.addTimer(timerName);
           return false;
         }
-        return (
-          timeManager.getTimer(timerName).getTime() / 1000 >= timeInSeconds
-        );
+        return timer.getTime() / 1000 >= timeInSeconds;
       };
 
       export const timerPaused = function (
         runtimeScene: gdjs.RuntimeScene,
-        timerName: string
+        timerName: gdjs.TimerNameOrSlot
       ) {
-        const timeManager = runtimeScene.getScene().getTimeManager();
-        if (!timeManager.hasTimer(timerName)) {
-          return false;
-        }
-        return timeManager.getTimer(timerName).isPaused();
+        const timer = runtimeScene
+          .getScene()
+          .getTimeManager()
+          .getTimer(timerName);
+        return !!timer && timer.isPaused();
       };
 
       export const resetTimer = function (
         runtimeScene: gdjs.RuntimeScene,
-        timerName: string
+        timerName: gdjs.TimerNameOrSlot
       ) {
         const timeManager = runtimeScene.getScene().getTimeManager();
-        if (!timeManager.hasTimer(timerName)) {
+        const timer = timeManager.getTimer(timerName);
+        if (!timer) {
           timeManager.addTimer(timerName);
         } else {
-          timeManager.getTimer(timerName).reset();
+          timer.reset();
         }
       };
 
       export const pauseTimer = function (
         runtimeScene: gdjs.RuntimeScene,
-        timerName: string
+        timerName: gdjs.TimerNameOrSlot
       ) {
         const timeManager = runtimeScene.getScene().getTimeManager();
-        if (!timeManager.hasTimer(timerName)) {
-          timeManager.addTimer(timerName);
-        }
-        timeManager.getTimer(timerName).setPaused(true);
+        const timer =
+          timeManager.getTimer(timerName) || timeManager.addTimer(timerName);
+        timer.setPaused(true);
       };
 
       export const unpauseTimer = function (
         runtimeScene: gdjs.RuntimeScene,
-        timerName: string
+        timerName: gdjs.TimerNameOrSlot
       ) {
         const timeManager = runtimeScene.getScene().getTimeManager();
-        if (!timeManager.hasTimer(timerName)) {
-          timeManager.addTimer(timerName);
-        }
-        return timeManager.getTimer(timerName).setPaused(false);
+        const timer =
+          timeManager.getTimer(timerName) || timeManager.addTimer(timerName);
+        return timer.setPaused(false);
       };
 
       export const removeTimer = function (
         runtimeScene: gdjs.RuntimeScene,
-        timerName: string
+        timerName: gdjs.TimerNameOrSlot
       ) {
         const timeManager = runtimeScene.getScene().getTimeManager();
         timeManager.removeTimer(timerName);
@@ -167,13 +165,13 @@ namespace gdjs {
        */
       export const getTimerElapsedTimeInSeconds = function (
         runtimeScene: gdjs.RuntimeScene,
-        timerName: string
+        timerName: gdjs.TimerNameOrSlot
       ) {
-        const timeManager = runtimeScene.getScene().getTimeManager();
-        if (!timeManager.hasTimer(timerName)) {
-          return 0;
-        }
-        return timeManager.getTimer(timerName).getTime() / 1000;
+        const timer = runtimeScene
+          .getScene()
+          .getTimeManager()
+          .getTimer(timerName);
+        return timer ? timer.getTime() / 1000 : 0;
       };
 
       /**
@@ -186,13 +184,13 @@ namespace gdjs {
        */
       export const getTimerElapsedTimeInSecondsOrNaN = function (
         runtimeScene: gdjs.RuntimeScene,
-        timerName: string
+        timerName: gdjs.TimerNameOrSlot
       ) {
-        const timeManager = runtimeScene.getScene().getTimeManager();
-        if (!timeManager.hasTimer(timerName)) {
-          return Number.NaN;
-        }
-        return timeManager.getTimer(timerName).getTime() / 1000;
+        const timer = runtimeScene
+          .getScene()
+          .getTimeManager()
+          .getTimer(timerName);
+        return timer ? timer.getTime() / 1000 : Number.NaN;
       };
 
       export const getTimeFromStartInSeconds = function (
@@ -337,6 +335,31 @@ namespace gdjs {
         runtimeScene.getGame().prioritizeLoadingOfScene(sceneName);
       };
 
+      /**
+       * Load a scene assets and create its objects in background, so that it
+       * starts instantly.
+       */
+      export const preInstantiateScene = (
+        runtimeScene: gdjs.RuntimeScene,
+        sceneName: string
+      ): void => {
+        runtimeScene.getGame().getSceneStack().preInstantiateScene(sceneName);
+      };
+
+      /**
+       * Check if a scene assets are loaded and its objects created in
+       * background.
+       */
+      export const isScenePreInstantiated = (
+        runtimeScene: gdjs.RuntimeScene,
+        sceneName: string
+      ): boolean => {
+        return runtimeScene
+          .getGame()
+          .getSceneStack()
+          .isScenePreInstantiated(sceneName);
+      };
+
       /**
        * @return The progress of assets loading in background for a scene (between 0 and 1).
        */
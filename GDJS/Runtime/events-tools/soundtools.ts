@@ -19,6 +19,26 @@ namespace gdjs {
         runtimeScene.getScene().getSoundManager().setGlobalVolume(globalVolume);
       };
 
+      export const setMaxSoundVoices = function (
+        runtimeScene: gdjs.RuntimeScene,
+        maxSoundVoices: integer
+      ): void {
+        runtimeScene
+          .getScene()
+          .getSoundManager()
+          .setMaxSoundVoices(maxSoundVoices);
+      };
+
+      export const setSoundDeduplicationDelay = function (
+        runtimeScene: gdjs.RuntimeScene,
+        delay: float
+      ): void {
+        runtimeScene
+          .getScene()
+          .getSoundManager()
+          .setSoundDeduplicationDelay(delay * 1000);
+      };
+
       export const unloadAllAudio = function (
         runtimeScene: gdjs.RuntimeScene
       ): void {
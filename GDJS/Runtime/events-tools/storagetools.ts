@@ -42,6 +42,127 @@ namespace gdjs {
       /** The stored objects that are loaded in memory */
       const loadedObjects = new Hashtable();
 
+      /**
+       * True if writes are delayed and grouped (see `setWriteBehindEnabled`).
+       */
+      let writeBehindEnabled = false;
+      /**
+       * The stored objects that were changed and are waiting to be written
+       * in `localStorage`, when writes are delayed.
+       */
+      const pendingObjects = new Hashtable();
+      const pendingObjectsNames: string[] = [];
+      let isFlushScheduled = false;
+      let areFlushListenersRegistered = false;
+      /**
+       * The time, in milliseconds, to wait for other changes before writing
+       * changed objects, when writes are delayed.
+       */
+      const writeBehindDelay = 1000;
+
+      /**
+       * Serialize an object as JSON and store it in the local storage.
+       */
+      const writeObjectToStorage = (name: string, jsObject: any) => {
+        const serializedString = JSON.stringify(jsObject);
+        try {
+          if (localStorage) {
+            localStorage.setItem('GDJS_' + name, serializedString);
+          }
+        } catch (error) {
+          logger.error(
+            'Unable to save data to localStorage for "' + name + '": ' + error
+          );
+        }
+      };
+
+      /**
+       * Write in the local storage all the objects waiting to be written.
+       *
+       * This is done automatically when writes are delayed (after a short
+       * delay, or when the game is hidden or closed), but can be called to
+       * make sure the data is saved at a given time.
+       */
+      export const flushPendingWrites = () => {
+        pendingObjects.keys(pendingObjectsNames);
+        for (let i = 0; i < pendingObjectsNames.length; i++) {
+          const name = pendingObjectsNames[i];
+          writeObjectToStorage(name, pendingObjects.get(name));
+        }
+        pendingObjects.clear();
+        pendingObjectsNames.length = 0;
+      };
+
+      const registerFlushListeners = () => {
+        if (areFlushListenersRegistered) {
+          return;
+        }
+        areFlushListenersRegistered = true;
+        if (typeof document !== 'undefined') {
+          document.addEventListener('visibilitychange', () => {
+            if (document.visibilityState === 'hidden') {
+              flushPendingWrites();
+            }
+          });
+        }
+        if (typeof window !== 'undefined') {
+          window.addEventListener('pagehide', flushPendingWrites, false);
+          window.addEventListener('beforeunload', flushPendingWrites, false);
+          // Cordova event
+          window.addEventListener('pause', flushPendingWrites, false);
+        }
+      };
+
+      /**
+       * Write the changed objects after a short delay, preferably when the
+       * browser is idle so that serialization doesn't happen during a frame.
+       */
+      const scheduleFlush = () => {
+        if (isFlushScheduled) {
+          return;
+        }
+        isFlushScheduled = true;
+        setTimeout(() => {
+          const flush = () => {
+            isFlushScheduled = false;
+            flushPendingWrites();
+          };
+          if (
+            typeof window !== 'undefined' &&
+            typeof window.requestIdleCallback === 'function'
+          ) {
+            window.requestIdleCallback(flush, { timeout: writeBehindDelay });
+          } else {
+            flush();
+          }
+        }, writeBehindDelay);
+      };
+
+      /**
+       * Delay the writes in the local storage, so that the changes made
+       * during a short time are grouped and written at once, when the browser
+       * is idle. Changes are also written when the game is hidden or closed.
+       *
+       * This avoids slowdowns for games saving large data often. Call
+       * `flushPendingWrites` to write the changes immediately.
+       *
+       * @param enable true to delay writes, false to write changes immediately.
+       */
+      export const setWriteBehindEnabled = (enable: boolean) => {
+        writeBehindEnabled = enable;
+        if (enable) {
+          registerFlushListeners();
+        } else {
+          flushPendingWrites();
+        }
+      };
+
+      /**
+       * Return true if writes in the local storage are delayed.
+       * @see setWriteBehindEnabled
+       */
+      export const isWriteBehindEnabled = (): boolean => writeBehindEnabled;
+
       /**
        * Load into memory a JSON serialized object, from the local storage
        * provided by the browser/environment.
@@ -59,6 +180,11 @@ namespace gdjs {
         ) {
           return;
         }
+        if (pendingObjects.containsKey(name)) {
+          // The object is not written yet: the local storage is outdated.
+          loadedObjects.put(name, pendingObjects.get(name));
+          return;
+        }
         let serializedString: string | null = null;
         try {
           if (localStorage) {
@@ -90,6 +216,8 @@ namespace gdjs {
        * stored in the local storage provided by the browser/environment.
        *
        * The object name is prefixed with `GDJS_` in `localStorage`.
+       * When writes are delayed (see `setWriteBehindEnabled`), the object is
+       * written later.
        *
        * @param name The name of the object to load
        */
@@ -103,33 +231,41 @@ namespace gdjs {
           return;
         }
         const jsObject = loadedObjects.get(name);
-        const serializedString = JSON.stringify(jsObject);
-        try {
-          if (localStorage) {
-            localStorage.setItem('GDJS_' + name, serializedString);
-          }
-        } catch (error) {
-          logger.error(
-            'Unable to save data to localStorage for "' + name + '": ' + error
-          );
-        }
         loadedObjects.remove(name);
+        if (writeBehindEnabled) {
+          pendingObjects.put(name, jsObject);
+          scheduleFlush();
+          return;
+        }
+        pendingObjects.remove(name);
+        writeObjectToStorage(name, jsObject);
       };
-      const loadObject = (name: string, cb: Function) => {
-        let notPermanentlyLoaded = false;
-        if (!loadedObjects.containsKey(name)) {
-          notPermanentlyLoaded = true;
-          loadJSONFileFromStorage(name);
+
+      /**
+       * Call a function with an object, loading it temporarily if it's not
+       * loaded in memory.
+       * @param name The name of the object
+       * @param isWrite true if the function changes the object, which must
+       * then be written in the local storage.
+       * @param cb The function to call with the object
+       */
+      const loadObject = (name: string, isWrite: boolean, cb: Function) => {
+        if (loadedObjects.containsKey(name)) {
+          return cb(loadedObjects.get(name));
         }
+        loadJSONFileFromStorage(name);
         const returnValue = cb(loadedObjects.get(name));
-        if (notPermanentlyLoaded) {
+        if (isWrite) {
           unloadJSONFile(name);
+        } else {
+          // The object was not changed: no need to write it again.
+          loadedObjects.remove(name);
         }
         return returnValue;
       };
 
       export const clearJSONFile = (name: string) => {
-        return loadObject(name, (jsObject) => {
+        return loadObject(name, /*isWrite=*/ true, (jsObject) => {
           for (const p in jsObject) {
             if (jsObject.hasOwnProperty(p)) {
               delete jsObject[p];
@@ -143,7 +279,7 @@ namespace gdjs {
         name: string,
         elementPath: string
       ) => {
-        return loadObject(name, (jsObject) => {
+        return loadObject(name, /*isWrite=*/ false, (jsObject) => {
           const pathSegments = elementPath.split('/');
           let currentElem = jsObject;
           for (let i = 0; i < pathSegments.length; ++i) {
@@ -160,7 +296,7 @@ namespace gdjs {
         name: string,
         elementPath: string
       ) => {
-        return loadObject(name, (jsObject) => {
+        return loadObject(name, /*isWrite=*/ true, (jsObject) => {
           const pathSegments = elementPath.split('/');
           let currentElem = jsObject;
           for (let i = 0; i < pathSegments.length; ++i) {
@@ -182,7 +318,7 @@ namespace gdjs {
         elementPath: string,
         val: any
       ) => {
-        return loadObject(name, (jsObject) => {
+        return loadObject(name, /*isWrite=*/ true, (jsObject) => {
           const pathSegments = elementPath.split('/');
           let currentElem = jsObject;
           for (let i = 0; i < pathSegments.length; ++i) {
@@ -204,7 +340,7 @@ namespace gdjs {
         elementPath: string,
         str: any
       ) => {
-        return loadObject(name, (jsObject) => {
+        return loadObject(name, /*isWrite=*/ true, (jsObject) => {
           const pathSegments = elementPath.split('/');
           let currentElem = jsObject;
           for (let i = 0; i < pathSegments.length; ++i) {
@@ -227,7 +363,7 @@ namespace gdjs {
         instanceContainer: gdjs.RuntimeInstanceContainer | null,
         variable: gdjs.Variable
       ) => {
-        return loadObject(name, (jsObject) => {
+        return loadObject(name, /*isWrite=*/ false, (jsObject) => {
           const pathSegments = elementPath.split('/');
           let currentElem = jsObject;
           for (let i = 0; i < pathSegments.length; ++i) {
@@ -253,7 +389,7 @@ namespace gdjs {
         instanceContainer: gdjs.RuntimeInstanceContainer | null,
         variable: gdjs.Variable
       ) => {
-        return loadObject(name, (jsObject) => {
+        return loadObject(name, /*isWrite=*/ false, (jsObject) => {
           const pathSegments = elementPath.split('/');
           let currentElem = jsObject;
           for (let i = 0; i < pathSegments.length; ++i) {
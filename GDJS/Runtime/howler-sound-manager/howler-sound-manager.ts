@@ -376,6 +376,22 @@ namespace gdjs {
     _freeSounds: HowlerSound[] = []; // Sounds without an assigned channel.
     _freeMusics: HowlerSound[] = []; // Musics without an assigned channel.
 
+    /**
+     * The maximum number of sounds of the same file played at the same time
+     * without a channel, or 0 for no limit. When reached, the oldest sound is
+     * stopped to play the new one.
+     */
+    _maxSoundVoices: integer = 32;
+    /**
+     * The delay, in milliseconds, during which a sound played without a
+     * channel is not played again, or 0 to always play it.
+     */
+    _soundDeduplicationDelay: float = 0;
+    /** The sounds played without a channel, oldest first, by resource name. */
+    _soundVoices: Record<string, HowlerSound[]> = {};
+    /** The last time a sound was played without a channel, by resource name. */
+    _soundLastPlayTimes: Record<string, float> = {};
+
     /** Paused sounds or musics that should be played once the game is resumed.  */
     _pausedSounds: HowlerSound[] = [];
     _paused: boolean = false;
@@ -685,6 +701,7 @@ namespace gdjs {
       clearContainer(Object.values(this._musics));
       clearContainer(Object.values(this._sounds));
       clearContainer(this._pausedSounds);
+      if (!isMusic) delete this._soundVoices[resource.name];
 
       howl.unload();
       cacheContainer.delete(resource);
@@ -704,11 +721,102 @@ namespace gdjs {
       this._sounds = {};
       this._musics = {};
       this._pausedSounds.length = 0;
+      this._soundVoices = {};
       this._loadedMusics.clear();
       this._loadedSounds.clear();
     }
 
+    /**
+     * Set the maximum number of sounds of the same file that can be played at
+     * the same time without a channel.
+     * @param maxSoundVoices The maximum number of sounds, or 0 for no limit.
+     */
+    setMaxSoundVoices(maxSoundVoices: integer): void {
+      this._maxSoundVoices = Math.max(0, Math.floor(maxSoundVoices));
+    }
+
+    getMaxSoundVoices(): integer {
+      return this._maxSoundVoices;
+    }
+
+    /**
+     * Set the delay during which a sound played without a channel is ignored
+     * if played again (for example, when many objects collide at once).
+     * @param delay The delay in milliseconds, or 0 to always play the sounds.
+     */
+    setSoundDeduplicationDelay(delay: float): void {
+      this._soundDeduplicationDelay = Math.max(0, delay);
+    }
+
+    getSoundDeduplicationDelay(): float {
+      return this._soundDeduplicationDelay;
+    }
+
+    /**
+     * Make room for a new sound of the given resource played without a
+     * channel, by stopping an old one if there are too many.
+     *
+     * Sounds that are not looping are stopped first, as looping ones are
+     * usually ambient sounds that would be noticed.
+     *
+     * @returns The sounds of the resource, or null if the new sound must
+     * not be played.
+     */
+    private _reserveSoundVoice(resourceName: string): HowlerSound[] | null {
+      if (this._soundDeduplicationDelay > 0) {
+        const now = performance.now();
+        const lastPlayTime = this._soundLastPlayTimes[resourceName];
+        if (
+          lastPlayTime !== undefined &&
+          now - lastPlayTime < this._soundDeduplicationDelay
+        ) {
+          return null;
+        }
+        this._soundLastPlayTimes[resourceName] = now;
+      }
+
+      let voices = this._soundVoices[resourceName];
+      if (!voices) {
+        voices = this._soundVoices[resourceName] = [];
+      }
+      let voicesCount = 0;
+      for (let i = 0, len = voices.length; i < len; ++i) {
+        const voice = voices[i];
+        if (!voice.stopped()) {
+          voices[voicesCount++] = voice;
+        }
+      }
+      voices.length = voicesCount;
+      if (this._maxSoundVoices === 0 || voicesCount < this._maxSoundVoices) {
+        return voices;
+      }
+
+      // A loading sound can't be stopped: it will play once loaded.
+      let stolenVoiceIndex = -1;
+      for (let i = 0; i < voicesCount; ++i) {
+        const voice = voices[i];
+        if (!voice.isLoaded()) continue;
+        if (!voice.getLoop()) {
+          stolenVoiceIndex = i;
+          break;
+        }
+        if (stolenVoiceIndex === -1) stolenVoiceIndex = i;
+      }
+      if (stolenVoiceIndex === -1) {
+        return null;
+      }
+      voices[stolenVoiceIndex].stop();
+      voices.splice(stolenVoiceIndex, 1);
+      return voices;
+    }
+
     playSound(soundName: string, loop: boolean, volume: float, pitch: float) {
+      const resourceName = this._getAudioResource(soundName).name;
+      const voices = this._reserveSoundVoice(resourceName);
+      if (!voices) {
+        return;
+      }
+
       const sound = this.createHowlerSound(
         soundName,
         /* isMusic= */ false,
@@ -716,6 +824,7 @@ namespace gdjs {
         loop,
         pitch
       );
+      voices.push(sound);
       this._storeSoundInArray(this._freeSounds, sound);
       sound.once('play', () => {
         if (this._paused) {
@@ -858,6 +967,7 @@ namespace gdjs {
       this._sounds = {};
       this._musics = {};
       this._pausedSounds.length = 0;
+      this._soundVoices = {};
     }
 
     async processResource(resourceName: string): Promise<void> {
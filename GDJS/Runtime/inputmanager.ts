@@ -4,11 +4,13 @@
  * This project is released under the MIT License.
  */
 namespace gdjs {
-  type Touch = { x: float; y: float; justEnded: boolean };
-
   /**
    * Store input made on a canvas: mouse position, key pressed
    * and touches states.
+   *
+   * The states are stored in typed arrays allocated once (indexed by
+   * location-aware key codes and by touch slots), so that handling input
+   * events and checking the state of keys or touches don't allocate memory.
    */
   export class InputManager {
     static MOUSE_LEFT_BUTTON: integer = 0;
@@ -24,11 +26,30 @@ namespace gdjs {
      * if location is not specified.
      */
     static _DEFAULT_LEFT_VARIANT_KEYS: integer[] = [16, 17, 18, 91];
-    _pressedKeys: Hashtable<boolean>;
-    _releasedKeys: Hashtable<boolean>;
+
+    /**
+     * The number of location-aware key codes that can be stored (key codes
+     * are below 256 and locations are between 0 and 3).
+     */
+    static _KEY_CODES_COUNT: integer = 4096;
+
+    /**
+     * The maximum number of touches (including the mouse) stored at the same
+     * time. Other touches are ignored.
+     */
+    static MAX_TOUCHES_COUNT: integer = 32;
+
+    /** 1 for the pressed keys, by location-aware key code. */
+    _pressedKeys: Uint8Array;
+    /** 1 for the keys released during the frame, by location-aware key code. */
+    _releasedKeys: Uint8Array;
+    /** The number of keys pressed. */
+    _pressedKeysCount: integer = 0;
+    /** The location-aware key codes of the keys released during the frame. */
+    _releasedKeyCodes: integer[] = [];
     _lastPressedKey: float = 0;
-    _pressedMouseButtons: Array<boolean>;
-    _releasedMouseButtons: Array<boolean>;
+    _pressedMouseButtons: Uint8Array;
+    _releasedMouseButtons: Uint8Array;
     /**
      * The cursor X position (moved by mouse and touch events).
      */
@@ -51,16 +72,27 @@ namespace gdjs {
     // extension in the wild.
     _touches = {
       firstKey: (): string | number | null => {
-        for (const key in this._mouseOrTouches.items) {
+        for (let slot = 0; slot < this._touchesCount; slot++) {
           // Exclude mouse key.
-          if (key !== '1') {
-            return key;
+          const identifier = this._touchIdentifiers[slot];
+          if (identifier !== InputManager.MOUSE_TOUCH_ID) {
+            return identifier;
           }
         }
         return null;
       },
     };
-    _mouseOrTouches: Hashtable<Touch>;
+
+    /**
+     * The identifiers of the mouse and the touches, by slot. Only the first
+     * `_touchesCount` slots are used.
+     */
+    _touchIdentifiers: Int32Array;
+    _touchesX: Float64Array;
+    _touchesY: Float64Array;
+    /** 1 for the touches that ended during the frame, by slot. */
+    _touchesJustEnded: Uint8Array;
+    _touchesCount: integer = 0;
     //Identifiers of the touches that started during/before the frame.
     _startedTouches: Array<integer> = [];
 
@@ -78,11 +110,21 @@ namespace gdjs {
     _lastEndedTouchIndex = 0;
 
     constructor() {
-      this._pressedKeys = new Hashtable();
-      this._releasedKeys = new Hashtable();
-      this._pressedMouseButtons = new Array(5);
-      this._releasedMouseButtons = new Array(5);
-      this._mouseOrTouches = new Hashtable();
+      this._pressedKeys = new Uint8Array(InputManager._KEY_CODES_COUNT);
+      this._releasedKeys = new Uint8Array(InputManager._KEY_CODES_COUNT);
+      this._pressedMouseButtons = new Uint8Array(5);
+      this._releasedMouseButtons = new Uint8Array(5);
+      this._touchIdentifiers = new Int32Array(InputManager.MAX_TOUCHES_COUNT);
+      this._touchesX = new Float64Array(InputManager.MAX_TOUCHES_COUNT);
+      this._touchesY = new Float64Array(InputManager.MAX_TOUCHES_COUNT);
+      this._touchesJustEnded = new Uint8Array(InputManager.MAX_TOUCHES_COUNT);
+    }
+
+    static _isStoredKeyCode(locationAwareKeyCode: number): boolean {
+      return (
+        locationAwareKeyCode >= 0 &&
+        locationAwareKeyCode < InputManager._KEY_CODES_COUNT
+      );
     }
 
     /**
@@ -123,8 +165,14 @@ namespace gdjs {
         keyCode,
         location
       );
-      this._pressedKeys.put(locationAwareKeyCode, true);
       this._lastPressedKey = locationAwareKeyCode;
+      if (!InputManager._isStoredKeyCode(locationAwareKeyCode)) {
+        return;
+      }
+      if (!this._pressedKeys[locationAwareKeyCode]) {
+        this._pressedKeys[locationAwareKeyCode] = 1;
+        this._pressedKeysCount++;
+      }
     }
 
     /**
@@ -139,8 +187,17 @@ namespace gdjs {
         keyCode,
         location
       );
-      this._pressedKeys.put(locationAwareKeyCode, false);
-      this._releasedKeys.put(locationAwareKeyCode, true);
+      if (!InputManager._isStoredKeyCode(locationAwareKeyCode)) {
+        return;
+      }
+      if (this._pressedKeys[locationAwareKeyCode]) {
+        this._pressedKeys[locationAwareKeyCode] = 0;
+        this._pressedKeysCount--;
+      }
+      if (!this._releasedKeys[locationAwareKeyCode]) {
+        this._releasedKeys[locationAwareKeyCode] = 1;
+        this._releasedKeyCodes.push(locationAwareKeyCode);
+      }
     }
 
     /**
@@ -156,10 +213,7 @@ namespace gdjs {
      * @param locationAwareKeyCode The location-aware key code to be tested.
      */
     isKeyPressed(locationAwareKeyCode: number): boolean {
-      return (
-        this._pressedKeys.containsKey(locationAwareKeyCode) &&
-        this._pressedKeys.get(locationAwareKeyCode)
-      );
+      return this._pressedKeys[locationAwareKeyCode] === 1;
     }
 
     /**
@@ -167,10 +221,7 @@ namespace gdjs {
      * @param locationAwareKeyCode The location-aware key code to be tested.
      */
     wasKeyReleased(locationAwareKeyCode: number) {
-      return (
-        this._releasedKeys.containsKey(locationAwareKeyCode) &&
-        this._releasedKeys.get(locationAwareKeyCode)
-      );
+      return this._releasedKeys[locationAwareKeyCode] === 1;
     }
 
     /**
@@ -178,28 +229,14 @@ namespace gdjs {
      * @return true if any key is pressed.
      */
     anyKeyPressed(): boolean {
-      for (const keyCode in this._pressedKeys.items) {
-        if (this._pressedKeys.items.hasOwnProperty(keyCode)) {
-          if (this._pressedKeys.items[keyCode]) {
-            return true;
-          }
-        }
-      }
-      return false;
+      return this._pressedKeysCount > 0;
     }
     /**
      * Return true if any key is released.
      * @return true if any key is released.
      */
     anyKeyReleased(): boolean {
-      for (const keyCode in this._releasedKeys.items) {
-        if (this._releasedKeys.items.hasOwnProperty(keyCode)) {
-          if (this._releasedKeys.items[keyCode]) {
-            return true;
-          }
-        }
-      }
-      return false;
+      return this._releasedKeyCodes.length > 0;
     }
 
     /**
@@ -304,8 +341,8 @@ namespace gdjs {
     }
 
     _setMouseButtonPressed(buttonCode: number): void {
-      this._pressedMouseButtons[buttonCode] = true;
-      this._releasedMouseButtons[buttonCode] = false;
+      this._pressedMouseButtons[buttonCode] = 1;
+      this._releasedMouseButtons[buttonCode] = 0;
     }
 
     /**
@@ -320,8 +357,8 @@ namespace gdjs {
     }
 
     _setMouseButtonReleased(buttonCode: number): void {
-      this._pressedMouseButtons[buttonCode] = false;
-      this._releasedMouseButtons[buttonCode] = true;
+      this._pressedMouseButtons[buttonCode] = 0;
+      this._releasedMouseButtons[buttonCode] = 1;
     }
 
     /**
@@ -329,10 +366,7 @@ namespace gdjs {
      * @param buttonCode The mouse button code (0: Left button, 1: Right button).
      */
     isMouseButtonPressed(buttonCode: number): boolean {
-      return (
-        this._pressedMouseButtons[buttonCode] !== undefined &&
-        this._pressedMouseButtons[buttonCode]
-      );
+      return this._pressedMouseButtons[buttonCode] === 1;
     }
 
     /**
@@ -340,10 +374,7 @@ namespace gdjs {
      * @param buttonCode The mouse button code (0: Left button, 1: Right button).
      */
     isMouseButtonReleased(buttonCode: number): boolean {
-      return (
-        this._releasedMouseButtons[buttonCode] !== undefined &&
-        this._releasedMouseButtons[buttonCode]
-      );
+      return this._releasedMouseButtons[buttonCode] === 1;
     }
 
     /**
@@ -367,10 +398,8 @@ namespace gdjs {
      * @return the touch X position, relative to the game view.
      */
     getTouchX(publicIdentifier: integer): float {
-      if (!this._mouseOrTouches.containsKey(publicIdentifier)) {
-        return 0;
-      }
-      return this._mouseOrTouches.get(publicIdentifier).x;
+      const slot = this._getTouchSlot(publicIdentifier);
+      return slot === -1 ? 0 : this._touchesX[slot];
     }
 
     /**
@@ -379,10 +408,22 @@ namespace gdjs {
      * @return the touch Y position, relative to the game view.
      */
     getTouchY(publicIdentifier: integer): float {
-      if (!this._mouseOrTouches.containsKey(publicIdentifier)) {
-        return 0;
+      const slot = this._getTouchSlot(publicIdentifier);
+      return slot === -1 ? 0 : this._touchesY[slot];
+    }
+
+    /**
+     * Return the slot of the touch in the arrays of touches, or -1 if the
+     * touch doesn't exist.
+     */
+    _getTouchSlot(publicIdentifier: integer): integer {
+      const touchIdentifiers = this._touchIdentifiers;
+      for (let slot = 0; slot < this._touchesCount; slot++) {
+        if (touchIdentifiers[slot] === publicIdentifier) {
+          return slot;
+        }
       }
-      return this._mouseOrTouches.get(publicIdentifier).y;
+      return -1;
     }
 
     /**
@@ -393,23 +434,26 @@ namespace gdjs {
       // A touch that end then start in one frame is ignored
       // because it's probably noise.
       // See _addTouch
-      if (!this._mouseOrTouches.containsKey(publicIdentifier)) {
-        return false;
-      }
-      return this._mouseOrTouches.get(publicIdentifier).justEnded;
+      const slot = this._getTouchSlot(publicIdentifier);
+      return slot !== -1 && this._touchesJustEnded[slot] === 1;
     }
 
     /**
      * Update and return the array containing the identifiers of all touches.
      */
     getAllTouchIdentifiers(): Array<integer> {
-      InputManager._allTouchIds.length = 0;
-      for (const id in this._mouseOrTouches.items) {
-        if (this._mouseOrTouches.items.hasOwnProperty(id)) {
-          InputManager._allTouchIds.push(parseInt(id, 10));
-        }
+      const allTouchIds = InputManager._allTouchIds;
+      allTouchIds.length = 0;
+      for (let slot = 0; slot < this._touchesCount; slot++) {
+        allTouchIds.push(this._touchIdentifiers[slot]);
       }
-      return InputManager._allTouchIds;
+      // Give the identifiers in the order they always had.
+      allTouchIds.sort(InputManager._compareNumbers);
+      return allTouchIds;
+    }
+
+    static _compareNumbers(a: number, b: number): number {
+      return a - b;
     }
 
     onTouchStart(rawIdentifier: integer, x: float, y: float): void {
@@ -423,14 +467,21 @@ namespace gdjs {
     _addTouch(publicIdentifier: integer, x: float, y: float): void {
       // A touch that end then start in one frame is ignored
       // because it's probably noise.
-      if (!this._endedTouches.includes(publicIdentifier)) {
-        this._startedTouches.push(publicIdentifier);
-        this._mouseOrTouches.put(publicIdentifier, {
-          x: x,
-          y: y,
-          justEnded: false,
-        });
+      if (this._endedTouches.includes(publicIdentifier)) {
+        return;
+      }
+      let slot = this._getTouchSlot(publicIdentifier);
+      if (slot === -1) {
+        if (this._touchesCount >= InputManager.MAX_TOUCHES_COUNT) {
+          return;
+        }
+        slot = this._touchesCount++;
+        this._touchIdentifiers[slot] = publicIdentifier;
       }
+      this._startedTouches.push(publicIdentifier);
+      this._touchesX[slot] = x;
+      this._touchesY[slot] = y;
+      this._touchesJustEnded[slot] = 0;
     }
 
     onTouchMove(rawIdentifier: integer, x: float, y: float): void {
@@ -441,12 +492,12 @@ namespace gdjs {
     }
 
     _moveTouch(publicIdentifier: integer, x: float, y: float): void {
-      const touch = this._mouseOrTouches.get(publicIdentifier);
-      if (!touch) {
+      const slot = this._getTouchSlot(publicIdentifier);
+      if (slot === -1) {
         return;
       }
-      touch.x = x;
-      touch.y = y;
+      this._touchesX[slot] = x;
+      this._touchesY[slot] = y;
     }
 
     onTouchEnd(rawIdentifier: number): void {
@@ -464,9 +515,10 @@ namespace gdjs {
 
     _removeTouch(publicIdentifier: number): void {
       this._endedTouches.push(publicIdentifier);
-      if (this._mouseOrTouches.containsKey(publicIdentifier)) {
+      const slot = this._getTouchSlot(publicIdentifier);
+      if (slot !== -1) {
         //Postpone deletion at the end of the frame
-        this._mouseOrTouches.get(publicIdentifier).justEnded = true;
+        this._touchesJustEnded[slot] = 1;
       }
     }
 
@@ -533,18 +585,23 @@ namespace gdjs {
      */
     onFrameEnded(): void {
       //Only clear the ended touches at the end of the frame.
-      for (const id in this._mouseOrTouches.items) {
-        if (this._mouseOrTouches.items.hasOwnProperty(id)) {
-          const touch = this._mouseOrTouches.items[id];
-          if (touch.justEnded) {
-            this._mouseOrTouches.remove(id);
-          }
+      for (let slot = this._touchesCount - 1; slot >= 0; slot--) {
+        if (this._touchesJustEnded[slot]) {
+          // Move the last touch in the slot of the ended one.
+          const lastSlot = --this._touchesCount;
+          this._touchIdentifiers[slot] = this._touchIdentifiers[lastSlot];
+          this._touchesX[slot] = this._touchesX[lastSlot];
+          this._touchesY[slot] = this._touchesY[lastSlot];
+          this._touchesJustEnded[slot] = this._touchesJustEnded[lastSlot];
         }
       }
       this._startedTouches.length = 0;
       this._endedTouches.length = 0;
-      this._releasedKeys.clear();
-      this._releasedMouseButtons.length = 0;
+      for (let i = 0; i < this._releasedKeyCodes.length; i++) {
+        this._releasedKeys[this._releasedKeyCodes[i]] = 0;
+      }
+      this._releasedKeyCodes.length = 0;
+      this._releasedMouseButtons.fill(0);
       this._mouseWheelDelta = 0;
       this._lastStartedTouchIndex = 0;
       this._lastEndedTouchIndex = 0;
@@ -569,7 +626,8 @@ namespace gdjs {
      * the release state.
      */
     clearAllPressedKeys(): void {
-      this._pressedKeys.clear();
+      this._pressedKeys.fill(0);
+      this._pressedKeysCount = 0;
     }
 
     static _allTouchIds: Array<integer> = [];
@@ -7,6 +7,9 @@
 namespace gdjs {
   const logger = new gdjs.Logger('LayerPixiRenderer');
 
+  const compareZOrders = (a: PIXI.DisplayObject, b: PIXI.DisplayObject) =>
+    a.zIndex - b.zIndex;
+
   /**
    * The renderer for a gdjs.Layer using Pixi.js.
    */
@@ -48,11 +51,6 @@ namespace gdjs {
     private _threePlaneMaterial: THREE.ShaderMaterial | null = null;
     private _threePlaneMesh: THREE.Mesh | null = null;
 
-    /**
-     * Pixi doesn't sort children with zIndex == 0.
-     */
-    private static readonly zeroZOrderForPixi = Math.pow(2, -24);
-
     private static vectorForProjections: THREE.Vector3 | null = null;
 
     /**
@@ -65,7 +63,10 @@ namespace gdjs {
       runtimeGameRenderer: gdjs.RuntimeGameRenderer
     ) {
       this._pixiContainer = new PIXI.Container();
-      this._pixiContainer.sortableChildren = true;
+      // Children are kept sorted by z order when they are added or when their
+      // z order changes (see `_moveChildToZOrder`), instead of letting PIXI
+      // sort all the children again when a z order changes.
+      this._pixiContainer.sortableChildren = false;
       this._layer = layer;
       this._isLightingLayer = layer.isLightingLayer();
       const parentRendererObject =
@@ -601,8 +602,24 @@ namespace gdjs {
      */
     addRendererObject(pixiChild, zOrder: float): void {
       const child = pixiChild as PIXI.DisplayObject;
-      child.zIndex = zOrder || LayerPixiRenderer.zeroZOrderForPixi;
-      this._pixiContainer.addChild(child);
+      if (child.parent) {
+        child.parent.removeChild(child);
+      }
+      child.zIndex = zOrder;
+      const children = this._pixiContainer.children;
+      // Children having the same z order are displayed in the order they
+      // were added.
+      let lowIndex = 0;
+      let highIndex = children.length;
+      while (lowIndex < highIndex) {
+        const middleIndex = (lowIndex + highIndex) >>> 1;
+        if (children[middleIndex].zIndex <= zOrder) {
+          lowIndex = middleIndex + 1;
+        } else {
+          highIndex = middleIndex;
+        }
+      }
+      this._pixiContainer.addChildAt(child, lowIndex);
     }
 
     /**
@@ -613,7 +630,93 @@ namespace gdjs {
      */
     changeRendererObjectZOrder(pixiChild, newZOrder: float): void {
       const child = pixiChild as PIXI.DisplayObject;
+      const oldZOrder = child.zIndex;
       child.zIndex = newZOrder;
+      if (oldZOrder === newZOrder || child.parent !== this._pixiContainer) {
+        return;
+      }
+      this._moveChildToZOrder(child, oldZOrder, newZOrder);
+    }
+
+    /**
+     * Move a child to keep the children sorted by z order, like PIXI does
+     * (children having the same z order keep their relative order).
+     *
+     * Only a binary search is done to find the old and the new indexes of the
+     * child, and only the children between these indexes are shifted.
+     */
+    private _moveChildToZOrder(
+      child: PIXI.DisplayObject,
+      oldZOrder: float,
+      newZOrder: float
+    ): void {
+      const children = this._pixiContainer.children;
+
+      // Find the child in the children having the old z order.
+      let lowIndex = 0;
+      let highIndex = children.length;
+      while (lowIndex < highIndex) {
+        const middleIndex = (lowIndex + highIndex) >>> 1;
+        if (children[middleIndex].zIndex < oldZOrder) {
+          lowIndex = middleIndex + 1;
+        } else {
+          highIndex = middleIndex;
+        }
+      }
+      let oldIndex = lowIndex;
+      while (oldIndex < children.length && children[oldIndex] !== child) {
+        oldIndex++;
+      }
+      if (oldIndex === children.length) {
+        // The children are not sorted (for instance if a child was added
+        // directly to the container): sort all of them.
+        children.sort(compareZOrders);
+        return;
+      }
+
+      // Nothing to do if the child is still between its neighbors.
+      const isAfterPrevious =
+        oldIndex === 0 || children[oldIndex - 1].zIndex <= newZOrder;
+      const isBeforeNext =
+        oldIndex === children.length - 1 ||
+        children[oldIndex + 1].zIndex >= newZOrder;
+      if (isAfterPrevious && isBeforeNext) {
+        return;
+      }
+
+      // Find the new index of the child (ignoring the child itself).
+      if (isAfterPrevious) {
+        lowIndex = oldIndex + 1;
+        highIndex = children.length;
+      } else {
+        lowIndex = 0;
+        highIndex = oldIndex;
+      }
+      while (lowIndex < highIndex) {
+        const middleIndex = (lowIndex + highIndex) >>> 1;
+        const middleZOrder = children[middleIndex].zIndex;
+        if (
+          middleZOrder < newZOrder ||
+          (middleZOrder === newZOrder && middleIndex < oldIndex)
+        ) {
+          lowIndex = middleIndex + 1;
+        } else {
+          highIndex = middleIndex;
+        }
+      }
+      // lowIndex is the index of the first child to display after the child.
+      if (lowIndex > oldIndex) {
+        const newIndex = lowIndex - 1;
+        for (let index = oldIndex; index < newIndex; index++) {
+          children[index] = children[index + 1];
+        }
+        children[newIndex] = child;
+      } else {
+        for (let index = oldIndex; index > lowIndex; index--) {
+          children[index] = children[index - 1];
+        }
+        children[lowIndex] = child;
+      }
     }
 
     /**
@@ -244,6 +244,55 @@ namespace gdjs {
       }
     }
 
+    /**
+     * Given a text style, returns a PIXI.BitmapFont with the glyphs of all
+     * the printable ASCII characters, and of the other given characters,
+     * drawn with this style. The fonts are shared by all the objects using
+     * the same style.
+     *
+     * The font is registered and should be released with `releaseBitmapFont`
+     * - so that it can be removed from memory when unused.
+     * @param style The style of the glyphs.
+     * @param extraCharacters The characters to add to the printable ASCII
+     * characters (each one only once, in the same order for a same set of
+     * characters).
+     */
+    obtainBitmapFontFromTextStyle(
+      style: PIXI.TextStyle,
+      extraCharacters: string
+    ): PIXI.BitmapFont {
+      const bitmapFontInstallKey =
+        'GDJS-TEXT-STYLE@' +
+        JSON.stringify([
+          style.fontFamily,
+          style.fontSize,
+          style.fontStyle,
+          style.fontWeight,
+          style.fill,
+          style.fillGradientType,
+          style.stroke,
+          style.strokeThickness,
+          style.dropShadow,
+          style.dropShadowColor,
+          style.dropShadowAlpha,
+          style.dropShadowBlur,
+          style.dropShadowAngle,
+          style.dropShadowDistance,
+          style.padding,
+        ]) +
+        '@' +
+        extraCharacters;
+
+      if (!PIXI.BitmapFont.available[bitmapFontInstallKey]) {
+        PIXI.BitmapFont.from(bitmapFontInstallKey, style, {
+          // All the printable ASCII characters
+          chars: [[' ', '~'], extraCharacters],
+        });
+      }
+      this._markBitmapFontAsUsed(bitmapFontInstallKey);
+      return PIXI.BitmapFont.available[bitmapFontInstallKey];
+    }
+
     async processResource(resourceName: string): Promise<void> {
       // Do nothing because fonts are light enough to be parsed in background.
     }
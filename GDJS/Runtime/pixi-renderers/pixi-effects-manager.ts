@@ -58,6 +58,64 @@ namespace gdjs {
       return true;
     }
 
+    /**
+     * Compile the shader programs of the given effects, so that they are not
+     * compiled during the first frame where the effects are rendered.
+     *
+     * A filter is created for each effect type (and thrown away): PixiJS
+     * shares the programs of filters having the same shaders, so the objects
+     * and layers using these effects will reuse the compiled programs.
+     * @param effectsData The effects to compile, usually the ones of a scene.
+     * @param target The effects target used to create the filters.
+     * @returns The number of programs that were compiled.
+     */
+    prewarmEffects(effectsData: EffectData[], target: EffectsTarget): integer {
+      const pixiRenderer = target
+        .getRuntimeScene()
+        .getGame()
+        .getRenderer()
+        .getPIXIRenderer();
+      if (!(pixiRenderer instanceof PIXI.Renderer)) {
+        return 0;
+      }
+
+      const prewarmedEffectTypes = new Set<string>();
+      const compiledPrograms = new Set<PIXI.Program>();
+      for (const effectData of effectsData) {
+        if (prewarmedEffectTypes.has(effectData.effectType)) {
+          continue;
+        }
+        prewarmedEffectTypes.add(effectData.effectType);
+
+        const filterCreator = gdjs.PixiFiltersTools.getFilterCreator(
+          effectData.effectType
+        );
+        if (!filterCreator) {
+          continue;
+        }
+        try {
+          const filter = filterCreator.makeFilter(target, effectData);
+          if (!(filter instanceof gdjs.PixiFiltersTools.PixiFilter)) {
+            continue;
+          }
+          const program = filter.pixiFilter.program;
+          if (!program || compiledPrograms.has(program)) {
+            continue;
+          }
+          // Binding the filter without syncing its uniforms is enough for
+          // PixiJS to generate the program for the WebGL context.
+          pixiRenderer.shader.bind(filter.pixiFilter, true);
+          compiledPrograms.add(program);
+        } catch (error) {
+          console.warn(
+            `Unable to prewarm the effect type "${effectData.effectType}":`,
+            error
+          );
+        }
+      }
+      return compiledPrograms.size;
+    }
+
     /**
      * Update the filters applied on a PixiJS DisplayObject.
      * This must be called after the events and before the rendering.
@@ -63,6 +63,17 @@ namespace gdjs {
 
     private _resourceLoader: gdjs.ResourceLoader;
 
+    /**
+     * Textures that are loaded but not yet uploaded to the GPU.
+     * @see uploadPendingTextures
+     */
+    private _texturesToUpload: PIXI.BaseTexture[] = [];
+    /**
+     * The maximum time (in milliseconds) spent in each frame to upload
+     * textures to the GPU.
+     */
+    private _texturesUploadTimeBudget: float = 2;
+
     /**
      * @param resourceLoader The resources loader of the game.
      */
@@ -386,12 +397,66 @@ namespace gdjs {
           this._loadedTextures.set(resource, loadedTexture);
           // TODO What if 2 assets share the same file with different settings?
           applyTextureSettings(loadedTexture, resource);
+          this._texturesToUpload.push(loadedTexture.baseTexture);
         }
       } catch (error) {
         logFileLoadingError(resource.file, error);
       }
     }
 
+    /**
+     * Upload to the GPU, within the time budget of a frame, some of the
+     * textures that were loaded (usually in background for the next scenes)
+     * but not rendered yet. Otherwise, they would all be uploaded when they are
+     * rendered for the first time, which makes the first frames of a scene
+     * slow.
+     * @param pixiRenderer The renderer that will render the textures.
+     */
+    uploadPendingTextures(pixiRenderer: PIXI.Renderer): void {
+      if (
+        this._texturesToUpload.length === 0 ||
+        this._texturesUploadTimeBudget <= 0
+      ) {
+        return;
+      }
+      const startTime = performance.now();
+      let processedCount = 0;
+      while (
+        processedCount < this._texturesToUpload.length &&
+        performance.now() - startTime < this._texturesUploadTimeBudget
+      ) {
+        const baseTexture = this._texturesToUpload[processedCount];
+        processedCount++;
+        if (
+          baseTexture.destroyed ||
+          !baseTexture.valid ||
+          baseTexture._glTextures[pixiRenderer.CONTEXT_UID]
+        ) {
+          // The texture was unloaded or is already on the GPU.
+          continue;
+        }
+        pixiRenderer.texture.bind(baseTexture);
+      }
+      this._texturesToUpload.splice(0, processedCount);
+    }
+
+    /**
+     * @returns The maximum time (in milliseconds) spent in each frame to
+     * upload the loaded textures to the GPU.
+     */
+    getTexturesUploadTimeBudget(): float {
+      return this._texturesUploadTimeBudget;
+    }
+
+    /**
+     * Change the maximum time spent in each frame to upload the loaded textures
+     * to the GPU. Textures are then only uploaded when rendered if it's 0.
+     * @param timeBudget The time budget in milliseconds.
+     */
+    setTexturesUploadTimeBudget(timeBudget: float): void {
+      this._texturesUploadTimeBudget = Math.max(0, timeBudget);
+    }
+
     /**
      * Return a texture containing a circle filled with white.
      * @param radius The circle radius
@@ -477,6 +542,7 @@ namespace gdjs {
      */
     dispose(): void {
       this._loadedTextures.clear();
+      this._texturesToUpload.length = 0;
 
       const threeTextures: THREE.Texture[] = [];
       this._loadedThreeTextures.values(threeTextures);
@@ -550,6 +616,20 @@ namespace gdjs {
         }
       });
     }
+
+    /**
+     * Return an estimation of the memory used by the texture of the specified
+     * resource (4 bytes per pixel), or 0 if it's not loaded.
+     *
+     * @param resource The resource of the texture
+     */
+    getResourceMemorySize(resource: ResourceData): number {
+      const texture = this._loadedTextures.getFromName(resource.name);
+      if (!texture || !texture.baseTexture || texture.baseTexture.destroyed) {
+        return 0;
+      }
+      return texture.baseTexture.realWidth * texture.baseTexture.realHeight * 4;
+    }
   }
 
   //Register the class to let the engine use it.
@@ -46,6 +46,23 @@ namespace gdjs {
 
     _wasDisposed: boolean = false;
 
+    /**
+     * The input manager given to `bindStandardEvents`, which receives the
+     * pointer moves.
+     */
+    private _inputManager: gdjs.InputManager | null = null;
+    /**
+     * Pointer moves are coalesced: only the last position of the mouse and of
+     * each touch is converted and given to the input manager, once per frame
+     * (see `_flushPendingPointerMoves`).
+     */
+    private _hasPendingMouseMove: boolean = false;
+    private _pendingMousePageX: float = 0;
+    private _pendingMousePageY: float = 0;
+    private _pendingTouchMoveIdentifiers: integer[] = [];
+    private _pendingTouchMovePagesX: float[] = [];
+    private _pendingTouchMovePagesY: float[] = [];
+
     /**
      * @param game The game that is being rendered
      * @param forceFullscreen If fullscreen should be always activated
@@ -573,18 +590,7 @@ namespace gdjs {
       this._throwIfDisposed();
       const canvas = this._gameCanvas;
       if (!canvas) return;
-
-      const isInsideCanvas = (e: MouseEvent | Touch) => {
-        const x = e.pageX - canvas.offsetLeft;
-        const y = e.pageY - canvas.offsetTop;
-
-        return (
-          0 <= x &&
-          x < (this._canvasWidth || 1) &&
-          0 <= y &&
-          y < (this._canvasHeight || 1)
-        );
-      };
+      this._inputManager = manager;
 
       // Some browsers lacks definition of some variables used to do calculations
       // in convertPageToGameCoords. They are defined to 0 as they are useless.
@@ -691,10 +697,12 @@ namespace gdjs {
         return button;
       }
       canvas.onmousemove = (e) => {
-        const pos = this.convertPageToGameCoords(e.pageX, e.pageY);
-        manager.onMouseMove(pos[0], pos[1]);
+        this._hasPendingMouseMove = true;
+        this._pendingMousePageX = e.pageX;
+        this._pendingMousePageY = e.pageY;
       };
       canvas.onmousedown = (e) => {
+        this._flushPendingPointerMoves();
         const pos = this.convertPageToGameCoords(e.pageX, e.pageY);
         manager.onMouseMove(pos[0], pos[1]);
         manager.onMouseButtonPressed(
@@ -705,16 +713,19 @@ namespace gdjs {
         }
         return false;
       };
-      canvas.onmouseup = function (e) {
+      canvas.onmouseup = (e) => {
+        this._flushPendingPointerMoves();
         manager.onMouseButtonReleased(
           convertHtmlMouseButtonToInputManagerMouseButton(e.button)
         );
         return false;
       };
-      canvas.onmouseleave = function (e) {
+      canvas.onmouseleave = (e) => {
+        this._flushPendingPointerMoves();
         manager.onMouseLeave();
       };
-      canvas.onmouseenter = function (e) {
+      canvas.onmouseenter = (e) => {
+        this._flushPendingPointerMoves();
         manager.onMouseEnter();
         // There is no mouse event when the cursor is outside of the canvas.
         // We catchup what happened.
@@ -771,20 +782,15 @@ namespace gdjs {
           if (e.changedTouches) {
             for (let i = 0; i < e.changedTouches.length; ++i) {
               const touch = e.changedTouches[i];
-              const pos = this.convertPageToGameCoords(
-                touch.pageX,
-                touch.pageY
+              let index = this._pendingTouchMoveIdentifiers.indexOf(
+                touch.identifier
               );
-              manager.onTouchMove(touch.identifier, pos[0], pos[1]);
-              // This works because touch events are sent
-              // when they continue outside of the canvas.
-              if (manager.isSimulatingMouseWithTouch()) {
-                if (isInsideCanvas(touch)) {
-                  manager.onMouseEnter();
-                } else {
-                  manager.onMouseLeave();
-                }
+              if (index === -1) {
+                index = this._pendingTouchMoveIdentifiers.length;
+                this._pendingTouchMoveIdentifiers.push(touch.identifier);
               }
+              this._pendingTouchMovePagesX[index] = touch.pageX;
+              this._pendingTouchMovePagesY[index] = touch.pageY;
             }
           }
         },
@@ -802,6 +808,7 @@ namespace gdjs {
           }
 
           e.preventDefault();
+          this._flushPendingPointerMoves();
           if (e.changedTouches) {
             for (let i = 0; i < e.changedTouches.length; ++i) {
               const touch = e.changedTouches[i];
@@ -823,7 +830,7 @@ namespace gdjs {
       );
       window.addEventListener(
         'touchend',
-        function (e) {
+        (e) => {
           if (isTargetDomElement(e)) {
             // Bail out if the game canvas is not focused. For example,
             // an `<input>` element can be focused, and needs to receive
@@ -832,6 +839,7 @@ namespace gdjs {
           }
 
           e.preventDefault();
+          this._flushPendingPointerMoves();
           if (e.changedTouches) {
             for (let i = 0; i < e.changedTouches.length; ++i) {
               manager.onTouchEnd(e.changedTouches[i].identifier);
@@ -844,7 +852,7 @@ namespace gdjs {
       );
       window.addEventListener(
         'touchcancel',
-        function (e) {
+        (e) => {
           if (isTargetDomElement(e)) {
             // Bail out if the game canvas is not focused. For example,
             // an `<input>` element can be focused, and needs to receive
@@ -853,6 +861,7 @@ namespace gdjs {
           }
 
           e.preventDefault();
+          this._flushPendingPointerMoves();
           if (e.changedTouches) {
             for (let i = 0; i < e.changedTouches.length; ++i) {
               manager.onTouchCancel(e.changedTouches[i].identifier);
@@ -865,6 +874,60 @@ namespace gdjs {
       );
     }
 
+    private _isPageCoordsInsideCanvas(pageX: float, pageY: float): boolean {
+      const canvas = this._gameCanvas;
+      if (!canvas) return false;
+      const x = pageX - canvas.offsetLeft;
+      const y = pageY - canvas.offsetTop;
+
+      return (
+        0 <= x &&
+        x < (this._canvasWidth || 1) &&
+        0 <= y &&
+        y < (this._canvasHeight || 1)
+      );
+    }
+
+    /**
+     * Give the last positions of the mouse and of the touches that moved
+     * since the last call to the input manager.
+     *
+     * This is done before each frame and before handling the other pointer
+     * events (so that they are still received in order), rather than for
+     * each move event: a lot of move events can be sent during a frame and
+     * converting their positions reads the canvas offsets, which can trigger
+     * a layout of the page.
+     */
+    private _flushPendingPointerMoves(): void {
+      const manager = this._inputManager;
+      if (!manager) return;
+      if (this._hasPendingMouseMove) {
+        this._hasPendingMouseMove = false;
+        const pos = this.convertPageToGameCoords(
+          this._pendingMousePageX,
+          this._pendingMousePageY
+        );
+        manager.onMouseMove(pos[0], pos[1]);
+      }
+      const touchIdentifiers = this._pendingTouchMoveIdentifiers;
+      for (let i = 0; i < touchIdentifiers.length; i++) {
+        const pageX = this._pendingTouchMovePagesX[i];
+        const pageY = this._pendingTouchMovePagesY[i];
+        const pos = this.convertPageToGameCoords(pageX, pageY);
+        manager.onTouchMove(touchIdentifiers[i], pos[0], pos[1]);
+        // This works because touch events are sent
+        // when they continue outside of the canvas.
+        if (manager.isSimulatingMouseWithTouch()) {
+          if (this._isPageCoordsInsideCanvas(pageX, pageY)) {
+            manager.onMouseEnter();
+          } else {
+            manager.onMouseLeave();
+          }
+        }
+      }
+      touchIdentifiers.length = 0;
+    }
+
     setWindowTitle(title): void {
       if (typeof document !== 'undefined') {
         document.title = title;
@@ -885,6 +948,7 @@ namespace gdjs {
 
         const dt = oldTime ? time - oldTime : 0;
         oldTime = time;
+        this._flushPendingPointerMoves();
         if (!fn(dt)) {
           // Stop the game loop if requested.
           cancelAnimationFrame(this._nextFrameId);
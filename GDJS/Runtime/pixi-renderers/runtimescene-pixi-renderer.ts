@@ -82,6 +82,13 @@ namespace gdjs {
       // not interfere with the headset's rendering.
       if (threeRenderer && threeRenderer.xr.isPresenting) return;
 
+      // Spread the upload of the textures loaded in background across frames.
+      // It's done before the rendering, which resets the WebGL states.
+      this._runtimeScene
+        .getGame()
+        .getImageManager()
+        .uploadPendingTextures(pixiRenderer);
+
       this._layerRenderingMetrics.rendered2DLayersCount = 0;
       this._layerRenderingMetrics.rendered3DLayersCount = 0;
 
@@ -48,19 +48,44 @@ namespace gdjs {
   const collisionTestStatics: {
     minMaxA: FloatPoint;
     minMaxB: FloatPoint;
-    edge: FloatPoint;
-    axis: FloatPoint;
     move_axis: FloatPoint;
     result: CollisionTestResult;
   } = {
     minMaxA: [0, 0],
     minMaxB: [0, 0],
-    edge: [0, 0],
-    axis: [0, 0],
     move_axis: [0, 0],
     result: makeNewCollisionTestResult(),
   };
 
+  /**
+   * Project the vertices on an axis.
+   * @param axisX The axis X coordinate (it should be normalized).
+   * @param axisY The axis Y coordinate (it should be normalized).
+   * @param vertices The vertices to project (at least one).
+   * @param result The minimum and the maximum of the projections.
+   */
+  const projectVertices = (
+    axisX: float,
+    axisY: float,
+    vertices: Array<FloatPoint>,
+    result: FloatPoint
+  ): void => {
+    const firstVertex = vertices[0];
+    let min = axisX * firstVertex[0] + axisY * firstVertex[1];
+    let max = min;
+    for (let i = 1, len = vertices.length; i < len; ++i) {
+      const vertex = vertices[i];
+      const dp = axisX * vertex[0] + axisY * vertex[1];
+      if (dp < min) {
+        min = dp;
+      } else if (dp > max) {
+        max = dp;
+      }
+    }
+    result[0] = min;
+    result[1] = max;
+  };
+
   /**
    * Arrays and data structure that are (re)used by Polygon.raycastTest to
    * avoid any allocation.
@@ -112,6 +137,9 @@ namespace gdjs {
     }
 
     rotate(angle: float): void {
+      if (angle === 0) {
+        return;
+      }
       let t: float = 0;
 
       //We want a clockwise rotation
@@ -211,47 +239,47 @@ namespace gdjs {
       ignoreTouchingEdges: boolean
     ): CollisionTestResult {
       //Algorithm core :
-      p1.computeEdges();
-      p2.computeEdges();
-      let edge = collisionTestStatics.edge;
       const move_axis = collisionTestStatics.move_axis;
       const result = collisionTestStatics.result;
+      const minMaxA = collisionTestStatics.minMaxA;
+      const minMaxB = collisionTestStatics.minMaxB;
+      const vertices1 = p1.vertices;
+      const vertices2 = p2.vertices;
       let minDist = Number.MAX_VALUE;
-      edge[0] = 0;
-      edge[1] = 0;
-      edge[0] = 0;
-      edge[1] = 0;
       result.collision = false;
       result.move_axis[0] = 0;
       result.move_axis[1] = 0;
 
-      //Iterate over all the edges composing the polygons
+      //Iterate over all the edges composing the polygons.
+      //Edges are read from the vertices to avoid to store them.
       for (
-        let i = 0, len1 = p1.vertices.length, len2 = p2.vertices.length;
+        let i = 0, len1 = vertices1.length, len2 = vertices2.length;
         i < len1 + len2;
         i++
       ) {
+        let edgeStart: FloatPoint;
+        let edgeEnd: FloatPoint;
         if (i < len1) {
-          // or <=
-          edge = p1.edges[i];
+          edgeStart = vertices1[i];
+          edgeEnd = i + 1 >= len1 ? vertices1[0] : vertices1[i + 1];
         } else {
-          edge = p2.edges[i - len1];
+          const j = i - len1;
+          edgeStart = vertices2[j];
+          edgeEnd = j + 1 >= len2 ? vertices2[0] : vertices2[j + 1];
         }
-        const axis = collisionTestStatics.axis;
 
         //Get the axis to which polygons will be projected
-        axis[0] = -edge[1];
-        axis[1] = edge[0];
-        Polygon.normalise(axis);
-        const minMaxA = collisionTestStatics.minMaxA;
-        const minMaxB = collisionTestStatics.minMaxB;
-        Polygon.project(
-          axis,
-          p1,
-          //Do projection on the axis.
-          minMaxA
-        );
-        Polygon.project(axis, p2, minMaxB);
+        let axisX = edgeStart[1] - edgeEnd[1];
+        let axisY = edgeEnd[0] - edgeStart[0];
+        const axisLength = Math.sqrt(axisX * axisX + axisY * axisY);
+        if (axisLength !== 0) {
+          axisX /= axisLength;
+          axisY /= axisLength;
+        }
+
+        //Do projection on the axis.
+        projectVertices(axisX, axisY, vertices1, minMaxA);
+        projectVertices(axisX, axisY, vertices2, minMaxB);
 
         //If the projections on the axis do not overlap, then their is no collision
         const dist = Polygon.distance(
@@ -269,8 +297,8 @@ namespace gdjs {
         const absDist = Math.abs(dist);
         if (absDist < minDist) {
           minDist = absDist;
-          move_axis[0] = axis[0];
-          move_axis[1] = axis[1];
+          move_axis[0] = axisX;
+          move_axis[1] = axisY;
         }
       }
       result.collision = true;
@@ -278,11 +306,11 @@ namespace gdjs {
       //Ensure move axis is correctly oriented.
       const p1Center = p1.computeCenter();
       const p2Center = p2.computeCenter();
-      const d: FloatPoint = [
-        p1Center[0] - p2Center[0],
-        p1Center[1] - p2Center[1],
-      ];
-      if (Polygon.dotProduct(d, move_axis) < 0) {
+      if (
+        (p1Center[0] - p2Center[0]) * move_axis[0] +
+          (p1Center[1] - p2Center[1]) * move_axis[1] <
+        0
+      ) {
         move_axis[0] = -move_axis[0];
         move_axis[1] = -move_axis[1];
       }
@@ -360,10 +388,8 @@ namespace gdjs {
           const rayA = 0;
           const rayB = Polygon.dotProduct(axis, r);
           const edgeA = Polygon.dotProduct(axis, deltaQP);
-          const edgeB = Polygon.dotProduct(axis, [
-            deltaQP[0] + s[0],
-            deltaQP[1] + s[1],
-          ]);
+          const edgeB =
+            axis[0] * (deltaQP[0] + s[0]) + axis[1] * (deltaQP[1] + s[1]);
 
           // Get overlapping range
           const minOverlap = Math.max(
@@ -456,19 +482,7 @@ namespace gdjs {
       p: gdjs.Polygon,
       result: FloatPoint
     ): void {
-      let dp = Polygon.dotProduct(axis, p.vertices[0]);
-      result[0] = dp;
-      result[1] = dp;
-      for (let i = 1, len = p.vertices.length; i < len; ++i) {
-        dp = Polygon.dotProduct(axis, p.vertices[i]);
-        if (dp < result[0]) {
-          result[0] = dp;
-        } else {
-          if (dp > result[1]) {
-            result[1] = dp;
-          }
-        }
-      }
+      projectVertices(axis[0], axis[1], p.vertices, result);
     }
 
     static distance(minA: float, maxA: float, minB: float, maxB: float): float {
@@ -10,6 +10,29 @@ namespace gdjs {
     subsections: Record<string, FrameMeasure>;
   };
 
+  /**
+   * A section measured by the profiler, in the Chrome trace event format
+   * (a "complete" event, with its times in microseconds).
+   */
+  export type ProfilerTraceEvent = {
+    name: string;
+    ph: 'X';
+    ts: float;
+    dur: float;
+    pid: integer;
+    tid: integer;
+  };
+
+  /**
+   * The sections measured by the profiler during the last frames, in the
+   * Chrome trace event format (that can be opened in the Performance tab of
+   * the Chrome developer tools, or in Perfetto).
+   */
+  export type ProfilerTrace = {
+    traceEvents: Array<ProfilerTraceEvent>;
+    displayTimeUnit: 'ms';
+  };
+
   /**
    * A basic profiling tool that can be used to measure time spent in sections of the engine.
    */
@@ -38,6 +61,23 @@ namespace gdjs {
     /** A function to get the current time. If available, corresponds to performance.now(). */
     _getTimeNow: () => float;
 
+    /**
+     * The maximum number of sections kept for the trace. When full, the
+     * oldest sections are replaced by the new ones.
+     */
+    static maxTraceEventsCount: integer = 65536;
+
+    /** The names of the sections of the trace, in a ring buffer. */
+    _traceNames: string[] = [];
+    /** The start times of the sections of the trace, in milliseconds. */
+    _traceStartTimes: Float64Array;
+    /** The durations of the sections of the trace, or -1 if not ended. */
+    _traceDurations: Float64Array;
+    /** The number of sections recorded in the trace since the start. */
+    _traceEventsCount: integer = 0;
+    /** The indexes (in the recording order) of the sections being measured. */
+    _openTraceEvents: integer[] = [];
+
     constructor() {
       while (this._framesMeasures.length < this._maxFramesCount) {
         this._framesMeasures.push({
@@ -51,16 +91,42 @@ namespace gdjs {
         window.performance && typeof window.performance.now === 'function'
           ? window.performance.now.bind(window.performance)
           : Date.now;
+      this._traceStartTimes = new Float64Array(Profiler.maxTraceEventsCount);
+      this._traceDurations = new Float64Array(Profiler.maxTraceEventsCount);
     }
 
     beginFrame(): void {
+      const timeNow = this._getTimeNow();
       this._currentFrameMeasure = {
         parent: null,
         time: 0,
-        lastStartTime: this._getTimeNow(),
+        lastStartTime: timeNow,
         subsections: {},
       };
       this._currentSection = this._currentFrameMeasure;
+      this._beginTraceEvent('frame', timeNow);
+    }
+
+    _beginTraceEvent(sectionName: string, timeNow: float): void {
+      const eventIndex = this._traceEventsCount++;
+      const slot = eventIndex % Profiler.maxTraceEventsCount;
+      this._traceNames[slot] = sectionName;
+      this._traceStartTimes[slot] = timeNow;
+      this._traceDurations[slot] = -1;
+      this._openTraceEvents.push(eventIndex);
+    }
+
+    _endTraceEvent(timeNow: float): void {
+      const eventIndex = this._openTraceEvents.pop();
+      if (
+        eventIndex === undefined ||
+        // The section was replaced by newer ones in the ring buffer.
+        eventIndex < this._traceEventsCount - Profiler.maxTraceEventsCount
+      ) {
+        return;
+      }
+      const slot = eventIndex % Profiler.maxTraceEventsCount;
+      this._traceDurations[slot] = timeNow - this._traceStartTimes[slot];
     }
 
     begin(sectionName: string): void {
@@ -82,7 +148,9 @@ namespace gdjs {
       this._currentSection = subsection;
 
       // Start the timer
-      this._currentSection.lastStartTime = this._getTimeNow();
+      const timeNow = this._getTimeNow();
+      this._currentSection.lastStartTime = timeNow;
+      this._beginTraceEvent(sectionName, timeNow);
     }
 
     end(sectionName?: string): void {
@@ -92,10 +160,11 @@ namespace gdjs {
         );
 
       // Stop the timer
-      const sectionTime =
-        this._getTimeNow() - this._currentSection.lastStartTime;
+      const timeNow = this._getTimeNow();
+      const sectionTime = timeNow - this._currentSection.lastStartTime;
       this._currentSection.time =
         (this._currentSection.time || 0) + sectionTime;
+      this._endTraceEvent(timeNow);
 
       // Pop the section
       if (this._currentSection.parent !== null)
@@ -181,6 +250,39 @@ namespace gdjs {
       return { framesCount: this._framesCount };
     }
 
+    /**
+     * Return the sections measured during the last frames (up to
+     * `Profiler.maxTraceEventsCount` sections), in the Chrome trace event
+     * format. Sections not ended yet are not included.
+     */
+    getChromeTrace(): ProfilerTrace {
+      const traceEvents: Array<ProfilerTraceEvent> = [];
+      const maxTraceEventsCount = Profiler.maxTraceEventsCount;
+      const firstEventIndex = Math.max(
+        0,
+        this._traceEventsCount - maxTraceEventsCount
+      );
+      for (
+        let eventIndex = firstEventIndex;
+        eventIndex < this._traceEventsCount;
+        eventIndex++
+      ) {
+        const slot = eventIndex % maxTraceEventsCount;
+        const duration = this._traceDurations[slot];
+        if (duration < 0) continue;
+
+        traceEvents.push({
+          name: this._traceNames[slot],
+          ph: 'X',
+          ts: this._traceStartTimes[slot] * 1000,
+          dur: duration * 1000,
+          pid: 1,
+          tid: 1,
+        });
+      }
+      return { traceEvents, displayTimeUnit: 'ms' };
+    }
+
     /**
      * Convert measures for a section into texts.
      * Useful for ingame profiling.
@@ -216,4 +318,119 @@ namespace gdjs {
       outputs.push.apply(outputs, subsectionsOutputs);
     }
   }
+
+  /**
+   * The time spent in the sections (the groups of events) of the events of a
+   * scene, measured by the code generated for release builds when the events
+   * profiling is enabled at export.
+   *
+   * Sections are identified by their index in the names given by the
+   * generated code, so measuring a section is only writing to preallocated
+   * arrays. Only one frame every `samplingRate` frames is measured, and
+   * nothing is measured while the sampling rate is 0 (the default).
+   */
+  export class EventsSectionsTimings {
+    /** The sections timings of all the scenes, by code namespace. */
+    static _allTimings: Record<string, EventsSectionsTimings> = {};
+
+    /** Measure one frame every `samplingRate` frames (0 to disable). */
+    static samplingRate: integer = 0;
+
+    /** The names of the sections, by id. */
+    readonly sectionNames: string[];
+    /** The time spent in each section, in milliseconds, by id. */
+    readonly times: Float64Array;
+    /** The number of times each section was measured, by id. */
+    readonly counts: Uint32Array;
+    /** The number of frames measured. */
+    sampledFramesCount: integer = 0;
+    /** True if the current frame is measured. */
+    sampling: boolean = false;
+
+    _startTimes: Float64Array;
+    _framesCount: integer = 0;
+    _getTimeNow: () => float;
+
+    constructor(sectionNames: string[]) {
+      this.sectionNames = sectionNames;
+      this.times = new Float64Array(sectionNames.length);
+      this.counts = new Uint32Array(sectionNames.length);
+      this._startTimes = new Float64Array(sectionNames.length);
+      this._startTimes.fill(-1);
+      this._getTimeNow =
+        typeof performance !== 'undefined' &&
+        typeof performance.now === 'function'
+          ? performance.now.bind(performance)
+          : Date.now;
+    }
+
+    /**
+     * Return the timings of the sections of a scene, created if needed.
+     * @param codeNamespace The namespace of the code of the scene.
+     * @param sectionNames The names of the sections, by id.
+     */
+    static getOrCreate(
+      codeNamespace: string,
+      sectionNames: string[]
+    ): EventsSectionsTimings {
+      const timings = EventsSectionsTimings._allTimings[codeNamespace];
+      if (timings && timings.sectionNames.length === sectionNames.length)
+        return timings;
+
+      return (EventsSectionsTimings._allTimings[codeNamespace] =
+        new EventsSectionsTimings(sectionNames));
+    }
+
+    /**
+     * Return the sections timings of all the scenes, by code namespace.
+     */
+    static getAll(): Record<string, EventsSectionsTimings> {
+      return EventsSectionsTimings._allTimings;
+    }
+
+    /**
+     * Choose if the frame starting is measured. Called before the events of
+     * the scene are run.
+     */
+    beginFrame(): void {
+      const samplingRate = EventsSectionsTimings.samplingRate;
+      this.sampling =
+        samplingRate > 0 && this._framesCount++ % samplingRate === 0;
+      if (this.sampling) this.sampledFramesCount++;
+    }
+
+    begin(sectionId: integer): void {
+      this._startTimes[sectionId] = this._getTimeNow();
+    }
+
+    end(sectionId: integer): void {
+      const startTime = this._startTimes[sectionId];
+      // The section was started before the frame was sampled.
+      if (startTime < 0) return;
+
+      this.times[sectionId] += this._getTimeNow() - startTime;
+      this.counts[sectionId]++;
+      this._startTimes[sectionId] = -1;
+    }
+
+    /**
+     * Return the average time spent in the section by measured frame, in
+     * milliseconds.
+     */
+    getAverageTimePerFrame(sectionId: integer): float {
+      return this.sampledFramesCount === 0
+        ? 0
+        : this.times[sectionId] / this.sampledFramesCount;
+    }
+
+    /**
+     * Forget all the measures.
+     */
+    reset(): void {
+      this.times.fill(0);
+      this.counts.fill(0);
+      this._startTimes.fill(-1);
+      this.sampledFramesCount = 0;
+    }
+  }
 }
@@ -31,6 +31,68 @@ namespace gdjs {
     }
   }
 
+  /**
+   * Remember the properties of a behavior synchronized over the network, so that
+   * only the properties that changed are sent when
+   * `syncOptions.syncOnlyChangedProperties` is set.
+   *
+   * As there is no acknowledgment of the messages, a property that changed is
+   * still sent for the next synchronizations (see `forcedSyncsCount`), in case
+   * messages are lost.
+   */
+  export class NetworkSyncPropertiesTracker {
+    /** The number of synchronizations sending a property after it changed. */
+    static forcedSyncsCount: integer = 3;
+
+    private _lastValues: { [propertyName: string]: any } = {};
+    private _remainingForcedSyncs: { [propertyName: string]: integer } = {};
+
+    /**
+     * Add the property to the synchronized properties, unless it did not change
+     * since the last synchronizations done with `syncOnlyChangedProperties`.
+     * Numbers are rounded if `syncOptions.numbersPrecision` is set.
+     * @param props The synchronized properties.
+     * @param propertyName The name of the property.
+     * @param value The current value of the property.
+     * @param syncOptions The options of the synchronization.
+     */
+    addProperty(
+      props: { [propertyName: string]: any },
+      propertyName: string,
+      value: any,
+      syncOptions: GetNetworkSyncDataOptions
+    ): void {
+      const numbersPrecision = syncOptions.numbersPrecision;
+      const syncedValue =
+        typeof value === 'number' && numbersPrecision && numbersPrecision > 0
+          ? Math.round(value / numbersPrecision) * numbersPrecision
+          : value;
+      if (!syncOptions.syncOnlyChangedProperties) {
+        props[propertyName] = syncedValue;
+        return;
+      }
+
+      if (this._lastValues[propertyName] !== syncedValue) {
+        this._lastValues[propertyName] = syncedValue;
+        this._remainingForcedSyncs[propertyName] =
+          NetworkSyncPropertiesTracker.forcedSyncsCount;
+      }
+      const remainingForcedSyncs = this._remainingForcedSyncs[propertyName];
+      if (remainingForcedSyncs > 0) {
+        this._remainingForcedSyncs[propertyName] = remainingForcedSyncs - 1;
+        props[propertyName] = syncedValue;
+      }
+    }
+
+    /**
+     * Forget the values sent, so that all the properties are sent again.
+     */
+    clear(): void {
+      this._lastValues = {};
+      this._remainingForcedSyncs = {};
+    }
+  }
+
   /**
    * RuntimeBehavior represents a behavior being used by a RuntimeObject.
    */
@@ -77,7 +139,31 @@ namespace gdjs {
       return false;
     }
 
-    getNetworkSyncData(): BehaviorNetworkSyncData {
+    /**
+     * Called to reset the behavior to its default state when the object owning it is
+     * "recycled" (see {@link gdjs.RuntimeObject#reinitialize}), to avoid constructing a new behavior.
+     *
+     * To implement this in your behavior, reset it as if it was newly constructed with the
+     * specified behaviorData (including `this._activated = true`), then return true.
+     * `onCreated` will be called after, as for a new behavior.
+     *
+     * @param behaviorData The data for the behavior.
+     * @returns true if the behavior was reset, false if it could not (i.e: recycling is not supported,
+     * a new behavior will be constructed).
+     */
+    reinitialize(behaviorData: BehaviorData): boolean {
+      // If not redefined, a new behavior is constructed.
+      return false;
+    }
+
+    /**
+     * Called when trying to send the state of the behavior to other peers.
+     * @param syncOptions The options of the synchronization. Behaviors can use
+     * a {@link gdjs.NetworkSyncPropertiesTracker} to follow them.
+     */
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): BehaviorNetworkSyncData {
       // To be redefined by behaviors that need to synchronize properties
       // while calling super() to get the common properties.
       return {
@@ -116,6 +202,8 @@ namespace gdjs {
 
     /**
      * Called at each frame before events. Call doStepPreEvents.<br>
+     * When profiling, the time spent is measured in a section named after
+     * the behavior type, so that it's summed for all the objects.<br>
      * Behaviors writers: Please do not redefine this method. Redefine doStepPreEvents instead.
      * @param instanceContainer The instanceContainer owning the object
      */
@@ -123,11 +211,11 @@ namespace gdjs {
       if (this._activated) {
         const profiler = instanceContainer.getScene().getProfiler();
         if (profiler) {
-          profiler.begin(this.name);
+          profiler.begin(this.type);
         }
         this.doStepPreEvents(instanceContainer);
         if (profiler) {
-          profiler.end(this.name);
+          profiler.end(this.type);
         }
       }
     }
@@ -141,11 +229,11 @@ namespace gdjs {
       if (this._activated) {
         const profiler = instanceContainer.getScene().getProfiler();
         if (profiler) {
-          profiler.begin(this.name);
+          profiler.begin(this.type);
         }
         this.doStepPostEvents(instanceContainer);
         if (profiler) {
-          profiler.end(this.name);
+          profiler.end(this.type);
         }
       }
     }
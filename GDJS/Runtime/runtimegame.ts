@@ -320,6 +320,31 @@ namespace gdjs {
       );
     }
 
+    /**
+     * Replace the data of a scene that was exported in its own file (see
+     * `LayoutData.dataFile`), once this file is loaded. The external layouts
+     * exported with the scene are added to the game.
+     *
+     * @param sceneData The complete data of the scene.
+     */
+    setSceneData(sceneData: LayoutData): void {
+      const index = this._data.layouts.findIndex(
+        (layoutData) => layoutData.name === sceneData.name
+      );
+      if (index === -1) {
+        logger.error('The game has no scene called "' + sceneData.name + '"');
+        return;
+      }
+      if (sceneData.externalLayouts) {
+        for (const externalLayoutData of sceneData.externalLayouts) {
+          this._data.externalLayouts.push(externalLayoutData);
+        }
+        delete sceneData.externalLayouts;
+      }
+      this._data.layouts[index] = sceneData;
+      this._sceneAndExtensionsData[index].sceneData = sceneData;
+    }
+
     private _updateSceneAndExtensionsData(): void {
       const usedExtensionsWithVariablesData =
         this._data.eventsFunctionsExtensions.filter(
@@ -968,6 +993,9 @@ namespace gdjs {
 
         // The standard game loop
         let accumulatedElapsedTime = 0;
+        // The time the last stepped frames were in advance (negative) or late
+        // (positive) on the maximum framerate.
+        let frameTimeLag = 0;
         this._hasJustResumed = false;
         this._renderer.startGameLoop((lastCallElapsedTime) => {
           try {
@@ -979,13 +1007,35 @@ namespace gdjs {
             accumulatedElapsedTime += lastCallElapsedTime;
             if (
               this._maxFPS > 0 &&
-              1000.0 / accumulatedElapsedTime > this._maxFPS + 7
+              1000.0 / lastCallElapsedTime > this._maxFPS + 7
             ) {
-              // Only skip frame if the framerate is 7 frames above the maximum framerate.
-              // Most browser/engines will try to run at slightly more than 60 frames per second.
-              // If game is set to have a maximum FPS to 60, then one out of two frames will be dropped.
-              // Hence, we use a 7 frames margin to ensure that we're not skipping frames too much.
-              return true;
+              // The screen refreshes faster than the maximum framerate (for
+              // instance 120 or 144Hz with 60 FPS). Frames are stepped when
+              // they are the closest to the expected time of the next frame,
+              // and the lag is kept to stay at the maximum framerate on
+              // average (a frame out of 2 or 3 is stepped on a 144Hz screen
+              // for 60 FPS, instead of one out of 3).
+              const minimalFrameTime = 1000.0 / this._maxFPS;
+              if (
+                accumulatedElapsedTime + frameTimeLag <
+                minimalFrameTime - lastCallElapsedTime / 2
+              ) {
+                return true;
+              }
+              frameTimeLag = Math.max(
+                -minimalFrameTime / 2,
+                Math.min(
+                  minimalFrameTime / 2,
+                  accumulatedElapsedTime + frameTimeLag - minimalFrameTime
+                )
+              );
+            } else {
+              // Only skip frames if the screen refreshes 7 frames per second
+              // faster than the maximum framerate.
+              // Most browser/engines will try to run at slightly more than 60
+              // frames per second. If game is set to have a maximum FPS to 60,
+              // then one out of two frames would be dropped.
+              frameTimeLag = 0;
             }
             const elapsedTime = accumulatedElapsedTime;
             accumulatedElapsedTime = 0;
@@ -53,6 +53,16 @@ namespace gdjs {
     result: gdjs.Polygon.makeNewRaycastTestResult(),
   };
 
+  /**
+   * Data structure that are (re)used by
+   * {@link RuntimeObject.reinitialize} to avoid any allocation.
+   */
+  const reinitializeStatics: {
+    previousBehaviors: Array<gdjs.RuntimeBehavior | undefined>;
+  } = {
+    previousBehaviors: [],
+  };
+
   /**
    * Move the object using the results from collisionTest call.
    * This moves the object according to the direction of the longest vector,
@@ -196,6 +206,11 @@ namespace gdjs {
     protected hitBoxesDirty: boolean = true;
     protected aabb: AABB = { min: [0, 0], max: [0, 0] };
     protected _isIncludedInParentCollisionMask = true;
+    /**
+     * The item of the object in the visibility index of the scene, if any.
+     * @see gdjs.ObjectsVisibilityIndex
+     */
+    _visibilityIndexItem: gdjs.ObjectVisibilityIndexItem | null = null;
 
     //Variables:
     protected _variables: gdjs.VariablesContainer;
@@ -205,7 +220,10 @@ namespace gdjs {
       {};
 
     //Forces:
-    protected _instantForces: gdjs.Force[] = [];
+    _instantForceX: float = 0;
+    _instantForceY: float = 0;
+    /** Forces with a multiplier other than 0 and 1 (deprecated). */
+    protected _legacyForces: gdjs.Force[] = [];
     _permanentForceX: float = 0;
     _permanentForceY: float = 0;
     _totalForce: gdjs.Force;
@@ -225,7 +243,7 @@ namespace gdjs {
      * effects, scale, size...).
      */
     protected _behaviorsTable: Hashtable<gdjs.RuntimeBehavior>;
-    protected _timers: Hashtable<gdjs.Timer>;
+    protected _timers: gdjs.TimersContainer;
 
     /**
      * @param instanceContainer The scene or custom object the object belongs to.
@@ -264,7 +282,7 @@ namespace gdjs {
         }
         this._behaviorsTable.put(autoData.name, behavior);
       }
-      this._timers = new Hashtable();
+      this._timers = new gdjs.TimersContainer();
     }
 
     //Common members functions related to the object and its runtimeScene :
@@ -333,9 +351,22 @@ namespace gdjs {
       this._variables = new gdjs.VariablesContainer(objectData.variables);
       this.clearForces();
 
-      // Reinitialize behaviors.
-      this._behaviorsTable.clear();
+      // Reinitialize behaviors, reusing the previous ones when they support it.
       const behaviorsDataCount = objectData.behaviors.length;
+      const previousBehaviors = reinitializeStatics.previousBehaviors;
+      for (
+        let behaviorDataIndex = 0;
+        behaviorDataIndex < behaviorsDataCount;
+        ++behaviorDataIndex
+      ) {
+        const behaviorData = objectData.behaviors[behaviorDataIndex];
+        previousBehaviors[behaviorDataIndex] = this._behaviorsTable.containsKey(
+          behaviorData.name
+        )
+          ? this._behaviorsTable.get(behaviorData.name)
+          : undefined;
+      }
+      this._behaviorsTable.clear();
       let behaviorsUsingLifecycleFunctionCount = 0;
       for (
         let behaviorDataIndex = 0;
@@ -343,9 +374,18 @@ namespace gdjs {
         ++behaviorDataIndex
       ) {
         const behaviorData = objectData.behaviors[behaviorDataIndex];
-        const Ctor = gdjs.getBehaviorConstructor(behaviorData.type);
-        // TODO: Add support for behavior recycling with a `reinitialize` method.
-        const behavior = new Ctor(runtimeScene, behaviorData, this);
+        const previousBehavior = previousBehaviors[behaviorDataIndex];
+        previousBehaviors[behaviorDataIndex] = undefined;
+        const behavior =
+          previousBehavior &&
+          previousBehavior.type === behaviorData.type &&
+          previousBehavior.reinitialize(behaviorData)
+            ? previousBehavior
+            : new (gdjs.getBehaviorConstructor(behaviorData.type))(
+                runtimeScene,
+                behaviorData,
+                this
+              );
         if (behavior.usesLifecycleFunction()) {
           if (behaviorsUsingLifecycleFunctionCount < this._behaviors.length) {
             this._behaviors[behaviorsUsingLifecycleFunctionCount] = behavior;
@@ -450,16 +490,19 @@ namespace gdjs {
     /**
      * Called when trying to send all information about the state of an object to other peers.
      * This can be redefined by objects to send more information.
+     * @param syncOptions The options of the synchronization, given to the behaviors.
      * @returns The full network sync data.
      */
-    getNetworkSyncData(): ObjectNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): ObjectNetworkSyncData {
       const behaviorNetworkSyncData = {};
       this._behaviors.forEach((behavior) => {
         if (!behavior.isSyncedOverNetwork()) {
           return;
         }
 
-        const networkSyncData = behavior.getNetworkSyncData();
+        const networkSyncData = behavior.getNetworkSyncData(syncOptions);
         if (networkSyncData) {
           behaviorNetworkSyncData[behavior.getName()] = networkSyncData;
         }
@@ -476,9 +519,10 @@ namespace gdjs {
       }
 
       const timersNetworkSyncData = {};
-      for (const timerName in this._timers.items) {
-        timersNetworkSyncData[timerName] =
-          this._timers.items[timerName].getNetworkSyncData();
+      const timers = this._timers.getAll();
+      for (let i = 0; i < timers.length; i++) {
+        const timer = timers[i];
+        timersNetworkSyncData[timer.getName()] = timer.getNetworkSyncData();
       }
 
       return {
@@ -490,7 +534,7 @@ namespace gdjs {
         a: this.angle,
         hid: this.hidden,
         lay: this.layer,
-        if: this._instantForces.map((force) => force.getNetworkSyncData()),
+        if: this._getForcesNetworkSyncData(),
         pfx: this._permanentForceX,
         pfy: this._permanentForceY,
         beh: behaviorNetworkSyncData,
@@ -542,17 +586,21 @@ namespace gdjs {
 
       if (networkSyncData.if) {
         // Force clear all forces and reapply them, using the garbage collector to recycle forces.
-        // Is that efficient?
         this.clearForces();
         for (let i = 0, len = networkSyncData.if.length; i < len; ++i) {
           const forceData = networkSyncData.if[i];
-          const recycledOrNewForce = this._getRecycledForce(
-            forceData.x,
-            forceData.y,
-            forceData.m
-          );
-          recycledOrNewForce.updateFromNetworkSyncData(forceData);
-          this._instantForces.push(recycledOrNewForce);
+          if (forceData.m === 0) {
+            this._instantForceX += forceData.x;
+            this._instantForceY += forceData.y;
+          } else {
+            const recycledOrNewForce = this._getRecycledForce(
+              forceData.x,
+              forceData.y,
+              forceData.m
+            );
+            recycledOrNewForce.updateFromNetworkSyncData(forceData);
+            this._legacyForces.push(recycledOrNewForce);
+          }
         }
       }
       if (networkSyncData.pfx !== undefined) {
@@ -748,6 +796,9 @@ namespace gdjs {
       // directly.
       this.hitBoxesDirty = true;
       this._runtimeScene.onChildrenLocationChanged();
+      if (this._visibilityIndexItem) {
+        this._visibilityIndexItem.invalidate();
+      }
     }
 
     /**
@@ -899,6 +950,9 @@ namespace gdjs {
       }
       const oldLayer = this._runtimeScene.getLayer(this.layer);
       this.layer = layer;
+      if (this._visibilityIndexItem) {
+        this._visibilityIndexItem.invalidate();
+      }
       const newLayer = this._runtimeScene.getLayer(this.layer);
       const rendererObject = this.getRendererObject();
       if (rendererObject) {
@@ -1471,6 +1525,31 @@ namespace gdjs {
     }
 
     //Forces :
+    /**
+     * Return the forces to synchronize, the sum of the instant forces being
+     * sent as one instant force.
+     */
+    private _getForcesNetworkSyncData(): ForceNetworkSyncData[] {
+      const forcesSyncData = this._legacyForces.map((force) =>
+        force.getNetworkSyncData()
+      );
+      if (this._instantForceX !== 0 || this._instantForceY !== 0) {
+        forcesSyncData.push({
+          x: this._instantForceX,
+          y: this._instantForceY,
+          a: gdjs.toDegrees(
+            Math.atan2(this._instantForceY, this._instantForceX)
+          ),
+          l: Math.sqrt(
+            this._instantForceX * this._instantForceX +
+              this._instantForceY * this._instantForceY
+          ),
+          m: 0,
+        });
+      }
+      return forcesSyncData;
+    }
+
     /**
      * Get a force from the garbage, or create a new force is garbage is empty.<br>
      * To be used each time a force is created so as to avoid temporaries objects.
@@ -1505,17 +1584,13 @@ namespace gdjs {
       if (multiplier === 1) {
         this._permanentForceX += x;
         this._permanentForceY += y;
-      } else if (
-        multiplier === 0 &&
-        this._instantForces.length > 0 &&
-        this._instantForces[0].getMultiplier() === 0
-      ) {
-        // Avoid to instantiate new a Force for each instance force.
-        this._instantForces[0].add(x, y);
+      } else if (multiplier === 0) {
+        // Instant forces are summed, so that no Force is instantiated for them.
+        this._instantForceX += x;
+        this._instantForceY += y;
       } else {
-        // Handle legacy forces with multiplier different from 0 and 1
-        // (or the 1st instant force).
-        this._instantForces.push(this._getRecycledForce(x, y, multiplier));
+        // Handle legacy forces with multiplier different from 0 and 1.
+        this._legacyForces.push(this._getRecycledForce(x, y, multiplier));
       }
     }
 
@@ -1585,9 +1660,11 @@ namespace gdjs {
     clearForces(): void {
       RuntimeObject.forcesGarbage.push.apply(
         RuntimeObject.forcesGarbage,
-        this._instantForces
+        this._legacyForces
       );
-      this._instantForces.length = 0;
+      this._legacyForces.length = 0;
+      this._instantForceX = 0;
+      this._instantForceY = 0;
       this._permanentForceX = 0;
       this._permanentForceY = 0;
     }
@@ -1598,7 +1675,9 @@ namespace gdjs {
      */
     hasNoForces(): boolean {
       return (
-        this._instantForces.length === 0 &&
+        this._legacyForces.length === 0 &&
+        this._instantForceX === 0 &&
+        this._instantForceY === 0 &&
         this._permanentForceX === 0 &&
         this._permanentForceY === 0
       );
@@ -1609,8 +1688,10 @@ namespace gdjs {
      * remove null ones.
      */
     updateForces(elapsedTime: float): void {
-      for (let i = 0; i < this._instantForces.length; ) {
-        const force = this._instantForces[i];
+      this._instantForceX = 0;
+      this._instantForceY = 0;
+      for (let i = 0; i < this._legacyForces.length; ) {
+        const force = this._legacyForces[i];
         const multiplier = force.getMultiplier();
         if (multiplier === 1) {
           // Permanent force
@@ -1622,7 +1703,7 @@ namespace gdjs {
             force.getLength() <= 0.001
           ) {
             RuntimeObject.forcesGarbage.push(force);
-            this._instantForces.splice(i, 1);
+            this._legacyForces.splice(i, 1);
           } else {
             // Deprecated way of updating forces progressively.
             force.setLength(
@@ -1642,9 +1723,12 @@ namespace gdjs {
      */
     getAverageForce(): gdjs.Force {
       this._totalForce.clear();
-      this._totalForce.add(this._permanentForceX, this._permanentForceY);
-      for (let i = 0, len = this._instantForces.length; i < len; ++i) {
-        this._totalForce.addForce(this._instantForces[i]);
+      this._totalForce.add(
+        this._permanentForceX + this._instantForceX,
+        this._permanentForceY + this._instantForceY
+      );
+      for (let i = 0, len = this._legacyForces.length; i < len; ++i) {
+        this._totalForce.addForce(this._legacyForces[i]);
       }
       return this._totalForce;
     }
@@ -1952,6 +2036,15 @@ namespace gdjs {
       }
     }
 
+    /**
+     * Get the behaviors having lifecycle functions, in the order they are
+     * stepped. Don't modify the returned array.
+     * @see gdjs.RuntimeBehavior#usesLifecycleFunction
+     */
+    getBehaviorsUsingLifecycleFunction(): gdjs.RuntimeBehavior[] {
+      return this._behaviors;
+    }
+
     /**
      * Called when the object was hot reloaded, to notify behaviors
      * that the object was modified. Useful for behaviors that
@@ -2028,6 +2121,7 @@ namespace gdjs {
       const behaviorIndex = this._behaviors.indexOf(behavior);
       if (behaviorIndex !== -1) {
         this._behaviors.splice(behaviorIndex, 1);
+        this._runtimeScene.invalidateBehaviorsGroups();
       }
       this._behaviorsTable.remove(name);
       return true;
@@ -2051,6 +2145,7 @@ namespace gdjs {
       );
       if (newRuntimeBehavior.usesLifecycleFunction()) {
         this._behaviors.push(newRuntimeBehavior);
+        this._runtimeScene.invalidateBehaviorsGroups();
       }
       this._behaviorsTable.put(behaviorData.name, newRuntimeBehavior);
       newRuntimeBehavior.onCreated();
@@ -2063,11 +2158,7 @@ namespace gdjs {
      * @param elapsedTime The elapsed time since the previous frame in milliseconds.
      */
     updateTimers(elapsedTime: float): void {
-      for (const name in this._timers.items) {
-        if (this._timers.items.hasOwnProperty(name)) {
-          this._timers.items[name].updateTime(elapsedTime);
-        }
-      }
+      this._timers.updateTime(elapsedTime);
     }
 
     /**
@@ -2075,71 +2166,62 @@ namespace gdjs {
      *
      * @deprecated prefer using `getTimerElapsedTimeInSecondsOrNaN`.
      *
-     * @param timerName The timer name.
+     * @param timerName The timer name (or its slot, see `gdjs.Timer.getSlot`).
      * @param timeInSeconds The time value to check in seconds.
      * @return True if the timer exists and its value is greater than or equal than the given time, false otherwise.
      */
-    timerElapsedTime(timerName: string, timeInSeconds: float): boolean {
-      if (!this._timers.containsKey(timerName)) {
-        this._timers.put(timerName, new gdjs.Timer(timerName));
+    timerElapsedTime(
+      timerName: gdjs.TimerNameOrSlot,
+      timeInSeconds: float
+    ): boolean {
+      const timer = this._timers.get(timerName);
+      if (!timer) {
+        this._timers.add(timerName);
         return false;
       }
-      return this.getTimerElapsedTimeInSeconds(timerName) >= timeInSeconds;
+      return timer.getTime() / 1000.0 >= timeInSeconds;
     }
 
     /**
      * Test a if a timer is paused.
-     * @param timerName The timer name.
+     * @param timerName The timer name (or its slot, see `gdjs.Timer.getSlot`).
      * @return True if the timer exists and is paused, false otherwise.
      */
-    timerPaused(timerName: string): boolean {
-      if (!this._timers.containsKey(timerName)) {
-        return false;
-      }
-      return this._timers.get(timerName).isPaused();
+    timerPaused(timerName: gdjs.TimerNameOrSlot): boolean {
+      const timer = this._timers.get(timerName);
+      return !!timer && timer.isPaused();
     }
 
     /**
      * Reset a timer. If the timer doesn't exist it is created.
-     * @param timerName The timer name.
+     * @param timerName The timer name (or its slot, see `gdjs.Timer.getSlot`).
      */
-    resetTimer(timerName: string): void {
-      if (!this._timers.containsKey(timerName)) {
-        this._timers.put(timerName, new gdjs.Timer(timerName));
-      }
-      this._timers.get(timerName).reset();
+    resetTimer(timerName: gdjs.TimerNameOrSlot): void {
+      this._timers.getOrAdd(timerName).reset();
     }
 
     /**
      * Pause a timer. If the timer doesn't exist it is created.
-     * @param timerName The timer name.
+     * @param timerName The timer name (or its slot, see `gdjs.Timer.getSlot`).
      */
-    pauseTimer(timerName: string): void {
-      if (!this._timers.containsKey(timerName)) {
-        this._timers.put(timerName, new gdjs.Timer(timerName));
-      }
-      this._timers.get(timerName).setPaused(true);
+    pauseTimer(timerName: gdjs.TimerNameOrSlot): void {
+      this._timers.getOrAdd(timerName).setPaused(true);
     }
 
     /**
      * Unpause a timer. If the timer doesn't exist it is created.
-     * @param timerName The timer name.
+     * @param timerName The timer name (or its slot, see `gdjs.Timer.getSlot`).
      */
-    unpauseTimer(timerName: string): void {
-      if (!this._timers.containsKey(timerName)) {
-        this._timers.put(timerName, new gdjs.Timer(timerName));
-      }
-      this._timers.get(timerName).setPaused(false);
+    unpauseTimer(timerName: gdjs.TimerNameOrSlot): void {
+      this._timers.getOrAdd(timerName).setPaused(false);
     }
 
     /**
      * Remove a timer
-     * @param timerName The timer name.
+     * @param timerName The timer name (or its slot, see `gdjs.Timer.getSlot`).
      */
-    removeTimer(timerName: string): void {
-      if (this._timers.containsKey(timerName)) {
-        this._timers.remove(timerName);
-      }
+    removeTimer(timerName: gdjs.TimerNameOrSlot): void {
+      this._timers.remove(timerName);
     }
 
     /**
@@ -2148,14 +2230,12 @@ namespace gdjs {
      * This is used by expressions to return 0 when a timer doesn't exist
      * because numeric expressions must always return a number.
      *
-     * @param timerName The timer name.
+     * @param timerName The timer name (or its slot, see `gdjs.Timer.getSlot`).
      * @return The timer elapsed time in seconds, 0 if the timer doesn't exist.
      */
-    getTimerElapsedTimeInSeconds(timerName: string): float {
-      if (!this._timers.containsKey(timerName)) {
-        return 0;
-      }
-      return this._timers.get(timerName).getTime() / 1000.0;
+    getTimerElapsedTimeInSeconds(timerName: gdjs.TimerNameOrSlot): float {
+      const timer = this._timers.get(timerName);
+      return timer ? timer.getTime() / 1000.0 : 0;
     }
 
     /**
@@ -2164,14 +2244,14 @@ namespace gdjs {
      * This is used by conditions to return false when a timer doesn't exist,
      * no matter the relational operator.
      *
-     * @param timerName The timer name.
+     * @param timerName The timer name (or its slot, see `gdjs.Timer.getSlot`).
      * @return The timer elapsed time in seconds, NaN if the timer doesn't exist.
      */
-    getTimerElapsedTimeInSecondsOrNaN(timerName: string): float {
-      if (!this._timers.containsKey(timerName)) {
-        return Number.NaN;
-      }
-      return this._timers.get(timerName).getTime() / 1000.0;
+    getTimerElapsedTimeInSecondsOrNaN(
+      timerName: gdjs.TimerNameOrSlot
+    ): float {
+      const timer = this._timers.get(timerName);
+      return timer ? timer.getTime() / 1000.0 : Number.NaN;
     }
 
     //Other :
@@ -2532,6 +2612,22 @@ namespace gdjs {
       }
     }
 
+    /**
+     * Return the radius of the circle, around the center of the object,
+     * outside of which the hitboxes of the object are never considered in
+     * collision (see {@link RuntimeObject.collisionTest}).
+     */
+    getCollisionBoundingRadius(): float {
+      return Math.sqrt(
+        computeSqBoundingRadius(
+          this.getWidth(),
+          this.getHeight(),
+          this.getCenterX(),
+          this.getCenterY()
+        )
+      );
+    }
+
     /**
      * Return true if the hitboxes of two objects are overlapping
      * @static
@@ -25,6 +25,9 @@ namespace gdjs {
     _requestedScene: string = '';
     _resourcesUnloading: 'at-scene-exit' | 'never' | 'inherit' = 'inherit';
     private _asyncTasksManager = new gdjs.AsyncTasksManager();
+    private _objectsVisibilityIndex = new gdjs.ObjectsVisibilityIndex();
+    /** Set if the scene was exported with its instances in chunks. */
+    private _instancesStreamer: gdjs.InstancesStreamer | null = null;
 
     /** True if loadFromScene was called and the scene is being played. */
     _isLoaded: boolean = false;
@@ -47,6 +50,20 @@ namespace gdjs {
     _cachedGameResolutionWidth: integer;
     _cachedGameResolutionHeight: integer;
 
+    /**
+     * The scene being loaded by `beginLoadFromScene`, whose initial
+     * instances are not all created yet.
+     */
+    _sceneDataBeingLoaded: LayoutData | null = null;
+    /** The index of the next initial instance to create. */
+    _nextInitialInstanceIndex: integer = 0;
+
+    /**
+     * The number of initial instances created between two checks of the
+     * time spent by `createInitialInstances`.
+     */
+    static _initialInstancesChunkSize: integer = 32;
+
     /**
      * A network ID associated to the scene to be used
      * for multiplayer, to identify the scene across peers.
@@ -130,6 +147,23 @@ namespace gdjs {
         logger.error('loadFromScene was called without a scene');
         return;
       }
+      this.beginLoadFromScene(sceneAndExtensionsData);
+      this.endLoadFromScene();
+    }
+
+    /**
+     * Start to load the runtime scene from the given scene, without creating
+     * its initial instances. They can then be created a few at a time with
+     * `createInitialInstances`, and the loading must be ended with
+     * `endLoadFromScene` before the scene is played.
+     *
+     * This allows to prepare a scene in background, without freezing the
+     * scene being played.
+     *
+     * @param sceneAndExtensionsData An object containing the scene data.
+     * @see gdjs.SceneStack#preInstantiateScene
+     */
+    beginLoadFromScene(sceneAndExtensionsData: SceneAndExtensionsData): void {
       const { sceneData, usedExtensionsWithVariablesData } =
         sceneAndExtensionsData;
 
@@ -138,9 +172,6 @@ namespace gdjs {
       }
 
       //Setup main properties
-      if (this._runtimeGame) {
-        this._runtimeGame.getRenderer().setWindowTitle(sceneData.title);
-      }
       this._name = sceneData.name;
       this._resourcesUnloading = sceneData.resourcesUnloading || 'inherit';
       this.setBackgroundColor(sceneData.r, sceneData.v, sceneData.b);
@@ -183,19 +214,89 @@ namespace gdjs {
         this.registerObject(sceneData.objects[i]);
       }
 
-      //Create initial instances of objects
-      this.createObjectsFrom(
-        sceneData.instances,
-        0,
-        0,
-        0,
-        /*trackByPersistentUuid=*/
-        true
-      );
+      // The initial instances are created later.
+      this._sceneDataBeingLoaded = sceneData;
+      this._nextInitialInstanceIndex = 0;
+      this._instancesStreamer =
+        sceneData.instancesChunks && sceneData.instancesChunkSize
+          ? new gdjs.InstancesStreamer(
+              this,
+              sceneData.instancesChunkSize,
+              sceneData.instancesChunks
+            )
+          : null;
+    }
+
+    /**
+     * Create the initial instances of the scene being loaded, until they are
+     * all created or the given duration is elapsed.
+     * @param maxDuration The time that can be spent, in milliseconds.
+     * @returns true if all the initial instances are created.
+     * @see gdjs.RuntimeScene#beginLoadFromScene
+     */
+    createInitialInstances(maxDuration: float): boolean {
+      const sceneData = this._sceneDataBeingLoaded;
+      if (!sceneData) {
+        return true;
+      }
+      const instances = sceneData.instances;
+      const chunkSize = RuntimeScene._initialInstancesChunkSize;
+      const startTime = performance.now();
+      while (this._nextInitialInstanceIndex < instances.length) {
+        const chunkEnd = Math.min(
+          this._nextInitialInstanceIndex + chunkSize,
+          instances.length
+        );
+        this.createObjectsFrom(
+          instances.slice(this._nextInitialInstanceIndex, chunkEnd),
+          0,
+          0,
+          0,
+          /*trackByPersistentUuid=*/
+          true
+        );
+        this._nextInitialInstanceIndex = chunkEnd;
+        if (performance.now() - startTime >= maxDuration) {
+          break;
+        }
+      }
+      return this._nextInitialInstanceIndex >= instances.length;
+    }
+
+    /**
+     * Return true if the scene is being loaded by `beginLoadFromScene` and
+     * `endLoadFromScene` was not called yet.
+     */
+    isBeingLoaded(): boolean {
+      return this._sceneDataBeingLoaded !== null;
+    }
+
+    /**
+     * End the loading of the scene: create the initial instances not created
+     * yet and notify the extensions that the scene is loaded.
+     * @see gdjs.RuntimeScene#beginLoadFromScene
+     */
+    endLoadFromScene(): void {
+      const sceneData = this._sceneDataBeingLoaded;
+      if (!sceneData) {
+        return;
+      }
+      this.createInitialInstances(Number.POSITIVE_INFINITY);
+      this._sceneDataBeingLoaded = null;
+      // Create the instances of the chunks near the cameras.
+      this._updateInstancesStreaming();
+      const initialGlobalObjectsData = this.getGame().getInitialObjectsData();
+
+      if (this._runtimeGame) {
+        this._runtimeGame.getRenderer().setWindowTitle(sceneData.title);
+      }
 
       // Set up the default z order (for objects created from events)
       this._setLayerDefaultZOrders();
 
+      // Compile the shaders of the effects before the first frame.
+      this._prewarmEffects(sceneData, initialGlobalObjectsData);
+
       //Set up the function to be executed at each tick
       this.setEventsGeneratedCodeFunction(sceneData);
       this._onceTriggers = new gdjs.OnceTriggers();
@@ -216,6 +317,35 @@ namespace gdjs {
       this._timeManager.reset();
     }
 
+    /**
+     * Compile the shader programs of the distinct effects used by the layers
+     * and the objects of the scene, to avoid hitches when they are first
+     * rendered.
+     */
+    private _prewarmEffects(
+      sceneData: LayoutData,
+      globalObjectsData: ObjectData[]
+    ): void {
+      const target = this._orderedLayers[0];
+      if (!target) {
+        return;
+      }
+      const effectsData: EffectData[] = [];
+      for (const layerData of sceneData.layers) {
+        effectsData.push(...layerData.effects);
+      }
+      for (const objectData of globalObjectsData) {
+        if (objectData.effects) effectsData.push(...objectData.effects);
+      }
+      for (const objectData of sceneData.objects) {
+        if (objectData.effects) effectsData.push(...objectData.effects);
+      }
+      if (effectsData.length === 0) {
+        return;
+      }
+      this.getGame().getEffectsManager().prewarmEffects(effectsData, target);
+    }
+
     getInitialSharedDataForBehavior(name: string): BehaviorSharedData | null {
       // TODO Move this error in RuntimeInstanceContainer after deciding
       // what to do with shared data in custom object.
@@ -269,9 +399,10 @@ namespace gdjs {
      * rendered on the screen.
      */
     unloadScene() {
-      if (!this._isLoaded) {
+      if (!this._isLoaded && !this._sceneDataBeingLoaded) {
         return;
       }
+      this._sceneDataBeingLoaded = null;
       if (this._profiler) {
         this.stopProfiler();
       }
@@ -321,6 +452,8 @@ namespace gdjs {
       this._eventsFunction = null;
       this._lastId = 0;
       this.networkId = null;
+      this._objectsVisibilityIndex.clear();
+      this._instancesStreamer = null;
       // @ts-ignore We are deleting the object
       this._onceTriggers = null;
     }
@@ -418,6 +551,15 @@ namespace gdjs {
       if (this._profiler) {
         this._profiler.end('callbacks and extensions (post-events)');
       }
+      if (this._instancesStreamer) {
+        if (this._profiler) {
+          this._profiler.begin('instances streaming');
+        }
+        this._updateInstancesStreaming();
+        if (this._profiler) {
+          this._profiler.end('instances streaming');
+        }
+      }
       if (this._profiler) {
         this._profiler.begin('objects (pre-render, effects update)');
       }
@@ -491,49 +633,99 @@ namespace gdjs {
 
         // TODO (3D) culling - add support for 3D object culling?
         this._updateLayersCameraCoordinates(2);
-        const allInstancesList = this.getAdhocListOfAllInstances();
-        for (let i = 0, len = allInstancesList.length; i < len; ++i) {
-          const object = allInstancesList[i];
-          const rendererObject = object.getRendererObject();
-          if (rendererObject) {
-            if (object.isHidden()) {
-              rendererObject.visible = false;
-            } else {
-              const cameraCoords =
-                this._layersCameraCoordinates[object.getLayer()];
-              if (!cameraCoords) {
-                continue;
-              }
-              const aabb = object.getVisibilityAABB();
-              rendererObject.visible =
-                // If no AABB is returned, the object should always be visible
-                !aabb ||
-                // If an AABB is there, it must be at least partially inside
-                // the camera bounds.
-                !(
-                  aabb.min[0] > cameraCoords[2] ||
-                  aabb.min[1] > cameraCoords[3] ||
-                  aabb.max[0] < cameraCoords[0] ||
-                  aabb.max[1] < cameraCoords[1]
-                );
-            }
-
-            // Update effects, only for visible objects.
-            if (rendererObject.visible) {
-              this._runtimeGame
-                .getEffectsManager()
-                .updatePreRender(object.getRendererEffects(), object);
-
-              // Perform pre-render update only if the object is visible
-              // (including if there is no visibility AABB returned previously).
-              object.updatePreRender(this);
-            }
-          } else {
-            // Perform pre-render update, always for objects not having an
-            // associated renderer object (so it must handle visibility on its own).
-            object.updatePreRender(this);
+
+        // Only the objects near the cameras and the objects that are moving
+        // are iterated: the others are hidden by the visibility index.
+        const visibilityIndex = this._objectsVisibilityIndex;
+        visibilityIndex.update(this._layersCameraCoordinates);
+        const objectsNearCameras = visibilityIndex.getObjectsNearCameras();
+        for (let i = 0, len = objectsNearCameras.length; i < len; ++i) {
+          this._updateObjectPreRender(objectsNearCameras[i]);
+        }
+        visibilityIndex.hideObjectsNotNearCameras();
+        const dynamicObjects = visibilityIndex.getDynamicObjects();
+        for (let i = 0, len = dynamicObjects.length; i < len; ++i) {
+          this._updateObjectPreRender(dynamicObjects[i]);
+        }
+      }
+    }
+
+    /**
+     * Create the objects of the chunks of instances that are near the
+     * cameras, and delete the ones of the chunks far from them, if the scene
+     * was exported with its instances in chunks.
+     */
+    private _updateInstancesStreaming(): void {
+      if (!this._instancesStreamer) {
+        return;
+      }
+      // Use the same margin as the culling of the objects.
+      this._updateLayersCameraCoordinates(2);
+      this._instancesStreamer.update(this._layersCameraCoordinates);
+    }
+
+    /**
+     * Return the streamer of the instances, if the scene was exported with
+     * its instances in chunks.
+     */
+    getInstancesStreamer(): gdjs.InstancesStreamer | null {
+      return this._instancesStreamer;
+    }
+
+    /**
+     * Update the visibility of the renderer object of an object, according
+     * to the cameras of its layer, then update its effects and call its
+     * pre-render update if it's visible.
+     */
+    private _updateObjectPreRender(object: gdjs.RuntimeObject): void {
+      if (this._profiler) {
+        // Measure the time spent for each object type.
+        this._profiler.begin(object.type);
+        this._doUpdateObjectPreRender(object);
+        this._profiler.end(object.type);
+      } else {
+        this._doUpdateObjectPreRender(object);
+      }
+    }
+
+    private _doUpdateObjectPreRender(object: gdjs.RuntimeObject): void {
+      const rendererObject = object.getRendererObject();
+      if (rendererObject) {
+        if (object.isHidden()) {
+          rendererObject.visible = false;
+        } else {
+          const cameraCoords = this._layersCameraCoordinates[object.getLayer()];
+          if (!cameraCoords) {
+            return;
           }
+          const aabb = object.getVisibilityAABB();
+          rendererObject.visible =
+            // If no AABB is returned, the object should always be visible
+            !aabb ||
+            // If an AABB is there, it must be at least partially inside
+            // the camera bounds.
+            !(
+              aabb.min[0] > cameraCoords[2] ||
+              aabb.min[1] > cameraCoords[3] ||
+              aabb.max[0] < cameraCoords[0] ||
+              aabb.max[1] < cameraCoords[1]
+            );
+        }
+
+        // Update effects, only for visible objects.
+        if (rendererObject.visible) {
+          this._runtimeGame
+            .getEffectsManager()
+            .updatePreRender(object.getRendererEffects(), object);
+
+          // Perform pre-render update only if the object is visible
+          // (including if there is no visibility AABB returned previously).
+          object.updatePreRender(this);
         }
+      } else {
+        // Perform pre-render update, always for objects not having an
+        // associated renderer object (so it must handle visibility on its own).
+        object.updatePreRender(this);
       }
     }
 
@@ -682,6 +874,16 @@ namespace gdjs {
       // Scenes don't maintain bounds.
     }
 
+    override addObject(obj: gdjs.RuntimeObject): void {
+      super.addObject(obj);
+      this._objectsVisibilityIndex.addObject(obj);
+    }
+
+    override markObjectForDeletion(obj: gdjs.RuntimeObject): void {
+      this._objectsVisibilityIndex.removeObject(obj);
+      super.markObjectForDeletion(obj);
+    }
+
     /**
      * Get the variables of the runtimeScene.
      * @return The container holding the variables of the scene.
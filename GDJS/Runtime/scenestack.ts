@@ -13,6 +13,20 @@ namespace gdjs {
     _sceneStackSyncDataToApply: SceneStackNetworkSyncData | null = null;
     _wasDisposed: boolean = false;
 
+    /**
+     * The scenes created in background before being played, by name.
+     * @see gdjs.SceneStack#preInstantiateScene
+     */
+    _preInstantiatedScenes = new Map<string, gdjs.RuntimeScene>();
+    /** The names of the scenes with initial instances left to create. */
+    _scenesToPreInstantiate: string[] = [];
+
+    /**
+     * The time that can be spent at each frame to create the initial
+     * instances of the scenes prepared in background, in milliseconds.
+     */
+    static preInstantiationMaxDuration: float = 4;
+
     /**
      * @param runtimeGame The runtime game that is using the scene stack
      */
@@ -51,6 +65,8 @@ namespace gdjs {
         return true;
       }
 
+      this._stepPreInstantiation();
+
       const currentScene = this._stack[this._stack.length - 1];
       if (currentScene.renderAndStep(elapsedTime)) {
         const request = currentScene.getRequestedChange();
@@ -158,10 +174,16 @@ namespace gdjs {
       this._throwIfDisposed();
 
       // Load the new one
-      const newScene = new gdjs.RuntimeScene(this._runtimeGame);
-      newScene.loadFromScene(
-        this._runtimeGame.getSceneAndExtensionsData(newSceneName)
-      );
+      this._runtimeGame.getResourceLoader().markSceneAsUsed(newSceneName);
+      let newScene = this._takePreInstantiatedScene(newSceneName);
+      if (newScene) {
+        newScene.endLoadFromScene();
+      } else {
+        newScene = new gdjs.RuntimeScene(this._runtimeGame);
+        newScene.loadFromScene(
+          this._runtimeGame.getSceneAndExtensionsData(newSceneName)
+        );
+      }
       this._wasFirstSceneLoaded = true;
 
       // Optionally create the objects from an external layout.
@@ -183,6 +205,97 @@ namespace gdjs {
       return newScene;
     }
 
+    /**
+     * Prepare a scene in background so that it starts instantly when it's
+     * pushed or replaces the current scene: its resources are loaded and
+     * processed, then its initial instances are created a few at each frame
+     * (see `SceneStack.preInstantiationMaxDuration`).
+     *
+     * The scene is not played (and its events are not run) until it's
+     * started.
+     */
+    preInstantiateScene(sceneName: string): void {
+      this._throwIfDisposed();
+      if (
+        this._preInstantiatedScenes.has(sceneName) ||
+        this._scenesToPreInstantiate.includes(sceneName)
+      ) {
+        return;
+      }
+      this._scenesToPreInstantiate.push(sceneName);
+      this._runtimeGame
+        .getResourceLoader()
+        .loadAndProcessSceneResources(sceneName)
+        .catch((error) => {
+          logger.error(
+            'Error while preparing scene "' + sceneName + '" in background:',
+            error
+          );
+          this._takePreInstantiatedScene(sceneName);
+        });
+    }
+
+    /**
+     * Return true if the scene was prepared in background by
+     * `preInstantiateScene` and all its initial instances are created.
+     */
+    isScenePreInstantiated(sceneName: string): boolean {
+      return (
+        this._preInstantiatedScenes.has(sceneName) &&
+        !this._scenesToPreInstantiate.includes(sceneName)
+      );
+    }
+
+    /**
+     * Create some initial instances of the first scene being prepared in
+     * background, once its resources are ready.
+     */
+    private _stepPreInstantiation(): void {
+      if (this._scenesToPreInstantiate.length === 0) {
+        return;
+      }
+      const sceneName = this._scenesToPreInstantiate[0];
+      if (!this._runtimeGame.areSceneAssetsReady(sceneName)) {
+        return;
+      }
+      let scene = this._preInstantiatedScenes.get(sceneName);
+      if (!scene) {
+        const sceneAndExtensionsData =
+          this._runtimeGame.getSceneAndExtensionsData(sceneName);
+        if (!sceneAndExtensionsData) {
+          this._scenesToPreInstantiate.shift();
+          return;
+        }
+        scene = new gdjs.RuntimeScene(this._runtimeGame);
+        scene.beginLoadFromScene(sceneAndExtensionsData);
+        this._preInstantiatedScenes.set(sceneName, scene);
+      }
+      if (
+        scene.createInitialInstances(SceneStack.preInstantiationMaxDuration)
+      ) {
+        this._scenesToPreInstantiate.shift();
+      }
+    }
+
+    /**
+     * Remove a scene prepared in background from the prepared scenes.
+     * @returns The scene, or null if the scene was not prepared.
+     */
+    private _takePreInstantiatedScene(
+      sceneName: string
+    ): gdjs.RuntimeScene | null {
+      const scene = this._preInstantiatedScenes.get(sceneName);
+      const queueIndex = this._scenesToPreInstantiate.indexOf(sceneName);
+      if (queueIndex !== -1) {
+        this._scenesToPreInstantiate.splice(queueIndex, 1);
+      }
+      if (!scene) {
+        return null;
+      }
+      this._preInstantiatedScenes.delete(sceneName);
+      return scene;
+    }
+
     /**
      * Start the specified scene, replacing the one currently being played.
      * If `clear` is set to true, all running scenes are also removed from the stack of scenes.
@@ -389,6 +502,11 @@ namespace gdjs {
           });
         }
       }
+      for (const scene of this._preInstantiatedScenes.values()) {
+        scene.unloadScene();
+      }
+      this._preInstantiatedScenes.clear();
+      this._scenesToPreInstantiate.length = 0;
 
       this._wasDisposed = true;
     }
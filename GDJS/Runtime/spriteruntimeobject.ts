@@ -115,9 +115,11 @@ namespace gdjs {
       return true;
     }
 
-    getNetworkSyncData(): SpriteNetworkSyncData {
+    getNetworkSyncData(
+      syncOptions: GetNetworkSyncDataOptions
+    ): SpriteNetworkSyncData {
       return {
-        ...super.getNetworkSyncData(),
+        ...super.getNetworkSyncData(syncOptions),
         anim: this._animator.getNetworkSyncData(),
         ifx: this.isFlippedX(),
         ify: this.isFlippedY(),
@@ -212,8 +214,11 @@ namespace gdjs {
       const hasFrameChanged = this._animator.step(this.getElapsedTime() / 1000);
       if (hasFrameChanged) {
         this._updateAnimationFrame();
-        // TODO: Hitboxes may not need an update if every frames has the same ones.
-        this.invalidateHitboxes();
+        // Most animations have the same hitboxes for all their frames:
+        // don't recompute them (and the AABB) for nothing.
+        if (!this._animator.haveCurrentFramesSameHitBoxes()) {
+          this.invalidateHitboxes();
+        }
       }
       this._renderer.ensureUpToDate();
     }
@@ -14,7 +14,7 @@ namespace gdjs {
     _timeScale: float = 1;
     _timeFromStart: float = 0;
     _firstFrame: boolean = true;
-    _timers: Hashtable<gdjs.Timer> = new Hashtable();
+    _timers: gdjs.TimersContainer = new gdjs.TimersContainer();
     _firstUpdateDone: boolean = false;
 
     constructor() {
@@ -26,7 +26,7 @@ namespace gdjs {
       this._timeScale = 1;
       this._timeFromStart = 0;
       this._firstFrame = true;
-      this._timers = new Hashtable();
+      this._timers = new gdjs.TimersContainer();
     }
 
     update(elapsedTime: float, minimumFPS: integer): void {
@@ -40,11 +40,7 @@ namespace gdjs {
       this._elapsedTime *= this._timeScale;
 
       //Update timers and others members
-      for (const name in this._timers.items) {
-        if (this._timers.items.hasOwnProperty(name)) {
-          this._timers.items[name].updateTime(this._elapsedTime);
-        }
-      }
+      this._timers.updateTime(this._elapsedTime);
       this._timeFromStart += this._elapsedTime;
     }
 
@@ -91,22 +87,20 @@ namespace gdjs {
       return this._elapsedTime;
     }
 
-    addTimer(name: string): void {
-      this._timers.put(name, new gdjs.Timer(name));
+    addTimer(name: gdjs.TimerNameOrSlot): gdjs.Timer {
+      return this._timers.add(name);
     }
 
-    hasTimer(name: string): boolean {
-      return this._timers.containsKey(name);
+    hasTimer(name: gdjs.TimerNameOrSlot): boolean {
+      return this._timers.has(name);
     }
 
-    getTimer(name: string): gdjs.Timer {
+    getTimer(name: gdjs.TimerNameOrSlot): gdjs.Timer | null {
       return this._timers.get(name);
     }
 
-    removeTimer(name: string): void {
-      if (this._timers.containsKey(name)) {
-        this._timers.remove(name);
-      }
+    removeTimer(name: gdjs.TimerNameOrSlot): void {
+      this._timers.remove(name);
     }
   }
 }
@@ -4,14 +4,56 @@
  * This project is released under the MIT License.
  */
 namespace gdjs {
+  /**
+   * The name of a timer, or its slot (see {@link gdjs.Timer.getSlot}).
+   */
+  export type TimerNameOrSlot = string | integer;
+
   /**
    * Represents a timer, which must be updated manually with {@link gdjs.Timer.updateTime}.
    */
   export class Timer {
+    private static _slotsByName = new Map<string, integer>();
+    private static _namesBySlot: string[] = [];
+
     _name: string;
     _time: float = 0;
     _paused: boolean = false;
 
+    /**
+     * Get the slot of the timers having this name.
+     *
+     * Slots are shared by all the scenes and objects, and never change during
+     * the game. The generated code resolves them once for the timers having
+     * a constant name, so that accessing these timers doesn't hash their name.
+     *
+     * @param name The name of the timer.
+     * @return The slot of the timer.
+     */
+    static getSlot(name: string): integer {
+      let slot = Timer._slotsByName.get(name);
+      if (slot === undefined) {
+        slot = Timer._namesBySlot.length;
+        Timer._slotsByName.set(name, slot);
+        Timer._namesBySlot.push(name);
+      }
+      return slot;
+    }
+
+    /**
+     * Get the name of the timers having this slot.
+     * @param slot The slot of the timer (see {@link gdjs.Timer.getSlot}).
+     */
+    static getNameOfSlot(slot: integer): string {
+      return Timer._namesBySlot[slot] || '';
+    }
+
+    static _toSlot(timerNameOrSlot: gdjs.TimerNameOrSlot): integer {
+      return typeof timerNameOrSlot === 'number'
+        ? timerNameOrSlot
+        : Timer.getSlot(timerNameOrSlot);
+    }
+
     /**
      * @param name The name of the timer.
      */
@@ -87,4 +129,100 @@ namespace gdjs {
       this._paused = syncData.paused;
     }
   }
+
+  /**
+   * The timers of a scene or of an object, stored by slot (see
+   * {@link gdjs.Timer.getSlot}).
+   */
+  export class TimersContainer {
+    /** The timers, by slot. */
+    private _timersBySlot: Array<gdjs.Timer | undefined> = [];
+    /** The timers, to update them without going through all the slots. */
+    private _timers: gdjs.Timer[] = [];
+
+    /**
+     * Check if a timer exists.
+     * @param timerNameOrSlot The name or the slot of the timer.
+     */
+    has(timerNameOrSlot: gdjs.TimerNameOrSlot): boolean {
+      return (
+        this._timersBySlot[gdjs.Timer._toSlot(timerNameOrSlot)] !== undefined
+      );
+    }
+
+    /**
+     * Get a timer.
+     * @param timerNameOrSlot The name or the slot of the timer.
+     * @return The timer, or null if it doesn't exist.
+     */
+    get(timerNameOrSlot: gdjs.TimerNameOrSlot): gdjs.Timer | null {
+      return this._timersBySlot[gdjs.Timer._toSlot(timerNameOrSlot)] || null;
+    }
+
+    /**
+     * Create a timer, replacing the existing one if any.
+     * @param timerNameOrSlot The name or the slot of the timer.
+     * @return The new timer.
+     */
+    add(timerNameOrSlot: gdjs.TimerNameOrSlot): gdjs.Timer {
+      const slot = gdjs.Timer._toSlot(timerNameOrSlot);
+      this.remove(slot);
+      const timer = new gdjs.Timer(gdjs.Timer.getNameOfSlot(slot));
+      this._timersBySlot[slot] = timer;
+      this._timers.push(timer);
+      return timer;
+    }
+
+    /**
+     * Get a timer, creating it if it doesn't exist.
+     * @param timerNameOrSlot The name or the slot of the timer.
+     */
+    getOrAdd(timerNameOrSlot: gdjs.TimerNameOrSlot): gdjs.Timer {
+      const slot = gdjs.Timer._toSlot(timerNameOrSlot);
+      return this._timersBySlot[slot] || this.add(slot);
+    }
+
+    /**
+     * Remove a timer, if it exists.
+     * @param timerNameOrSlot The name or the slot of the timer.
+     */
+    remove(timerNameOrSlot: gdjs.TimerNameOrSlot): void {
+      const slot = gdjs.Timer._toSlot(timerNameOrSlot);
+      const timer = this._timersBySlot[slot];
+      if (!timer) {
+        return;
+      }
+      this._timersBySlot[slot] = undefined;
+      const index = this._timers.indexOf(timer);
+      if (index !== -1) {
+        this._timers.splice(index, 1);
+      }
+    }
+
+    /**
+     * Remove all the timers.
+     */
+    clear(): void {
+      this._timersBySlot.length = 0;
+      this._timers.length = 0;
+    }
+
+    /**
+     * Notify all the timers that some time has passed.
+     * @param time The elapsed time, in milliseconds.
+     */
+    updateTime(time: float): void {
+      const timers = this._timers;
+      for (let i = 0, len = timers.length; i < len; i++) {
+        timers[i].updateTime(time);
+      }
+    }
+
+    /**
+     * Get all the timers. The array must not be modified.
+     */
+    getAll(): gdjs.Timer[] {
+      return this._timers;
+    }
+  }
 }
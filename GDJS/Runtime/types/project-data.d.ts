@@ -37,11 +37,26 @@ declare type ObjectData = {
   behaviors: Array<BehaviorData & any>;
   /** The list of effects. */
   effects: Array<EffectData>;
+  /**
+   * The maximum number of deleted instances kept to be reused when instances
+   * are created (if the object supports it). Default to 128 if not set or 0.
+   */
+  instancesPoolSize?: integer;
 };
 
 declare type GetNetworkSyncDataOptions = {
   playerNumber?: number;
   isHost?: boolean;
+  /**
+   * If true, behaviors can give only the properties that changed since
+   * their last synchronization done with this option (the data is assumed to be sent).
+   */
+  syncOnlyChangedProperties?: boolean;
+  /**
+   * If set, the numbers of the behaviors can be rounded to a multiple of this value,
+   * to reduce the size of the synchronized data.
+   */
+  numbersPrecision?: float;
 };
 
 /** Object containing basic properties for all objects synchronizing over the network. */
@@ -175,6 +190,33 @@ declare interface LayoutData extends InstanceContainerData {
   usedResources: ResourceReference[];
   resourcesPreloading?: 'at-startup' | 'never' | 'inherit';
   resourcesUnloading?: 'at-scene-exit' | 'never' | 'inherit';
+  /**
+   * If set, the scene was exported with only its name and the resources it
+   * uses: the rest of its data is in this file, loaded with its resources.
+   */
+  dataFile?: string;
+  /**
+   * The external layouts only used by this scene, exported in the file of the
+   * scene (see `dataFile`) instead of the project data.
+   */
+  externalLayouts?: ExternalLayoutData[];
+  /**
+   * If set, the scene was exported with most of its instances grouped in
+   * chunks of this size, created only when they are near the cameras.
+   */
+  instancesChunkSize?: number;
+  instancesChunks?: InstancesChunkData[];
+}
+
+/**
+ * The initial instances of a scene that are in a chunk (they have their
+ * top-left corner in it).
+ */
+declare interface InstancesChunkData {
+  /** The coordinates of the chunk, in chunks. */
+  x: integer;
+  y: integer;
+  instances: InstanceData[];
 }
 
 declare interface LayoutNetworkSyncData {
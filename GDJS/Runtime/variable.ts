@@ -11,6 +11,55 @@ namespace gdjs {
    */
   type Children = Record<string, gdjs.Variable>;
 
+  /**
+   * A child of a structure or an array, as stored by the variable.
+   *
+   * Children that are numbers, strings or booleans are stored inline, without
+   * a `gdjs.Variable`, and are only transformed into one when they are
+   * accessed (see `getChildNamed`, `getChildAt` or `getAllChildren`). This
+   * saves a lot of memory for big structures like the ones loaded from JSON.
+   */
+  type InlineChild = gdjs.Variable | float | string | boolean;
+
+  const getInlineChildFromData = (childData: VariableData): InlineChild => {
+    const type = childData.type || 'number';
+    if (type === 'number') {
+      const value = parseFloat((childData.value as string) || '0');
+      // Protect against NaN.
+      return value === value ? value : 0;
+    } else if (type === 'string') {
+      return '' + childData.value || '0';
+    } else if (type === 'boolean') {
+      return !!childData.value;
+    }
+    return new gdjs.Variable(childData);
+  };
+
+  const getInlineChildFromJSObject = (obj: any): InlineChild => {
+    if (
+      (typeof obj === 'number' && !Number.isNaN(obj)) ||
+      typeof obj === 'string' ||
+      typeof obj === 'boolean'
+    ) {
+      return obj;
+    }
+    return new gdjs.Variable().fromJSObject(obj);
+  };
+
+  const getVariableFromInlineChild = (child: InlineChild): gdjs.Variable => {
+    if (typeof child === 'object') {
+      return child;
+    }
+    const variable = new gdjs.Variable();
+    if (typeof child === 'number') variable.setNumber(child);
+    else if (typeof child === 'string') variable.setString(child);
+    else variable.setBoolean(child);
+    return variable;
+  };
+
+  const cloneInlineChild = (child: InlineChild): InlineChild =>
+    typeof child === 'object' ? child.clone() : child;
+
   /**
    * A Variable is an object storing a value (number or a string) or children variables.
    */
@@ -20,8 +69,8 @@ namespace gdjs {
     _value: float = 0;
     _str: string = '0';
     _bool: boolean = false;
-    _children: Children = {};
-    _childrenArray: gdjs.Variable[] = [];
+    _children: Record<string, InlineChild> = {};
+    _childrenArray: InlineChild[] = [];
     _undefinedInContainer: boolean = false;
 
     // When synchronised over the network, this defines which player is the owner of the variable.
@@ -60,12 +109,13 @@ namespace gdjs {
             for (var i = 0, len = varData.children.length; i < len; ++i) {
               var childData = varData.children[i];
               if (childData.name === undefined) continue;
-              this._children[childData.name] = new gdjs.Variable(childData);
+              this._children[childData.name] =
+                getInlineChildFromData(childData);
             }
           }
         } else if (this._type === 'array' && varData.children) {
           for (const childData of varData.children)
-            this._childrenArray.push(new gdjs.Variable(childData));
+            this._childrenArray.push(getInlineChildFromData(childData));
         }
       }
     }
@@ -93,17 +143,19 @@ namespace gdjs {
     ): gdjs.Variable {
       if (!merge) target.clearChildren();
       target.castTo(source.getType());
+      // The target can't be changed (it's a placeholder for a missing variable).
+      if (target.getType() !== source.getType()) return target;
       if (source.isPrimitive()) {
         target.setValue(source.getValue());
       } else if (source.getType() === 'structure') {
-        const children = source.getAllChildren();
+        const children = source._children;
         for (const p in children) {
           if (children.hasOwnProperty(p))
-            target.addChild(p, children[p].clone());
+            target._children[p] = cloneInlineChild(children[p]);
         }
       } else if (source.getType() === 'array') {
-        for (const p of source.getAllChildrenArray())
-          target.pushVariableCopy(p);
+        for (const p of source._childrenArray)
+          target._childrenArray.push(cloneInlineChild(p));
       }
       return target;
     }
@@ -132,12 +184,15 @@ namespace gdjs {
       } else if (Array.isArray(obj)) {
         this.castTo('array');
         this.clearChildren();
-        for (const i in obj) this.getChild(i).fromJSObject(obj[i]);
+        for (const i in obj)
+          this._childrenArray[parseInt(i, 10) || 0] =
+            getInlineChildFromJSObject(obj[i]);
       } else if (typeof obj === 'object') {
         this.castTo('structure');
         this.clearChildren();
         for (var p in obj)
-          if (obj.hasOwnProperty(p)) this.getChild(p).fromJSObject(obj[p]);
+          if (obj.hasOwnProperty(p))
+            this._children[p] = getInlineChildFromJSObject(obj[p]);
       } else if (typeof obj === 'symbol') {
         this.setString(obj.toString());
       } else if (typeof obj === 'bigint') {
@@ -194,8 +249,10 @@ namespace gdjs {
           return this.getAsBoolean();
         case 'structure':
           const obj = {};
-          for (const name in this._children)
-            obj[name] = this._children[name].toJSObject();
+          for (const name in this._children) {
+            const child = this._children[name];
+            obj[name] = typeof child === 'object' ? child.toJSObject() : child;
+          }
           return obj;
         case 'array':
           const arr: any[] = [];
@@ -204,7 +261,12 @@ namespace gdjs {
             // A variable can have empty items in its children array if one inserts
             // a variable at an index greater than highest index. All the array elements
             // in the gap will be empty elements.
-            arr.push(item === undefined ? undefined : item.toJSObject());
+            arr.push(
+              typeof item === 'object'
+                ? item.toJSObject()
+                : // Inline children are already primitive values.
+                  item
+            );
           }
           return arr;
       }
@@ -295,6 +357,8 @@ namespace gdjs {
       const child = this._children[childName];
       if (child === undefined || child === null)
         return (this._children[childName] = new gdjs.Variable());
+      if (typeof child !== 'object')
+        return (this._children[childName] = getVariableFromInlineChild(child));
 
       return child;
     }
@@ -513,9 +577,12 @@ namespace gdjs {
      */
     getAllChildren(): Children {
       return this._type === 'structure'
-        ? this._children
+        ? this._getAllChildrenAsVariables()
         : this._type === 'array'
-          ? (Object.assign({}, this._childrenArray) as unknown as Children)
+          ? (Object.assign(
+              {},
+              this._getAllChildrenArrayAsVariables()
+            ) as unknown as Children)
           : {};
     }
 
@@ -524,12 +591,41 @@ namespace gdjs {
      */
     getAllChildrenArray(): gdjs.Variable[] {
       return this._type === 'structure'
-        ? Object.values(this._children)
+        ? Object.values(this._getAllChildrenAsVariables())
         : this._type === 'array'
-          ? this._childrenArray
+          ? this._getAllChildrenArrayAsVariables()
           : [];
     }
 
+    /**
+     * Transform the inline children of the structure into variables.
+     */
+    private _getAllChildrenAsVariables(): Children {
+      const children = this._children;
+      for (const name in children) {
+        const child = children[name];
+        if (typeof child !== 'object') {
+          children[name] = getVariableFromInlineChild(child);
+        }
+      }
+      return children as Children;
+    }
+
+    /**
+     * Transform the inline children of the array into variables.
+     */
+    private _getAllChildrenArrayAsVariables(): gdjs.Variable[] {
+      const childrenArray = this._childrenArray;
+      for (let index = 0; index < childrenArray.length; index++) {
+        const child = childrenArray[index];
+        // Empty elements are kept.
+        if (child !== undefined && typeof child !== 'object') {
+          childrenArray[index] = getVariableFromInlineChild(child);
+        }
+      }
+      return childrenArray as gdjs.Variable[];
+    }
+
     /**
      * Return the length of the collection.
      */
@@ -596,12 +692,12 @@ namespace gdjs {
     getChildAt(index: integer) {
       if (this._type !== 'array') this.castTo('array');
 
-      if (
-        this._childrenArray[index] === undefined ||
-        this._childrenArray[index] === null
-      )
-        this._childrenArray[index] = new gdjs.Variable();
-      return this._childrenArray[index];
+      const child = this._childrenArray[index];
+      if (child === undefined || child === null)
+        return (this._childrenArray[index] = new gdjs.Variable());
+      if (typeof child !== 'object')
+        return (this._childrenArray[index] = getVariableFromInlineChild(child));
+      return child;
     }
 
     /**
@@ -637,7 +733,7 @@ namespace gdjs {
       if (this._type !== 'array') this.castTo('array');
 
       this._childrenArray.push(
-        new gdjs.Variable({
+        getInlineChildFromData({
           type: typeof value as 'string' | 'number' | 'boolean',
           value,
         })
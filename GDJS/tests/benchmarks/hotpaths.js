@@ -0,0 +1,195 @@
+// Benchmarks of the hot paths of the game engine: each suite is added to
+// the JSON report of the benchmarks (see init.js and karma.conf.js).
+describe('GDJS hot paths', function () {
+  const makeSceneWithObjects = (objectsCount) => {
+    const runtimeGame = gdjs.getPixiRuntimeGame();
+    const runtimeScene = new gdjs.TestRuntimeScene(runtimeGame);
+    runtimeScene.registerObject({
+      name: 'MyObjectA',
+      type: 'TestObject::TestObject',
+      behaviors: [
+        { type: 'TestBehavior::TestBehavior', name: 'SomeBehavior' },
+      ],
+      variables: [],
+      effects: [],
+    });
+    runtimeScene.registerObject({
+      name: 'MyObjectB',
+      type: 'TestObject::TestObject',
+      behaviors: [],
+      variables: [],
+      effects: [],
+    });
+
+    const objectsA = [];
+    const objectsB = [];
+    for (let i = 0; i < objectsCount; i++) {
+      const objectA = runtimeScene.createObject('MyObjectA');
+      objectA.setPosition((i * 37) % 2000, (i * 53) % 2000);
+      objectsA.push(objectA);
+      const objectB = runtimeScene.createObject('MyObjectB');
+      objectB.setPosition((i * 71) % 2000, (i * 29) % 2000);
+      objectsB.push(objectB);
+    }
+    return { runtimeGame, runtimeScene, objectsA, objectsB };
+  };
+
+  it('benchmark object picking', function () {
+    this.timeout(60000);
+    const { objectsA } = makeSceneWithObjects(1000);
+    const objectsLists = Hashtable.newFrom({ MyObjectA: [] });
+    const isOnTheLeft = (object) => object.getX() < 1000;
+
+    runBenchmarkSuite(
+      'object picking',
+      makeBenchmarkSuite({ benchmarksCount: 30, iterationsCount: 200 })
+        .add('pickObjectsIf (1000 objects)', () => {
+          const list = objectsLists.get('MyObjectA');
+          list.length = 0;
+          list.push.apply(list, objectsA);
+          gdjs.evtTools.object.pickObjectsIf(
+            isOnTheLeft,
+            objectsLists,
+            false,
+            null
+          );
+        })
+        .add('filterPickedObjectsList (1000 objects)', (i) => {
+          const list = objectsLists.get('MyObjectA');
+          list.length = 0;
+          for (let k = 0; k < objectsA.length; k++) {
+            objectsA[k].pick = (k + i) % 2 === 0;
+            list.push(objectsA[k]);
+          }
+          gdjs.evtTools.object.filterPickedObjectsList(list);
+        })
+    );
+  });
+
+  it('benchmark collision tests', function () {
+    this.timeout(60000);
+    const { objectsA, objectsB } = makeSceneWithObjects(500);
+    objectsA.concat(objectsB).forEach((object) =>
+      object.setCustomWidthAndHeight(20, 20)
+    );
+    const objectsLists1 = Hashtable.newFrom({ MyObjectA: [] });
+    const objectsLists2 = Hashtable.newFrom({ MyObjectB: [] });
+    const fillLists = () => {
+      const list1 = objectsLists1.get('MyObjectA');
+      list1.length = 0;
+      list1.push.apply(list1, objectsA);
+      const list2 = objectsLists2.get('MyObjectB');
+      list2.length = 0;
+      list2.push.apply(list2, objectsB);
+    };
+
+    runBenchmarkSuite(
+      'collision tests',
+      makeBenchmarkSuite({ benchmarksCount: 10, iterationsCount: 10 })
+        .add('hitBoxesCollisionTest (500x500 objects)', () => {
+          fillLists();
+          gdjs.evtTools.object.hitBoxesCollisionTest(
+            objectsLists1,
+            objectsLists2,
+            false,
+            null,
+            false
+          );
+        })
+        .add('distanceTest (500x500 objects)', () => {
+          fillLists();
+          gdjs.evtTools.object.distanceTest(
+            objectsLists1,
+            objectsLists2,
+            50,
+            false
+          );
+        })
+    );
+  });
+
+  it('benchmark variable access chains', function () {
+    this.timeout(60000);
+    const variables = new gdjs.VariablesContainer();
+    variables
+      .get('Player')
+      .getChild('Inventory')
+      .getChild('Items')
+      .getChild('Sword')
+      .setNumber(3);
+    const array = variables.get('Scores');
+    for (let i = 0; i < 100; i++) array.pushValue(i);
+
+    runBenchmarkSuite(
+      'variable access chains',
+      makeBenchmarkSuite({ benchmarksCount: 30, iterationsCount: 100000 })
+        .add('read Player.Inventory.Items.Sword', () => {
+          variables
+            .get('Player')
+            .getChild('Inventory')
+            .getChild('Items')
+            .getChild('Sword')
+            .getAsNumber();
+        })
+        .add('write Player.Inventory.Items.Sword', (i) => {
+          variables
+            .get('Player')
+            .getChild('Inventory')
+            .getChild('Items')
+            .getChild('Sword')
+            .setNumber(i);
+        })
+        .add('read Scores[i]', (i) => {
+          array.getChildAt(i % 100).getAsNumber();
+        })
+    );
+  });
+
+  it('benchmark objects creation and deletion', function () {
+    this.timeout(60000);
+    const { runtimeScene } = makeSceneWithObjects(0);
+
+    runBenchmarkSuite(
+      'objects creation and deletion',
+      makeBenchmarkSuite({ benchmarksCount: 30, iterationsCount: 100 })
+        .add('create and delete 100 objects', () => {
+          const objects = [];
+          for (let k = 0; k < 100; k++) {
+            objects.push(runtimeScene.createObject('MyObjectB'));
+          }
+          for (let k = 0; k < 100; k++) {
+            objects[k].deleteFromScene();
+          }
+        })
+        .add('create and delete 100 objects with a behavior', () => {
+          const objects = [];
+          for (let k = 0; k < 100; k++) {
+            objects.push(runtimeScene.createObject('MyObjectA'));
+          }
+          for (let k = 0; k < 100; k++) {
+            objects[k].deleteFromScene();
+          }
+        })
+    );
+  });
+
+  it('benchmark behaviors stepping and rendering', function () {
+    this.timeout(60000);
+    const { runtimeScene, objectsA, objectsB } = makeSceneWithObjects(1000);
+    const allObjects = objectsA.concat(objectsB);
+
+    runBenchmarkSuite(
+      'scene step and render',
+      makeBenchmarkSuite({ benchmarksCount: 20, iterationsCount: 20 })
+        .add('renderAndStep (2000 objects, 1000 behaviors)', () => {
+          runtimeScene.renderAndStep(1000 / 60);
+        })
+        .add('move and renderAndStep (2000 objects)', (i) => {
+          for (let k = 0; k < allObjects.length; k++) {
+            allObjects[k].setX(allObjects[k].getX() + (i % 2 ? 1 : -1));
+          }
+          runtimeScene.renderAndStep(1000 / 60);
+        })
+    );
+  });
+});
@@ -2,15 +2,24 @@
  * Helper allowing to run a benchmark of the time spent the execute a certain
  * number of iterations of one or more functions.
  *
+ * Each test case is first run `warmUpIterationsCount` times (so that it's
+ * optimized by the JavaScript engine before being measured), then
+ * `benchmarksCount` times `iterationsCount` iterations are measured.
+ *
  * Note that this could surely be replaced by a more robust solution like
  * Benchmark.js
  *
- * @param {*} options
+ * @param {{benchmarksCount?: number, iterationsCount?: number, warmUpIterationsCount?: number}} options
  */
 let makeBenchmarkSuite = (options = {}) => {
   const benchmarkTimings = {};
+  const benchmarkGcCounts = {};
   const benchmarksCount = options.benchmarksCount || 1000;
   const iterationsCount = options.iterationsCount || 100000;
+  const warmUpIterationsCount =
+    options.warmUpIterationsCount !== undefined
+      ? options.warmUpIterationsCount
+      : Math.ceil(iterationsCount / 10);
   const testCases = [];
 
   const suite = {};
@@ -19,6 +28,12 @@ let makeBenchmarkSuite = (options = {}) => {
     return suite;
   };
   suite.run = () => {
+    testCases.forEach((testCase) => {
+      for (let i = 0; i < warmUpIterationsCount; i++) {
+        testCase.fn(i);
+      }
+    });
+
     for (
       let benchmarkIndex = 0;
       benchmarkIndex < benchmarksCount;
@@ -26,12 +41,18 @@ let makeBenchmarkSuite = (options = {}) => {
     ) {
       testCases.forEach(testCase => {
         const description = testCase.title + '(' + iterationsCount + 'x)';
+        const usedHeapSizeBefore = getUsedHeapSize();
         const start = performance.now();
         for (let i = 0; i < iterationsCount; i++) {
           testCase.fn(i);
         }
         benchmarkTimings[description] = benchmarkTimings[description] || [];
         benchmarkTimings[description].push(performance.now() - start);
+
+        // The used heap can only decrease if the garbage collector ran.
+        benchmarkGcCounts[description] = benchmarkGcCounts[description] || 0;
+        if (getUsedHeapSize() < usedHeapSizeBefore)
+          benchmarkGcCounts[description]++;
       });
     }
 
@@ -43,5 +64,76 @@ let makeBenchmarkSuite = (options = {}) => {
     }
     return results;
   };
+  /**
+   * Return, once `run` was called, the measures of each test case: the mean
+   * time (in ms) of `iterationsCount` iterations, the operations (iterations)
+   * per second, the percentiles of the time of an iteration (in ms) and the
+   * number of measures during which the garbage collector ran (only in
+   * browsers giving the used heap size, like Chrome).
+   */
+  suite.getReport = () => {
+    const report = {};
+    for (let benchmarkName in benchmarkTimings) {
+      const timings = benchmarkTimings[benchmarkName];
+      const meanTime =
+        timings.reduce((sum, value) => sum + value, 0) / timings.length;
+      const iterationTimings = timings
+        .map((timing) => timing / iterationsCount)
+        .sort((a, b) => a - b);
+      report[benchmarkName] = {
+        iterationsCount,
+        benchmarksCount,
+        meanTime,
+        opsPerSecond: meanTime > 0 ? (iterationsCount * 1000) / meanTime : 0,
+        p50: getPercentile(iterationTimings, 0.5),
+        p90: getPercentile(iterationTimings, 0.9),
+        p99: getPercentile(iterationTimings, 0.99),
+        gcCount: benchmarkGcCounts[benchmarkName],
+      };
+    }
+    return report;
+  };
   return suite;
 };
+
+const getUsedHeapSize = () =>
+  // @ts-ignore - Only available in Chrome.
+  (performance.memory && performance.memory.usedJSHeapSize) || 0;
+
+const getPercentile = (sortedValues, percentile) =>
+  sortedValues.length
+    ? sortedValues[
+        Math.min(
+          sortedValues.length - 1,
+          Math.floor(percentile * sortedValues.length)
+        )
+      ]
+    : 0;
+
+/**
+ * The reports of the benchmark suites run with `runBenchmarkSuite`, logged
+ * as JSON at the end of the benchmarks (and written to a file by the
+ * `benchmarks-json` reporter, see karma.conf.js).
+ */
+const benchmarksReport = {
+  userAgent: typeof navigator !== 'undefined' ? navigator.userAgent : '',
+  date: new Date().toISOString(),
+  suites: {},
+};
+
+/**
+ * Run a benchmark suite, log its results and add its report to the report
+ * of all the benchmarks.
+ */
+let runBenchmarkSuite = (name, benchmarkSuite) => {
+  const results = benchmarkSuite.run();
+  const report = benchmarkSuite.getReport();
+  benchmarksReport.suites[name] = report;
+
+  console.log(name, results);
+  return report;
+};
+
+after(() => {
+  console.log('GDJS_BENCHMARKS_REPORT ' + JSON.stringify(benchmarksReport));
+});
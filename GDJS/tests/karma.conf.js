@@ -1,3 +1,44 @@
+const fs = require('fs');
+const path = require('path');
+
+/**
+ * Collect the report logged by the benchmarks (see benchmarks/init.js)
+ * and write it, as JSON, to the file given with `--benchmarksOutput`.
+ */
+function BenchmarksJsonReporter(baseReporterDecorator, config, logger) {
+  baseReporterDecorator(this);
+  const log = logger.create('reporter.benchmarks-json');
+  const reportPrefix = 'GDJS_BENCHMARKS_REPORT ';
+  const reports = [];
+
+  this.onBrowserLog = (browser, message) => {
+    const messageString = String(message);
+    const prefixIndex = messageString.indexOf(reportPrefix);
+    if (prefixIndex === -1) return;
+
+    const json = messageString.substring(
+      messageString.indexOf('{', prefixIndex),
+      messageString.lastIndexOf('}') + 1
+    );
+    try {
+      reports.push({ browser: browser.name, ...JSON.parse(json) });
+    } catch (error) {
+      log.error('Unable to read the benchmarks report: ' + error.message);
+    }
+  };
+
+  this.onRunComplete = () => {
+    if (!reports.length) return;
+
+    const outputPath = path.resolve(
+      config.benchmarksOutput || 'benchmarks-report.json'
+    );
+    fs.writeFileSync(outputPath, JSON.stringify(reports, null, 2));
+    log.info('Benchmarks report written to ' + outputPath);
+  };
+}
+BenchmarksJsonReporter.$inject = ['baseReporterDecorator', 'config', 'logger'];
+
 module.exports = function (config) {
   const testFiles = [
     './Extensions/**/tests/**.spec.js',
@@ -14,12 +55,23 @@ module.exports = function (config) {
     frameworks: ['mocha', 'sinon'],
     browserNoActivityTimeout: 400000,
     browsers: ['ChromeHeadless', 'EdgeHeadless', 'Chrome', 'Edge', 'Firefox'],
+    customLaunchers: {
+      // Give access to the precise memory usage, reported by the benchmarks.
+      ChromeHeadlessBenchmark: {
+        base: 'ChromeHeadless',
+        flags: ['--enable-precise-memory-info'],
+      },
+    },
+    reporters: config.benchmarksOutput
+      ? ['progress', 'benchmarks-json']
+      : ['progress'],
     plugins: [
       require('karma-chrome-launcher'),
       require('@chiragrupani/karma-chromium-edge-launcher'),
       require('karma-firefox-launcher'),
       require('karma-mocha'),
       require('karma-sinon'),
+      { 'reporter:benchmarks-json': ['type', BenchmarksJsonReporter] },
     ],
     client: {
       mocha: {
@@ -54,6 +106,8 @@ module.exports = function (config) {
       './newIDE/app/resources/GDJS/Runtime/timemanager.js',
       './newIDE/app/resources/GDJS/Runtime/polygon.js',
       './newIDE/app/resources/GDJS/Runtime/runtimeobject.js',
+      './newIDE/app/resources/GDJS/Runtime/ObjectsVisibilityIndex.js',
+      './newIDE/app/resources/GDJS/Runtime/InstancesStreamer.js',
       './newIDE/app/resources/GDJS/Runtime/RuntimeInstanceContainer.js',
       './newIDE/app/resources/GDJS/Runtime/runtimescene.js',
       './newIDE/app/resources/GDJS/Runtime/scenestack.js',
@@ -130,6 +184,7 @@ module.exports = function (config) {
       './newIDE/app/resources/GDJS/Runtime/Extensions/TextObject/textruntimeobject-pixi-renderer.js',
       './newIDE/app/resources/GDJS/Runtime/Extensions/3D/A_RuntimeObject3D.js',
       './newIDE/app/resources/GDJS/Runtime/Extensions/3D/A_RuntimeObject3DRenderer.js',
+      './newIDE/app/resources/GDJS/Runtime/Extensions/3D/InstancedMeshesBatcher.js',
       './newIDE/app/resources/GDJS/Runtime/Extensions/3D/Cube3DRuntimeObject.js',
       './newIDE/app/resources/GDJS/Runtime/Extensions/3D/Cube3DRuntimeObjectPixiRenderer.js',
       './newIDE/app/resources/GDJS/Runtime/Extensions/TopDownMovementBehavior/topdownmovementruntimebehavior.js',
@@ -14,6 +14,8 @@ gdjs.MockedResourceManager = class MockedResourceManager {
   loadedResources = new Set();
   waitingForProcessing = new Set();
   readyResources = new Set();
+  /** The memory size of each loaded resource, in bytes. */
+  resourceMemorySize = 0;
 
   loadResource(resourceName) {
     if (
@@ -103,6 +105,16 @@ gdjs.MockedResourceManager = class MockedResourceManager {
     }
   }
 
+  /**
+   * @param {ResourceData} resource
+   * @returns {number}
+   */
+  getResourceMemorySize(resource) {
+    return this.loadedResources.has(resource.name)
+      ? this.resourceMemorySize
+      : 0;
+  }
+
   /**
    * @returns {ResourceKind[]}
    */
@@ -33,6 +33,12 @@ gdjs.TestRuntimeBehavior = class TestRuntimeBehavior extends gdjs.RuntimeBehavio
   onDestroy() {
     this.owner.getVariables().get('lastState').setString('onDestroy');
   }
+
+  reinitialize(behaviorData) {
+    // The behavior has no state: it can always be reused.
+    this._activated = true;
+    return true;
+  }
 };
 
 gdjs.registerBehavior('TestBehavior::TestBehavior', gdjs.TestRuntimeBehavior);
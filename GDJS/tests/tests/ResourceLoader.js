@@ -307,6 +307,72 @@ describe('gdjs.ResourceLoader', () => {
     ).to.be(false);
   });
 
+  it('should keep resources of exited scenes until the memory budget is exceeded', async () => {
+    const mockedResourceManager = new gdjs.MockedResourceManager();
+    mockedResourceManager.resourceMemorySize = 1000;
+    const runtimeGame = gdjs.getPixiRuntimeGame(gameSettingsWithThreeScenes);
+    const resourceLoader = runtimeGame.getResourceLoader();
+    resourceLoader.injectMockResourceManagerForTesting(
+      'fake-resource-kind-for-testing-only',
+      mockedResourceManager
+    );
+    resourceLoader.setResourcesMemoryBudget(5000);
+
+    // Load all resources for all scenes
+    resourceLoader.loadAllResources(() => {});
+    for (const resourceName of [
+      'scene1-resource1.png',
+      'scene1-resource2.png',
+      'scene2-resource1.png',
+      'scene3-resource1.png',
+      'shared-resource.png',
+    ]) {
+      mockedResourceManager.markPendingResourcesAsLoaded(resourceName);
+    }
+    await delay(10);
+    expect(resourceLoader.getLoadedResourcesMemorySize()).to.be(5000);
+
+    // Exited scenes are kept as the resources fit in the budget.
+    resourceLoader.unloadSceneResources({
+      unloadedSceneName: 'Scene2',
+      newSceneName: 'Scene3',
+    });
+    resourceLoader.unloadSceneResources({
+      unloadedSceneName: 'Scene3',
+      newSceneName: 'Scene1',
+    });
+    expect(mockedResourceManager.disposedResources.size).to.be(0);
+    expect(resourceLoader.areSceneAssetsReady('Scene2')).to.be(true);
+    expect(resourceLoader.areSceneAssetsReady('Scene3')).to.be(true);
+
+    // The least recently exited scene is unloaded first, but not the
+    // resources still used by another loaded scene.
+    resourceLoader.setResourcesMemoryBudget(4000);
+    expect(
+      mockedResourceManager.isResourceDisposed('scene2-resource1.png')
+    ).to.be(true);
+    expect(
+      mockedResourceManager.isResourceDisposed('shared-resource.png')
+    ).to.be(false);
+    expect(
+      mockedResourceManager.isResourceDisposed('scene3-resource1.png')
+    ).to.be(false);
+    expect(resourceLoader.areSceneAssetsLoaded('Scene2')).to.be(false);
+    expect(resourceLoader.areSceneAssetsReady('Scene3')).to.be(true);
+    expect(resourceLoader.getLoadedResourcesMemorySize()).to.be(4000);
+
+    // A scene used again is not unloaded.
+    resourceLoader.markSceneAsUsed('Scene3');
+    resourceLoader.setResourcesMemoryBudget(1000);
+    expect(
+      mockedResourceManager.isResourceDisposed('scene3-resource1.png')
+    ).to.be(false);
+    expect(resourceLoader.areSceneAssetsReady('Scene3')).to.be(true);
+    expect(
+      mockedResourceManager.isResourceDisposed('scene1-resource1.png')
+    ).to.be(false);
+  });
+
   it('should handle background scene loading progress correctly', async () => {
     const mockedResourceManager = new gdjs.MockedResourceManager();
     const runtimeGame = gdjs.getPixiRuntimeGame(gameSettingsWithThreeScenes);
@@ -344,4 +410,34 @@ describe('gdjs.ResourceLoader', () => {
     // Progress should be complete (1.0)
     expect(resourceLoader.getSceneLoadingProgress('Scene2')).to.be(1);
   });
+
+  it('should measure the loading time of each resource', async () => {
+    const mockedResourceManager = new gdjs.MockedResourceManager();
+    const runtimeGame = gdjs.getPixiRuntimeGame(gameSettingsWithThreeScenes);
+    const resourceLoader = runtimeGame.getResourceLoader();
+    resourceLoader.injectMockResourceManagerForTesting(
+      'fake-resource-kind-for-testing-only',
+      mockedResourceManager
+    );
+
+    runtimeGame.loadFirstAssetsAndStartBackgroundLoading('Scene1');
+    expect(
+      resourceLoader.getResourcesLoadingTimings().get('scene1-resource1.png')
+    ).to.eql({ loadingTime: 0, processingTime: 0 });
+
+    await delay(20);
+    mockedResourceManager.markPendingResourcesAsLoaded('scene1-resource1.png');
+    mockedResourceManager.markPendingResourcesAsLoaded('scene1-resource2.png');
+    await delay(10);
+
+    const timings = resourceLoader
+      .getResourcesLoadingTimings()
+      .get('scene1-resource1.png');
+    if (!timings) throw new Error('Timings should have been measured.');
+    expect(timings.loadingTime).to.be.greaterThan(10);
+    // Resources of other scenes are not measured until they are loaded.
+    expect(
+      resourceLoader.getResourcesLoadingTimings().has('scene3-resource1.png')
+    ).to.be(false);
+  });
 });
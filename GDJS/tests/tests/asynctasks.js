@@ -53,6 +53,90 @@
       asyncTasksManager.processTasks(runtimeScene);
       cb.expectToNotHaveBeenCalled();
     });
+
+    it('should keep the pending tasks and the tasks added by callbacks', function () {
+      const firstTask = new gdjs.ManuallyResolvableTask();
+      const secondTask = new gdjs.ManuallyResolvableTask();
+      const firstCb = createMockCallback();
+      const secondCb = createMockCallback();
+      const addedCb = createMockCallback();
+      const addedTask = new gdjs.ManuallyResolvableTask();
+      asyncTasksManager.addTask(firstTask, () => {
+        firstCb();
+        asyncTasksManager.addTask(addedTask, addedCb);
+      });
+      asyncTasksManager.addTask(new NeverResolvingTask(), () => {});
+      asyncTasksManager.addTask(secondTask, secondCb);
+
+      firstTask.resolve();
+      asyncTasksManager.processTasks(runtimeScene);
+      firstCb.expectToHaveBeenCalledOnce();
+      secondCb.expectToNotHaveBeenCalled();
+      addedCb.expectToNotHaveBeenCalled();
+
+      secondTask.resolve();
+      addedTask.resolve();
+      asyncTasksManager.processTasks(runtimeScene);
+      firstCb.expectToHaveBeenCalledOnce();
+      secondCb.expectToHaveBeenCalledOnce();
+      addedCb.expectToHaveBeenCalledOnce();
+    });
+
+    it('should give the objects lists and the events function context to the callback', function () {
+      const asyncObjectsList = new gdjs.LongLivedObjectsList();
+      const eventsFunctionContext = {};
+      const sceneCallbackArguments = [];
+      const functionCallbackArguments = [];
+      asyncTasksManager.addTask(
+        new gdjs.ResolveTask(),
+        (...args) => sceneCallbackArguments.push(...args),
+        asyncObjectsList
+      );
+      asyncTasksManager.addTask(
+        new gdjs.ResolveTask(),
+        (...args) => functionCallbackArguments.push(...args),
+        asyncObjectsList,
+        // @ts-ignore - Only the identity of the context is checked.
+        eventsFunctionContext
+      );
+      asyncTasksManager.processTasks(runtimeScene);
+
+      expect(sceneCallbackArguments).to.eql([runtimeScene, asyncObjectsList]);
+      expect(functionCallbackArguments[0]).to.be(runtimeScene);
+      expect(functionCallbackArguments[1]).to.be(eventsFunctionContext);
+      expect(functionCallbackArguments[2]).to.be(asyncObjectsList);
+    });
+  });
+
+  describe('gdjs.LongLivedObjectsList', function () {
+    it('keeps the objects until they are removed', function () {
+      const runtimeGame = gdjs.getPixiRuntimeGame();
+      const runtimeScene = new gdjs.RuntimeScene(runtimeGame);
+      const objectData = {
+        name: 'MyObject',
+        type: '',
+        behaviors: [],
+        effects: [],
+      };
+      const object1 = new gdjs.RuntimeObject(runtimeScene, objectData);
+      const object2 = new gdjs.RuntimeObject(runtimeScene, objectData);
+
+      const parentList = new gdjs.LongLivedObjectsList();
+      parentList.addObject('MyObject', object1);
+      parentList.addObject('MyObject', object2);
+      parentList.addObject('MyObject', object1);
+      expect(parentList.getObjects('MyObject')).to.eql([object1, object2]);
+
+      // Objects not saved in a list are searched in its parent.
+      const list = gdjs.LongLivedObjectsList.from(parentList);
+      expect(list.getObjects('MyObject')).to.be(
+        parentList.getObjects('MyObject')
+      );
+      expect(list.getObjects('MyOtherObject')).to.eql([]);
+
+      parentList.removeObject('MyObject', object1);
+      expect(parentList.getObjects('MyObject')).to.eql([object2]);
+    });
   });
 
   describe('gdjs.PromiseTask', function () {
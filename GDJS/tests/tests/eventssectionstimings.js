@@ -0,0 +1,54 @@
+// @ts-check
+describe('gdjs.EventsSectionsTimings', () => {
+  afterEach(() => {
+    gdjs.EventsSectionsTimings.samplingRate = 0;
+  });
+
+  it('should only measure the sampled frames', () => {
+    const timings = new gdjs.EventsSectionsTimings(['Group 1', 'Group 2']);
+    let time = 0;
+    timings._getTimeNow = () => time;
+
+    const runFrame = () => {
+      timings.beginFrame();
+      if (timings.sampling) timings.begin(0);
+      time += 2;
+      if (timings.sampling) timings.begin(1);
+      time += 1;
+      if (timings.sampling) timings.end(1);
+      if (timings.sampling) timings.end(0);
+    };
+
+    // Nothing is measured by default.
+    runFrame();
+    expect(timings.sampledFramesCount).to.be(0);
+    expect(timings.counts[0]).to.be(0);
+
+    gdjs.EventsSectionsTimings.samplingRate = 2;
+    for (let i = 0; i < 4; i++) runFrame();
+    expect(timings.sampledFramesCount).to.be(2);
+    expect(timings.counts[0]).to.be(2);
+    expect(timings.times[0]).to.be(6);
+    expect(timings.times[1]).to.be(2);
+    expect(timings.getAverageTimePerFrame(0)).to.be(3);
+
+    timings.reset();
+    expect(timings.sampledFramesCount).to.be(0);
+    expect(timings.times[0]).to.be(0);
+  });
+
+  it('should keep the timings of a scene', () => {
+    const timings = gdjs.EventsSectionsTimings.getOrCreate(
+      'gdjs.MyTestSceneCode',
+      ['Group 1']
+    );
+    expect(
+      gdjs.EventsSectionsTimings.getOrCreate('gdjs.MyTestSceneCode', [
+        'Group 1',
+      ])
+    ).to.be(timings);
+    expect(gdjs.EventsSectionsTimings.getAll()['gdjs.MyTestSceneCode']).to.be(
+      timings
+    );
+  });
+});
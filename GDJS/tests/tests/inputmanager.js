@@ -242,6 +242,61 @@ describe('gdjs.InputManager', () => {
     inputManager.onTouchEnd(46);
   });
 
+  it('should keep the touches of ended touches until the end of the frame', () => {
+    inputManager.touchSimulateMouse(false);
+    inputManager.onTouchStart(50, 10, 20);
+    inputManager.onTouchStart(51, 30, 40);
+    inputManager.onTouchStart(52, 50, 60);
+    inputManager.onFrameEnded();
+
+    inputManager.onTouchEnd(50);
+    inputManager.onTouchMove(52, 55, 65);
+    expect(inputManager.hasTouchEnded(50)).to.be(true);
+    expect(inputManager.getTouchX(50)).to.be(10);
+    expect(inputManager.getAllTouchIdentifiers()).to.eql([50, 51, 52]);
+
+    inputManager.onFrameEnded();
+    expect(inputManager.hasTouchEnded(50)).to.be(false);
+    expect(inputManager.getTouchX(50)).to.be(0);
+    expect(inputManager.getAllTouchIdentifiers()).to.eql([51, 52]);
+    expect(inputManager.getTouchX(51)).to.be(30);
+    expect(inputManager.getTouchY(52)).to.be(65);
+
+    inputManager.onTouchEnd(51);
+    inputManager.onTouchEnd(52);
+  });
+
+  it('should ignore the touches beyond the maximum count', () => {
+    inputManager.touchSimulateMouse(false);
+    const touchesCount = gdjs.InputManager.MAX_TOUCHES_COUNT + 2;
+    for (let id = 100; id < 100 + touchesCount; id++) {
+      inputManager.onTouchStart(id, id, id);
+    }
+    expect(inputManager.getAllTouchIdentifiers()).to.have.length(
+      gdjs.InputManager.MAX_TOUCHES_COUNT
+    );
+    expect(inputManager.getTouchX(100 + touchesCount - 1)).to.be(0);
+
+    for (let id = 100; id < 100 + touchesCount; id++) {
+      inputManager.onTouchEnd(id);
+    }
+  });
+
+  it('should count the keys pressed once', () => {
+    inputManager.onKeyPressed(65);
+    inputManager.onKeyPressed(65);
+    inputManager.onKeyReleased(65);
+    expect(inputManager.anyKeyPressed()).to.be(false);
+    expect(inputManager.anyKeyReleased()).to.be(true);
+
+    inputManager.onKeyPressed(66);
+    inputManager.clearAllPressedKeys();
+    expect(inputManager.anyKeyPressed()).to.be(false);
+    inputManager.onFrameEnded();
+    expect(inputManager.anyKeyReleased()).to.be(false);
+    expect(inputManager.wasKeyReleased(65)).to.be(false);
+  });
+
   describe("deprecated touch functions that don't handle mouse", () => {
     it('should not simulate touch events from mouse events when legacy functions are used', () => {
       inputManager.onMouseMove(500, 600);
@@ -412,3 +467,55 @@ describe('gdjs.RuntimeObject.cursorOnObject', () => {
     expect(object.cursorOnObject(runtimeScene)).to.be(false);
   });
 });
+
+describe('gdjs.evtTools.input.cursorOnObject', () => {
+  const runtimeGame = gdjs.getPixiRuntimeGame();
+  const runtimeScene = new gdjs.RuntimeScene(runtimeGame);
+  runtimeScene.loadFromScene({sceneData: {
+    layers: [{ name: '', visibility: true, effects: [] }],
+    variables: [],
+    behaviorsSharedData: [],
+    objects: [],
+    instances: [],
+  }, usedExtensionsWithVariablesData: []});
+
+  const objects = [];
+  for (let i = 0; i < 10; i++) {
+    const object = new gdjs.RuntimeObject(runtimeScene, {
+      name: 'obj1',
+      type: '',
+      behaviors: [],
+      effects: [],
+    });
+    object.setPosition(i * 100, 500);
+    objects.push(object);
+  }
+
+  it('picks the objects under the cursor or a touch', () => {
+    const inputManager = runtimeGame.getInputManager();
+    inputManager.touchSimulateMouse(false);
+    inputManager.onMouseMove(300, 500);
+    inputManager.onTouchStart(0, 700, 500);
+
+    const objectsLists = Hashtable.newFrom({ obj1: objects.slice() });
+    expect(
+      gdjs.evtTools.input.cursorOnObject(objectsLists, runtimeScene, true, false)
+    ).to.be(true);
+    expect(objectsLists.get('obj1')).to.eql([objects[3], objects[7]]);
+
+    // Positions are not kept from the previous call.
+    inputManager.onTouchEnd(0);
+    inputManager.onFrameEnded();
+    inputManager.onMouseMove(100, 500);
+    const otherObjectsLists = Hashtable.newFrom({ obj1: objects.slice() });
+    expect(
+      gdjs.evtTools.input.cursorOnObject(
+        otherObjectsLists,
+        runtimeScene,
+        true,
+        false
+      )
+    ).to.be(true);
+    expect(otherObjectsLists.get('obj1')).to.eql([objects[1]]);
+  });
+});
@@ -0,0 +1,122 @@
+// @ts-check
+describe('gdjs.InstancesStreamer', () => {
+  const createInstance = (x, y) => ({
+    persistentUuid: '',
+    name: 'MyObject',
+    x,
+    y,
+    angle: 0,
+    layer: '',
+    zOrder: 0,
+    customSize: false,
+    width: 0,
+    height: 0,
+    locked: false,
+    numberProperties: [],
+    stringProperties: [],
+    initialVariables: [],
+  });
+
+  const createScene = () => {
+    const runtimeGame = gdjs.getPixiRuntimeGame();
+    const runtimeScene = new gdjs.RuntimeScene(runtimeGame);
+    runtimeScene.loadFromScene({
+      sceneData: {
+        layers: [
+          {
+            name: '',
+            visibility: true,
+            cameras: [],
+            effects: [],
+            ambientLightColorR: 127,
+            ambientLightColorB: 127,
+            ambientLightColorG: 127,
+            isLightingLayer: false,
+            followBaseLayerCamera: false,
+          },
+        ],
+        variables: [],
+        r: 0,
+        v: 0,
+        b: 0,
+        mangledName: 'Scene1',
+        name: 'Scene1',
+        stopSoundsOnStartup: false,
+        title: '',
+        behaviorsSharedData: [],
+        objects: [
+          {
+            type: 'Sprite',
+            name: 'MyObject',
+            behaviors: [],
+            effects: [],
+            // @ts-ignore
+            animations: [],
+            updateIfNotVisible: false,
+            variables: [],
+          },
+        ],
+        // Instances not in a chunk are always created.
+        instances: [createInstance(-10000, -10000)],
+        usedResources: [],
+        instancesChunkSize: 100,
+        instancesChunks: [
+          {
+            x: 0,
+            y: 0,
+            instances: [createInstance(10, 10), createInstance(50, 50)],
+          },
+          { x: 100, y: 0, instances: [createInstance(10010, 10)] },
+        ],
+      },
+      usedExtensionsWithVariablesData: [],
+    });
+    return runtimeScene;
+  };
+
+  it('creates the instances of the chunks near the cameras', () => {
+    const runtimeScene = createScene();
+    const streamer = runtimeScene.getInstancesStreamer();
+    if (!streamer) throw new Error('The scene should stream its instances.');
+
+    expect(streamer.getLoadedChunksCount()).to.be(1);
+    expect(runtimeScene.getObjects('MyObject').length).to.be(3);
+
+    // Move the camera to the other chunk.
+    runtimeScene.getLayer('').setCameraX(10000);
+    runtimeScene.renderAndStep(1000 / 60);
+    expect(streamer.getLoadedChunksCount()).to.be(1);
+    const objects = runtimeScene.getObjects('MyObject');
+    expect(objects.length).to.be(2);
+    expect(objects.map((object) => object.getX()).sort()).to.eql([
+      -10000,
+      10010,
+    ]);
+
+    // Come back to the first chunk.
+    runtimeScene.getLayer('').setCameraX(0);
+    runtimeScene.renderAndStep(1000 / 60);
+    expect(runtimeScene.getObjects('MyObject').length).to.be(3);
+  });
+
+  it('does not create again the objects deleted by the game', () => {
+    const runtimeScene = createScene();
+    const objects = runtimeScene.getObjects('MyObject');
+    const deletedObject = objects.find((object) => object.getX() === 10);
+    if (!deletedObject) throw new Error('The object should exist.');
+    deletedObject.deleteFromScene();
+    expect(runtimeScene.getObjects('MyObject').length).to.be(2);
+
+    // Release the chunk, then load it again.
+    runtimeScene.getLayer('').setCameraX(10000);
+    runtimeScene.renderAndStep(1000 / 60);
+    runtimeScene.getLayer('').setCameraX(0);
+    runtimeScene.renderAndStep(1000 / 60);
+
+    const xPositions = runtimeScene
+      .getObjects('MyObject')
+      .map((object) => object.getX())
+      .sort();
+    expect(xPositions).to.eql([-10000, 50]);
+  });
+});
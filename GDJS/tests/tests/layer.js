@@ -60,4 +60,33 @@ describe('gdjs.Layer', () => {
 		// The camera Z is still 0, it's not evaluated from the zoom factor.
 		expect(layer.getCameraZ(45)).to.be(0);
 	});
+	it('keeps the renderer objects sorted by z order', () => {
+		const layer = new gdjs.Layer({name: 'My layer', visibility: true, effects:[]}, runtimeScene)
+		const layerRenderer = layer.getRenderer();
+		const pixiContainer = layerRenderer.getRendererObject();
+		const a = new PIXI.Container();
+		const b = new PIXI.Container();
+		const c = new PIXI.Container();
+		const d = new PIXI.Container();
+		layerRenderer.addRendererObject(a, 2);
+		layerRenderer.addRendererObject(b, 0);
+		layerRenderer.addRendererObject(c, 2);
+		layerRenderer.addRendererObject(d, 1);
+		expect(pixiContainer.children).to.eql([b, d, a, c]);
+
+		layerRenderer.changeRendererObjectZOrder(b, 3);
+		expect(pixiContainer.children).to.eql([d, a, c, b]);
+		layerRenderer.changeRendererObjectZOrder(c, -1);
+		expect(pixiContainer.children).to.eql([c, d, a, b]);
+		// Objects having the same z order keep their order.
+		layerRenderer.changeRendererObjectZOrder(a, 1);
+		expect(pixiContainer.children).to.eql([c, d, a, b]);
+		layerRenderer.changeRendererObjectZOrder(c, 1);
+		expect(pixiContainer.children).to.eql([c, d, a, b]);
+		layerRenderer.changeRendererObjectZOrder(b, 1);
+		expect(pixiContainer.children).to.eql([c, d, a, b]);
+
+		layerRenderer.removeRendererObject(d);
+		expect(pixiContainer.children).to.eql([c, a, b]);
+	});
 });
@@ -246,3 +246,118 @@ describe('gdjs.evtTools.object', function () {
     );
   });
 });
+
+describe('gdjs.evtTools.object (collision and distance with a broad phase)', function () {
+  const makeObjects = (runtimeScene, name, count, size) => {
+    const objects = [];
+    for (let i = 0; i < count; i++) {
+      const object = new gdjs.TestRuntimeObject(runtimeScene, {
+        name,
+        type: '',
+        variables: [],
+        behaviors: [],
+        effects: [],
+      });
+      object.setCustomWidthAndHeight(size, size);
+      // Spread the objects, with some of them exactly touching each other.
+      object.setPosition((i * 37) % 400, ((i * 53) % 300) - size * (i % 3));
+      if (i % 7 === 0) object.setAngle(45);
+      objects.push(object);
+    }
+    return objects;
+  };
+
+  const getPickedIds = (objectsLists) => {
+    const ids = [];
+    for (const name in objectsLists.items) {
+      objectsLists.items[name].forEach((object) => ids.push(object.id));
+    }
+    return ids.sort((a, b) => a - b);
+  };
+
+  /**
+   * Check that a test using the broad phase picks the same objects as
+   * the test of all the pairs of objects.
+   */
+  const checkSameAsAllPairs = (test, allPairsTest, inverted) => {
+    const runtimeGame = gdjs.getPixiRuntimeGame();
+    const runtimeScene = new gdjs.TestRuntimeScene(runtimeGame);
+    const objectsA = makeObjects(runtimeScene, 'MyObjectA', 60, 20);
+    const objectsB = makeObjects(runtimeScene, 'MyObjectB', 40, 30);
+
+    const listsA = Hashtable.newFrom({ MyObjectA: objectsA.slice() });
+    const listsB = Hashtable.newFrom({ MyObjectB: objectsB.slice() });
+    const result = test(listsA, listsB, inverted);
+
+    const expectedListsA = Hashtable.newFrom({ MyObjectA: objectsA.slice() });
+    const expectedListsB = Hashtable.newFrom({ MyObjectB: objectsB.slice() });
+    const expectedResult = allPairsTest(
+      expectedListsA,
+      expectedListsB,
+      inverted
+    );
+
+    expect(result).to.be(expectedResult);
+    expect(getPickedIds(listsA)).to.eql(getPickedIds(expectedListsA));
+    expect(getPickedIds(listsB)).to.eql(getPickedIds(expectedListsB));
+    return getPickedIds(listsA).length;
+  };
+
+  [false, true].forEach((inverted) => {
+    it(
+      'picks the same objects in collision as when testing all the pairs' +
+        (inverted ? ' (inverted)' : ''),
+      function () {
+        [false, true].forEach((ignoreTouchingEdges) => {
+          const pickedCount = checkSameAsAllPairs(
+            (lists1, lists2, inverted) =>
+              gdjs.evtTools.object.hitBoxesCollisionTest(
+                lists1,
+                lists2,
+                inverted,
+                null,
+                ignoreTouchingEdges
+              ),
+            (lists1, lists2, inverted) =>
+              gdjs.evtTools.object.twoListsTest(
+                gdjs.RuntimeObject.collisionTest,
+                lists1,
+                lists2,
+                inverted,
+                ignoreTouchingEdges
+              ),
+            inverted
+          );
+          expect(pickedCount).to.be.greaterThan(0);
+        });
+      }
+    );
+
+    it(
+      'picks the same objects at a distance as when testing all the pairs' +
+        (inverted ? ' (inverted)' : ''),
+      function () {
+        [0, 25, 60, 1000].forEach((distance) => {
+          checkSameAsAllPairs(
+            (lists1, lists2, inverted) =>
+              gdjs.evtTools.object.distanceTest(
+                lists1,
+                lists2,
+                distance,
+                inverted
+              ),
+            (lists1, lists2, inverted) =>
+              gdjs.evtTools.object.twoListsTest(
+                gdjs.evtTools.object._distanceBetweenObjects,
+                lists1,
+                lists2,
+                inverted,
+                distance * distance
+              ),
+            inverted
+          );
+        });
+      }
+    );
+  });
+});
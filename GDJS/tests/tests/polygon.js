@@ -45,4 +45,21 @@ describe('gdjs.Polygon', function() {
 		expect(result.collision).to.eql(true);
 		expect(result.move_axis).to.eql([-2, 0]);
 	});
+	it('can check for collisions between polygons with different vertices count', function(){
+		var rect = gdjs.Polygon.createRectangle(10, 10);
+		rect.rotate(Math.PI / 4);
+		var triangle = new gdjs.Polygon();
+		triangle.vertices.push([6, -10], [16, 0], [6, 10]);
+
+		let result = null;
+		result = gdjs.Polygon.collisionTest(rect, triangle, /*ignoreTouchingEdges=*/true);
+		expect(result.collision).to.eql(true);
+		expect(result.move_axis[0]).to.be.within(-1.08, -1.06);
+		expect(result.move_axis[1]).to.be.within(-0.0001, 0.0001);
+
+		triangle.move(2, 0);
+		result = gdjs.Polygon.collisionTest(rect, triangle, /*ignoreTouchingEdges=*/true);
+		expect(result.collision).to.eql(false);
+		expect(result.move_axis).to.eql([0, 0]);
+	});
 });
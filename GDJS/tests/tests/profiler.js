@@ -0,0 +1,71 @@
+// @ts-check
+describe('gdjs.Profiler', () => {
+  const defaultMaxTraceEventsCount = gdjs.Profiler.maxTraceEventsCount;
+  afterEach(() => {
+    gdjs.Profiler.maxTraceEventsCount = defaultMaxTraceEventsCount;
+  });
+
+  it('should export the sections measured as a Chrome trace', () => {
+    const profiler = new gdjs.Profiler();
+    let time = 10;
+    profiler._getTimeNow = () => time;
+
+    profiler.beginFrame();
+    profiler.begin('objects (pre-events)');
+    profiler.begin('PlatformBehavior::PlatformerObjectBehavior');
+    time += 2;
+    profiler.end('PlatformBehavior::PlatformerObjectBehavior');
+    time += 1;
+    profiler.end('objects (pre-events)');
+    profiler.endFrame();
+
+    expect(
+      profiler.getFramesAverageMeasures().subsections['objects (pre-events)']
+        .time
+    ).to.be(3);
+    expect(profiler.getChromeTrace().traceEvents).to.eql([
+      { name: 'frame', ph: 'X', ts: 10000, dur: 3000, pid: 1, tid: 1 },
+      {
+        name: 'objects (pre-events)',
+        ph: 'X',
+        ts: 10000,
+        dur: 3000,
+        pid: 1,
+        tid: 1,
+      },
+      {
+        name: 'PlatformBehavior::PlatformerObjectBehavior',
+        ph: 'X',
+        ts: 10000,
+        dur: 2000,
+        pid: 1,
+        tid: 1,
+      },
+    ]);
+  });
+
+  it('should only keep the last sections in the trace', () => {
+    gdjs.Profiler.maxTraceEventsCount = 4;
+    const profiler = new gdjs.Profiler();
+    let time = 0;
+    profiler._getTimeNow = () => time;
+
+    for (let i = 0; i < 3; i++) {
+      profiler.beginFrame();
+      profiler.begin('events');
+      time += 1;
+      profiler.end('events');
+      profiler.endFrame();
+    }
+
+    const traceEvents = profiler.getChromeTrace().traceEvents;
+    expect(traceEvents.map((event) => event.name)).to.eql([
+      'frame',
+      'events',
+      'frame',
+      'events',
+    ]);
+    expect(traceEvents[0].ts).to.be(1000);
+    expect(traceEvents[3].ts).to.be(2000);
+  });
+});
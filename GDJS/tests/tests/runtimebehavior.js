@@ -0,0 +1,68 @@
+// @ts-check
+
+describe('gdjs.NetworkSyncPropertiesTracker', () => {
+  it('gives all the properties when not syncing only the changes', () => {
+    const tracker = new gdjs.NetworkSyncPropertiesTracker();
+    for (let i = 0; i < 5; i++) {
+      const props = {};
+      tracker.addProperty(props, 'speed', 150, {});
+      tracker.addProperty(props, 'name', 'Hero', {});
+      expect(props).to.eql({ speed: 150, name: 'Hero' });
+    }
+  });
+
+  it('gives only the properties that changed recently', () => {
+    const tracker = new gdjs.NetworkSyncPropertiesTracker();
+    const syncOptions = { syncOnlyChangedProperties: true };
+    const sync = (speed, name) => {
+      const props = {};
+      tracker.addProperty(props, 'speed', speed, syncOptions);
+      tracker.addProperty(props, 'name', name, syncOptions);
+      return props;
+    };
+
+    // Changed properties are sent a few times, in case messages are lost.
+    const forcedSyncsCount = gdjs.NetworkSyncPropertiesTracker.forcedSyncsCount;
+    for (let i = 0; i < forcedSyncsCount; i++) {
+      expect(sync(150, 'Hero')).to.eql({ speed: 150, name: 'Hero' });
+    }
+    expect(sync(150, 'Hero')).to.eql({});
+
+    for (let i = 0; i < forcedSyncsCount; i++) {
+      expect(sync(200, 'Hero')).to.eql({ speed: 200 });
+    }
+    expect(sync(200, 'Hero')).to.eql({});
+
+    // All the properties are still given for a full synchronization.
+    const props = {};
+    tracker.addProperty(props, 'speed', 200, {});
+    tracker.addProperty(props, 'name', 'Hero', {});
+    expect(props).to.eql({ speed: 200, name: 'Hero' });
+
+    tracker.clear();
+    expect(sync(200, 'Hero')).to.eql({ speed: 200, name: 'Hero' });
+  });
+
+  it('rounds the numbers to the precision', () => {
+    const tracker = new gdjs.NetworkSyncPropertiesTracker();
+    const syncOptions = {
+      syncOnlyChangedProperties: true,
+      numbersPrecision: 0.5,
+    };
+    const sync = (speed) => {
+      const props = {};
+      tracker.addProperty(props, 'speed', speed, syncOptions);
+      tracker.addProperty(props, 'name', 'Hero', syncOptions);
+      return props;
+    };
+
+    expect(sync(150.2)).to.eql({ speed: 150, name: 'Hero' });
+    // Changes smaller than the precision are not sent again.
+    const forcedSyncsCount = gdjs.NetworkSyncPropertiesTracker.forcedSyncsCount;
+    for (let i = 1; i < forcedSyncsCount; i++) {
+      sync(150.1);
+    }
+    expect(sync(150.1)).to.eql({});
+    expect(sync(150.4)).to.eql({ speed: 150.5 });
+  });
+});
@@ -562,6 +562,32 @@ describe('gdjs.RuntimeObject', () => {
     expect(object.getY()).to.be(20 + 40 / 4 + 0.000000000000018);
   });
 
+  it('can sum instant forces with a legacy force', () => {
+    const object = new gdjs.TestRuntimeObject(runtimeScene, {
+      name: 'obj1',
+      type: '',
+      variables: [],
+      behaviors: [],
+      effects: [],
+    });
+    runtimeScene.addObject(object);
+
+    object.addForce(60, 0, 0.5);
+    object.addForce(75, 10, 0);
+    object.addForce(25, 30, 0);
+    expect(object.getAverageForce().getX()).to.be(160);
+    expect(object.getAverageForce().getY()).to.be(40);
+
+    // Instant forces are removed after a step, the legacy one is reduced.
+    runtimeScene.renderAndStep(1000 / 60);
+    expect(object.hasNoForces()).to.be(false);
+    expect(object.getAverageForce().getX()).to.be.within(0.1, 60);
+    expect(object.getAverageForce().getY()).to.be(0);
+
+    object.clearForces();
+    expect(object.hasNoForces()).to.be(true);
+  });
+
   it('can clear forces', () => {
     const object = new gdjs.TestRuntimeObject(runtimeScene, {
       name: 'obj1',
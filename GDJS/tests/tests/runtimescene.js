@@ -76,6 +76,94 @@ describe('gdjs.RuntimeScene integration tests', function () {
         'onDestroy'
       );
     });
+
+    it('can step the behaviors grouped by type', function () {
+      const runtimeGame = gdjs.getPixiRuntimeGame();
+      const runtimeScene = new gdjs.RuntimeScene(runtimeGame);
+      runtimeScene.loadFromScene({sceneData: {
+        layers: [
+          {
+            name: '',
+            visibility: true,
+            cameras: [],
+            effects: [],
+            ambientLightColorR: 127,
+            ambientLightColorB: 127,
+            ambientLightColorG: 127,
+            isLightingLayer: false,
+            followBaseLayerCamera: false,
+          },
+        ],
+        variables: [],
+        r: 0,
+        v: 0,
+        b: 0,
+        mangledName: 'Scene1',
+        name: 'Scene1',
+        stopSoundsOnStartup: false,
+        title: '',
+        behaviorsSharedData: [],
+        objects: [
+          {
+            type: 'TestObject::TestObject',
+            name: 'Object1',
+            behaviors: [
+              {
+                type: 'TestBehavior::TestBehavior',
+                name: 'SomeBehavior',
+              },
+            ],
+            variables: [],
+            effects: [],
+          },
+        ],
+        instances: [],
+        usedResources: [],
+      }, usedExtensionsWithVariablesData: []});
+      runtimeScene.setBehaviorsSteppedByType(true);
+      expect(runtimeScene.areBehaviorsSteppedByType()).to.be(true);
+
+      const object1 = runtimeScene.createObject('Object1');
+      const object2 = runtimeScene.createObject('Object1');
+      if (!object1 || !object2) {
+        throw new Error('objects should have been created');
+      }
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(object1.getVariables().get('lastState').getAsString()).to.eql(
+        'doStepPostEvents'
+      );
+      expect(object2.getVariables().get('lastState').getAsString()).to.eql(
+        'doStepPostEvents'
+      );
+
+      // Deactivated behaviors are not stepped.
+      const behavior2 = object2.getBehavior('SomeBehavior');
+      if (!behavior2) {
+        throw new Error('behavior should have been created');
+      }
+      behavior2.activate(false);
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(object2.getVariables().get('lastState').getAsString()).to.eql(
+        'deactivated'
+      );
+
+      // Objects created later are stepped too.
+      const object3 = runtimeScene.createObject('Object1');
+      if (!object3) {
+        throw new Error('object should have been created');
+      }
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(object3.getVariables().get('lastState').getAsString()).to.eql(
+        'doStepPostEvents'
+      );
+
+      // Deleted objects are not stepped anymore.
+      runtimeScene.markObjectForDeletion(object1);
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(object1.getVariables().get('lastState').getAsString()).to.eql(
+        'onDestroy'
+      );
+    });
   });
 
   describe('Layers (using a Sprite object)', function () {
@@ -172,4 +260,109 @@ describe('gdjs.RuntimeScene integration tests', function () {
       expect(runtimeScene.hasLayer('MyOtherLayer')).to.be(true);
     });
   });
+
+  describe('Culling (using a Sprite object)', function () {
+    const makeSceneWithSprites = () => {
+      const runtimeGame = gdjs.getPixiRuntimeGame();
+      const runtimeScene = new gdjs.RuntimeScene(runtimeGame);
+      runtimeScene.loadFromScene({sceneData: {
+        layers: [
+          {
+            name: '',
+            visibility: true,
+            cameras: [],
+            effects: [],
+            ambientLightColorR: 127,
+            ambientLightColorB: 127,
+            ambientLightColorG: 127,
+            isLightingLayer: false,
+            followBaseLayerCamera: false,
+          },
+        ],
+        variables: [],
+        r: 0,
+        v: 0,
+        b: 0,
+        mangledName: 'Scene1',
+        name: 'Scene1',
+        stopSoundsOnStartup: false,
+        title: '',
+        behaviorsSharedData: [],
+        objects: [
+          {
+            type: 'Sprite',
+            name: 'MyObject',
+            behaviors: [],
+            effects: [],
+            // @ts-ignore
+            animations: [],
+            updateIfNotVisible: false,
+          },
+        ],
+        instances: [],
+      }, usedExtensionsWithVariablesData: []});
+      return runtimeScene;
+    };
+
+    it('hides the objects far from the camera, including after they moved', () => {
+      const runtimeScene = makeSceneWithSprites();
+      const layer = runtimeScene.getLayer('');
+      const nearObject = runtimeScene.createObject('MyObject');
+      const farObject = runtimeScene.createObject('MyObject');
+      if (!nearObject || !farObject) {
+        throw new Error('object should have been created');
+      }
+      nearObject.setPosition(layer.getCameraX(), layer.getCameraY());
+      farObject.setPosition(100000, 100000);
+
+      runtimeScene.renderAndStep(1000 / 60);
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(nearObject.getRendererObject().visible).to.be(true);
+      expect(farObject.getRendererObject().visible).to.be(false);
+
+      // Objects moving near the camera are shown.
+      farObject.setPosition(layer.getCameraX(), layer.getCameraY());
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(farObject.getRendererObject().visible).to.be(true);
+
+      // Objects are hidden when the camera moves away.
+      layer.setCameraX(200000);
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(nearObject.getRendererObject().visible).to.be(false);
+      expect(farObject.getRendererObject().visible).to.be(false);
+
+      // Objects moving at each frame are still shown and hidden.
+      for (let i = 0; i < 5; i++) {
+        nearObject.setPosition(200000 + i, layer.getCameraY());
+        runtimeScene.renderAndStep(1000 / 60);
+        expect(nearObject.getRendererObject().visible).to.be(true);
+        expect(farObject.getRendererObject().visible).to.be(false);
+      }
+      nearObject.setPosition(0, 0);
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(nearObject.getRendererObject().visible).to.be(false);
+
+      // ...and once they stop moving.
+      for (
+        let i = 0;
+        i < gdjs.ObjectsVisibilityIndex.staticFramesCount + 1;
+        i++
+      ) {
+        runtimeScene.renderAndStep(1000 / 60);
+      }
+      expect(nearObject.getRendererObject().visible).to.be(false);
+      layer.setCameraX(0);
+      layer.setCameraY(0);
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(nearObject.getRendererObject().visible).to.be(true);
+
+      // Hidden objects are not shown, and deleted objects are forgotten.
+      nearObject.hide();
+      runtimeScene.renderAndStep(1000 / 60);
+      expect(nearObject.getRendererObject().visible).to.be(false);
+      nearObject.deleteFromScene();
+      farObject.deleteFromScene();
+      runtimeScene.renderAndStep(1000 / 60);
+    });
+  });
 });
@@ -534,4 +534,91 @@ describe('gdjs.SceneStack', () => {
     gdjs._unregisterCallback(onRuntimeSceneLoaded);
     gdjs._unregisterCallback(onRuntimeScenePaused);
   });
+
+  it('can prepare a scene in background before starting it', async () => {
+    const preparedSceneData = createSceneData('Prepared scene', []);
+    preparedSceneData.objects = [
+      {
+        type: 'Sprite',
+        name: 'MyObject',
+        behaviors: [],
+        effects: [],
+        // @ts-ignore
+        animations: [],
+        updateIfNotVisible: false,
+        variables: [],
+      },
+    ];
+    preparedSceneData.instances = [];
+    for (let i = 0; i < 100; i++) {
+      preparedSceneData.instances.push({
+        name: 'MyObject',
+        x: i,
+        y: 0,
+        angle: 0,
+        layer: '',
+        zOrder: 0,
+        customSize: false,
+        width: 0,
+        height: 0,
+        locked: false,
+        numberProperties: [],
+        stringProperties: [],
+        initialVariables: [],
+      });
+    }
+    const runtimeGame = gdjs.getPixiRuntimeGame({
+      layouts: [createSceneData('Scene 1', []), preparedSceneData],
+    });
+    const sceneStack = runtimeGame.getSceneStack();
+    await runtimeGame.getResourceLoader().loadAllResources(() => {});
+
+    /** @type gdjs.RuntimeScene | null  */
+    let lastLoadedScene = null;
+    const onRuntimeSceneLoaded = (runtimeScene) => {
+      lastLoadedScene = runtimeScene;
+    };
+    gdjs.registerRuntimeSceneLoadedCallback(onRuntimeSceneLoaded);
+
+    const defaultMaxDuration = gdjs.SceneStack.preInstantiationMaxDuration;
+    // Only one chunk of instances is created at each frame.
+    gdjs.SceneStack.preInstantiationMaxDuration = 0;
+    try {
+      sceneStack.push('Scene 1');
+      sceneStack.preInstantiateScene('Prepared scene');
+      await delay(10);
+      expect(sceneStack.isScenePreInstantiated('Prepared scene')).to.be(false);
+
+      // The instances are created a few at each frame.
+      sceneStack.step(1000 / 60);
+      const preparedScene = sceneStack._preInstantiatedScenes.get(
+        'Prepared scene'
+      );
+      if (!preparedScene) throw new Error('The scene should be prepared.');
+      expect(preparedScene.isBeingLoaded()).to.be(true);
+      expect(preparedScene.getObjects('MyObject').length).to.be(
+        gdjs.RuntimeScene._initialInstancesChunkSize
+      );
+      expect(sceneStack.isScenePreInstantiated('Prepared scene')).to.be(false);
+
+      sceneStack.step(1000 / 60);
+      sceneStack.step(1000 / 60);
+      sceneStack.step(1000 / 60);
+      expect(sceneStack.isScenePreInstantiated('Prepared scene')).to.be(true);
+      expect(preparedScene.getObjects('MyObject').length).to.be(100);
+      // The scene is not played before being started.
+      //@ts-ignore
+      expect(lastLoadedScene.getName()).to.be('Scene 1');
+
+      // The prepared scene is started instantly.
+      expect(sceneStack.push('Prepared scene')).to.be(preparedScene);
+      expect(lastLoadedScene).to.be(preparedScene);
+      expect(preparedScene.isBeingLoaded()).to.be(false);
+      expect(preparedScene.getObjects('MyObject').length).to.be(100);
+      expect(sceneStack.isScenePreInstantiated('Prepared scene')).to.be(false);
+    } finally {
+      gdjs.SceneStack.preInstantiationMaxDuration = defaultMaxDuration;
+      gdjs._unregisterCallback(onRuntimeSceneLoaded);
+    }
+  });
 });
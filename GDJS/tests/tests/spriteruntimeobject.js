@@ -381,6 +381,44 @@ describe('gdjs.SpriteRuntimeObject', () => {
     });
   });
 
+  describe('Hitboxes', () => {
+    it('are not updated when the new frame has the same hitboxes', () => {
+      const runtimeGame = gdjs.getPixiRuntimeGame();
+      const runtimeScene = new gdjs.TestRuntimeScene(runtimeGame);
+      const stepDurationInMilliseconds = 1000 / 60;
+      runtimeScene._timeManager.getElapsedTime = function () {
+        return stepDurationInMilliseconds;
+      };
+
+      const object = createObjectWithAnimationInScene(runtimeScene);
+      runtimeScene.addObject(object);
+      let hitBoxesUpdatesCount = 0;
+      const updateHitBoxes = object.updateHitBoxes.bind(object);
+      object.updateHitBoxes = () => {
+        hitBoxesUpdatesCount++;
+        updateHitBoxes();
+      };
+
+      runtimeScene.renderAndStep(stepDurationInMilliseconds);
+      object.getAABB();
+      hitBoxesUpdatesCount = 0;
+
+      const minimumStepCountBeforeNextFrame = Math.ceil(
+        firstAnimationTimeBetweenFrames / (stepDurationInMilliseconds / 1000)
+      );
+      for (let i = 0; i < minimumStepCountBeforeNextFrame; i++) {
+        runtimeScene.renderAndStep(stepDurationInMilliseconds);
+      }
+      expect(object.getAnimationFrame()).to.be(1);
+      object.getAABB();
+      expect(hitBoxesUpdatesCount).to.be(0);
+
+      object.setX(10);
+      expect(object.getAABB().min[0]).to.be(10);
+      expect(hitBoxesUpdatesCount).to.be(1);
+    });
+  });
+
   describe('Animation change', () => {
     it('should reset the elapsed time on a frame when changing animation', () => {
       const runtimeGame = gdjs.getPixiRuntimeGame();
@@ -434,4 +472,71 @@ describe('gdjs.SpriteRuntimeObject', () => {
       expect(object.getAnimationElapsedTime()).to.not.be(0);
     });
   });
+
+  describe('Recycling', () => {
+    const makeSceneWithObject = (instancesPoolSize) => {
+      const runtimeGame = gdjs.getPixiRuntimeGame();
+      const runtimeScene = new gdjs.TestRuntimeScene(runtimeGame);
+      runtimeScene.registerObject({
+        name: 'MyObject',
+        type: 'Sprite',
+        updateIfNotVisible: false,
+        variables: [],
+        behaviors: [
+          { type: 'TestBehavior::TestBehavior', name: 'SomeBehavior' },
+        ],
+        effects: [],
+        animations: [],
+        instancesPoolSize,
+      });
+      return runtimeScene;
+    };
+
+    it('reuses the deleted instances and their behaviors', () => {
+      const runtimeScene = makeSceneWithObject(undefined);
+      const object = runtimeScene.createObject('MyObject');
+      if (!object) throw new Error('object should have been created');
+      const behavior = object.getBehavior('SomeBehavior');
+      object.setPosition(100, 200);
+      object.getVariables().get('MyVariable').setNumber(42);
+
+      object.deleteFromScene();
+      runtimeScene._cacheOrClearRemovedInstances();
+      expect(object.getVariables().get('lastState').getAsString()).to.be(
+        'onDestroy'
+      );
+
+      const recycledObject = runtimeScene.createObject('MyObject');
+      if (!recycledObject) throw new Error('object should have been created');
+      expect(recycledObject).to.be(object);
+      expect(recycledObject.getX()).to.be(0);
+      expect(recycledObject.getY()).to.be(0);
+      expect(recycledObject.getVariables().has('MyVariable')).to.be(false);
+      expect(recycledObject.getBehavior('SomeBehavior')).to.be(behavior);
+      expect(behavior.activated()).to.be(true);
+      expect(
+        recycledObject.getVariables().get('lastState').getAsString()
+      ).to.be('created');
+    });
+
+    it('keeps at most the size of the pool of deleted instances', () => {
+      const runtimeScene = makeSceneWithObject(2);
+      const objects = [];
+      for (let i = 0; i < 3; i++) {
+        objects.push(runtimeScene.createObject('MyObject'));
+      }
+      objects.forEach((object) => object.deleteFromScene());
+      runtimeScene._cacheOrClearRemovedInstances();
+      expect(runtimeScene._instancesCache.get('MyObject').length).to.be(2);
+
+      const defaultPoolRuntimeScene = makeSceneWithObject(undefined);
+      for (let i = 0; i < 3; i++) {
+        defaultPoolRuntimeScene.createObject('MyObject').deleteFromScene();
+      }
+      defaultPoolRuntimeScene._cacheOrClearRemovedInstances();
+      expect(
+        defaultPoolRuntimeScene._instancesCache.get('MyObject').length
+      ).to.be(3);
+    });
+  });
 });
@@ -149,4 +149,31 @@ describe('gdjs.evtTools.storage', function () {
     checkFixturesInFile('Test1');
     testClearingFile('Test2');
   });
+
+  it('can delay and group the writes', function () {
+    window.localStorage.removeItem('GDJS_Test3');
+    gdjs.evtTools.storage.setWriteBehindEnabled(true);
+    expect(gdjs.evtTools.storage.isWriteBehindEnabled()).to.be(true);
+    try {
+      writeFixturesInFile('Test3');
+      // Nothing is written yet, but the values can be read.
+      expect(window.localStorage.getItem('GDJS_Test3')).to.be(null);
+      checkFixturesInFile('Test3');
+
+      // Loading and unloading the object keeps the changes.
+      gdjs.evtTools.storage.loadJSONFileFromStorage('Test3');
+      checkFixturesInFile('Test3');
+      gdjs.evtTools.storage.unloadJSONFile('Test3');
+      expect(window.localStorage.getItem('GDJS_Test3')).to.be(null);
+
+      gdjs.evtTools.storage.flushPendingWrites();
+      expect(window.localStorage.getItem('GDJS_Test3')).not.to.be(null);
+      checkFixturesInFile('Test3');
+    } finally {
+      gdjs.evtTools.storage.setWriteBehindEnabled(false);
+    }
+    expect(gdjs.evtTools.storage.isWriteBehindEnabled()).to.be(false);
+    checkFixturesInFile('Test3');
+    testClearingFile('Test3');
+  });
 });
@@ -15,4 +15,24 @@ describe('gdjs.TimeManager', () => {
     expect(timeManager.getTimer('timer1').getTime()).to.be(31);
     expect(timeManager.getTimer('timer2').getTime()).to.be(15);
   });
+
+  it('should access timers by their slot', () => {
+    const timeManager = new gdjs.TimeManager();
+    const slot = gdjs.Timer.getSlot('slotTimer');
+    expect(gdjs.Timer.getSlot('slotTimer')).to.be(slot);
+    expect(gdjs.Timer.getNameOfSlot(slot)).to.be('slotTimer');
+
+    timeManager.addTimer(slot);
+    timeManager.update(16, 1);
+    expect(timeManager.hasTimer('slotTimer')).to.be(true);
+    const timer = timeManager.getTimer('slotTimer');
+    if (!timer) throw new Error('The timer should exist.');
+    expect(timer.getName()).to.be('slotTimer');
+    expect(timer.getTime()).to.be(16);
+
+    timeManager.removeTimer(slot);
+    timeManager.update(16, 1);
+    expect(timeManager.hasTimer('slotTimer')).to.be(false);
+    expect(timeManager.getTimer(slot)).to.be(null);
+  });
 });
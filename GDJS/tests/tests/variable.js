@@ -216,6 +216,60 @@ describe('gdjs.Variable', function () {
     expect(structure.getChild('f').getType()).to.be('boolean');
     expect(structure.getChild('f').getAsBoolean()).to.be(true);
   });
+  it('keeps the primitive children usable and independent', function () {
+    const structure = new gdjs.Variable().fromJSObject({
+      a: 1,
+      b: 'Hello',
+      c: true,
+      d: [2, 'World', false],
+    });
+
+    // Children are variables when accessed, and changes are kept.
+    const a = structure.getChild('a');
+    expect(a.getType()).to.be('number');
+    expect(a.getAsNumber()).to.be(1);
+    a.add(41);
+    expect(structure.getChild('a')).to.be(a);
+    expect(structure.getChild('b').getAsString()).to.be('Hello');
+    expect(structure.getChild('c').getAsBoolean()).to.be(true);
+    const array = structure.getChild('d');
+    expect(array.getChildAt(1).getType()).to.be('string');
+    array.getChildAt(2).setBoolean(true);
+
+    const clone = structure.clone();
+    clone.getChild('d').getChildAt(0).setNumber(3);
+    clone.getChild('b').setString('Bye');
+
+    expect(structure.toJSObject()).to.eql({
+      a: 42,
+      b: 'Hello',
+      c: true,
+      d: [2, 'World', true],
+    });
+    expect(clone.toJSObject()).to.eql({
+      a: 42,
+      b: 'Bye',
+      c: true,
+      d: [3, 'World', true],
+    });
+
+    const allChildren = structure.getAllChildren();
+    expect(allChildren.b).to.be(structure.getChild('b'));
+    expect(allChildren.c.getType()).to.be('boolean');
+    const allChildrenArray = array.getAllChildrenArray();
+    expect(allChildrenArray[0].getAsNumber()).to.be(2);
+
+    const fromData = new gdjs.Variable({
+      type: 'array',
+      children: [
+        { type: 'number', value: 4 },
+        { type: 'string', value: '' },
+      ],
+    });
+    expect(fromData.getChildAt(0).getAsNumber()).to.be(4);
+    expect(fromData.getChildAt(1).getAsString()).to.be('0');
+  });
+
   it('exposes a badVariable that is neutral for all operations', function () {
     expect(gdjs.VariablesContainer.badVariable.getValue()).to.be(0);
 
@@ -4,9 +4,18 @@
 #include <GDCore/Project/Project.h>
 #include <GDCore/Serialization/Serializer.h>
 #include <GDCore/Serialization/SerializerElement.h>
+#include <GDCore/Tools/Localization.h>
 #include <emscripten.h>
 #include <map>
 
+namespace {
+
+// Most behaviors have a few different contents: this only protects from an
+// unbounded growth of the cache.
+const std::size_t maxCachedContentsCount = 1024;
+
+}  // namespace
+
 using namespace gd;
 
 BehaviorJsImplementation* BehaviorJsImplementation::Clone() const {
@@ -32,6 +41,19 @@ BehaviorJsImplementation* BehaviorJsImplementation::Clone() const {
 }
 std::map<gd::String, gd::PropertyDescriptor>
 BehaviorJsImplementation::GetProperties(const gd::SerializerElement& behaviorContent) const {
+  // Calling the JavaScript implementation (and creating the properties with
+  // the bindings) is much slower than serializing the content to find
+  // properties already returned for the same content.
+  std::size_t translationsGeneration = gd::TranslationsCache::GetGeneration();
+  if (propertiesCache->translationsGeneration != translationsGeneration) {
+    propertiesCache->propertiesByContent.clear();
+    propertiesCache->translationsGeneration = translationsGeneration;
+  }
+  std::string content = gd::Serializer::ToJSON(behaviorContent).Raw();
+  auto cachedProperties = propertiesCache->propertiesByContent.find(content);
+  if (cachedProperties != propertiesCache->propertiesByContent.end())
+    return cachedProperties->second;
+
   std::map<gd::String, gd::PropertyDescriptor>* jsCreatedProperties = nullptr;
   std::map<gd::String, gd::PropertyDescriptor> copiedProperties;
 
@@ -52,6 +74,10 @@ BehaviorJsImplementation::GetProperties(const gd::SerializerElement& behaviorCon
 
   copiedProperties = *jsCreatedProperties;
   delete jsCreatedProperties;
+
+  if (propertiesCache->propertiesByContent.size() >= maxCachedContentsCount)
+    propertiesCache->propertiesByContent.clear();
+  propertiesCache->propertiesByContent[content] = copiedProperties;
   return copiedProperties;
 }
 bool BehaviorJsImplementation::UpdateProperty(gd::SerializerElement& behaviorContent,
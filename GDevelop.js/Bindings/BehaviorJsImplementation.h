@@ -5,6 +5,11 @@
 #include <GDCore/Serialization/SerializerElement.h>
 #include <emscripten.h>
 
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 using namespace gd;
 
 /**
@@ -14,7 +19,8 @@ using namespace gd;
  */
 class BehaviorJsImplementation : public gd::Behavior {
  public:
-  BehaviorJsImplementation(){};
+  BehaviorJsImplementation()
+      : propertiesCache(std::make_shared<PropertiesCache>()){};
   virtual BehaviorJsImplementation* Clone() const override;
 
   virtual std::map<gd::String, gd::PropertyDescriptor> GetProperties(
@@ -28,4 +34,24 @@ class BehaviorJsImplementation : public gd::Behavior {
   void __destroy__();
 
  private:
+  /**
+   * \brief The properties returned by the JavaScript implementation for each
+   * behavior content. Properties only depend on the content, so a content
+   * changed by UpdateProperty or InitializeContent (or anything else) is just
+   * another entry.
+   */
+  struct PropertiesCache {
+    PropertiesCache() : translationsGeneration(0){};
+
+    std::size_t translationsGeneration;  ///< Properties have translated
+                                         ///< labels, so they are forgotten
+                                         ///< when translations change.
+    std::unordered_map<std::string,
+                       std::map<gd::String, gd::PropertyDescriptor>>
+        propertiesByContent;
+  };
+
+  std::shared_ptr<PropertiesCache>
+      propertiesCache;  ///< Shared by the clones, i.e: by all the behaviors of
+                        ///< this type.
 };
@@ -0,0 +1,228 @@
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <GDCore/Project/InitialInstance.h>
+#include <GDCore/Project/InitialInstancesContainer.h>
+#include <GDCore/Project/InitialInstancesDelta.h>
+#include <GDCore/String.h>
+
+/**
+ * \brief Buffers holding the position, size, angle, Z order, layer and flags
+ * of all the instances of a gd::InitialInstancesContainer, so that
+ * JavaScript can read (or change) them directly from the memory of the
+ * module instead of calling the getters of each instance.
+ *
+ * For the instance at index `i`:
+ * - the numbers (read as a Float64Array) are at `i * NumbersPerInstance`:
+ *   x, y, z, angle, custom width, custom height, custom depth.
+ * - the integers (read as an Int32Array) are at `i * IntegersPerInstance`:
+ *   Z order, index of the layer (see GetLayerName), flags (see Flag*).
+ *
+ * The indexed instances can also be moved, rotated, or changed of layer or
+ * of Z order at once (the buffers are then updated), and their changes
+ * recorded in a gd::InitialInstancesDelta to undo them.
+ *
+ * \warning The instances are remembered when the buffers are read: read them
+ * again after instances are added to or removed from the container.
+ */
+class InitialInstancesBuffer {
+ public:
+  static constexpr std::size_t NumbersPerInstance = 7;
+  static constexpr std::size_t IntegersPerInstance = 3;
+
+  enum Flag {
+    FlagLocked = 1,
+    FlagCustomSize = 2,
+    FlagCustomDepth = 4,
+  };
+
+  InitialInstancesBuffer() {}
+
+  /**
+   * \brief Fill the buffers with the instances of the container.
+   */
+  void ReadFrom(gd::InitialInstancesContainer& container_) {
+    container = &container_;
+    instances.clear();
+    layerNames.clear();
+    layerIndexes.clear();
+    instances.reserve(container->GetInstancesCount());
+    container->IterateOverInstances([&](gd::InitialInstance& instance) {
+      instances.push_back(&instance);
+      return false;
+    });
+
+    numbers.resize(instances.size() * NumbersPerInstance);
+    integers.resize(instances.size() * IntegersPerInstance);
+    for (std::size_t index = 0; index < instances.size(); ++index)
+      ReadInstance(index);
+  }
+
+  /**
+   * \brief Apply the numbers, the Z order and the flags of the buffers to the
+   * instances whose indexes were set with SetIndexesCount and
+   * GetIndexesPointer (for example, to move or resize the selected
+   * instances at once). Layers are not changed.
+   */
+  void ApplyToInstances() {
+    for (std::int32_t index : indexes) {
+      if (index < 0 || static_cast<std::size_t>(index) >= instances.size())
+        continue;
+
+      gd::InitialInstance& instance = *instances[index];
+      const double* instanceNumbers = &numbers[index * NumbersPerInstance];
+      instance.SetX(instanceNumbers[0]);
+      instance.SetY(instanceNumbers[1]);
+      instance.SetZ(instanceNumbers[2]);
+      instance.SetAngle(instanceNumbers[3]);
+      instance.SetCustomWidth(instanceNumbers[4]);
+      instance.SetCustomHeight(instanceNumbers[5]);
+      instance.SetCustomDepth(instanceNumbers[6]);
+
+      const std::int32_t* instanceIntegers =
+          &integers[index * IntegersPerInstance];
+      instance.SetZOrder(instanceIntegers[0]);
+      instance.SetLocked((instanceIntegers[2] & FlagLocked) != 0);
+      instance.SetHasCustomSize((instanceIntegers[2] & FlagCustomSize) != 0);
+      instance.SetHasCustomDepth((instanceIntegers[2] & FlagCustomDepth) != 0);
+    }
+  }
+
+  /**
+   * \brief Move the instances whose indexes were set with SetIndexesCount
+   * and GetIndexesPointer, and update the buffers.
+   */
+  void MoveInstances(double deltaX, double deltaY, double deltaZ) {
+    container->MoveInstances(GetIndexedInstances(), deltaX, deltaY, deltaZ);
+    ReadIndexedInstances();
+  }
+
+  /**
+   * \brief Rotate the indexed instances around the pivot (see
+   * gd::InitialInstancesContainer::RotateInstances), and update the buffers.
+   */
+  void RotateInstances(double angle, double pivotX, double pivotY) {
+    container->RotateInstances(GetIndexedInstances(), angle, pivotX, pivotY);
+    ReadIndexedInstances();
+  }
+
+  /**
+   * \brief Move the indexed instances to a layer, and update the buffers.
+   */
+  void SetInstancesLayer(const gd::String& layerName) {
+    container->SetInstancesLayer(GetIndexedInstances(), layerName);
+    ReadIndexedInstances();
+  }
+
+  /**
+   * \brief Add an offset to the Z order of the indexed instances, and update
+   * the buffers.
+   */
+  void ChangeInstancesZOrder(int offset) {
+    container->ChangeInstancesZOrder(GetIndexedInstances(), offset);
+    ReadIndexedInstances();
+  }
+
+  /**
+   * \brief Remember the state of the indexed instances in the delta, before
+   * changing them (see gd::InitialInstancesDelta::RecordBefore).
+   */
+  void RecordInstancesBefore(gd::InitialInstancesDelta& delta) {
+    delta.RecordBefore(GetIndexedInstances());
+  }
+
+  std::size_t GetInstancesCount() const { return instances.size(); }
+
+  /**
+   * \brief Return the instance at the given index of the buffers.
+   */
+  gd::InitialInstance& GetInstance(std::size_t index) {
+    return *instances[index];
+  }
+
+  std::size_t GetLayersCount() const { return layerNames.size(); }
+  const gd::String& GetLayerName(std::size_t index) const {
+    return layerNames[index];
+  }
+
+  /**
+   * \brief Resize the indexes of the instances to apply changes to, before
+   * filling them from JavaScript.
+   */
+  void SetIndexesCount(std::size_t count) { indexes.resize(count); }
+
+  /**
+   * \brief Return the address of the numbers in the memory of the module.
+   */
+  std::uintptr_t GetNumbersPointer() {
+    return reinterpret_cast<std::uintptr_t>(numbers.data());
+  }
+
+  /**
+   * \brief Return the address of the integers in the memory of the module.
+   */
+  std::uintptr_t GetIntegersPointer() {
+    return reinterpret_cast<std::uintptr_t>(integers.data());
+  }
+
+  /**
+   * \brief Return the address of the indexes in the memory of the module.
+   */
+  std::uintptr_t GetIndexesPointer() {
+    return reinterpret_cast<std::uintptr_t>(indexes.data());
+  }
+
+ private:
+  std::vector<gd::InitialInstance*> GetIndexedInstances() const {
+    std::vector<gd::InitialInstance*> indexedInstances;
+    indexedInstances.reserve(indexes.size());
+    for (std::int32_t index : indexes) {
+      if (index >= 0 && static_cast<std::size_t>(index) < instances.size())
+        indexedInstances.push_back(instances[index]);
+    }
+    return indexedInstances;
+  }
+
+  void ReadIndexedInstances() {
+    for (std::int32_t index : indexes) {
+      if (index >= 0 && static_cast<std::size_t>(index) < instances.size())
+        ReadInstance(index);
+    }
+  }
+
+  void ReadInstance(std::size_t index) {
+    const gd::InitialInstance& instance = *instances[index];
+    double* instanceNumbers = &numbers[index * NumbersPerInstance];
+    instanceNumbers[0] = instance.GetX();
+    instanceNumbers[1] = instance.GetY();
+    instanceNumbers[2] = instance.GetZ();
+    instanceNumbers[3] = instance.GetAngle();
+    instanceNumbers[4] = instance.GetCustomWidth();
+    instanceNumbers[5] = instance.GetCustomHeight();
+    instanceNumbers[6] = instance.GetCustomDepth();
+
+    auto layerIt = layerIndexes.find(instance.GetLayer());
+    if (layerIt == layerIndexes.end()) {
+      layerIt = layerIndexes
+                    .insert(std::make_pair(instance.GetLayer(),
+                                           layerNames.size()))
+                    .first;
+      layerNames.push_back(instance.GetLayer());
+    }
+    std::int32_t* instanceIntegers = &integers[index * IntegersPerInstance];
+    instanceIntegers[0] = instance.GetZOrder();
+    instanceIntegers[1] = static_cast<std::int32_t>(layerIt->second);
+    instanceIntegers[2] = (instance.IsLocked() ? FlagLocked : 0) |
+                          (instance.HasCustomSize() ? FlagCustomSize : 0) |
+                          (instance.HasCustomDepth() ? FlagCustomDepth : 0);
+  }
+
+  gd::InitialInstancesContainer* container = nullptr;
+  std::vector<gd::InitialInstance*> instances;
+  std::vector<double> numbers;
+  std::vector<std::int32_t> integers;
+  std::vector<std::int32_t> indexes;
+  std::vector<gd::String> layerNames;
+  std::map<gd::String, std::size_t> layerIndexes;
+};
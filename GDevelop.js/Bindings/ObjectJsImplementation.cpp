@@ -6,6 +6,7 @@
 #include <GDCore/Project/PropertyDescriptor.h>
 #include <GDCore/Serialization/Serializer.h>
 #include <GDCore/Serialization/SerializerElement.h>
+#include <GDCore/Tools/Localization.h>
 #include <emscripten.h>
 
 #include <map>
@@ -40,6 +41,11 @@ std::unique_ptr<gd::ObjectConfiguration> ObjectJsImplementation::Clone() const {
 
 std::map<gd::String, gd::PropertyDescriptor>
 ObjectJsImplementation::GetProperties() const {
+  std::size_t translationsGeneration = gd::TranslationsCache::GetGeneration();
+  if (cachedProperties &&
+      cachedPropertiesTranslationsGeneration == translationsGeneration)
+    return *cachedProperties;
+
   std::map<gd::String, gd::PropertyDescriptor>* jsCreatedProperties = nullptr;
   std::map<gd::String, gd::PropertyDescriptor> copiedProperties;
 
@@ -59,10 +65,16 @@ ObjectJsImplementation::GetProperties() const {
 
   copiedProperties = *jsCreatedProperties;
   delete jsCreatedProperties;
+
+  cachedProperties =
+      std::make_shared<const std::map<gd::String, gd::PropertyDescriptor>>(
+          copiedProperties);
+  cachedPropertiesTranslationsGeneration = translationsGeneration;
   return copiedProperties;
 }
 bool ObjectJsImplementation::UpdateProperty(const gd::String& arg0,
                                             const gd::String& arg1) {
+  cachedProperties.reset();
   EM_ASM_INT(
       {
         var self = Module['getCache'](Module['ObjectJsImplementation'])[$0];
@@ -145,6 +157,7 @@ void ObjectJsImplementation::DoSerializeTo(SerializerElement& element) const {
 }
 void ObjectJsImplementation::DoUnserializeFrom(Project& project,
                                                const SerializerElement& element) {
+  cachedProperties.reset();
   EM_ASM_INT(
       {
         var self = Module['getCache'](Module['ObjectJsImplementation'])[$0];
@@ -6,6 +6,9 @@
 #include <GDCore/Serialization/SerializerElement.h>
 #include <emscripten.h>
 
+#include <map>
+#include <memory>
+
 using namespace gd;
 
 /**
@@ -19,7 +22,7 @@ using namespace gd;
  */
 class ObjectJsImplementation : public gd::ObjectConfiguration {
  public:
-  ObjectJsImplementation() {}
+  ObjectJsImplementation() : cachedPropertiesTranslationsGeneration(0) {}
   std::unique_ptr<gd::ObjectConfiguration> Clone() const override;
 
   std::map<gd::String, gd::PropertyDescriptor> GetProperties() const override;
@@ -38,4 +41,20 @@ class ObjectJsImplementation : public gd::ObjectConfiguration {
  protected:
   void DoSerializeTo(SerializerElement& arg0) const override;
   void DoUnserializeFrom(Project& arg0, const SerializerElement& arg1) override;
+
+ private:
+  /**
+   * \brief The properties returned by the JavaScript implementation, until
+   * the content is changed by UpdateProperty or unserialized.
+   *
+   * \note The content must not be modified directly in JavaScript without
+   * calling one of these methods.
+   */
+  mutable std::shared_ptr<const std::map<gd::String, gd::PropertyDescriptor>>
+      cachedProperties;
+  mutable std::size_t
+      cachedPropertiesTranslationsGeneration;  ///< Properties have translated
+                                               ///< labels, so they are
+                                               ///< forgotten when translations
+                                               ///< change.
 };
@@ -0,0 +1,49 @@
+#include <cstdint>
+#include <string>
+
+#include <GDCore/Serialization/Serializer.h>
+#include <GDCore/Serialization/SerializerElement.h>
+
+/**
+ * \brief A buffer holding a gd::SerializerElement encoded in the binary
+ * format of gd::Serializer::ToBinary, so that JavaScript can read (or write)
+ * it directly from the memory of the module.
+ *
+ * This is much faster than walking the element with the bindings or than
+ * converting it to a JSON string and parsing it again.
+ */
+class SerializerBinaryBuffer {
+ public:
+  SerializerBinaryBuffer() {}
+
+  /**
+   * \brief Encode the element in the buffer.
+   */
+  void SerializeFrom(const gd::SerializerElement& element) {
+    data = gd::Serializer::ToBinary(element);
+  }
+
+  /**
+   * \brief Decode the buffer into the element.
+   */
+  void UnserializeTo(gd::SerializerElement& element) const {
+    element = gd::Serializer::FromBinary(data);
+  }
+
+  /**
+   * \brief Resize the buffer, before filling it from JavaScript.
+   */
+  void Resize(std::size_t size) { data.resize(size); }
+
+  std::size_t GetSize() const { return data.size(); }
+
+  /**
+   * \brief Return the address of the data in the memory of the module.
+   */
+  std::uintptr_t GetDataPointer() {
+    return reinterpret_cast<std::uintptr_t>(&data[0]);
+  }
+
+ private:
+  std::string data;
+};
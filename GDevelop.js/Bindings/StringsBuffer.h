@@ -0,0 +1,121 @@
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <GDCore/Events/Expression.h>
+#include <GDCore/Events/Instruction.h>
+#include <GDCore/Project/Object.h>
+#include <GDCore/Project/ObjectsContainer.h>
+#include <GDCore/String.h>
+
+/**
+ * \brief A batch of strings that JavaScript can read at once, directly from
+ * the memory of the module, instead of getting them one by one (each getter
+ * copies the string in the memory of the module and decodes it).
+ *
+ * Strings are interned: each different string is stored once and is
+ * identified by an id. The batch is a list of ids, so that JavaScript only
+ * decodes the strings it has never seen (see `toJSArray` in postjs.js).
+ * Interned strings are kept when the batch is cleared, so that they are
+ * still known when the batch is filled again (for example, at the next render
+ * of the events sheet).
+ */
+class StringsBuffer {
+ public:
+  StringsBuffer() : internedStringsGeneration(0) {
+    internedOffsets.push_back(0);
+  }
+
+  /**
+   * \brief Remove the strings of the batch. Interned strings are kept.
+   */
+  void Clear() { ids.clear(); }
+
+  /**
+   * \brief Remove the strings of the batch and all the interned strings.
+   */
+  void ClearInternedStrings() {
+    ids.clear();
+    internedData.clear();
+    internedOffsets.clear();
+    internedOffsets.push_back(0);
+    internedIds.clear();
+    internedStringsGeneration++;
+  }
+
+  void AddString(const gd::String& str) { ids.push_back(Intern(str.Raw())); }
+
+  /**
+   * \brief Add the (plain string of the) parameters of the instruction.
+   */
+  void AddInstructionParameters(const gd::Instruction& instruction) {
+    for (std::size_t i = 0; i < instruction.GetParametersCount(); ++i)
+      AddString(instruction.GetParameter(i).GetPlainString());
+  }
+
+  /**
+   * \brief Add the names of the objects of the container.
+   */
+  void AddObjectsNames(const gd::ObjectsContainer& container) {
+    for (std::size_t i = 0; i < container.GetObjectsCount(); ++i)
+      AddString(container.GetObject(i).GetName());
+  }
+
+  /**
+   * \brief Return the number of strings of the batch.
+   */
+  std::size_t GetCount() const { return ids.size(); }
+
+  /**
+   * \brief Return the address of the ids (32 bits unsigned integers) of the
+   * strings of the batch.
+   */
+  std::uintptr_t GetIdsPointer() const {
+    return reinterpret_cast<std::uintptr_t>(ids.data());
+  }
+
+  std::size_t GetInternedStringsCount() const { return internedIds.size(); }
+
+  /**
+   * \brief Return a number changed each time the interned strings are
+   * cleared, so that JavaScript knows when to forget them.
+   */
+  std::size_t GetInternedStringsGeneration() const {
+    return internedStringsGeneration;
+  }
+
+  /**
+   * \brief Return the address of the offsets (32 bits unsigned integers) of
+   * the interned strings in their data: the string with id `i` is from
+   * offset `i` to offset `i + 1`.
+   */
+  std::uintptr_t GetInternedOffsetsPointer() const {
+    return reinterpret_cast<std::uintptr_t>(internedOffsets.data());
+  }
+
+  /**
+   * \brief Return the address of the interned strings, encoded in UTF-8.
+   */
+  std::uintptr_t GetInternedDataPointer() const {
+    return reinterpret_cast<std::uintptr_t>(internedData.data());
+  }
+
+ private:
+  std::uint32_t Intern(const std::string& str) {
+    auto it = internedIds.find(str);
+    if (it != internedIds.end()) return it->second;
+
+    std::uint32_t id = static_cast<std::uint32_t>(internedIds.size());
+    internedIds[str] = id;
+    internedData += str;
+    internedOffsets.push_back(static_cast<std::uint32_t>(internedData.size()));
+    return id;
+  }
+
+  std::vector<std::uint32_t> ids;
+  std::string internedData;
+  std::vector<std::uint32_t> internedOffsets;
+  std::unordered_map<std::string, std::uint32_t> internedIds;
+  std::size_t internedStringsGeneration;
+};
@@ -6,6 +6,7 @@
 #include <GDCore/Events/Builtin/RepeatEvent.h>
 #include <GDCore/Events/Builtin/StandardEvent.h>
 #include <GDCore/Events/Builtin/WhileEvent.h>
+#include <GDCore/Events/CodeGeneration/CodeGenerationReport.h>
 #include <GDCore/Events/CodeGeneration/DiagnosticReport.h>
 #include <GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h>
 #include <GDCore/Events/Parsers/ExpressionParser2.h>
@@ -22,12 +23,19 @@
 #include <GDCore/Extensions/Metadata/ParameterMetadataTools.h>
 #include <GDCore/Extensions/Metadata/ParameterOptions.h>
 #include <GDCore/Extensions/Platform.h>
+#include <GDCore/Extensions/PlatformSnapshot.h>
+#include <GDCore/Tools/MemoryTracker.h>
+#include <GDCore/Tools/PerfScope.h>
+#include <GDCore/Tools/Localization.h>
+#include <GDCore/Tools/Log.h>
 #include <GDCore/IDE/AbstractFileSystem.h>
 #include <GDCore/IDE/Dialogs/LayoutEditorCanvas/EditorSettings.h>
 #include <GDCore/IDE/Events/ArbitraryEventsWorker.h>
 #include <GDCore/IDE/Events/EventsContextAnalyzer.h>
 #include <GDCore/IDE/Events/EventsFunctionSelfCallChecker.h>
+#include <GDCore/IDE/Events/EventsFunctionsCallGraph.h>
 #include <GDCore/IDE/Events/EventsIdentifiersFinder.h>
+#include <GDCore/IDE/Events/EventsListRows.h>
 #include <GDCore/IDE/Events/EventsListUnfolder.h>
 #include <GDCore/IDE/Events/EventsParametersLister.h>
 #include <GDCore/IDE/Events/EventsPositionFinder.h>
@@ -41,6 +49,7 @@
 #include <GDCore/IDE/Events/ExpressionValidator.h>
 #include <GDCore/IDE/Events/InstructionSentenceFormatter.h>
 #include <GDCore/IDE/Events/InstructionsCountEvaluator.h>
+#include <GDCore/IDE/Events/ProjectStatisticsEvaluator.h>
 #include <GDCore/IDE/Events/InstructionsTypeRenamer.h>
 #include <GDCore/IDE/Events/TextFormatting.h>
 #include <GDCore/IDE/Events/UsedExtensionsFinder.h>
@@ -73,7 +82,9 @@
 #include <GDCore/Project/ExternalLayout.h>
 #include <GDCore/Project/InitialInstance.h>
 #include <GDCore/Project/InitialInstancesContainer.h>
+#include <GDCore/Project/InitialInstancesDelta.h>
 #include <GDCore/Project/Layout.h>
+#include <GDCore/Project/LayoutSnapshot.h>
 #include <GDCore/Project/LayersContainer.h>
 #include <GDCore/Project/MeasurementBaseUnit.h>
 #include <GDCore/Project/MeasurementUnitElement.h>
@@ -97,6 +108,7 @@
 #include <GDJS/Events/Builtin/JsCodeEvent.h>
 #include <GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/EventsFunctionsExtensionCodeGenerator.h>
+#include <GDJS/Events/CodeGeneration/LayoutCodeGenerationCache.h>
 #include <GDJS/Events/CodeGeneration/LayoutCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/MetadataDeclarationHelper.h>
 #include <GDJS/Events/CodeGeneration/ObjectCodeGenerator.h>
@@ -122,7 +134,10 @@
 #include "BehaviorJsImplementation.h"
 #include "BehaviorSharedDataJsImplementation.h"
 #include "ObjectJsImplementation.h"
+#include "InitialInstancesBuffer.h"
 #include "ProjectHelper.h"
+#include "SerializerBinaryBuffer.h"
+#include "StringsBuffer.h"
 
 /**
  * \brief Manual binding of gd::ArbitraryResourceWorker to allow overriding
@@ -358,6 +373,72 @@ class AbstractFileSystemJS : public AbstractFileSystem {
     return directories;
   }
 
+  virtual gd::String GetFileFingerprint(const gd::String &file) {
+    return (const char *)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          // Optional: files are always copied if not implemented.
+          if (!self.hasOwnProperty('getFileFingerprint')) return ensureString('');
+          return ensureString(self.getFileFingerprint(UTF8ToString($1)));
+        },
+        (int)this,
+        file.c_str());
+  }
+
+  virtual bool RemoveFile(const gd::String &file) {
+    return (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          // Optional: files are never removed if not implemented.
+          if (!self.hasOwnProperty('removeFile')) return false;
+          return self.removeFile(UTF8ToString($1));
+        },
+        (int)this,
+        file.c_str());
+  }
+
+  // OpenForWrite, Append and Close are optional: if not implemented, the
+  // content is written at once with WriteToFile.
+  virtual bool OpenForWrite(const gd::String &file) {
+    int result = EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('openForWrite')) return -1;
+          return self.openForWrite(UTF8ToString($1)) ? 1 : 0;
+        },
+        (int)this,
+        file.c_str());
+    if (result == -1) return AbstractFileSystem::OpenForWrite(file);
+    return result == 1;
+  }
+
+  virtual bool Append(const gd::String &file, const gd::String &content) {
+    int result = EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('append')) return -1;
+          return self.append(UTF8ToString($1), UTF8ToString($2)) ? 1 : 0;
+        },
+        (int)this,
+        file.c_str(),
+        content.c_str());
+    if (result == -1) return AbstractFileSystem::Append(file, content);
+    return result == 1;
+  }
+
+  virtual bool Close(const gd::String &file) {
+    int result = EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('close')) return -1;
+          return self.close(UTF8ToString($1)) ? 1 : 0;
+        },
+        (int)this,
+        file.c_str());
+    if (result == -1) return AbstractFileSystem::Close(file);
+    return result == 1;
+  }
+
   AbstractFileSystemJS(){};
   virtual ~AbstractFileSystemJS(){};
 };
@@ -465,6 +546,7 @@ typedef std::vector<const gd::ObjectFolderOrObject*> VectorObjectFolderOrObject;
 typedef std::vector<gd::Screenshot> VectorScreenshot;
 typedef QuickCustomization::Visibility
     QuickCustomization_Visibility;
+typedef LayoutSnapshot::Part LayoutSnapshot_Part;
 typedef CustomObjectConfiguration::EdgeAnchor
     CustomObjectConfiguration_EdgeAnchor;
 
@@ -527,6 +609,7 @@ typedef std::vector<gd::PropertyDescriptorChoice> VectorPropertyDescriptorChoice
             std::shared_ptr<gd::ObjectConfiguration>(instance))
 
 #define WRAPPED_at(a) at(a).get()
+#define WRAPPED_GetExtensionToUpdate(name) GetExtensionToUpdate(name).get()
 
 #define MAP_getOrCreate(key) operator[](key)
 #define MAP_get(key) find(key)->second
@@ -841,6 +924,24 @@ typedef std::vector<gd::PropertyDescriptorChoice> VectorPropertyDescriptorChoice
 #define STATIC_GetDefaultMeasurementUnitByName GetDefaultMeasurementUnitByName
 #define STATIC_HasDefaultMeasurementUnitNamed HasDefaultMeasurementUnitNamed
 #define STATIC_GetEdgeAnchorFromString GetEdgeAnchorFromString
+#define STATIC_ComputeKey ComputeKey
+#define STATIC_ComputeProjectExtensionsDeclarationsKey \
+  ComputeProjectExtensionsDeclarationsKey
+#define STATIC_ComputeExtensionCodeKey ComputeExtensionCodeKey
+#define STATIC_IsEnabled IsEnabled
+#define STATIC_Enable Enable
+#define STATIC_Reset Reset
+#define STATIC_GetCounter GetCounter
+#define STATIC_GetCallsCount GetCallsCount
+#define STATIC_GetTotalDuration GetTotalDuration
+#define STATIC_SetMinimumLevel(level) \
+  SetMinimumLevel(static_cast<gd::LogSink::Level>(level))
+#define STATIC_SetMaximumMessagesPerSecond SetMaximumMessagesPerSecond
+#define STATIC_UseJavaScriptHandler UseJavaScriptHandler
+#define STATIC_Flush Flush
+#define STATIC_Clear Clear
+#define STATIC_ComputeLayoutStatistics ComputeLayoutStatistics
+#define STATIC_ComputeProjectStatistics ComputeProjectStatistics
 
 // We postfix some methods with "At" as Javascript does not support overloading
 #define GetLayoutAt GetLayout
@@ -863,4 +964,9 @@ typedef std::vector<gd::PropertyDescriptorChoice> VectorPropertyDescriptorChoice
 using namespace gd;
 using namespace std;
 
+// The glue of the modules that are built (see Bindings/modules.js).
+#ifdef GD_BINDINGS_GLUE_CPP
+#include GD_BINDINGS_GLUE_CPP
+#else
 #include "glue.cpp"
+#endif
@@ -0,0 +1,63 @@
+/**
+ * The optional modules of libGD.js: the interfaces of Bindings.idl that are
+ * only used by the editor. A build with `--modules=core` leaves them out,
+ * giving a smaller and faster to instantiate library for the tools that only
+ * need the project model, the serialization, the code generation and the
+ * export (a game viewer, a linter, an export worker...).
+ *
+ * An interface can only be in a module if no interface of the core (or of
+ * another module that is kept) uses it: this is checked when the bindings
+ * are generated (see update-bindings.js).
+ */
+module.exports = {
+  refactoring: [
+    'WholeProjectRefactorer',
+    'VariablesChangeset',
+    'UnfilledRequiredBehaviorPropertyProblem',
+    'VectorUnfilledRequiredBehaviorPropertyProblem',
+    'EventsRefactorer',
+    'EventsSearchResult',
+    'VectorEventsSearchResult',
+    'EventsRemover',
+    'EventsListUnfolder',
+    'EventsListRows',
+    'InstructionsTypeRenamer',
+    'EventsBasedObjectDependencyFinder',
+    'PropertyFunctionGenerator',
+    'ProjectResourcesAdder',
+    'ResourcesRenamer',
+    'VariableInstructionSwitcher',
+    'ObjectVariableHelper',
+    'EventsBasedObjectVariantHelper',
+  ],
+  completion: [
+    'ExpressionCompletionDescription',
+    'VectorExpressionCompletionDescription',
+    'ExpressionCompletionFinder',
+    'ExpressionNodeLocationFinder',
+    'ExpressionTypeFinder',
+  ],
+  editor: [
+    'HighestZOrderFinder',
+    'VectorPairStringTextFormatting',
+    'TextFormatting',
+    'InstructionSentenceFormatter',
+    'EventsVariablesFinder',
+    'EventsIdentifiersFinder',
+    'EventsFunctionSelfCallChecker',
+    'EventsFunctionsCallGraph',
+    'EventsParametersLister',
+    'EventsPositionFinder',
+    'EventsTypesLister',
+    'EventsContext',
+    'EventsContextAnalyzer',
+    'UsedExtensionsResult',
+    'UsedExtensionsFinder',
+    'ExampleExtensionUsagesFinder',
+    'InstructionsCountEvaluator',
+    'ProjectStatistics',
+    'ProjectStatisticsEvaluator',
+    'ObjectsUsingResourceCollector',
+    'ResourcesInUseHelper',
+  ],
+};
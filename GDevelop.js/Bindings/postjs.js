@@ -177,96 +177,267 @@ var adaptNamingConventions = function (gd) {
     return arr;
   };
 
-  // Add gd.Serializer.fromJSObject which is much faster than manually parsing
-  // JSON with gd.Serializer.fromJSON.
-  const elementFromJSObject = function (object, element) {
-    if (typeof object === 'number') {
-      element.setDoubleValue(object);
-    } else if (typeof object === 'string') {
-      element.setStringValue(object);
-    } else if (typeof object === 'boolean') {
-      element.setBoolValue(object);
-    } else if (Array.isArray(object)) {
-      element.considerAsArray();
-      for (var i = 0; i < object.length; ++i) {
-        var item = element.addChild('');
-        elementFromJSObject(object[i], item);
+  // Add gd.Serializer.fromJSObject and gd.Serializer.toJSObject, which are
+  // much faster than going through a JSON string with gd.Serializer.fromJSON
+  // or gd.Serializer.toJSON.
+  // Elements are exchanged with the binary format of gd::Serializer::ToBinary,
+  // read and written directly in the memory of the module (see
+  // gd::Serializer::ToBinary for the description of the format).
+  const binaryHeader = [71, 68, 66, 49]; // "GDB1"
+  const BinaryNull = 0;
+  const BinaryFalse = 1;
+  const BinaryTrue = 2;
+  const BinaryInt = 3;
+  const BinaryDouble = 4;
+  const BinaryString = 5;
+  const BinaryArray = 6;
+  const BinaryObject = 7;
+
+  const encodeJSObjectToBinary = function (rootObject) {
+    let bytes = new Uint8Array(1024);
+    let dataView = new DataView(bytes.buffer);
+    let position = 0;
+    const keys = new Map();
+
+    const reserve = function (size) {
+      if (position + size <= bytes.length) return;
+
+      const newBytes = new Uint8Array(
+        Math.max(bytes.length * 2, position + size)
+      );
+      newBytes.set(bytes);
+      bytes = newBytes;
+      dataView = new DataView(bytes.buffer);
+    };
+    const writeVarUint = function (value) {
+      reserve(10);
+      while (value >= 0x80) {
+        bytes[position++] = (value % 0x80) | 0x80;
+        value = Math.floor(value / 0x80);
+      }
+      bytes[position++] = value;
+    };
+    const writeString = function (str) {
+      const length = lengthBytesUTF8(str);
+      writeVarUint(length);
+      reserve(length + 1); // stringToUTF8Array also writes a null terminator.
+      stringToUTF8Array(str, bytes, position, length + 1);
+      position += length;
+    };
+    const writeKey = function (key) {
+      const index = keys.get(key);
+      if (index !== undefined) {
+        writeVarUint(index + 1);
+        return;
       }
-    } else if (typeof object === 'object') {
-      for (var childName in object) {
-        if (object.hasOwnProperty(childName)) {
-          var child = element.addChild(childName);
-          elementFromJSObject(object[childName], child);
+
+      keys.set(key, keys.size);
+      writeVarUint(0);
+      writeString(key);
+    };
+    const writeObject = function (object) {
+      reserve(1);
+      if (typeof object === 'number') {
+        reserve(9);
+        bytes[position++] = BinaryDouble;
+        dataView.setFloat64(position, object, true);
+        position += 8;
+      } else if (typeof object === 'string') {
+        bytes[position++] = BinaryString;
+        writeString(object);
+      } else if (typeof object === 'boolean') {
+        bytes[position++] = object ? BinaryTrue : BinaryFalse;
+      } else if (Array.isArray(object)) {
+        bytes[position++] = BinaryArray;
+        writeVarUint(object.length);
+        for (let i = 0; i < object.length; ++i) {
+          writeObject(object[i]);
+        }
+      } else {
+        // Like any other value (null, undefined, functions...), objects are
+        // encoded as objects (without members, for non objects).
+        const childNames =
+          object && typeof object === 'object' ? Object.keys(object) : [];
+        bytes[position++] = BinaryObject;
+        writeVarUint(childNames.length);
+        for (let i = 0; i < childNames.length; ++i) {
+          writeKey(childNames[i]);
+          writeObject(object[childNames[i]]);
         }
       }
-    }
+    };
+
+    reserve(binaryHeader.length);
+    bytes.set(binaryHeader, 0);
+    position = binaryHeader.length;
+    writeObject(rootObject);
+    return bytes.subarray(0, position);
+  };
+
+  const utf8Decoder = new TextDecoder('utf-8');
+
+  const decodeBinaryToJSObject = function (bytes) {
+    const dataView = new DataView(
+      bytes.buffer,
+      bytes.byteOffset,
+      bytes.byteLength
+    );
+    let position = binaryHeader.length;
+    const keys = [];
+
+    const readVarUint = function () {
+      let value = 0;
+      let multiplier = 1;
+      let byte;
+      do {
+        byte = bytes[position++];
+        value += (byte & 0x7f) * multiplier;
+        multiplier *= 0x80;
+      } while (byte & 0x80);
+      return value;
+    };
+    const readString = function () {
+      const length = readVarUint();
+      // Decode exactly the given length, as strings can contain null
+      // characters. TextDecoder can't read shared memory (when the module
+      // is built with threads), so the bytes are copied in this case.
+      const stringBytes =
+        typeof SharedArrayBuffer !== 'undefined' &&
+        bytes.buffer instanceof SharedArrayBuffer
+          ? bytes.slice(position, position + length)
+          : bytes.subarray(position, position + length);
+      const str = utf8Decoder.decode(stringBytes);
+      position += length;
+      return str;
+    };
+    const readObject = function () {
+      const tag = bytes[position++];
+      if (tag === BinaryFalse) return false;
+      else if (tag === BinaryTrue) return true;
+      else if (tag === BinaryInt) {
+        const zigzag = readVarUint();
+        return zigzag % 2 ? -(zigzag + 1) / 2 : zigzag / 2;
+      } else if (tag === BinaryDouble) {
+        const value = dataView.getFloat64(position, true);
+        position += 8;
+        return value;
+      } else if (tag === BinaryString) {
+        return readString();
+      } else if (tag === BinaryArray) {
+        const count = readVarUint();
+        const array = [];
+        for (let i = 0; i < count; ++i) {
+          array.push(readObject());
+        }
+        return array;
+      } else if (tag === BinaryObject) {
+        const count = readVarUint();
+        const object = {};
+        for (let i = 0; i < count; ++i) {
+          const keyReference = readVarUint();
+          let key;
+          if (keyReference === 0) {
+            key = readString();
+            keys.push(key);
+          } else {
+            key = keys[keyReference - 1];
+          }
+          object[key] = readObject();
+        }
+        return object;
+      }
+
+      return null;
+    };
+
+    return readObject();
   };
 
   gd.Serializer.fromJSObject = function (object) {
-    var element = new gd.SerializerElement();
-    elementFromJSObject(object, element);
+    const bytes = encodeJSObjectToBinary(object);
+    const buffer = new gd.SerializerBinaryBuffer();
+    buffer.resize(bytes.length);
+    // Read HEAPU8 after resizing, as the memory could have grown.
+    HEAPU8.set(bytes, buffer.getDataPointer());
+
+    const element = new gd.SerializerElement();
+    buffer.unserializeTo(element);
+    buffer.delete();
 
     return element;
   };
 
-  const valueToJSObject = function (serializerValue) {
-    // TODO: use getRaw to avoid conversions
-    if (serializerValue.isBoolean()) return serializerValue.getBool();
-    else if (serializerValue.isDouble()) return serializerValue.getDouble();
-    else if (serializerValue.isInt()) return serializerValue.getInt();
-    else if (serializerValue.isString()) {
-      return serializerValue.getRawString();
-    }
+  gd.Serializer.toJSObject = function (element) {
+    const buffer = new gd.SerializerBinaryBuffer();
+    buffer.serializeFrom(element);
+    const dataPointer = buffer.getDataPointer();
+    // No call to the module is done while decoding, so the memory can't grow
+    // and the data can be read in place.
+    const object = decodeBinaryToJSObject(
+      HEAPU8.subarray(dataPointer, dataPointer + buffer.getSize())
+    );
+    buffer.delete();
+
+    return object;
+  };
 
-    return null;
+  // Views on the buffers of the instances, to read or change them without
+  // calling the getters and setters of each instance. The views must be
+  // obtained again after any call to the module, as the memory could have
+  // grown (which detaches the views).
+  gd.InitialInstancesBuffer.prototype.getNumbers = function () {
+    const pointer = this.getNumbersPointer();
+    return HEAPF64.subarray(
+      pointer / 8,
+      pointer / 8 + this.getInstancesCount() * 7
+    );
   };
 
-  gd.Serializer.toJSObject = function (element) {
-    if (!element.isValueUndefined()) {
-      return valueToJSObject(element.getValue());
-    } else if (element.consideredAsArray()) {
-      const array = [];
-
-      const children = element.getAllChildren();
-      const childrenCount = children.size();
-      for (let i = 0; i < childrenCount; ++i) {
-        // TODO: double check usage of shared_ptr
-        const sharedPtrSerializerElement = children.getSharedPtrSerializerElement(
-          i
-        );
-        const serializerElement = sharedPtrSerializerElement.get();
-        array.push(gd.Serializer.toJSObject(serializerElement));
-        sharedPtrSerializerElement.reset();
-      }
+  gd.InitialInstancesBuffer.prototype.getIntegers = function () {
+    const pointer = this.getIntegersPointer();
+    return HEAP32.subarray(
+      pointer / 4,
+      pointer / 4 + this.getInstancesCount() * 3
+    );
+  };
 
-      return array;
-    } else {
-      const object = {};
+  gd.InitialInstancesBuffer.prototype.setIndexes = function (indexes) {
+    this.setIndexesCount(indexes.length);
+    // Read HEAP32 after resizing, as the memory could have grown.
+    HEAP32.set(indexes, this.getIndexesPointer() / 4);
+  };
 
-      const attributes = element.getAllAttributes();
-      const attributeNames = attributes.keys();
+  // Decode the strings of the batch. Interned strings are only decoded the
+  // first time they are seen, then are reused from the cache of the buffer.
+  gd.StringsBuffer.prototype.toJSArray = function () {
+    const generation = this.getInternedStringsGeneration();
+    if (
+      !this._internedStrings ||
+      this._internedStringsGeneration !== generation
+    ) {
+      this._internedStrings = [];
+      this._internedStringsGeneration = generation;
+    }
 
-      for (let i = 0; i < attributeNames.size(); ++i) {
-        const name = attributeNames.at(i);
-        const serializerValue = attributes.get(name);
-        object[name] = valueToJSObject(element.getValue());
+    const internedStrings = this._internedStrings;
+    const internedStringsCount = this.getInternedStringsCount();
+    if (internedStrings.length < internedStringsCount) {
+      const offsetsIndex = this.getInternedOffsetsPointer() / 4;
+      const dataPointer = this.getInternedDataPointer();
+      for (let id = internedStrings.length; id < internedStringsCount; id++) {
+        const start = HEAPU32[offsetsIndex + id];
+        const end = HEAPU32[offsetsIndex + id + 1];
+        internedStrings.push(UTF8ToString(dataPointer + start, end - start));
       }
+    }
 
-      const children = element.getAllChildren();
-      const childrenCount = children.size();
-      for (let i = 0; i < childrenCount; ++i) {
-        // TODO: double check usage of shared_ptr
-        const name = children.getString(i);
-        const sharedPtrSerializerElement = children.getSharedPtrSerializerElement(
-          i
-        );
-        const serializerElement = sharedPtrSerializerElement.get();
-        object[name] = gd.Serializer.toJSObject(serializerElement);
-        sharedPtrSerializerElement.reset();
-      }
-      return object;
+    const count = this.getCount();
+    const idsIndex = this.getIdsPointer() / 4;
+    const strings = new Array(count);
+    for (let i = 0; i < count; i++) {
+      strings[i] = internedStrings[HEAPU32[idsIndex + i]];
     }
-    return null;
+    return strings;
   };
 
   //Preserve backward compatibility with some alias for methods:
@@ -309,6 +480,12 @@ var adaptNamingConventions = function (gd) {
     return clonedObj;
   }
 
+  // Return the size of the memory of the module, in bytes. The memory can
+  // only grow, so this is also the highest memory used until now.
+  gd.getHeapSize = function () {
+    return HEAP8.length;
+  };
+
   gd._deepCloneForObjectJsImplementationContent = function (obj) {
     return deepClone(obj);
   }
@@ -316,4 +493,460 @@ var adaptNamingConventions = function (gd) {
   return gd;
 };
 
+// Debug mode recording the objects created with `new` (or `clone`), which
+// are owned by JavaScript and must be deleted, to find the ones that are
+// never deleted (these are leaking memory).
+var addLeaksTracking = function (gd) {
+  var aliveObjects = null; // Creation records of alive objects, by pointer.
+  var captureStacks = true;
+  var checkpoint = 0;
+  var originalValues = null; // Values of the module replaced while tracking.
+
+  function recordObject(className, object) {
+    aliveObjects.set(object.ptr, {
+      className: className,
+      ptr: object.ptr,
+      checkpoint: checkpoint,
+      stack: captureStacks ? new Error().stack || '' : '',
+    });
+  }
+
+  function replaceModuleValue(key, value) {
+    if (!originalValues.has(key)) originalValues.set(key, gd[key]);
+    gd[key] = value;
+  }
+
+  function trackClass(OriginalClass, className) {
+    var TrackedClass = function () {
+      OriginalClass.apply(this, arguments);
+      recordObject(className, this);
+    };
+    // Share the prototype and the cache of wrappers (and the static methods),
+    // so that the tracked class can be used in place of the original one.
+    TrackedClass.prototype = OriginalClass.prototype;
+    for (var key in OriginalClass) {
+      if (OriginalClass.hasOwnProperty(key)) {
+        TrackedClass[key] = OriginalClass[key];
+      }
+    }
+
+    var proto = OriginalClass.prototype;
+    if (proto.hasOwnProperty('clone')) {
+      var originalClone = proto.clone;
+      proto.clone = function () {
+        var clone = originalClone.apply(this, arguments);
+        if (aliveObjects && clone && clone.ptr) recordObject(className, clone);
+        return clone;
+      };
+      proto.clone.__originalClone__ = originalClone;
+    }
+
+    return TrackedClass;
+  }
+
+  function untrackClass(OriginalClass) {
+    var proto = OriginalClass.prototype;
+    if (proto.hasOwnProperty('clone') && proto.clone.__originalClone__) {
+      proto.clone = proto.clone.__originalClone__;
+    }
+  }
+
+  /**
+   * Start to record the objects created with `new` (or `clone`) and not
+   * deleted. Must be called before the objects to track are created.
+   * Set `captureStacks` to false to only record the class of the objects
+   * (faster).
+   */
+  gd.startLeaksTracking = function (options) {
+    if (aliveObjects) return;
+
+    aliveObjects = new Map();
+    originalValues = new Map();
+    captureStacks = !options || options.captureStacks !== false;
+    checkpoint = 0;
+
+    var trackedClasses = new Map();
+    for (var key in gd) {
+      if (!gd.hasOwnProperty(key)) continue;
+      var value = gd[key];
+      if (typeof value !== 'function' || !value.prototype) continue;
+      if (value.prototype.__class__ !== value) continue;
+      if (!trackedClasses.has(value)) {
+        trackedClasses.set(value, trackClass(value, key));
+      }
+    }
+    // Replace the classes, including their aliases (like `gd.Object`).
+    for (var key in gd) {
+      if (gd.hasOwnProperty(key) && trackedClasses.has(gd[key])) {
+        replaceModuleValue(key, trackedClasses.get(gd[key]));
+      }
+    }
+
+    var originalDestroy = gd.destroy;
+    replaceModuleValue('destroy', function (object) {
+      if (aliveObjects && object) aliveObjects.delete(object.ptr);
+      originalDestroy(object);
+    });
+  };
+
+  /**
+   * Stop to record the objects, and forget the objects recorded.
+   */
+  gd.stopLeaksTracking = function () {
+    if (!aliveObjects) return;
+
+    originalValues.forEach(function (value, key) {
+      if (typeof value === 'function' && value.prototype) untrackClass(value);
+      gd[key] = value;
+    });
+    aliveObjects = null;
+    originalValues = null;
+  };
+
+  /**
+   * Add a checkpoint, to later get only the objects created after it.
+   * Returns the checkpoint.
+   */
+  gd.addLeaksTrackingCheckpoint = function () {
+    return ++checkpoint;
+  };
+
+  /**
+   * Return the objects that were created after the checkpoint (or since the
+   * start of the tracking) and are still not deleted, with the class of the
+   * object, its pointer, and the stack where it was created.
+   */
+  gd.getLeakedObjects = function (sinceCheckpoint) {
+    if (!aliveObjects) return [];
+
+    var leakedObjects = [];
+    aliveObjects.forEach(function (record) {
+      if (record.checkpoint >= (sinceCheckpoint || 0)) {
+        leakedObjects.push(record);
+      }
+    });
+    return leakedObjects;
+  };
+};
+
+// Export (and code generation) of a project in a worker, so that the thread
+// of the editor is not blocked. The editor sends a snapshot of the project,
+// the worker loads it in its own instance of the module, exports it and
+// streams back the operations done on the file system, which the editor
+// applies to the real file system.
+var addExportInWorker = function (gd) {
+  var fileSystemOperations = [
+    'mkDir',
+    'clearDir',
+    'copyFile',
+    'writeToFile',
+    'removeFile',
+    'openForWrite',
+    'append',
+    'close',
+  ];
+
+  function getFileName(fullPath) {
+    return fullPath.substring(fullPath.lastIndexOf('/') + 1);
+  }
+
+  function getDirName(fullPath) {
+    var index = fullPath.lastIndexOf('/');
+    if (index === -1) return '.';
+    if (index === 0) return '/';
+    return fullPath.substring(0, index);
+  }
+
+  // A file system sending the changes done by the exporter with `post`. The
+  // files that the exporter can read must be given in `fileContents`.
+  function makeStreamingFileSystem(fileContents, post) {
+    var writtenFiles = {};
+    var fs = new gd.AbstractFileSystemJS();
+    fileSystemOperations.forEach(function (operation) {
+      fs[operation] = function () {
+        var args = Array.prototype.slice.call(arguments);
+        if (operation === 'writeToFile' || operation === 'openForWrite') {
+          writtenFiles[args[0]] = true;
+        } else if (operation === 'copyFile') {
+          writtenFiles[args[1]] = true;
+        }
+        post({ operation: operation, args: args });
+        return true;
+      };
+    });
+    fs.dirExists = function () {
+      return true;
+    };
+    fs.fileExists = function (filePath) {
+      return (
+        Object.prototype.hasOwnProperty.call(fileContents, filePath) ||
+        writtenFiles.hasOwnProperty(filePath)
+      );
+    };
+    fs.readFile = function (filePath) {
+      return Object.prototype.hasOwnProperty.call(fileContents, filePath)
+        ? fileContents[filePath]
+        : '';
+    };
+    fs.readDir = function (dirPath) {
+      var prefix = dirPath.replace(/\/$/, '') + '/';
+      var files = new gd.VectorString();
+      Object.keys(fileContents).forEach(function (filePath) {
+        if (
+          filePath.indexOf(prefix) === 0 &&
+          filePath.indexOf('/', prefix.length) === -1
+        ) {
+          files.push_back(filePath);
+        }
+      });
+      return files;
+    };
+    fs.getTempDir = function () {
+      return '/tmp';
+    };
+    fs.fileNameFrom = getFileName;
+    fs.dirNameFrom = getDirName;
+    fs.isAbsolute = function (fullPath) {
+      return fullPath.length > 0 && fullPath.charAt(0) === '/';
+    };
+    fs.getFileFingerprint = function () {
+      return '';
+    };
+    return fs;
+  }
+
+  // Call the setters of the export options from an object like
+  // `{layoutName: 'Scene', fullLoadingScreen: true}`. Setters with several
+  // arguments are given an array, and methods without arguments `true`.
+  function applyExportOptions(exportOptions, options) {
+    Object.keys(options || {}).forEach(function (name) {
+      var value = options[name];
+      var setterName = 'set' + name.charAt(0).toUpperCase() + name.slice(1);
+      var method = exportOptions[setterName] || exportOptions[name];
+      if (typeof method !== 'function') {
+        throw new Error('Unknown export option: "' + name + '".');
+      }
+      if (Array.isArray(value)) method.apply(exportOptions, value);
+      else if (method === exportOptions[setterName])
+        method.call(exportOptions, value);
+      else if (value) method.call(exportOptions);
+    });
+  }
+
+  /**
+   * Return the snapshot of a project to send to a worker, as an ArrayBuffer
+   * that can be transferred (see `gd.exportInWorker`).
+   */
+  gd.serializeProjectForWorker = function (project) {
+    var element = new gd.SerializerElement();
+    project.serializeTo(element);
+    var buffer = new gd.SerializerBinaryBuffer();
+    buffer.serializeFrom(element);
+    element.delete();
+
+    var dataPointer = buffer.getDataPointer();
+    var data = HEAPU8.slice(dataPointer, dataPointer + buffer.getSize()).buffer;
+    buffer.delete();
+    return data;
+  };
+
+  /**
+   * Create a project from a snapshot returned by
+   * `gd.serializeProjectForWorker`. The project must be deleted.
+   */
+  gd.unserializeProjectFromWorker = function (data) {
+    var bytes = new Uint8Array(data);
+    var buffer = new gd.SerializerBinaryBuffer();
+    buffer.resize(bytes.length);
+    // Read HEAPU8 after resizing, as the memory could have grown.
+    HEAPU8.set(bytes, buffer.getDataPointer());
+    var element = new gd.SerializerElement();
+    buffer.unserializeTo(element);
+    buffer.delete();
+
+    var project = gd.ProjectHelper.createNewGDJSProject();
+    project.unserializeFrom(element);
+    element.delete();
+    return project;
+  };
+
+  /**
+   * Answer the export requests sent by `gd.exportInWorker` to `scope` (the
+   * global scope of a worker, or a MessagePort).
+   *
+   * `onProjectLoaded(project)` can be given to prepare a project before it is
+   * exported (for example, to declare the events based extensions in the
+   * platform, which are not part of the snapshot).
+   *
+   * Return a function to stop answering the requests.
+   */
+  gd.handleExportRequestsInWorker = function (scope, options) {
+    var onProjectLoaded = (options && options.onProjectLoaded) || null;
+
+    var onMessage = function (event) {
+      var request = event.data;
+      if (!request || request.gdExportRequestId === undefined) return;
+
+      var post = function (message) {
+        message.gdExportRequestId = request.gdExportRequestId;
+        scope.postMessage(message);
+      };
+
+      var result = { done: true, succeeded: false, error: '', metrics: '' };
+      var project = null;
+      var fs = null;
+      var exporter = null;
+      var exportOptions = null;
+      try {
+        project = gd.unserializeProjectFromWorker(request.projectData);
+        if (onProjectLoaded) onProjectLoaded(project);
+
+        fs = makeStreamingFileSystem(request.fileContents || {}, post);
+        exporter = new gd.Exporter(fs, request.gdjsRoot || '');
+        if (request.codeOutputDirectory)
+          exporter.setCodeOutputDirectory(request.codeOutputDirectory);
+        if (request.codeGenerationThreadsCount)
+          exporter.setCodeGenerationThreadsCount(
+            request.codeGenerationThreadsCount
+          );
+
+        if (request.exportType === 'preview') {
+          exportOptions = new gd.PreviewExportOptions(
+            project,
+            request.outputPath
+          );
+          applyExportOptions(exportOptions, request.options);
+          result.succeeded = exporter.exportProjectForPixiPreview(
+            exportOptions
+          );
+        } else if (request.exportType === 'whole') {
+          exportOptions = new gd.ExportOptions(project, request.outputPath);
+          applyExportOptions(exportOptions, request.options);
+          result.succeeded = exporter.exportWholePixiProject(exportOptions);
+        } else {
+          throw new Error('Unknown export type: "' + request.exportType + '".');
+        }
+        result.error = exporter.getLastError();
+        result.metrics = exporter.getLastMetricsReport();
+      } catch (error) {
+        result.succeeded = false;
+        result.error = String((error && error.message) || error);
+      }
+
+      if (exportOptions) exportOptions.delete();
+      if (exporter) exporter.delete();
+      if (fs) fs.delete();
+      if (project) project.delete();
+      post(result);
+    };
+
+    scope.addEventListener('message', onMessage);
+    return function () {
+      scope.removeEventListener('message', onMessage);
+    };
+  };
+
+  var lastExportRequestId = 0;
+
+  /**
+   * Export a project in a worker answering the requests with
+   * `gd.handleExportRequestsInWorker`. The operations on the file system are
+   * streamed to `fileSystem` as they are done by the exporter, with the
+   * same names and arguments as the methods of `gd.AbstractFileSystemJS`.
+   * If `openForWrite`, `append` and `close` are not given, the pieces of the
+   * files are gathered and given to `writeToFile`.
+   *
+   * `request` contains `exportType` ('preview' or 'whole'), `outputPath`,
+   * `gdjsRoot`, the `options` (see `applyExportOptions`) and the
+   * `fileContents` that can be read by the exporter. The project is given
+   * as `project` or, if already serialized, as `projectData`.
+   *
+   * Return a promise resolved with `{succeeded, error, metrics}` when the
+   * export is finished.
+   */
+  gd.exportInWorker = function (worker, request, fileSystem) {
+    var exportRequestId = ++lastExportRequestId;
+    var projectData =
+      request.projectData || gd.serializeProjectForWorker(request.project);
+    var isStreamingFiles = !!(
+      fileSystem.openForWrite &&
+      fileSystem.append &&
+      fileSystem.close
+    );
+    var openedFiles = {};
+
+    return new Promise(function (resolve) {
+      var onMessage = function (event) {
+        var message = event.data;
+        if (!message || message.gdExportRequestId !== exportRequestId) return;
+
+        if (message.done) {
+          worker.removeEventListener('message', onMessage);
+          resolve({
+            succeeded: message.succeeded,
+            error: message.error,
+            metrics: message.metrics,
+          });
+          return;
+        }
+
+        var operation = message.operation;
+        var args = message.args;
+        if (!isStreamingFiles) {
+          if (operation === 'openForWrite') {
+            openedFiles[args[0]] = [];
+            return;
+          } else if (operation === 'append') {
+            if (openedFiles[args[0]]) openedFiles[args[0]].push(args[1]);
+            return;
+          } else if (operation === 'close') {
+            if (openedFiles[args[0]]) {
+              operation = 'writeToFile';
+              args = [args[0], openedFiles[args[0]].join('')];
+              delete openedFiles[args[0]];
+            } else return;
+          }
+        }
+        if (fileSystem[operation]) fileSystem[operation].apply(fileSystem, args);
+      };
+      worker.addEventListener('message', onMessage);
+
+      worker.postMessage(
+        {
+          gdExportRequestId: exportRequestId,
+          exportType: request.exportType,
+          projectData: projectData,
+          outputPath: request.outputPath,
+          gdjsRoot: request.gdjsRoot,
+          codeOutputDirectory: request.codeOutputDirectory,
+          codeGenerationThreadsCount: request.codeGenerationThreadsCount,
+          options: request.options,
+          fileContents: request.fileContents,
+        },
+        [projectData]
+      );
+    });
+  };
+};
+
+// The strings translated by `getTranslation` are cached by libGD.js:
+// forget them when the translation function (so the language) is changed.
+var clearTranslationsCacheOnChange = function (gd) {
+  var getTranslation = gd.getTranslation;
+  Object.defineProperty(gd, 'getTranslation', {
+    configurable: true,
+    enumerable: true,
+    get: function () {
+      return getTranslation;
+    },
+    set: function (newGetTranslation) {
+      getTranslation = newGetTranslation;
+      gd.TranslationsCache.clear();
+    },
+  });
+};
+
 adaptNamingConventions(Module);
+addLeaksTracking(Module);
+addExportInWorker(Module);
+clearTranslationsCacheOnChange(Module);
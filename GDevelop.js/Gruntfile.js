@@ -12,6 +12,7 @@ module.exports = function (grunt) {
     'debug',
     'debug-assertions',
     'debug-sanitizers',
+    'threads',
   ];
   const variant = grunt.option('variant') || (grunt.option('dev') ? 'dev' : 'release');
 
@@ -24,6 +25,10 @@ module.exports = function (grunt) {
     process.exit(1);
   }
 
+  // Build only the core and some optional modules (see Bindings/modules.js),
+  // for example `--modules=core` or `--modules=core,completion`.
+  const modules = grunt.option('modules') || '';
+
   const buildOutputPath = '../Binaries/embuild/GDevelop.js/';
   const buildPath = '../Binaries/embuild';
 
@@ -93,6 +98,9 @@ module.exports = function (grunt) {
             '../..',
             // Disable link time optimizations for slightly faster build time.
             variant ? '-DGDEVELOPJS_BUILD_VARIANT=' + variant : '',
+            '-DGD_MEMORY_TRACKING=' +
+              (grunt.option('memory-tracking') ? 'TRUE' : 'FALSE'),
+            '-DGDEVELOPJS_MODULES=' + modules.split(',').join('-'),
           ].join(' '),
         options: {
           execOptions: {
@@ -104,8 +112,9 @@ module.exports = function (grunt) {
       },
       // Generate glue.cpp and glue.js file using Bindings.idl, and patch them
       updateGDBindings: {
-        src: 'Bindings/Bindings.idl',
-        command: 'node update-bindings.js',
+        src: ['Bindings/Bindings.idl', 'Bindings/modules.js'],
+        command:
+          'node update-bindings.js' + (modules ? ' --modules=' + modules : ''),
       },
       // Compile GDevelop with emscripten
       make: {
@@ -175,13 +184,15 @@ module.exports = function (grunt) {
   grunt.registerTask('build:raw', [
     'mkdir:embuild',
     'shell:cmake',
-    'newer:shell:updateGDBindings',
+    // The glue of the modules is not the same as the glue of the full library.
+    modules ? 'shell:updateGDBindings' : 'newer:shell:updateGDBindings',
     'shell:make',
   ]);
   grunt.registerTask('build', [
     'shell:syncVersions',
     'build:raw',
-    'shell:copyToNewIDE',
+    // libGD-core.js... is not used by newIDE, it stays in Binaries/embuild.
+    ...(modules ? [] : ['shell:copyToNewIDE']),
     'shell:generateFlowTypes',
     'shell:generateTSTypes',
   ]);
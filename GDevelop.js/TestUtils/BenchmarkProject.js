@@ -0,0 +1,93 @@
+const fs = require('fs');
+
+/**
+ * Create a project with the size of a big real-world game, to be used in
+ * benchmarks: scenes with objects, instances and events using expressions.
+ *
+ * If the `GD_BENCHMARK_PROJECT` environment variable is set to the path of a
+ * game.json file, this project is loaded instead.
+ *
+ * @param {libGDevelop} gd
+ * @param {{scenesCount?: number, objectsCount?: number, instancesCount?: number, eventsCount?: number}} options
+ * @returns {gdProject}
+ */
+const makeBenchmarkProject = (gd, options = {}) => {
+  const projectPath = process.env.GD_BENCHMARK_PROJECT;
+  if (projectPath) {
+    const project = gd.ProjectHelper.createNewGDJSProject();
+    const element = gd.Serializer.fromJSON(
+      fs.readFileSync(projectPath, 'utf8')
+    );
+    project.unserializeFrom(element);
+    element.delete();
+    return project;
+  }
+
+  const scenesCount = options.scenesCount || 20;
+  const objectsCount = options.objectsCount || 50;
+  const instancesCount = options.instancesCount || 500;
+  const eventsCount = options.eventsCount || 200;
+
+  const project = gd.ProjectHelper.createNewGDJSProject();
+  project.setName('Benchmark project');
+  for (let sceneIndex = 0; sceneIndex < scenesCount; sceneIndex++) {
+    const layout = project.insertNewLayout(
+      'Scene' + sceneIndex,
+      project.getLayoutsCount()
+    );
+    layout.getVariables().insertNew('Score', 0).setValue(0);
+
+    for (let objectIndex = 0; objectIndex < objectsCount; objectIndex++) {
+      layout
+        .getObjects()
+        .insertNewObject(
+          project,
+          objectIndex % 2 ? 'TextObject::Text' : 'Sprite',
+          'Object' + objectIndex,
+          objectIndex
+        );
+    }
+
+    const instances = layout.getInitialInstances();
+    for (let instanceIndex = 0; instanceIndex < instancesCount; instanceIndex++) {
+      const instance = instances.insertNewInitialInstance();
+      instance.setObjectName('Object' + (instanceIndex % objectsCount));
+      instance.setX((instanceIndex * 37) % 2000);
+      instance.setY((instanceIndex * 53) % 2000);
+    }
+
+    const events = layout.getEvents();
+    for (let eventIndex = 0; eventIndex < eventsCount; eventIndex++) {
+      const objectName = 'Object' + (eventIndex % objectsCount);
+      const event = gd.asStandardEvent(
+        events.insertNewEvent(
+          project,
+          'BuiltinCommonInstructions::Standard',
+          events.getEventsCount()
+        )
+      );
+
+      const condition = new gd.Instruction();
+      condition.setType('PosX');
+      condition.setParametersCount(3);
+      condition.setParameter(0, objectName);
+      condition.setParameter(1, '>');
+      condition.setParameter(2, 'Score + ' + objectName + '.Y() * 2');
+      event.getConditions().insert(condition, 0);
+      condition.delete();
+
+      const action = new gd.Instruction();
+      action.setType('ModVarScene');
+      action.setParametersCount(3);
+      action.setParameter(0, 'Score');
+      action.setParameter(1, '+');
+      action.setParameter(2, objectName + '.X() + abs(' + eventIndex + ')');
+      event.getActions().insert(action, 0);
+      action.delete();
+    }
+  }
+
+  return project;
+};
+
+module.exports = { makeBenchmarkProject };
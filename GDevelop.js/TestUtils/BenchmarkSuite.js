@@ -7,10 +7,14 @@ const { performance } = require('perf_hooks');
  * Note that this could surely be replaced by a more robust solution like
  * Benchmark.js
  *
- * @param {{benchmarksCount?: number, iterationsCount?: number}} options
+ * If `getMemoryUsage` is given, it's called after each test case to find the
+ * highest memory usage reached by each of them (see `getMemoryHighWaterMarks`).
+ *
+ * @param {{benchmarksCount?: number, iterationsCount?: number, getMemoryUsage?: () => number}} options
  */
 let makeBenchmarkSuite = (options = {}) => {
   const benchmarkTimings = {};
+  const memoryHighWaterMarks = {};
   const benchmarksCount = options.benchmarksCount || 1000;
   const iterationsCount = options.iterationsCount || 100000;
   const testCases = [];
@@ -38,6 +42,12 @@ let makeBenchmarkSuite = (options = {}) => {
         }
         benchmarkTimings[description] = benchmarkTimings[description] || [];
         benchmarkTimings[description].push(performance.now() - start);
+        if (options.getMemoryUsage) {
+          memoryHighWaterMarks[description] = Math.max(
+            memoryHighWaterMarks[description] || 0,
+            options.getMemoryUsage()
+          );
+        }
       });
     }
 
@@ -49,6 +59,11 @@ let makeBenchmarkSuite = (options = {}) => {
     }
     return results;
   };
+  /**
+   * Return the highest memory usage reached after each test case, once
+   * `run` was called.
+   */
+  suite.getMemoryHighWaterMarks = () => memoryHighWaterMarks;
   return suite;
 };
 
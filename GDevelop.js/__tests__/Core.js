@@ -239,6 +239,69 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.LayoutSnapshot', function () {
+    it('shares the unchanged parts and restores a layout', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      layout.getObjects().insertNewObject(project, 'Sprite', 'MyObject', 0);
+      const instance1 = layout.getInitialInstances().insertNewInitialInstance();
+      instance1.setObjectName('MyObject');
+      instance1.setX(10);
+      const instance2 = layout.getInitialInstances().insertNewInitialInstance();
+      instance2.setObjectName('MyObject');
+
+      const snapshot1 = new gd.LayoutSnapshot();
+      snapshot1.take(layout);
+
+      // Instances are recreated when a snapshot is restored.
+      const instance1Uuid = instance1.getPersistentUuid();
+      instance1.setX(20);
+      const changedInstancesUuids = new gd.VectorString();
+      changedInstancesUuids.push_back(instance1Uuid);
+      const snapshot2 = new gd.LayoutSnapshot();
+      snapshot2.takeNext(snapshot1, layout, 0, changedInstancesUuids);
+      expect(
+        snapshot2.isPartSharedWith(snapshot1, gd.LayoutSnapshot.Objects)
+      ).toBe(true);
+      expect(
+        snapshot2.isPartSharedWith(snapshot1, gd.LayoutSnapshot.Instances)
+      ).toBe(false);
+      expect(snapshot2.getSharedInstancesCount(snapshot1)).toBe(1);
+
+      layout.getObjects().removeObject('MyObject');
+      changedInstancesUuids.clear();
+      const snapshot3 = new gd.LayoutSnapshot();
+      snapshot3.takeNext(
+        snapshot2,
+        layout,
+        gd.LayoutSnapshot.Objects,
+        changedInstancesUuids
+      );
+      expect(layout.getObjects().hasObjectNamed('MyObject')).toBe(false);
+
+      snapshot2.restoreTo(project, layout);
+      expect(layout.getObjects().hasObjectNamed('MyObject')).toBe(true);
+      snapshot1.restoreTo(project, layout);
+      expect(layout.getInitialInstances().getInstancesCount()).toBe(2);
+      let restoredX = 0;
+      const functor = new gd.InitialInstanceJSFunctor();
+      functor.invoke = (instancePtr) => {
+        const instance = gd.wrapPointer(instancePtr, gd.InitialInstance);
+        if (instance.getPersistentUuid() === instance1Uuid)
+          restoredX = instance.getX();
+      };
+      layout.getInitialInstances().iterateOverInstances(functor);
+      expect(restoredX).toBe(10);
+
+      functor.delete();
+      changedInstancesUuids.delete();
+      snapshot1.delete();
+      snapshot2.delete();
+      snapshot3.delete();
+      project.delete();
+    });
+  });
+
   describe('gd.Layer', function () {
     it('can have a name and visibility', function () {
       const layer = new gd.Layer();
@@ -741,6 +804,101 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.InitialInstancesBuffer', function () {
+    let container = null;
+    let buffer = null;
+    beforeAll(() => {
+      container = new gd.InitialInstancesContainer();
+      const instance1 = container.insertNewInitialInstance();
+      instance1.setObjectName('MyObject1');
+      instance1.setX(10);
+      instance1.setY(20);
+      instance1.setAngle(45);
+      instance1.setZOrder(3);
+      const instance2 = container.insertNewInitialInstance();
+      instance2.setObjectName('MyObject2');
+      instance2.setLayer('OtherLayer');
+      instance2.setHasCustomSize(true);
+      instance2.setCustomWidth(100);
+      instance2.setCustomHeight(50);
+      instance2.setLocked(true);
+
+      buffer = new gd.InitialInstancesBuffer();
+    });
+
+    it('reads the instances', function () {
+      buffer.readFrom(container);
+      expect(buffer.getInstancesCount()).toBe(2);
+      expect(buffer.getLayersCount()).toBe(2);
+      expect(buffer.getLayerName(0)).toBe('');
+      expect(buffer.getLayerName(1)).toBe('OtherLayer');
+
+      const numbers = buffer.getNumbers();
+      expect(numbers.length).toBe(14);
+      expect(Array.from(numbers.subarray(0, 4))).toEqual([10, 20, 0, 45]);
+      expect(numbers[7 + 4]).toBe(100);
+      expect(numbers[7 + 5]).toBe(50);
+
+      const integers = buffer.getIntegers();
+      expect(Array.from(integers)).toEqual([3, 0, 0, 0, 1, 1 | 2]);
+    });
+
+    it('applies changes to some instances', function () {
+      buffer.readFrom(container);
+      const numbers = buffer.getNumbers();
+      numbers[0] = 15;
+      numbers[7] = 200;
+      numbers[7 + 1] = 300;
+      buffer.getIntegers()[3 + 2] = 2;
+      buffer.setIndexes([1]);
+      buffer.applyToInstances();
+
+      expect(buffer.getInstance(0).getX()).toBe(10);
+      const instance2 = buffer.getInstance(1);
+      expect(instance2.getObjectName()).toBe('MyObject2');
+      expect(instance2.getX()).toBe(200);
+      expect(instance2.getY()).toBe(300);
+      expect(instance2.isLocked()).toBe(false);
+      expect(instance2.hasCustomSize()).toBe(true);
+    });
+
+    it('moves some instances and undoes it', function () {
+      buffer.readFrom(container);
+      buffer.setIndexes([0]);
+      const delta = new gd.InitialInstancesDelta();
+      buffer.recordInstancesBefore(delta);
+      buffer.moveInstances(5, -5, 0);
+      buffer.setInstancesLayer('NewLayer');
+      buffer.changeInstancesZOrder(2);
+      delta.recordAfter();
+
+      const instance1 = buffer.getInstance(0);
+      expect(instance1.getX()).toBe(15);
+      expect(instance1.getY()).toBe(15);
+      expect(instance1.getLayer()).toBe('NewLayer');
+      expect(instance1.getZOrder()).toBe(5);
+      expect(Array.from(buffer.getNumbers().subarray(0, 2))).toEqual([15, 15]);
+      expect(buffer.getLayerName(buffer.getIntegers()[1])).toBe('NewLayer');
+      expect(delta.getInstancesCount()).toBe(1);
+
+      delta.undo(container);
+      expect(instance1.getX()).toBe(10);
+      expect(instance1.getY()).toBe(20);
+      expect(instance1.getLayer()).toBe('');
+      expect(instance1.getZOrder()).toBe(3);
+
+      delta.redo(container);
+      expect(instance1.getX()).toBe(15);
+      expect(instance1.getLayer()).toBe('NewLayer');
+      delta.delete();
+    });
+
+    afterAll(function () {
+      buffer.delete();
+      container.delete();
+    });
+  });
+
   describe('gd.InitialInstance', function () {
     let project = null;
     let layout = null;
@@ -2458,6 +2616,42 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.StringsBuffer', function () {
+    it('can read strings in a batch', function () {
+      const instr = new gd.Instruction();
+      instr.setParametersCount(3);
+      instr.setParameter(0, 'MyObject');
+      instr.setParameter(1, '"Hello wörld 👋"');
+      instr.setParameter(2, 'MyObject');
+
+      const buffer = new gd.StringsBuffer();
+      buffer.addInstructionParameters(instr);
+      buffer.addString('');
+      expect(buffer.getCount()).toBe(4);
+      expect(buffer.getInternedStringsCount()).toBe(3);
+      expect(buffer.toJSArray()).toEqual([
+        'MyObject',
+        '"Hello wörld 👋"',
+        'MyObject',
+        '',
+      ]);
+
+      // Interned strings are kept when the batch is filled again.
+      buffer.clear();
+      buffer.addString('Other');
+      buffer.addString('MyObject');
+      expect(buffer.getInternedStringsCount()).toBe(4);
+      expect(buffer.toJSArray()).toEqual(['Other', 'MyObject']);
+
+      buffer.clearInternedStrings();
+      buffer.addString('New');
+      expect(buffer.toJSArray()).toEqual(['New']);
+
+      buffer.delete();
+      instr.delete();
+    });
+  });
+
   describe('gd.InstructionsList', function () {
     let list = null;
     beforeAll(() => (list = new gd.InstructionsList()));
@@ -3900,6 +4094,21 @@ describe('libGD.js', function () {
         0
       );
     });
+    it('translates errors in the language of the translation function', function () {
+      const previousGetTranslation = gd.getTranslation;
+      try {
+        const message =
+          'You must enter a text (between quotes) or a valid expression call.';
+        gd.getTranslation = (str) => 'Translated: ' + str;
+        testExpression('string', '="Mynewscene"', 'Translated: ' + message, 0);
+
+        // Translated strings are cached, but not across translation functions.
+        gd.getTranslation = (str) => 'Traduit : ' + str;
+        testExpression('string', '="Mynewscene"', 'Traduit : ' + message, 0);
+      } finally {
+        gd.getTranslation = previousGetTranslation;
+      }
+    });
     it('report errors in invalid expressions ("number|string" type)', function () {
       testExpression(
         'number|string',
@@ -4220,6 +4429,37 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.PlatformSnapshot', function () {
+    it('can restore the extensions declared for a project', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      project.insertNewEventsFunctionsExtension('MyEventsExtension', 0);
+      const key = gd.PlatformSnapshot.computeKey(project);
+      expect(gd.PlatformSnapshot.computeKey(project)).toBe(key);
+
+      const extension = new gd.PlatformExtension();
+      extension.setExtensionInformation('MyEventsExtension', '', '', '', '');
+      gd.JsPlatform.get().addNewExtension(extension);
+      extension.delete();
+
+      const snapshot = new gd.PlatformSnapshot();
+      snapshot.take(gd.JsPlatform.get(), key);
+      gd.JsPlatform.get().removeExtension('MyEventsExtension');
+
+      expect(snapshot.restore(gd.JsPlatform.get(), 'Another key')).toBe(false);
+      expect(
+        gd.JsPlatform.get().isExtensionLoaded('MyEventsExtension')
+      ).toBe(false);
+      expect(snapshot.restore(gd.JsPlatform.get(), key)).toBe(true);
+      expect(
+        gd.JsPlatform.get().isExtensionLoaded('MyEventsExtension')
+      ).toBe(true);
+
+      gd.JsPlatform.get().removeExtension('MyEventsExtension');
+      snapshot.delete();
+      project.delete();
+    });
+  });
+
   describe('gd.ParameterMetadata', function () {
     it('can tell the type of a parameter', function () {
       expect(gd.ParameterMetadata.isObject('object')).toBe(true);
@@ -0,0 +1,200 @@
+const fs = require('fs');
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+const { makeBenchmarkSuite } = require('../TestUtils/BenchmarkSuite.js');
+const { makeBenchmarkProject } = require('../TestUtils/BenchmarkProject.js');
+const {
+  makeFakeAbstractFileSystem,
+} = require('../TestUtils/FakeAbstractFileSystem.js');
+
+// Benchmarks of the operations done by the editor, through the JS API.
+// Run them with `GD_BENCHMARK=1 npx jest EditorOperationsBenchmark`, and set
+// `GD_BENCHMARK_OUTPUT` to the path of a file to write the results (as JSON)
+// to compare them between changes. Set `GD_BENCHMARK_PROJECT` to the path of
+// a game.json file to use it instead of the generated project.
+const describeBenchmark = process.env.GD_BENCHMARK ? describe : describe.skip;
+
+describeBenchmark('libGD.js editor operations benchmarks', function () {
+  let gd = null;
+  let project = null;
+  const results = {};
+
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+    project = makeBenchmarkProject(gd);
+  });
+
+  afterAll(() => {
+    if (project) project.delete();
+
+    results.heapSize = gd.getHeapSize();
+    if (gd.MemoryTracker.isEnabled())
+      results.memoryTracker = JSON.parse(gd.MemoryTracker.toJSON());
+
+    console.log(JSON.stringify(results, null, 2));
+    if (process.env.GD_BENCHMARK_OUTPUT) {
+      fs.writeFileSync(
+        process.env.GD_BENCHMARK_OUTPUT,
+        JSON.stringify(results, null, 2)
+      );
+    }
+  });
+
+  const runBenchmarkSuite = (name, benchmarkSuite) => {
+    results[name] = {
+      timings: benchmarkSuite.run(),
+      heapHighWaterMarks: benchmarkSuite.getMemoryHighWaterMarks(),
+    };
+  };
+
+  const makeSuite = (iterationsCount) =>
+    makeBenchmarkSuite({
+      benchmarksCount: 3,
+      iterationsCount,
+      getMemoryUsage: () => gd.getHeapSize(),
+    });
+
+  it('benchmarks loading and saving the project', function () {
+    const element = new gd.SerializerElement();
+    project.serializeTo(element);
+    const json = gd.Serializer.toJSON(element);
+    element.delete();
+
+    runBenchmarkSuite(
+      'project load and save',
+      makeSuite(3)
+        .add('save (serializeTo + toJSON)', () => {
+          const element = new gd.SerializerElement();
+          project.serializeTo(element);
+          gd.Serializer.toJSON(element);
+          element.delete();
+        })
+        .add('load (fromJSON + unserializeFrom)', () => {
+          const element = gd.Serializer.fromJSON(json);
+          const loadedProject = gd.ProjectHelper.createNewGDJSProject();
+          loadedProject.unserializeFrom(element);
+          loadedProject.delete();
+          element.delete();
+        })
+    );
+  });
+
+  it('benchmarks the export for preview', function () {
+    const fileSystem = makeFakeAbstractFileSystem(gd, {});
+    const exporter = new gd.Exporter(fileSystem, '/fake-gdjs-root');
+
+    runBenchmarkSuite(
+      'exportProjectForPixiPreview',
+      makeSuite(2).add('export Scene0 for preview', () => {
+        const previewExportOptions = new gd.PreviewExportOptions(
+          project,
+          '/fake-export-dir'
+        );
+        previewExportOptions.setLayoutName('Scene0');
+        exporter.exportProjectForPixiPreview(previewExportOptions);
+        previewExportOptions.delete();
+      })
+    );
+
+    exporter.delete();
+    fileSystem.delete();
+  });
+
+  it('benchmarks renaming an object in the whole project', function () {
+    const layout = project.getLayout('Scene0');
+
+    runBenchmarkSuite(
+      'whole project rename',
+      makeSuite(2).add('rename Object0 (and back)', () => {
+        gd.WholeProjectRefactorer.objectOrGroupRenamedInScene(
+          project,
+          layout,
+          'Object0',
+          'RenamedObject0',
+          /* isObjectGroup=*/ false
+        );
+        gd.WholeProjectRefactorer.objectOrGroupRenamedInScene(
+          project,
+          layout,
+          'RenamedObject0',
+          'Object0',
+          /* isObjectGroup=*/ false
+        );
+      })
+    );
+  });
+
+  it('benchmarks the validation and the completion of expressions', function () {
+    const layout = project.getLayout('Scene0');
+    const projectScopedContainers = gd.ProjectScopedContainers.makeNewProjectScopedContainersForProjectAndLayout(
+      project,
+      layout
+    );
+    const expression = 'Score + Object1.X() * abs(Object2.Variable(Speed)) + Obj';
+    const parser = new gd.ExpressionParser2();
+
+    runBenchmarkSuite(
+      'expressions',
+      makeSuite(200)
+        .add('parse and validate', () => {
+          const expressionNode = parser.parseExpression(expression).get();
+          const expressionValidator = new gd.ExpressionValidator(
+            gd.JsPlatform.get(),
+            projectScopedContainers,
+            'number',
+            ''
+          );
+          expressionNode.visit(expressionValidator);
+          expressionValidator.getAllErrors().size();
+          expressionValidator.delete();
+        })
+        .add('parse and complete', () => {
+          const expressionNode = parser.parseExpression(expression).get();
+          const completionDescriptions = gd.ExpressionCompletionFinder.getCompletionDescriptionsFor(
+            gd.JsPlatform.get(),
+            projectScopedContainers,
+            'number',
+            expressionNode,
+            expression.length - 1
+          );
+          completionDescriptions.size();
+          completionDescriptions.delete();
+        })
+    );
+
+    parser.delete();
+  });
+
+  it('benchmarks the formatting of the sentences of an events sheet', function () {
+    const events = project.getLayout('Scene0').getEvents();
+    const formatter = gd.InstructionSentenceFormatter.get();
+
+    const formatInstructions = (instructions, getMetadata) => {
+      for (let i = 0; i < instructions.size(); i++) {
+        const instruction = instructions.get(i);
+        const formattedTexts = formatter.getAsFormattedText(
+          instruction,
+          getMetadata(gd.JsPlatform.get(), instruction.getType())
+        );
+        formattedTexts.size();
+        formattedTexts.delete();
+      }
+    };
+
+    runBenchmarkSuite(
+      'events-sheet sentences',
+      makeSuite(3).add('format all the instructions of Scene0', () => {
+        for (let i = 0; i < events.getEventsCount(); i++) {
+          const event = gd.asStandardEvent(events.getEventAt(i));
+          formatInstructions(
+            event.getConditions(),
+            gd.MetadataProvider.getConditionMetadata
+          );
+          formatInstructions(
+            event.getActions(),
+            gd.MetadataProvider.getActionMetadata
+          );
+        }
+      })
+    );
+  });
+});
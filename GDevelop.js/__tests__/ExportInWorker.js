@@ -0,0 +1,112 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+
+/**
+ * Create two connected ends of a fake message channel, standing for the
+ * editor and the worker. Messages are delivered asynchronously.
+ */
+const makeFakeMessageChannel = () => {
+  const makePort = () => ({
+    listeners: [],
+    otherPort: null,
+    addEventListener(type, listener) {
+      this.listeners.push(listener);
+    },
+    removeEventListener(type, listener) {
+      this.listeners = this.listeners.filter((l) => l !== listener);
+    },
+    postMessage(data) {
+      const otherPort = this.otherPort;
+      setImmediate(() => {
+        otherPort.listeners.forEach((listener) => listener({ data }));
+      });
+    },
+  });
+
+  const port1 = makePort();
+  const port2 = makePort();
+  port1.otherPort = port2;
+  port2.otherPort = port1;
+  return { port1, port2 };
+};
+
+describe('libGD.js export in a worker', function () {
+  let gd = null;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+  });
+
+  it('serializes and unserializes a project snapshot', function () {
+    const project = gd.ProjectHelper.createNewGDJSProject();
+    project.setName('My game');
+    project.insertNewLayout('Scene', 0);
+
+    const data = gd.serializeProjectForWorker(project);
+    expect(data instanceof ArrayBuffer).toBe(true);
+
+    const unserializedProject = gd.unserializeProjectFromWorker(data);
+    expect(unserializedProject.getName()).toBe('My game');
+    expect(unserializedProject.hasLayoutNamed('Scene')).toBe(true);
+
+    unserializedProject.delete();
+    project.delete();
+  });
+
+  it('exports a layout for preview and streams the written files', async function () {
+    const { port1: editorPort, port2: workerPort } = makeFakeMessageChannel();
+    const onProjectLoaded = jest.fn();
+    const stopHandling = gd.handleExportRequestsInWorker(workerPort, {
+      onProjectLoaded,
+    });
+
+    const project = gd.ProjectHelper.createNewGDJSProject();
+    project.insertNewLayout('Scene', 0);
+
+    const writtenFiles = {};
+    const result = await gd.exportInWorker(
+      editorPort,
+      {
+        project,
+        exportType: 'preview',
+        outputPath: '/path/for/export',
+        gdjsRoot: 'fake-gdjs-root',
+        options: { layoutName: 'Scene' },
+      },
+      {
+        writeToFile: (filePath, content) => {
+          writtenFiles[filePath] = content;
+        },
+      }
+    );
+    project.delete();
+    stopHandling();
+
+    expect(result.succeeded).toBe(true);
+    expect(onProjectLoaded).toHaveBeenCalledTimes(1);
+    const code = Object.keys(writtenFiles)
+      .map((filePath) => writtenFiles[filePath])
+      .join('\n');
+    expect(code).toMatch('runtimeScene.getOnceTriggers().startNewFrame');
+  });
+
+  it('reports unknown export options', async function () {
+    const { port1: editorPort, port2: workerPort } = makeFakeMessageChannel();
+    const stopHandling = gd.handleExportRequestsInWorker(workerPort);
+
+    const project = gd.ProjectHelper.createNewGDJSProject();
+    const result = await gd.exportInWorker(
+      editorPort,
+      {
+        project,
+        exportType: 'preview',
+        outputPath: '/path/for/export',
+        options: { notAnOption: true },
+      },
+      {}
+    );
+    project.delete();
+    stopHandling();
+
+    expect(result.succeeded).toBe(false);
+    expect(result.error).toMatch('notAnOption');
+  });
+});
@@ -243,6 +243,138 @@ describe('libGD.js - GDJS related tests', function () {
       // Trigger once is used in a condition
       expect(code).toMatch('runtimeScene.getOnceTriggers().triggerOnce');
     });
+    it('can report the size of the code generated for the groups', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      layout.getObjects().insertNewObject(project, 'Sprite', 'MyObject', 0);
+      const group = layout
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Group', 0);
+      gd.asGroupEvent(group).setName('My group');
+      const evt = group
+        .getSubEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      const action = new gd.Instruction();
+      action.setType('Delete');
+      action.setParametersCount(2);
+      action.setParameter(0, 'MyObject');
+      gd.asStandardEvent(evt).getActions().insert(action, 0);
+      action.delete();
+
+      const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+      layoutCodeGenerator.setGenerateEventsProfiling(true);
+      const codeGenerationReport = new gd.CodeGenerationReport();
+      layoutCodeGenerator.setCodeGenerationReport(codeGenerationReport);
+      const diagnosticReport = new gd.DiagnosticReport();
+      layoutCodeGenerator.generateLayoutCompleteCode(
+        layout,
+        new gd.SetString(),
+        diagnosticReport,
+        true
+      );
+      const { entries } = JSON.parse(codeGenerationReport.toJSON());
+      diagnosticReport.delete();
+      codeGenerationReport.delete();
+      layoutCodeGenerator.delete();
+      project.delete();
+
+      expect(entries.length).toBe(2);
+      expect(entries[0].type).toBe('scene');
+      expect(entries[0].name).toBe('Scene');
+      expect(entries[0].parent).toBe(-1);
+      expect(entries[1].type).toBe('eventsGroup');
+      expect(entries[1].name).toBe('My group');
+      expect(entries[1].parent).toBe(0);
+      expect(entries[1].profilerSectionId).toBe(0);
+      expect(entries[1].objectListsCopied).toBeGreaterThan(0);
+      expect(entries[1].codeSize).toBeGreaterThan(0);
+      expect(entries[1].codeSize).toBeLessThan(entries[0].codeSize);
+    });
+    it('can report the size of the code generated for behavior functions', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const eventsFunctionsExtension = project.insertNewEventsFunctionsExtension(
+        'MyExtension',
+        0
+      );
+      const eventsBasedBehavior = eventsFunctionsExtension
+        .getEventsBasedBehaviors()
+        .insertNew('MyBehavior', 0);
+      eventsBasedBehavior
+        .getEventsFunctions()
+        .insertNewEventsFunction('doStepPreEvents', 0);
+      gd.WholeProjectRefactorer.ensureBehaviorEventsFunctionsProperParameters(
+        eventsFunctionsExtension,
+        eventsBasedBehavior
+      );
+
+      const behaviorCodeGenerator = new gd.BehaviorCodeGenerator(project);
+      const codeGenerationReport = new gd.CodeGenerationReport();
+      behaviorCodeGenerator.setCodeGenerationReport(codeGenerationReport);
+      const behaviorMethodMangledNames = new gd.MapStringString();
+      behaviorMethodMangledNames.set('doStepPreEvents', 'doStepPreEvents');
+      const includeFiles = new gd.SetString();
+      behaviorCodeGenerator.generateRuntimeBehaviorCompleteCode(
+        eventsFunctionsExtension,
+        eventsBasedBehavior,
+        'gdjs.evtsExt__MyExtension__MyBehavior',
+        behaviorMethodMangledNames,
+        includeFiles,
+        true
+      );
+      const { entries } = JSON.parse(codeGenerationReport.toJSON());
+      includeFiles.delete();
+      behaviorMethodMangledNames.delete();
+      codeGenerationReport.delete();
+      behaviorCodeGenerator.delete();
+      project.delete();
+
+      expect(entries.length).toBe(1);
+      expect(entries[0].type).toBe('eventsFunction');
+      expect(entries[0].name).toBe('MyExtension::MyBehavior::doStepPreEvents');
+      expect(entries[0].parent).toBe(-1);
+      expect(entries[0].codeSize).toBeGreaterThan(0);
+    });
+    it('only declares the objects lists used by the events', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      layout.getObjects().insertNewObject(project, 'Sprite', 'MyObject', 0);
+      layout
+        .getObjects()
+        .insertNewObject(project, 'Sprite', 'MyUnusedObject', 0);
+      const evt = layout
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      const action = new gd.Instruction();
+      action.setType('ChangeAnimation');
+      action.setParametersCount(4);
+      action.setParameter(0, 'MyObject');
+      action.setParameter(1, '=');
+      action.setParameter(2, '2');
+      gd.asStandardEvent(evt).getActions().insert(action, 0);
+      action.delete();
+
+      const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+      const diagnosticReport = new gd.DiagnosticReport();
+      const code = layoutCodeGenerator.generateLayoutCompleteCode(
+        layout,
+        new gd.SetString(),
+        diagnosticReport,
+        true
+      );
+      diagnosticReport.delete();
+      layoutCodeGenerator.delete();
+      project.delete();
+
+      expect(code).toMatch('gdjs.SceneCode.GDMyObjectObjects1= [];');
+      expect(code).toEqual(
+        expect.not.stringContaining('GDMyUnusedObjectObjects')
+      );
+
+      // The list is only reset once, at the end of the events.
+      expect(
+        code.split('gdjs.SceneCode.GDMyObjectObjects1.length = 0;').length
+      ).toBe(2);
+    });
     it('does not generate code for improperly set up actions/conditions', function () {
       const project = gd.ProjectHelper.createNewGDJSProject();
       const layout = project.insertNewLayout('Scene', 0);
@@ -338,10 +470,24 @@ describe('libGD.js - GDJS related tests', function () {
         diagnosticReport,
         true
       );
+
+      // Compact code is generated without the comments.
+      layoutCodeGenerator.setGenerateCompactCode(true);
+      const compactCode = layoutCodeGenerator.generateLayoutCompleteCode(
+        layout,
+        new gd.SetString(),
+        diagnosticReport,
+        true
+      );
       diagnosticReport.delete();
       layoutCodeGenerator.delete();
       project.delete();
 
+      expect(compactCode).toMatch(
+        'gdjs.SceneCode.GDMyObjectObjects1[i].setAnimation(2);'
+      );
+      expect(compactCode).toEqual(expect.not.stringContaining('/*'));
+
       // Animation is set to 2 for MyObject
       expect(code).toMatch(
         'gdjs.SceneCode.GDMyObjectObjects1[i].setAnimation(2);'
@@ -657,6 +803,51 @@ describe('libGD.js - GDJS related tests', function () {
 
       action.delete();
     });
+
+    it('computes keys changing only with what is used by the code', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const extension = project.insertNewEventsFunctionsExtension(
+        'MyExtension',
+        0
+      );
+      const otherExtension = project.insertNewEventsFunctionsExtension(
+        'MyOtherExtension',
+        1
+      );
+      const otherEventsFunction = otherExtension
+        .getEventsFunctions()
+        .insertNewEventsFunction('MyOtherFunction', 0);
+
+      const computeKey = () =>
+        gd.EventsFunctionsExtensionCodeGenerator.computeExtensionCodeKey(
+          extension,
+          gd.EventsFunctionsExtensionCodeGenerator.computeProjectExtensionsDeclarationsKey(
+            project
+          )
+        );
+      const key = computeKey();
+      expect(computeKey()).toBe(key);
+
+      // The events of other extensions are not used by the code.
+      otherEventsFunction
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      expect(computeKey()).toBe(key);
+
+      // Their declarations are.
+      otherEventsFunction.setFullName('My other function');
+      const keyWithOtherDeclarations = computeKey();
+      expect(keyWithOtherDeclarations).not.toBe(key);
+
+      extension
+        .getEventsFunctions()
+        .insertNewEventsFunction('MyFunction', 0)
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      expect(computeKey()).not.toBe(keyWithOtherDeclarations);
+
+      project.delete();
+    });
   });
 
   describe('TextObject', function () {
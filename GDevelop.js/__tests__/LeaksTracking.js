@@ -0,0 +1,61 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+
+describe('libGD.js leaks tracking', function () {
+  let gd = null;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+  });
+
+  afterEach(() => {
+    gd.stopLeaksTracking();
+  });
+
+  it('reports the objects that are not deleted', function () {
+    gd.startLeaksTracking();
+
+    const element = new gd.SerializerElement();
+    const deletedElement = new gd.SerializerElement();
+    deletedElement.delete();
+
+    const leakedObjects = gd.getLeakedObjects();
+    expect(leakedObjects.length).toBe(1);
+    expect(leakedObjects[0].className).toBe('SerializerElement');
+    expect(leakedObjects[0].ptr).toBe(element.ptr);
+    expect(leakedObjects[0].stack).toContain('LeaksTracking.js');
+
+    element.delete();
+    expect(gd.getLeakedObjects().length).toBe(0);
+  });
+
+  it('reports the objects created after a checkpoint', function () {
+    gd.startLeaksTracking({ captureStacks: false });
+
+    const container = new gd.InitialInstancesContainer();
+    const checkpoint = gd.addLeaksTrackingCheckpoint();
+    const clonedContainer = container.clone();
+
+    expect(gd.getLeakedObjects().length).toBe(2);
+    const leakedObjects = gd.getLeakedObjects(checkpoint);
+    expect(leakedObjects.length).toBe(1);
+    expect(leakedObjects[0].className).toBe('InitialInstancesContainer');
+    expect(leakedObjects[0].ptr).toBe(clonedContainer.ptr);
+    expect(leakedObjects[0].stack).toBe('');
+
+    gd.destroy(clonedContainer);
+    container.delete();
+    expect(gd.getLeakedObjects().length).toBe(0);
+  });
+
+  it('keeps the classes usable', function () {
+    gd.startLeaksTracking();
+
+    const layout = new gd.Layout();
+    expect(layout instanceof gd.Layout).toBe(true);
+    expect(gd.castObject(layout, gd.Layout).ptr).toBe(layout.ptr);
+    expect(gd.Object).toBe(gd.gdObject);
+    layout.delete();
+
+    gd.stopLeaksTracking();
+    expect(gd.getLeakedObjects()).toEqual([]);
+  });
+});
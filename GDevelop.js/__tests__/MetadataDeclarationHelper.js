@@ -1652,6 +1652,14 @@ describe('MetadataDeclarationHelper', () => {
         )
       ).toBe('The speed is greater than 2 pixels per second');
     });
+    it('can shift parameters next to an ill-formed one', () => {
+      expect(
+        gd.MetadataDeclarationHelper.shiftSentenceParamIndexes(
+          '_PARAM_PARAM2_ and _PARAM3_PARAM4_',
+          2
+        )
+      ).toBe('_PARAM_PARAM4_ and _PARAM5_PARAM4_');
+    });
     [2, 0, -2].forEach((indexOffset) => {
       it(`can shift 1 parameter by ${indexOffset}`, () => {
         expect(
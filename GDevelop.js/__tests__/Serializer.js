@@ -140,5 +140,31 @@ describe('libGD.js object serialization', function() {
       checkJsonParseAndStringify('[{"a":1},2]');
       checkJsonParseAndStringify('{"7":[],"a":[1,2,{"b":3},{"c":[4,5]},6]}');
     });
+    it('should convert attributes and all kinds of values', function() {
+      const element = new gd.SerializerElement();
+      element.setStringAttribute('attr', 'value');
+      element.addChild('int').setIntValue(-123456);
+      element.addChild('double').setDoubleValue(1.5);
+      element.addChild('bool').setBoolValue(false);
+      element.addChild('empty');
+
+      expect(gd.Serializer.toJSObject(element)).toEqual({
+        attr: 'value',
+        int: -123456,
+        double: 1.5,
+        bool: false,
+        empty: {},
+      });
+      element.delete();
+    });
+    it('should keep strings with null characters', function() {
+      const element = gd.Serializer.fromJSObject({
+        'key\u0000with null': 'a\u0000b\u0000',
+      });
+      expect(gd.Serializer.toJSObject(element)).toEqual({
+        'key\u0000with null': 'a\u0000b\u0000',
+      });
+      element.delete();
+    });
   });
 });
@@ -84,6 +84,12 @@ const extraClassAttributes = {
     'static fromJSObject(object: Object): gdSerializerElement;',
     'static toJSObject(element: gdSerializerElement): any;',
   ],
+  InitialInstancesBuffer: [
+    'getNumbers(): Float64Array;',
+    'getIntegers(): Int32Array;',
+    'setIndexes(indexes: Array<number>): void;',
+  ],
+  StringsBuffer: ['toJSArray(): Array<string>;'],
 };
 
 const PrimitiveTypes = new Map([
@@ -453,6 +459,94 @@ export function compare<T extends EmscriptenObject>(object1: T, object2: T): boo
  */
 export function destroy(object: EmscriptenObject): void;
 
+/**
+ * Return the size of the memory of the module, in bytes. The memory can only grow,
+ * so this is also the highest memory used until now.
+ */
+export function getHeapSize(): number;
+
+type LeakedObject = {
+  className: string;
+  ptr: number;
+  checkpoint: number;
+  stack: string;
+};
+
+/**
+ * Start to record the objects created with `new` (or `clone`), which must be deleted.
+ * Must be called before the objects to track are created. This is slow and only
+ * meant to find the objects that are never deleted.
+ */
+export function startLeaksTracking(options?: { captureStacks?: boolean }): void;
+
+/**
+ * Stop to record the objects, and forget the objects recorded.
+ */
+export function stopLeaksTracking(): void;
+
+/**
+ * Add a checkpoint, to later get only the objects created after it.
+ */
+export function addLeaksTrackingCheckpoint(): number;
+
+/**
+ * Return the objects created after the checkpoint (or since the start of the tracking)
+ * that are still not deleted.
+ */
+export function getLeakedObjects(sinceCheckpoint?: number): Array<LeakedObject>;
+
+type ExportInWorkerRequest = {
+  exportType: 'preview' | 'whole';
+  outputPath: string;
+  gdjsRoot?: string;
+  /** The project to export, serialized when the export is started. */
+  project?: Project;
+  /** The project, already serialized with `serializeProjectForWorker`. It is transferred to the worker. */
+  projectData?: ArrayBuffer;
+  /** Values given to the setters of the export options, like `{ layoutName: 'Scene' }`. */
+  options?: Record<string, any>;
+  /** The content of the files that can be read by the exporter. */
+  fileContents?: Record<string, string>;
+  codeOutputDirectory?: string;
+  codeGenerationThreadsCount?: number;
+};
+
+type ExportInWorkerResult = {
+  succeeded: boolean;
+  error: string;
+  metrics: string;
+};
+
+/**
+ * Return the snapshot of a project to send to a worker, as an ArrayBuffer that can be transferred.
+ */
+export function serializeProjectForWorker(project: Project): ArrayBuffer;
+
+/**
+ * Create a project from a snapshot returned by `serializeProjectForWorker`. The project must be deleted.
+ */
+export function unserializeProjectFromWorker(data: ArrayBuffer): Project;
+
+/**
+ * Answer the export requests sent by `exportInWorker` to `scope` (the global scope of a worker,
+ * or a MessagePort). Return a function to stop answering the requests.
+ */
+export function handleExportRequestsInWorker(
+  scope: any,
+  options?: { onProjectLoaded?: (project: Project) => void }
+): () => void;
+
+/**
+ * Export a project in a worker, without blocking the current thread. The operations
+ * done on the file system by the exporter are streamed to `fileSystem`, with the same
+ * names and arguments as the methods of `AbstractFileSystemJS`.
+ */
+export function exportInWorker(
+  worker: any,
+  request: ExportInWorkerRequest,
+  fileSystem: Record<string, (...args: any[]) => any>
+): Promise<ExportInWorkerResult>;
+
 export as namespace gd;
 
 declare global {
@@ -262,6 +262,26 @@ type CustomObjectConfiguration_EdgeAnchor = 0 | 1 | 2 | 3 | 4`
       ].join('\n'),
       'types/gdcustomobjectconfiguration.js'
     );
+    fs.writeFileSync(
+      'types/layoutsnapshot_part.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type LayoutSnapshot_Part = 1 | 2 | 4 | 8 | 16 | 32 | 63`
+    );
+    shell.sed(
+      '-i',
+      'declare class gdLayoutSnapshot {',
+      [
+        'declare class gdLayoutSnapshot {',
+        '  static Settings: 1;',
+        '  static Variables: 2;',
+        '  static Instances: 4;',
+        '  static Objects: 8;',
+        '  static Events: 16;',
+        '  static Layers: 32;',
+        '  static AllParts: 63;',
+      ].join('\n'),
+      'types/gdlayoutsnapshot.js'
+    );
 
     // Add convenience methods that are manually added (see postjs.js):
     shell.sed(
@@ -309,6 +329,18 @@ type CustomObjectConfiguration_EdgeAnchor = 0 | 1 | 2 | 3 | 4`
         '',
         `  asImageResource(gdResource): gdImageResource;`,
         '',
+        '  getHeapSize(): number;',
+        '',
+        '  startLeaksTracking(options?: {| captureStacks?: boolean |}): void;',
+        '  stopLeaksTracking(): void;',
+        '  addLeaksTrackingCheckpoint(): number;',
+        '  getLeakedObjects(sinceCheckpoint?: number): Array<{| className: string, ptr: number, checkpoint: number, stack: string |}>;',
+        '',
+        '  serializeProjectForWorker(project: gdProject): ArrayBuffer;',
+        '  unserializeProjectFromWorker(data: ArrayBuffer): gdProject;',
+        '  handleExportRequestsInWorker(scope: any, options?: {| onProjectLoaded?: (project: gdProject) => void |}): () => void;',
+        `  exportInWorker(worker: any, request: {| exportType: 'preview' | 'whole', outputPath: string, gdjsRoot?: string, project?: gdProject, projectData?: ArrayBuffer, options?: Object, fileContents?: {[string]: string}, codeOutputDirectory?: string, codeGenerationThreadsCount?: number |}, fileSystem: Object): Promise<{| succeeded: boolean, error: string, metrics: string |}>;`,
+        '',
       ].join('\n'),
       'types/libgdevelop.js'
     );
@@ -333,6 +365,22 @@ type CustomObjectConfiguration_EdgeAnchor = 0 | 1 | 2 | 3 | 4`
 `,
       'types/gdserializer.js'
     );
+    shell.sed(
+      '-i',
+      'declare class gdInitialInstancesBuffer {',
+      `declare class gdInitialInstancesBuffer {
+  getNumbers(): Float64Array;
+  getIntegers(): Int32Array;
+  setIndexes(indexes: Array<number>): void;
+`,
+      'types/gdinitialinstancesbuffer.js'
+    );
+    shell.sed(
+      '-i',
+      'declare class gdStringsBuffer {',
+      'declare class gdStringsBuffer {\n  toJSArray(): Array<string>;',
+      'types/gdstringsbuffer.js'
+    );
     shell.sed(
       '-i',
       'declare class gdInstructionsList {',
@@ -70,6 +70,16 @@ export enum QuickCustomization_Visibility {
   Hidden = 2,
 }
 
+export enum LayoutSnapshot_Part {
+  Settings = 1,
+  Variables = 2,
+  Instances = 4,
+  Objects = 8,
+  Events = 16,
+  Layers = 32,
+  AllParts = 63,
+}
+
 export enum ProjectDiagnostic_ErrorType {
   UndeclaredVariable = 0,
   MissingBehavior = 1,
@@ -244,6 +254,15 @@ export class EventsFunctionSelfCallChecker extends EmscriptenObject {
   static isObjectFunctionOnlyCallingItself(project: Project, extension: EventsFunctionsExtension, eventsBasedObject: EventsBasedObject, eventsFunction: EventsFunction): boolean;
 }
 
+export class EventsFunctionsCallGraph extends EmscriptenObject {
+  constructor();
+  build(project: Project): void;
+  updateExtension(project: Project, eventsFunctionsExtension: EventsFunctionsExtension): void;
+  removeExtension(extensionName: string): void;
+  hasFunction(functionFullType: string): boolean;
+  isRecursive(functionFullType: string): boolean;
+}
+
 export class InstructionOrExpressionGroupMetadata extends EmscriptenObject {
   constructor();
   setIcon(icon: string): InstructionOrExpressionGroupMetadata;
@@ -267,6 +286,8 @@ export class Platform extends EmscriptenObject {
   getInstructionOrExpressionGroupMetadata(name: string): InstructionOrExpressionGroupMetadata;
   isExtensionLoaded(name: string): boolean;
   removeExtension(name: string): void;
+  getExtensionToUpdate(name: string): PlatformExtension;
+  notifyExtensionChanged(name: string): void;
   reloadBuiltinExtensions(): void;
   getAllPlatformExtensions(): VectorPlatformExtension;
 }
@@ -281,10 +302,21 @@ export class JsPlatform extends EmscriptenObject {
   getInstructionOrExpressionGroupMetadata(name: string): InstructionOrExpressionGroupMetadata;
   isExtensionLoaded(name: string): boolean;
   removeExtension(name: string): void;
+  getExtensionToUpdate(name: string): PlatformExtension;
+  notifyExtensionChanged(name: string): void;
   reloadBuiltinExtensions(): void;
   getAllPlatformExtensions(): VectorPlatformExtension;
 }
 
+export class PlatformSnapshot extends EmscriptenObject {
+  constructor();
+  static computeKey(project: Project): string;
+  take(platform: Platform, key: string): void;
+  restore(platform: Platform, key: string): boolean;
+  getKey(): string;
+  clear(): void;
+}
+
 export class PairStringVariable extends EmscriptenObject {
   constructor();
   getName(): string;
@@ -741,6 +773,8 @@ export class gdObject extends EmscriptenObject {
   getName(): string;
   setAssetStoreId(assetStoreId: string): void;
   getAssetStoreId(): string;
+  setInstancesPoolSize(instancesPoolSize: number): void;
+  getInstancesPoolSize(): number;
   setType(type: string): void;
   getType(): string;
   getConfiguration(): ObjectConfiguration;
@@ -1224,6 +1258,50 @@ export class InitialInstancesContainer extends EmscriptenObject {
   unserializeFrom(element: SerializerElement): void;
 }
 
+export class InitialInstancesDelta extends EmscriptenObject {
+  constructor();
+  recordAfter(): void;
+  isEmpty(): boolean;
+  getInstancesCount(): number;
+  undo(container: InitialInstancesContainer): void;
+  redo(container: InitialInstancesContainer): void;
+  serializeTo(element: SerializerElement): void;
+  unserializeFrom(element: SerializerElement): void;
+}
+
+export class InitialInstancesBuffer extends EmscriptenObject {
+  constructor();
+  readFrom(container: InitialInstancesContainer): void;
+  applyToInstances(): void;
+  moveInstances(deltaX: number, deltaY: number, deltaZ: number): void;
+  rotateInstances(angle: number, pivotX: number, pivotY: number): void;
+  setInstancesLayer(layerName: string): void;
+  changeInstancesZOrder(offset: number): void;
+  recordInstancesBefore(delta: InitialInstancesDelta): void;
+  getInstancesCount(): number;
+  getInstance(index: number): InitialInstance;
+  getLayersCount(): number;
+  getLayerName(index: number): string;
+  setIndexesCount(count: number): void;
+  getNumbersPointer(): number;
+  getIntegersPointer(): number;
+  getIndexesPointer(): number;
+  getNumbers(): Float64Array;
+  getIntegers(): Int32Array;
+  setIndexes(indexes: Array<number>): void;
+}
+
+export class LayoutSnapshot extends EmscriptenObject {
+  constructor();
+  take(layout: Layout): void;
+  takeNext(previous: LayoutSnapshot, layout: Layout, changedParts: number, changedInstancesUuids: VectorString): void;
+  isEmpty(): boolean;
+  restoreTo(project: Project, layout: Layout): void;
+  serializeTo(element: SerializerElement): void;
+  isPartSharedWith(other: LayoutSnapshot, part: LayoutSnapshot_Part): boolean;
+  getSharedInstancesCount(other: LayoutSnapshot): number;
+}
+
 export class HighestZOrderFinder extends EmscriptenObject {
   constructor();
   restrictSearchToLayer(layer: string): void;
@@ -1296,10 +1374,66 @@ export class Serializer extends EmscriptenObject {
   static toJSObject(element: gdSerializerElement): any;
 }
 
+export class SerializerBinaryBuffer extends EmscriptenObject {
+  constructor();
+  serializeFrom(element: SerializerElement): void;
+  unserializeTo(element: SerializerElement): void;
+  resize(size: number): void;
+  getSize(): number;
+  getDataPointer(): number;
+}
+
+export class MemoryTracker extends EmscriptenObject {
+  static isEnabled(): boolean;
+  static toJSON(): string;
+}
+
+export class PerfScope extends EmscriptenObject {
+  static enable(enable: boolean): void;
+  static isEnabled(): boolean;
+  static reset(): void;
+  static getCounter(name: string): number;
+  static getCallsCount(path: string): number;
+  static getTotalDuration(path: string): number;
+  static toJSON(): string;
+}
+
+export class TranslationsCache extends EmscriptenObject {
+  static clear(): void;
+}
+
+export class LogSink extends EmscriptenObject {
+  static setMinimumLevel(level: number): void;
+  static setMaximumMessagesPerSecond(count: number): void;
+  static useJavaScriptHandler(): void;
+  static flush(): void;
+}
+
+export class StringsBuffer extends EmscriptenObject {
+  constructor();
+  clear(): void;
+  clearInternedStrings(): void;
+  addString(str: string): void;
+  addInstructionParameters(instruction: Instruction): void;
+  addObjectsNames(container: ObjectsContainer): void;
+  getCount(): number;
+  getIdsPointer(): number;
+  getInternedStringsCount(): number;
+  getInternedStringsGeneration(): number;
+  getInternedOffsetsPointer(): number;
+  getInternedDataPointer(): number;
+  toJSArray(): Array<string>;
+}
+
 export class ObjectAssetSerializer extends EmscriptenObject {
   static serializeTo(project: Project, obj: gdObject, objectFullName: string, element: SerializerElement, usedResourceNames: VectorString): void;
 }
 
+export class ObjectAssetsPackSerializer extends EmscriptenObject {
+  constructor(project: Project);
+  serializeAssetToJSON(obj: gdObject, objectFullName: string, usedResourceNames: VectorString): string;
+}
+
 export class InstructionsList extends EmscriptenObject {
   constructor();
   insert(instr: Instruction, pos: number): Instruction;
@@ -1385,6 +1519,9 @@ export class InstructionMetadata extends AbstractFunctionMetadata {
   getParametersCount(): number;
   getParameters(): ParameterMetadataContainer;
   getUsageComplexity(): number;
+  isPure(): boolean;
+  hasSideEffects(): boolean;
+  getEvaluationCost(): number;
   isHidden(): boolean;
   isPrivate(): boolean;
   isAsync(): boolean;
@@ -1411,6 +1548,10 @@ export class InstructionMetadata extends AbstractFunctionMetadata {
   markAsSimple(): InstructionMetadata;
   markAsAdvanced(): InstructionMetadata;
   markAsComplex(): InstructionMetadata;
+  markAsPure(): InstructionMetadata;
+  markAsWithoutSideEffects(): InstructionMetadata;
+  markAsCheapToEvaluate(): InstructionMetadata;
+  markAsExpensiveToEvaluate(): InstructionMetadata;
   getCodeExtraInformation(): InstructionMetadata;
   setFunctionName(functionName_: string): InstructionMetadata;
   setAsyncFunctionName(functionName_: string): InstructionMetadata;
@@ -1752,6 +1893,7 @@ export class PlatformExtension extends EmscriptenObject {
   getAllConditions(): MapStringInstructionMetadata;
   getAllExpressions(): MapStringExpressionMetadata;
   getAllStrExpressions(): MapStringExpressionMetadata;
+  removeInstructionsAndExpressions(name: string): void;
   getAllActionsForObject(objectType: string): MapStringInstructionMetadata;
   getAllConditionsForObject(objectType: string): MapStringInstructionMetadata;
   getAllExpressionsForObject(objectType: string): MapStringExpressionMetadata;
@@ -1907,6 +2049,23 @@ export class EventsListUnfolder extends EmscriptenObject {
   static unfoldToLevel(list: EventsList, maxLevel: number, currentLevel?: number): void;
 }
 
+export class EventsListRows extends EmscriptenObject {
+  constructor();
+  build(events: EventsList): void;
+  getRowsCount(): number;
+  getEventAt(rowIndex: number): BaseEvent;
+  getDepthAt(rowIndex: number): number;
+  isDisabledAt(rowIndex: number): boolean;
+  getRowIndexOf(event: BaseEvent): number;
+  setEventHeight(event: BaseEvent, height: number): void;
+  setDefaultEventHeight(height: number): void;
+  clearEventsHeights(): void;
+  getRowHeight(rowIndex: number): number;
+  getRowOffset(rowIndex: number): number;
+  getTotalHeight(): number;
+  getRowIndexAtOffset(offset: number): number;
+}
+
 export class EventsSearchResult extends EmscriptenObject {
   isEventsListValid(): boolean;
   getEventsList(): EventsList;
@@ -2057,6 +2216,24 @@ export class InstructionsCountEvaluator extends EmscriptenObject {
   static scanProject(project: Project): number;
 }
 
+export class ProjectStatistics extends EmscriptenObject {
+  constructor();
+  getEventsCount(): number;
+  getInstructionsCount(): number;
+  getConditionsCount(): number;
+  getActionsCount(): number;
+  getExpressionsCount(): number;
+  getObjectsCount(): number;
+  getInstancesCount(): number;
+  add(other: ProjectStatistics): void;
+  toJSON(): string;
+}
+
+export class ProjectStatisticsEvaluator extends EmscriptenObject {
+  static computeLayoutStatistics(project: Project, layout: Layout): ProjectStatistics;
+  static computeProjectStatistics(project: Project): ProjectStatistics;
+}
+
 export class ExtensionAndBehaviorMetadata extends EmscriptenObject {
   getExtension(): PlatformExtension;
   getMetadata(): BehaviorMetadata;
@@ -2126,6 +2303,13 @@ export class DiagnosticReport extends EmscriptenObject {
   getSceneName(): string;
 }
 
+export class CodeGenerationReport extends EmscriptenObject {
+  constructor();
+  getEntriesCount(): number;
+  toJSON(): string;
+  clear(): void;
+}
+
 export class WholeProjectDiagnosticReport extends EmscriptenObject {
   get(index: number): DiagnosticReport;
   count(): number;
@@ -2199,6 +2383,7 @@ export class UniquePtrExpressionNode extends EmscriptenObject {
 export class ExpressionParser2 extends EmscriptenObject {
   constructor();
   parseExpression(expression: string): UniquePtrExpressionNode;
+  reparseExpression(rootNode: UniquePtrExpressionNode, previousExpression: string, position: number, deletedLength: number, insertedText: string): boolean;
 }
 
 export class EventsFunction extends EmscriptenObject {
@@ -2464,11 +2649,16 @@ export class AbstractFileSystemJS extends AbstractFileSystem {
   readFile(fn: string): string;
   readDir(dir: string): VectorString;
   fileExists(fn: string): boolean;
+  getFileFingerprint(fn: string): string;
+  removeFile(fn: string): boolean;
+  openForWrite(fn: string): boolean;
+  append(fn: string, content: string): boolean;
+  close(fn: string): boolean;
 }
 
 export class ProjectResourcesAdder extends EmscriptenObject {
   static getAllUseless(project: Project, resourceType: string): VectorString;
-  static removeAllUseless(project: Project, resourceType: string): void;
+  static removeAllUseless(project: Project, resourceType: string): VectorString;
 }
 
 export class ArbitraryEventsWorker extends EmscriptenObject {
@@ -2923,11 +3113,20 @@ export class ParticleEmitterObject extends ObjectConfiguration {
 export class LayoutCodeGenerator extends EmscriptenObject {
   constructor(project: Project);
   generateLayoutCompleteCode(layout: Layout, includes: SetString, diagnosticReport: DiagnosticReport, compilationForRuntime: boolean): string;
+  setGenerateCompactCode(compactCode: boolean): void;
+  setGenerateEventsProfiling(eventsProfiling: boolean): void;
+  setCodeGenerationReport(codeGenerationReport: CodeGenerationReport): void;
+}
+
+export class LayoutCodeGenerationCache extends EmscriptenObject {
+  constructor();
+  clear(): void;
 }
 
 export class BehaviorCodeGenerator extends EmscriptenObject {
   constructor(project: Project);
   generateRuntimeBehaviorCompleteCode(eventsFunctionsExtension: EventsFunctionsExtension, eventsBasedBehavior: EventsBasedBehavior, codeNamespace: string, behaviorMethodMangledNames: MapStringString, includes: SetString, compilationForRuntime: boolean): string;
+  setCodeGenerationReport(codeGenerationReport: CodeGenerationReport): void;
   static getBehaviorPropertyGetterName(propertyName: string): string;
   static getBehaviorPropertySetterName(propertyName: string): string;
   static getBehaviorPropertyToggleFunctionName(propertyName: string): string;
@@ -2939,6 +3138,7 @@ export class BehaviorCodeGenerator extends EmscriptenObject {
 export class ObjectCodeGenerator extends EmscriptenObject {
   constructor(project: Project);
   generateRuntimeObjectCompleteCode(eventsFunctionsExtension: EventsFunctionsExtension, eventsBasedObject: EventsBasedObject, codeNamespace: string, objectMethodMangledNames: MapStringString, includes: SetString, compilationForRuntime: boolean): string;
+  setCodeGenerationReport(codeGenerationReport: CodeGenerationReport): void;
   static getObjectPropertyGetterName(propertyName: string): string;
   static getObjectPropertySetterName(propertyName: string): string;
   static getObjectPropertyToggleFunctionName(propertyName: string): string;
@@ -2947,6 +3147,9 @@ export class ObjectCodeGenerator extends EmscriptenObject {
 export class EventsFunctionsExtensionCodeGenerator extends EmscriptenObject {
   constructor(project: Project);
   generateFreeEventsFunctionCompleteCode(extension: EventsFunctionsExtension, eventsFunction: EventsFunction, codeNamespac: string, includes: SetString, compilationForRuntime: boolean): string;
+  setCodeGenerationReport(codeGenerationReport: CodeGenerationReport): void;
+  static computeProjectExtensionsDeclarationsKey(project: Project): string;
+  static computeExtensionCodeKey(extension: EventsFunctionsExtension, declarationsKey: string): string;
 }
 
 export class PreviewExportOptions extends EmscriptenObject {
@@ -2963,6 +3166,7 @@ export class PreviewExportOptions extends EmscriptenObject {
   setProjectDataOnlyExport(enable: boolean): PreviewExportOptions;
   setNativeMobileApp(enable: boolean): PreviewExportOptions;
   setFullLoadingScreen(enable: boolean): PreviewExportOptions;
+  setIncrementalResourcesExport(enable: boolean): PreviewExportOptions;
   setIsDevelopmentEnvironment(enable: boolean): PreviewExportOptions;
   setNonRuntimeScriptsCacheBurst(value: number): PreviewExportOptions;
   setElectronRemoteRequirePath(electronRemoteRequirePath: string): PreviewExportOptions;
@@ -2980,14 +3184,24 @@ export class ExportOptions extends EmscriptenObject {
   constructor(project: Project, outputPath: string);
   setFallbackAuthor(id: string, username: string): ExportOptions;
   setTarget(target: string): ExportOptions;
+  setCompactEventsCode(enable: boolean): ExportOptions;
+  setEventsProfiling(enable: boolean): ExportOptions;
+  setBundleScripts(enable: boolean): ExportOptions;
+  setSplitScenesData(enable: boolean): ExportOptions;
+  setProjectDataAsJsonString(enable: boolean): ExportOptions;
+  setInstancesChunkSize(size: number): ExportOptions;
 }
 
 export class Exporter extends EmscriptenObject {
   constructor(fs: AbstractFileSystem, gdjsRoot: string);
   setCodeOutputDirectory(path: string): void;
+  setCodeGenerationThreadsCount(threadsCount: number): void;
+  setCodeGenerationCache(cache: LayoutCodeGenerationCache): void;
+  setCodeGenerationReport(report: CodeGenerationReport): void;
   exportProjectForPixiPreview(options: PreviewExportOptions): boolean;
   exportWholePixiProject(options: ExportOptions): boolean;
   getLastError(): string;
+  getLastMetricsReport(): string;
 }
 
 export class JsCodeEvent extends EmscriptenObject {
@@ -3159,6 +3373,94 @@ export function compare<T extends EmscriptenObject>(object1: T, object2: T): boo
  */
 export function destroy(object: EmscriptenObject): void;
 
+/**
+ * Return the size of the memory of the module, in bytes. The memory can only grow,
+ * so this is also the highest memory used until now.
+ */
+export function getHeapSize(): number;
+
+type LeakedObject = {
+  className: string;
+  ptr: number;
+  checkpoint: number;
+  stack: string;
+};
+
+/**
+ * Start to record the objects created with `new` (or `clone`), which must be deleted.
+ * Must be called before the objects to track are created. This is slow and only
+ * meant to find the objects that are never deleted.
+ */
+export function startLeaksTracking(options?: { captureStacks?: boolean }): void;
+
+/**
+ * Stop to record the objects, and forget the objects recorded.
+ */
+export function stopLeaksTracking(): void;
+
+/**
+ * Add a checkpoint, to later get only the objects created after it.
+ */
+export function addLeaksTrackingCheckpoint(): number;
+
+/**
+ * Return the objects created after the checkpoint (or since the start of the tracking)
+ * that are still not deleted.
+ */
+export function getLeakedObjects(sinceCheckpoint?: number): Array<LeakedObject>;
+
+type ExportInWorkerRequest = {
+  exportType: 'preview' | 'whole';
+  outputPath: string;
+  gdjsRoot?: string;
+  /** The project to export, serialized when the export is started. */
+  project?: Project;
+  /** The project, already serialized with `serializeProjectForWorker`. It is transferred to the worker. */
+  projectData?: ArrayBuffer;
+  /** Values given to the setters of the export options, like `{ layoutName: 'Scene' }`. */
+  options?: Record<string, any>;
+  /** The content of the files that can be read by the exporter. */
+  fileContents?: Record<string, string>;
+  codeOutputDirectory?: string;
+  codeGenerationThreadsCount?: number;
+};
+
+type ExportInWorkerResult = {
+  succeeded: boolean;
+  error: string;
+  metrics: string;
+};
+
+/**
+ * Return the snapshot of a project to send to a worker, as an ArrayBuffer that can be transferred.
+ */
+export function serializeProjectForWorker(project: Project): ArrayBuffer;
+
+/**
+ * Create a project from a snapshot returned by `serializeProjectForWorker`. The project must be deleted.
+ */
+export function unserializeProjectFromWorker(data: ArrayBuffer): Project;
+
+/**
+ * Answer the export requests sent by `exportInWorker` to `scope` (the global scope of a worker,
+ * or a MessagePort). Return a function to stop answering the requests.
+ */
+export function handleExportRequestsInWorker(
+  scope: any,
+  options?: { onProjectLoaded?: (project: Project) => void }
+): () => void;
+
+/**
+ * Export a project in a worker, without blocking the current thread. The operations
+ * done on the file system by the exporter are streamed to `fileSystem`, with the same
+ * names and arguments as the methods of `AbstractFileSystemJS`.
+ */
+export function exportInWorker(
+  worker: any,
+  request: ExportInWorkerRequest,
+  fileSystem: Record<string, (...args: any[]) => any>
+): Promise<ExportInWorkerResult>;
+
 export as namespace gd;
 
 declare global {
@@ -13,6 +13,11 @@ declare class gdAbstractFileSystemJS extends gdAbstractFileSystem {
   readFile(fn: string): string;
   readDir(dir: string): gdVectorString;
   fileExists(fn: string): boolean;
+  getFileFingerprint(fn: string): string;
+  removeFile(fn: string): boolean;
+  openForWrite(fn: string): boolean;
+  append(fn: string, content: string): boolean;
+  close(fn: string): boolean;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
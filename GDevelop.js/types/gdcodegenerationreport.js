@@ -0,0 +1,9 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdCodeGenerationReport {
+  constructor(): void;
+  getEntriesCount(): number;
+  toJSON(): string;
+  clear(): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,11 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsFunctionsCallGraph {
+  constructor(): void;
+  build(project: gdProject): void;
+  updateExtension(project: gdProject, eventsFunctionsExtension: gdEventsFunctionsExtension): void;
+  removeExtension(extensionName: string): void;
+  hasFunction(functionFullType: string): boolean;
+  isRecursive(functionFullType: string): boolean;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
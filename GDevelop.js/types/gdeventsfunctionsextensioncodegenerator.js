@@ -1,7 +1,10 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdEventsFunctionsExtensionCodeGenerator {
   constructor(project: gdProject): void;
+  static computeProjectExtensionsDeclarationsKey(project: gdProject): string;
+  static computeExtensionCodeKey(extension: gdEventsFunctionsExtension, declarationsKey: string): string;
   generateFreeEventsFunctionCompleteCode(extension: gdEventsFunctionsExtension, eventsFunction: gdEventsFunction, codeNamespac: string, includes: gdSetString, compilationForRuntime: boolean): string;
+  setCodeGenerationReport(codeGenerationReport: gdCodeGenerationReport): void;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -0,0 +1,19 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsListRows {
+  constructor(): void;
+  build(events: gdEventsList): void;
+  getRowsCount(): number;
+  getEventAt(rowIndex: number): gdBaseEvent;
+  getDepthAt(rowIndex: number): number;
+  isDisabledAt(rowIndex: number): boolean;
+  getRowIndexOf(event: gdBaseEvent): number;
+  setEventHeight(event: gdBaseEvent, height: number): void;
+  setDefaultEventHeight(height: number): void;
+  clearEventsHeights(): void;
+  getRowHeight(rowIndex: number): number;
+  getRowOffset(rowIndex: number): number;
+  getTotalHeight(): number;
+  getRowIndexAtOffset(offset: number): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
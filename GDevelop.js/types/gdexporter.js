@@ -2,9 +2,13 @@
 declare class gdjsExporter {
   constructor(fs: gdAbstractFileSystem, gdjsRoot: string): void;
   setCodeOutputDirectory(path: string): void;
+  setCodeGenerationThreadsCount(threadsCount: number): void;
+  setCodeGenerationCache(cache: gdLayoutCodeGenerationCache): void;
+  setCodeGenerationReport(report: gdCodeGenerationReport): void;
   exportProjectForPixiPreview(options: gdPreviewExportOptions): boolean;
   exportWholePixiProject(options: gdExportOptions): boolean;
   getLastError(): string;
+  getLastMetricsReport(): string;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -3,6 +3,12 @@ declare class gdExportOptions {
   constructor(project: gdProject, outputPath: string): void;
   setFallbackAuthor(id: string, username: string): gdExportOptions;
   setTarget(target: string): gdExportOptions;
+  setCompactEventsCode(enable: boolean): gdExportOptions;
+  setEventsProfiling(enable: boolean): gdExportOptions;
+  setBundleScripts(enable: boolean): gdExportOptions;
+  setSplitScenesData(enable: boolean): gdExportOptions;
+  setProjectDataAsJsonString(enable: boolean): gdExportOptions;
+  setInstancesChunkSize(size: number): gdExportOptions;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 declare class gdExpressionParser2 {
   constructor(): void;
   parseExpression(expression: string): gdUniquePtrExpressionNode;
+  reparseExpression(rootNode: gdUniquePtrExpressionNode, previousExpression: string, position: number, deletedLength: number, insertedText: string): boolean;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
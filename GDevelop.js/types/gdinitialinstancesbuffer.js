@@ -0,0 +1,25 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdInitialInstancesBuffer {
+  getNumbers(): Float64Array;
+  getIntegers(): Int32Array;
+  setIndexes(indexes: Array<number>): void;
+
+  constructor(): void;
+  readFrom(container: gdInitialInstancesContainer): void;
+  applyToInstances(): void;
+  moveInstances(deltaX: number, deltaY: number, deltaZ: number): void;
+  rotateInstances(angle: number, pivotX: number, pivotY: number): void;
+  setInstancesLayer(layerName: string): void;
+  changeInstancesZOrder(offset: number): void;
+  recordInstancesBefore(delta: gdInitialInstancesDelta): void;
+  getInstancesCount(): number;
+  getInstance(index: number): gdInitialInstance;
+  getLayersCount(): number;
+  getLayerName(index: number): string;
+  setIndexesCount(count: number): void;
+  getNumbersPointer(): number;
+  getIntegersPointer(): number;
+  getIndexesPointer(): number;
+  delete(): void;
+  ptr: number;
+};
@@ -0,0 +1,13 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdInitialInstancesDelta {
+  constructor(): void;
+  recordAfter(): void;
+  isEmpty(): boolean;
+  getInstancesCount(): number;
+  undo(container: gdInitialInstancesContainer): void;
+  redo(container: gdInitialInstancesContainer): void;
+  serializeTo(element: gdSerializerElement): void;
+  unserializeFrom(element: gdSerializerElement): void;
+  delete(): void;
+  ptr: number;
+};
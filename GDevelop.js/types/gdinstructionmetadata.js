@@ -13,6 +13,9 @@ declare class gdInstructionMetadata extends gdAbstractFunctionMetadata {
   getParametersCount(): number;
   getParameters(): gdParameterMetadataContainer;
   getUsageComplexity(): number;
+  isPure(): boolean;
+  hasSideEffects(): boolean;
+  getEvaluationCost(): number;
   isHidden(): boolean;
   isPrivate(): boolean;
   isAsync(): boolean;
@@ -39,6 +42,10 @@ declare class gdInstructionMetadata extends gdAbstractFunctionMetadata {
   markAsSimple(): gdInstructionMetadata;
   markAsAdvanced(): gdInstructionMetadata;
   markAsComplex(): gdInstructionMetadata;
+  markAsPure(): gdInstructionMetadata;
+  markAsWithoutSideEffects(): gdInstructionMetadata;
+  markAsCheapToEvaluate(): gdInstructionMetadata;
+  markAsExpensiveToEvaluate(): gdInstructionMetadata;
   getCodeExtraInformation(): gdInstructionMetadata;
   setFunctionName(functionName_: string): gdInstructionMetadata;
   setAsyncFunctionName(functionName_: string): gdInstructionMetadata;
@@ -2,6 +2,9 @@
 declare class gdLayoutCodeGenerator {
   constructor(project: gdProject): void;
   generateLayoutCompleteCode(layout: gdLayout, includes: gdSetString, diagnosticReport: gdDiagnosticReport, compilationForRuntime: boolean): string;
+  setGenerateCompactCode(compactCode: boolean): void;
+  setGenerateEventsProfiling(eventsProfiling: boolean): void;
+  setCodeGenerationReport(codeGenerationReport: gdCodeGenerationReport): void;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -0,0 +1,20 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdLayoutSnapshot {
+  static Settings: 1;
+  static Variables: 2;
+  static Instances: 4;
+  static Objects: 8;
+  static Events: 16;
+  static Layers: 32;
+  static AllParts: 63;
+  constructor(): void;
+  take(layout: gdLayout): void;
+  takeNext(previous: gdLayoutSnapshot, layout: gdLayout, changedParts: number, changedInstancesUuids: gdVectorString): void;
+  isEmpty(): boolean;
+  restoreTo(project: gdProject, layout: gdLayout): void;
+  serializeTo(element: gdSerializerElement): void;
+  isPartSharedWith(other: gdLayoutSnapshot, part: LayoutSnapshot_Part): boolean;
+  getSharedInstancesCount(other: gdLayoutSnapshot): number;
+  delete(): void;
+  ptr: number;
+};
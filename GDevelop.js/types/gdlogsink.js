@@ -0,0 +1,9 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdLogSink {
+  static setMinimumLevel(level: number): void;
+  static setMaximumMessagesPerSecond(count: number): void;
+  static useJavaScriptHandler(): void;
+  static flush(): void;
+  delete(): void;
+  ptr: number;
+};
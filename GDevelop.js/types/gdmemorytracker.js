@@ -0,0 +1,7 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdMemoryTracker {
+  static isEnabled(): boolean;
+  static toJSON(): string;
+  delete(): void;
+  ptr: number;
+};
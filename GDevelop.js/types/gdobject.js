@@ -6,6 +6,8 @@ declare class gdObject {
   getName(): string;
   setAssetStoreId(assetStoreId: string): void;
   getAssetStoreId(): string;
+  setInstancesPoolSize(instancesPoolSize: number): void;
+  getInstancesPoolSize(): number;
   setType(type: string): void;
   getType(): string;
   getConfiguration(): gdObjectConfiguration;
@@ -0,0 +1,7 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdObjectAssetsPackSerializer {
+  constructor(project: gdProject): void;
+  serializeAssetToJSON(obj: gdObject, objectFullName: string, usedResourceNames: gdVectorString): string;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,12 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdPerfScope {
+  static enable(enable: boolean): void;
+  static isEnabled(): boolean;
+  static reset(): void;
+  static getCounter(name: string): number;
+  static getCallsCount(path: string): number;
+  static getTotalDuration(path: string): number;
+  static toJSON(): string;
+  delete(): void;
+  ptr: number;
+};
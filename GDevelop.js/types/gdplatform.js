@@ -7,6 +7,8 @@ declare class gdPlatform {
   getInstructionOrExpressionGroupMetadata(name: string): gdInstructionOrExpressionGroupMetadata;
   isExtensionLoaded(name: string): boolean;
   removeExtension(name: string): void;
+  getExtensionToUpdate(name: string): gdPlatformExtension;
+  notifyExtensionChanged(name: string): void;
   reloadBuiltinExtensions(): void;
   getAllPlatformExtensions(): gdVectorPlatformExtension;
   delete(): void;
@@ -44,6 +44,7 @@ declare class gdPlatformExtension {
   getAllConditions(): gdMapStringInstructionMetadata;
   getAllExpressions(): gdMapStringExpressionMetadata;
   getAllStrExpressions(): gdMapStringExpressionMetadata;
+  removeInstructionsAndExpressions(name: string): void;
   getAllActionsForObject(objectType: string): gdMapStringInstructionMetadata;
   getAllConditionsForObject(objectType: string): gdMapStringInstructionMetadata;
   getAllExpressionsForObject(objectType: string): gdMapStringExpressionMetadata;
@@ -0,0 +1,11 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdPlatformSnapshot {
+  constructor(): void;
+  static computeKey(project: gdProject): string;
+  take(platform: gdPlatform, key: string): void;
+  restore(platform: gdPlatform, key: string): boolean;
+  getKey(): string;
+  clear(): void;
+  delete(): void;
+  ptr: number;
+};
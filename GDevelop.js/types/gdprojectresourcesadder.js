@@ -1,7 +1,7 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdProjectResourcesAdder {
   static getAllUseless(project: gdProject, resourceType: string): gdVectorString;
-  static removeAllUseless(project: gdProject, resourceType: string): void;
+  static removeAllUseless(project: gdProject, resourceType: string): gdVectorString;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
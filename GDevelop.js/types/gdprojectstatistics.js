@@ -0,0 +1,15 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdProjectStatistics {
+  constructor(): void;
+  getEventsCount(): number;
+  getInstructionsCount(): number;
+  getConditionsCount(): number;
+  getActionsCount(): number;
+  getExpressionsCount(): number;
+  getObjectsCount(): number;
+  getInstancesCount(): number;
+  add(other: gdProjectStatistics): void;
+  toJSON(): string;
+  delete(): void;
+  ptr: number;
+};
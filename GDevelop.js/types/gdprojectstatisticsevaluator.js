@@ -0,0 +1,7 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdProjectStatisticsEvaluator {
+  static computeLayoutStatistics(project: gdProject, layout: gdLayout): gdProjectStatistics;
+  static computeProjectStatistics(project: gdProject): gdProjectStatistics;
+  delete(): void;
+  ptr: number;
+};
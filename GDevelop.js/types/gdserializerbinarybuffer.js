@@ -0,0 +1,11 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdSerializerBinaryBuffer {
+  constructor(): void;
+  serializeFrom(element: gdSerializerElement): void;
+  unserializeTo(element: gdSerializerElement): void;
+  resize(size: number): void;
+  getSize(): number;
+  getDataPointer(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
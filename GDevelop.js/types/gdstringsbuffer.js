@@ -0,0 +1,18 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdStringsBuffer {
+  toJSArray(): Array<string>;
+  constructor(): void;
+  clear(): void;
+  clearInternedStrings(): void;
+  addString(str: string): void;
+  addInstructionParameters(instruction: gdInstruction): void;
+  addObjectsNames(container: gdObjectsContainer): void;
+  getCount(): number;
+  getIdsPointer(): number;
+  getInternedStringsCount(): number;
+  getInternedStringsGeneration(): number;
+  getInternedOffsetsPointer(): number;
+  getInternedDataPointer(): number;
+  delete(): void;
+  ptr: number;
+};
@@ -0,0 +1,6 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdTranslationsCache {
+  static clear(): void;
+  delete(): void;
+  ptr: number;
+};
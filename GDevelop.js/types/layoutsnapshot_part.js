@@ -0,0 +1,2 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+type LayoutSnapshot_Part = 1 | 2 | 4 | 8 | 16 | 32 | 63
\ No newline at end of file
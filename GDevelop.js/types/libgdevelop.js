@@ -40,6 +40,18 @@ declare class libGDevelop {
 
   asImageResource(gdResource): gdImageResource;
 
+  getHeapSize(): number;
+
+  startLeaksTracking(options?: {| captureStacks?: boolean |}): void;
+  stopLeaksTracking(): void;
+  addLeaksTrackingCheckpoint(): number;
+  getLeakedObjects(sinceCheckpoint?: number): Array<{| className: string, ptr: number, checkpoint: number, stack: string |}>;
+
+  serializeProjectForWorker(project: gdProject): ArrayBuffer;
+  unserializeProjectFromWorker(data: ArrayBuffer): gdProject;
+  handleExportRequestsInWorker(scope: any, options?: {| onProjectLoaded?: (project: gdProject) => void |}): () => void;
+  exportInWorker(worker: any, request: {| exportType: 'preview' | 'whole', outputPath: string, gdjsRoot?: string, project?: gdProject, projectData?: ArrayBuffer, options?: Object, fileContents?: {[string]: string}, codeOutputDirectory?: string, codeGenerationThreadsCount?: number |}, fileSystem: Object): Promise<{| succeeded: boolean, error: string, metrics: string |}>;
+
   VectorString: Class<gdVectorString>;
   VectorPlatformExtension: Class<gdVectorPlatformExtension>;
   VectorDependencyMetadata: Class<gdVectorDependencyMetadata>;
@@ -61,10 +73,12 @@ declare class libGDevelop {
   EventsVariablesFinder: Class<gdEventsVariablesFinder>;
   EventsIdentifiersFinder: Class<gdEventsIdentifiersFinder>;
   EventsFunctionSelfCallChecker: Class<gdEventsFunctionSelfCallChecker>;
+  EventsFunctionsCallGraph: Class<gdEventsFunctionsCallGraph>;
   InstructionOrExpressionGroupMetadata: Class<gdInstructionOrExpressionGroupMetadata>;
   VersionWrapper: Class<gdVersionWrapper>;
   Platform: Class<gdPlatform>;
   JsPlatform: Class<gdJsPlatform>;
+  PlatformSnapshot: Class<gdPlatformSnapshot>;
   PairStringVariable: Class<gdPairStringVariable>;
   Variable_Type: Class<Variable_Type>;
   VariableInstructionSwitcher: Class<gdVariableInstructionSwitcher>;
@@ -130,6 +144,10 @@ declare class libGDevelop {
   JavaScriptResource: Class<gdJavaScriptResource>;
   InitialInstance: Class<gdInitialInstance>;
   InitialInstancesContainer: Class<gdInitialInstancesContainer>;
+  InitialInstancesDelta: Class<gdInitialInstancesDelta>;
+  InitialInstancesBuffer: Class<gdInitialInstancesBuffer>;
+  LayoutSnapshot_Part: Class<LayoutSnapshot_Part>;
+  LayoutSnapshot: Class<gdLayoutSnapshot>;
   HighestZOrderFinder: Class<gdHighestZOrderFinder>;
   InitialInstanceFunctor: Class<gdInitialInstanceFunctor>;
   InitialInstanceJSFunctorWrapper: Class<gdInitialInstanceJSFunctorWrapper>;
@@ -138,7 +156,14 @@ declare class libGDevelop {
   SerializerElement: Class<gdSerializerElement>;
   SharedPtrSerializerElement: Class<gdSharedPtrSerializerElement>;
   Serializer: Class<gdSerializer>;
+  SerializerBinaryBuffer: Class<gdSerializerBinaryBuffer>;
+  MemoryTracker: Class<gdMemoryTracker>;
+  PerfScope: Class<gdPerfScope>;
+  TranslationsCache: Class<gdTranslationsCache>;
+  LogSink: Class<gdLogSink>;
+  StringsBuffer: Class<gdStringsBuffer>;
   ObjectAssetSerializer: Class<gdObjectAssetSerializer>;
+  ObjectAssetsPackSerializer: Class<gdObjectAssetsPackSerializer>;
   InstructionsList: Class<gdInstructionsList>;
   Instruction: Class<gdInstruction>;
   Expression: Class<gdExpression>;
@@ -178,6 +203,7 @@ declare class libGDevelop {
   LinkEvent: Class<gdLinkEvent>;
   EventsRemover: Class<gdEventsRemover>;
   EventsListUnfolder: Class<gdEventsListUnfolder>;
+  EventsListRows: Class<gdEventsListRows>;
   EventsSearchResult: Class<gdEventsSearchResult>;
   VectorEventsSearchResult: Class<gdVectorEventsSearchResult>;
   EventsRefactorer: Class<gdEventsRefactorer>;
@@ -194,6 +220,8 @@ declare class libGDevelop {
   UsedExtensionsFinder: Class<gdUsedExtensionsFinder>;
   ExampleExtensionUsagesFinder: Class<gdExampleExtensionUsagesFinder>;
   InstructionsCountEvaluator: Class<gdInstructionsCountEvaluator>;
+  ProjectStatistics: Class<gdProjectStatistics>;
+  ProjectStatisticsEvaluator: Class<gdProjectStatisticsEvaluator>;
   ExtensionAndBehaviorMetadata: Class<gdExtensionAndBehaviorMetadata>;
   ExtensionAndObjectMetadata: Class<gdExtensionAndObjectMetadata>;
   ExtensionAndEffectMetadata: Class<gdExtensionAndEffectMetadata>;
@@ -203,6 +231,7 @@ declare class libGDevelop {
   ProjectDiagnostic_ErrorType: Class<ProjectDiagnostic_ErrorType>;
   ProjectDiagnostic: Class<gdProjectDiagnostic>;
   DiagnosticReport: Class<gdDiagnosticReport>;
+  CodeGenerationReport: Class<gdCodeGenerationReport>;
   WholeProjectDiagnosticReport: Class<gdWholeProjectDiagnosticReport>;
   ExpressionParserError: Class<gdExpressionParserError>;
   VectorExpressionParserError: Class<gdVectorExpressionParserError>;
@@ -272,6 +301,7 @@ declare class libGDevelop {
   ParticleEmitterObject_RendererType: Class<ParticleEmitterObject_RendererType>;
   ParticleEmitterObject: Class<gdParticleEmitterObject>;
   LayoutCodeGenerator: Class<gdLayoutCodeGenerator>;
+  LayoutCodeGenerationCache: Class<gdLayoutCodeGenerationCache>;
   BehaviorCodeGenerator: Class<gdBehaviorCodeGenerator>;
   ObjectCodeGenerator: Class<gdObjectCodeGenerator>;
   EventsFunctionsExtensionCodeGenerator: Class<gdEventsFunctionsExtensionCodeGenerator>;
@@ -8,6 +8,30 @@
 var debug = false; //If true, add additional checks in bindings files.
 var fs = require('fs');
 var exec = require('child_process').exec;
+var optionalModules = require('./Bindings/modules.js');
+
+// With `--modules=core` (or `--modules=core,completion`...), only the core and
+// the given optional modules are kept, and the files are named after the
+// modules (glue-core.cpp...). Otherwise, all the interfaces are kept.
+var modulesArgument = process.argv.find(function(arg) {
+  return arg.indexOf('--modules=') === 0;
+});
+var keptModules = modulesArgument
+  ? modulesArgument.substring('--modules='.length).split(',')
+  : null;
+if (keptModules) {
+  keptModules.forEach(function(moduleName) {
+    if (moduleName !== 'core' && !optionalModules.hasOwnProperty(moduleName)) {
+      fatalError({
+        message: 'Unknown module: ' + moduleName,
+        output: 'Possible values are: core, ' + Object.keys(optionalModules).join(', '),
+      });
+    }
+  });
+}
+var gluePath = keptModules
+  ? 'Bindings/glue-' + keptModules.join('-')
+  : 'Bindings/glue';
 
 if (!process.env.EMSDK) {
   console.error('EMSDK env. variable is not set');
@@ -39,8 +63,23 @@ function generateGlueFromBinding(cb) {
       return;
     }
 
+    var idlPath = 'Bindings/Bindings.idl';
+    if (keptModules) {
+      try {
+        var filteredIdl = filterIdlModules(
+          fs.readFileSync(idlPath, 'utf8'),
+          keptModules
+        );
+        idlPath = gluePath + '.idl';
+        fs.writeFileSync(idlPath, filteredIdl);
+      } catch (err) {
+        cb({ message: 'Error while removing the optional modules:', output: err });
+        return;
+      }
+    }
+
     exec(
-      'python "' + webIdlBinderPath + '" Bindings/Bindings.idl Bindings/glue',
+      'python "' + webIdlBinderPath + '" ' + idlPath + ' ' + gluePath,
       function(err, stdout, stderr) {
         if (err) {
           cb({ message: 'Error while running WebIDL binder:', output: err });
@@ -57,7 +96,7 @@ function generateGlueFromBinding(cb) {
  * of the IDL language/binder.
  */
 function patchGlueCppFile(cb) {
-  var file = 'Bindings/glue.cpp';
+  var file = gluePath + '.cpp';
   var classesToErase = [
     'ArbitraryResourceWorkerJS',
     'AbstractFileSystemJS',
@@ -185,6 +224,54 @@ function patchGlueCppFile(cb) {
   });
 }
 
+/**
+ * Return the content of Bindings.idl without the interfaces of the modules
+ * that are not kept, or throw if a kept interface still uses one of them.
+ */
+function filterIdlModules(idl, keptModules) {
+  var removedInterfaces = {};
+  Object.keys(optionalModules).forEach(function(moduleName) {
+    if (keptModules.indexOf(moduleName) !== -1) return;
+    optionalModules[moduleName].forEach(function(interfaceName) {
+      removedInterfaces[interfaceName] = true;
+    });
+  });
+
+  // Remove the declarations (with their extended attributes), the enums
+  // (named after their interface) and the "implements" statements of the
+  // removed interfaces.
+  var filteredIdl = idl.replace(
+    /(^\[[^\]\n]*\]\n)?^interface (\w+) \{[^]*?^\};\n/gm,
+    function(declaration, attributes, interfaceName) {
+      return removedInterfaces[interfaceName] ? '' : declaration;
+    }
+  );
+  filteredIdl = filteredIdl.replace(/^enum (\w+?)_\w+ \{[^]*?^\};\n/gm, function(
+    declaration,
+    interfaceName
+  ) {
+    return removedInterfaces[interfaceName] ? '' : declaration;
+  });
+  filteredIdl = filteredIdl.replace(/^(\w+) implements (\w+);\n/gm, function(
+    statement,
+    interfaceName
+  ) {
+    return removedInterfaces[interfaceName] ? '' : statement;
+  });
+
+  var withoutComments = filteredIdl.replace(/\/\/.*$/gm, '');
+  Object.keys(removedInterfaces).forEach(function(interfaceName) {
+    if (new RegExp('\\b' + interfaceName + '\\b').test(withoutComments)) {
+      throw new Error(
+        interfaceName +
+          ' is still used by another interface: it must be moved to the core or to another module.'
+      );
+    }
+  });
+
+  return filteredIdl;
+}
+
 function fatalError(error) {
   if (error.message) console.error(error.message);
   if (error.output) console.log(error.output);
@@ -672,4 +672,79 @@ describe("TiledTileMapLoader", function () {
       expect(layer.isFlippedDiagonally(2, 1)).to.be(false);
     });
   });
+
+  describe("with a base64 encoded layer", function () {
+    const tiledMap: TiledTileMap = {
+      compressionlevel: -1,
+      height: 2,
+      infinite: false,
+      layers: [
+        {
+          // The GIDs 1, 2147483649 (flipped horizontally), 0 (no tile)
+          // and 1610612738 (flipped vertically and diagonally).
+          data: "AQAAAAEAAIAAAAAAAgAAYA==",
+          encoding: "base64",
+          height: 2,
+          id: 1,
+          name: "Tile Layer 1",
+          opacity: 1,
+          type: "tilelayer",
+          visible: true,
+          width: 2,
+          x: 0,
+          y: 0,
+        },
+      ],
+      nextlayerid: 2,
+      nextobjectid: 1,
+      orientation: "orthogonal",
+      renderorder: "right-down",
+      tiledversion: "1.9.0",
+      tileheight: 8,
+      tilesets: [
+        {
+          columns: 2,
+          firstgid: 1,
+          image: "MiniTiledSet.png",
+          imageheight: 8,
+          imagewidth: 16,
+          margin: 0,
+          name: "new tileset",
+          spacing: 0,
+          tilecount: 2,
+          tileheight: 8,
+          tilewidth: 8,
+        },
+      ],
+      tilewidth: 8,
+      type: "map",
+      version: "1.9",
+      width: 2,
+    };
+
+    const tileMap: EditableTileMap = TiledTileMapLoader.load(tiledMap, null);
+
+    it("can load the tiles and their flipping", function () {
+      const layers = new Array(...tileMap.getLayers());
+      expect(layers.length).to.be(1);
+      const layer = layers[0] as EditableTileMapLayer;
+
+      expect(layer.getTileId(0, 0)).to.be(0);
+      expect(layer.isFlippedHorizontally(0, 0)).to.be(false);
+      expect(layer.isFlippedVertically(0, 0)).to.be(false);
+      expect(layer.isFlippedDiagonally(0, 0)).to.be(false);
+
+      expect(layer.getTileId(1, 0)).to.be(0);
+      expect(layer.isFlippedHorizontally(1, 0)).to.be(true);
+      expect(layer.isFlippedVertically(1, 0)).to.be(false);
+      expect(layer.isFlippedDiagonally(1, 0)).to.be(false);
+
+      expect(layer.getTileId(0, 1)).to.be(undefined);
+
+      expect(layer.getTileId(1, 1)).to.be(1);
+      expect(layer.isFlippedHorizontally(1, 1)).to.be(false);
+      expect(layer.isFlippedVertically(1, 1)).to.be(true);
+      expect(layer.isFlippedDiagonally(1, 1)).to.be(true);
+    });
+  });
 });
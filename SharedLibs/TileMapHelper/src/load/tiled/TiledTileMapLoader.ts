@@ -5,6 +5,7 @@ import {
   TileObject,
 } from "../../model/TileMapModel";
 import { TiledTileMap } from "./TiledFormat";
+import { FlippingHelper } from "../../model/GID";
 import {
   decodeBase64LayerData,
   extractTileUidFlippedStates,
@@ -152,7 +153,7 @@ export namespace TiledTileMapLoader {
         }
       } else if (tiledLayer.type === "tilelayer") {
         let tileSlotIndex = 0;
-        let layerData: integer[] | null = null;
+        let layerData: ArrayLike<integer> | null = null;
 
         if (tiledLayer.encoding === "base64") {
           layerData = decodeBase64LayerData(pako, tiledLayer);
@@ -175,27 +176,25 @@ export namespace TiledTileMapLoader {
               // The "globalTileUid" is the tile UID with encoded
               // bits about the flipping/rotation of the tile.
               const globalTileUid = layerData[tileSlotIndex];
-              // Extract the tile UID and the texture.
-              const tileUid = extractTileUidFlippedStates(globalTileUid);
-              if (tileUid.id !== undefined) {
-                collisionTileLayer.setTile(x, y, tileUid.id);
-                collisionTileLayer.setFlippedHorizontally(
-                  x,
-                  y,
-                  tileUid.flippedHorizontally
-                );
-                collisionTileLayer.setFlippedVertically(
-                  x,
-                  y,
-                  tileUid.flippedVertically
-                );
-                collisionTileLayer.setFlippedDiagonally(
-                  x,
-                  y,
-                  tileUid.flippedDiagonally
-                );
-              }
               tileSlotIndex += 1;
+              const tileId = getTileIdFromTiledGUI(
+                globalTileUid & FlippingHelper.tileIdMask
+              );
+              if (tileId === undefined) {
+                continue;
+              }
+              if (!definitions.has(tileId)) {
+                console.error(`Invalid tile definition index: ${tileId}`);
+                continue;
+              }
+              // Tiled uses the same flipping bits as the model, so the tile
+              // and its flipping are set at once (this is done for every
+              // tile of big maps).
+              collisionTileLayer.setTileGID(
+                x,
+                y,
+                tileId | (globalTileUid & ~FlippingHelper.tileIdMask)
+              );
             }
           }
         }
@@ -14,45 +14,45 @@ import { TiledLayer } from "./TiledFormat";
  * @param tiledLayer The layer data from a Tiled JSON.
  * @returns The decoded layer data.
  */
-export const decodeBase64LayerData = (pako: any, tiledLayer: TiledLayer) => {
+export const decodeBase64LayerData = (
+  pako: any,
+  tiledLayer: TiledLayer
+): ArrayLike<integer> | null => {
   const { data, compression } = tiledLayer;
   const dataBase64 = data as string;
   if (!dataBase64) {
     // The layer data is not encoded.
     return data as number[];
   }
-  let index = 4;
-  const decodedData: integer[] = [];
-  let step1 = atob(dataBase64)
-    .split("")
-    .map(function (x) {
-      return x.charCodeAt(0);
-    });
+  // Big maps have millions of bytes: avoid creating an array of strings or
+  // numbers for them.
+  const binaryString = atob(dataBase64);
+  const binData = new Uint8Array(binaryString.length);
+  for (let i = 0; i < binaryString.length; i++) {
+    binData[i] = binaryString.charCodeAt(i);
+  }
   try {
-    const decodeArray = (arr: integer[] | Uint8Array, index: integer) =>
-      (arr[index] +
-        (arr[index + 1] << 8) +
-        (arr[index + 2] << 16) +
-        (arr[index + 3] << 24)) >>>
-      0;
-
+    let bytes: Uint8Array;
     if (compression === "zlib") {
-      const binData = new Uint8Array(step1);
-      const decompressedData = pako.inflate(binData);
-      while (index <= decompressedData.length) {
-        decodedData.push(decodeArray(decompressedData, index - 4));
-        index += 4;
-      }
+      bytes = pako.inflate(binData);
     } else if (compression === "zstd") {
       console.error(
         "Zstandard compression is not supported for layers in a Tilemap. Use instead zlib compression or no compression."
       );
       return null;
     } else {
-      while (index <= step1.length) {
-        decodedData.push(decodeArray(step1, index - 4));
-        index += 4;
-      }
+      bytes = binData;
+    }
+
+    // GIDs are stored as little-endian unsigned 32-bit integers.
+    const decodedData = new Uint32Array(bytes.length >> 2);
+    for (let i = 0, index = 0; i < decodedData.length; i++, index += 4) {
+      decodedData[i] =
+        (bytes[index] |
+          (bytes[index + 1] << 8) |
+          (bytes[index + 2] << 16) |
+          (bytes[index + 3] << 24)) >>>
+        0;
     }
     return decodedData;
   } catch (error) {
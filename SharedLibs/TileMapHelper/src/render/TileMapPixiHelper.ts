@@ -87,6 +87,17 @@ export namespace PixiTileMapHelper {
     return textureCache;
   }
 
+  /**
+   * A part of the grid of a tile map, in tile coordinates.
+   * Maximums are excluded.
+   */
+  export type GridArea = {
+    minColumn: integer;
+    minRow: integer;
+    maxColumn: integer;
+    maxRow: integer;
+  };
+
   /**
    * Re-renders the tile map whenever its rendering settings have been changed
    *
@@ -99,21 +110,28 @@ export namespace PixiTileMapHelper {
    * - everything (`all`).
    * @param layerIndex If `displayMode` is set to `index`, the layer index to be
    * displayed.
+   * @param area If set, only the tiles of this area are rendered (the
+   * background and the objects are only rendered with the area starting at the
+   * first column and row). It allows to split big tile maps into chunks
+   * rendered separately.
    */
   export function updatePixiTileMap(
     untypedPixiTileMap: any,
     tileMap: EditableTileMap,
     textureCache: TileTextureCache,
     displayMode: "index" | "visible" | "all",
-    layerIndex: number
+    layerIndex: number,
+    area?: GridArea
   ): void {
     // The extension doesn't handle the Pixi sub-namespace very well.
     const pixiTileMap = untypedPixiTileMap as PIXI.tilemap.CompositeTilemap;
     if (!pixiTileMap) return;
     pixiTileMap.clear();
 
+    const isFirstArea = !area || (area.minColumn === 0 && area.minRow === 0);
+
     const bgResourceName = tileMap.getBackgroundResourceName();
-    if (bgResourceName) {
+    if (isFirstArea && bgResourceName) {
       const texture = textureCache.getLevelBackgroundTexture(bgResourceName);
       pixiTileMap.tile(texture, 0, 0);
     }
@@ -127,6 +145,9 @@ export namespace PixiTileMapHelper {
       }
 
       if (layer instanceof EditableObjectLayer) {
+        if (!isFirstArea) {
+          continue;
+        }
         const objectLayer = layer as EditableObjectLayer;
 
         for (const object of objectLayer.objects) {
@@ -152,9 +173,15 @@ export namespace PixiTileMapHelper {
         const dimensionX = tileLayer.tileMap.getDimensionX();
         const dimensionY = tileLayer.tileMap.getDimensionY();
         const alpha = tileLayer.getAlpha();
+        const minColumn = area ? Math.max(0, area.minColumn) : 0;
+        const minRow = area ? Math.max(0, area.minRow) : 0;
+        const maxColumn = area
+          ? Math.min(dimensionX, area.maxColumn)
+          : dimensionX;
+        const maxRow = area ? Math.min(dimensionY, area.maxRow) : dimensionY;
 
-        for (let y = 0; y < dimensionY; y++) {
-          for (let x = 0; x < dimensionX; x++) {
+        for (let y = minRow; y < maxRow; y++) {
+          for (let x = minColumn; x < maxColumn; x++) {
             const xPos = tileWidth * x;
             const yPos = tileHeight * y;
 
@@ -38,6 +38,26 @@ const isUnavoidableLibraryWarning = ({ group, message }: Log): boolean =>
   (message.includes('Electron Security Warning') ||
     message.includes('Warning: This is a browser-targeted Firebase bundle'));
 
+/**
+ * Return a copy of the game data where the data at the given path is replaced
+ * (the data that is not on the path is not copied).
+ */
+const setGameDataAtPath = (
+  gameData: any,
+  path: Array<string>,
+  value: any
+): any => {
+  if (!path.length) return value;
+  if (!gameData || typeof gameData !== 'object') return gameData;
+
+  const [key, ...remainingPath] = path;
+  const gameDataCopy = Array.isArray(gameData)
+    ? [...gameData]
+    : { ...gameData };
+  gameDataCopy[key] = setGameDataAtPath(gameData[key], remainingPath, value);
+  return gameDataCopy;
+};
+
 type Props = {|
   project: gdProject,
   setToolbar: React.Node => void,
@@ -229,6 +249,19 @@ export default class Debugger extends React.Component<Props, State> {
           [id]: data.payload,
         },
       });
+    } else if (data.command === 'dump.path') {
+      const { path, value } = data.payload;
+      this.setState(state => {
+        const gameData = state.debuggerGameData[id];
+        if (!gameData) return null;
+
+        return {
+          debuggerGameData: {
+            ...state.debuggerGameData,
+            [id]: setGameDataAtPath(gameData, path, value),
+          },
+        };
+      });
     } else if (data.command === 'profiler.output') {
       this.setState({
         profilerOutputs: {
@@ -301,6 +334,11 @@ export default class Debugger extends React.Component<Props, State> {
     previewDebuggerServer.sendMessage(id, { command: 'refresh' });
   };
 
+  _refreshPath = (id: DebuggerId, path: Array<string>) => {
+    const { previewDebuggerServer } = this.props;
+    previewDebuggerServer.sendMessage(id, { command: 'refreshPath', path });
+  };
+
   _edit = (id: DebuggerId, path: Array<string>, newValue: any) => {
     const { previewDebuggerServer } = this.props;
     previewDebuggerServer.sendMessage(id, {
@@ -309,7 +347,8 @@ export default class Debugger extends React.Component<Props, State> {
       newValue,
     });
 
-    setTimeout(() => this._refresh(id), 100);
+    // Only refresh the edited element rather than dumping the whole game.
+    setTimeout(() => this._refreshPath(id, path.slice(0, -1)), 100);
     return true;
   };
 
@@ -321,7 +360,8 @@ export default class Debugger extends React.Component<Props, State> {
       args,
     });
 
-    setTimeout(() => this._refresh(id), 100);
+    // Only refresh the element owning the called method.
+    setTimeout(() => this._refreshPath(id, path.slice(0, -1)), 100);
     return true;
   };
 
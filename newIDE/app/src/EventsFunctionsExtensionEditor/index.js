@@ -70,7 +70,7 @@ type Props = {|
   ) => void,
   onBehaviorEdited?: () => void,
   onObjectEdited?: () => void,
-  onFunctionEdited?: () => void,
+  onFunctionEdited?: (editedFreeEventsFunctionName?: ?string) => void,
   initiallyFocusedFunctionName: ?string,
   initiallyFocusedBehaviorName: ?string,
   initiallyFocusedObjectName: ?string,
@@ -315,7 +315,19 @@ export default class EventsFunctionsExtensionEditor extends React.Component<
     // Users may have change a function declaration.
     // Reload metadata just in case.
     if (this.props.onFunctionEdited) {
-      this.props.onFunctionEdited();
+      const {
+        selectedEventsFunction: editedEventsFunction,
+        selectedEventsBasedBehavior: editedEventsBasedBehavior,
+        selectedEventsBasedObject: editedEventsBasedObject,
+      } = this.state;
+      // Only the previously selected function can have been changed.
+      this.props.onFunctionEdited(
+        editedEventsFunction &&
+          !editedEventsBasedBehavior &&
+          !editedEventsBasedObject
+          ? editedEventsFunction.getName()
+          : null
+      );
     }
 
     this._updateProjectScopedContainerFrom({
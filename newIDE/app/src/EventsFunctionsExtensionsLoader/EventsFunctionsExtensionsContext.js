@@ -18,7 +18,8 @@ export type EventsFunctionsExtensionsState = {|
   ) => Promise<void>,
   reloadProjectEventsFunctionsExtensionMetadata: (
     project: ?gdProject,
-    extension: gdEventsFunctionsExtension
+    extension: gdEventsFunctionsExtension,
+    editedFreeEventsFunctionName?: ?string
   ) => void,
   getEventsFunctionsExtensionWriter: () => ?EventsFunctionsExtensionWriter,
   getEventsFunctionsExtensionOpener: () => ?EventsFunctionsExtensionOpener,
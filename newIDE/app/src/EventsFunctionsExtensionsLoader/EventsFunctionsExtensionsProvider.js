@@ -137,7 +137,8 @@ export default class EventsFunctionsExtensionsProvider extends React.Component<
 
   _reloadProjectEventsFunctionsExtensionMetadata(
     project: ?gdProject,
-    extension: gdEventsFunctionsExtension
+    extension: gdEventsFunctionsExtension,
+    editedFreeEventsFunctionName?: ?string
   ): void {
     const { i18n } = this.props;
     const eventsFunctionCodeWriter = this._eventsFunctionCodeWriter;
@@ -148,7 +149,8 @@ export default class EventsFunctionsExtensionsProvider extends React.Component<
         project,
         extension,
         eventsFunctionCodeWriter,
-        i18n
+        i18n,
+        editedFreeEventsFunctionName
       );
     } catch (eventsFunctionsExtensionsError) {
       this.setState({
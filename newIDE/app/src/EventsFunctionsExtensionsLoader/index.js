@@ -28,6 +28,80 @@ type Options = {
 type OptionsForGeneration = {
   ...Options,
   skipCodeGeneration?: boolean,
+  // See computeProjectExtensionsDeclarationsKey of
+  // gd.EventsFunctionsExtensionCodeGenerator.
+  extensionsDeclarationsKey?: string,
+  writtenCode?: WrittenExtensionCode,
+};
+
+/**
+ * The code written for an extension, identified by a key computed from
+ * everything used to generate it (see
+ * gd.EventsFunctionsExtensionCodeGenerator.computeExtensionCodeKey).
+ */
+type WrittenExtensionCode = {|
+  key: string,
+  // The include files required by the code written for each function,
+  // behavior or object, by the name given to the code writer.
+  requiredIncludeFiles: { [codeName: string]: Array<string> },
+|};
+
+/**
+ * The code written by each code writer, by extension name, so that the code
+ * of the extensions that were not modified is not generated again (at each
+ * preview for example).
+ */
+const writtenExtensionsCode: WeakMap<
+  EventsFunctionCodeWriter,
+  { [extensionName: string]: WrittenExtensionCode }
+> = new WeakMap();
+
+const getWrittenExtensionCode = (
+  eventsFunctionCodeWriter: EventsFunctionCodeWriter,
+  eventsFunctionsExtension: gdEventsFunctionsExtension,
+  extensionsDeclarationsKey: string
+): WrittenExtensionCode => {
+  let writtenCodeByExtension = writtenExtensionsCode.get(
+    eventsFunctionCodeWriter
+  );
+  if (!writtenCodeByExtension) {
+    writtenCodeByExtension = {};
+    writtenExtensionsCode.set(eventsFunctionCodeWriter, writtenCodeByExtension);
+  }
+
+  const key = gd.EventsFunctionsExtensionCodeGenerator.computeExtensionCodeKey(
+    eventsFunctionsExtension,
+    extensionsDeclarationsKey
+  );
+  const extensionName = eventsFunctionsExtension.getName();
+  const writtenCode = writtenCodeByExtension[extensionName];
+  if (writtenCode && writtenCode.key === key) return writtenCode;
+
+  const newWrittenCode = { key, requiredIncludeFiles: {} };
+  writtenCodeByExtension[extensionName] = newWrittenCode;
+  return newWrittenCode;
+};
+
+/**
+ * Return the include files required by the code if it was already written
+ * for the same extension, or null if the code must be generated.
+ */
+const getRequiredIncludeFilesOfWrittenCode = (
+  options: OptionsForGeneration,
+  codeName: string
+): ?Array<string> => {
+  const { writtenCode } = options;
+  return writtenCode ? writtenCode.requiredIncludeFiles[codeName] : null;
+};
+
+const storeWrittenCode = (
+  options: OptionsForGeneration,
+  codeName: string,
+  requiredIncludeFiles: Array<string>
+) => {
+  const { writtenCode } = options;
+  if (writtenCode)
+    writtenCode.requiredIncludeFiles[codeName] = requiredIncludeFiles;
 };
 
 type CodeGenerationContext = {|
@@ -55,9 +129,14 @@ export const loadProjectEventsFunctionsExtensions = (
         { skipCodeGeneration: true, eventsFunctionCodeWriter, i18n }
       );
     })
-  ).then(() =>
-    Promise.all(
-      // Second pass: generate extensions, including code.
+  ).then(() => {
+    // The code of an extension depends on the declarations of all of them.
+    const extensionsDeclarationsKey = gd.EventsFunctionsExtensionCodeGenerator.computeProjectExtensionsDeclarationsKey(
+      project
+    );
+    return Promise.all(
+      // Second pass: generate extensions, including code (only for the
+      // extensions modified since their code was last written).
       mapFor(0, project.getEventsFunctionsExtensionsCount(), i => {
         return loadProjectEventsFunctionsExtension(
           project,
@@ -66,31 +145,144 @@ export const loadProjectEventsFunctionsExtensions = (
             skipCodeGeneration: false,
             eventsFunctionCodeWriter,
             i18n,
+            extensionsDeclarationsKey,
           }
         );
       })
-    )
-  );
+    );
+  });
+};
+
+/**
+ * The names of the free functions of the extensions, when their metadata were
+ * last entirely declared. Used to know if the metadata of a single function
+ * can be declared again (as the other functions did not change).
+ */
+const loadedFreeFunctionNames: { [extensionName: string]: string } = {};
+
+const getFreeFunctionNames = (
+  eventsFunctionsExtension: gdEventsFunctionsExtension
+): string => {
+  const freeEventsFunctions = eventsFunctionsExtension.getEventsFunctions();
+  return mapFor(0, freeEventsFunctions.getEventsFunctionsCount(), i =>
+    freeEventsFunctions.getEventsFunctionAt(i).getName()
+  ).join(';');
+};
+
+const addNewExtension = (
+  extension: gdPlatformExtension,
+  eventsFunctionsExtension: gdEventsFunctionsExtension
+) => {
+  gd.JsPlatform.get().addNewExtension(extension);
+  loadedFreeFunctionNames[
+    eventsFunctionsExtension.getName()
+  ] = getFreeFunctionNames(eventsFunctionsExtension);
 };
 
 /**
  * Load an event-function extension metadata without generating the code.
+ *
+ * If only a free function was edited, only the metadata of this function (and
+ * of the actions using it as a getter) are declared again, instead of the
+ * metadata of the whole extension.
  */
 export const reloadProjectEventsFunctionsExtensionMetadata = (
   project: gdProject,
   eventsFunctionsExtension: gdEventsFunctionsExtension,
   eventsFunctionCodeWriter: EventsFunctionCodeWriter,
-  i18n: I18nType
+  i18n: I18nType,
+  editedFreeEventsFunctionName?: ?string
 ): void => {
+  if (
+    editedFreeEventsFunctionName &&
+    reloadProjectFreeEventsFunctionMetadata(
+      project,
+      eventsFunctionsExtension,
+      editedFreeEventsFunctionName,
+      { eventsFunctionCodeWriter, i18n }
+    )
+  ) {
+    return;
+  }
+
   const extension = generateEventsFunctionExtensionMetadata(
     project,
     eventsFunctionsExtension,
     { eventsFunctionCodeWriter, i18n }
   );
-  gd.JsPlatform.get().addNewExtension(extension);
+  addNewExtension(extension, eventsFunctionsExtension);
   extension.delete();
 };
 
+/**
+ * Declare again the metadata of a free function in the extension already
+ * loaded in the platform.
+ * @returns false if the whole extension must be declared again instead.
+ */
+const reloadProjectFreeEventsFunctionMetadata = (
+  project: gdProject,
+  eventsFunctionsExtension: gdEventsFunctionsExtension,
+  eventsFunctionName: string,
+  options: Options
+): boolean => {
+  const extensionName = eventsFunctionsExtension.getName();
+  const freeEventsFunctions = eventsFunctionsExtension.getEventsFunctions();
+  const platform = gd.JsPlatform.get();
+  if (
+    !freeEventsFunctions.hasEventsFunctionNamed(eventsFunctionName) ||
+    !platform.isExtensionLoaded(extensionName) ||
+    // Functions were added, removed or renamed: the include files of all
+    // functions must be updated.
+    loadedFreeFunctionNames[extensionName] !==
+      getFreeFunctionNames(eventsFunctionsExtension)
+  ) {
+    return false;
+  }
+
+  const codeGenerationContext = {
+    codeNamespacePrefix: gd.MetadataDeclarationHelper.getExtensionCodeNamespacePrefix(
+      eventsFunctionsExtension
+    ),
+    extensionIncludeFiles: getExtensionIncludeFiles(
+      project,
+      eventsFunctionsExtension,
+      options
+    ),
+  };
+
+  // Actions with an operator are declared from their getter.
+  const eventsFunctionsToDeclare = mapFor(
+    0,
+    freeEventsFunctions.getEventsFunctionsCount(),
+    i => freeEventsFunctions.getEventsFunctionAt(i)
+  ).filter(
+    eventsFunction =>
+      eventsFunction.getName() === eventsFunctionName ||
+      (eventsFunction.getFunctionType() ===
+        gd.EventsFunction.ActionWithOperator &&
+        eventsFunction.getGetterName() === eventsFunctionName)
+  );
+
+  const extension = platform.getExtensionToUpdate(extensionName);
+  const metadataDeclarationHelper = new gd.MetadataDeclarationHelper();
+  eventsFunctionsToDeclare.forEach(eventsFunction => {
+    // The function type may have changed.
+    extension.removeInstructionsAndExpressions(eventsFunction.getName());
+    generateFreeFunctionMetadata(
+      project,
+      extension,
+      eventsFunctionsExtension,
+      eventsFunction,
+      options,
+      codeGenerationContext,
+      metadataDeclarationHelper
+    );
+  });
+  metadataDeclarationHelper.delete();
+  platform.notifyExtensionChanged(extensionName);
+  return true;
+};
+
 const loadProjectEventsFunctionsExtension = (
   project: gdProject,
   eventsFunctionsExtension: gdEventsFunctionsExtension,
@@ -101,7 +293,7 @@ const loadProjectEventsFunctionsExtension = (
     eventsFunctionsExtension,
     options
   ).then(extension => {
-    gd.JsPlatform.get().addNewExtension(extension);
+    addNewExtension(extension, eventsFunctionsExtension);
     extension.delete();
   });
 };
@@ -134,8 +326,21 @@ const getExtensionIncludeFiles = (
 const generateEventsFunctionExtension = (
   project: gdProject,
   eventsFunctionsExtension: gdEventsFunctionsExtension,
-  options: OptionsForGeneration
+  optionsForExtensions: OptionsForGeneration
 ): Promise<gdPlatformExtension> => {
+  const { extensionsDeclarationsKey } = optionsForExtensions;
+  const options =
+    !optionsForExtensions.skipCodeGeneration && extensionsDeclarationsKey
+      ? {
+          ...optionsForExtensions,
+          writtenCode: getWrittenExtensionCode(
+            optionsForExtensions.eventsFunctionCodeWriter,
+            eventsFunctionsExtension,
+            extensionsDeclarationsKey
+          ),
+        }
+      : optionsForExtensions;
+
   const extension = new gd.PlatformExtension();
   gd.MetadataDeclarationHelper.declareExtension(
     extension,
@@ -323,6 +528,22 @@ const generateFreeFunction = (
   );
 
   if (!options.skipCodeGeneration) {
+    const functionName = gd.MetadataDeclarationHelper.getFreeFunctionCodeName(
+      eventsFunctionsExtension,
+      eventsFunction
+    );
+    const writtenRequiredIncludeFiles = getRequiredIncludeFilesOfWrittenCode(
+      options,
+      functionName
+    );
+    if (writtenRequiredIncludeFiles) {
+      writtenRequiredIncludeFiles.forEach(includeFile => {
+        functionMetadata.addIncludeFile(includeFile);
+      });
+      metadataDeclarationHelper.delete();
+      return Promise.resolve();
+    }
+
     const includeFiles = new gd.SetString();
     const eventsFunctionsExtensionCodeGenerator = new gd.EventsFunctionsExtensionCodeGenerator(
       project
@@ -345,24 +566,20 @@ const generateFreeFunction = (
     // Add any include file required by the function to the list
     // of include files for this function (so that when used, the "dependencies"
     // are transitively included).
-    includeFiles
-      .toNewVectorString()
-      .toJSArray()
-      .forEach((includeFile: string) => {
-        functionMetadata.addIncludeFile(includeFile);
-      });
+    const requiredIncludeFiles = includeFiles.toNewVectorString().toJSArray();
+    requiredIncludeFiles.forEach((includeFile: string) => {
+      functionMetadata.addIncludeFile(includeFile);
+    });
 
     includeFiles.delete();
     eventsFunctionsExtensionCodeGenerator.delete();
     metadataDeclarationHelper.delete();
 
-    const functionName = gd.MetadataDeclarationHelper.getFreeFunctionCodeName(
-      eventsFunctionsExtension,
-      eventsFunction
-    );
     return options.eventsFunctionCodeWriter
       .writeFunctionCode(functionName, code)
-      .then(() => {});
+      .then(() => {
+        storeWrittenCode(options, functionName, requiredIncludeFiles);
+      });
   } else {
     // Skip code generation if no events function writer is provided.
     // This is the case during the "first pass", where all events functions extensions
@@ -440,6 +657,18 @@ function generateBehavior(
         eventsBasedBehavior,
         codeGenerationContext.codeNamespacePrefix
       );
+      const writtenRequiredIncludeFiles = getRequiredIncludeFilesOfWrittenCode(
+        options,
+        codeNamespace
+      );
+      if (writtenRequiredIncludeFiles) {
+        writtenRequiredIncludeFiles.forEach(includeFile => {
+          behaviorMetadata.addIncludeFile(includeFile);
+        });
+        behaviorMethodMangledNames.delete();
+        return Promise.resolve();
+      }
+
       const includeFiles = new gd.SetString();
       const behaviorCodeGenerator = new gd.BehaviorCodeGenerator(project);
       const code = behaviorCodeGenerator.generateRuntimeBehaviorCompleteCode(
@@ -460,19 +689,18 @@ function generateBehavior(
       // Add any include file required by the functions to the list
       // of include files for this behavior (so that when used, the "dependencies"
       // are transitively included).
-      includeFiles
-        .toNewVectorString()
-        .toJSArray()
-        .forEach((includeFile: string) => {
-          behaviorMetadata.addIncludeFile(includeFile);
-        });
+      const requiredIncludeFiles = includeFiles.toNewVectorString().toJSArray();
+      requiredIncludeFiles.forEach((includeFile: string) => {
+        behaviorMetadata.addIncludeFile(includeFile);
+      });
 
       includeFiles.delete();
 
-      return options.eventsFunctionCodeWriter.writeBehaviorCode(
-        codeNamespace,
-        code
-      );
+      return options.eventsFunctionCodeWriter
+        .writeBehaviorCode(codeNamespace, code)
+        .then(() => {
+          storeWrittenCode(options, codeNamespace, requiredIncludeFiles);
+        });
     } else {
       // Skip code generation
       behaviorMethodMangledNames.delete();
@@ -542,6 +770,18 @@ function generateObject(
         eventsBasedObject,
         codeGenerationContext.codeNamespacePrefix
       );
+      const writtenRequiredIncludeFiles = getRequiredIncludeFilesOfWrittenCode(
+        options,
+        codeNamespace
+      );
+      if (writtenRequiredIncludeFiles) {
+        writtenRequiredIncludeFiles.forEach(includeFile => {
+          objectMetadata.addIncludeFile(includeFile);
+        });
+        objectMethodMangledNames.delete();
+        return Promise.resolve();
+      }
+
       const includeFiles = new gd.SetString();
       const objectCodeGenerator = new gd.ObjectCodeGenerator(project);
       const code = objectCodeGenerator.generateRuntimeObjectCompleteCode(
@@ -562,19 +802,18 @@ function generateObject(
       // Add any include file required by the functions to the list
       // of include files for this object (so that when used, the "dependencies"
       // are transitively included).
-      includeFiles
-        .toNewVectorString()
-        .toJSArray()
-        .forEach((includeFile: string) => {
-          objectMetadata.addIncludeFile(includeFile);
-        });
+      const requiredIncludeFiles = includeFiles.toNewVectorString().toJSArray();
+      requiredIncludeFiles.forEach((includeFile: string) => {
+        objectMetadata.addIncludeFile(includeFile);
+      });
 
       includeFiles.delete();
 
-      return options.eventsFunctionCodeWriter.writeObjectCode(
-        codeNamespace,
-        code
-      );
+      return options.eventsFunctionCodeWriter
+        .writeObjectCode(codeNamespace, code)
+        .then(() => {
+          storeWrittenCode(options, codeNamespace, requiredIncludeFiles);
+        });
     } else {
       // Skip code generation
       objectMethodMangledNames.delete();
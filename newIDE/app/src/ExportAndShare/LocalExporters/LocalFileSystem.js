@@ -184,6 +184,47 @@ class LocalFileSystem {
     }
     return true;
   };
+  /**
+   * The file descriptors of the files opened with `openForWrite`.
+   * @private
+   */
+  _openedFiles: { [string]: number } = {};
+
+  openForWrite = (file: string) => {
+    try {
+      fs.ensureDirSync(path.dirname(file));
+      this._openedFiles[file] = fs.openSync(file, 'w');
+    } catch (e) {
+      console.error('openForWrite(' + file + ') failed: ' + e);
+      return false;
+    }
+    return true;
+  };
+  append = (file: string, contents: string) => {
+    const fd = this._openedFiles[file];
+    if (fd === undefined) return false;
+
+    try {
+      fs.writeSync(fd, contents);
+    } catch (e) {
+      console.error('append(' + file + ', ...) failed: ' + e);
+      return false;
+    }
+    return true;
+  };
+  close = (file: string) => {
+    const fd = this._openedFiles[file];
+    if (fd === undefined) return false;
+
+    delete this._openedFiles[file];
+    try {
+      fs.closeSync(fd);
+    } catch (e) {
+      console.error('close(' + file + ') failed: ' + e);
+      return false;
+    }
+    return true;
+  };
   readFile = (file: string) => {
     try {
       var contents = fs.readFileSync(file);
@@ -69,6 +69,16 @@ export default class LocalPreviewLauncher extends React.Component<
   };
   _networkPreviewSubscriptionChecker: ?SubscriptionCheckerInterface = null;
   _hotReloadSubscriptionChecker: ?SubscriptionCheckerInterface = null;
+  // Keep the code generated for scenes between previews, so that only the
+  // modified scenes are generated again.
+  _codeGenerationCache: ?gdLayoutCodeGenerationCache = null;
+
+  componentWillUnmount() {
+    if (this._codeGenerationCache) {
+      this._codeGenerationCache.delete();
+      this._codeGenerationCache = null;
+    }
+  }
 
   _openPreviewBrowserWindow = () => {
     const {
@@ -188,6 +198,10 @@ export default class LocalPreviewLauncher extends React.Component<
       );
       const outputDir = path.join(fileSystem.getTempDir(), 'preview');
       const exporter = new gd.Exporter(fileSystem, gdjsRoot);
+      if (!this._codeGenerationCache) {
+        this._codeGenerationCache = new gd.LayoutCodeGenerationCache();
+      }
+      exporter.setCodeGenerationCache(this._codeGenerationCache);
 
       return {
         outputDir,
@@ -91,7 +91,8 @@ export type RenderEditorContainerProps = {|
   // Events function management:
   onLoadEventsFunctionsExtensions: () => Promise<void>,
   onReloadEventsFunctionsExtensionMetadata: (
-    extension: gdEventsFunctionsExtension
+    extension: gdEventsFunctionsExtension,
+    editedFreeEventsFunctionName?: ?string
   ) => void,
   onCreateEventsFunction: (
     extensionName: string,
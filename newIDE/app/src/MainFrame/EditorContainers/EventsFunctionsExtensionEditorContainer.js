@@ -80,14 +80,17 @@ export class EventsFunctionsExtensionEditorContainer extends React.Component<Ren
     }
   }
 
-  _reloadExtensionMetadata = () => {
+  _reloadExtensionMetadata = (editedFreeEventsFunctionName?: ?string) => {
     // Immediately trigger the reload/regeneration of the extension
     // as a change in function declaration must be seen in the instructions
     // especially to avoid to show "unsupported instructions".
     try {
       const extension = this.getEventsFunctionsExtension();
       if (extension) {
-        this.props.onReloadEventsFunctionsExtensionMetadata(extension);
+        this.props.onReloadEventsFunctionsExtensionMetadata(
+          extension,
+          editedFreeEventsFunctionName
+        );
       }
     } catch (error) {
       console.warn(
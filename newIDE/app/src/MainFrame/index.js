@@ -4087,13 +4087,17 @@ const MainFrame = (props: Props) => {
                         currentProject
                       );
                     },
-                    onReloadEventsFunctionsExtensionMetadata: extension => {
+                    onReloadEventsFunctionsExtensionMetadata: (
+                      extension,
+                      editedFreeEventsFunctionName
+                    ) => {
                       if (isProjectClosedSoAvoidReloadingExtensions) {
                         return;
                       }
                       eventsFunctionsExtensionsState.reloadProjectEventsFunctionsExtensionMetadata(
                         currentProject,
-                        extension
+                        extension,
+                        editedFreeEventsFunctionName
                       );
                     },
                     onDeleteResource: (
@@ -15,7 +15,6 @@ import {
   openBlobDownloadUrl,
 } from '../Utils/BlobDownloadUrlHolder';
 import PlaceholderLoader from '../UI/PlaceholderLoader';
-import { serializeToObjectAsset } from '../Utils/Serializer';
 import { showErrorBox } from '../UI/Messages/MessageBox';
 import { downloadUrlsToBlobs, type ItemResult } from '../Utils/BlobDownloader';
 import { useGenericRetryableProcessWithProgress } from '../Utils/UseGenericRetryableProcessWithProgress';
@@ -27,6 +26,8 @@ import {
 } from '../Utils/BrowserArchiver';
 import ResourcesLoader from '../ResourcesLoader';
 
+const gd: libGDevelop = global.gd;
+
 const excludedObjectType = [
   'BBText::BBText',
   'Lighting::LightObject',
@@ -158,17 +159,20 @@ const zipAssets = async (
 ): Promise<Blob | null> => {
   const blobFiles = new Map<string, BlobFileDescriptor>();
   const textFiles: Array<TextFileDescriptor> = [];
+  // Resources and variants used by several objects are serialized once.
+  const packSerializer = new gd.ObjectAssetsPackSerializer(project);
 
   try {
     await Promise.all(
       enumeratedObjects.map(async ({ object, path }) => {
-        const usedResourceNames: Array<string> = [];
-        const serializedObject = serializeToObjectAsset(
-          project,
+        const usedResourceNamesVector = new gd.VectorString();
+        const assetJson = packSerializer.serializeAssetToJSON(
           object,
           addSpacesToPascalCase(object.getName()),
-          usedResourceNames
+          usedResourceNamesVector
         );
+        const usedResourceNames = usedResourceNamesVector.toJSArray();
+        usedResourceNamesVector.delete();
 
         // Download resources to blobs and update the resources.
         const blobByResourceName: Map<string, Blob> = new Map();
@@ -188,7 +192,7 @@ const zipAssets = async (
         }
 
         textFiles.push({
-          text: JSON.stringify(serializedObject, null, 2),
+          text: assetJson,
           filePath: 'objects/' + path + object.getName() + '.asset.json',
         });
       })
@@ -208,6 +212,8 @@ const zipAssets = async (
       errorId: 'download-file-save-as-dialog-error',
     });
     return null;
+  } finally {
+    packSerializer.delete();
   }
 };
 
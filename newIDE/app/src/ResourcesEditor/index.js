@@ -150,19 +150,17 @@ export default class ResourcesEditor extends React.Component<Props, State> {
       ? this.state.selectedResource.getName()
       : null;
 
-    const removedResourceNames = gd.ProjectResourcesAdder.getAllUseless(
+    const removedResourceNames = gd.ProjectResourcesAdder.removeAllUseless(
       project,
       resourceKind
     ).toJSArray();
     console.info(
-      `Removing ${
+      `Removed ${
         removedResourceNames.length
       } unused ${resourceKind} resource(s):`,
       removedResourceNames
     );
 
-    gd.ProjectResourcesAdder.removeAllUseless(project, resourceKind);
-
     // The selectedResource might be *invalid* now if it was removed.
     // Be sure to drop the reference to it if that's the case.
     if (removedResourceNames.includes(selectedResourceName)) {